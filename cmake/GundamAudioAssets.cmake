@@ -0,0 +1,148 @@
+# Audio asset pipeline: converts the clips in assets/audio/ at build time and
+# links them into the firmware as one binary pack (tools/audio/audiopack.py).
+#
+#   gundam_add_audio_assets(<target> PACK <name>
+#       CLIP <clip name> <source file> [wav2cpp options...]
+#       ...)
+#
+# Each CLIP is converted by its own custom command into
+# <build>/audio/<pack>/<clip name>.clip, depending on the source file, the
+# converter scripts and a stamp of its options, so an edit-build cycle only
+# reconverts the clips that actually changed.  The converted clips are then
+# joined into <pack>.pack, with a generated .incbin stub that links its
+# payloads (not its header and clip table) into flash, and the registry
+# header <pack>_pack.h: the symbols <pack>_pack and <pack>_pack_end
+# around the payloads, a ClipId per clip in declaration order, the constexpr
+# CLIP_TABLE of ClipDescriptors and findClip() (see src/asset_pack.h).  The
+# header is on the target's include path; one registry per target.
+#
+# Source files are relative to the calling CMakeLists.txt.  Requires Python 3;
+# OGG/MP3 sources also need pydub (tools/audio/requirements.txt) and FFmpeg,
+# both checked at configure time.
+
+find_package(Python3 COMPONENTS Interpreter REQUIRED)
+
+set(GUNDAM_AUDIO_TOOLS ${CMAKE_CURRENT_LIST_DIR}/../tools/audio)
+
+# Fail at configure time, not on the first conversion, if the decoders for
+# compressed sources are missing.  pydub runs the ffmpeg on PATH.
+function(_gundam_audio_check_decoders)
+    find_program(GUNDAM_FFMPEG_EXECUTABLE ffmpeg)
+    if(NOT GUNDAM_FFMPEG_EXECUTABLE)
+        message(FATAL_ERROR "gundam_add_audio_assets: FFmpeg not found.  "
+                "OGG/MP3 clips are decoded with FFmpeg: install it and put "
+                "ffmpeg on your PATH.")
+    endif()
+
+    if(NOT GUNDAM_AUDIO_PYDUB_FOUND)
+        execute_process(
+            COMMAND ${Python3_EXECUTABLE} -c "import pydub"
+            RESULT_VARIABLE result
+            OUTPUT_QUIET ERROR_QUIET
+        )
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "gundam_add_audio_assets: ${Python3_EXECUTABLE} "
+                    "cannot import pydub.  OGG/MP3 clips need it: run "
+                    "pip install -r tools/audio/requirements.txt")
+        endif()
+        set(GUNDAM_AUDIO_PYDUB_FOUND TRUE CACHE INTERNAL "pydub importable")
+    endif()
+endfunction()
+
+function(gundam_add_audio_assets target)
+    set(tools ${GUNDAM_AUDIO_TOOLS}/audiopack.py ${GUNDAM_AUDIO_TOOLS}/wav2cpp.py)
+
+    # Split the arguments into PACK <name> and one group per CLIP; the
+    # options are passed to audiopack.py as they are, so no
+    # cmake_parse_arguments() (it would take --rate etc. as values)
+    set(pack "")
+    set(clip_names "")
+    set(group "")
+    set(in_clip FALSE)
+    foreach(arg IN LISTS ARGN ITEMS CLIP)
+        if(arg STREQUAL "PACK")
+            set(group PACK)
+        elseif(group STREQUAL "PACK")
+            set(pack ${arg})
+            set(group "")
+        elseif(arg STREQUAL "CLIP")
+            if(group)
+                list(GET group 0 name)
+                list(APPEND clip_names ${name})
+                set(clip_${name} ${group})
+            endif()
+            set(group "")
+            set(in_clip TRUE)
+        elseif(in_clip)
+            list(APPEND group ${arg})
+        else()
+            message(FATAL_ERROR "gundam_add_audio_assets: unexpected argument '${arg}'")
+        endif()
+    endforeach()
+    if(NOT pack OR NOT clip_names)
+        message(FATAL_ERROR "gundam_add_audio_assets: needs PACK <name> and at least one CLIP")
+    endif()
+
+    set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/audio/${pack})
+    set(pack_file ${out_dir}/${pack}.pack)
+    set(header ${out_dir}/${pack}_pack.h)
+    set(stub ${out_dir}/${pack}_pack.S)
+    set(converted "")
+    set(compressed FALSE)
+
+    foreach(name IN LISTS clip_names)
+        set(group ${clip_${name}})
+        list(LENGTH group length)
+        if(length LESS 2)
+            message(FATAL_ERROR "gundam_add_audio_assets: CLIP ${name} needs a source file")
+        endif()
+        list(GET group 1 source)
+        set(options "")
+        if(length GREATER 2)
+            list(SUBLIST group 2 -1 options)
+        endif()
+        get_filename_component(source ${source} ABSOLUTE)
+        string(TOLOWER "${source}" lower)
+        if(NOT lower MATCHES "\\.wav$")
+            set(compressed TRUE)
+        endif()
+        set(output ${out_dir}/${name}.clip)
+
+        # Makefile generators do not rerun a command when only its options
+        # change, so the options go into a stamp that is rewritten only
+        # when they differ
+        set(stamp ${out_dir}/${name}.options)
+        file(WRITE ${stamp}.tmp "${source} ${options}\n")
+        configure_file(${stamp}.tmp ${stamp} COPYONLY)
+
+        add_custom_command(
+            OUTPUT ${output}
+            COMMAND Python3::Interpreter ${GUNDAM_AUDIO_TOOLS}/audiopack.py
+                    clip ${name} ${source} ${output} ${options}
+            DEPENDS ${source} ${stamp} ${tools}
+            COMMENT "Converting audio clip ${name}"
+            VERBATIM
+        )
+        list(APPEND converted ${output})
+    endforeach()
+
+    if(compressed)
+        _gundam_audio_check_decoders()
+    endif()
+
+    # The stub is written with the pack, with a label at every clip for
+    # the descriptor table.  OBJECT_DEPENDS reassembles it when the pack
+    # changes (.incbin is invisible to the dependency scanner).
+    add_custom_command(
+        OUTPUT ${pack_file} ${header} ${stub}
+        COMMAND Python3::Interpreter ${GUNDAM_AUDIO_TOOLS}/audiopack.py
+                link ${pack_file} ${converted} --header ${header} --stub ${stub}
+        DEPENDS ${converted} ${tools}
+        COMMENT "Linking audio pack ${pack}"
+        VERBATIM
+    )
+    set_source_files_properties(${stub} PROPERTIES OBJECT_DEPENDS ${pack_file})
+
+    target_sources(${target} PRIVATE ${stub} ${header})
+    target_include_directories(${target} PRIVATE ${out_dir})
+endfunction()
@@ -0,0 +1,13 @@
+#ifndef HOST_HARDWARE_PIO_H
+#define HOST_HARDWARE_PIO_H
+
+// Host stand-in: NeoPixel keeps PIO handles as members, but the capture
+// backend never touches them.
+typedef struct pio_hw pio_hw_t;
+typedef pio_hw_t *PIO;
+typedef struct pio_program pio_program_t;
+
+#define pio0 ((PIO)0)
+#define pio1 ((PIO)0)
+
+#endif // HOST_HARDWARE_PIO_H
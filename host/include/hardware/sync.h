@@ -0,0 +1,11 @@
+#ifndef HOST_HARDWARE_SYNC_H
+#define HOST_HARDWARE_SYNC_H
+
+#include <stdint.h>
+
+// Host stand-in: the simulator is single-threaded and has no interrupts,
+// so critical sections are no-ops.
+static inline uint32_t save_and_disable_interrupts() { return 0; }
+static inline void restore_interrupts(uint32_t) {}
+
+#endif // HOST_HARDWARE_SYNC_H
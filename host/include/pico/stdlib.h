@@ -0,0 +1,70 @@
+#ifndef HOST_PICO_STDLIB_H
+#define HOST_PICO_STDLIB_H
+
+// ---------------------------------------------------------------------------
+// Host stand-in for the subset of pico/stdlib.h the animation engine uses.
+// Time comes from the simulated clock in mock_time.cpp: sleeping jumps
+// straight to the deadline, so hours of run time pass in milliseconds.
+// ---------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+// Same representation as the SDK's non-opaque absolute_time_t
+typedef uint64_t absolute_time_t;
+
+typedef int32_t alarm_id_t;
+typedef struct alarm_pool alarm_pool_t;
+
+static const absolute_time_t at_the_end_of_time = INT64_MAX;
+static const absolute_time_t nil_time = 0;
+
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline absolute_time_t from_us_since_boot(uint64_t us) { return us; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+
+static inline bool is_at_the_end_of_time(absolute_time_t t) {
+    return t == at_the_end_of_time;
+}
+
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us) {
+    uint64_t delayed = t + us;
+    // Saturate at the end of time, like the SDK
+    if ((int64_t)delayed < 0 || delayed < t) {
+        delayed = INT64_MAX;
+    }
+    return delayed;
+}
+
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms) {
+    return delayed_by_us(t, (uint64_t)ms * 1000);
+}
+
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) {
+    return (int64_t)(to - from);
+}
+
+static inline absolute_time_t absolute_time_min(absolute_time_t a, absolute_time_t b) {
+    return a < b ? a : b;
+}
+
+// Simulated clock (mock_time.cpp)
+absolute_time_t get_absolute_time();
+uint32_t time_us_32();
+uint64_t time_us_64();
+bool time_reached(absolute_time_t t);
+bool best_effort_wfe_or_timeout(absolute_time_t timeout);
+void busy_wait_us(uint64_t us);
+
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) {
+    return delayed_by_ms(get_absolute_time(), ms);
+}
+
+// The simulator is single-threaded and reports as core0
+static inline uint get_core_num() { return 0; }
+static inline void tight_loop_contents() {}
+
+#endif // HOST_PICO_STDLIB_H
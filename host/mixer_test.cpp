@@ -0,0 +1,130 @@
+// ---------------------------------------------------------------------------
+// Host test of the mixer gain stage (src/mixer.h), the code the I2SAudio
+// refill IRQ runs for every voice.
+//
+// Ramps up, ramps down and holds at the extremes of the gain range on
+// full-scale input, checking every sample against a double-precision
+// reference.  Built with the undefined-behaviour sanitizer where the
+// compiler has it, so an overflowing or negative shift fails the test.
+//
+//   mixer_test
+// ---------------------------------------------------------------------------
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "mixer.h"
+
+static const uint32_t BLOCK = 256;           // frames per buffer, as I2SAudio
+static const int32_t GAIN_UNITY = 0x8000;
+
+static uint failures = 0;
+
+static void fail(const char *fmt, ...) {
+    if (failures++ < 20) {
+        va_list args;
+        va_start(args, fmt);
+        printf("FAIL: ");
+        vprintf(fmt, args);
+        printf("\n");
+        va_end(args);
+    }
+}
+
+// Full-scale input: alternating extremes, so both signs see the top gain
+static void full_scale(int16_t *src, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        src[i] = (i & 1) ? INT16_MAX : INT16_MIN;
+    }
+}
+
+// Sample i of a g0 -> g1 ramp over `count` steps, within 2 LSB of the
+// exact linear gain (one for the Q15 gain, one for the product)
+static void check_ramp(const char *what, const int32_t *mix, const int16_t *src,
+                       uint32_t count, uint32_t stride, int32_t g0, int32_t g1) {
+    for (uint32_t i = 0; i < count; i++) {
+        double gain = g0 + (double)(g1 - g0) * i / count;
+        for (uint32_t c = 0; c < stride; c++) {
+            double expected = src[i * stride + c] * gain / 32768.0;
+            double got = mix[i * stride + c];
+            if (got < expected - 2.0 || got > expected + 2.0) {
+                fail("%s: sample %u is %.0f, expected %.1f", what, i, got, expected);
+                return;
+            }
+        }
+    }
+}
+
+static void test_ramp(const char *what, int32_t g0, int32_t g1) {
+    int16_t src[BLOCK * 2];
+    int32_t mix[BLOCK * 2];
+    full_scale(src, BLOCK * 2);
+
+    for (uint32_t i = 0; i < BLOCK; i++) mix[i] = 0;
+    mixScaled(mix, src, BLOCK, g0, g1);
+    check_ramp(what, mix, src, BLOCK, 1, g0, g1);
+
+    for (uint32_t i = 0; i < BLOCK * 2; i++) mix[i] = 0;
+    mixScaledStereo(mix, src, BLOCK, g0, g1);
+    check_ramp(what, mix, src, BLOCK, 2, g0, g1);
+}
+
+static void test_gain_product() {
+    if (mixGain(GAIN_UNITY, GAIN_UNITY) != GAIN_UNITY) {
+        fail("unity x unity is 0x%x", (unsigned)mixGain(GAIN_UNITY, GAIN_UNITY));
+    }
+    if (mixGain(0xFFFF, GAIN_UNITY) != 0xFFFF) {
+        fail("0xFFFF x unity is 0x%x", (unsigned)mixGain(0xFFFF, GAIN_UNITY));
+    }
+    if (mixGain(0xFFFF, 0xFFFF) != MIX_GAIN_MAX) {
+        fail("0xFFFF x 0xFFFF is 0x%x, not clamped", (unsigned)mixGain(0xFFFF, 0xFFFF));
+    }
+    if (mixGain(0x4000, 0) != 0) {
+        fail("master 0 does not silence");
+    }
+}
+
+// Both gains at 0xFFFF: the clamped product on full-scale input, summed
+// over every voice and saturated the way fillBuffer() does it
+static void test_max_gain_mix() {
+    const uint voices = 4;
+    int16_t src[BLOCK];
+    int32_t mix[BLOCK] = {};
+    full_scale(src, BLOCK);
+
+    int32_t g = mixGain(0xFFFF, 0xFFFF);
+    for (uint v = 0; v < voices; v++) {
+        mixScaled(mix, src, BLOCK, g, g);
+    }
+    for (uint32_t i = 0; i < BLOCK; i++) {
+        int32_t expected = (int32_t)voices * ((src[i] * MIX_GAIN_MAX) >> 15);
+        if (mix[i] != expected) {
+            fail("max gain: sample %u is %d, expected %d", i, mix[i], expected);
+            break;
+        }
+        int16_t out = saturate16(mix[i]);
+        if (out != (src[i] < 0 ? INT16_MIN : INT16_MAX)) {
+            fail("max gain: sample %u saturates to %d", i, out);
+            break;
+        }
+    }
+}
+
+int main() {
+    test_gain_product();
+
+    test_ramp("ramp up from silence", 0, MIX_GAIN_MAX);
+    test_ramp("ramp down to silence", MIX_GAIN_MAX, 0);     // fadeOut(), stop()
+    test_ramp("ramp up to unity", 0x1000, GAIN_UNITY);
+    test_ramp("ramp down from unity", GAIN_UNITY, 0);
+    test_ramp("short ramp down", mixGain(0xFFFF, 0xFFFF), 1);
+    test_ramp("hold at max", MIX_GAIN_MAX, MIX_GAIN_MAX);
+    test_max_gain_mix();
+
+    if (failures) {
+        printf("%u check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("All mixer checks passed\n");
+    return 0;
+}
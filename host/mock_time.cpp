@@ -0,0 +1,45 @@
+#include "mock_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static absolute_time_t now_us = 0;
+
+void mock_time_set(absolute_time_t t) {
+    if (t > now_us) {
+        now_us = t;
+    }
+}
+
+void mock_time_advance_us(uint64_t us) {
+    mock_time_set(delayed_by_us(now_us, us));
+}
+
+absolute_time_t get_absolute_time() {
+    return now_us;
+}
+
+uint32_t time_us_32() {
+    return (uint32_t)now_us;
+}
+
+uint64_t time_us_64() {
+    return now_us;
+}
+
+bool time_reached(absolute_time_t t) {
+    return now_us >= t;
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t timeout) {
+    // Nothing else runs in the simulator, so nothing could ever wake us
+    if (is_at_the_end_of_time(timeout)) {
+        fprintf(stderr, "mock_time: sleep until the end of time (deadlock)\n");
+        abort();
+    }
+    mock_time_set(timeout);
+    return true;
+}
+
+void busy_wait_us(uint64_t us) {
+    mock_time_advance_us(us);
+}
@@ -0,0 +1,17 @@
+#ifndef MOCK_TIME_H
+#define MOCK_TIME_H
+
+#include "pico/stdlib.h"
+
+// ---------------------------------------------------------------------------
+// Simulated time base behind the host pico/stdlib.h.  Starts at boot (0);
+// WFE sleeps and busy waits advance it instantly to their deadline.
+// ---------------------------------------------------------------------------
+
+// Jump the clock to `t` (never backwards)
+void mock_time_set(absolute_time_t t);
+
+// Move the clock forward by `us`
+void mock_time_advance_us(uint64_t us);
+
+#endif // MOCK_TIME_H
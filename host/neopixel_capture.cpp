@@ -0,0 +1,31 @@
+#include "neopixel_capture.h"
+
+static NeoPixelCaptureCallback capture_cb = nullptr;
+static void *capture_user = nullptr;
+
+void neopixel_capture_set_callback(NeoPixelCaptureCallback callback,
+                                   void *user_data) {
+    capture_cb   = callback;
+    capture_user = user_data;
+}
+
+void NeoPixel::initOutput() {
+}
+
+void NeoPixel::releaseOutput() {
+}
+
+void NeoPixel::setAlarmPool(alarm_pool_t *pool) {
+    alarm_pool_ = pool;
+}
+
+void NeoPixel::transmitFrame() {
+    if (capture_cb) {
+        capture_cb(*this, get_absolute_time(), stream_[front_], stream_words_, capture_user);
+    }
+    // The wire time is not simulated: the frame latches immediately
+    busy_ = false;
+    if (frame_done_cb_) {
+        frame_done_cb_(frame_done_user_);
+    }
+}
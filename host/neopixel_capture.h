@@ -0,0 +1,21 @@
+#ifndef NEOPIXEL_CAPTURE_H
+#define NEOPIXEL_CAPTURE_H
+
+#include "neopixel.h"
+
+// ---------------------------------------------------------------------------
+// Host output backend for NeoPixel: instead of PIO + DMA, every frame that
+// show() sends is handed to a capture callback together with the simulated
+// time.  `stream` is exactly what the firmware would clock out: corrected
+// wire words (or bit-planes in parallel mode).
+// ---------------------------------------------------------------------------
+typedef void (*NeoPixelCaptureCallback)(const NeoPixel &strip,
+                                        absolute_time_t time,
+                                        const uint32_t *stream, uint words,
+                                        void *user_data);
+
+// Route frames from every strip to `callback` (nullptr to discard)
+void neopixel_capture_set_callback(NeoPixelCaptureCallback callback,
+                                   void *user_data = nullptr);
+
+#endif // NEOPIXEL_CAPTURE_H
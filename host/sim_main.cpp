@@ -0,0 +1,475 @@
+// ---------------------------------------------------------------------------
+// Host simulation of the Gundam head light show.
+//
+// Runs the real LedShow / GreenEyesScheduler / FrameClock code against the
+// simulated clock and the capture NeoPixel backend: both firmware loops
+// (core1 rendering, core0 control) are folded into one, exactly as they
+// interleave on the tick grid.  Audio is simulated as far as the eyes see
+// it: clips of the pack's lengths, playing from when main() starts them,
+// with a synthetic envelope.  Every sent frame is recorded and checked for
+// timing and colour; the process exits non-zero on any regression.
+//
+//   gundam_sim [--hours H] [--seed N] [--verbose]
+// ---------------------------------------------------------------------------
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "mock_time.h"
+#include "neopixel_capture.h"
+#include "frame_clock.h"
+#include "led_show.h"
+#include "green_eyes.h"
+
+// Same settings as src/main.cpp
+#define NEOPIXEL_PIN 26
+#define NUM_PIXELS LedShow::NUM_PIXELS
+#define LED_FPS 50
+
+static const uint64_t FRAME_US = 1000000 / LED_FPS;
+static const uint64_t SECOND_US = 1000000;
+
+// Clips the eyes follow (clip_03, clip_05 in the pack: 44.1 kHz,
+// `--envelope 50`)
+static const uint32_t AUDIO_RATE = 44100;
+static const uint32_t ENVELOPE_RATE = LED_FPS;
+static const uint32_t EYES_CLIP_FRAMES  = 53204;    // 1.2 s
+static const uint32_t THEME_CLIP_FRAMES = 206755;   // 4.7 s
+
+typedef WireFormat<ColorOrder::RGB, 3> Wire;
+
+struct Rgb {
+    uint8_t r, g, b;
+    bool operator==(const Rgb &o) const { return r == o.r && g == o.g && b == o.b; }
+    bool operator!=(const Rgb &o) const { return !(*this == o); }
+};
+
+struct Frame {
+    uint64_t time_us;
+    Rgb px[NUM_PIXELS];
+};
+
+struct Hold {
+    uint64_t on_us;
+    uint64_t off_us;   // 0 while still on when the run ends
+};
+
+// A clip the eyes pulsed with, and the colour they pulsed in
+struct Pulse {
+    uint64_t start_us;  // clip start
+    uint64_t first_us;  // first tick drawn
+    uint64_t end_us;    // tick the pulse finished (0: still running)
+    uint32_t frames;
+    Rgb full;           // logical colour at level 255
+};
+
+static std::vector<Frame> frames;
+static std::vector<Hold> holds;
+static std::vector<Pulse> pulses;
+static uint failures = 0;
+static bool verbose = false;
+
+static void fail(const char *fmt, ...) {
+    if (failures++ < 20) {
+        va_list args;
+        va_start(args, fmt);
+        printf("FAIL: ");
+        vprintf(fmt, args);
+        printf("\n");
+        va_end(args);
+    }
+}
+
+// Record each frame as the colours that went out on the wire
+static void capture(const NeoPixel &strip, absolute_time_t time,
+                    const uint32_t *stream, uint words, void *user_data) {
+    Frame f;
+    f.time_us = to_us_since_boot(time);
+    for (uint i = 0; i < NUM_PIXELS && i < words; i++) {
+        f.px[i].r = (uint8_t)(stream[i] >> Wire::R_SHIFT);
+        f.px[i].g = (uint8_t)(stream[i] >> Wire::G_SHIFT);
+        f.px[i].b = (uint8_t)(stream[i] >> Wire::B_SHIFT);
+    }
+    frames.push_back(f);
+}
+
+// Wire colour expected for a logical (gamma-encoded) show colour
+static Rgb wire(uint8_t r, uint8_t g, uint8_t b) {
+    return Rgb{GAMMA_2_2.v[r], GAMMA_2_2.v[g], GAMMA_2_2.v[b]};
+}
+
+// What the LEDs show at `t_us`: the last frame sent at or before it
+static const Frame *state_at(uint64_t t_us) {
+    const Frame *latest = nullptr;
+    size_t lo = 0, hi = frames.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (frames[mid].time_us <= t_us) {
+            latest = &frames[mid];
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return latest;
+}
+
+static bool shows(uint64_t t_us, const Rgb (&expected)[NUM_PIXELS]) {
+    const Frame *f = state_at(t_us);
+    if (!f) return false;
+    for (uint i = 0; i < NUM_PIXELS; i++) {
+        if (f->px[i] != expected[i]) return false;
+    }
+    return true;
+}
+
+static bool all_same(const Frame *f) {
+    for (uint i = 1; i < NUM_PIXELS; i++) {
+        if (f->px[i] != f->px[0]) return false;
+    }
+    return true;
+}
+
+static double seconds(uint64_t us) { return us / 1e6; }
+
+// ---------------------------------------------------------------------------
+// Simulated audio: a voice is a clip length and a start time; its position
+// is the time since the start at the clip rate, as I2SAudio::getPosition()
+// reports it.  The envelope is a ramp with a period of 0.64 s.
+// ---------------------------------------------------------------------------
+
+struct SimVoice {
+    uint64_t start_us;
+    uint32_t frames;
+};
+
+static uint8_t envelope_levels[(THEME_CLIP_FRAMES * ENVELOPE_RATE + AUDIO_RATE - 1) /
+                               AUDIO_RATE];
+
+static void init_envelope() {
+    for (uint i = 0; i < sizeof(envelope_levels); i++) {
+        envelope_levels[i] = (uint8_t)((i % 32) * 255 / 31);
+    }
+}
+
+static ClipEnvelope envelope_for(uint32_t clip_frames) {
+    uint32_t count = (clip_frames * ENVELOPE_RATE + AUDIO_RATE - 1) / AUDIO_RATE;
+    return ClipEnvelope{envelope_levels, count, ENVELOPE_RATE};
+}
+
+static uint32_t sim_clip_frame(const SimVoice &voice, uint64_t now_us) {
+    return (uint32_t)((now_us - voice.start_us) * AUDIO_RATE / SECOND_US);
+}
+
+static bool sim_position(void *ctx, uint32_t &frame) {
+    const SimVoice *voice = static_cast<const SimVoice *>(ctx);
+    frame = sim_clip_frame(*voice, to_us_since_boot(get_absolute_time()));
+    return frame < voice->frames;
+}
+
+// Start a clip and have the eyes follow it, as main() does on core0/core1
+// (`drawn`: the show updates again on this tick)
+static void play_and_follow(LedShow &show, SimVoice &voice, uint32_t clip_frames,
+                            const Rgb &full, const FrameInfo &frame, bool drawn) {
+    voice.start_us = to_us_since_boot(frame.time);
+    voice.frames   = clip_frames;
+    show.followAudio(envelope_for(clip_frames), AUDIO_RATE, sim_position, &voice, frame);
+    pulses.push_back(Pulse{voice.start_us, voice.start_us + (drawn ? 0 : FRAME_US), 0,
+                           clip_frames, full});
+}
+
+// Logical eye colour at envelope level `level` (AudioEnvelopeAnimation)
+static Rgb pulse_colour(const Rgb &full, uint8_t level) {
+    uint32_t scale = LedShow::PULSE_FLOOR + (uint32_t)(255 - LedShow::PULSE_FLOOR) * level / 255;
+    return Rgb{(uint8_t)(full.r * scale / 255), (uint8_t)(full.g * scale / 255),
+               (uint8_t)(full.b * scale / 255)};
+}
+
+static bool in_pulse(uint64_t t_us) {
+    for (const Pulse &p : pulses) {
+        if (t_us >= p.start_us && (p.end_us == 0 || t_us <= p.end_us)) return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Checks
+// ---------------------------------------------------------------------------
+
+static void check_frame_timing() {
+    for (size_t i = 0; i < frames.size(); i++) {
+        if (frames[i].time_us % FRAME_US != 0) {
+            fail("frame %zu at %.6f s is off the %llu us tick grid", i,
+                 seconds(frames[i].time_us), (unsigned long long)FRAME_US);
+        }
+        if (i > 0 && frames[i].time_us <= frames[i - 1].time_us) {
+            fail("frame %zu at %.6f s is not after the previous frame", i,
+                 seconds(frames[i].time_us));
+        }
+    }
+}
+
+static void check_boot_sequence(uint64_t steady_us) {
+    const Rgb black = {0, 0, 0};
+    const Rgb red = wire(LedShow::RED, 0, 0);
+    const Rgb all_red[NUM_PIXELS] = {red, red, red, red};
+    const Rgb all_black[NUM_PIXELS] = {black, black, black, black};
+    const Rgb yellow = wire(122, 136, 0);
+    const Rgb stable[NUM_PIXELS] = {yellow, yellow, red, red};
+
+    // Phase 1: rainbow cycle, all LEDs in unison and changing
+    const Frame *f = state_at(2500000);
+    if (!f || !all_same(f) || f->px[0] == black) {
+        fail("rainbow cycle: LEDs not lit in unison at 2.5 s");
+    }
+    uint hue_changes = 0;
+    for (size_t i = 1; i < frames.size() && frames[i].time_us < 5 * SECOND_US; i++) {
+        if (frames[i].px[0] != frames[i - 1].px[0]) hue_changes++;
+    }
+    if (hue_changes < 100) {
+        fail("rainbow cycle: only %u colour steps in 5 s", hue_changes);
+    }
+
+    // Phase 2: rainbow chase, LEDs differ
+    f = state_at(6500000);
+    if (!f || all_same(f)) {
+        fail("rainbow chase: LEDs not showing different hues at 6.5 s");
+    }
+
+    // Phase 3: solid red; phase 4: flicker, then dark
+    if (!shows(10 * SECOND_US, all_red)) {
+        fail("solid red: LEDs not red at 10 s");
+    }
+    if (!shows(14500000, all_black)) {
+        fail("flicker: LEDs not dark at 14.5 s");
+    }
+
+    // Phase 5: stable pattern from ~15 s.  Steady state is reported on the
+    // tick the pattern starts; it draws on the next one, the eyes pulsing
+    // with the theme (check_pulses()) until it ends.
+    if (steady_us < 15 * SECOND_US || steady_us > 15 * SECOND_US + 10 * FRAME_US) {
+        fail("steady state reached at %.3f s, expected ~15 s", seconds(steady_us));
+    }
+    const Frame *pattern = state_at(steady_us + FRAME_US);
+    if (!pattern || pattern->px[2] != red || pattern->px[3] != red) {
+        fail("stable pattern not showing at %.3f s", seconds(steady_us + FRAME_US));
+    }
+    if (pulses.empty() || !pulses[0].end_us || !shows(pulses[0].end_us, stable)) {
+        fail("stable pattern not showing after the theme");
+    }
+}
+
+static void check_green_eyes(uint64_t steady_us, uint64_t end_us) {
+    const Rgb red = wire(LedShow::RED, 0, 0);
+    const Rgb green = wire(LedShow::NEON_GREEN_R, LedShow::NEON_GREEN_G,
+                           LedShow::NEON_GREEN_B);
+    const Rgb yellow = wire(122, 136, 0);
+    const Rgb eyes[NUM_PIXELS] = {green, green, red, red};
+    const Rgb stable[NUM_PIXELS] = {yellow, yellow, red, red};
+
+    // Gaps are 20-60 s; allow one tick of rounding onto the grid
+    const uint64_t min_gap = 20 * SECOND_US;
+    const uint64_t max_gap = 60 * SECOND_US + FRAME_US;
+    const uint64_t hold = 10 * SECOND_US;
+
+    uint64_t expected_min = (end_us - steady_us) / (max_gap + hold);
+    if (holds.size() < expected_min) {
+        fail("only %zu green-eyes holds in %.1f h (expected >= %llu)",
+             holds.size(), seconds(end_us) / 3600, (unsigned long long)expected_min);
+    }
+
+    uint64_t prev_off = 0;   // first gap counts from boot
+    for (size_t i = 0; i < holds.size(); i++) {
+        const Hold &h = holds[i];
+        if (h.on_us < steady_us) {
+            fail("hold %zu starts at %.3f s, before steady state", i, seconds(h.on_us));
+        }
+        uint64_t gap = h.on_us - prev_off;
+        if (gap < min_gap || gap > max_gap) {
+            fail("hold %zu: gap of %.3f s outside 20-60 s", i, seconds(gap));
+        }
+        // The eyes pulse with clip_03 from the first frame (check_pulses())
+        const Frame *on = state_at(h.on_us);
+        if (!on || on->px[2] != red || on->px[3] != red || on->px[0] == yellow) {
+            fail("hold %zu: eyes not green at %.3f s", i, seconds(h.on_us));
+        }
+        if (h.off_us == 0) {
+            break;   // still on when the run ended
+        }
+        uint64_t length = h.off_us - h.on_us;
+        if (length < hold || length > hold + FRAME_US) {
+            fail("hold %zu lasted %.3f s, expected 10 s", i, seconds(length));
+        }
+        if (!shows(h.off_us - 1, eyes)) {
+            fail("hold %zu: eyes changed before the hold ended", i);
+        }
+        if (!shows(h.off_us, stable)) {
+            fail("hold %zu: stable pattern not restored at %.3f s", i, seconds(h.off_us));
+        }
+        prev_off = h.off_us;
+    }
+
+    // Tickless + dirty tracking: in steady state the only frames sent
+    // outside the audio pulses are the green-eyes edges
+    size_t steady_frames = 0;
+    for (const Frame &f : frames) {
+        if (f.time_us > steady_us + FRAME_US && !in_pulse(f.time_us)) steady_frames++;
+    }
+    size_t edges = 0;
+    for (const Hold &h : holds) {
+        if (!in_pulse(h.on_us)) edges++;
+        if (h.off_us && !in_pulse(h.off_us)) edges++;
+    }
+    if (steady_frames != edges) {
+        fail("%zu frames sent in steady state for %zu green-eyes edges",
+             steady_frames, edges);
+    }
+}
+
+// Every tick of a pulse shows the envelope level at the clip position of
+// that tick; the pulse ends with the clip and leaves the full colour
+static void check_pulses(uint64_t steady_us) {
+    if (pulses.empty() || pulses[0].start_us != steady_us) {
+        fail("eyes not following the theme at steady state (%.3f s)", seconds(steady_us));
+    }
+    for (size_t i = 0; i < pulses.size(); i++) {
+        const Pulse &p = pulses[i];
+        if (p.end_us == 0) break;   // still running when the run ended
+        SimVoice voice = {p.start_us, p.frames};
+        ClipEnvelope envelope = envelope_for(p.frames);
+
+        uint64_t length = p.end_us - p.start_us;
+        uint64_t clip_us = (uint64_t)p.frames * SECOND_US / AUDIO_RATE;
+        if (length < clip_us || length > clip_us + FRAME_US) {
+            fail("pulse %zu lasted %.3f s, clip is %.3f s", i, seconds(length),
+                 seconds(clip_us));
+        }
+        uint levels = 0;
+        Rgb last = {0, 0, 0};
+        for (uint64_t t = p.first_us; t < p.end_us; t += FRAME_US) {
+            Rgb logical = pulse_colour(p.full, envelope.at(sim_clip_frame(voice, t),
+                                                           AUDIO_RATE));
+            Rgb expected = wire(logical.r, logical.g, logical.b);
+            const Frame *f = state_at(t);
+            if (!f || f->px[0] != expected || f->px[1] != expected) {
+                fail("pulse %zu: eyes off the envelope at %.3f s", i, seconds(t));
+                break;
+            }
+            if (expected != last) levels++;
+            last = expected;
+        }
+        if (levels < 8) {
+            fail("pulse %zu: only %u brightness steps", i, levels);
+        }
+        const Frame *f = state_at(p.end_us);
+        Rgb full = wire(p.full.r, p.full.g, p.full.b);
+        if (!f || f->px[0] != full || f->px[1] != full) {
+            fail("pulse %zu: full colour not restored at %.3f s", i, seconds(p.end_us));
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+int main(int argc, char **argv) {
+    double hours = 4.0;
+    unsigned seed = 1;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--hours") && i + 1 < argc) {
+            hours = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = (unsigned)strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "--verbose")) {
+            verbose = true;
+        } else {
+            fprintf(stderr, "usage: %s [--hours H] [--seed N] [--verbose]\n", argv[0]);
+            return 2;
+        }
+    }
+    const uint64_t end_us = (uint64_t)(hours * 3600.0 * SECOND_US);
+
+    auto wall_start = std::chrono::steady_clock::now();
+    srand(seed);
+    init_envelope();
+    neopixel_capture_set_callback(capture);
+
+    // Same setup as core1_main()
+    NeoPixelStrip<ColorOrder::RGB> strip(NEOPIXEL_PIN, NUM_PIXELS);
+    strip.setGamma(GAMMA_2_2);
+    LedShow show(strip);
+
+    FrameClock frameClock(LED_FPS);
+    frameClock.start();
+    show.start(frameClock.frame());
+
+    // Same setup as main() on core0
+    GreenEyesScheduler greenEyes;
+    greenEyes.start(get_absolute_time());
+
+    const Rgb green  = {LedShow::NEON_GREEN_R, LedShow::NEON_GREEN_G, LedShow::NEON_GREEN_B};
+    const Rgb yellow = {122, 136, 0};
+    SimVoice themeVoice = {0, 0};
+    SimVoice eyesVoice  = {0, 0};
+
+    uint64_t steady_us = 0;
+    absolute_time_t wakeTime = frameClock.nextTickTime();
+    while (to_us_since_boot(get_absolute_time()) < end_us) {
+        // Earliest deadline of either loop
+        wakeTime = absolute_time_min(wakeTime, greenEyes.nextDeadline());
+        const FrameInfo &frame = frameClock.waitForTick(wakeTime);
+        uint64_t now_us = to_us_since_boot(frame.time);
+
+        switch (greenEyes.update(frame.time)) {
+        case GreenEyesScheduler::EYES_ON:
+            show.handleCommand(LedCommand::GREEN_EYES_ON, frame);
+            play_and_follow(show, eyesVoice, EYES_CLIP_FRAMES, green, frame, true);
+            holds.push_back(Hold{now_us, 0});
+            if (verbose) printf("%10.3f s  green eyes on (clip_03)\n", seconds(now_us));
+            break;
+        case GreenEyesScheduler::EYES_OFF:
+            show.handleCommand(LedCommand::GREEN_EYES_OFF, frame);
+            holds.back().off_us = now_us;
+            if (verbose) printf("%10.3f s  green eyes off\n", seconds(now_us));
+            break;
+        default:
+            break;
+        }
+
+        show.update(frame);
+        if (!pulses.empty() && !pulses.back().end_us && !show.eyesPulsing()) {
+            pulses.back().end_us = now_us;
+        }
+        if (!steady_us && show.inSteadyState()) {
+            steady_us = now_us;
+            greenEyes.setSteadyState(true);
+            // The theme starts; the eyes pulse with it from the next tick
+            play_and_follow(show, themeVoice, THEME_CLIP_FRAMES, yellow, frame, false);
+            if (verbose) printf("%10.3f s  steady state (clip_05)\n", seconds(now_us));
+        }
+
+        strip.show();
+        wakeTime = show.nextUpdateTime(frame);
+    }
+
+    double wall_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - wall_start).count();
+
+    check_frame_timing();
+    check_boot_sequence(steady_us);
+    check_green_eyes(steady_us, end_us);
+    check_pulses(steady_us);
+
+    printf("Simulated %.2f h in %.1f ms: %zu frames sent, %lu skipped, "
+           "%zu green-eyes holds, %zu audio pulses (seed %u)\n",
+           hours, wall_ms, frames.size(), (unsigned long)strip.getFramesSkipped(),
+           holds.size(), pulses.size(), seed);
+    if (failures) {
+        printf("%u check(s) FAILED\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
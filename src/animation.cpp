@@ -27,6 +27,18 @@ void hsv_to_rgb(uint8_t h, uint8_t s, uint8_t v,
     }
 }
 
+// ---------------------------------------------------------------------------
+// Deadline helper: the next multiple of step_ms after `elapsed`, capped at
+// end_ms (all relative to the animation start).
+// ---------------------------------------------------------------------------
+static absolute_time_t next_step_time(const FrameInfo &frame, uint32_t elapsed,
+                                      uint32_t step_ms, uint32_t end_ms) {
+    if (elapsed >= end_ms) return frame.time;
+    uint32_t next = (elapsed / step_ms + 1) * step_ms;
+    if (next > end_ms) next = end_ms;
+    return delayed_by_ms(frame.time, next - elapsed);
+}
+
 // ---------------------------------------------------------------------------
 // RainbowCycleAnimation – all LEDs show the same hue, cycling through the
 // full spectrum.  Gives the impression of a system powering up.
@@ -35,41 +47,43 @@ RainbowCycleAnimation::RainbowCycleAnimation(uint32_t duration_ms,
                                              uint32_t frame_delay_ms,
                                              uint8_t brightness)
     : duration_ms_(duration_ms), frame_delay_ms_(frame_delay_ms),
-      brightness_(brightness), start_time_(0), last_frame_time_(0),
-      hue_offset_(0), complete_(false) {}
+      brightness_(brightness), start_time_(0), complete_(false) {}
 
-void RainbowCycleAnimation::start(NeoPixel &strip) {
-    start_time_      = to_ms_since_boot(get_absolute_time());
-    last_frame_time_ = start_time_;
-    hue_offset_      = 0;
-    complete_        = false;
+void RainbowCycleAnimation::start(NeoPixel &strip, const FrameInfo &frame) {
+    start_time_ = frame.now_ms;
+    complete_   = false;
 }
 
-void RainbowCycleAnimation::update(NeoPixel &strip) {
+void RainbowCycleAnimation::update(NeoPixel &strip, const FrameInfo &frame) {
     if (complete_) return;
 
-    uint32_t now = to_ms_since_boot(get_absolute_time());
+    uint32_t elapsed = frame.now_ms - start_time_;
 
-    if (now - start_time_ >= duration_ms_) {
+    if (elapsed >= duration_ms_) {
         complete_ = true;
         return;
     }
 
-    if (now - last_frame_time_ < frame_delay_ms_) return;
-    last_frame_time_ = now;
+    // Hue advances one step per frame_delay_ms_, independent of the frame
+    // rate; unchanged frames are dropped by NeoPixel::show()
+    uint32_t hue_offset = (elapsed / frame_delay_ms_) * 3;  // controls rotation speed
 
     // Every LED gets the same colour (cycling in unison)
-    uint8_t hue = (uint8_t)(hue_offset_ & 0xFF);
+    uint8_t hue = (uint8_t)(hue_offset & 0xFF);
     uint8_t r, g, b;
     hsv_to_rgb(hue, 255, brightness_, r, g, b);
 
     strip.fill(r, g, b);
-
-    hue_offset_ += 3;  // controls rotation speed
 }
 
 bool RainbowCycleAnimation::isComplete() const { return complete_; }
 
+absolute_time_t RainbowCycleAnimation::nextUpdateTime(const FrameInfo &frame) const {
+    if (complete_) return frame.time;
+    return next_step_time(frame, frame.now_ms - start_time_,
+                          frame_delay_ms_, duration_ms_);
+}
+
 // ---------------------------------------------------------------------------
 // RainbowChaseAnimation – each LED has a different hue offset so the colours
 // appear to travel along the strip.
@@ -78,42 +92,42 @@ RainbowChaseAnimation::RainbowChaseAnimation(uint32_t duration_ms,
                                              uint32_t frame_delay_ms,
                                              uint8_t brightness)
     : duration_ms_(duration_ms), frame_delay_ms_(frame_delay_ms),
-      brightness_(brightness), start_time_(0), last_frame_time_(0),
-      hue_offset_(0), complete_(false) {}
+      brightness_(brightness), start_time_(0), complete_(false) {}
 
-void RainbowChaseAnimation::start(NeoPixel &strip) {
-    start_time_      = to_ms_since_boot(get_absolute_time());
-    last_frame_time_ = start_time_;
-    hue_offset_      = 0;
-    complete_        = false;
+void RainbowChaseAnimation::start(NeoPixel &strip, const FrameInfo &frame) {
+    start_time_ = frame.now_ms;
+    complete_   = false;
 }
 
-void RainbowChaseAnimation::update(NeoPixel &strip) {
+void RainbowChaseAnimation::update(NeoPixel &strip, const FrameInfo &frame) {
     if (complete_) return;
 
-    uint32_t now = to_ms_since_boot(get_absolute_time());
+    uint32_t elapsed = frame.now_ms - start_time_;
 
-    if (now - start_time_ >= duration_ms_) {
+    if (elapsed >= duration_ms_) {
         complete_ = true;
         return;
     }
 
-    if (now - last_frame_time_ < frame_delay_ms_) return;
-    last_frame_time_ = now;
+    uint32_t hue_offset = (elapsed / frame_delay_ms_) * 5;  // faster sweep for chase effect
 
     uint num_pixels = strip.getNumPixels();
     for (uint i = 0; i < num_pixels; i++) {
-        uint8_t hue = (uint8_t)((hue_offset_ + i * 256 / num_pixels) & 0xFF);
+        uint8_t hue = (uint8_t)((hue_offset + i * 256 / num_pixels) & 0xFF);
         uint8_t r, g, b;
         hsv_to_rgb(hue, 255, brightness_, r, g, b);
         strip.setPixelColor(i, r, g, b);
     }
-
-    hue_offset_ += 5;  // faster sweep for chase effect
 }
 
 bool RainbowChaseAnimation::isComplete() const { return complete_; }
 
+absolute_time_t RainbowChaseAnimation::nextUpdateTime(const FrameInfo &frame) const {
+    if (complete_) return frame.time;
+    return next_step_time(frame, frame.now_ms - start_time_,
+                          frame_delay_ms_, duration_ms_);
+}
+
 // ---------------------------------------------------------------------------
 // SolidColorAnimation – fill all LEDs with one colour for a fixed time.
 // ---------------------------------------------------------------------------
@@ -122,13 +136,13 @@ SolidColorAnimation::SolidColorAnimation(uint8_t r, uint8_t g, uint8_t b,
     : r_(r), g_(g), b_(b), duration_ms_(duration_ms),
       start_time_(0), applied_(false), complete_(false) {}
 
-void SolidColorAnimation::start(NeoPixel &strip) {
-    start_time_ = to_ms_since_boot(get_absolute_time());
+void SolidColorAnimation::start(NeoPixel &strip, const FrameInfo &frame) {
+    start_time_ = frame.now_ms;
     applied_    = false;
     complete_   = false;
 }
 
-void SolidColorAnimation::update(NeoPixel &strip) {
+void SolidColorAnimation::update(NeoPixel &strip, const FrameInfo &frame) {
     if (complete_) return;
 
     if (!applied_) {
@@ -136,14 +150,20 @@ void SolidColorAnimation::update(NeoPixel &strip) {
         applied_ = true;
     }
 
-    uint32_t now = to_ms_since_boot(get_absolute_time());
-    if (now - start_time_ >= duration_ms_) {
+    if (frame.now_ms - start_time_ >= duration_ms_) {
         complete_ = true;
     }
 }
 
 bool SolidColorAnimation::isComplete() const { return complete_; }
 
+absolute_time_t SolidColorAnimation::nextUpdateTime(const FrameInfo &frame) const {
+    if (complete_ || !applied_) return frame.time;
+    // Nothing changes until the colour has been held for duration_ms_
+    return next_step_time(frame, frame.now_ms - start_time_,
+                          duration_ms_, duration_ms_);
+}
+
 // ---------------------------------------------------------------------------
 // FlickerAnimation – rapidly toggles between a colour and black, then holds
 // LEDs off for a specified period before completing.
@@ -159,17 +179,17 @@ FlickerAnimation::FlickerAnimation(uint8_t r, uint8_t g, uint8_t b,
       start_time_(0), off_start_time_(0),
       flickering_(true), in_off_phase_(false), complete_(false) {}
 
-void FlickerAnimation::start(NeoPixel &strip) {
-    start_time_    = to_ms_since_boot(get_absolute_time());
+void FlickerAnimation::start(NeoPixel &strip, const FrameInfo &frame) {
+    start_time_    = frame.now_ms;
     flickering_    = true;
     in_off_phase_  = false;
     complete_      = false;
 }
 
-void FlickerAnimation::update(NeoPixel &strip) {
+void FlickerAnimation::update(NeoPixel &strip, const FrameInfo &frame) {
     if (complete_) return;
 
-    uint32_t now = to_ms_since_boot(get_absolute_time());
+    uint32_t now = frame.now_ms;
 
     if (flickering_) {
         uint32_t elapsed = now - start_time_;
@@ -198,6 +218,17 @@ void FlickerAnimation::update(NeoPixel &strip) {
 
 bool FlickerAnimation::isComplete() const { return complete_; }
 
+absolute_time_t FlickerAnimation::nextUpdateTime(const FrameInfo &frame) const {
+    if (complete_) return frame.time;
+    if (flickering_) {
+        // Next on/off toggle, or the end of the flicker phase
+        return next_step_time(frame, frame.now_ms - start_time_,
+                              flicker_interval_ms_, flicker_duration_ms_);
+    }
+    return next_step_time(frame, frame.now_ms - off_start_time_,
+                          off_duration_ms_, off_duration_ms_);
+}
+
 // ---------------------------------------------------------------------------
 // StaticPatternAnimation – sets individual pixel colours and holds forever.
 // ---------------------------------------------------------------------------
@@ -210,11 +241,11 @@ StaticPatternAnimation::StaticPatternAnimation(const PixelColor *colors,
     }
 }
 
-void StaticPatternAnimation::start(NeoPixel &strip) {
+void StaticPatternAnimation::start(NeoPixel &strip, const FrameInfo &frame) {
     applied_ = false;
 }
 
-void StaticPatternAnimation::update(NeoPixel &strip) {
+void StaticPatternAnimation::update(NeoPixel &strip, const FrameInfo &frame) {
     if (!applied_) {
         for (uint i = 0; i < num_pixels_; i++) {
             strip.setPixelColor(i, colors_[i].r, colors_[i].g, colors_[i].b);
@@ -227,11 +258,74 @@ bool StaticPatternAnimation::isComplete() const {
     return false;  // static pattern runs indefinitely
 }
 
+absolute_time_t StaticPatternAnimation::nextUpdateTime(const FrameInfo &frame) const {
+    // Once the pattern is in the framebuffer there is nothing left to do
+    return applied_ ? at_the_end_of_time : frame.time;
+}
+
+// ---------------------------------------------------------------------------
+// AudioEnvelopeAnimation – one envelope read per frame at the position the
+// audio driver reports; the clip's end is the animation's end.
+// ---------------------------------------------------------------------------
+AudioEnvelopeAnimation::AudioEnvelopeAnimation(uint first_pixel, uint num_pixels,
+                                               uint8_t floor)
+    : first_pixel_(first_pixel), num_pixels_(num_pixels), floor_(floor),
+      r_(0), g_(0), b_(0), envelope_{nullptr, 0, 0}, sample_rate_(0),
+      source_(nullptr), ctx_(nullptr), complete_(true) {}
+
+void AudioEnvelopeAnimation::setClip(const ClipEnvelope &envelope, uint32_t sample_rate,
+                                     PositionSource source, void *ctx) {
+    envelope_    = envelope;
+    sample_rate_ = sample_rate;
+    source_      = source;
+    ctx_         = ctx;
+}
+
+void AudioEnvelopeAnimation::setColor(uint8_t r, uint8_t g, uint8_t b) {
+    r_ = r;
+    g_ = g;
+    b_ = b;
+}
+
+void AudioEnvelopeAnimation::start(NeoPixel &strip, const FrameInfo &frame) {
+    complete_ = !envelope_.levels || !source_ || sample_rate_ == 0;
+}
+
+void AudioEnvelopeAnimation::update(NeoPixel &strip, const FrameInfo &frame) {
+    if (complete_) return;
+
+    uint32_t pos;
+    if (!source_(ctx_, pos)) {
+        complete_ = true;
+        draw(strip, 255);
+        return;
+    }
+    draw(strip, envelope_.at(pos, sample_rate_));
+}
+
+void AudioEnvelopeAnimation::draw(NeoPixel &strip, uint8_t level) {
+    // Brightness floor + (255 - floor) * level, applied to the full colour
+    uint32_t scale = floor_ + (uint32_t)(255 - floor_) * level / 255;
+    for (uint i = 0; i < num_pixels_; i++) {
+        strip.setPixelColor(first_pixel_ + i, r_ * scale / 255, g_ * scale / 255,
+                            b_ * scale / 255);
+    }
+}
+
+bool AudioEnvelopeAnimation::isComplete() const {
+    return complete_;
+}
+
+absolute_time_t AudioEnvelopeAnimation::nextUpdateTime(const FrameInfo &frame) const {
+    // Position comes from the audio clock: sample it every tick while playing
+    return complete_ ? at_the_end_of_time : frame.time;
+}
+
 // ---------------------------------------------------------------------------
 // AnimationSequencer
 // ---------------------------------------------------------------------------
 AnimationSequencer::AnimationSequencer()
-    : count_(0), current_(0), started_(false) {
+    : count_(0), current_(0), started_(false), first_update_(false) {
     for (uint i = 0; i < MAX_ANIMATIONS; i++) {
         animations_[i] = nullptr;
     }
@@ -243,24 +337,27 @@ void AnimationSequencer::addAnimation(Animation *animation) {
     }
 }
 
-void AnimationSequencer::start(NeoPixel &strip) {
+void AnimationSequencer::start(NeoPixel &strip, const FrameInfo &frame) {
     current_ = 0;
     started_ = true;
+    first_update_ = true;
     if (count_ > 0) {
-        animations_[0]->start(strip);
+        animations_[0]->start(strip, frame);
     }
 }
 
-void AnimationSequencer::update(NeoPixel &strip) {
+void AnimationSequencer::update(NeoPixel &strip, const FrameInfo &frame) {
     if (!started_ || current_ >= count_) return;
 
     Animation *anim = animations_[current_];
-    anim->update(strip);
+    anim->update(strip, frame);
+    first_update_ = false;
 
     if (anim->isComplete()) {
         current_++;
         if (current_ < count_) {
-            animations_[current_]->start(strip);
+            animations_[current_]->start(strip, frame);
+            first_update_ = true;
         }
     }
 }
@@ -268,3 +365,10 @@ void AnimationSequencer::update(NeoPixel &strip) {
 bool AnimationSequencer::isComplete() const {
     return started_ && current_ >= count_;
 }
+
+absolute_time_t AnimationSequencer::nextUpdateTime(const FrameInfo &frame) const {
+    if (!started_ || current_ >= count_) return at_the_end_of_time;
+    // A freshly started animation draws its first frame on the next tick
+    if (first_update_) return frame.time;
+    return animations_[current_]->nextUpdateTime(frame);
+}
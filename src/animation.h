@@ -2,6 +2,8 @@
 #define ANIMATION_H
 
 #include "neopixel.h"
+#include "frame_clock.h"
+#include "asset_pack.h"
 #include "pico/stdlib.h"
 
 // HSV to RGB conversion helper
@@ -11,19 +13,29 @@ void hsv_to_rgb(uint8_t h, uint8_t s, uint8_t v, uint8_t &r, uint8_t &g, uint8_t
 // ---------------------------------------------------------------------------
 // Base class for all animations.
 // Subclass this to add new animation types in the future.
+// Animations take their notion of time from the FrameInfo of the current
+// tick rather than reading the clock themselves.
 // ---------------------------------------------------------------------------
 class Animation {
 public:
     virtual ~Animation() = default;
 
     // Called once when the animation begins
-    virtual void start(NeoPixel &strip) = 0;
+    virtual void start(NeoPixel &strip, const FrameInfo &frame) = 0;
 
-    // Called on every iteration of the main loop to advance the animation
-    virtual void update(NeoPixel &strip) = 0;
+    // Called once per frame clock tick to advance the animation
+    virtual void update(NeoPixel &strip, const FrameInfo &frame) = 0;
 
     // Returns true when the animation has finished its work
     virtual bool isComplete() const = 0;
+
+    // Earliest time this animation needs another update() to stay correct.
+    // The main loop sleeps until the earliest deadline of all components;
+    // the default asks for the very next tick, idle animations return
+    // at_the_end_of_time.
+    virtual absolute_time_t nextUpdateTime(const FrameInfo &frame) const {
+        return frame.time;
+    }
 };
 
 // ---------------------------------------------------------------------------
@@ -36,17 +48,16 @@ public:
     RainbowCycleAnimation(uint32_t duration_ms,
                           uint32_t frame_delay_ms = 20,
                           uint8_t brightness = 64);
-    void start(NeoPixel &strip) override;
-    void update(NeoPixel &strip) override;
+    void start(NeoPixel &strip, const FrameInfo &frame) override;
+    void update(NeoPixel &strip, const FrameInfo &frame) override;
     bool isComplete() const override;
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const override;
 
 private:
     uint32_t duration_ms_;
     uint32_t frame_delay_ms_;
     uint8_t brightness_;
     uint32_t start_time_;
-    uint32_t last_frame_time_;
-    uint32_t hue_offset_;
     bool complete_;
 };
 
@@ -56,17 +67,16 @@ public:
     RainbowChaseAnimation(uint32_t duration_ms,
                           uint32_t frame_delay_ms = 30,
                           uint8_t brightness = 64);
-    void start(NeoPixel &strip) override;
-    void update(NeoPixel &strip) override;
+    void start(NeoPixel &strip, const FrameInfo &frame) override;
+    void update(NeoPixel &strip, const FrameInfo &frame) override;
     bool isComplete() const override;
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const override;
 
 private:
     uint32_t duration_ms_;
     uint32_t frame_delay_ms_;
     uint8_t brightness_;
     uint32_t start_time_;
-    uint32_t last_frame_time_;
-    uint32_t hue_offset_;
     bool complete_;
 };
 
@@ -74,9 +84,10 @@ private:
 class SolidColorAnimation : public Animation {
 public:
     SolidColorAnimation(uint8_t r, uint8_t g, uint8_t b, uint32_t duration_ms);
-    void start(NeoPixel &strip) override;
-    void update(NeoPixel &strip) override;
+    void start(NeoPixel &strip, const FrameInfo &frame) override;
+    void update(NeoPixel &strip, const FrameInfo &frame) override;
     bool isComplete() const override;
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const override;
 
 private:
     uint8_t r_, g_, b_;
@@ -93,9 +104,10 @@ public:
                      uint32_t flicker_duration_ms,
                      uint32_t off_duration_ms,
                      uint32_t flicker_interval_ms = 80);
-    void start(NeoPixel &strip) override;
-    void update(NeoPixel &strip) override;
+    void start(NeoPixel &strip, const FrameInfo &frame) override;
+    void update(NeoPixel &strip, const FrameInfo &frame) override;
     bool isComplete() const override;
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const override;
 
 private:
     uint8_t r_, g_, b_;
@@ -117,9 +129,10 @@ public:
     };
 
     StaticPatternAnimation(const PixelColor *colors, uint num_pixels);
-    void start(NeoPixel &strip) override;
-    void update(NeoPixel &strip) override;
+    void start(NeoPixel &strip, const FrameInfo &frame) override;
+    void update(NeoPixel &strip, const FrameInfo &frame) override;
     bool isComplete() const override;  // Always false – runs forever
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const override;
 
 private:
     static const uint MAX_PIXELS = 8;
@@ -128,6 +141,44 @@ private:
     bool applied_;
 };
 
+// Pulses a group of pixels with a playing clip: each frame reads the clip's
+// envelope (`wav2cpp.py --envelope`) at the current playback position, so
+// the light stays locked to the audio whatever the mixer does.  Brightness
+// runs from `floor` (silence) to the full colour (loudest); the full
+// colour comes back when the clip ends.
+class AudioEnvelopeAnimation : public Animation {
+public:
+    // Frame of the clip now playing; false once it has stopped
+    typedef bool (*PositionSource)(void *ctx, uint32_t &frame);
+
+    AudioEnvelopeAnimation(uint first_pixel, uint num_pixels, uint8_t floor = 64);
+
+    // Follow a clip (call before start()); `envelope.levels` must be set
+    void setClip(const ClipEnvelope &envelope, uint32_t sample_rate,
+                 PositionSource source, void *ctx);
+
+    // Full colour; takes effect on the next update()
+    void setColor(uint8_t r, uint8_t g, uint8_t b);
+
+    void start(NeoPixel &strip, const FrameInfo &frame) override;
+    void update(NeoPixel &strip, const FrameInfo &frame) override;
+    bool isComplete() const override;
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const override;
+
+private:
+    uint first_pixel_;
+    uint num_pixels_;
+    uint8_t floor_;
+    uint8_t r_, g_, b_;
+    ClipEnvelope envelope_;
+    uint32_t sample_rate_;
+    PositionSource source_;
+    void *ctx_;
+    bool complete_;
+
+    void draw(NeoPixel &strip, uint8_t level);
+};
+
 // ---------------------------------------------------------------------------
 // Animation sequencer – runs a list of animations in order
 // ---------------------------------------------------------------------------
@@ -141,14 +192,17 @@ public:
     void addAnimation(Animation *animation);
 
     // Begin running the sequence from the first animation
-    void start(NeoPixel &strip);
+    void start(NeoPixel &strip, const FrameInfo &frame);
 
     // Advance the current animation; moves to next when complete
-    void update(NeoPixel &strip);
+    void update(NeoPixel &strip, const FrameInfo &frame);
 
     // True when every animation in the sequence has completed
     bool isComplete() const;
 
+    // Next update deadline of the running animation (end of time when idle)
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const;
+
     // Index of the currently-running animation
     uint getCurrentIndex() const { return current_; }
 
@@ -160,6 +214,7 @@ private:
     uint count_;
     uint current_;
     bool started_;
+    bool first_update_;   // current animation has not drawn yet
 };
 
 #endif // ANIMATION_H
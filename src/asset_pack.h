@@ -0,0 +1,86 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include "pico/stdlib.h"
+
+// ---------------------------------------------------------------------------
+// Binary audio asset pack from `tools/audio/audiopack.py`, linked into
+// flash by a generated assembler .incbin stub (gundam_add_audio_assets()
+// in cmake/GundamAudioAssets.cmake).  The pack layout is documented in
+// audiopack.py.
+//
+// Clip lookup is compile-time only: the generated registry header
+// describes every clip with labels the stub places on its payload, so the
+// types below are all the firmware needs.  The stub links the payloads
+// alone; the pack's header and clip table stay in the .pack file for the
+// tools.  Payloads are 16-bit PCM or IMA ADPCM blocks, exactly what
+// I2SAudio streams, read in place.
+// ---------------------------------------------------------------------------
+
+enum class AudioCodec : uint8_t {
+    PCM16     = 0,
+    IMA_ADPCM = 1,
+};
+
+// A clip in flash and how to play it (see I2SAudio::play(ClipId))
+struct AudioClip {
+    AudioCodec codec;
+    uint8_t channels;       // 1, or 2 for interleaved stereo PCM
+    const void *data;
+    uint32_t num_samples;   // both channels for stereo
+    uint32_t sample_rate;
+    uint32_t loop_start;    // frames; loop_end 0: no loop points
+    uint32_t loop_end;
+};
+
+// Amplitude envelope of a clip (`--envelope FPS`), for audio-synced LEDs:
+// one level per 1/rate s of audio, 0 (silent, or 36 dB under the clip's
+// loudest frame) to 255 (loudest)
+struct ClipEnvelope {
+    const uint8_t *levels;  // nullptr: the clip has no envelope
+    uint32_t count;
+    uint32_t rate;          // levels per second
+
+    // Level at clip frame `frame` of a clip at `sample_rate` (0 past the end)
+    uint8_t at(uint32_t frame, uint32_t sample_rate) const {
+        uint32_t i = (uint32_t)((uint64_t)frame * rate / sample_rate);
+        return i < count ? levels[i] : 0;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Compile-time clip registry.  The build also generates the pack's
+// registry header (clips_pack.h) with a `ClipId` enum, a constexpr
+// CLIP_TABLE of ClipDescriptors indexed by it, and findClip(): a perfect
+// hash of the clip names, so a lookup is one hash, one table read and one
+// string compare.  I2SAudio::play(ClipId) is a single indexed load.
+// ---------------------------------------------------------------------------
+
+// Defined by the generated registry header
+enum class ClipId : uint16_t;
+
+struct ClipDescriptor {
+    const char *name;
+    AudioClip clip;
+    ClipEnvelope envelope;
+};
+
+// FNV-1a of the name, from a basis the registry's seed perturbs (must
+// match clip_name_hash() in audiopack.py)
+constexpr uint32_t clipNameHash(const char *name, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    while (*name) {
+        h = (h ^ (uint8_t)*name++) * 16777619u;
+    }
+    return h;
+}
+
+constexpr bool clipNameEqual(const char *a, const char *b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+#endif // ASSET_PACK_H
@@ -1,4811 +0,0 @@
-#include "clip_03.h"
-
-// Auto-generated by wav2cpp  do not edit
-// 57647 samples, 44100 Hz, mono
-
-const int16_t CLIP_03_SAMPLES[] = {
-    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1,
-    -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0,
-    -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1,
-    -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0,
-    0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0,
-    -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, -1, 1, 0, -1, 0, 0, 0, -1,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0,
-    -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-    0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0,
-    0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1,
-    -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
-    -1, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, 0,
-    0, -1, -1, 0, 1, 0, 0, -1, -1, 0, 0, 0,
-    0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0,
-    0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0,
-    0, 1, 0, -1, -1, 0, 1, 0, -1, -1, 0, -1,
-    -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, 1, 0,
-    -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0,
-    -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, -1,
-    0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-    0, -1, -1, -1, -1, 1, 0, -1, 0, -1, -1, 1,
-    0, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0,
-    0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, -1,
-    -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1,
-    -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0,
-    0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 1, 0,
-    0, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-    -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1,
-    -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-    -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1,
-    -1, -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1,
-    -1, -1, 0, 0, 1, 0, 0, -1, 0, -1, -1, 0,
-    0, 0, 1, 1, 0, 0, 0, 0, -1, -1, 0, 1,
-    1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, -1,
-    0, 1, 2, 1, 1, 0, -1, -1, -1, -1, -1, 0,
-    0, 0, 0, -1, -1, -1, -2, -2, -1, -1, -1, -1,
-    0, 0, 1, 1, 1, 0, 0, -1, -1, -1, -1, -1,
-    -1, -1, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1,
-    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-    1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0,
-    1, 0, 0, 2, 1, 0, 1, 0, -1, 0, 0, -1,
-    -1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, -1,
-    -1, 1, 1, 1, 2, 0, -1, 0, 1, 0, 0, 1,
-    -1, -1, -1, -2, -1, -1, -3, -3, -2, -2, 0, 2,
-    1, 1, 2, 1, 2, 2, 1, 2, 2, 2, 4, 4,
-    2, 2, 1, 2, 4, 4, 2, 3, 3, 1, 0, 1,
-    0, 0, 3, 6, 2, -1, 1, 1, 0, 2, 3, 0,
-    1, 4, 3, 2, 3, 1, -2, 3, 6, 3, 1, 2,
-    0, -1, 0, 0, -3, -2, 0, 0, -2, -1, 0, 1,
-    3, 3, 2, 2, 1, 0, -1, -4, -5, -3, -3, 0,
-    3, 0, -2, -1, -2, -2, 2, 0, -3, -4, -3, -4,
-    -6, -5, -1, -1, -4, -4, 1, 6, 6, 4, 4, 4,
-    2, 0, -1, -1, -4, -7, 0, 5, 2, 2, 4, -1,
-    -3, 2, 0, -4, -4, -3, -4, -7, -8, -7, -3, 0,
-    -3, -3, 2, 1, -6, -7, -6, -7, -8, -9, -10, -9,
-    -10, -10, -11, -16, -15, -8, -6, -10, -8, -2, -2, -8,
-    -4, -3, -13, -12, -3, -4, -5, -3, -6, -6, -6, -5,
-    -4, -9, -7, -4, -14, -14, -7, -17, -18, -13, -16, -10,
-    -6, -8, 4, 0, -13, -1, -2, -1, 24, -7, 3, 197,
-    375, 367, 323, 310, 274, 237, 205, 165, 140, 111, 75, 48,
-    14, -21, -42, -65, -90, -113, -139, -154, -177, -217, -248, -269,
-    -287, -299, -314, -322, -329, -353, -365, -359, -373, -394, -399, -399,
-    -393, -384, -384, -382, -376, -367, -355, -343, -332, -323, -324, -320,
-    -303, -283, -261, -241, -229, -213, -195, -179, -164, -164, -165, -161,
-    -169, -177, -169, -173, -185, -187, -192, -199, -199, -199, -200, -194,
-    -181, -165, -164, -176, -176, -160, -138, -123, -129, -137, -130, -110,
-    -81, -66, -70, -63, -45, -27, -22, -40, -52, -45, -69, -97,
-    -79, -75, -113, -124, -105, -102, -109, -125, -144, -146, -141, -146,
-    -155, -166, -174, -169, -161, -158, -156, -156, -149, -124, -97, -81,
-    -73, -70, -61, -42, -28, -22, -8, 6, 7, 10, 24, 36,
-    43, 46, 46, 47, 55, 66, 76, 77, 69, 64, 67, 70,
-    65, 51, 34, 23, 18, 10, -4, -18, -26, -27, -32, -47,
-    -70, -95, -120, -147, -173, -200, -227, -251, -274, -295, -312, -323,
-    -332, -341, -350, -358, -362, -365, -372, -378, -378, -367, -348, -327,
-    -305, -280, -251, -221, -191, -162, -132, -97, -66, -44, -27, -16,
-    -7, 3, 16, 33, 53, 74, 89, 89, 79, 72, 73, 78,
-    74, 53, 25, 4, -3, -4, -17, -45, -82, -110, -121, -120,
-    -120, -126, -134, -136, -134, -136, -148, -162, -165, -152, -131, -115,
-    -109, -101, -81, -50, -23, -13, -14, -12, 2, 25, 44, 59,
-    77, 106, 139, 159, 161, 156, 158, 172, 181, 175, 154, 136,
-    137, 151, 160, 150, 126, 105, 99, 102, 100, 80, 46, 11,
-    -17, -37, -57, -81, -108, -129, -141, -144, -144, -146, -150, -148,
-    -134, -110, -85, -68, -59, -47, -24, 6, 28, 34, 30, 37,
-    63, 98, 115, 106, 83, 75, 90, 111, 111, 83, 49, 35,
-    47, 62, 54, 29, 12, 25, 54, 69, 53, 25, 20, 47,
-    80, 86, 62, 43, 62, 113, 157, 166, 151, 154, 197, 259,
-    300, 301, 292, 308, 355, 398, 404, 374, 347, 351, 375, 381,
-    346, 286, 232, 196, 159, 99, 19, -56, -108, -148, -200, -265,
-    -322, -344, -338, -331, -340, -347, -314, -232, -133, -56, -8, 57,
-    186, 379, 591, 775, 933, 1110, 1342, 1613, 1866, 2052, 2170, 2260,
-    2351, 2431, 2459, 2407, 2290, 2155, 2039, 1944, 1836, 1681, 1473, 1231,
-    977, 705, 381, -29, -528, -1079, -1628, -2146, -2632, -3088, -3487, -3773,
-    -3898, -3867, -3731, -3544, -3314, -3020, -2658, -2276, -1946, -1702, -1505, -1282,
-    -1004, -712, -467, -276, -74, 217, 608, 1033, 1416, 1745, 2073, 2445,
-    2838, 3164, 3354, 3412, 3400, 3371, 3323, 3214, 3020, 2765, 2493, 2223,
-    1934, 1584, 1155, 657, 115, -458, -1048, -1637, -2193, -2684, -3089, -3392,
-    -3573, -3608, -3491, -3244, -2908, -2514, -2074, -1598, -1113, -668, -300, -14,
-    216, 399, 507, 497, 362, 153, -56, -213, -314, -365, -339, -180,
-    140, 572, 1013, 1389, 1709, 2033, 2394, 2741, 2978, 3055, 3018, 2947,
-    2873, 2737, 2458, 2024, 1517, 1035, 596, 130, -441, -1115, -1806, -2426,
-    -2956, -3428, -3857, -4184, -4325, -4244, -3994, -3664, -3307, -2911, -2449, -1944,
-    -1462, -1044, -661, -240, 267, 830, 1373, 1844, 2254, 2636, 2985, 3244,
-    3352, 3302, 3142, 2928, 2670, 2342, 1920, 1425, 905, 394, -112, -632,
-    -1164, -1680, -2142, -2530, -2847, -3098, -3277, -3374, -3396, -3372, -3326, -3257,
-    -3144, -2971, -2746, -2492, -2223, -1931, -1605, -1255, -909, -585, -261, 106,
-    545, 1042, 1543, 2004, 2415, 2797, 3152, 3446, 3632, 3696, 3667, 3587,
-    3467, 3271, 2959, 2532, 2035, 1520, 998, 452, -126, -692, -1165, -1487,
-    -1660, -1724, -1699, -1557, -1267, -848, -375, 65, 427, 714, 941, 1087,
-    1098, 931, 603, 185, -248, -658, -1033, -1343, -1535, -1558, -1401, -1100,
-    -709, -262, 225, 741, 1265, 1764, 2211, 2589, 2882, 3062, 3090, 2961,
-    2705, 2363, 1955, 1480, 944, 377, -174, -667, -1099, -1483, -1819, -2074,
-    -2210, -2210, -2097, -1916, -1697, -1438, -1126, -774, -413, -80, 216, 488,
-    751, 994, 1191, 1326, 1411, 1459, 1477, 1469, 1439, 1398, 1369, 1365,
-    1374, 1375, 1365, 1368, 1409, 1497, 1614, 1726, 1805, 1839, 1821, 1744,
-    1604, 1401, 1140, 833, 502, 170, -161, -491, -807, -1091, -1333, -1535,
-    -1690, -1788, -1836, -1856, -1863, -1859, -1844, -1821, -1782, -1717, -1620, -1498,
-    -1363, -1227, -1093, -946, -779, -610, -477, -409, -402, -428, -450, -456,
-    -465, -483, -475, -396, -236, -28, 191, 406, 624, 864, 1125, 1359,
-    1505, 1548, 1511, 1407, 1218, 925, 551, 171, -128, -309, -404, -453,
-    -446, -342, -126, 161, 449, 686, 871, 1036, 1196, 1314, 1337, 1248,
-    1083, 884, 650, 349, -29, -451, -859, -1217, -1516, -1754, -1922, -1992,
-    -1955, -1838, -1691, -1536, -1358, -1137, -880, -622, -400, -212, -16, 217,
-    475, 716, 925, 1121, 1323, 1526, 1697, 1807, 1852, 1855, 1824, 1737,
-    1575, 1348, 1099, 870, 674, 502, 343, 197, 82, 15, -6, -5,
-    8, 57, 174, 351, 548, 743, 928, 1084, 1178, 1191, 1120, 987,
-    833, 692, 564, 437, 326, 251, 222, 230, 253, 247, 194, 112,
-    19, -87, -204, -303, -350, -322, -214, -42, 174, 423, 700, 971,
-    1184, 1300, 1313, 1242, 1110, 923, 674, 356, -27, -449, -882, -1312,
-    -1753, -2207, -2639, -2999, -3253, -3376, -3348, -3171, -2864, -2457, -1995, -1538,
-    -1148, -862, -698, -656, -718, -856, -1041, -1232, -1385, -1478, -1505, -1459,
-    -1330, -1114, -806, -425, -14, 378, 747, 1115, 1500, 1882, 2209, 2419,
-    2497, 2472, 2376, 2205, 1929, 1517, 972, 338, -332, -1023, -1732, -2415,
-    -2985, -3373, -3555, -3553, -3418, -3191, -2883, -2495, -2065, -1649, -1268, -889,
-    -460, 30, 536, 992, 1372, 1703, 2013, 2280, 2439, 2447, 2328, 2172,
-    2074, 2074, 2157, 2284, 2436, 2623, 2850, 3069, 3197, 3160, 2924, 2482,
-    1855, 1069, 156, -841, -1845, -2754, -3477, -3950, -4144, -4079, -3798, -3350,
-    -2788, -2175, -1576, -1047, -626, -308, -43, 232, 542, 860, 1143, 1358,
-    1508, 1619, 1718, 1827, 1966, 2149, 2378, 2655, 2978, 3333, 3684, 3979,
-    4160, 4178, 4004, 3652, 3160, 2567, 1895, 1144, 313, -580, -1495, -2378,
-    -3183, -3875, -4416, -4747, -4809, -4583, -4094, -3405, -2615, -1817, -1058, -336,
-    349, 968, 1470, 1811, 1979, 2010, 1949, 1803, 1539, 1141, 650, 165,
-    -197, -374, -389, -296, -106, 200, 620, 1097, 1543, 1870, 2036, 2053,
-    1960, 1784, 1529, 1214, 890, 618, 416, 243, 42, -225, -585, -1049,
-    -1609, -2250, -2942, -3630, -4246, -4751, -5122, -5329, -5330, -5106, -4664, -4038,
-    -3300, -2521, -1747, -1012, -349, 232, 751, 1238, 1717, 2198, 2669, 3087,
-    3404, 3580, 3567, 3336, 2885, 2242, 1467, 635, -194, -999, -1764, -2469,
-    -3106, -3670, -4146, -4516, -4755, -4818, -4673, -4331, -3816, -3145, -2352, -1502,
-    -647, 186, 960, 1632, 2175, 2558, 2723, 2618, 2231, 1583, 729, -235,
-    -1189, -2006, -2579, -2836, -2760, -2377, -1731, -886, 63, 1005, 1831, 2451,
-    2809, 2879, 2666, 2203, 1547, 764, -64, -846, -1519, -2070, -2491, -2786,
-    -2981, -3111, -3179, -3167, -3053, -2812, -2438, -1971, -1490, -1062, -727, -498,
-    -350, -221, -52, 197, 549, 1003, 1538, 2136, 2769, 3369, 3842, 4107,
-    4118, 3858, 3342, 2609, 1709, 717, -258, -1094, -1692, -2004, -2055, -1910,
-    -1641, -1309, -980, -722, -557, -466, -404, -317, -171, 42, 306, 580,
-    814, 959, 994, 923, 776, 608, 476, 409, 417, 514, 709, 981,
-    1281, 1565, 1821, 2066, 2314, 2553, 2753, 2882, 2907, 2781, 2462, 1929,
-    1188, 298, -624, -1452, -2103, -2540, -2746, -2710, -2447, -2002, -1452, -892,
-    -386, 64, 482, 868, 1196, 1442, 1607, 1703, 1742, 1735, 1680, 1578,
-    1431, 1255, 1070, 896, 764, 703, 727, 832, 1002, 1211, 1442, 1705,
-    2016, 2362, 2714, 3058, 3394, 3693, 3907, 3980, 3854, 3483, 2869, 2058,
-    1106, 89, -895, -1756, -2439, -2909, -3159, -3225, -3159, -2992, -2738, -2420,
-    -2052, -1634, -1169, -674, -162, 357, 873, 1370, 1817, 2171, 2384, 2436,
-    2339, 2118, 1789, 1370, 890, 402, -26, -329, -457, -394, -157, 227,
-    724, 1282, 1823, 2270, 2560, 2650, 2543, 2273, 1863, 1324, 675, -43,
-    -789, -1530, -2245, -2942, -3643, -4349, -5031, -5627, -6046, -6195, -6030, -5559,
-    -4827, -3905, -2884, -1853, -876, 9, 780, 1418, 1895, 2184, 2265, 2130,
-    1789, 1283, 668, -5, -693, -1347, -1926, -2405, -2760, -2969, -3037, -2989,
-    -2843, -2632, -2421, -2284, -2273, -2405, -2661, -2982, -3300, -3564, -3729, -3745,
-    -3583, -3233, -2722, -2116, -1514, -1016, -689, -568, -655, -918, -1305, -1742,
-    -2146, -2457, -2662, -2769, -2786, -2707, -2526, -2245, -1876, -1442, -967, -459,
-    87, 671, 1291, 1936, 2588, 3221, 3799, 4283, 4634, 4798, 4731, 4413,
-    3861, 3114, 2225, 1254, 251, -753, -1729, -2627, -3390, -3967, -4325, -4457,
-    -4367, -4053, -3523, -2822, -2028, -1223, -447, 297, 1026, 1746, 2431, 3041,
-    3549, 3941, 4193, 4267, 4124, 3742, 3138, 2376, 1553, 768, 102, -374,
-    -592, -508, -138, 437, 1096, 1719, 2187, 2410, 2333, 1961, 1354, 640,
-    -29, -526, -790, -808, -612, -277, 109, 463, 708, 793, 716, 517,
-    250, -36, -297, -508, -664, -770, -831, -860, -859, -813, -692, -479,
-    -180, 188, 610, 1070, 1562, 2076, 2599, 3115, 3615, 4093, 4524, 4870,
-    5098, 5186, 5115, 4885, 4510, 3996, 3355, 2624, 1850, 1066, 309, -369,
-    -925, -1369, -1724, -2012, -2271, -2535, -2800, -3034, -3219, -3344, -3394, -3350,
-    -3197, -2931, -2561, -2128, -1677, -1222, -761, -302, 142, 567, 966, 1330,
-    1640, 1876, 2015, 2037, 1939, 1745, 1498, 1248, 1033, 869, 765, 725,
-    744, 817, 940, 1090, 1228, 1318, 1336, 1280, 1161, 995, 807, 626,
-    490, 448, 530, 728, 978, 1205, 1335, 1310, 1095, 687, 111, -593,
-    -1355, -2081, -2685, -3108, -3302, -3246, -2951, -2465, -1857, -1217, -619, -90,
-    377, 789, 1149, 1477, 1807, 2164, 2555, 2968, 3367, 3708, 3962, 4115,
-    4155, 4065, 3827, 3448, 2960, 2406, 1820, 1214, 577, -112, -857, -1636,
-    -2423, -3194, -3900, -4475, -4860, -5017, -4923, -4593, -4072, -3414, -2672, -1917,
-    -1212, -571, 16, 552, 1029, 1451, 1820, 2128, 2353, 2471, 2441, 2216,
-    1770, 1114, 303, -575, -1430, -2182, -2759, -3099, -3163, -2948, -2499, -1896,
-    -1227, -553, 90, 681, 1225, 1729, 2175, 2515, 2689, 2650, 2381, 1900,
-    1255, 520, -221, -902, -1492, -1993, -2432, -2848, -3272, -3699, -4101, -4426,
-    -4604, -4570, -4299, -3801, -3120, -2329, -1525, -793, -178, 305, 673, 978,
-    1283, 1634, 2048, 2512, 2994, 3448, 3824, 4072, 4155, 4059, 3783, 3338,
-    2753, 2083, 1366, 608, -186, -1013, -1874, -2748, -3587, -4330, -4907, -5265,
-    -5384, -5283, -4985, -4507, -3883, -3161, -2390, -1615, -874, -178, 487, 1135,
-    1768, 2364, 2888, 3295, 3555, 3656, 3615, 3458, 3203, 2865, 2455, 1984,
-    1471, 946, 451, 13, -367, -699, -991, -1268, -1550, -1852, -2187, -2569,
-    -2987, -3395, -3734, -3935, -3927, -3669, -3167, -2474, -1680, -901, -227, 289,
-    628, 788, 784, 637, 376, 37, -341, -709, -1006, -1176, -1200, -1095,
-    -882, -572, -199, 199, 598, 984, 1335, 1637, 1903, 2161, 2426, 2713,
-    3033, 3381, 3738, 4085, 4384, 4590, 4664, 4600, 4400, 4063, 3597, 3028,
-    2388, 1703, 998, 314, -317, -876, -1346, -1714, -1994, -2211, -2378, -2501,
-    -2593, -2677, -2768, -2871, -2993, -3118, -3212, -3232, -3141, -2913, -2558, -2112,
-    -1625, -1152, -732, -386, -118, 76, 207, 311, 441, 639, 934, 1329,
-    1797, 2295, 2771, 3181, 3482, 3655, 3701, 3643, 3498, 3281, 2986, 2607,
-    2154, 1649, 1109, 553, 9, -493, -925, -1272, -1539, -1759, -1969, -2203,
-    -2482, -2820, -3205, -3602, -3954, -4200, -4301, -4256, -4095, -3849, -3542, -3189,
-    -2807, -2421, -2063, -1751, -1471, -1197, -915, -617, -312, -11, 275, 540,
-    779, 986, 1165, 1335, 1506, 1688, 1884, 2091, 2308, 2535, 2775, 3029,
-    3284, 3506, 3659, 3724, 3690, 3548, 3300, 2961, 2557, 2101, 1597, 1049,
-    454, -197, -914, -1696, -2516, -3324, -4065, -4682, -5115, -5307, -5235, -4921,
-    -4414, -3786, -3100, -2398, -1708, -1050, -413, 223, 864, 1495, 2101, 2657,
-    3113, 3429, 3596, 3618, 3497, 3257, 2932, 2547, 2118, 1662, 1176, 641,
-    56, -546, -1110, -1577, -1879, -1949, -1748, -1284, -621, 124, 803, 1282,
-    1472, 1340, 913, 268, -488, -1239, -1898, -2415, -2791, -3069, -3318, -3601,
-    -3948, -4337, -4693, -4920, -4932, -4671, -4133, -3373, -2482, -1547, -641, 186,
-    916, 1561, 2131, 2639, 3099, 3505, 3828, 4042, 4131, 4074, 3850, 3464,
-    2939, 2303, 1593, 855, 116, -598, -1245, -1797, -2255, -2629, -2923, -3149,
-    -3319, -3420, -3424, -3315, -3091, -2756, -2327, -1836, -1323, -816, -330, 137,
-    588, 1024, 1440, 1822, 2145, 2387, 2526, 2543, 2422, 2160, 1773, 1289,
-    762, 276, -83, -240, -157, 163, 672, 1300, 1976, 2647, 3278, 3847,
-    4343, 4756, 5078, 5305, 5423, 5417, 5263, 4935, 4419, 3718, 2854, 1880,
-    858, -174, -1189, -2155, -3030, -3758, -4264, -4470, -4333, -3864, -3120, -2193,
-    -1209, -284, 500, 1098, 1496, 1712, 1778, 1732, 1615, 1472, 1337, 1218,
-    1104, 969, 761, 430, -42, -633, -1277, -1873, -2321, -2555, -2552, -2330,
-    -1927, -1389, -764, -112, 518, 1102, 1639, 2133, 2590, 3006, 3362, 3632,
-    3810, 3892, 3869, 3733, 3485, 3135, 2703, 2214, 1679, 1096, 460, -226,
-    -968, -1774, -2634, -3504, -4302, -4933, -5322, -5430, -5260, -4856, -4289, -3630,
-    -2931, -2238, -1585, -984, -426, 96, 583, 1037, 1458, 1844, 2194, 2506,
-    2763, 2942, 3017, 2957, 2729, 2305, 1683, 880, -53, -1027, -1949, -2731,
-    -3294, -3588, -3599, -3351, -2894, -2289, -1599, -880, -181, 462, 1035, 1544,
-    1998, 2396, 2740, 3030, 3259, 3393, 3377, 3155, 2692, 1980, 1041, -67,
-    -1249, -2405, -3455, -4337, -4984, -5342, -5399, -5179, -4731, -4125, -3436, -2732,
-    -2064, -1448, -864, -287, 287, 861, 1433, 1984, 2488, 2931, 3303, 3580,
-    3739, 3771, 3668, 3419, 3031, 2530, 1926, 1229, 461, -337, -1118, -1823,
-    -2397, -2805, -3031, -3067, -2924, -2639, -2270, -1892, -1591, -1435, -1433, -1535,
-    -1649, -1673, -1526, -1175, -647, -25, 575, 1044, 1307, 1346, 1199, 946,
-    664, 411, 223, 121, 88, 59, -53, -303, -700, -1206, -1733, -2166,
-    -2411, -2422, -2207, -1804, -1262, -633, 30, 688, 1331, 1968, 2604, 3226,
-    3804, 4311, 4707, 4927, 4901, 4583, 3972, 3104, 2041, 869, -331, -1496,
-    -2580, -3526, -4271, -4769, -4995, -4930, -4571, -3952, -3153, -2277, -1414, -625,
-    58, 635, 1118, 1522, 1860, 2146, 2388, 2594, 2756, 2844, 2813, 2631,
-    2284, 1763, 1083, 291, -533, -1284, -1850, -2147, -2142, -1851, -1327, -672,
-    1, 615, 1151, 1631, 2093, 2572, 3082, 3621, 4170, 4682, 5091, 5334,
-    5362, 5143, 4676, 3992, 3152, 2216, 1236, 263, -671, -1565, -2424, -3223,
-    -3913, -4440, -4749, -4803, -4616, -4256, -3803, -3340, -2941, -2643, -2435, -2270,
-    -2085, -1830, -1491, -1075, -581, -7, 633, 1311, 1990, 2631, 3208, 3710,
-    4109, 4359, 4428, 4306, 3981, 3459, 2759, 1896, 902, -156, -1176, -2043,
-    -2650, -2913, -2801, -2341, -1601, -676, 316, 1270, 2109, 2800, 3332, 3701,
-    3914, 3982, 3908, 3680, 3288, 2735, 2054, 1282, 446, -441, -1362, -2285,
-    -3157, -3904, -4446, -4708, -4641, -4246, -3589, -2791, -1995, -1328, -864, -600,
-    -486, -461, -470, -452, -357, -165, 91, 332, 469, 430, 172, -314,
-    -989, -1769, -2545, -3191, -3586, -3663, -3427, -2930, -2241, -1446, -622, 169,
-    885, 1526, 2114, 2660, 3161, 3611, 3993, 4276, 4428, 4425, 4240, 3866,
-    3325, 2658, 1897, 1070, 192, -733, -1675, -2580, -3411, -4140, -4723, -5110,
-    -5274, -5209, -4934, -4492, -3936, -3296, -2589, -1844, -1094, -345, 399, 1134,
-    1851, 2538, 3165, 3691, 4097, 4381, 4535, 4540, 4384, 4066, 3588, 2958,
-    2204, 1369, 512, -290, -946, -1362, -1472, -1260, -761, -45, 789, 1620,
-    2325, 2818, 3053, 3034, 2806, 2429, 1968, 1493, 1066, 711, 424, 184,
-    -58, -375, -820, -1394, -2070, -2793, -3490, -4092, -4547, -4823, -4884, -4705,
-    -4296, -3700, -2984, -2219, -1467, -764, -125, 448, 978, 1501, 2031, 2549,
-    3041, 3493, 3876, 4163, 4362, 4485, 4527, 4492, 4400, 4253, 4034, 3721,
-    3287, 2719, 2038, 1278, 474, -328, -1077, -1748, -2331, -2823, -3236, -3597,
-    -3904, -4115, -4181, -4058, -3731, -3222, -2571, -1828, -1055, -313, 358, 930,
-    1363, 1617, 1663, 1488, 1102, 547, -115, -820, -1501, -2105, -2598, -2945,
-    -3110, -3064, -2793, -2292, -1579, -716, 198, 1063, 1790, 2296, 2513, 2419,
-    2036, 1416, 642, -160, -859, -1356, -1588, -1548, -1291, -902, -448, 20,
-    463, 865, 1229, 1558, 1861, 2155, 2467, 2810, 3158, 3453, 3636, 3658,
-    3483, 3094, 2500, 1725, 803, -204, -1220, -2170, -2973, -3541, -3822, -3809,
-    -3532, -3051, -2448, -1805, -1197, -682, -285, -10, 149, 199, 163, 79,
-    0, -31, 2, 94, 240, 411, 541, 564, 433, 117, -399, -1071,
-    -1798, -2458, -2929, -3126, -3019, -2630, -2028, -1305, -558, 144, 750, 1242,
-    1629, 1938, 2182, 2369, 2503, 2569, 2539, 2387, 2102, 1688, 1171, 593,
-    -4, -557, -991, -1238, -1261, -1058, -655, -114, 457, 916, 1141, 1060,
-    664, 13, -785, -1621, -2428, -3173, -3854, -4476, -5034, -5497, -5824, -5973,
-    -5908, -5618, -5127, -4479, -3724, -2917, -2101, -1307, -554, 147, 796, 1391,
-    1928, 2403, 2798, 3072, 3183, 3117, 2869, 2444, 1864, 1169, 407, -366,
-    -1104, -1764, -2285, -2586, -2608, -2343, -1827, -1127, -327, 484, 1245, 1925,
-    2513, 3007, 3415, 3742, 3968, 4048, 3938, 3617, 3084, 2362, 1506, 585,
-    -311, -1077, -1635, -1959, -2061, -1974, -1750, -1442, -1104, -791, -550, -399,
-    -332, -323, -336, -339, -324, -300, -280, -296, -393, -602, -932, -1365,
-    -1842, -2283, -2612, -2770, -2727, -2482, -2053, -1474, -796, -72, 653, 1337,
-    1936, 2430, 2822, 3125, 3353, 3517, 3620, 3660, 3632, 3534, 3360, 3113,
-    2803, 2444, 2059, 1661, 1254, 840, 421, -7, -442, -858, -1217, -1479,
-    -1605, -1561, -1348, -1000, -580, -166, 166, 352, 347, 134, -268, -819,
-    -1474, -2179, -2887, -3559, -4145, -4603, -4899, -5013, -4930, -4663, -4248, -3734,
-    -3164, -2571, -1979, -1407, -870, -358, 142, 626, 1086, 1518, 1916, 2265,
-    2570, 2839, 3071, 3265, 3429, 3566, 3669, 3740, 3797, 3853, 3910, 3962,
-    4003, 4019, 3993, 3904, 3727, 3430, 2995, 2435, 1787, 1095, 408, -214,
-    -717, -1070, -1264, -1314, -1253, -1128, -1006, -964, -1057, -1291, -1625, -1979,
-    -2264, -2397, -2319, -2010, -1518, -938, -363, 134, 501, 723, 832, 860,
-    829, 761, 691, 636, 601, 602, 656, 766, 927, 1123, 1314, 1449,
-    1490, 1404, 1158, 739, 165, -535, -1302, -2039, -2647, -3054, -3223, -3143,
-    -2844, -2389, -1854, -1306, -790, -325, 98, 498, 896, 1311, 1760, 2242,
-    2732, 3176, 3517, 3716, 3756, 3631, 3346, 2914, 2366, 1754, 1147, 609,
-    178, -132, -316, -387, -378, -338, -338, -457, -743, -1201, -1811, -2511,
-    -3185, -3730, -4096, -4268, -4262, -4140, -3996, -3890, -3841, -3841, -3846, -3797,
-    -3647, -3367, -2959, -2455, -1883, -1263, -626, -9, 584, 1169, 1742, 2289,
-    2789, 3200, 3473, 3584, 3523, 3281, 2866, 2305, 1627, 871, 97, -619,
-    -1201, -1584, -1732, -1635, -1326, -870, -346, 166, 600, 923, 1139, 1270,
-    1346, 1391, 1405, 1360, 1224, 982, 642, 245, -150, -493, -732, -825,
-    -769, -606, -397, -209, -105, -102, -179, -309, -472, -651, -844, -1070,
-    -1327, -1603, -1884, -2165, -2443, -2731, -3030, -3323, -3580, -3761, -3809, -3674,
-    -3337, -2819, -2180, -1503, -863, -306, 157, 537, 848, 1103, 1343, 1612,
-    1925, 2257, 2581, 2862, 3068, 3188, 3226, 3196, 3123, 3036, 2956, 2898,
-    2878, 2882, 2883, 2877, 2868, 2840, 2776, 2688, 2585, 2461, 2306, 2106,
-    1834, 1467, 993, 408, -276, -1031, -1819, -2600, -3328, -3938, -4369, -4579,
-    -4545, -4279, -3835, -3288, -2706, -2139, -1622, -1167, -758, -364, 37, 445,
-    854, 1245, 1583, 1815, 1903, 1836, 1637, 1348, 1008, 637, 236, -198,
-    -659, -1127, -1563, -1916, -2142, -2216, -2124, -1872, -1484, -1007, -513, -63,
-    303, 575, 766, 900, 1013, 1136, 1292, 1488, 1735, 2032, 2352, 2671,
-    2971, 3238, 3451, 3612, 3742, 3838, 3887, 3891, 3865, 3816, 3753, 3690,
-    3616, 3510, 3365, 3159, 2872, 2501, 2048, 1518, 940, 349, -235, -798,
-    -1302, -1702, -1960, -2055, -1990, -1781, -1451, -1043, -635, -299, -88, -30,
-    -95, -200, -271, -266, -174, -30, 108, 200, 219, 126, -104, -456,
-    -904, -1422, -1982, -2556, -3134, -3710, -4264, -4750, -5116, -5309, -5291, -5058,
-    -4653, -4143, -3580, -3008, -2479, -2030, -1656, -1344, -1081, -843, -602, -346,
-    -63, 269, 659, 1088, 1511, 1883, 2184, 2414, 2573, 2659, 2685, 2663,
-    2594, 2493, 2382, 2262, 2124, 1966, 1774, 1531, 1239, 901, 516, 83,
-    -384, -866, -1334, -1764, -2142, -2453, -2691, -2869, -3018, -3163, -3334, -3539,
-    -3740, -3858, -3821, -3587, -3153, -2560, -1880, -1197, -579, -76, 284, 491,
-    559, 517, 394, 226, 52, -110, -253, -361, -415, -419, -388, -336,
-    -281, -245, -238, -255, -289, -318, -298, -189, 23, 332, 723, 1164,
-    1614, 2048, 2443, 2767, 2993, 3115, 3133, 3057, 2910, 2712, 2470, 2205,
-    1944, 1696, 1458, 1224, 974, 699, 411, 118, -191, -523, -866, -1206,
-    -1531, -1832, -2108, -2357, -2558, -2692, -2738, -2656, -2406, -1993, -1461, -858,
-    -237, 352, 875, 1307, 1614, 1761, 1737, 1550, 1212, 753, 240, -263,
-    -722, -1111, -1392, -1549, -1586, -1499, -1271, -914, -468, 9, 450, 808,
-    1066, 1216, 1260, 1227, 1132, 962, 718, 436, 138, -162, -424, -608,
-    -695, -664, -503, -248, 52, 379, 720, 1048, 1351, 1649, 1957, 2269,
-    2580, 2886, 3170, 3405, 3574, 3671, 3692, 3652, 3583, 3495, 3353, 3138,
-    2851, 2475, 1987, 1402, 755, 82, -551, -1052, -1367, -1481, -1392, -1129,
-    -752, -333, 61, 372, 566, 631, 574, 429, 252, 103, 38, 95,
-    272, 526, 802, 1041, 1186, 1204, 1093, 867, 547, 179, -203, -590,
-    -989, -1411, -1875, -2400, -2985, -3609, -4243, -4854, -5379, -5748, -5913, -5862,
-    -5596, -5141, -4549, -3883, -3203, -2549, -1943, -1394, -911, -485, -83, 325,
-    742, 1157, 1548, 1884, 2142, 2321, 2434, 2486, 2469, 2371, 2199, 1966,
-    1685, 1361, 999, 599, 170, -259, -632, -901, -1035, -1018, -861, -597,
-    -271, 64, 336, 470, 417, 174, -222, -712, -1208, -1612, -1849, -1873,
-    -1673, -1288, -780, -215, 335, 797, 1128, 1316, 1349, 1226, 973, 646,
-    315, 49, -119, -196, -204, -180, -169, -206, -312, -501, -767, -1092,
-    -1472, -1913, -2409, -2949, -3522, -4087, -4583, -4955, -5149, -5104, -4798, -4274,
-    -3608, -2886, -2192, -1576, -1047, -602, -224, 123, 473, 835, 1204, 1567,
-    1913, 2222, 2473, 2665, 2803, 2888, 2935, 2973, 3013, 3043, 3053, 3034,
-    2960, 2808, 2578, 2266, 1864, 1380, 838, 269, -284, -781, -1190, -1487,
-    -1649, -1685, -1629, -1528, -1447, -1447, -1534, -1664, -1772, -1793, -1661, -1349,
-    -888, -332, 256, 809, 1269, 1604, 1810, 1894, 1876, 1792, 1672, 1532,
-    1388, 1257, 1123, 949, 719, 429, 59, -401, -941, -1545, -2183, -2800,
-    -3340, -3760, -4011, -4043, -3849, -3461, -2934, -2334, -1726, -1154, -646, -220,
-    132, 441, 733, 1026, 1342, 1695, 2077, 2469, 2847, 3180, 3439, 3616,
-    3722, 3775, 3791, 3790, 3789, 3791, 3796, 3800, 3789, 3741, 3626, 3415,
-    3094, 2655, 2097, 1435, 713, -14, -691, -1259, -1650, -1817, -1752, -1484,
-    -1056, -531, 17, 510, 906, 1212, 1448, 1646, 1847, 2088, 2362, 2627,
-    2825, 2898, 2796, 2504, 2054, 1518, 989, 552, 264, 153, 204, 352,
-    517, 642, 689, 632, 476, 255, 2, -267, -546, -837, -1146, -1492,
-    -1876, -2290, -2735, -3217, -3727, -4227, -4676, -5039, -5282, -5375, -5288, -4997,
-    -4508, -3868, -3152, -2431, -1754, -1143, -587, -75, 396, 826, 1211, 1541,
-    1818, 2042, 2208, 2307, 2340, 2318, 2268, 2219, 2176, 2132, 2091, 2039,
-    1946, 1798, 1596, 1328, 980, 551, 53, -494, -1054, -1581, -2037, -2372,
-    -2536, -2495, -2252, -1839, -1301, -680, -11, 673, 1329, 1917, 2413, 2810,
-    3110, 3318, 3434, 3452, 3379, 3245, 3091, 2918, 2698, 2410, 2049, 1601,
-    1058, 441, -231, -944, -1681, -2409, -3100, -3726, -4251, -4648, -4909, -5033,
-    -5025, -4903, -4682, -4377, -4007, -3605, -3202, -2821, -2474, -2149, -1825, -1484,
-    -1128, -748, -335, 107, 559, 1001, 1424, 1812, 2163, 2477, 2748, 2960,
-    3101, 3164, 3129, 2963, 2633, 2120, 1437, 636, -211, -1029, -1734, -2250,
-    -2532, -2568, -2373, -1981, -1459, -903, -405, -20, 239, 393, 493, 583,
-    686, 811, 972, 1173, 1411, 1672, 1959, 2273, 2613, 2969, 3326, 3671,
-    3988, 4243, 4386, 4364, 4153, 3758, 3205, 2539, 1821, 1104, 432, -174,
-    -709, -1195, -1659, -2123, -2610, -3126, -3648, -4116, -4470, -4670, -4698, -4551,
-    -4244, -3816, -3341, -2889, -2483, -2113, -1760, -1411, -1045, -665, -295, 40,
-    320, 521, 623, 632, 578, 502, 441, 420, 451, 517, 576, 578,
-    479, 250, -118, -603, -1145, -1656, -2052, -2278, -2304, -2133, -1799, -1365,
-    -894, -436, -28, 315, 597, 833, 1047, 1268, 1523, 1825, 2163, 2521,
-    2881, 3232, 3541, 3768, 3891, 3925, 3903, 3856, 3798, 3734, 3669, 3599,
-    3503, 3353, 3124, 2800, 2378, 1876, 1319, 730, 136, -423, -908, -1289,
-    -1538, -1633, -1577, -1399, -1154, -925, -805, -859, -1101, -1511, -2032, -2574,
-    -3037, -3325, -3368, -3148, -2717, -2155, -1526, -876, -255, 303, 791, 1219,
-    1589, 1893, 2094, 2151, 2045, 1785, 1380, 861, 273, -367, -1070, -1825,
-    -2587, -3300, -3912, -4358, -4586, -4568, -4300, -3805, -3148, -2425, -1713, -1055,
-    -475, 20, 452, 848, 1223, 1588, 1953, 2312, 2650, 2946, 3178, 3331,
-    3404, 3417, 3384, 3315, 3207, 3049, 2814, 2471, 2004, 1423, 744, -2,
-    -759, -1458, -2043, -2461, -2663, -2620, -2354, -1918, -1371, -778, -204, 309,
-    753, 1138, 1482, 1816, 2159, 2496, 2798, 3044, 3221, 3330, 3383, 3388,
-    3344, 3247, 3104, 2921, 2715, 2501, 2271, 1992, 1642, 1218, 727, 181,
-    -411, -1046, -1732, -2467, -3230, -3982, -4660, -5185, -5506, -5609, -5504, -5205,
-    -4739, -4159, -3532, -2916, -2347, -1831, -1360, -935, -569, -280, -75, 34,
-    44, -25, -144, -285, -419, -514, -541, -487, -359, -175, 33, 244,
-    441, 603, 706, 726, 640, 426, 72, -394, -907, -1390, -1781, -2037,
-    -2131, -2046, -1787, -1385, -894, -364, 168, 696, 1214, 1721, 2208, 2668,
-    3087, 3453, 3754, 3973, 4086, 4090, 3987, 3771, 3436, 2989, 2453, 1857,
-    1240, 642, 96, -365, -686, -817, -735, -435, 65, 707, 1400, 2054,
-    2593, 2948, 3077, 2983, 2696, 2262, 1759, 1277, 881, 603, 456, 421,
-    433, 420, 351, 218, 31, -186, -400, -592, -764, -926, -1091, -1268,
-    -1452, -1631, -1817, -2049, -2356, -2743, -3184, -3634, -4040, -4374, -4626, -4779,
-    -4818, -4736, -4535, -4226, -3840, -3422, -2998, -2578, -2169, -1766, -1347, -901,
-    -433, 50, 550, 1060, 1564, 2044, 2469, 2819, 3094, 3304, 3440, 3503,
-    3518, 3505, 3462, 3377, 3229, 2985, 2627, 2162, 1597, 932, 202, -526,
-    -1187, -1728, -2107, -2300, -2308, -2142, -1833, -1440, -1018, -592, -176, 226,
-    616, 993, 1348, 1674, 1977, 2258, 2501, 2687, 2801, 2837, 2811, 2748,
-    2657, 2535, 2399, 2278, 2197, 2170, 2209, 2310, 2455, 2611, 2739, 2785,
-    2707, 2488, 2120, 1605, 973, 257, -515, -1322, -2127, -2893, -3580, -4141,
-    -4536, -4740, -4757, -4624, -4410, -4178, -3957, -3764, -3622, -3546, -3519, -3513,
-    -3509, -3477, -3388, -3231, -3019, -2759, -2460, -2135, -1788, -1420, -1040, -651,
-    -244, 186, 619, 1025, 1379, 1656, 1841, 1944, 1980, 1949, 1835, 1620,
-    1289, 829, 244, -447, -1204, -1959, -2608, -3051, -3215, -3075, -2658, -2048,
-    -1373, -760, -282, 49, 267, 426, 597, 834, 1157, 1546, 1965, 2371,
-    2725, 2992, 3150, 3203, 3176, 3101, 3003, 2904, 2816, 2737, 2642, 2505,
-    2308, 2034, 1677, 1239, 720, 127, -516, -1171, -1790, -2310, -2667, -2828,
-    -2805, -2631, -2346, -2010, -1684, -1415, -1213, -1048, -875, -678, -472, -267,
-    -67, 99, 181, 143, -12, -239, -459, -589, -578, -427, -184, 75,
-    273, 354, 282, 41, -362, -900, -1539, -2245, -2970, -3657, -4264, -4749,
-    -5068, -5184, -5089, -4806, -4378, -3852, -3278, -2719, -2228, -1823, -1478, -1156,
-    -831, -485, -121, 242, 583, 894, 1169, 1410, 1632, 1852, 2067, 2241,
-    2336, 2327, 2199, 1941, 1555, 1067, 538, 39, -365, -631, -744, -715,
-    -572, -363, -137, 73, 259, 424, 577, 730, 891, 1062, 1248, 1458,
-    1693, 1945, 2221, 2527, 2845, 3165, 3496, 3832, 4135, 4363, 4498, 4534,
-    4473, 4328, 4113, 3819, 3435, 2965, 2421, 1806, 1134, 435, -237, -811,
-    -1215, -1399, -1343, -1059, -598, -55, 465, 875, 1125, 1211, 1178, 1090,
-    997, 919, 848, 762, 620, 382, 26, -446, -995, -1559, -2068, -2465,
-    -2714, -2804, -2763, -2626, -2413, -2130, -1786, -1391, -939, -431, 104, 609,
-    1021, 1298, 1417, 1371, 1168, 842, 445, 17, -440, -943, -1501, -2126,
-    -2807, -3507, -4177, -4766, -5215, -5461, -5465, -5220, -4743, -4085, -3326, -2543,
-    -1797, -1139, -603, -185, 143, 402, 601, 756, 876, 972, 1049, 1104,
-    1116, 1053, 883, 592, 201, -236, -648, -954, -1064, -927, -552, 9,
-    690, 1409, 2073, 2617, 3012, 3241, 3302, 3220, 3050, 2849, 2660, 2508,
-    2402, 2340, 2310, 2285, 2227, 2112, 1932, 1682, 1366, 1009, 646, 286,
-    -70, -420, -756, -1080, -1382, -1625, -1775, -1803, -1682, -1400, -971, -421,
-    216, 885, 1534, 2126, 2632, 3011, 3220, 3239, 3061, 2687, 2129, 1422,
-    618, -223, -1044, -1781, -2376, -2786, -2994, -3004, -2848, -2580, -2255, -1918,
-    -1601, -1324, -1087, -878, -676, -444, -145, 217, 584, 870, 990, 875,
-    489, -152, -974, -1879, -2775, -3588, -4260, -4760, -5074, -5194, -5119, -4867,
-    -4480, -4012, -3519, -3036, -2571, -2125, -1700, -1282, -848, -383, 117, 650,
-    1207, 1765, 2290, 2741, 3076, 3261, 3262, 3041, 2589, 1927, 1114, 231,
-    -617, -1313, -1745, -1855, -1655, -1213, -622, 14, 604, 1106, 1515, 1850,
-    2152, 2458, 2781, 3117, 3470, 3824, 4134, 4353, 4448, 4404, 4225, 3932,
-    3533, 3034, 2459, 1829, 1148, 415, -353, -1120, -1835, -2430, -2840, -3004,
-    -2883, -2489, -1889, -1165, -395, 341, 976, 1502, 1947, 2340, 2685, 2967,
-    3151, 3185, 3010, 2608, 2028, 1349, 657, 36, -435, -721, -845, -859,
-    -832, -844, -973, -1253, -1677, -2214, -2827, -3475, -4113, -4695, -5176, -5516,
-    -5690, -5693, -5526, -5208, -4793, -4349, -3937, -3590, -3297, -3002, -2654, -2245,
-    -1787, -1279, -738, -202, 304, 768, 1174, 1508, 1748, 1852, 1780, 1516,
-    1058, 432, -297, -1052, -1777, -2409, -2857, -3044, -2937, -2543, -1921, -1162,
-    -348, 458, 1211, 1884, 2462, 2920, 3234, 3377, 3316, 3037, 2568, 1970,
-    1324, 738, 315, 121, 186, 515, 1068, 1766, 2519, 3252, 3911, 4472,
-    4914, 5209, 5340, 5311, 5122, 4765, 4244, 3575, 2771, 1860, 910, 27,
-    -674, -1107, -1231, -1037, -560, 132, 954, 1815, 2632, 3350, 3947, 4404,
-    4700, 4836, 4821, 4667, 4401, 4051, 3615, 3080, 2446, 1720, 919, 83,
-    -754, -1568, -2308, -2877, -3187, -3171, -2800, -2109, -1207, -219, 739, 1579,
-    2243, 2706, 2951, 2976, 2785, 2375, 1753, 980, 144, -670, -1387, -1927,
-    -2209, -2166, -1763, -1042, -138, 748, 1407, 1671, 1469, 839, -98, -1180,
-    -2258, -3226, -4038, -4691, -5221, -5650, -5972, -6156, -6165, -5970, -5573, -5003,
-    -4295, -3491, -2652, -1848, -1133, -562, -180, -8, -55, -326, -808, -1469,
-    -2269, -3132, -3964, -4676, -5178, -5376, -5230, -4770, -4062, -3191, -2260, -1359,
-    -536, 182, 801, 1355, 1870, 2344, 2773, 3143, 3417, 3570, 3593, 3472,
-    3192, 2762, 2191, 1490, 701, -104, -846, -1450, -1847, -1980, -1805, -1314,
-    -566, 335, 1283, 2172, 2906, 3423, 3697, 3704, 3430, 2889, 2130, 1240,
-    341, -438, -982, -1213, -1116, -738, -157, 546, 1290, 2005, 2649, 3204,
-    3664, 4023, 4265, 4386, 4404, 4337, 4187, 3966, 3691, 3364, 2995, 2594,
-    2154, 1663, 1123, 538, -90, -752, -1440, -2153, -2874, -3566, -4191, -4697,
-    -5020, -5128, -5025, -4728, -4274, -3724, -3126, -2517, -1935, -1403, -910, -448,
-    -11, 418, 846, 1242, 1559, 1749, 1774, 1636, 1378, 1040, 649, 228,
-    -229, -746, -1331, -1977, -2668, -3363, -3992, -4485, -4780, -4832, -4637, -4230,
-    -3668, -3033, -2416, -1872, -1419, -1056, -761, -493, -229, 48, 344, 647,
-    933, 1193, 1418, 1585, 1690, 1741, 1738, 1673, 1535, 1310, 990, 595,
-    166, -247, -578, -753, -739, -533, -157, 336, 888, 1452, 1991, 2475,
-    2890, 3227, 3482, 3668, 3806, 3902, 3947, 3932, 3839, 3657, 3390, 3055,
-    2658, 2208, 1717, 1192, 658, 152, -295, -644, -852, -895, -782, -533,
-    -181, 225, 643, 1034, 1357, 1583, 1706, 1724, 1653, 1535, 1409, 1294,
-    1225, 1238, 1340, 1510, 1721, 1929, 2086, 2153, 2094, 1879, 1501, 972,
-    319, -403, -1131, -1819, -2426, -2899, -3197, -3297, -3188, -2890, -2455, -1940,
-    -1397, -880, -414, 9, 394, 749, 1091, 1415, 1685, 1863, 1925, 1857,
-    1675, 1396, 1020, 555, 32, -522, -1097, -1680, -2273, -2892, -3536, -4185,
-    -4808, -5363, -5792, -6052, -6128, -6024, -5780, -5456, -5093, -4712, -4323, -3920,
-    -3483, -3003, -2492, -1975, -1487, -1067, -743, -542, -491, -586, -805, -1118,
-    -1487, -1876, -2270, -2667, -3061, -3449, -3828, -4151, -4356, -4394, -4230, -3852,
-    -3300, -2642, -1938, -1236, -576, 28, 564, 1021, 1408, 1757, 2094, 2431,
-    2763, 3065, 3309, 3493, 3618, 3690, 3725, 3736, 3725, 3699, 3658, 3573,
-    3406, 3134, 2742, 2224, 1597, 886, 123, -637, -1328, -1885, -2247, -2368,
-    -2252, -1936, -1479, -953, -440, 17, 401, 713, 980, 1249, 1552, 1908,
-    2331, 2803, 3284, 3737, 4126, 4414, 4593, 4679, 4681, 4607, 4467, 4259,
-    3978, 3628, 3206, 2706, 2129, 1481, 755, -38, -871, -1714, -2530, -3263,
-    -3858, -4264, -4431, -4352, -4060, -3592, -2983, -2288, -1557, -831, -150, 451,
-    967, 1400, 1735, 1961, 2069, 2051, 1926, 1742, 1542, 1344, 1160, 985,
-    800, 592, 354, 77, -252, -648, -1118, -1653, -2219, -2781, -3304, -3751,
-    -4099, -4332, -4435, -4401, -4244, -3978, -3620, -3208, -2784, -2380, -2020, -1718,
-    -1461, -1227, -992, -731, -423, -76, 295, 674, 1042, 1383, 1688, 1945,
-    2138, 2263, 2312, 2280, 2175, 2008, 1776, 1476, 1116, 701, 256, -161,
-    -484, -668, -678, -507, -189, 226, 695, 1160, 1579, 1944, 2251, 2498,
-    2705, 2904, 3109, 3322, 3545, 3763, 3945, 4073, 4135, 4134, 4088, 4017,
-    3928, 3829, 3725, 3605, 3453, 3258, 2999, 2645, 2184, 1615, 949, 224,
-    -515, -1225, -1855, -2343, -2651, -2760, -2668, -2398, -2002, -1540, -1067, -621,
-    -206, 187, 558, 912, 1262, 1603, 1906, 2144, 2292, 2331, 2257, 2078,
-    1802, 1455, 1075, 699, 342, 18, -266, -507, -701, -851, -972, -1080,
-    -1205, -1373, -1587, -1838, -2132, -2476, -2862, -3266, -3641, -3911, -3994, -3838,
-    -3427, -2781, -1967, -1072, -171, 655, 1330, 1810, 2076, 2105, 1890, 1453,
-    828, 65, -770, -1616, -2429, -3168, -3785, -4223, -4435, -4390, -4091, -3592,
-    -2996, -2429, -2001, -1788, -1834, -2145, -2670, -3328, -4020, -4643, -5102, -5341,
-    -5342, -5124, -4739, -4254, -3729, -3213, -2743, -2321, -1927, -1551, -1183, -811,
-    -431, -58, 285, 570, 782, 920, 999, 1040, 1072, 1113, 1155, 1175,
-    1146, 1032, 806, 465, 25, -469, -948, -1328, -1535, -1520, -1271, -842,
-    -308, 256, 785, 1228, 1577, 1847, 2059, 2252, 2472, 2737, 3036, 3345,
-    3634, 3878, 4061, 4183, 4249, 4271, 4258, 4212, 4124, 3977, 3735, 3367,
-    2874, 2292, 1676, 1093, 610, 274, 123, 169, 395, 763, 1230, 1735,
-    2212, 2611, 2904, 3079, 3143, 3108, 2982, 2776, 2511, 2214, 1913, 1631,
-    1373, 1136, 913, 709, 535, 405, 322, 271, 243, 230, 227, 228,
-    238, 264, 305, 372, 475, 607, 753, 901, 1042, 1175, 1295, 1383,
-    1404, 1329, 1138, 826, 416, -45, -499, -888, -1162, -1302, -1314, -1234,
-    -1116, -1034, -1051, -1210, -1527, -1978, -2520, -3109, -3702, -4246, -4697, -5019,
-    -5187, -5192, -5044, -4775, -4412, -3985, -3522, -3048, -2587, -2151, -1739, -1340,
-    -941, -532, -110, 315, 730, 1117, 1451, 1713, 1900, 2019, 2081, 2099,
-    2083, 2034, 1947, 1814, 1608, 1305, 892, 364, -266, -966, -1676, -2323,
-    -2829, -3121, -3155, -2936, -2511, -1960, -1363, -789, -286, 124, 441, 690,
-    911, 1144, 1414, 1724, 2064, 2428, 2807, 3197, 3589, 3956, 4263, 4482,
-    4604, 4632, 4573, 4432, 4203, 3864, 3398, 2804, 2104, 1355, 635, 37,
-    -354, -475, -302, 133, 751, 1448, 2122, 2698, 3126, 3388, 3482, 3402,
-    3129, 2647, 1963, 1117, 179, -751, -1557, -2123, -2359, -2234, -1793, -1137,
-    -385, 349, 976, 1457, 1803, 2064, 2288, 2505, 2721, 2909, 3020, 2999,
-    2807, 2429, 1881, 1196, 414, -423, -1266, -2064, -2769, -3334, -3700, -3801,
-    -3602, -3112, -2397, -1564, -730, 10, 604, 1041, 1336, 1509, 1573, 1533,
-    1400, 1195, 943, 672, 408, 166, -50, -243, -414, -563, -709, -878,
-    -1100, -1404, -1808, -2304, -2854, -3404, -3925, -4404, -4841, -5234, -5565, -5799,
-    -5882, -5764, -5413, -4829, -4045, -3121, -2144, -1222, -471, 20, 208, 104,
-    -231, -698, -1177, -1559, -1761, -1737, -1501, -1120, -695, -328, -98, -57,
-    -215, -552, -1035, -1626, -2271, -2908, -3490, -3986, -4372, -4618, -4702, -4614,
-    -4360, -3962, -3466, -2930, -2400, -1902, -1439, -1007, -605, -227, 148, 535,
-    931, 1319, 1680, 1988, 2215, 2345, 2379, 2315, 2149, 1877, 1516, 1103,
-    681, 299, 7, -153, -154, 17, 354, 806, 1299, 1768, 2172, 2494,
-    2734, 2913, 3061, 3206, 3386, 3629, 3948, 4323, 4708, 5042, 5281, 5418,
-    5472, 5455, 5382, 5274, 5153, 5032, 4915, 4781, 4577, 4248, 3761, 3113,
-    2327, 1451, 558, -262, -913, -1307, -1389, -1165, -699, -96, 543, 1137,
-    1641, 2038, 2332, 2538, 2668, 2731, 2723, 2634, 2461, 2226, 1965, 1716,
-    1525, 1436, 1468, 1604, 1796, 1973, 2053, 1976, 1721, 1293, 711, 8,
-    -784, -1631, -2479, -3259, -3898, -4330, -4490, -4340, -3892, -3208, -2372, -1486,
-    -648, 72, 645, 1069, 1364, 1543, 1612, 1564, 1403, 1151, 846, 537,
-    259, 22, -198, -432, -700, -1007, -1350, -1723, -2118, -2522, -2914, -3273,
-    -3588, -3859, -4095, -4302, -4481, -4623, -4704, -4690, -4536, -4204, -3686, -3015,
-    -2262, -1524, -884, -407, -131, -69, -199, -467, -810, -1172, -1517, -1849,
-    -2206, -2623, -3103, -3620, -4127, -4572, -4907, -5093, -5090, -4869, -4446, -3875,
-    -3234, -2597, -2023, -1536, -1134, -791, -471, -142, 203, 547, 844, 1025,
-    1026, 824, 441, -78, -675, -1274, -1795, -2157, -2286, -2147, -1764, -1195,
-    -506, 228, 936, 1567, 2096, 2507, 2814, 3051, 3245, 3412, 3566, 3701,
-    3790, 3808, 3744, 3590, 3341, 3009, 2606, 2135, 1598, 1009, 406, -145,
-    -557, -763, -744, -524, -165, 251, 643, 958, 1178, 1322, 1431, 1535,
-    1650, 1795, 1987, 2230, 2520, 2841, 3158, 3437, 3657, 3806, 3869, 3847,
-    3763, 3635, 3475, 3284, 3040, 2699, 2229, 1624, 888, 42, -860, -1752,
-    -2559, -3188, -3538, -3554, -3243, -2662, -1899, -1067, -271, 413, 946, 1336,
-    1626, 1856, 2037, 2145, 2140, 1990, 1681, 1220, 629, -56, -794, -1548,
-    -2281, -2943, -3462, -3760, -3770, -3441, -2772, -1832, -766, 241, 1016, 1432,
-    1427, 1013, 274, -662, -1661, -2589, -3324, -3763, -3842, -3553, -2951, -2158,
-    -1333, -650, -256, -241, -609, -1283, -2145, -3072, -3958, -4721, -5303, -5651,
-    -5730, -5544, -5140, -4589, -3983, -3401, -2887, -2434, -2011, -1589, -1135, -634,
-    -100, 424, 892, 1263, 1510, 1622, 1601, 1458, 1225, 944, 628, 253,
-    -211, -785, -1470, -2223, -2956, -3566, -3967, -4102, -3954, -3560, -2993, -2338,
-    -1689, -1102, -587, -126, 289, 665, 1018, 1353, 1659, 1913, 2091, 2183,
-    2198, 2154, 2067, 1955, 1840, 1745, 1686, 1669, 1688, 1720, 1752, 1778,
-    1789, 1764, 1681, 1513, 1247, 910, 565, 287, 148, 200, 447, 846,
-    1336, 1846, 2314, 2716, 3069, 3386, 3666, 3912, 4138, 4353, 4552, 4713,
-    4801, 4789, 4682, 4493, 4219, 3856, 3395, 2820, 2130, 1365, 597, -97,
-    -628, -902, -869, -555, -57, 503, 1019, 1433, 1741, 1975, 2182, 2399,
-    2641, 2899, 3145, 3339, 3447, 3457, 3372, 3201, 2957, 2647, 2264, 1807,
-    1282, 694, 44, -657, -1391, -2130, -2819, -3382, -3747, -3863, -3710, -3313,
-    -2750, -2117, -1488, -897, -342, 194, 724, 1228, 1651, 1926, 2004, 1871,
-    1557, 1130, 673, 251, -120, -474, -861, -1327, -1902, -2586, -3338, -4087,
-    -4747, -5215, -5397, -5236, -4741, -3966, -2988, -1905, -823, 162, 964, 1519,
-    1787, 1753, 1429, 850, 87, -769, -1613, -2346, -2891, -3249, -3484, -3678,
-    -3900, -4196, -4589, -5055, -5539, -5964, -6230, -6258, -6023, -5554, -4905, -4146,
-    -3351, -2572, -1842, -1181, -597, -79, 379, 756, 1019, 1143, 1118, 956,
-    681, 317, -128, -648, -1229, -1846, -2459, -3022, -3477, -3760, -3808, -3592,
-    -3137, -2506, -1788, -1067, -401, 181, 672, 1085, 1456, 1803, 2113, 2348,
-    2460, 2393, 2112, 1627, 990, 280, -395, -915, -1200, -1217, -976, -523,
-    73, 745, 1435, 2076, 2615, 3039, 3364, 3611, 3796, 3912, 3943, 3888,
-    3769, 3609, 3408, 3164, 2877, 2551, 2198, 1850, 1558, 1384, 1387, 1598,
-    1989, 2480, 2961, 3325, 3494, 3436, 3179, 2797, 2392, 2079, 1965, 2118,
-    2519, 3076, 3673, 4204, 4589, 4792, 4817, 4695, 4477, 4215, 3946, 3672,
-    3369, 3018, 2607, 2124, 1577, 1000, 440, -48, -407, -592, -590, -411,
-    -86, 337, 802, 1260, 1677, 2032, 2322, 2540, 2670, 2696, 2620, 2461,
-    2245, 2004, 1763, 1524, 1274, 999, 690, 341, -58, -524, -1073, -1711,
-    -2412, -3125, -3767, -4223, -4384, -4192, -3649, -2813, -1791, -730, 235, 996,
-    1483, 1667, 1571, 1250, 769, 208, -370, -929, -1454, -1940, -2398, -2856,
-    -3319, -3771, -4179, -4497, -4665, -4643, -4438, -4085, -3642, -3180, -2751, -2350,
-    -1944, -1500, -1007, -481, 22, 417, 622, 565, 212, -416, -1248, -2173,
-    -3049, -3731, -4091, -4047, -3589, -2783, -1760, -678, 307, 1073, 1571, 1804,
-    1781, 1509, 1012, 333, -476, -1339, -2173, -2916, -3550, -4082, -4522, -4866,
-    -5088, -5152, -5031, -4715, -4211, -3559, -2823, -2064, -1328, -654, -67, 421,
-    800, 1065, 1219, 1270, 1229, 1115, 937, 684, 336, -116, -665, -1288,
-    -1941, -2565, -3095, -3471, -3646, -3589, -3306, -2840, -2257, -1636, -1058, -583,
-    -233, 5, 171, 322, 510, 760, 1063, 1392, 1731, 2070, 2390, 2668,
-    2883, 3009, 3024, 2940, 2793, 2610, 2386, 2098, 1715, 1218, 641, 64,
-    -417, -729, -823, -687, -360, 74, 529, 943, 1281, 1529, 1699, 1821,
-    1919, 2006, 2088, 2177, 2289, 2436, 2628, 2863, 3122, 3381, 3624, 3832,
-    3984, 4076, 4119, 4111, 4038, 3894, 3683, 3403, 3071, 2732, 2428, 2176,
-    1991, 1892, 1875, 1928, 2045, 2223, 2436, 2663, 2887, 3085, 3230, 3317,
-    3355, 3340, 3276, 3177, 3052, 2911, 2773, 2660, 2580, 2526, 2483, 2415,
-    2289, 2090, 1802, 1405, 893, 281, -395, -1073, -1667, -2091, -2281, -2198,
-    -1854, -1318, -678, -12, 605, 1108, 1460, 1649, 1670, 1544, 1314, 1024,
-    714, 419, 153, -100, -366, -670, -1038, -1487, -2012, -2595, -3209, -3813,
-    -4356, -4784, -5030, -5036, -4786, -4314, -3664, -2896, -2085, -1304, -609, -48,
-    346, 563, 603, 487, 251, -65, -432, -836, -1275, -1764, -2315, -2907,
-    -3498, -4054, -4543, -4932, -5200, -5322, -5261, -4986, -4505, -3870, -3158, -2458,
-    -1846, -1374, -1076, -946, -937, -992, -1062, -1104, -1073, -949, -738, -459,
-    -147, 140, 341, 419, 363, 181, -105, -465, -867, -1268, -1618, -1867,
-    -1966, -1882, -1612, -1186, -652, -76, 471, 931, 1257, 1420, 1394, 1172,
-    761, 185, -513, -1265, -1995, -2641, -3168, -3555, -3795, -3887, -3849, -3705,
-    -3476, -3185, -2861, -2524, -2195, -1902, -1669, -1499, -1374, -1259, -1111, -899,
-    -618, -275, 116, 521, 893, 1177, 1323, 1288, 1063, 676, 182, -358,
-    -852, -1203, -1338, -1224, -872, -330, 315, 967, 1542, 1969, 2201, 2224,
-    2062, 1756, 1351, 890, 408, -67, -511, -890, -1167, -1303, -1276, -1090,
-    -788, -442, -135, 69, 138, 77, -65, -214, -297, -266, -96, 208,
-    617, 1095, 1600, 2091, 2530, 2888, 3144, 3294, 3358, 3360, 3304, 3178,
-    2977, 2695, 2331, 1893, 1410, 929, 515, 243, 173, 323, 668, 1146,
-    1671, 2156, 2525, 2718, 2711, 2521, 2199, 1818, 1464, 1218, 1137, 1252,
-    1549, 1973, 2450, 2906, 3288, 3574, 3777, 3935, 4079, 4231, 4398, 4553,
-    4647, 4628, 4456, 4121, 3643, 3060, 2400, 1691, 992, 387, -52, -271,
-    -252, -12, 397, 905, 1446, 1957, 2391, 2726, 2952, 3062, 3063, 2975,
-    2816, 2614, 2398, 2188, 1971, 1715, 1393, 982, 476, -117, -782, -1507,
-    -2256, -2955, -3516, -3863, -3947, -3751, -3306, -2700, -2043, -1426, -910, -506,
-    -189, 80, 318, 525, 682, 759, 730, 598, 384, 114, -171, -428,
-    -626, -759, -842, -901, -970, -1084, -1274, -1559, -1944, -2432, -3018, -3686,
-    -4398, -5114, -5783, -6333, -6687, -6804, -6684, -6345, -5818, -5153, -4395, -3584,
-    -2760, -1960, -1205, -517, 68, 523, 839, 1007, 1015, 867, 579, 168,
-    -351, -961, -1648, -2392, -3160, -3915, -4623, -5237, -5692, -5928, -5909, -5625,
-    -5092, -4365, -3529, -2674, -1866, -1125, -443, 195, 811, 1408, 1957, 2413,
-    2733, 2876, 2827, 2619, 2328, 2018, 1730, 1477, 1247, 998, 688, 304,
-    -146, -637, -1140, -1623, -2059, -2425, -2702, -2898, -3033, -3125, -3186, -3231,
-    -3260, -3250, -3173, -3000, -2691, -2208, -1550, -758, 107, 966, 1728, 2306,
-    2642, 2714, 2524, 2104, 1521, 853, 179, -428, -910, -1234, -1373, -1311,
-    -1060, -652, -119, 502, 1153, 1767, 2286, 2661, 2857, 2868, 2708, 2404,
-    2000, 1543, 1066, 592, 157, -210, -514, -761, -945, -1065, -1131, -1131,
-    -1046, -876, -625, -291, 106, 544, 1017, 1527, 2051, 2556, 3027, 3441,
-    3753, 3937, 3987, 3900, 3683, 3357, 2946, 2466, 1945, 1426, 943, 522,
-    204, 29, 19, 172, 464, 860, 1320, 1815, 2316, 2805, 3256, 3631,
-    3890, 4012, 3983, 3804, 3497, 3103, 2658, 2200, 1768, 1393, 1099, 919,
-    886, 1005, 1250, 1576, 1936, 2281, 2570, 2776, 2882, 2885, 2777, 2557,
-    2246, 1891, 1532, 1188, 862, 557, 265, -22, -294, -528, -696, -774,
-    -746, -606, -352, 10, 458, 958, 1473, 1958, 2366, 2658, 2821, 2851,
-    2760, 2575, 2329, 2037, 1694, 1292, 834, 333, -196, -722, -1204, -1595,
-    -1860, -1967, -1905, -1689, -1356, -949, -503, -55, 355, 697, 944, 1074,
-    1075, 945, 686, 309, -160, -666, -1143, -1517, -1730, -1741, -1542, -1166,
-    -676, -146, 347, 732, 954, 984, 815, 458, -46, -643, -1280, -1910,
-    -2486, -2970, -3329, -3544, -3609, -3540, -3368, -3121, -2826, -2507, -2181, -1845,
-    -1507, -1180, -873, -588, -328, -104, 75, 202, 259, 225, 85, -159,
-    -502, -934, -1433, -1979, -2556, -3140, -3692, -4169, -4528, -4725, -4714, -4471,
-    -4006, -3365, -2620, -1858, -1155, -570, -139, 120, 211, 142, -81, -451,
-    -958, -1581, -2282, -3009, -3697, -4295, -4761, -5058, -5153, -5025, -4678, -4151,
-    -3513, -2833, -2156, -1507, -907, -362, 129, 565, 926, 1188, 1329, 1337,
-    1210, 958, 601, 160, -340, -880, -1450, -2044, -2627, -3149, -3567, -3852,
-    -3975, -3913, -3668, -3260, -2722, -2102, -1451, -809, -198, 369, 896, 1400,
-    1897, 2383, 2844, 3244, 3542, 3690, 3655, 3414, 2974, 2376, 1682, 966,
-    304, -230, -585, -730, -669, -451, -164, 92, 240, 244, 128, -57,
-    -249, -387, -416, -320, -113, 194, 591, 1044, 1520, 1982, 2383, 2675,
-    2843, 2898, 2853, 2726, 2541, 2303, 2001, 1630, 1193, 698, 180, -301,
-    -681, -899, -913, -722, -369, 88, 582, 1040, 1402, 1643, 1777, 1844,
-    1908, 2021, 2192, 2416, 2686, 2991, 3305, 3612, 3894, 4125, 4276, 4341,
-    4322, 4223, 4048, 3798, 3462, 3025, 2494, 1901, 1300, 761, 365, 177,
-    214, 455, 839, 1285, 1712, 2064, 2321, 2493, 2599, 2667, 2740, 2858,
-    3044, 3295, 3586, 3875, 4126, 4307, 4401, 4408, 4342, 4219, 4051, 3851,
-    3624, 3357, 3022, 2604, 2103, 1529, 905, 275, -304, -774, -1076, -1179,
-    -1091, -851, -516, -141, 235, 591, 924, 1240, 1559, 1887, 2220, 2544,
-    2840, 3081, 3242, 3310, 3280, 3145, 2919, 2629, 2292, 1905, 1455, 937,
-    345, -316, -1012, -1679, -2233, -2607, -2752, -2650, -2324, -1834, -1265, -699,
-    -197, 207, 514, 739, 889, 959, 938, 816, 595, 292, -58, -410,
-    -712, -909, -964, -873, -659, -361, -42, 233, 416, 487, 442, 298,
-    88, -156, -412, -660, -887, -1086, -1257, -1388, -1472, -1517, -1542, -1568,
-    -1615, -1696, -1811, -1946, -2085, -2215, -2323, -2407, -2477, -2534, -2567, -2561,
-    -2502, -2379, -2194, -1964, -1698, -1396, -1070, -748, -459, -232, -83, -23,
-    -55, -179, -389, -670, -996, -1335, -1654, -1934, -2179, -2410, -2646, -2894,
-    -3155, -3437, -3739, -4044, -4318, -4530, -4657, -4682, -4597, -4402, -4101, -3698,
-    -3219, -2703, -2193, -1723, -1333, -1061, -924, -918, -1038, -1270, -1580, -1933,
-    -2309, -2692, -3062, -3393, -3656, -3811, -3825, -3693, -3430, -3073, -2672, -2292,
-    -1991, -1805, -1742, -1787, -1904, -2049, -2189, -2309, -2405, -2485, -2562, -2647,
-    -2740, -2837, -2933, -3008, -3031, -2963, -2775, -2456, -2033, -1576, -1162, -855,
-    -697, -726, -955, -1352, -1859, -2408, -2922, -3326, -3565, -3602, -3408, -2978,
-    -2352, -1595, -775, 37, 777, 1402, 1884, 2209, 2374, 2387, 2264, 2022,
-    1669, 1211, 667, 84, -493, -1028, -1478, -1814, -2025, -2102, -2039, -1852,
-    -1572, -1231, -861, -494, -147, 165, 439, 688, 935, 1193, 1473, 1790,
-    2148, 2538, 2945, 3334, 3661, 3893, 4014, 4013, 3881, 3620, 3256, 2848,
-    2464, 2157, 1963, 1898, 1960, 2133, 2386, 2664, 2894, 3031, 3064, 2998,
-    2865, 2720, 2626, 2617, 2699, 2871, 3120, 3416, 3719, 3993, 4202, 4311,
-    4295, 4145, 3864, 3483, 3054, 2616, 2191, 1798, 1449, 1152, 923, 785,
-    745, 786, 882, 994, 1077, 1101, 1055, 951, 812, 672, 571, 534,
-    568, 666, 824, 1014, 1196, 1343, 1454, 1524, 1554, 1559, 1546, 1510,
-    1451, 1357, 1217, 1030, 802, 535, 242, -61, -372, -682, -960, -1175,
-    -1309, -1344, -1274, -1116, -896, -635, -358, -79, 193, 446, 675, 892,
-    1101, 1301, 1496, 1678, 1816, 1891, 1906, 1874, 1802, 1703, 1590, 1463,
-    1316, 1132, 898, 621, 322, 31, -224, -414, -515, -520, -440, -299,
-    -121, 73, 260, 429, 587, 736, 869, 985, 1098, 1206, 1293, 1341,
-    1335, 1267, 1145, 996, 849, 713, 586, 483, 417, 391, 400, 441,
-    498, 546, 573, 577, 552, 497, 414, 311, 202, 109, 43, 18,
-    39, 105, 213, 355, 509, 653, 769, 834, 828, 764, 674, 567,
-    446, 319, 186, 47, -87, -196, -266, -293, -284, -263, -250, -267,
-    -348, -505, -726, -997, -1302, -1606, -1879, -2097, -2228, -2251, -2170, -1999,
-    -1765, -1501, -1234, -968, -716, -505, -343, -232, -181, -185, -224, -290,
-    -376, -469, -557, -632, -680, -702, -717, -739, -771, -807, -831, -838,
-    -840, -854, -897, -982, -1112, -1271, -1442, -1595, -1690, -1690, -1583, -1381,
-    -1109, -800, -491, -219, -21, 90, 124, 97, 21, -93, -247, -446,
-    -696, -995, -1334, -1691, -2036, -2328, -2520, -2579, -2496, -2285, -1976, -1608,
-    -1235, -916, -699, -605, -624, -730, -877, -1029, -1176, -1310, -1421, -1506,
-    -1560, -1575, -1562, -1556, -1573, -1609, -1670, -1757, -1854, -1971, -2136, -2346,
-    -2580, -2822, -3044, -3212, -3311, -3335, -3280, -3151, -2956, -2700, -2397, -2078,
-    -1766, -1484, -1262, -1121, -1059, -1080, -1177, -1328, -1507, -1685, -1841, -1973,
-    -2073, -2124, -2132, -2115, -2089, -2077, -2111, -2206, -2344, -2513, -2699, -2887,
-    -3069, -3239, -3373, -3453, -3475, -3432, -3311, -3115, -2846, -2513, -2146, -1782,
-    -1439, -1135, -894, -722, -614, -555, -507, -430, -321, -196, -61, 76,
-    188, 251, 264, 217, 99, -94, -349, -658, -1017, -1403, -1782, -2119,
-    -2377, -2519, -2520, -2365, -2044, -1563, -952, -247, 503, 1228, 1868, 2368,
-    2673, 2747, 2593, 2237, 1713, 1089, 450, -120, -536, -723, -653, -335,
-    210, 935, 1764, 2613, 3412, 4115, 4692, 5106, 5321, 5326, 5118, 4704,
-    4135, 3482, 2799, 2122, 1510, 1010, 650, 460, 453, 606, 874, 1196,
-    1482, 1646, 1639, 1458, 1161, 852, 628, 558, 690, 1020, 1502, 2083,
-    2703, 3290, 3809, 4280, 4720, 5124, 5489, 5791, 5951, 5893, 5569, 4961,
-    4098, 3078, 2032, 1090, 371, -30, -80, 182, 667, 1261, 1852, 2340,
-    2677, 2862, 2919, 2874, 2767, 2647, 2553, 2513, 2542, 2632, 2752, 2878,
-    3011, 3151, 3300, 3480, 3730, 4074, 4508, 4998, 5500, 5940, 6214, 6226,
-    5913, 5259, 4317, 3205, 2071, 1046, 225, -347, -665, -735, -583, -242,
-    237, 783, 1315, 1783, 2169, 2461, 2670, 2821, 2928, 2979, 2947, 2780,
-    2437, 1914, 1243, 474, -313, -1043, -1668, -2144, -2418, -2464, -2283, -1894,
-    -1360, -776, -204, 324, 775, 1125, 1358, 1427, 1280, 898, 306, -431,
-    -1205, -1889, -2364, -2539, -2388, -1963, -1349, -652, 22, 606, 1068, 1374,
-    1490, 1420, 1172, 753, 194, -447, -1126, -1786, -2341, -2714, -2871, -2817,
-    -2576, -2186, -1698, -1173, -663, -198, 210, 554, 842, 1076, 1234, 1281,
-    1188, 940, 540, 12, -605, -1257, -1865, -2340, -2625, -2703, -2594, -2337,
-    -1989, -1616, -1271, -983, -757, -579, -416, -239, -36, 192, 441, 689,
-    902, 1056, 1138, 1136, 1049, 888, 667, 400, 100, -226, -568, -923,
-    -1301, -1699, -2091, -2428, -2651, -2707, -2586, -2314, -1928, -1488, -1067, -708,
-    -429, -260, -224, -312, -505, -770, -1038, -1235, -1317, -1264, -1086, -840,
-    -589, -385, -273, -265, -328, -434, -565, -688, -761, -767, -701, -569,
-    -405, -263, -188, -202, -307, -481, -710, -991, -1320, -1694, -2118, -2579,
-    -3053, -3510, -3906, -4180, -4281, -4185, -3898, -3460, -2929, -2364, -1824, -1356,
-    -978, -693, -509, -430, -440, -515, -630, -762, -917, -1103, -1313, -1528,
-    -1730, -1901, -2025, -2102, -2154, -2206, -2283, -2405, -2578, -2782, -2976, -3108,
-    -3138, -3044, -2828, -2499, -2078, -1601, -1115, -666, -289, -5, 187, 300,
-    331, 268, 109, -149, -513, -962, -1451, -1940, -2397, -2778, -3048, -3170,
-    -3094, -2796, -2299, -1668, -984, -331, 234, 686, 1014, 1214, 1305, 1299,
-    1203, 1030, 787, 467, 65, -395, -879, -1349, -1777, -2135, -2393, -2508,
-    -2459, -2248, -1889, -1412, -867, -294, 284, 836, 1324, 1716, 1992, 2140,
-    2165, 2067, 1857, 1553, 1172, 730, 262, -196, -636, -1065, -1485, -1886,
-    -2230, -2446, -2482, -2323, -1978, -1480, -894, -282, 312, 836, 1240, 1498,
-    1611, 1578, 1408, 1131, 783, 394, -5, -385, -723, -1012, -1245, -1416,
-    -1522, -1561, -1536, -1457, -1340, -1191, -1009, -796, -549, -262, 65, 419,
-    785, 1138, 1445, 1680, 1826, 1867, 1794, 1610, 1330, 980, 593, 212,
-    -124, -382, -550, -618, -585, -464, -289, -101, 53, 128, 105, -7,
-    -188, -403, -605, -756, -829, -801, -660, -408, -58, 365, 836, 1334,
-    1826, 2267, 2620, 2868, 2986, 2966, 2829, 2600, 2290, 1914, 1493, 1039,
-    565, 102, -326, -710, -1023, -1235, -1329, -1293, -1128, -853, -507, -119,
-    294, 721, 1150, 1564, 1953, 2315, 2639, 2903, 3074, 3127, 3066, 2912,
-    2683, 2388, 2042, 1662, 1253, 833, 450, 154, -22, -51, 76, 342,
-    714, 1154, 1616, 2060, 2453, 2773, 3010, 3161, 3239, 3259, 3235, 3173,
-    3074, 2931, 2748, 2542, 2325, 2103, 1889, 1712, 1592, 1531, 1527, 1570,
-    1637, 1704, 1760, 1800, 1814, 1802, 1789, 1797, 1840, 1923, 2057, 2237,
-    2444, 2663, 2889, 3098, 3255, 3340, 3349, 3279, 3129, 2907, 2615, 2245,
-    1807, 1332, 861, 452, 163, 25, 39, 191, 447, 754, 1066, 1351,
-    1591, 1781, 1932, 2068, 2198, 2306, 2376, 2408, 2406, 2361, 2282, 2189,
-    2089, 1983, 1885, 1813, 1761, 1709, 1638, 1531, 1374, 1174, 947, 707,
-    466, 242, 44, -127, -274, -402, -520, -625, -695, -716, -685, -590,
-    -404, -127, 209, 577, 955, 1303, 1576, 1751, 1819, 1772, 1629, 1428,
-    1195, 931, 638, 303, -114, -643, -1262, -1912, -2524, -3020, -3315, -3361,
-    -3169, -2789, -2291, -1752, -1246, -827, -523, -341, -279, -319, -435, -604,
-    -818, -1067, -1341, -1630, -1937, -2256, -2559, -2817, -3003, -3090, -3063, -2928,
-    -2712, -2455, -2200, -1988, -1849, -1798, -1835, -1942, -2089, -2245, -2381, -2460,
-    -2454, -2349, -2158, -1907, -1628, -1353, -1100, -886, -728, -637, -618, -659,
-    -747, -872, -1029, -1214, -1429, -1679, -1957, -2228, -2459, -2643, -2777, -2854,
-    -2870, -2838, -2757, -2622, -2435, -2205, -1929, -1610, -1262, -906, -570, -290,
-    -98, -7, -15, -117, -291, -514, -777, -1079, -1407, -1740, -2065, -2370,
-    -2641, -2860, -3007, -3064, -3010, -2824, -2504, -2074, -1568, -1020, -470, 37,
-    464, 785, 976, 1018, 919, 705, 394, 8, -428, -901, -1408, -1925,
-    -2407, -2816, -3124, -3304, -3350, -3283, -3117, -2851, -2496, -2072, -1600, -1102,
-    -609, -131, 336, 770, 1133, 1399, 1556, 1582, 1466, 1220, 871, 438,
-    -46, -540, -1011, -1432, -1776, -2039, -2233, -2367, -2437, -2455, -2427, -2346,
-    -2193, -1964, -1659, -1276, -826, -346, 124, 556, 930, 1217, 1409, 1514,
-    1541, 1486, 1348, 1132, 836, 448, -34, -600, -1222, -1863, -2474, -3004,
-    -3394, -3591, -3564, -3320, -2893, -2326, -1675, -1007, -368, 223, 756, 1224,
-    1632, 1978, 2245, 2406, 2446, 2355, 2137, 1810, 1389, 881, 303, -302,
-    -891, -1434, -1915, -2314, -2616, -2817, -2913, -2909, -2815, -2653, -2434, -2166,
-    -1850, -1490, -1090, -660, -209, 259, 747, 1255, 1773, 2272, 2712, 3049,
-    3255, 3306, 3189, 2901, 2464, 1906, 1256, 546, -180, -880, -1514, -2027,
-    -2355, -2450, -2287, -1875, -1265, -531, 256, 1038, 1763, 2397, 2932, 3364,
-    3688, 3893, 3956, 3848, 3555, 3097, 2509, 1832, 1134, 487, -54, -446,
-    -647, -641, -450, -108, 352, 872, 1386, 1849, 2243, 2559, 2799, 2972,
-    3082, 3119, 3084, 2997, 2864, 2676, 2425, 2117, 1770, 1410, 1075, 789,
-    551, 350, 180, 29, -119, -280, -451, -623, -775, -880, -891, -773,
-    -520, -147, 329, 882, 1462, 2016, 2516, 2946, 3278, 3485, 3563, 3514,
-    3337, 3042, 2646, 2170, 1638, 1085, 545, 43, -401, -764, -1017, -1141,
-    -1134, -1013, -807, -546, -256, 43, 346, 646, 934, 1204, 1462, 1706,
-    1925, 2104, 2223, 2264, 2222, 2113, 1968, 1825, 1708, 1628, 1583, 1566,
-    1551, 1499, 1387, 1206, 948, 629, 293, -4, -232, -370, -398, -299,
-    -75, 265, 694, 1173, 1657, 2099, 2460, 2710, 2842, 2855, 2756, 2572,
-    2333, 2064, 1786, 1519, 1269, 1039, 837, 674, 549, 469, 448, 499,
-    616, 794, 1020, 1280, 1553, 1816, 2045, 2220, 2333, 2379, 2350, 2242,
-    2069, 1849, 1603, 1342, 1075, 809, 552, 316, 125, 10, -3, 98,
-    311, 627, 1017, 1441, 1863, 2253, 2581, 2816, 2938, 2934, 2795, 2523,
-    2141, 1681, 1186, 707, 297, -11, -209, -315, -352, -348, -323, -293,
-    -263, -236, -204, -158, -88, 14, 151, 321, 522, 757, 1030, 1336,
-    1662, 1994, 2316, 2614, 2869, 3061, 3173, 3197, 3121, 2931, 2619, 2184,
-    1630, 973, 249, -500, -1234, -1898, -2433, -2791, -2945, -2886, -2645, -2280,
-    -1848, -1391, -948, -538, -154, 219, 578, 918, 1231, 1506, 1727, 1875,
-    1924, 1854, 1661, 1359, 958, 483, -26, -535, -1014, -1430, -1749, -1960,
-    -2067, -2074, -1991, -1843, -1669, -1514, -1411, -1379, -1426, -1548, -1733, -1965,
-    -2228, -2490, -2710, -2859, -2923, -2897, -2783, -2596, -2352, -2066, -1760, -1461,
-    -1179, -921, -697, -515, -366, -242, -147, -78, -33, -20, -45, -112,
-    -231, -422, -702, -1080, -1555, -2109, -2705, -3296, -3828, -4238, -4481, -4542,
-    -4431, -4176, -3827, -3440, -3066, -2746, -2524, -2424, -2442, -2551, -2719, -2912,
-    -3091, -3210, -3229, -3122, -2877, -2500, -2011, -1456, -895, -391, 2, 250,
-    343, 291, 108, -182, -553, -975, -1415, -1834, -2209, -2529, -2801, -3036,
-    -3236, -3394, -3498, -3536, -3490, -3352, -3125, -2821, -2465, -2087, -1712, -1361,
-    -1070, -886, -834, -919, -1131, -1448, -1820, -2201, -2565, -2896, -3170, -3372,
-    -3488, -3501, -3399, -3184, -2869, -2466, -1999, -1491, -963, -435, 58, 483,
-    816, 1040, 1139, 1109, 949, 658, 237, -294, -895, -1518, -2118, -2651,
-    -3076, -3366, -3509, -3503, -3350, -3060, -2662, -2191, -1673, -1137, -611, -119,
-    319, 683, 958, 1140, 1234, 1249, 1206, 1139, 1078, 1039, 1024, 1030,
-    1040, 1028, 963, 822, 594, 270, -151, -643, -1156, -1637, -2036, -2306,
-    -2412, -2345, -2119, -1752, -1278, -753, -237, 231, 623, 929, 1157, 1331,
-    1469, 1578, 1658, 1709, 1729, 1700, 1601, 1412, 1140, 805, 428, 19,
-    -401, -804, -1164, -1457, -1656, -1738, -1706, -1579, -1375, -1107, -789, -447,
-    -108, 201, 465, 677, 834, 938, 1005, 1052, 1088, 1119, 1146, 1152,
-    1112, 1010, 844, 619, 353, 84, -155, -340, -454, -480, -416, -282,
-    -96, 129, 387, 677, 1004, 1368, 1761, 2157, 2524, 2828, 3034, 3111,
-    3031, 2784, 2388, 1884, 1317, 730, 169, -331, -740, -1028, -1169, -1156,
-    -998, -714, -319, 157, 673, 1188, 1670, 2102, 2479, 2805, 3073, 3270,
-    3380, 3399, 3332, 3188, 2976, 2707, 2397, 2067, 1742, 1433, 1138, 846,
-    551, 260, -13, -253, -450, -605, -708, -731, -646, -446, -135, 271,
-    738, 1217, 1675, 2090, 2422, 2630, 2702, 2642, 2452, 2153, 1793, 1425,
-    1093, 838, 694, 671, 750, 901, 1083, 1250, 1361, 1387, 1312, 1140,
-    901, 635, 387, 198, 96, 86, 159, 297, 480, 684, 896, 1108,
-    1312, 1497, 1649, 1751, 1796, 1788, 1725, 1595, 1394, 1132, 824, 485,
-    142, -180, -464, -695, -850, -910, -876, -763, -585, -355, -88, 208,
-    518, 814, 1075, 1288, 1452, 1575, 1667, 1728, 1748, 1717, 1633, 1498,
-    1310, 1068, 771, 430, 61, -309, -654, -938, -1135, -1244, -1276, -1245,
-    -1173, -1081, -980, -872, -763, -653, -530, -381, -206, -1, 237, 510,
-    813, 1135, 1454, 1745, 1997, 2203, 2351, 2431, 2445, 2383, 2235, 2005,
-    1705, 1348, 956, 558, 175, -177, -476, -708, -867, -946, -934, -832,
-    -655, -413, -126, 182, 481, 735, 908, 973, 921, 757, 503, 191,
-    -148, -478, -760, -963, -1081, -1121, -1091, -995, -827, -584, -275, 79,
-    450, 818, 1161, 1456, 1686, 1833, 1885, 1840, 1707, 1503, 1247, 959,
-    644, 310, -27, -356, -677, -976, -1234, -1448, -1619, -1733, -1776, -1748,
-    -1648, -1471, -1221, -918, -583, -231, 126, 475, 796, 1069, 1273, 1384,
-    1389, 1290, 1100, 846, 572, 324, 126, -19, -109, -143, -144, -143,
-    -161, -210, -298, -417, -548, -670, -765, -825, -858, -873, -864, -829,
-    -776, -711, -631, -544, -458, -370, -278, -188, -113, -66, -65, -119,
-    -219, -352, -499, -620, -677, -652, -539, -337, -61, 266, 626, 994,
-    1334, 1612, 1805, 1889, 1845, 1685, 1420, 1056, 608, 107, -413, -927,
-    -1410, -1835, -2179, -2417, -2521, -2471, -2266, -1928, -1486, -978, -448, 58,
-    505, 873, 1138, 1283, 1293, 1166, 905, 543, 129, -290, -672, -978,
-    -1183, -1289, -1306, -1248, -1141, -1019, -901, -784, -664, -536, -398, -244,
-    -75, 105, 288, 464, 617, 730, 792, 806, 767, 664, 495, 272,
-    5, -288, -573, -825, -1035, -1192, -1273, -1267, -1178, -1016, -796, -535,
-    -257, 15, 259, 455, 587, 644, 633, 571, 464, 316, 140, -48,
-    -238, -423, -595, -744, -870, -968, -1032, -1061, -1054, -1009, -930, -819,
-    -683, -547, -428, -330, -250, -194, -162, -154, -176, -230, -297, -363,
-    -431, -502, -569, -633, -694, -746, -786, -820, -842, -843, -834, -830,
-    -835, -850, -879, -919, -961, -1005, -1059, -1121, -1181, -1233, -1272, -1295,
-    -1294, -1265, -1214, -1149, -1077, -1000, -921, -842, -761, -679, -609, -550,
-    -495, -436, -374, -313, -259, -223, -221, -261, -345, -478, -664, -899,
-    -1172, -1469, -1774, -2060, -2297, -2467, -2554, -2547, -2447, -2275, -2044, -1767,
-    -1472, -1200, -968, -779, -641, -558, -521, -515, -525, -533, -527, -508,
-    -472, -409, -323, -233, -159, -113, -110, -162, -273, -434, -630, -842,
-    -1056, -1254, -1411, -1507, -1534, -1488, -1368, -1187, -967, -726, -478, -238,
-    -24, 154, 287, 373, 410, 400, 352, 278, 190, 99, 14, -59,
-    -118, -159, -180, -182, -164, -127, -79, -32, 5, 33, 58, 89,
-    129, 182, 264, 373, 493, 604, 698, 770, 806, 801, 761, 691,
-    598, 498, 398, 292, 167, 21, -143, -311, -472, -629, -781, -917,
-    -1031, -1115, -1147, -1109, -1005, -848, -634, -371, -82, 219, 524, 799,
-    1015, 1165, 1248, 1232, 1102, 872, 563, 195, -206, -611, -986, -1298,
-    -1525, -1664, -1713, -1670, -1541, -1347, -1102, -824, -540, -277, -50, 142,
-    304, 446, 572, 684, 780, 854, 903, 929, 937, 926, 893, 830,
-    736, 615, 478, 330, 176, 23, -128, -285, -442, -585, -706, -798,
-    -845, -842, -797, -710, -574, -398, -196, 41, 306, 574, 828, 1074,
-    1318, 1556, 1777, 1955, 2061, 2088, 2033, 1882, 1637, 1325, 975, 610,
-    263, -39, -286, -461, -535, -517, -439, -323, -186, -54, 63, 174,
-    273, 346, 397, 448, 506, 575, 653, 727, 787, 835, 876, 907,
-    934, 964, 990, 1004, 1007, 1001, 987, 976, 973, 976, 985, 998,
-    1004, 999, 995, 993, 983, 968, 960, 958, 954, 953, 954, 957,
-    973, 1011, 1059, 1097, 1124, 1143, 1146, 1125, 1081, 1024, 952, 867,
-    772, 673, 585, 525, 501, 516, 571, 665, 795, 949, 1116, 1287,
-    1450, 1585, 1679, 1732, 1745, 1711, 1640, 1551, 1456, 1356, 1253, 1145,
-    1031, 908, 780, 645, 500, 347, 198, 69, -27, -88, -110, -83,
-    -5, 115, 270, 458, 664, 866, 1046, 1193, 1291, 1334, 1330, 1280,
-    1181, 1038, 865, 672, 467, 265, 78, -83, -196, -246, -231, -163,
-    -54, 80, 213, 323, 385, 386, 329, 239, 137, 28, -86, -194,
-    -283, -340, -349, -303, -205, -65, 111, 312, 523, 720, 884, 1004,
-    1085, 1130, 1133, 1089, 1003, 883, 735, 565, 368, 140, -106, -351,
-    -585, -798, -973, -1094, -1154, -1147, -1070, -932, -744, -517, -266, -16,
-    218, 427, 590, 693, 735, 727, 671, 575, 447, 287, 102, -95,
-    -295, -492, -669, -810, -917, -990, -1023, -1012, -967, -897, -817, -746,
-    -694, -662, -656, -678, -717, -759, -790, -803, -790, -743, -652, -503,
-    -301, -59, 210, 480, 718, 894, 985, 963, 818, 558, 204, -218,
-    -665, -1098, -1491, -1814, -2029, -2115, -2076, -1922, -1662, -1320, -925, -492,
-    -36, 419, 837, 1179, 1416, 1532, 1534, 1433, 1244, 980, 664, 323,
-    -10, -319, -590, -813, -984, -1109, -1186, -1209, -1180, -1115, -1015, -875,
-    -702, -500, -265, -3, 260, 498, 699, 851, 934, 943, 889, 781,
-    625, 436, 239, 46, -137, -309, -462, -589, -687, -755, -790, -787,
-    -746, -667, -549, -396, -217, -23, 180, 371, 524, 625, 670, 655,
-    585, 470, 317, 125, -91, -301, -488, -650, -782, -879, -948, -980,
-    -955, -876, -771, -653, -516, -363, -210, -59, 92, 230, 352, 467,
-    577, 666, 723, 743, 719, 650, 546, 409, 237, 41, -156, -338,
-    -503, -640, -741, -805, -832, -819, -770, -693, -589, -460, -322, -191,
-    -75, 20, 86, 121, 122, 87, 19, -70, -173, -279, -373, -446,
-    -503, -542, -551, -532, -487, -408, -295, -165, -28, 123, 280, 423,
-    537, 623, 670, 673, 648, 605, 541, 449, 334, 204, 74, -38,
-    -128, -206, -269, -315, -351, -384, -414, -442, -466, -484, -496, -507,
-    -518, -517, -493, -429, -317, -169, -5, 170, 358, 552, 741, 912,
-    1033, 1069, 1020, 917, 784, 626, 455, 284, 123, -19, -136, -220,
-    -266, -283, -285, -279, -263, -242, -220, -188, -143, -89, -20, 71,
-    173, 269, 352, 417, 459, 476, 467, 427, 359, 274, 173, 51,
-    -91, -249, -422, -596, -742, -843, -902, -921, -903, -852, -762, -628,
-    -459, -269, -76, 92, 215, 296, 334, 315, 238, 120, -24, -190,
-    -366, -524, -646, -729, -766, -745, -661, -523, -351, -168, 2, 134,
-    221, 263, 259, 208, 116, -2, -134, -264, -375, -463, -531, -574,
-    -578, -540, -466, -372, -280, -205, -138, -70, -11, 32, 61, 73,
-    55, 5, -75, -200, -372, -566, -749, -900, -1000, -1034, -998, -895,
-    -725, -514, -302, -112, 44, 152, 208, 221, 194, 114, -15, -172,
-    -339, -505, -652, -770, -863, -932, -971, -973, -933, -854, -751, -642,
-    -532, -430, -350, -300, -275, -280, -323, -393, -470, -555, -654, -763,
-    -872, -975, -1061, -1123, -1163, -1181, -1170, -1130, -1069, -991, -893, -781,
-    -668, -562, -473, -412, -384, -381, -391, -408, -432, -461, -489, -508,
-    -516, -514, -509, -508, -514, -526, -545, -574, -613, -653, -690, -730,
-    -770, -796, -800, -783, -752, -715, -675, -628, -565, -485, -391, -288,
-    -178, -64, 52, 168, 277, 368, 430, 459, 451, 396, 288, 137,
-    -45, -256, -484, -705, -894, -1033, -1102, -1091, -1013, -882, -700, -476,
-    -229, 25, 273, 492, 667, 796, 878, 901, 854, 743, 586, 409,
-    232, 57, -111, -262, -390, -494, -569, -610, -625, -617, -583, -531,
-    -474, -418, -356, -292, -218, -122, -4, 121, 245, 365, 476, 578,
-    674, 749, 783, 783, 763, 728, 680, 630, 573, 501, 416, 333,
-    257, 190, 120, 35, -73, -196, -325, -454, -571, -666, -740, -789,
-    -800, -766, -691, -578, -428, -249, -52, 153, 358, 556, 741, 900,
-    1030, 1127, 1181, 1186, 1152, 1084, 976, 829, 659, 487, 328, 199,
-    110, 58, 40, 57, 114, 210, 336, 469, 586, 675, 742, 788,
-    813, 815, 792, 759, 734, 731, 747, 777, 812, 844, 862, 865,
-    845, 795, 715, 617, 502, 367, 232, 125, 60, 45, 87, 192,
-    347, 530, 728, 935, 1138, 1320, 1468, 1572, 1611, 1576, 1471, 1309,
-    1107, 890, 678, 484, 323, 219, 178, 193, 253, 345, 444, 540,
-    635, 724, 788, 826, 851, 867, 877, 894, 923, 961, 1006, 1062,
-    1126, 1192, 1250, 1289, 1294, 1264, 1200, 1100, 971, 830, 682, 523,
-    370, 244, 148, 79, 43, 32, 26, 19, 15, 22, 44, 82,
-    135, 210, 314, 439, 574, 716, 864, 997, 1095, 1164, 1208, 1211,
-    1154, 1038, 865, 640, 387, 140, -67, -216, -306, -338, -310, -214,
-    -59, 132, 333, 519, 664, 755, 791, 771, 691, 557, 387, 199,
-    15, -144, -262, -327, -332, -284, -192, -61, 100, 276, 457, 643,
-    828, 994, 1132, 1246, 1333, 1387, 1399, 1363, 1271, 1120, 908, 646,
-    357, 68, -198, -424, -586, -667, -662, -577, -421, -215, 15, 243,
-    460, 667, 863, 1031, 1156, 1233, 1264, 1250, 1202, 1134, 1046, 932,
-    795, 647, 495, 348, 218, 112, 30, -28, -60, -69, -54, -12,
-    56, 152, 275, 417, 564, 706, 836, 943, 1019, 1052, 1031, 959,
-    849, 714, 564, 412, 266, 135, 35, -18, -20, 17, 82, 154,
-    208, 229, 220, 182, 115, 24, -78, -186, -298, -410, -499, -544,
-    -541, -503, -439, -347, -235, -123, -21, 66, 135, 179, 191, 177,
-    140, 79, -8, -111, -209, -291, -353, -384, -373, -325, -247, -146,
-    -39, 56, 135, 197, 227, 219, 185, 140, 85, 19, -53, -120,
-    -179, -230, -272, -299, -302, -291, -273, -242, -201, -166, -147, -139,
-    -135, -142, -162, -190, -224, -257, -283, -305, -329, -347, -361, -382,
-    -411, -431, -442, -448, -447, -432, -410, -391, -376, -359, -331, -287,
-    -229, -167, -100, -31, 23, 51, 56, 39, -13, -102, -217, -349,
-    -497, -649, -787, -903, -1002, -1089, -1170, -1243, -1296, -1313, -1294, -1241,
-    -1149, -1031, -903, -764, -605, -438, -289, -165, -60, 22, 65, 66,
-    30, -44, -153, -290, -440, -590, -736, -875, -1003, -1119, -1216, -1298,
-    -1369, -1423, -1454, -1455, -1422, -1354, -1251, -1108, -933, -739, -535, -327,
-    -127, 53, 200, 306, 363, 360, 298, 178, 4, -209, -451, -709,
-    -957, -1181, -1374, -1525, -1625, -1676, -1678, -1624, -1516, -1374, -1221, -1054,
-    -874, -688, -501, -318, -146, 16, 169, 310, 431, 517, 553, 531,
-    451, 331, 188, 25, -155, -351, -557, -753, -936, -1096, -1214, -1283,
-    -1302, -1269, -1181, -1034, -837, -604, -339, -62, 202, 450, 674, 855,
-    986, 1071, 1115, 1115, 1056, 942, 778, 556, 287, -3, -299, -582,
-    -835, -1041, -1187, -1269, -1278, -1208, -1076, -895, -670, -422, -163, 102,
-    353, 576, 764, 899, 976, 993, 954, 869, 729, 538, 323, 93,
-    -135, -342, -527, -683, -804, -900, -971, -1011, -1014, -963, -864, -734,
-    -579, -405, -209, 6, 223, 435, 636, 782, 852, 846, 761, 598,
-    361, 64, -260, -591, -917, -1214, -1471, -1663, -1770, -1803, -1770, -1665,
-    -1500, -1284, -1029, -758, -488, -240, -29, 153, 297, 395, 452, 461,
-    420, 339, 219, 73, -94, -290, -501, -715, -935, -1147, -1341, -1513,
-    -1647, -1735, -1780, -1776, -1729, -1633, -1495, -1341, -1167, -968, -760, -550,
-    -343, -156, 12, 152, 250, 306, 318, 292, 228, 114, -43, -231,
-    -456, -693, -911, -1107, -1271, -1387, -1461, -1486, -1473, -1433, -1370, -1303,
-    -1236, -1149, -1046, -923, -778, -627, -462, -278, -101, 62, 209, 328,
-    413, 446, 417, 344, 233, 93, -59, -227, -401, -567, -725, -852,
-    -934, -982, -994, -970, -913, -810, -671, -516, -346, -178, -19, 128,
-    241, 317, 358, 356, 331, 305, 275, 253, 233, 205, 182, 156,
-    117, 66, -12, -120, -243, -375, -488, -558, -589, -566, -482, -346,
-    -150, 80, 314, 552, 781, 987, 1167, 1300, 1382, 1414, 1385, 1305,
-    1189, 1038, 868, 681, 475, 272, 77, -113, -271, -392, -481, -531,
-    -547, -523, -453, -345, -188, 11, 227, 468, 733, 1002, 1273, 1527,
-    1738, 1902, 1993, 1993, 1906, 1727, 1475, 1172, 832, 503, 221, -15,
-    -191, -313, -398, -427, -398, -313, -169, 8, 205, 426, 650, 880,
-    1120, 1340, 1530, 1676, 1753, 1759, 1684, 1521, 1303, 1043, 767, 517,
-    295, 110, -24, -110, -144, -121, -65, 23, 129, 231, 345, 472,
-    599, 727, 822, 869, 899, 929, 969, 1020, 1061, 1097, 1138, 1173,
-    1209, 1226, 1193, 1114, 992, 835, 666, 475, 262, 57, -128, -267,
-    -343, -374, -361, -303, -214, -84, 73, 229, 388, 528, 627, 692,
-    711, 681, 616, 502, 350, 184, 17, -116, -192, -209, -141, 18,
-    261, 603, 1013, 1445, 1866, 2213, 2437, 2520, 2446, 2253, 1981, 1642,
-    1255, 814, 302, -237, -755, -1204, -1528, -1707, -1719, -1523, -1121, -542,
-    139, 780, 1258, 1491, 1428, 1092, 532, -184, -936, -1610, -2106, -2335,
-    -2282, -1975, -1451, -790, -57, 688, 1343, 1824, 2063, 2004, 1657, 1055,
-    244, -677, -1594, -2376, -2871, -3005, -2768, -2209, -1447, -580, 315, 1155,
-    1887, 2467, 2847, 3027, 3005, 2774, 2361, 1788, 1103, 390, -296, -908,
-    -1398, -1758, -1964, -2003, -1906, -1695, -1395, -1031, -595, -105, 400, 903,
-    1372, 1795, 2183, 2501, 2707, 2771, 2657, 2385, 1994, 1501, 950, 377,
-    -197, -720, -1171, -1552, -1848, -2072, -2220, -2275, -2264, -2212, -2126, -2029,
-    -1896, -1693, -1417, -1059, -646, -228, 179, 545, 844, 1076, 1211, 1237,
-    1179, 1050, 894, 767, 694, 720, 868, 1126, 1473, 1844, 2147, 2321,
-    2314, 2097, 1693, 1106, 364, -476, -1371, -2254, -3053, -3725, -4207, -4451,
-    -4449, -4197, -3744, -3167, -2522, -1873, -1267, -713, -240, 145, 456, 683,
-    847, 972, 1059, 1137, 1212, 1256, 1265, 1219, 1107, 950, 744, 490,
-    211, -81, -342, -510, -573, -528, -399, -243, -85, 43, 90, 34,
-    -153, -476, -879, -1313, -1719, -2027, -2205, -2213, -2019, -1651, -1147, -576,
-    -39, 410, 728, 885, 896, 771, 527, 220, -114, -434, -694, -894,
-    -1030, -1094, -1104, -1060, -977, -890, -807, -741, -705, -672, -631, -568,
-    -458, -312, -136, 79, 307, 544, 779, 972, 1102, 1146, 1074, 908,
-    672, 390, 108, -159, -396, -571, -678, -700, -616, -454, -233, 17,
-    243, 426, 540, 559, 501, 381, 227, 98, 20, 4, 62, 170,
-    313, 476, 622, 730, 784, 767, 706, 619, 502, 381, 262, 160,
-    119, 146, 230, 358, 494, 633, 781, 925, 1076, 1226, 1356, 1477,
-    1596, 1701, 1805, 1902, 1988, 2080, 2169, 2246, 2298, 2290, 2221, 2099,
-    1902, 1626, 1274, 845, 387, -56, -445, -724, -871, -883, -753, -515,
-    -202, 155, 502, 822, 1108, 1335, 1502, 1602, 1623, 1590, 1512, 1394,
-    1253, 1082, 886, 694, 509, 341, 214, 133, 119, 187, 322, 518,
-    747, 970, 1179, 1345, 1431, 1428, 1311, 1071, 733, 306, -182, -699,
-    -1222, -1702, -2094, -2380, -2529, -2532, -2389, -2077, -1624, -1090, -518, 29,
-    506, 904, 1215, 1445, 1584, 1608, 1523, 1332, 1026, 646, 227, -214,
-    -633, -998, -1290, -1492, -1607, -1634, -1572, -1446, -1259, -1015, -750, -476,
-    -212, 21, 230, 414, 561, 660, 678, 602, 447, 214, -81, -393,
-    -696, -951, -1123, -1202, -1169, -1038, -836, -575, -290, -17, 248, 498,
-    731, 960, 1165, 1319, 1409, 1435, 1418, 1361, 1235, 1044, 794, 496,
-    193, -100, -380, -631, -850, -1023, -1122, -1147, -1103, -1000, -852, -657,
-    -421, -172, 78, 311, 517, 718, 912, 1088, 1245, 1365, 1440, 1471,
-    1443, 1354, 1214, 1026, 812, 586, 358, 149, -50, -247, -416, -552,
-    -669, -767, -852, -919, -951, -946, -895, -801, -677, -507, -285, -29,
-    257, 548, 801, 1003, 1155, 1260, 1322, 1318, 1249, 1121, 918, 638,
-    293, -116, -560, -1005, -1422, -1780, -2068, -2276, -2386, -2405, -2335, -2170,
-    -1942, -1682, -1399, -1116, -859, -645, -474, -321, -169, -1, 204, 410,
-    570, 676, 727, 726, 690, 623, 528, 402, 243, 74, -95, -271,
-    -447, -625, -806, -970, -1121, -1259, -1353, -1376, -1321, -1195, -1035, -870,
-    -716, -578, -443, -326, -259, -242, -271, -332, -398, -458, -518, -575,
-    -629, -660, -645, -581, -463, -289, -69, 186, 452, 693, 895, 1045,
-    1140, 1189, 1182, 1114, 1000, 843, 643, 406, 140, -130, -383, -622,
-    -833, -991, -1075, -1076, -1014, -911, -781, -654, -548, -453, -381, -347,
-    -348, -367, -375, -347, -283, -197, -119, -71, -49, -63, -121, -204,
-    -300, -400, -487, -559, -615, -650, -662, -640, -587, -500, -373, -220,
-    -64, 85, 224, 349, 464, 553, 590, 556, 448, 285, 84, -147,
-    -397, -650, -882, -1055, -1159, -1214, -1245, -1265, -1264, -1220, -1135, -1019,
-    -888, -758, -627, -484, -330, -183, -68, -3, 17, 0, -42, -92,
-    -152, -223, -308, -422, -571, -728, -860, -953, -1005, -1007, -946, -829,
-    -672, -486, -286, -87, 107, 290, 462, 626, 774, 899, 988, 1026,
-    1007, 943, 851, 742, 611, 449, 258, 42, -176, -363, -504, -598,
-    -634, -596, -464, -246, 19, 284, 506, 662, 746, 757, 691, 542,
-    314, 28, -279, -562, -753, -784, -626, -292, 190, 776, 1407, 2021,
-    2572, 3009, 3291, 3407, 3382, 3239, 3013, 2748, 2465, 2148, 1757, 1244,
-    579, -216, -1053, -1812, -2377, -2660, -2618, -2265, -1653, -877, -98, 469,
-    648, 375, -282, -1153, -2004, -2612, -2824, -2595, -1975, -1076, -37, 1006,
-    1934, 2658, 3120, 3290, 3147, 2676, 1876, 789, -476, -1750, -2833, -3547,
-    -3785, -3531, -2853, -1873, -745, 386, 1409, 2235, 2806, 3090, 3063, 2701,
-    2015, 1068, -24, -1114, -2038, -2658, -2903, -2751, -2219, -1394, -423, 536,
-    1363, 1978, 2355, 2522, 2519, 2355, 2018, 1500, 814, 21, -771, -1448,
-    -1932, -2178, -2150, -1824, -1216, -392, 526, 1405, 2146, 2702, 3037, 3093,
-    2811, 2163, 1184, -21, -1303, -2517, -3550, -4304, -4685, -4638, -4190, -3444,
-    -2534, -1570, -636, 181, 759, 985, 847, 451, -36, -454, -689, -668,
-    -368, 204, 981, 1803, 2457, 2775, 2706, 2289, 1605, 734, -263, -1322,
-    -2355, -3260, -3965, -4430, -4609, -4453, -3968, -3246, -2441, -1706, -1141, -760,
-    -519, -362, -254, -152, 12, 292, 686, 1128, 1530, 1820, 1962, 1952,
-    1803, 1516, 1097, 582, 33, -498, -970, -1332, -1522, -1500, -1259, -842,
-    -331, 161, 516, 632, 456, 23, -541, -1070, -1409, -1466, -1234, -771,
-    -146, 581, 1339, 2019, 2506, 2715, 2618, 2242, 1644, 875, -12, -929,
-    -1766, -2419, -2814, -2916, -2744, -2369, -1880, -1342, -808, -322, 76, 347,
-    468, 453, 368, 301, 311, 416, 594, 818, 1066, 1319, 1536, 1648,
-    1575, 1277, 789, 208, -354, -814, -1122, -1249, -1182, -935, -547, -86,
-    372, 777, 1109, 1362, 1531, 1596, 1538, 1344, 1040, 692, 379, 163,
-    78, 127, 293, 556, 891, 1252, 1573, 1800, 1908, 1906, 1830, 1714,
-    1557, 1342, 1063, 728, 355, -13, -328, -554, -661, -621, -439, -161,
-    154, 467, 754, 992, 1173, 1306, 1412, 1512, 1626, 1751, 1860, 1905,
-    1832, 1605, 1219, 695, 82, -557, -1143, -1604, -1878, -1942, -1806, -1507,
-    -1096, -648, -249, 38, 196, 233, 162, 7, -191, -393, -573, -717,
-    -820, -883, -904, -877, -803, -696, -575, -445, -301, -135, 56, 258,
-    440, 566, 607, 547, 376, 89, -310, -794, -1331, -1899, -2495, -3107,
-    -3698, -4212, -4593, -4800, -4803, -4581, -4123, -3445, -2608, -1706, -837, -73,
-    545, 993, 1256, 1319, 1188, 917, 586, 254, -62, -374, -697, -1036,
-    -1385, -1736, -2087, -2414, -2655, -2737, -2618, -2299, -1828, -1281, -719, -165,
-    358, 802, 1119, 1291, 1324, 1242, 1089, 892, 662, 414, 182, -7,
-    -140, -207, -201, -124, 15, 198, 392, 575, 740, 868, 928, 893,
-    745, 474, 96, -331, -741, -1067, -1257, -1284, -1155, -884, -500, -53,
-    403, 827, 1186, 1443, 1588, 1643, 1640, 1596, 1521, 1417, 1285, 1144,
-    1011, 884, 763, 666, 607, 585, 596, 620, 609, 538, 433, 335,
-    283, 322, 488, 767, 1112, 1499, 1916, 2343, 2770, 3189, 3569, 3844,
-    3957, 3861, 3513, 2892, 2014, 926, -287, -1499, -2577, -3415, -3938, -4083,
-    -3802, -3111, -2116, -1020, -47, 620, 894, 797, 464, 109, -55, 119,
-    676, 1551, 2570, 3514, 4200, 4505, 4356, 3737, 2698, 1337, -212, -1769,
-    -3141, -4179, -4784, -4882, -4456, -3593, -2465, -1250, -100, 864, 1579, 2026,
-    2202, 2141, 1930, 1673, 1435, 1260, 1190, 1246, 1434, 1740, 2117, 2457,
-    2633, 2540, 2124, 1379, 356, -850, -2109, -3264, -4166, -4721, -4893, -4701,
-    -4199, -3465, -2578, -1617, -656, 255, 1103, 1897, 2644, 3342, 3979, 4503,
-    4824, 4825, 4412, 3556, 2305, 775, -881, -2501, -3936, -5059, -5767, -5988,
-    -5686, -4894, -3744, -2454, -1265, -365, 141, 253, 80, -199, -397, -355,
-    38, 800, 1828, 2942, 3930, 4596, 4811, 4544, 3824, 2722, 1365, -79,
-    -1434, -2536, -3242, -3474, -3245, -2635, -1789, -923, -273, -9, -189, -741,
-    -1477, -2141, -2499, -2406, -1837, -895, 240, 1379, 2379, 3136, 3587, 3703,
-    3486, 2975, 2261, 1462, 686, 19, -477, -757, -787, -547, -72, 538,
-    1149, 1626, 1853, 1766, 1372, 723, -81, -896, -1557, -1931, -1931, -1528,
-    -768, 225, 1290, 2250, 2938, 3233, 3089, 2525, 1611, 463, -773, -1942,
-    -2891, -3489, -3656, -3387, -2748, -1850, -837, 133, 935, 1477, 1716, 1663,
-    1387, 996, 615, 365, 322, 510, 905, 1443, 2026, 2543, 2905, 3050,
-    2942, 2589, 2052, 1413, 775, 253, -66, -176, -128, 11, 170, 283,
-    309, 232, 35, -279, -653, -996, -1228, -1283, -1125, -771, -280, 293,
-    872, 1353, 1645, 1723, 1620, 1399, 1136, 897, 730, 673, 750, 956,
-    1248, 1572, 1871, 2098, 2227, 2256, 2167, 1934, 1553, 1053, 484, -81,
-    -550, -851, -933, -770, -379, 174, 804, 1435, 1994, 2414, 2654, 2695,
-    2536, 2218, 1819, 1425, 1097, 884, 797, 804, 847, 861, 779, 543,
-    137, -423, -1091, -1781, -2386, -2817, -3013, -2939, -2609, -2094, -1476, -821,
-    -180, 406, 924, 1384, 1789, 2127, 2376, 2497, 2446, 2195, 1744, 1107,
-    317, -576, -1530, -2521, -3516, -4459, -5275, -5889, -6230, -6255, -5952, -5350,
-    -4517, -3539, -2512, -1507, -561, 315, 1124, 1860, 2484, 2921, 3078, 2886,
-    2321, 1412, 237, -1090, -2447, -3713, -4785, -5593, -6093, -6241, -6003, -5387,
-    -4478, -3428, -2441, -1710, -1357, -1393, -1721, -2153, -2459, -2442, -1994, -1119,
-    71, 1383, 2614, 3600, 4244, 4503, 4394, 3969, 3287, 2412, 1417, 350,
-    -768, -1907, -2996, -3951, -4693, -5149, -5263, -5005, -4386, -3455, -2310, -1071,
-    157, 1313, 2371, 3323, 4161, 4857, 5358, 5590, 5494, 5054, 4290, 3258,
-    2042, 740, -569, -1835, -2995, -3967, -4669, -5029, -5003, -4607, -3925, -3070,
-    -2145, -1243, -432, 275, 915, 1543, 2212, 2952, 3757, 4585, 5368, 6003,
-    6378, 6407, 6053, 5340, 4336, 3142, 1857, 582, -595, -1615, -2455, -3106,
-    -3559, -3808, -3843, -3646, -3213, -2572, -1759, -807, 253, 1371, 2473, 3481,
-    4333, 5002, 5479, 5749, 5779, 5530, 4976, 4120, 2985, 1632, 164, -1276,
-    -2538, -3484, -4012, -4083, -3717, -2977, -1959, -792, 383, 1438, 2279, 2865,
-    3219, 3404, 3489, 3545, 3632, 3771, 3922, 4017, 3989, 3782, 3376, 2795,
-    2077, 1250, 348, -588, -1540, -2492, -3388, -4133, -4635, -4819, -4646, -4151,
-    -3434, -2606, -1754, -948, -249, 313, 736, 1043, 1270, 1457, 1623, 1764,
-    1859, 1892, 1851, 1737, 1546, 1280, 960, 598, 185, -287, -791, -1264,
-    -1628, -1808, -1778, -1580, -1304, -1042, -867, -817, -880, -1005, -1128, -1182,
-    -1106, -864, -470, 21, 531, 961, 1210, 1204, 925, 425, -204, -855,
-    -1419, -1816, -2019, -2053, -1959, -1797, -1630, -1498, -1394, -1287, -1150, -965,
-    -730, -479, -267, -136, -103, -151, -220, -227, -112, 144, 519, 957,
-    1387, 1747, 1999, 2120, 2104, 1964, 1726, 1412, 1028, 574, 60, -482,
-    -1008, -1465, -1806, -2010, -2095, -2111, -2113, -2135, -2174, -2192, -2139, -1962,
-    -1614, -1079, -390, 385, 1159, 1835, 2320, 2553, 2516, 2219, 1700, 1012,
-    207, -655, -1504, -2266, -2880, -3279, -3410, -3260, -2850, -2218, -1411, -492,
-    463, 1358, 2077, 2515, 2602, 2307, 1636, 646, -568, -1880, -3146, -4220,
-    -4984, -5363, -5320, -4871, -4096, -3144, -2203, -1447, -963, -724, -626, -547,
-    -392, -123, 249, 696, 1188, 1676, 2090, 2345, 2358, 2062, 1435, 519,
-    -587, -1752, -2840, -3724, -4293, -4469, -4226, -3604, -2723, -1781, -997, -532,
-    -432, -628, -955, -1210, -1230, -926, -285, 613, 1613, 2542, 3268, 3684,
-    3728, 3396, 2731, 1794, 673, -521, -1695, -2776, -3671, -4275, -4504, -4322,
-    -3761, -2940, -2029, -1198, -555, -123, 175, 453, 808, 1294, 1910, 2579,
-    3191, 3656, 3917, 3945, 3739, 3316, 2694, 1904, 1005, 53, -916, -1862,
-    -2735, -3487, -4055, -4349, -4305, -3915, -3233, -2382, -1532, -838, -371, -117,
-    -5, 62, 176, 388, 705, 1112, 1581, 2083, 2570, 2975, 3219, 3219,
-    2909, 2266, 1328, 176, -1075, -2285, -3324, -4101, -4558, -4652, -4376, -3774,
-    -2922, -1936, -949, -58, 705, 1359, 1951, 2525, 3069, 3497, 3703, 3622,
-    3234, 2559, 1657, 610, -516, -1664, -2772, -3760, -4529, -4967, -4985, -4559,
-    -3746, -2669, -1487, -334, 715, 1632, 2400, 3002, 3425, 3662, 3723, 3640,
-    3453, 3198, 2907, 2598, 2278, 1948, 1595, 1198, 735, 193, -439, -1168,
-    -1990, -2869, -3734, -4484, -5012, -5237, -5110, -4625, -3817, -2762, -1561, -329,
-    825, 1811, 2578, 3106, 3408, 3512, 3447, 3242, 2950, 2626, 2305, 2000,
-    1706, 1402, 1046, 609, 78, -534, -1190, -1815, -2304, -2564, -2536, -2221,
-    -1677, -1004, -321, 252, 600, 631, 301, -342, -1160, -1965, -2572, -2859,
-    -2801, -2445, -1877, -1188, -462, 239, 864, 1366, 1705, 1858, 1821, 1598,
-    1221, 758, 295, -81, -301, -338, -214, 15, 291, 576, 851, 1103,
-    1315, 1481, 1611, 1734, 1881, 2078, 2330, 2615, 2904, 3187, 3459, 3695,
-    3834, 3790, 3494, 2918, 2087, 1065, -60, -1182, -2195, -3004, -3529, -3727,
-    -3600, -3187, -2556, -1802, -1026, -311, 295, 792, 1219, 1634, 2079, 2564,
-    3065, 3540, 3939, 4214, 4301, 4135, 3667, 2888, 1829, 570, -764, -2041,
-    -3149, -3994, -4501, -4627, -4355, -3694, -2704, -1497, -207, 1045, 2170, 3097,
-    3777, 4168, 4251, 4044, 3595, 2961, 2200, 1374, 541, -252, -959, -1533,
-    -1937, -2164, -2230, -2176, -2074, -2018, -2080, -2276, -2569, -2887, -3152, -3300,
-    -3288, -3093, -2710, -2167, -1529, -863, -211, 418, 1041, 1686, 2351, 2986,
-    3521, 3886, 4006, 3819, 3312, 2524, 1513, 343, -901, -2123, -3216, -4064,
-    -4553, -4618, -4263, -3553, -2605, -1581, -662, -1, 312, 275, -25, -428,
-    -776, -951, -892, -585, -53, 638, 1387, 2065, 2557, 2787, 2729, 2393,
-    1824, 1100, 325, -380, -882, -1080, -953, -586, -162, 91, -22, -564,
-    -1430, -2390, -3170, -3540, -3393, -2756, -1758, -577, 604, 1654, 2507, 3145,
-    3570, 3790, 3797, 3561, 3058, 2306, 1366, 317, -757, -1785, -2701, -3439,
-    -3931, -4113, -3939, -3395, -2536, -1486, -397, 603, 1435, 2085, 2586, 2977,
-    3262, 3408, 3374, 3131, 2681, 2060, 1317, 507, -328, -1143, -1898, -2555,
-    -3071, -3392, -3481, -3326, -2945, -2377, -1689, -972, -326, 154, 387, 335,
-    43, -368, -747, -935, -817, -376, 308, 1121, 1952, 2701, 3292, 3682,
-    3842, 3735, 3335, 2652, 1728, 645, -471, -1475, -2243, -2692, -2792, -2568,
-    -2080, -1400, -608, 220, 1015, 1721, 2309, 2780, 3141, 3388, 3511, 3499,
-    3332, 2997, 2497, 1856, 1110, 328, -412, -1062, -1599, -1996, -2221, -2250,
-    -2052, -1610, -953, -154, 704, 1540, 2263, 2786, 3066, 3088, 2855, 2392,
-    1737, 940, 82, -703, -1270, -1516, -1408, -981, -337, 384, 1045, 1525,
-    1713, 1534, 990, 164, -814, -1787, -2589, -3075, -3147, -2774, -2003, -969,
-    145, 1158, 1927, 2349, 2383, 2038, 1365, 461, -539, -1467, -2164, -2511,
-    -2465, -2058, -1378, -547, 291, 1003, 1499, 1740, 1723, 1487, 1121, 739,
-    436, 278, 288, 442, 670, 875, 954, 830, 475, -81, -765, -1477,
-    -2109, -2576, -2818, -2806, -2543, -2071, -1453, -763, -69, 580, 1164, 1661,
-    2024, 2205, 2170, 1900, 1401, 727, -41, -808, -1473, -1930, -2106, -1993,
-    -1634, -1112, -539, -15, 396, 647, 692, 502, 101, -439, -1014, -1496,
-    -1763, -1745, -1437, -877, -144, 654, 1410, 2037, 2473, 2680, 2659, 2430,
-    2009, 1433, 761, 54, -636, -1253, -1740, -2076, -2270, -2348, -2361, -2369,
-    -2402, -2448, -2474, -2436, -2295, -2029, -1635, -1120, -494, 197, 881, 1496,
-    2008, 2411, 2715, 2934, 3066, 3096, 3019, 2844, 2595, 2291, 1923, 1456,
-    868, 166, -611, -1410, -2183, -2897, -3519, -4005, -4308, -4379, -4196, -3771,
-    -3157, -2427, -1647, -870, -130, 564, 1206, 1785, 2285, 2684, 2952, 3046,
-    2924, 2570, 1998, 1245, 365, -584, -1538, -2428, -3177, -3708, -3970, -3954,
-    -3702, -3286, -2784, -2256, -1736, -1251, -829, -477, -172, 135, 495, 947,
-    1501, 2133, 2794, 3418, 3915, 4190, 4181, 3866, 3259, 2425, 1462, 462,
-    -510, -1410, -2216, -2905, -3426, -3708, -3691, -3363, -2765, -1988, -1152, -352,
-    378, 1051, 1694, 2320, 2930, 3503, 4001, 4369, 4554, 4516, 4237, 3725,
-    3014, 2159, 1209, 210, -789, -1735, -2571, -3231, -3646, -3770, -3609, -3208,
-    -2643, -2002, -1369, -797, -315, 80, 417, 750, 1137, 1612, 2173, 2788,
-    3398, 3914, 4240, 4300, 4033, 3396, 2394, 1111, -316, -1719, -2923, -3767,
-    -4139, -3996, -3368, -2358, -1119, 197, 1467, 2598, 3537, 4261, 4753, 4982,
-    4920, 4569, 3953, 3119, 2129, 1044, -84, -1202, -2246, -3161, -3892, -4379,
-    -4562, -4413, -3944, -3202, -2263, -1220, -159, 864, 1822, 2689, 3439, 4033,
-    4431, 4591, 4483, 4090, 3418, 2518, 1481, 428, -520, -1248, -1662, -1701,
-    -1362, -720, 59, 749, 1124, 1023, 419, -566, -1704, -2741, -3444, -3658,
-    -3344, -2566, -1443, -129, 1192, 2357, 3258, 3812, 3943, 3617, 2860, 1746,
-    395, -1016, -2299, -3303, -3926, -4124, -3912, -3337, -2465, -1399, -276, 768,
-    1640, 2280, 2669, 2855, 2922, 2955, 3008, 3095, 3195, 3267, 3257, 3101,
-    2750, 2183, 1404, 437, -654, -1752, -2715, -3408, -3722, -3590, -3012, -2063,
-    -889, 332, 1442, 2324, 2907, 3155, 3067, 2672, 2038, 1274, 539, 13,
-    -156, 84, 683, 1510, 2394, 3156, 3658, 3830, 3655, 3151, 2359, 1350,
-    209, -967, -2069, -3000, -3684, -4070, -4136, -3877, -3307, -2460, -1413, -295,
-    761, 1654, 2351, 2866, 3230, 3454, 3535, 3471, 3285, 3020, 2728, 2425,
-    2079, 1641, 1093, 448, -267, -1009, -1721, -2337, -2778, -2966, -2851, -2450,
-    -1837, -1131, -480, -29, 144, 40, -266, -653, -981, -1139, -1097, -903,
-    -650, -452, -413, -601, -1018, -1596, -2199, -2651, -2804, -2564, -1905, -890,
-    332, 1580, 2706, 3620, 4259, 4572, 4515, 4071, 3273, 2219, 1042, -140,
-    -1262, -2319, -3322, -4239, -4982, -5439, -5527, -5217, -4542, -3593, -2496, -1386,
-    -380, 451, 1104, 1616, 2026, 2370, 2669, 2930, 3152, 3324, 3401, 3305,
-    2968, 2358, 1481, 387, -831, -2058, -3183, -4109, -4742, -5004, -4855, -4318,
-    -3493, -2527, -1570, -711, 29, 685, 1306, 1916, 2508, 3064, 3565, 3975,
-    4241, 4291, 4051, 3490, 2648, 1618, 491, -660, -1770, -2770, -3612, -4257,
-    -4656, -4754, -4516, -3946, -3100, -2093, -1071, -138, 665, 1335, 1882, 2332,
-    2695, 2945, 3059, 3039, 2886, 2595, 2178, 1655, 1029, 299, -510, -1370,
-    -2257, -3135, -3947, -4631, -5104, -5274, -5090, -4598, -3919, -3196, -2546, -2021,
-    -1606, -1243, -873, -442, 87, 712, 1399, 2089, 2712, 3194, 3479, 3525,
-    3304, 2812, 2082, 1172, 157, -887, -1897, -2823, -3602, -4145, -4359, -4184,
-    -3612, -2706, -1584, -391, 727, 1645, 2285, 2608, 2589, 2215, 1510, 539,
-    -596, -1775, -2873, -3781, -4416, -4742, -4777, -4578, -4209, -3744, -3258, -2790,
-    -2327, -1829, -1272, -641, 57, 774, 1457, 2079, 2629, 3090, 3444, 3660,
-    3687, 3474, 3017, 2357, 1548, 651, -274, -1192, -2070, -2849, -3445, -3780,
-    -3802, -3500, -2950, -2298, -1693, -1235, -965, -851, -805, -728, -535, -171,
-    373, 1053, 1787, 2480, 3037, 3398, 3550, 3504, 3294, 2972, 2595, 2206,
-    1842, 1544, 1336, 1228, 1224, 1318, 1463, 1584, 1599, 1422, 996, 337,
-    -466, -1277, -1936, -2296, -2283, -1922, -1313, -598, 69, 565, 830, 858,
-    673, 339, -49, -391, -584, -543, -228, 341, 1085, 1883, 2599, 3131,
-    3426, 3468, 3258, 2809, 2130, 1240, 177, -983, -2136, -3143, -3855, -4162,
-    -4024, -3468, -2567, -1439, -231, 921, 1912, 2679, 3192, 3448, 3461, 3270,
-    2922, 2460, 1917, 1334, 752, 198, -315, -777, -1175, -1496, -1724, -1851,
-    -1875, -1805, -1668, -1493, -1310, -1118, -902, -639, -317, 63, 483, 911,
-    1301, 1601, 1761, 1763, 1622, 1387, 1113, 856, 656, 536, 491, 487,
-    488, 483, 484, 519, 607, 735, 850, 887, 796, 549, 141, -400,
-    -1022, -1677, -2324, -2935, -3504, -4035, -4518, -4914, -5167, -5214, -4999, -4497,
-    -3728, -2743, -1623, -492, 515, 1292, 1776, 1941, 1805, 1414, 825, 96,
-    -695, -1466, -2137, -2642, -2914, -2910, -2621, -2091, -1412, -718, -157, 137,
-    64, -418, -1262, -2323, -3403, -4293, -4802, -4804, -4285, -3355, -2190, -982,
-    101, 960, 1581, 2004, 2292, 2492, 2610, 2595, 2388, 1962, 1328, 517,
-    -424, -1430, -2426, -3334, -4058, -4501, -4586, -4279, -3618, -2704, -1680, -671,
-    238, 1002, 1611, 2086, 2448, 2698, 2829, 2841, 2748, 2564, 2310, 2007,
-    1669, 1305, 899, 426, -144, -821, -1590, -2406, -3207, -3914, -4442, -4708,
-    -4652, -4263, -3591, -2739, -1829, -966, -218, 395, 897, 1334, 1749, 2160,
-    2561, 2907, 3122, 3127, 2877, 2369, 1644, 762, -216, -1223, -2175, -2955,
-    -3438, -3528, -3194, -2487, -1530, -479, 522, 1378, 2047, 2540, 2907, 3202,
-    3444, 3614, 3680, 3621, 3435, 3140, 2734, 2195, 1497, 656, -267, -1200,
-    -2063, -2774, -3255, -3457, -3345, -2914, -2201, -1291, -295, 679, 1524, 2169,
-    2607, 2888, 3087, 3264, 3440, 3576, 3605, 3488, 3227, 2831, 2312, 1685,
-    962, 158, -679, -1470, -2139, -2624, -2882, -2920, -2804, -2608, -2381, -2137,
-    -1862, -1517, -1087, -588, -39, 542, 1124, 1676, 2192, 2663, 3046, 3288,
-    3344, 3186, 2828, 2345, 1831, 1350, 943, 621, 363, 132, -98, -360,
-    -703, -1144, -1648, -2124, -2440, -2452, -2074, -1316, -280, 864, 1926, 2751,
-    3267, 3486, 3470, 3289, 2992, 2603, 2132, 1574, 922, 210, -485, -1067,
-    -1428, -1471, -1138, -453, 490, 1519, 2409, 2940, 2984, 2515, 1594, 368,
-    -954, -2169, -3100, -3605, -3600, -3081, -2112, -820, 612, 1980, 3115, 3891,
-    4252, 4219, 3869, 3270, 2469, 1509, 426, -744, -1937, -3067, -4051, -4805,
-    -5236, -5269, -4874, -4072, -2947, -1649, -347, 818, 1735, 2344, 2656, 2718,
-    2562, 2221, 1746, 1200, 657, 220, 6, 72, 413, 984, 1699, 2439,
-    3090, 3574, 3829, 3825, 3580, 3134, 2531, 1807, 993, 98, -876, -1909,
-    -2964, -3982, -4871, -5518, -5835, -5775, -5341, -4604, -3686, -2716, -1801, -1018,
-    -390, 115, 549, 962, 1395, 1862, 2345, 2806, 3206, 3492, 3621, 3593,
-    3439, 3195, 2893, 2560, 2206, 1820, 1387, 887, 292, -413, -1233, -2146,
-    -3095, -3979, -4674, -5053, -5017, -4532, -3647, -2477, -1189, 46, 1106, 1937,
-    2526, 2880, 3029, 2985, 2716, 2168, 1328, 238, -991, -2173, -3096, -3583,
-    -3520, -2881, -1749, -332, 1089, 2211, 2764, 2582, 1668, 200, -1505, -3073,
-    -4161, -4546, -4186, -3220, -1899, -500, 759, 1750, 2451, 2924, 3256, 3511,
-    3711, 3846, 3876, 3753, 3446, 2942, 2246, 1370, 320, -888, -2198, -3494,
-    -4615, -5381, -5642, -5338, -4516, -3317, -1922, -505, 789, 1851, 2631, 3140,
-    3430, 3554, 3549, 3424, 3160, 2741, 2183, 1537, 848, 140, -561, -1225,
-    -1844, -2436, -3022, -3615, -4212, -4788, -5283, -5614, -5695, -5468, -4914, -4083,
-    -3084, -2051, -1079, -205, 577, 1289, 1941, 2514, 2962, 3245, 3339, 3222,
-    2883, 2332, 1603, 748, -161, -1046, -1834, -2462, -2894, -3152, -3319, -3484,
-    -3688, -3903, -4042, -3987, -3646, -2991, -2068, -993, 91, 1049, 1790, 2298,
-    2602, 2743, 2752, 2648, 2441, 2128, 1696, 1128, 405, -471, -1457, -2472,
-    -3423, -4245, -4901, -5377, -5651, -5694, -5490, -5046, -4395, -3597, -2731, -1890,
-    -1162, -602, -212, 64, 298, 532, 749, 883, 874, 717, 476, 253,
-    148, 229, 507, 926, 1386, 1757, 1900, 1698, 1097, 127, -1080, -2300,
-    -3286, -3841, -3858, -3337, -2386, -1181, 93, 1280, 2251, 2921, 3275, 3360,
-    3251, 3009, 2663, 2215, 1679, 1103, 552, 79, -299, -586, -790, -909,
-    -946, -924, -894, -909, -987, -1099, -1181, -1168, -1024, -751, -371, 95,
-    630, 1209, 1795, 2346, 2809, 3122, 3237, 3142, 2855, 2410, 1863, 1266,
-    664, 85, -461, -990, -1526, -2060, -2547, -2910, -3063, -2937, -2525, -1879,
-    -1073, -197, 658, 1423, 2072, 2602, 3015, 3305, 3444, 3390, 3110, 2610,
-    1932, 1153, 373, -314, -826, -1091, -1062, -737, -154, 604, 1398, 2052,
-    2399, 2327, 1811, 931, -141, -1189, -2020, -2491, -2543, -2210, -1587, -794,
-    54, 857, 1560, 2143, 2604, 2944, 3173, 3303, 3329, 3249, 3082, 2871,
-    2656, 2462, 2288, 2108, 1892, 1626, 1326, 1008, 682, 339, -58, -556,
-    -1166, -1841, -2485, -2963, -3132, -2896, -2249, -1268, -107, 1039, 1992, 2654,
-    3001, 3061, 2903, 2598, 2190, 1710, 1206, 744, 377, 153, 112, 259,
-    554, 911, 1204, 1296, 1079, 521, -320, -1304, -2250, -2984, -3395, -3444,
-    -3165, -2645, -1999, -1325, -693, -134, 345, 754, 1132, 1525, 1959, 2420,
-    2862, 3220, 3445, 3517, 3460, 3312, 3102, 2847, 2552, 2198, 1744, 1161,
-    443, -388, -1259, -2029, -2531, -2635, -2299, -1565, -557, 556, 1607, 2472,
-    3084, 3434, 3565, 3537, 3398, 3170, 2855, 2440, 1911, 1272, 547, -208,
-    -893, -1383, -1563, -1374, -864, -223, 279, 408, 56, -716, -1692, -2569,
-    -3080, -3073, -2552, -1662, -618, 392, 1260, 1945, 2454, 2827, 3098, 3283,
-    3395, 3449, 3433, 3310, 3045, 2615, 2008, 1249, 390, -530, -1486, -2444,
-    -3345, -4098, -4597, -4754, -4538, -3980, -3171, -2234, -1286, -403, 385, 1061,
-    1632, 2122, 2542, 2874, 3089, 3169, 3111, 2934, 2674, 2379, 2082, 1792,
-    1501, 1187, 810, 324, -298, -1042, -1864, -2705, -3497, -4180, -4701, -5013,
-    -5062, -4817, -4280, -3500, -2561, -1570, -618, 248, 1023, 1723, 2357, 2898,
-    3282, 3445, 3360, 3046, 2557, 1972, 1364, 775, 210, -348, -923, -1524,
-    -2143, -2745, -3267, -3627, -3742, -3565, -3096, -2372, -1473, -508, 416, 1242,
-    1957, 2573, 3088, 3483, 3717, 3747, 3558, 3176, 2652, 2056, 1458, 924,
-    486, 158, -72, -247, -438, -699, -1027, -1372, -1660, -1807, -1739, -1419,
-    -872, -172, 598, 1365, 2083, 2738, 3335, 3876, 4344, 4714, 4969, 5088,
-    5050, 4843, 4462, 3921, 3249, 2485, 1661, 805, -41, -808, -1420, -1804,
-    -1913, -1733, -1296, -674, 38, 752, 1404, 1966, 2454, 2903, 3339, 3749,
-    4106, 4393, 4597, 4697, 4685, 4560, 4324, 3978, 3525, 2958, 2281, 1532,
-    769, 31, -650, -1249, -1752, -2137, -2345, -2322, -2067, -1618, -1021, -337,
-    364, 1026, 1595, 2015, 2257, 2332, 2270, 2096, 1836, 1500, 1078, 563,
-    -34, -695, -1387, -2041, -2580, -2943, -3101, -3053, -2824, -2461, -2022, -1561,
-    -1103, -637, -153, 341, 830, 1284, 1656, 1906, 2020, 1999, 1834, 1521,
-    1075, 517, -96, -673, -1113, -1343, -1326, -1071, -652, -200, 143, 254,
-    54, -460, -1217, -2082, -2882, -3444, -3653, -3478, -2969, -2237, -1419, -638,
-    33, 555, 921, 1144, 1249, 1261, 1193, 1073, 930, 781, 630, 474,
-    299, 74, -226, -617, -1103, -1677, -2314, -2972, -3585, -4061, -4294, -4220,
-    -3837, -3197, -2387, -1528, -732, -72, 418, 718, 825, 762, 561, 263,
-    -92, -462, -811, -1113, -1335, -1434, -1377, -1182, -926, -717, -661, -839,
-    -1274, -1928, -2725, -3563, -4318, -4860, -5089, -4961, -4494, -3775, -2937, -2096,
-    -1325, -665, -135, 263, 526, 647, 622, 475, 237, -61, -404, -790,
-    -1223, -1702, -2221, -2766, -3320, -3852, -4320, -4677, -4887, -4928, -4793, -4490,
-    -4025, -3407, -2674, -1897, -1160, -520, -4, 381, 641, 782, 798, 687,
-    480, 233, -2, -175, -244, -194, -45, 156, 342, 427, 336, 25,
-    -510, -1228, -2031, -2793, -3385, -3696, -3651, -3240, -2522, -1595, -589, 350,
-    1090, 1560, 1757, 1728, 1537, 1241, 874, 450, -1, -436, -798, -1037,
-    -1111, -1008, -769, -497, -328, -391, -774, -1480, -2411, -3406, -4287, -4886,
-    -5070, -4783, -4057, -3009, -1824, -705, 193, 809, 1155, 1287, 1281, 1210,
-    1119, 1025, 921, 791, 621, 399, 114, -236, -633, -1072, -1562, -2110,
-    -2722, -3398, -4097, -4712, -5102, -5156, -4837, -4201, -3375, -2509, -1713, -1048,
-    -521, -91, 299, 690, 1101, 1504, 1827, 1990, 1965, 1783, 1493, 1142,
-    753, 309, -220, -843, -1556, -2341, -3151, -3900, -4482, -4791, -4735, -4287,
-    -3514, -2544, -1517, -555, 262, 903, 1383, 1738, 2004, 2185, 2252, 2174,
-    1929, 1514, 942, 251, -505, -1275, -1991, -2572, -2944, -3061, -2908, -2508,
-    -1910, -1170, -336, 530, 1370, 2132, 2787, 3324, 3753, 4087, 4319, 4434,
-    4427, 4312, 4119, 3891, 3659, 3427, 3160, 2816, 2354, 1761, 1067, 352,
-    -288, -752, -948, -823, -390, 277, 1071, 1868, 2547, 3031, 3314, 3448,
-    3516, 3606, 3788, 4094, 4530, 5065, 5633, 6137, 6470, 6540, 6291, 5720,
-    4874, 3843, 2752, 1739, 909, 316, -45, -212, -237, -141, 90, 473,
-    977, 1514, 1985, 2314, 2484, 2539, 2559, 2613, 2741, 2951, 3223, 3517,
-    3786, 3996, 4133, 4193, 4171, 4063, 3866, 3579, 3204, 2743, 2217, 1689,
-    1251, 989, 961, 1187, 1639, 2238, 2881, 3480, 3960, 4262, 4370, 4312,
-    4136, 3899, 3657, 3438, 3248, 3111, 3052, 3058, 3074, 3051, 2956, 2757,
-    2441, 2023, 1532, 1004, 505, 114, -105, -120, 69, 431, 914, 1459,
-    2000, 2465, 2802, 2980, 2985, 2815, 2492, 2067, 1600, 1161, 825, 646,
-    653, 842, 1153, 1486, 1716, 1724, 1444, 904, 217, -477, -1044, -1370,
-    -1385, -1077, -496, 263, 1075, 1817, 2400, 2771, 2898, 2763, 2368, 1738,
-    937, 55, -811, -1566, -2126, -2424, -2433, -2166, -1681, -1080, -484, 0,
-    306, 422, 393, 310, 270, 351, 588, 976, 1461, 1964, 2396, 2663,
-    2698, 2478, 2025, 1388, 617, -233, -1093, -1874, -2461, -2736, -2631, -2164,
-    -1431, -560, 302, 1013, 1468, 1611, 1426, 922, 146, -822, -1879, -2896,
-    -3713, -4166, -4163, -3708, -2903, -1928, -1017, -403, -246, -607, -1447, -2604,
-    -3813, -4778, -5276, -5190, -4525, -3426, -2145, -955, -71, 371, 343, -77,
-    -744, -1522, -2311, -3052, -3726, -4343, -4918, -5446, -5900, -6257, -6511, -6679,
-    -6793, -6890, -6985, -7051, -7026, -6834, -6417, -5760, -4906, -3943, -2981, -2129,
-    -1479, -1086, -958, -1075, -1422, -1979, -2711, -3559, -4456, -5333, -6129, -6780,
-    -7235, -7449, -7389, -7048, -6489, -5850, -5297, -4955, -4886, -5063, -5375, -5676,
-    -5854, -5844, -5618, -5203, -4673, -4108, -3558, -3056, -2632, -2302, -2067, -1910,
-    -1819, -1782, -1777, -1762, -1688, -1508, -1192, -730, -152, 464, 1017, 1425,
-    1648, 1685, 1573, 1364, 1103, 807, 481, 122, -268, -688, -1135, -1613,
-    -2126, -2666, -3205, -3712, -4162, -4539, -4833, -5036, -5124, -5055, -4800, -4349,
-    -3696, -2855, -1896, -935, -93, 534, 887, 961, 799, 459, 1, -513,
-    -1033, -1524, -1963, -2324, -2570, -2641, -2473, -2037, -1352, -469, 524, 1498,
-    2311, 2835, 2982, 2724, 2117, 1276, 334, -559, -1250, -1626, -1629, -1268,
-    -629, 142, 916, 1624, 2237, 2736, 3114, 3399, 3652, 3933, 4256, 4574,
-    4828, 4985, 5038, 5003, 4903, 4737, 4458, 4030, 3468, 2821, 2148, 1529,
-    1062, 834, 899, 1270, 1902, 2689, 3503, 4236, 4809, 5182, 5349, 5316,
-    5101, 4728, 4228, 3652, 3091, 2673, 2505, 2623, 2996, 3556, 4195, 4778,
-    5174, 5274, 5005, 4372, 3484, 2515, 1632, 970, 627, 644, 986, 1566,
-    2283, 3031, 3720, 4301, 4777, 5158, 5440, 5614, 5681, 5654, 5556, 5417,
-    5256, 5080, 4895, 4705, 4500, 4268, 3996, 3673, 3275, 2767, 2136, 1415,
-    696, 107, -225, -228, 90, 654, 1369, 2131, 2830, 3373, 3695, 3768,
-    3604, 3273, 2884, 2527, 2258, 2110, 2091, 2185, 2347, 2510, 2596, 2543,
-    2319, 1927, 1395, 764, 61, -709, -1535, -2384, -3208, -3953, -4554, -4945,
-    -5082, -4946, -4549, -3942, -3205, -2428, -1689, -1043, -504, -70, 263, 492,
-    602, 570, 387, 68, -357, -844, -1329, -1759, -2126, -2461, -2803, -3193,
-    -3678, -4273, -4953, -5669, -6357, -6934, -7318, -7457, -7341, -7024, -6618, -6219,
-    -5856, -5512, -5141, -4684, -4101, -3409, -2650, -1857, -1079, -395, 123, 427,
-    488, 315, -29, -480, -1009, -1575, -2118, -2592, -2970, -3224, -3350, -3376,
-    -3343, -3290, -3286, -3414, -3718, -4170, -4675, -5093, -5282, -5153, -4715, -4046,
-    -3237, -2376, -1560, -878, -374, -64, 55, 14, -139, -368, -670, -1033,
-    -1429, -1826, -2189, -2481, -2688, -2846, -3012, -3230, -3506, -3790, -3978, -3960,
-    -3680, -3166, -2524, -1913, -1485, -1355, -1590, -2171, -2969, -3790, -4443, -4769,
-    -4670, -4168, -3380, -2432, -1435, -499, 289, 900, 1318, 1515, 1484, 1252,
-    858, 353, -177, -626, -891, -877, -518, 174, 1095, 2085, 2959, 3548,
-    3751, 3550, 3002, 2221, 1377, 657, 213, 127, 390, 918, 1591, 2290,
-    2927, 3456, 3867, 4172, 4394, 4570, 4722, 4847, 4935, 4981, 4981, 4924,
-    4812, 4655, 4469, 4279, 4109, 3959, 3801, 3611, 3379, 3110, 2839, 2636,
-    2581, 2733, 3104, 3647, 4274, 4895, 5443, 5875, 6178, 6361, 6436, 6407,
-    6293, 6131, 5933, 5676, 5337, 4922, 4461, 4006, 3628, 3397, 3355, 3516,
-    3864, 4353, 4898, 5404, 5799, 6040, 6117, 6045, 5855, 5576, 5234, 4851,
-    4437, 3979, 3442, 2782, 1968, 1023, 51, -789, -1340, -1485, -1186, -510,
-    408, 1421, 2386, 3162, 3645, 3804, 3670, 3324, 2879, 2423, 1973, 1507,
-    990, 381, -358, -1224, -2175, -3157, -4095, -4876, -5370, -5480, -5171, -4475,
-    -3504, -2424, -1402, -563, 47, 450, 700, 839, 884, 837, 691, 436,
-    64, -418, -984, -1601, -2258, -2983, -3795, -4681, -5590, -6426, -7056, -7363,
-    -7277, -6779, -5908, -4773, -3531, -2332, -1290, -478, 95, 469, 677, 718,
-    600, 357, 42, -297, -632, -964, -1313, -1712, -2192, -2766, -3416, -4106,
-    -4777, -5328, -5607, -5472, -4850, -3762, -2355, -894, 318, 1036, 1130, 611,
-    -371, -1578, -2775, -3791, -4559, -5120, -5570, -5996, -6448, -6943, -7456, -7923,
-    -8265, -8402, -8257, -7800, -7070, -6148, -5101, -3966, -2775, -1577, -450, 516,
-    1251, 1701, 1839, 1653, 1143, 328, -741, -1950, -3153, -4223, -5062, -5582,
-    -5718, -5442, -4771, -3756, -2492, -1105, 282, 1569, 2678, 3547, 4140, 4438,
-    4429, 4107, 3487, 2619, 1584, 486, -567, -1478, -2173, -2604, -2759, -2656,
-    -2326, -1806, -1140, -386, 398, 1174, 1920, 2616, 3251, 3828, 4350, 4806,
-    5175, 5432, 5538, 5449, 5142, 4632, 3963, 3215, 2507, 1969, 1713, 1807,
-    2254, 2977, 3843, 4714, 5479, 6059, 6394, 6429, 6131, 5524, 4719, 3898,
-    3257, 2954, 3059, 3538, 4277, 5122, 5920, 6552, 6957, 7119, 7041, 6735,
-    6212, 5478, 4561, 3556, 2626, 1945, 1635, 1725, 2131, 2684, 3191, 3486,
-    3458, 3069, 2373, 1515, 703, 181, 135, 609, 1488, 2555, 3569, 4331,
-    4751, 4841, 4665, 4285, 3749, 3096, 2353, 1536, 663, -254, -1213, -2221,
-    -3260, -4258, -5092, -5626, -5755, -5447, -4774, -3883, -2940, -2077, -1367, -809,
-    -343, 99, 551, 996, 1392, 1679, 1805, 1739, 1479, 1054, 511, -120,
-    -814, -1533, -2260, -3011, -3785, -4528, -5169, -5637, -5848, -5737, -5314, -4652,
-    -3858, -3068, -2414, -1962, -1703, -1609, -1648, -1771, -1938, -2134, -2326, -2463,
-    -2525, -2541, -2557, -2634, -2836, -3190, -3670, -4229, -4824, -5416, -5979, -6502,
-    -6963, -7331, -7571, -7656, -7571, -7325, -6949, -6477, -5942, -5375, -4787, -4176,
-    -3536, -2861, -2152, -1421, -695, -9, 593, 1064, 1367, 1509, 1539, 1531,
-    1535, 1555, 1567, 1534, 1423, 1213, 913, 534, 64, -513, -1182, -1901,
-    -2597, -3155, -3447, -3394, -2978, -2245, -1296, -266, 735, 1635, 2394, 3010,
-    3509, 3917, 4250, 4520, 4736, 4883, 4959, 4972, 4926, 4820, 4662, 4451,
-    4172, 3820, 3405, 2936, 2441, 2000, 1704, 1608, 1744, 2122, 2713, 3449,
-    4255, 5055, 5763, 6310, 6643, 6713, 6491, 5981, 5223, 4290, 3272, 2264,
-    1355, 630, 173, 46, 279, 838, 1607, 2427, 3159, 3711, 4039, 4159,
-    4131, 4017, 3874, 3767, 3740, 3808, 3972, 4219, 4499, 4731, 4851, 4820,
-    4617, 4264, 3807, 3284, 2715, 2128, 1550, 1006, 526, 147, -106, -244,
-    -311, -388, -576, -963, -1578, -2361, -3169, -3826, -4184, -4145, -3696, -2920,
-    -1984, -1065, -325, 110, 185, -59, -525, -1105, -1715, -2309, -2890, -3465,
-    -3999, -4407, -4580, -4422, -3935, -3257, -2610, -2214, -2249, -2814, -3879, -5283,
-    -6792, -8154, -9145, -9597, -9423, -8638, -7346, -5709, -3922, -2202, -740, 348,
-    1019, 1252, 1041, 417, -552, -1766, -3073, -4275, -5181, -5659, -5660, -5239,
-    -4556, -3838, -3303, -3098, -3251, -3675, -4202, -4636, -4784, -4519, -3828, -2827,
-    -1697, -615, 310, 1049, 1634, 2115, 2515, 2825, 3012, 3031, 2845, 2429,
-    1784, 936, -49, -1067, -2003, -2742, -3174, -3208, -2825, -2088, -1120, -50,
-    1001, 1949, 2769, 3468, 4051, 4517, 4866, 5085, 5149, 5044, 4782, 4404,
-    3962, 3525, 3162, 2950, 2942, 3140, 3490, 3899, 4249, 4430, 4372, 4050,
-    3465, 2637, 1640, 598, -349, -1068, -1440, -1404, -972, -220, 740, 1774,
-    2750, 3578, 4206, 4630, 4873, 4976, 4973, 4896, 4759, 4541, 4205, 3725,
-    3097, 2332, 1465, 543, -403, -1368, -2335, -3267, -4106, -4754, -5091, -5029,
-    -4544, -3682, -2543, -1268, 5, 1173, 2154, 2893, 3388, 3674, 3770, 3664,
-    3335, 2778, 2015, 1103, 124, -861, -1819, -2722, -3517, -4135, -4510, -4607,
-    -4451, -4110, -3649, -3101, -2479, -1800, -1088, -377, 286, 826, 1162, 1220,
-    963, 405, -375, -1249, -2090, -2813, -3376, -3766, -3989, -4050, -3932, -3620,
-    -3156, -2649, -2243, -2085, -2299, -2938, -3941, -5144, -6334, -7306, -7897, -8011,
-    -7634, -6824, -5684, -4327, -2861, -1408, -104, 933, 1627, 1942, 1884, 1504,
-    876, 67, -855, -1812, -2699, -3414, -3877, -4034, -3879, -3455, -2850, -2165,
-    -1507, -982, -654, -521, -523, -577, -591, -486, -233, 148, 632, 1199,
-    1817, 2447, 3051, 3595, 4041, 4380, 4635, 4830, 4980, 5096, 5181, 5217,
-    5176, 5021, 4694, 4141, 3359, 2414, 1424, 537, -96, -365, -232, 272,
-    1059, 1993, 2937, 3803, 4557, 5185, 5689, 6081, 6366, 6541, 6618, 6610,
-    6520, 6339, 6072, 5744, 5379, 4981, 4532, 3991, 3339, 2606, 1848, 1108,
-    414, -210, -742, -1147, -1364, -1324, -984, -335, 579, 1650, 2736, 3701,
-    4445, 4913, 5116, 5086, 4833, 4347, 3639, 2752, 1766, 800, -11, -567,
-    -820, -764, -475, -112, 134, 92, -357, -1221, -2347, -3444, -4180, -4277,
-    -3624, -2337, -697, 968, 2367, 3274, 3566, 3221, 2302, 980, -451, -1655,
-    -2367, -2463, -1978, -1114, -186, 462, 547, -91, -1417, -3208, -5136, -6885,
-    -8209, -8951, -9026, -8397, -7104, -5300, -3259, -1346, 69, 703, 448, -612,
-    -2247, -4159, -6058, -7711, -8960, -9695, -9868, -9505, -8699, -7582, -6297, -4970,
-    -3703, -2566, -1587, -766, -81, 500, 994, 1367, 1536, 1438, 1098, 601,
-    13, -653, -1414, -2265, -3141, -3909, -4409, -4510, -4159, -3395, -2332, -1121,
-    97, 1223, 2207, 3040, 3745, 4352, 4874, 5297, 5607, 5774, 5743, 5455,
-    4887, 4065, 3071, 2007, 957, -19, -853, -1464, -1809, -1898, -1764, -1446,
-    -982, -412, 224, 873, 1483, 2029, 2518, 2961, 3373, 3763, 4128, 4446,
-    4689, 4794, 4647, 4140, 3250, 2087, 858, -185, -808, -846, -255, 858,
-    2255, 3644, 4773, 5488, 5756, 5638, 5243, 4707, 4175, 3763, 3524, 3441,
-    3427, 3327, 2990, 2340, 1373, 134, -1266, -2649, -3836, -4694, -5139, -5153,
-    -4795, -4167, -3397, -2660, -2132, -1903, -1954, -2211, -2577, -2967, -3342, -3703,
-    -4040, -4327, -4553, -4705, -4742, -4631, -4345, -3865, -3203, -2419, -1589, -774,
-    -45, 517, 851, 938, 802, 485, 35, -520, -1161, -1859, -2589, -3342,
-    -4119, -4911, -5659, -6245, -6524, -6398, -5863, -4990, -3898, -2719, -1574, -562,
-    246, 814, 1165, 1355, 1446, 1487, 1505, 1500, 1462, 1384, 1253, 1041,
-    741, 377, 10, -277, -385, -233, 214, 939, 1880, 2937, 3990, 4930,
-    5670, 6146, 6336, 6285, 6081, 5810, 5527, 5262, 5018, 4775, 4506, 4177,
-    3734, 3128, 2357, 1477, 587, -179, -676, -796, -481, 260, 1327, 2541,
-    3691, 4604, 5168, 5331, 5084, 4442, 3451, 2224, 938, -210, -1043, -1421,
-    -1262, -575, 527, 1834, 3065, 3931, 4220, 3843, 2847, 1387, -316, -2000,
-    -3381, -4216, -4378, -3891, -2922, -1719, -527, 501, 1322, 1967, 2511, 3030,
-    3556, 4051, 4437, 4614, 4493, 4033, 3264, 2273, 1168, 60, -966, -1882,
-    -2703, -3476, -4276, -5158, -6102, -7011, -7738, -8116, -8008, -7367, -6233, -4711,
-    -2975, -1266, 169, 1122, 1454, 1135, 250, -1036, -2537, -4059, -5423, -6470,
-    -7050, -7048, -6452, -5389, -4113, -2962, -2285, -2313, -3065, -4361, -5876, -7222,
-    -8057, -8183, -7581, -6387, -4858, -3293, -1923, -842, -38, 563, 1042, 1430,
-    1684, 1729, 1510, 1021, 331, -433, -1115, -1565, -1668, -1391, -816, -96,
-    602, 1161, 1553, 1856, 2205, 2715, 3410, 4231, 5066, 5815, 6407, 6804,
-    6962, 6819, 6318, 5450, 4275, 2939, 1674, 749, 393, 720, 1683, 3072,
-    4558, 5783, 6440, 6356, 5506, 4011, 2114, 169, -1426, -2348, -2433, -1716,
-    -415, 1154, 2682, 3946, 4845, 5390, 5664, 5764, 5769, 5707, 5566, 5312,
-    4928, 4414, 3788, 3078, 2291, 1427, 504, -434, -1339, -2159, -2832, -3285,
-    -3434, -3201, -2545, -1502, -214, 1071, 2057, 2516, 2358, 1636, 526, -731,
-    -1903, -2817, -3380, -3594, -3548, -3371, -3181, -3054, -3017, -3079, -3261, -3603,
-    -4138, -4841, -5619, -6347, -6898, -7174, -7105, -6652, -5803, -4607, -3196, -1753,
-    -480, 420, 779, 513, -364, -1740, -3392, -5005, -6271, -6976, -7033, -6465,
-    -5398, -4031, -2577, -1215, -57, 859, 1566, 2125, 2569, 2886, 3065, 3089,
-    2929, 2579, 2083, 1500, 904, 397, 70, -42, 63, 369, 842, 1454,
-    2194, 3027, 3898, 4775, 5620, 6359, 6915, 7233, 7257, 6945, 6296, 5337,
-    4116, 2738, 1373, 232, -480, -631, -202, 722, 1977, 3357, 4678, 5807,
-    6659, 7197, 7437, 7423, 7197, 6828, 6410, 6026, 5719, 5490, 5300, 5099,
-    4834, 4455, 3911, 3170, 2218, 1078, -179, -1441, -2573, -3428, -3870, -3799,
-    -3175, -2061, -626, 906, 2285, 3295, 3799, 3759, 3217, 2298, 1197, 112,
-    -819, -1536, -2053, -2451, -2837, -3301, -3925, -4753, -5765, -6872, -7929, -8753,
-    -9183, -9118, -8521, -7437, -6003, -4418, -2889, -1619, -786, -509, -842, -1741,
-    -3036, -4449, -5656, -6370, -6429, -5840, -4744, -3364, -1936, -660, 312, 851,
-    862, 308, -770, -2232, -3844, -5322, -6400, -6887, -6713, -5946, -4756, -3359,
-    -1970, -732, 314, 1186, 1938, 2638, 3313, 3931, 4455, 4864, 5127, 5217,
-    5124, 4815, 4258, 3447, 2410, 1213, -9, -1066, -1776, -2003, -1702, -949,
-    93, 1247, 2358, 3306, 4037, 4560, 4926, 5208, 5449, 5637, 5733, 5678,
-    5417, 4916, 4164, 3147, 1880, 441, -1058, -2478, -3647, -4406, -4671, -4433,
-    -3743, -2750, -1669, -688, 68, 544, 788, 920, 1058, 1287, 1666, 2207,
-    2851, 3496, 4044, 4421, 4580, 4508, 4216, 3728, 3091, 2375, 1662, 1024,
-    528, 200, 12, -88, -171, -328, -639, -1146, -1872, -2825, -3930, -5056,
-    -6079, -6883, -7390, -7623, -7665, -7547, -7242, -6738, -6027, -5121, -4099, -3076,
-    -2147, -1412, -957, -798, -885, -1161, -1564, -2021, -2502, -3022, -3597, -4249,
-    -5003, -5856, -6762, -7632, -8322, -8671, -8580, -8038, -7101, -5874, -4489, -3073,
-    -1754, -647, 208, 850, 1358, 1806, 2242, 2642, 2902, 2876, 2453, 1616,
-    465, -792, -1895, -2616, -2829, -2527, -1801, -803, 325, 1483, 2612, 3673,
-    4638, 5467, 6101, 6497, 6657, 6624, 6462, 6238, 5993, 5729, 5423, 5034,
-    4500, 3770, 2838, 1747, 582, -546, -1519, -2213, -2524, -2403, -1869, -980,
-    158, 1404, 2627, 3747, 4729, 5555, 6217, 6706, 6993, 7049, 6857, 6425,
-    5780, 4980, 4100, 3211, 2368, 1610, 962, 427, -16, -414, -826, -1305,
-    -1883, -2567, -3340, -4133, -4843, -5366, -5623, -5588, -5296, -4828, -4264, -3694,
-    -3215, -2886, -2710, -2670, -2725, -2802, -2837, -2792, -2627, -2319, -1907, -1487,
-    -1153, -980, -1004, -1199, -1512, -1885, -2248, -2523, -2655, -2615, -2399, -2032,
-    -1556, -1002, -403, 184, 672, 961, 971, 694, 196, -409, -971, -1317,
-    -1309, -895, -109, 943, 2094, 3179, 4091, 4745, 5045, 4934, 4432, 3630,
-    2678, 1785, 1156, 940, 1214, 1969, 3075, 4319, 5464, 6305, 6703, 6603,
-    6020, 5023, 3744, 2366, 1091, 123, -363, -298, 264, 1150, 2077, 2709,
-    2782, 2217, 1135, -184, -1371, -2096, -2181, -1634, -632, 549, 1609, 2322,
-    2598, 2489, 2144, 1733, 1400, 1239, 1296, 1585, 2071, 2673, 3276, 3755,
-    4000, 3949, 3597, 2976, 2150, 1201, 191, -861, -1937, -2971, -3834, -4354,
-    -4382, -3861, -2868, -1584, -246, 916, 1748, 2192, 2266, 2025, 1532, 838,
-    0, -905, -1781, -2549, -3163, -3624, -3974, -4287, -4627, -5043, -5571, -6230,
-    -6999, -7799, -8502, -8941, -8946, -8410, -7341, -5849, -4138, -2486, -1173, -377,
-    -145, -412, -1040, -1859, -2733, -3567, -4301, -4922, -5455, -5928, -6343, -6645,
-    -6752, -6604, -6176, -5481, -4578, -3556, -2492, -1446, -481, 376, 1145, 1854,
-    2522, 3155, 3716, 4139, 4360, 4343, 4065, 3567, 2969, 2439, 2155, 2242,
-    2715, 3453, 4237, 4791, 4863, 4326, 3203, 1644, -70, -1596, -2643, -3041,
-    -2748, -1868, -613, 797, 2169, 3356, 4301, 5048, 5664, 6201, 6684, 7103,
-    7412, 7589, 7624, 7499, 7191, 6694, 6024, 5198, 4240, 3183, 2053, 857,
-    -405, -1712, -2994, -4121, -4926, -5250, -5004, -4193, -2925, -1401, 144, 1513,
-    2587, 3308, 3655, 3637, 3290, 2677, 1887, 1025, 177, -619, -1387, -2164,
-    -2978, -3844, -4736, -5572, -6265, -6740, -6904, -6676, -6041, -5049, -3802, -2466,
-    -1200, -82, 856, 1578, 2077, 2372, 2449, 2289, 1923, 1399, 762, 71,
-    -619, -1294, -1957, -2607, -3229, -3753, -4066, -4075, -3737, -3053, -2086, -955,
-    226, 1368, 2396, 3268, 3990, 4585, 5060, 5396, 5543, 5426, 4988, 4225,
-    3199, 2022, 843, -171, -855, -1090, -833, -137, 828, 1818, 2617, 3088,
-    3178, 2934, 2487, 1997, 1602, 1412, 1490, 1839, 2420, 3147, 3907, 4602,
-    5165, 5542, 5707, 5680, 5500, 5197, 4784, 4252, 3578, 2774, 1903, 1055,
-    317, -275, -744, -1133, -1457, -1718, -1893, -1922, -1741, -1318, -657, 205,
-    1183, 2144, 2957, 3512, 3747, 3648, 3263, 2685, 2033, 1414, 905, 529,
-    244, -25, -345, -763, -1295, -1909, -2557, -3206, -3831, -4407, -4952, -5507,
-    -6088, -6696, -7331, -7962, -8522, -8938, -9140, -9083, -8785, -8325, -7793, -7255,
-    -6739, -6234, -5710, -5144, -4524, -3860, -3196, -2598, -2135, -1869, -1815, -1940,
-    -2193, -2527, -2905, -3309, -3733, -4153, -4507, -4711, -4684, -4358, -3711, -2783,
-    -1672, -520, 550, 1468, 2202, 2735, 3059, 3157, 3010, 2657, 2201, 1766,
-    1463, 1384, 1554, 1935, 2453, 2985, 3352, 3395, 3033, 2281, 1256, 191,
-    -647, -1074, -1002, -432, 542, 1740, 2954, 3998, 4729, 5079, 5067, 4761,
-    4256, 3668, 3138, 2805, 2789, 3140, 3787, 4541, 5188, 5554, 5537, 5113,
-    4331, 3267, 2004, 649, -691, -1939, -3036, -3919, -4523, -4784, -4652, -4136,
-    -3324, -2331, -1278, -278, 591, 1293, 1801, 2085, 2143, 2013, 1749, 1397,
-    992, 579, 198, -146, -494, -893, -1380, -1976, -2669, -3403, -4104, -4686,
-    -5057, -5142, -4904, -4346, -3517, -2517, -1477, -516, 272, 834, 1154, 1228,
-    1044, 612, -18, -765, -1519, -2143, -2513, -2568, -2318, -1815, -1140, -411,
-    233, 677, 856, 766, 461, 47, -348, -606, -650, -450, -35, 524,
-    1129, 1685, 2131, 2456, 2680, 2828, 2932, 3032, 3171, 3380, 3663, 3989,
-    4296, 4527, 4656, 4670, 4554, 4296, 3890, 3326, 2621, 1841, 1088, 453,
-    16, -158, -30, 376, 989, 1701, 2392, 2964, 3383, 3654, 3791, 3803,
-    3692, 3452, 3085, 2616, 2098, 1586, 1148, 842, 686, 657, 708, 760,
-    718, 518, 153, -338, -868, -1297, -1493, -1385, -967, -295, 508, 1292,
-    1930, 2332, 2439, 2248, 1807, 1170, 384, -493, -1414, -2368, -3341, -4297,
-    -5199, -6030, -6738, -7236, -7452, -7355, -6957, -6345, -5644, -4959, -4340, -3793,
-    -3288, -2788, -2289, -1844, -1510, -1330, -1331, -1531, -1922, -2482, -3168, -3912,
-    -4635, -5271, -5774, -6110, -6267, -6245, -6032, -5621, -5037, -4339, -3595, -2856,
-    -2148, -1479, -849, -258, 306, 846, 1351, 1808, 2203, 2498, 2637, 2591,
-    2375, 2020, 1589, 1190, 944, 929, 1151, 1563, 2087, 2636, 3150, 3607,
-    3997, 4304, 4496, 4555, 4475, 4246, 3849, 3280, 2568, 1776, 1005, 390,
-    64, 116, 577, 1412, 2520, 3748, 4917, 5868, 6501, 6776, 6694, 6261,
-    5506, 4492, 3316, 2085, 917, -97, -925, -1589, -2118, -2540, -2883, -3162,
-    -3377, -3544, -3678, -3758, -3737, -3579, -3272, -2843, -2349, -1850, -1376, -944,
-    -578, -298, -126, -82, -158, -307, -500, -733, -1009, -1333, -1711, -2140,
-    -2612, -3128, -3688, -4253, -4744, -5077, -5174, -4976, -4473, -3720, -2823, -1912,
-    -1097, -425, 128, 595, 986, 1295, 1523, 1679, 1782, 1869, 1970, 2096,
-    2227, 2326, 2351, 2275, 2088, 1812, 1509, 1276, 1198, 1314, 1626, 2119,
-    2761, 3491, 4212, 4816, 5227, 5427, 5447, 5323, 5090, 4781, 4422, 4053,
-    3735, 3532, 3486, 3618, 3929, 4379, 4896, 5395, 5800, 6051, 6107, 5930,
-    5491, 4782, 3832, 2702, 1472, 226, -950, -1954, -2656, -2920, -2658, -1886,
-    -733, 620, 2002, 3282, 4368, 5204, 5753, 5982, 5869, 5418, 4661, 3664,
-    2521, 1338, 224, -708, -1357, -1642, -1512, -1003, -290, 348, 637, 398,
-    -409, -1671, -3167, -4664, -5984, -7001, -7623, -7784, -7444, -6599, -5315, -3766,
-    -2224, -1007, -415, -647, -1704, -3380, -5352, -7281, -8875, -9943, -10416, -10322,
-    -9745, -8812, -7680, -6510, -5440, -4554, -3853, -3263, -2689, -2049, -1298, -439,
-    466, 1332, 2070, 2608, 2898, 2912, 2641, 2094, 1299, 303, -803, -1865,
-    -2694, -3121, -3043, -2453, -1447, -201, 1075, 2220, 3155, 3881, 4452, 4941,
-    5384, 5768, 6066, 6256, 6314, 6224, 5987, 5589, 5015, 4281, 3435, 2497,
-    1464, 349, -821, -1989, -3027, -3751, -4000, -3700, -2878, -1659, -231, 1215,
-    2522, 3586, 4361, 4826, 4947, 4679, 3995, 2903, 1450, -251, -2007, -3586,
-    -4773, -5409, -5426, -4881, -3957, -2925, -2083, -1675, -1817, -2438, -3318, -4175,
-    -4735, -4803, -4317, -3360, -2107, -768, 457, 1405, 1962, 2078, 1765, 1092,
-    179, -809, -1713, -2431, -2930, -3221, -3367, -3450, -3529, -3652, -3865, -4171,
-    -4489, -4696, -4673, -4349, -3728, -2898, -1986, -1102, -323, 326, 864, 1330,
-    1747, 2125, 2467, 2780, 3077, 3377, 3675, 3941, 4133, 4217, 4184, 4035,
-    3761, 3348, 2790, 2092, 1307, 548, -42, -362, -360, -51, 480, 1119,
-    1782, 2428, 3041, 3631, 4213, 4766, 5244, 5630, 5932, 6145, 6252, 6253,
-    6161, 6001, 5814, 5648, 5495, 5288, 4944, 4396, 3595, 2545, 1340, 116,
-    -992, -1864, -2392, -2515, -2213, -1522, -537, 593, 1718, 2719, 3529, 4153,
-    4630, 4978, 5195, 5283, 5257, 5145, 4985, 4786, 4526, 4186, 3755, 3216,
-    2577, 1870, 1107, 286, -583, -1480, -2380, -3210, -3862, -4259, -4388, -4288,
-    -4044, -3765, -3552, -3470, -3557, -3837, -4315, -4958, -5705, -6493, -7282, -8034,
-    -8699, -9231, -9589, -9729, -9619, -9264, -8685, -7913, -7001, -6004, -4971, -3941,
-    -2955, -2050, -1265, -646, -246, -99, -207, -528, -986, -1465, -1815, -1875,
-    -1533, -768, 347, 1659, 2969, 4065, 4777, 5021, 4793, 4135, 3133, 1923,
-    676, -417, -1154, -1383, -1064, -281, 793, 1951, 3016, 3879, 4490, 4812,
-    4833, 4562, 4023, 3286, 2474, 1731, 1176, 879, 843, 1014, 1322, 1715,
-    2170, 2697, 3319, 4021, 4753, 5463, 6099, 6589, 6855, 6819, 6425, 5668,
-    4611, 3364, 2051, 778, -407, -1528, -2634, -3736, -4766, -5589, -6047, -6025,
-    -5502, -4567, -3386, -2128, -927, 124, 976, 1592, 1925, 1945, 1670, 1148,
-    426, -431, -1362, -2346, -3391, -4483, -5598, -6709, -7739, -8584, -9155, -9382,
-    -9219, -8685, -7883, -6962, -6058, -5265, -4594, -3996, -3402, -2761, -2064, -1347,
-    -670, -81, 377, 662, 736, 584, 223, -290, -883, -1491, -2061, -2545,
-    -2877, -2974, -2769, -2233, -1393, -325, 849, 2012, 3078, 3999, 4750, 5316,
-    5676, 5828, 5801, 5652, 5456, 5287, 5184, 5119, 5010, 4777, 4364, 3747,
-    2936, 1957, 835, -359, -1501, -2424, -2959, -2983, -2466, -1477, -163, 1286,
-    2686, 3903, 4850, 5466, 5735, 5668, 5253, 4470, 3351, 1986, 506, -901,
-    -2032, -2733, -2915, -2544, -1651, -351, 1175, 2710, 4036, 4997, 5513, 5569,
-    5184, 4393, 3241, 1817, 260, -1279, -2678, -3862, -4798, -5493, -5964, -6202,
-    -6167, -5817, -5140, -4184, -3058, -1903, -852, 16, 688, 1179, 1489, 1596,
-    1460, 1061, 441, -322, -1168, -2062, -2955, -3797, -4542, -5139, -5521, -5634,
-    -5445, -4960, -4239, -3397, -2567, -1882, -1440, -1261, -1280, -1391, -1493, -1512,
-    -1390, -1099, -648, -72, 581, 1250, 1859, 2362, 2760, 3096, 3428, 3800,
-    4205, 4587, 4889, 5071, 5108, 4999, 4768, 4440, 4044, 3624, 3215, 2850,
-    2567, 2406, 2392, 2519, 2750, 3016, 3229, 3311, 3204, 2882, 2354, 1669,
-    930, 268, -212, -451, -432, -182, 241, 781, 1397, 2031, 2615, 3121,
-    3546, 3901, 4202, 4436, 4541, 4445, 4114, 3543, 2763, 1845, 862, -124,
-    -1039, -1813, -2416, -2848, -3127, -3317, -3508, -3751, -4050, -4406, -4811, -5233,
-    -5654, -6088, -6552, -7037, -7506, -7888, -8077, -7976, -7554, -6832, -5863, -4739,
-    -3582, -2499, -1568, -856, -399, -176, -135, -242, -460, -735, -1034, -1359,
-    -1714, -2116, -2614, -3252, -4004, -4783, -5472, -5942, -6083, -5851, -5279, -4460,
-    -3511, -2535, -1610, -766, -10, 664, 1272, 1854, 2447, 3068, 3699, 4298,
-    4806, 5160, 5313, 5242, 4962, 4512, 3935, 3269, 2563, 1879, 1296, 905,
-    800, 1041, 1622, 2470, 3446, 4393, 5178, 5702, 5906, 5794, 5426, 4865,
-    4179, 3443, 2741, 2179, 1878, 1922, 2295, 2905, 3635, 4349, 4932, 5311,
-    5434, 5250, 4743, 3968, 3033, 2064, 1175, 429, -145, -529, -715, -718,
-    -588, -417, -327, -419, -711, -1124, -1520, -1745, -1706, -1413, -970, -549,
-    -322, -403, -829, -1570, -2534, -3589, -4633, -5607, -6468, -7193, -7784, -8227,
-    -8467, -8467, -8235, -7788, -7149, -6383, -5584, -4813, -4098, -3465, -2912, -2410,
-    -1958, -1600, -1379, -1322, -1446, -1733, -2113, -2509, -2864, -3133, -3293, -3358,
-    -3339, -3215, -2965, -2590, -2095, -1502, -866, -244, 326, 815, 1190, 1417,
-    1477, 1381, 1176, 928, 704, 585, 620, 801, 1092, 1466, 1886, 2314,
-    2748, 3204, 3680, 4161, 4642, 5108, 5514, 5805, 5933, 5872, 5604, 5113,
-    4392, 3477, 2437, 1372, 417, -283, -619, -534, -34, 810, 1870, 2993,
-    4030, 4868, 5446, 5750, 5784, 5578, 5193, 4705, 4186, 3684, 3202, 2729,
-    2267, 1846, 1479, 1126, 709, 153, -575, -1439, -2333, -3128, -3734, -4101,
-    -4216, -4110, -3862, -3572, -3326, -3180, -3138, -3168, -3245, -3385, -3609, -3935,
-    -4368, -4880, -5407, -5885, -6276, -6530, -6595, -6460, -6141, -5658, -5042, -4354,
-    -3661, -3019, -2482, -2101, -1901, -1870, -1977, -2170, -2392, -2601, -2773, -2885,
-    -2906, -2810, -2595, -2258, -1795, -1230, -612, 15, 612, 1142, 1590, 1968,
-    2297, 2572, 2772, 2877, 2895, 2861, 2823, 2815, 2846, 2915, 3012, 3120,
-    3221, 3299, 3364, 3448, 3575, 3732, 3880, 3976, 4004, 3990, 3990, 4029,
-    4073, 4053, 3928, 3701, 3416, 3136, 2925, 2835, 2918, 3213, 3710, 4322,
-    4927, 5411, 5684, 5698, 5443, 4932, 4189, 3268, 2272, 1324, 558, 99,
-    41, 399, 1117, 2093, 3183, 4223, 5064, 5586, 5708, 5404, 4702, 3683,
-    2459, 1158, -129, -1359, -2504, -3541, -4473, -5300, -5969, -6398, -6525, -6329,
-    -5833, -5117, -4301, -3486, -2749, -2185, -1854, -1728, -1720, -1746, -1740, -1661,
-    -1527, -1413, -1400, -1538, -1873, -2444, -3246, -4218, -5278, -6338, -7309, -8111,
-    -8673, -8934, -8852, -8430, -7728, -6841, -5872, -4908, -4019, -3240, -2564, -1971,
-    -1447, -982, -561, -151, 307, 878, 1584, 2386, 3211, 4000, 4692, 5227,
-    5555, 5639, 5474, 5096, 4554, 3875, 3062, 2120, 1080, 17, -947, -1670,
-    -2034, -1959, -1407, -416, 873, 2245, 3450, 4259, 4506, 4139, 3232, 1988,
-    713, -245, -610, -270, 701, 2082, 3588, 4962, 6021, 6677, 6933, 6856,
-    6512, 5943, 5168, 4193, 3046, 1803, 587, -474, -1269, -1708, -1732, -1372,
-    -767, -143, 259, 264, -183, -994, -1949, -2761, -3178, -3063, -2431, -1445,
-    -373, 504, 993, 1024, 635, -79, -1004, -2035, -3096, -4145, -5165, -6151,
-    -7078, -7880, -8454, -8690, -8503, -7874, -6840, -5506, -4043, -2673, -1615, -1030,
-    -1008, -1548, -2540, -3784, -5051, -6110, -6767, -6913, -6533, -5680, -4455, -3023,
-    -1608, -427, 339, 582, 300, -378, -1239, -2038, -2537, -2572, -2108, -1249,
-    -165, 957, 1947, 2724, 3318, 3813, 4275, 4754, 5286, 5847, 6355, 6733,
-    6951, 7004, 6897, 6655, 6314, 5888, 5363, 4696, 3839, 2771, 1550, 342,
-    -632, -1174, -1182, -667, 283, 1532, 2911, 4244, 5379, 6205, 6667, 6770,
-    6558, 6055, 5257, 4180, 2902, 1550, 288, -706, -1267, -1291, -746, 315,
-    1734, 3250, 4546, 5315, 5326, 4491, 2897, 792, -1479, -3566, -5170, -6058,
-    -6093, -5277, -3773, -1881, 20, 1553, 2453, 2629, 2146, 1149, -190, -1703,
-    -3220, -4586, -5687, -6456, -6852, -6838, -6420, -5684, -4776, -3863, -3086, -2505,
-    -2082, -1749, -1439, -1100, -734, -424, -293, -434, -890, -1632, -2523, -3337,
-    -3874, -4043, -3859, -3414, -2842, -2267, -1767, -1373, -1072, -801, -464, 20,
-    690, 1533, 2461, 3335, 4016, 4422, 4546, 4455, 4244, 3990, 3736, 3512,
-    3355, 3289, 3320, 3437, 3622, 3858, 4130, 4411, 4662, 4846, 4926, 4867,
-    4651, 4277, 3729, 2984, 2061, 1028, -36, -1053, -1941, -2620, -3033, -3135,
-    -2905, -2356, -1540, -534, 580, 1708, 2760, 3661, 4371, 4889, 5230, 5400,
-    5390, 5184, 4762, 4130, 3339, 2441, 1463, 415, -693, -1855, -3077, -4331,
-    -5513, -6477, -7062, -7117, -6550, -5395, -3826, -2122, -585, 525, 1059, 1005,
-    462, -404, -1426, -2466, -3447, -4360, -5221, -6029, -6731, -7256, -7534, -7508,
-    -7146, -6454, -5474, -4268, -2925, -1598, -472, 298, 629, 513, 0, -827,
-    -1879, -3056, -4233, -5269, -6046, -6482, -6531, -6193, -5521, -4606, -3536, -2387,
-    -1238, -146, 864, 1795, 2649, 3419, 4090, 4629, 4989, 5112, 4964, 4543,
-    3892, 3100, 2266, 1485, 848, 435, 278, 344, 574, 917, 1330, 1789,
-    2301, 2891, 3558, 4266, 4963, 5596, 6118, 6496, 6723, 6794, 6690, 6399,
-    5941, 5355, 4679, 3940, 3157, 2320, 1417, 483, -390, -1079, -1467, -1476,
-    -1085, -323, 727, 1916, 3043, 3909, 4372, 4372, 3931, 3144, 2153, 1109,
-    140, -669, -1289, -1736, -2061, -2342, -2663, -3084, -3627, -4288, -5065, -5936,
-    -6838, -7671, -8328, -8717, -8762, -8417, -7712, -6757, -5687, -4614, -3608, -2697,
-    -1878, -1136, -474, 67, 405, 434, 71, -685, -1754, -3000, -4259, -5357,
-    -6149, -6544, -6498, -6017, -5164, -4056, -2844, -1670, -622, 280, 1038, 1650,
-    2106, 2402, 2521, 2443, 2161, 1711, 1177, 683, 346, 237, 370, 724,
-    1245, 1862, 2519, 3177, 3804, 4378, 4889, 5337, 5697, 5925, 5963, 5758,
-    5295, 4611, 3788, 2945, 2246, 1873, 1947, 2475, 3356, 4419, 5468, 6344,
-    6963, 7315, 7420, 7312, 7019, 6559, 5932, 5150, 4243, 3256, 2211, 1116,
-    1, -1044, -1867, -2293, -2196, -1555, -473, 865, 2244, 3490, 4494, 5204,
-    5597, 5677, 5469, 5000, 4293, 3373, 2284, 1090, -141, -1354, -2512, -3575,
-    -4477, -5161, -5609, -5843, -5897, -5793, -5543, -5163, -4685, -4175, -3740, -3504,
-    -3559, -3939, -4608, -5460, -6317, -6961, -7198, -6929, -6173, -5069, -3822, -2643,
-    -1697, -1083, -824, -875, -1145, -1530, -1915, -2205, -2359, -2393, -2357, -2325,
-    -2377, -2543, -2800, -3098, -3377, -3559, -3570, -3368, -2934, -2282, -1480, -638,
-    148, 812, 1308, 1610, 1731, 1722, 1648, 1610, 1717, 2051, 2615, 3345,
-    4113, 4774, 5230, 5464, 5528, 5484, 5382, 5239, 5047, 4789, 4467, 4090,
-    3655, 3141, 2553, 1940, 1405, 1068, 1021, 1293, 1840, 2570, 3377, 4150,
-    4786, 5217, 5412, 5375, 5142, 4788, 4398, 4038, 3741, 3527, 3388, 3270,
-    3102, 2829, 2403, 1776, 930, -110, -1271, -2435, -3442, -4123, -4347, -4066,
-    -3339, -2334, -1283, -410, 109, 175, -206, -918, -1786, -2644, -3362, -3856,
-    -4094, -4078, -3836, -3436, -2978, -2582, -2369, -2450, -2874, -3608, -4560, -5623,
-    -6668, -7559, -8187, -8493, -8458, -8084, -7395, -6445, -5333, -4189, -3132, -2237,
-    -1514, -934, -469, -121, 73, 83, -86, -390, -760, -1111, -1355, -1411,
-    -1214, -731, -1, 864, 1718, 2435, 2938, 3211, 3287, 3223, 3083, 2939,
-    2843, 2813, 2843, 2930, 3065, 3230, 3406, 3569, 3683, 3707, 3616, 3405,
-    3097, 2741, 2417, 2211, 2207, 2467, 3000, 3726, 4494, 5125, 5471, 5433,
-    4993, 4215, 3218, 2145, 1156, 418, 59, 128, 572, 1260, 2038, 2787,
-    3435, 3935, 4255, 4375, 4283, 3995, 3566, 3064, 2532, 2008, 1552, 1231,
-    1095, 1158, 1385, 1682, 1933, 2046, 1970, 1683, 1192, 527, -279, -1183,
-    -2125, -3038, -3859, -4525, -4983, -5203, -5184, -4947, -4546, -4084, -3690, -3492,
-    -3592, -4027, -4756, -5680, -6676, -7628, -8432, -9025, -9384, -9504, -9378, -9007,
-    -8414, -7642, -6758, -5846, -4991, -4270, -3733, -3417, -3332, -3454, -3728, -4078,
-    -4416, -4658, -4724, -4554, -4108, -3377, -2389, -1221, 14, 1186, 2165, 2820,
-    3030, 2728, 1936, 776, -553, -1811, -2763, -3214, -3073, -2380, -1279, 28,
-    1330, 2468, 3360, 3987, 4353, 4477, 4376, 4082, 3655, 3201, 2847, 2708,
-    2863, 3334, 4073, 4959, 5833, 6542, 6982, 7131, 7034, 6776, 6436, 6046,
-    5598, 5060, 4414, 3672, 2876, 2079, 1354, 796, 522, 644, 1221, 2189,
-    3344, 4370, 4943, 4830, 3978, 2532, 819, -753, -1842, -2284, -2103, -1456,
-    -585, 240, 814, 1027, 865, 396, -270, -1035, -1829, -2603, -3326, -3960,
-    -4461, -4805, -5024, -5170, -5279, -5364, -5416, -5404, -5300, -5049, -4564, -3782,
-    -2719, -1472, -190, 973, 1897, 2495, 2705, 2492, 1863, 886, -315, -1588,
-    -2802, -3854, -4652, -5109, -5180, -4871, -4242, -3396, -2438, -1441, -458, 485,
-    1385, 2236, 3028, 3757, 4417, 4973, 5384, 5630, 5707, 5616, 5364, 4970,
-    4460, 3880, 3293, 2771, 2360, 2062, 1864, 1742, 1661, 1625, 1687, 1906,
-    2295, 2824, 3443, 4089, 4694, 5186, 5478, 5489, 5198, 4649, 3938, 3202,
-    2594, 2239, 2231, 2628, 3399, 4402, 5406, 6138, 6360, 5955, 4939, 3427,
-    1621, -190, -1684, -2556, -2590, -1753, -224, 1658, 3476, 4825, 5435, 5244,
-    4368, 3027, 1474, -70, -1448, -2548, -3266, -3513, -3248, -2538, -1593, -720,
-    -233, -345, -1101, -2377, -3946, -5543, -6924, -7875, -8201, -7777, -6633, -5005,
-    -3309, -2044, -1631, -2243, -3744, -5765, -7829, -9503, -10510, -10772, -10368, -9478,
-    -8308, -7038, -5800, -4683, -3721, -2896, -2136, -1356, -512, 362, 1187, 1883,
-    2396, 2697, 2780, 2630, 2216, 1518, 568, -577, -1839, -3117, -4264, -5088,
-    -5397, -5080, -4171, -2842, -1332, 145, 1455, 2549, 3445, 4199, 4872, 5502,
-    6091, 6581, 6853, 6775, 6270, 5358, 4144, 2774, 1386, 71, -1122, -2149,
-    -2932, -3358, -3315, -2750, -1728, -443, 846, 1909, 2619, 2960, 3008, 2912,
-    2842, 2943, 3269, 3757, 4233, 4471, 4277, 3562, 2355, 766, -1053, -2925,
-    -4657, -6049, -6916, -7147, -6750, -5849, -4643, -3351, -2149, -1127, -280, 465,
-    1204, 1984, 2760, 3429, 3882, 4038, 3869, 3405, 2711, 1874, 985, 108,
-    -747, -1616, -2553, -3585, -4671, -5687, -6472, -6886, -6853, -6387, -5562, -4482,
-    -3266, -2041, -912, 47, 782, 1263, 1500, 1526, 1388, 1144, 863, 624,
-    522, 644, 1029, 1632, 2313, 2879, 3160, 3049, 2523, 1658, 597, -481,
-    -1384, -1924, -1985, -1555, -708, 417, 1650, 2848, 3917, 4803, 5489, 5989,
-    6303, 6408, 6259, 5819, 5097, 4171, 3161, 2180, 1331, 698, 336, 273,
-    481, 855, 1247, 1553, 1766, 1973, 2299, 2814, 3481, 4189, 4828, 5324,
-    5640, 5738, 5553, 5012, 4087, 2828, 1386, -22, -1194, -1992, -2323, -2142,
-    -1475, -418, 866, 2141, 3162, 3744, 3790, 3295, 2334, 1017, -536, -2179,
-    -3730, -5003, -5828, -6073, -5694, -4754, -3416, -1926, -561, 441, 933, 886,
-    372, -477, -1519, -2629, -3738, -4832, -5922, -6993, -7990, -8818, -9361, -9537,
-    -9320, -8727, -7820, -6716, -5558, -4481, -3587, -2890, -2308, -1743, -1153, -566,
-    -48, 348, 640, 890, 1137, 1371, 1562, 1667, 1658, 1542, 1348, 1117,
-    909, 789, 808, 979, 1270, 1623, 2000, 2376, 2709, 2935, 2989, 2805,
-    2335, 1579, 563, -663, -2003, -3310, -4420, -5171, -5423, -5106, -4241, -2924,
-    -1321, 350, 1892, 3179, 4169, 4890, 5392, 5692, 5752, 5522, 4973, 4135,
-    3087, 1913, 665, -619, -1907, -3158, -4293, -5218, -5882, -6308, -6543, -6606,
-    -6475, -6113, -5523, -4764, -3917, -3050, -2188, -1327, -465, 365, 1111, 1742,
-    2244, 2593, 2733, 2583, 2090, 1272, 219, -959, -2169, -3327, -4317, -4986,
-    -5188, -4848, -4001, -2801, -1476, -221, 843, 1657, 2210, 2520, 2598, 2444,
-    2086, 1567, 914, 137, -757, -1761, -2842, -3883, -4706, -5128, -5026, -4371,
-    -3258, -1870, -403, 977, 2170, 3148, 3941, 4599, 5146, 5564, 5828, 5933,
-    5893, 5732, 5482, 5144, 4665, 3969, 3010, 1808, 474, -787, -1746, -2231,
-    -2182, -1667, -849, 87, 997, 1771, 2346, 2702, 2859, 2878, 2870, 2953,
-    3206, 3649, 4246, 4911, 5553, 6120, 6593, 6961, 7209, 7315, 7233, 6927,
-    6389, 5646, 4727, 3651, 2436, 1117, -225, -1454, -2401, -2918, -2926, -2423,
-    -1491, -271, 1067, 2354, 3443, 4218, 4611, 4621, 4302, 3718, 2909, 1905,
-    765, -401, -1421, -2121, -2424, -2408, -2253, -2156, -2267, -2641, -3263, -4113,
-    -5156, -6293, -7372, -8224, -8684, -8662, -8189, -7361, -6302, -5166, -4121, -3291,
-    -2782, -2680, -3007, -3702, -4646, -5662, -6557, -7207, -7574, -7652, -7438, -6932,
-    -6152, -5173, -4131, -3143, -2239, -1374, -481, 458, 1372, 2156, 2765, 3221,
-    3574, 3861, 4086, 4228, 4287, 4284, 4230, 4094, 3814, 3321, 2576, 1592,
-    445, -723, -1742, -2461, -2791, -2717, -2290, -1599, -744, 165, 1019, 1742,
-    2311, 2766, 3191, 3646, 4139, 4648, 5147, 5616, 6056, 6459, 6775, 6947,
-    6963, 6834, 6561, 6140, 5560, 4795, 3867, 2861, 1870, 980, 271, -230,
-    -564, -793, -979, -1189, -1436, -1693, -1958, -2259, -2632, -3123, -3759, -4478,
-    -5168, -5728, -6064, -6111, -5869, -5383, -4708, -3948, -3239, -2698, -2401, -2353,
-    -2466, -2588, -2602, -2462, -2202, -1915, -1674, -1511, -1437, -1460, -1570, -1729,
-    -1857, -1835, -1580, -1111, -532, 12, 382, 521, 466, 296, 77, -146,
-    -377, -642, -935, -1208, -1410, -1503, -1483, -1389, -1257, -1074, -796, -391,
-    132, 721, 1323, 1923, 2536, 3167, 3789, 4347, 4797, 5148, 5450, 5744,
-    6026, 6238, 6293, 6138, 5767, 5199, 4473, 3651, 2800, 1997, 1345, 926,
-    774, 891, 1250, 1782, 2417, 3103, 3775, 4371, 4860, 5227, 5464, 5583,
-    5583, 5435, 5117, 4616, 3910, 3007, 1976, 929, 19, -576, -739, -464,
-    170, 1020, 1915, 2728, 3378, 3794, 3945, 3874, 3645, 3317, 2930, 2473,
-    1900, 1208, 451, -310, -1042, -1731, -2387, -2999, -3506, -3830, -3927, -3782,
-    -3423, -2917, -2358, -1879, -1649, -1802, -2383, -3342, -4544, -5815, -7018, -8085,
-    -8973, -9655, -10093, -10229, -10016, -9483, -8754, -8003, -7384, -6972, -6740, -6595,
-    -6445, -6228, -5902, -5409, -4699, -3779, -2749, -1789, -1094, -773, -801, -1060,
-    -1393, -1627, -1592, -1171, -335, 812, 2028, 3023, 3562, 3509, 2850, 1689,
-    211, -1324, -2583, -3250, -3162, -2350, -1022, 512, 1985, 3260, 4296, 5080,
-    5626, 5957, 6109, 6143, 6105, 5960, 5635, 5092, 4347, 3499, 2705, 2075,
-    1615, 1268, 936, 507, -72, -784, -1582, -2354, -2901, -3029, -2632, -1728,
-    -495, 774, 1820, 2504, 2785, 2689, 2284, 1610, 687, -433, -1671, -2937,
-    -4149, -5238, -6156, -6842, -7202, -7156, -6677, -5830, -4768, -3707, -2854, -2348,
-    -2216, -2373, -2650, -2844, -2791, -2416, -1719, -765, 316, 1371, 2258, 2847,
-    3035, 2783, 2124, 1134, -69, -1328, -2480, -3346, -3738, -3534, -2760, -1597,
-    -334, 726, 1395, 1627, 1483, 1107, 679, 358, 261, 453, 900, 1492,
-    2120, 2699, 3176, 3559, 3878, 4116, 4262, 4350, 4425, 4529, 4705, 4954,
-    5246, 5578, 5956, 6337, 6644, 6787, 6668, 6230, 5498, 4534, 3421, 2290,
-    1307, 652, 513, 1000, 2041, 3407, 4808, 5980, 6755, 7098, 7040, 6612,
-    5853, 4822, 3590, 2250, 904, -365, -1481, -2354, -2888, -2999, -2640, -1835,
-    -679, 690, 2126, 3489, 4669, 5600, 6253, 6618, 6668, 6383, 5769, 4869,
-    3753, 2523, 1277, 72, -1080, -2201, -3333, -4493, -5627, -6609, -7272, -7434,
-    -6976, -5897, -4326, -2508, -751, 677, 1603, 1939, 1695, 966, -147, -1563,
-    -3177, -4857, -6460, -7849, -8943, -9740, -10247, -10431, -10252, -9689, -8753, -7529,
-    -6168, -4809, -3545, -2429, -1445, -539, 299, 1046, 1683, 2180, 2477, 2512,
-    2234, 1621, 713, -398, -1606, -2789, -3819, -4590, -4994, -4932, -4369, -3373,
-    -2098, -742, 541, 1700, 2750, 3684, 4467, 5079, 5529, 5846, 6036, 6033,
-    5730, 5070, 4073, 2821, 1431, 14, -1319, -2435, -3161, -3325, -2849, -1795,
-    -350, 1269, 2880, 4342, 5542, 6388, 6821, 6856, 6579, 6088, 5457, 4746,
-    4008, 3290, 2645, 2109, 1669, 1261, 808, 250, -430, -1201, -2031, -2902,
-    -3802, -4697, -5506, -6092, -6316, -6083, -5378, -4291, -3030, -1834, -920, -483,
-    -649, -1409, -2647, -4179, -5753, -7111, -8080, -8565, -8524, -7997, -7084, -5897,
-    -4574, -3296, -2259, -1641, -1572, -2061, -2975, -4075, -5055, -5604, -5532, -4805,
-    -3517, -1866, -127, 1433, 2580, 3128, 2990, 2207, 918, -643, -2166, -3331,
-    -3896, -3754, -2970, -1757, -382, 912, 1977, 2796, 3450, 4019, 4547, 5050,
-    5537, 6016, 6474, 6864, 7126, 7220, 7147, 6932, 6598, 6154, 5585, 4865,
-    3964, 2862, 1609, 346, -718, -1344, -1348, -685, 537, 2122, 3851, 5542,
-    7070, 8344, 9268, 9763, 9772, 9256, 8210, 6680, 4785, 2719, 692, -1125,
-    -2611, -3658, -4155, -4022, -3271, -2094, -822, 223, 841, 988, 791, 490,
-    330, 492, 1085, 2082, 3291, 4463, 5370, 5845, 5823, 5337, 4457, 3276,
-    1941, 603, -654, -1826, -2977, -4181, -5443, -6675, -7755, -8559, -8957, -8857,
-    -8232, -7142, -5770, -4386, -3218, -2343, -1698, -1146, -563, 99, 797, 1422,
-    1835, 1908, 1559, 781, -364, -1761, -3260, -4712, -5980, -6960, -7600, -7911,
-    -7954, -7812, -7568, -7270, -6926, -6522, -6047, -5503, -4896, -4247, -3608, -3041,
-    -2579, -2210, -1895, -1580, -1222, -800, -287, 348, 1109, 1952, 2785, 3490,
-    3958, 4118, 3926, 3394, 2614, 1751, 1019, 668, 901, 1779, 3208, 4964,
-    6747, 8280, 9413, 10128, 10498, 10648, 10699, 10702, 10634, 10438, 10041, 9386,
-    8461, 7321, 6088, 4923, 3941, 3160, 2527, 1928, 1222, 328, -748, -1943,
-    -3140, -4163, -4857, -5148, -5042, -4656, -4252, -4145, -4557, -5547, -6987, -8583,
-    -9975, -10883, -11157, -10773, -9803, -8394, -6728, -5011, -3426, -2079, -963, -2,
-    877, 1708, 2468, 3078, 3447, 3517, 3278, 2798, 2220, 1704, 1330, 1074,
-    861, 630, 395, 244, 259, 433, 677, 865, 919, 847, 710, 537,
-    301, -34, -464, -909, -1220, -1270, -1027, -537, 116, 849, 1634, 2503,
-    3466, 4438, 5274, 5857, 6162, 6272, 6298, 6258, 6038, 5478, 4483, 3109,
-    1548, 14, -1395, -2726, -4103, -5579, -7003, -8020, -8225, -7385, -5609, -3389,
-    -1422, -267, -49, -403, -658, -214, 1102, 2933, 4614, 5549, 5505, 4688,
-    3590, 2708, 2320, 2426, 2847, 3348, 3753, 3990, 4062, 3982, 3755, 3391,
-    2893, 2286, 1634, 1016, 465, -54, -622, -1336, -2253, -3351, -4558, -5803,
-    -7024, -8137, -9027, -9562, -9611, -9103, -8075, -6649, -4988, -3266, -1682, -418,
-    384, 643, 346, -446, -1608, -2973, -4344, -5506, -6265, -6493, -6141, -5243,
-    -3913, -2312, -629, 927, 2159, 2918, 3133, 2796, 1964, 744, -737, -2327,
-    -3840, -5085, -5898, -6162, -5843, -5026, -3898, -2714, -1756, -1258, -1343, -1994,
-    -3057, -4258, -5243, -5699, -5439, -4450, -2887, -1002, 983, 2927, 4747, 6389,
-    7813, 8964, 9765, 10163, 10167, 9841, 9271, 8558, 7781, 6984, 6186, 5415,
-    4707, 4100, 3606, 3194, 2802, 2361, 1810, 1108, 227, -853, -2148, -3618,
-    -5150, -6601, -7809, -8597, -8815, -8403, -7417, -6022, -4475, -3043, -1881, -995,
-    -298, 337, 1022, 1776, 2503, 3053, 3282, 3097, 2476, 1477, 195, -1241,
-    -2667, -3910, -4837, -5350, -5387, -4930, -4000, -2640, -928, 1001, 2977, 4860,
-    6560, 8020, 9191, 10011, 10397, 10285, 9670, 8616, 7210, 5555, 3787, 2059,
-    489, -876, -2074, -3200, -4346, -5544, -6751, -7879, -8807, -9396, -9550, -9248,
-    -8562, -7627, -6580, -5499, -4406, -3338, -2372, -1592, -1052, -735, -538, -309,
-    42, 521, 1090, 1677, 2166, 2426, 2374, 2028, 1517, 1066, 915, 1216,
-    2003, 3211, 4710, 6337, 7925, 9337, 10462, 11211, 11510, 11324, 10699, 9782,
-    8798, 7981, 7505, 7427, 7670, 8073, 8440, 8601, 8448, 7952, 7175, 6231,
-    5236, 4272, 3380, 2564, 1783, 962, 16, -1119, -2451, -3894, -5292, -6516,
-    -7495, -8158, -8386, -8042, -7033, -5378, -3256, -984, 1114, 2797, 3905, 4337,
-    4089, 3294, 2207, 1155, 423, 133, 198, 397, 515, 420, 74, -482,
-    -1168, -1891, -2557, -3070, -3349, -3336, -2999, -2328, -1366, -248, 806, 1564,
-    1872, 1716, 1227, 598, -14, -553, -1058, -1627, -2385, -3432, -4814, -6491,
-    -8324, -10077, -11480, -12317, -12477, -11950, -10803, -9154, -7171, -5084, -3133, -1482,
-    -149, 976, 2042, 3116, 4099, 4782, 4994, 4722, 4135, 3510, 3089, 2960,
-    3058, 3265, 3484, 3657, 3747, 3714, 3495, 3036, 2351, 1548, 804, 317,
-    255, 698, 1617, 2868, 4219, 5402, 6194, 6475, 6245, 5576, 4557, 3266,
-    1803, 302, -1117, -2398, -3543, -4568, -5445, -6065, -6287, -6053, -5479, -4834,
-    -4433, -4497, -5057, -5976, -7040, -8021, -8719, -9009, -8848, -8267, -7344, -6206,
-    -4996, -3843, -2833, -1984, -1225, -431, 507, 1612, 2796, 3896, 4766, 5338,
-    5620, 5641, 5429, 5018, 4477, 3910, 3411, 2994, 2591, 2087, 1384, 457,
-    -619, -1732, -2798, -3772, -4611, -5282, -5754, -5988, -5967, -5728, -5342, -4879,
-    -4402, -3945, -3490, -3002, -2468, -1891, -1269, -608, 112, 946, 1928, 3030,
-    4213, 5477, 6813, 8177, 9477, 10547, 11161, 11128, 10372, 8923, 6891, 4468,
-    1917, -451, -2305, -3363, -3512, -2845, -1563, 101, 1922, 3676, 5138, 6091,
-    6399, 6073, 5263, 4181, 3010, 1858, 798, -67, -614, -771, -572, -152,
-    300, 615, 695, 503, 45, -616, -1353, -1990, -2351, -2303, -1820, -1005,
-    -24, 973, 1864, 2573, 3058, 3301, 3291, 3033, 2552, 1903, 1171, 453,
-    -197, -810, -1457, -2210, -3128, -4253, -5561, -6937, -8181, -9049, -9322, -8879,
-    -7743, -6064, -4073, -2036, -240, 1032, 1532, 1103, -243, -2251, -4446, -6287,
-    -7336, -7389, -6509, -4966, -3094, -1181, 534, 1829, 2480, 2302, 1245, -502,
-    -2506, -4230, -5236, -5321, -4536, -3122, -1412, 255, 1629, 2617, 3283, 3756,
-    4136, 4481, 4810, 5134, 5496, 5963, 6553, 7184, 7725, 8049, 8092, 7849,
-    7337, 6530, 5374, 3856, 2046, 96, -1756, -3229, -4082, -4186, -3545, -2292,
-    -662, 1082, 2720, 4117, 5222, 6055, 6670, 7121, 7433, 7568, 7439, 6964,
-    6115, 4950, 3622, 2367, 1465, 1152, 1499, 2307, 3155, 3584, 3300, 2280,
-    738, -1008, -2693, -4163, -5316, -6033, -6203, -5789, -4868, -3634, -2351, -1279,
-    -612, -459, -830, -1612, -2576, -3440, -3946, -3915, -3282, -2089, -495, 1238,
-    2777, 3805, 4121, 3689, 2622, 1101, -683, -2548, -4308, -5776, -6806, -7329,
-    -7354, -6925, -6079, -4834, -3207, -1265, 843, 2901, 4694, 6054, 6878, 7116,
-    6756, 5834, 4458, 2808, 1110, -443, -1756, -2860, -3872, -4913, -6051, -7292,
-    -8597, -9893, -11067, -11948, -12318, -11980, -10861, -9074, -6887, -4611, -2482, -599,
-    1057, 2561, 3982, 5329, 6516, 7358, 7646, 7243, 6164, 4592, 2819, 1171,
-    -81, -775, -886, -502, 212, 1055, 1832, 2412, 2781, 3027, 3269, 3602,
-    4058, 4571, 4973, 5063, 4708, 3916, 2841, 1712, 737, 10, -501, -885,
-    -1218, -1514, -1740, -1851, -1818, -1657, -1419, -1198, -1105, -1237, -1631, -2253,
-    -3032, -3894, -4789, -5701, -6654, -7688, -8819, -10015, -11182, -12196, -12955, -13396,
-    -13482, -13171, -12404, -11143, -9433, -7458, -5499, -3798, -2439, -1313, -193, 1131,
-    2732, 4487, 6111, 7245, 7551, 6823, 5070, 2544, -341, -3133, -5428, -6910,
-    -7377, -6764, -5172, -2861, -200, 2441, 4788, 6690, 8082, 8920, 9155, 8776,
-    7839, 6456, 4747, 2803, 715, -1358, -3157, -4412, -4939, -4698, -3746, -2168,
-    -57, 2440, 5073, 7482, 9305, 10319, 10501, 9985, 8958, 7583, 6006, 4403,
-    2996, 1948, 1240, 672, -4, -946, -2170, -3568, -4986, -6290, -7351, -8012,
-    -8122, -7621, -6601, -5295, -3992, -2870, -1896, -883, 346, 1858, 3592, 5387,
-    7046, 8395, 9299, 9671, 9471, 8729, 7540, 6065, 4484, 2946, 1539, 303,
-    -754, -1645, -2388, -2997, -3482, -3848, -4079, -4138, -4014, -3726, -3311, -2824,
-    -2345, -1979, -1845, -2056, -2664, -3611, -4720, -5747, -6465, -6737, -6521, -5845,
-    -4775, -3429, -1957, -494, 889, 2203, 3512, 4863, 6218, 7439, 8342, 8776,
-    8666, 8025, 6935, 5516, 3919, 2331, 948, -82, -679, -832, -600, -117,
-    434, 854, 975, 712, 79, -820, -1819, -2702, -3242, -3270, -2720, -1641,
-    -180, 1459, 3059, 4410, 5303, 5549, 5037, 3796, 2011, -2, -1876, -3303,
-    -4098, -4203, -3667, -2616, -1230, 293, 1783, 3130, 4292, 5272, 6092, 6799,
-    7428, 7961, 8332, 8469, 8343, 7987, 7498, 6979, 6486, 6009, 5509, 4943,
-    4286, 3542, 2730, 1855, 907, -122, -1233, -2410, -3612, -4777, -5852, -6789,
-    -7551, -8096, -8372, -8296, -7801, -6898, -5706, -4415, -3225, -2272, -1603, -1200,
-    -1004, -935, -910, -866, -760, -556, -228, 240, 861, 1640, 2557, 3582,
-    4686, 5826, 6938, 7935, 8743, 9327, 9707, 9932, 10036, 10001, 9749, 9197,
-    8318, 7165, 5848, 4504, 3280, 2304, 1625, 1183, 809, 286, -548, -1727,
-    -3161, -4699, -6167, -7386, -8185, -8402, -7908, -6681, -4881, -2820, -847, 783,
-    1947, 2640, 2928, 2917, 2722, 2473, 2294, 2249, 2288, 2248, 1917, 1173,
-    100, -1000, -1744, -1845, -1220, -2, 1524, 3017, 4167, 4743, 4614, 3785,
-    2396, 670, -1157, -2901, -4474, -5865, -7064, -8024, -8699, -9082, -9209, -9135,
-    -8914, -8581, -8163, -7713, -7314, -7038, -6921, -6945, -7033, -7070, -6960, -6636,
-    -6058, -5208, -4096, -2744, -1197, 470, 2176, 3837, 5357, 6621, 7510, 7918,
-    7759, 7021, 5800, 4277, 2673, 1221, 111, -584, -928, -1076, -1198, -1394,
-    -1646, -1843, -1845, -1552, -931, -12, 1132, 2387, 3590, 4533, 5024, 4954,
-    4328, 3240, 1814, 172, -1567, -3280, -4840, -6128, -7031, -7464, -7377, -6752,
-    -5616, -4072, -2290, -463, 1213, 2557, 3418, 3691, 3331, 2365, 911, -843,
-    -2664, -4307, -5565, -6324, -6590, -6497, -6279, -6197, -6427, -7001, -7796, -8566,
-    -9006, -8853, -7959, -6346, -4194, -1771, 645, 2808, 4511, 5602, 5998, 5684,
-    4743, 3353, 1722, 41, -1543, -2935, -4113, -5108, -5963, -6719, -7408, -8027,
-    -8527, -8842, -8917, -8719, -8222, -7424, -6366, -5145, -3895, -2733, -1733, -907,
-    -196, 510, 1317, 2262, 3304, 4331, 5190, 5746, 5914, 5684, 5128, 4426,
-    3835, 3596, 3835, 4507, 5410, 6265, 6846, 7056, 6937, 6598, 6149, 5687,
-    5302, 5075, 5046, 5210, 5531, 5954, 6403, 6775, 6935, 6752, 6158, 5195,
-    3998, 2731, 1517, 399, -612, -1468, -2073, -2342, -2255, -1888, -1407, -1011,
-    -828, -881, -1110, -1402, -1622, -1652, -1421, -918, -195, 623, 1368, 1868,
-    1975, 1604, 760, -483, -2002, -3644, -5251, -6706, -7935, -8899, -9573, -9919,
-    -9891, -9462, -8676, -7649, -6537, -5485, -4583, -3860, -3323, -2982, -2832, -2841,
-    -2953, -3081, -3127, -3024, -2747, -2299, -1706, -1019, -295, 403, 1007, 1435,
-    1606, 1467, 1042, 465, -43, -260, -43, 629, 1651, 2866, 4145, 5413,
-    6624, 7764, 8836, 9847, 10800, 11689, 12458, 13001, 13203, 12997, 12361, 11327,
-    9992, 8498, 6989, 5593, 4396, 3395, 2502, 1616, 696, -204, -958, -1431,
-    -1558, -1370, -959, -421, 156, 690, 1091, 1248, 1037, 355, -817, -2395,
-    -4206, -6041, -7712, -9098, -10142, -10778, -10911, -10460, -9420, -7906, -6152, -4453,
-    -3033, -1965, -1189, -578, 13, 697, 1535, 2548, 3719, 4984, 6230, 7332,
-    8151, 8541, 8381, 7621, 6303, 4576, 2668, 837, -681, -1690, -2056, -1735,
-    -785, 636, 2284, 3891, 5243, 6233, 6830, 7049, 6918, 6452, 5660, 4586,
-    3325, 1997, 700, -501, -1541, -2332, -2783, -2836, -2481, -1754, -738, 470,
-    1778, 3083, 4246, 5128, 5635, 5743, 5487, 4926, 4094, 2990, 1642, 144,
-    -1384, -2858, -4252, -5573, -6808, -7869, -8590, -8796, -8375, -7292, -5619, -3548,
-    -1324, 830, 2733, 4237, 5231, 5648, 5457, 4680, 3444, 1984, 580, -548,
-    -1311, -1773, -2104, -2499, -3107, -3998, -5147, -6420, -7613, -8536, -9054, -9105,
-    -8711, -7969, -6998, -5924, -4875, -3956, -3199, -2562, -1982, -1403, -796, -176,
-    413, 951, 1452, 1931, 2383, 2773, 3040, 3102, 2891, 2376, 1565, 509,
-    -699, -1925, -3019, -3813, -4147, -3903, -3044, -1629, 179, 2151, 4056, 5722,
-    7040, 7934, 8352, 8273, 7720, 6798, 5699, 4653, 3853, 3425, 3403, 3716,
-    4213, 4738, 5169, 5416, 5428, 5192, 4710, 3994, 3078, 2025, 891, -283,
-    -1468, -2659, -3851, -4990, -5967, -6667, -7016, -6985, -6593, -5901, -5014, -4061,
-    -3192, -2549, -2229, -2275, -2683, -3368, -4138, -4744, -4976, -4748, -4117, -3267,
-    -2466, -1988, -2022, -2634, -3759, -5204, -6647, -7703, -8038, -7483, -6073, -4014,
-    -1609, 842, 3092, 4953, 6274, 6918, 6779, 5810, 4079, 1849, -401, -2103,
-    -2815, -2387, -1002, 901, 2803, 4296, 5175, 5407, 5067, 4285, 3206, 1980,
-    786, -160, -654, -556, 143, 1276, 2557, 3675, 4412, 4684, 4532, 4061,
-    3374, 2551, 1694, 949, 469, 361, 619, 1123, 1675, 2076, 2184, 1965,
-    1503, 934, 358, -214, -845, -1622, -2589, -3695, -4797, -5697, -6192, -6130,
-    -5476, -4335, -2931, -1554, -503, -21, -242, -1117, -2401, -3703, -4578, -4663,
-    -3808, -2159, -102, 1883, 3347, 3941, 3481, 2011, -183, -2614, -4702, -5934,
-    -6037, -5051, -3269, -1087, 1127, 3082, 4584, 5551, 5999, 6020, 5759, 5381,
-    5039, 4851, 4879, 5106, 5423, 5676, 5735, 5547, 5176, 4787, 4555, 4560,
-    4747, 4955, 4960, 4554, 3622, 2184, 433, -1288, -2578, -3116, -2745, -1483,
-    482, 2836, 5197, 7163, 8360, 8541, 7657, 5849, 3402, 693, -1893, -4025,
-    -5410, -5807, -5122, -3532, -1464, 527, 1933, 2447, 2091, 1187, 198, -466,
-    -583, -147, 656, 1528, 2143, 2238, 1667, 453, -1211, -3016, -4619, -5728,
-    -6173, -5966, -5319, -4583, -4139, -4289, -5153, -6629, -8425, -10143, -11383, -11832,
-    -11335, -9919, -7789, -5259, -2664, -252, 1866, 3658, 5040, 5780, 5593, 4325,
-    2098, -659, -3280, -5050, -5458, -4350, -1945, 1215, 4404, 6912, 8227, 8127,
-    6693, 4249, 1247, -1834, -4502, -6269, -6725, -5646, -3107, 460, 4332, 7700,
-    9892, 10550, 9712, 7733, 5083, 2193, -582, -2950, -4660, -5494, -5328, -4259,
-    -2650, -1057, -72, -108, -1207, -2966, -4675, -5580, -5200, -3557, -1195, 1058,
-    2441, 2514, 1235, -1078, -3870, -6499, -8381, -9100, -8497, -6723, -4222, -1608,
-    513, 1697, 1773, 905, -429, -1583, -1949, -1187, 615, 2964, 5157, 6520,
-    6596, 5263, 2758, -380, -3447, -5742, -6746, -6243, -4356, -1485, 1787, 4790,
-    6882, 7578, 6705, 4477, 1468, -1524, -3701, -4502, -3740, -1618, 1338, 4399,
-    6825, 8078, 7940, 6534, 4249, 1592, -994, -3208, -4865, -5859, -6167, -5871,
-    -5183, -4390, -3745, -3367, -3179, -2936, -2334, -1200, 403, 2233, 3991, 5404,
-    6292, 6595, 6342, 5635, 4656, 3635, 2764, 2142, 1738, 1383, 835, -101,
-    -1496, -3300, -5339, -7339, -9012, -10094, -10367, -9687, -8037, -5561, -2591, 328,
-    2526, 3437, 2841, 975, -1506, -3751, -5027, -4944, -3536, -1206, 1414, 3669,
-    5040, 5231, 4231, 2342, 104, -1865, -3012, -2969, -1689, 508, 3056, 5339,
-    6863, 7410, 7119, 6409, 5777, 5611, 6069, 7017, 8079, 8823, 8948, 8374,
-    7244, 5825, 4371, 3033, 1896, 1020, 441, 169, 164, 288, 341, 162,
-    -336, -1199, -2419, -3901, -5479, -6944, -8066, -8659, -8693, -8306, -7735, -7248,
-    -7057, -7214, -7594, -7956, -8011, -7491, -6262, -4386, -2109, 175, 1964, 2772,
-    2330, 716, -1627, -4006, -5703, -6219, -5404, -3460, -824, 1987, 4498, 6336,
-    7265, 7222, 6334, 4909, 3411, 2360, 2149, 2891, 4350, 5970, 7050, 7030,
-    5727, 3370, 460, -2407, -4690, -6014, -6195, -5225, -3276, -728, 1853, 3845,
-    4769, 4493, 3321, 1917, 1035, 1191, 2468, 4521, 6743, 8513, 9392, 9193,
-    7939, 5819, 3195, 590, -1404, -2308, -1943, -562, 1199, 2546, 2827, 1766,
-    -447, -3241, -5859, -7606, -8060, -7144, -5088, -2339, 542, 2968, 4434, 4609,
-    3446, 1253, -1355, -3641, -4977, -5055, -3984, -2208, -292, 1277, 2200, 2395,
-    1960, 1129, 233, -344, -260, 671, 2396, 4597, 6771, 8422, 9255, 9248,
-    8630, 7780, 7059, 6677, 6679, 6958, 7290, 7392, 7025, 6041, 4421, 2340,
-    176, -1597, -2563, -2499, -1496, 18, 1434, 2191, 1934, 599, -1577, -4136,
-    -6530, -8229, -8814, -8095, -6177, -3435, -409, 2317, 4245, 5041, 4549, 2817,
-    161, -2832, -5434, -6993, -7156, -6000, -3995, -1817, -112, 675, 373, -915,
-    -2864, -5011, -6856, -7990, -8200, -7508, -6140, -4429, -2714, -1230, -78, 768,
-    1434, 2095, 2913, 3966, 5219, 6510, 7575, 8130, 7979, 7092, 5641, 3970,
-    2468, 1430, 966, 991, 1261, 1465, 1332, 710, -415, -1921, -3563, -5054,
-    -6130, -6581, -6290, -5259, -3596, -1515, 685, 2648, 4051, 4689, 4506, 3591,
-    2138, 389, -1382, -2897, -3922, -4311, -4030, -3208, -2121, -1083, -334, 23,
-    18, -216, -513, -765, -959, -1143, -1410, -1869, -2599, -3621, -4882, -6234,
-    -7455, -8321, -8685, -8515, -7874, -6884, -5695, -4464, -3337, -2432, -1804, -1437,
-    -1239, -1066, -778, -294, 371, 1104, 1708, 1952, 1668, 866, -240, -1299,
-    -1951, -1967, -1325, -195, 1156, 2478, 3602, 4456, 5053, 5454, 5750, 6070,
-    6545, 7248, 8142, 9074, 9821, 10180, 10058, 9472, 8483, 7162, 5603, 3928,
-    2284, 832, -303, -1099, -1624, -1985, -2287, -2628, -3087, -3693, -4410, -5115,
-    -5611, -5715, -5332, -4493, -3349, -2164, -1255, -906, -1298, -2451, -4193, -6189,
-    -8032, -9352, -9886, -9531, -8378, -6675, -4730, -2835, -1209, 30, 881, 1448,
-    1874, 2305, 2860, 3602, 4491, 5406, 6165, 6550, 6359, 5490, 3999, 2124,
-    249, -1176, -1792, -1457, -270, 1472, 3344, 4929, 5932, 6245, 5960, 5321,
-    4628, 4104, 3840, 3785, 3771, 3586, 3076, 2193, 981, -461, -2030, -3657,
-    -5283, -6804, -8041, -8757, -8735, -7893, -6372, -4534, -2836, -1672, -1229, -1431,
-    -1982, -2502, -2677, -2361, -1605, -616, 309, 870, 853, 192, -1001, -2461,
-    -3838, -4814, -5224, -5103, -4653, -4175, -3970, -4246, -5062, -6306, -7728, -8993,
-    -9764, -9796, -9013, -7541, -5652, -3680, -1960, -763, -225, -312, -835, -1484,
-    -1908, -1819, -1088, 252, 2044, 4043, 5953, 7484, 8410, 8609, 8092, 6993,
-    5526, 3937, 2451, 1245, 436, 91, 223, 781, 1666, 2743, 3807, 4605,
-    4914, 4607, 3686, 2277, 581, -1215, -2978, -4601, -5979, -7024, -7678, -7897,
-    -7657, -6958, -5809, -4241, -2351, -331, 1557, 3017, 3754, 3556, 2374, 348,
-    -2209, -4867, -7163, -8724, -9362, -9055, -7923, -6194, -4175, -2187, -521, 601,
-    1084, 987, 477, -247, -995, -1605, -1954, -1971, -1642, -1023, -247, 538,
-    1222, 1755, 2146, 2480, 2889, 3503, 4397, 5549, 6823, 8010, 8918, 9446,
-    9598, 9444, 9089, 8659, 8292, 8110, 8140, 8270, 8274, 7929, 7118, 5869,
-    4312, 2612, 927, -591, -1783, -2490, -2602, -2117, -1170, 4, 1140, 1996,
-    2414, 2383, 2037, 1581, 1217, 1075, 1153, 1324, 1405, 1227, 661, -349,
-    -1760, -3433, -5165, -6714, -7845, -8402, -8330, -7652, -6464, -4927, -3261, -1706,
-    -489, 239, 468, 344, 121, 68, 379, 1124, 2258, 3656, 5138, 6507,
-    7590, 8256, 8440, 8161, 7520, 6667, 5775, 5002, 4454, 4141, 3980, 3841,
-    3601, 3176, 2549, 1765, 924, 163, -373, -590, -484, -138, 318, 759,
-    1117, 1370, 1505, 1491, 1290, 879, 273, -465, -1239, -1949, -2524, -2933,
-    -3195, -3366, -3491, -3567, -3541, -3356, -2980, -2440, -1834, -1323, -1084, -1261,
-    -1916, -2992, -4302, -5582, -6579, -7100, -7032, -6358, -5156, -3583, -1846, -172,
-    1234, 2230, 2761, 2836, 2532, 1980, 1347, 791, 425, 293, 373, 611,
-    967, 1407, 1888, 2341, 2685, 2842, 2774, 2517, 2169, 1877, 1805, 2076,
-    2709, 3614, 4636, 5600, 6351, 6787, 6844, 6490, 5742, 4699, 3522, 2384,
-    1420, 674, 101, -378, -801, -1153, -1409, -1567, -1674, -1829, -2139, -2675,
-    -3453, -4440, -5549, -6667, -7689, -8507, -9002, -9069, -8650, -7749, -6447, -4901,
-    -3292, -1771, -486, 402, 757, 506, -338, -1638, -3131, -4499, -5452, -5769,
-    -5336, -4185, -2487, -504, 1475, 3192, 4481, 5264, 5521, 5292, 4703, 3951,
-    3269, 2892, 2996, 3633, 4720, 6071, 7426, 8509, 9105, 9111, 8520, 7388,
-    5803, 3879, 1777, -281, -2044, -3290, -3869, -3717, -2862, -1421, 405, 2340,
-    4076, 5347, 5975, 5895, 5177, 4015, 2670, 1413, 483, 43, 138, 703,
-    1606, 2663, 3649, 4348, 4596, 4309, 3491, 2231, 650, -1127, -2963, -4710,
-    -6230, -7406, -8144, -8378, -8092, -7312, -6110, -4630, -3064, -1591, -318, 715,
-    1504, 2082, 2487, 2763, 2968, 3174, 3443, 3783, 4134, 4387, 4426, 4168,
-    3581, 2680, 1509, 165, -1196, -2374, -3179, -3498, -3318, -2698, -1726, -499,
-    866, 2227, 3426, 4337, 4914, 5192, 5235, 5082, 4716, 4081, 3127, 1864,
-    378, -1207, -2757, -4133, -5206, -5883, -6104, -5852, -5187, -4268, -3328, -2626,
-    -2367, -2627, -3325, -4271, -5223, -5936, -6224, -6001, -5293, -4238, -3048, -1934,
-    -1021, -332, 173, 560, 902, 1268, 1724, 2337, 3135, 4083, 5102, 6083,
-    6906, 7478, 7756, 7738, 7457, 6993, 6424, 5783, 5053, 4188, 3135, 1865,
-    431, -1051, -2461, -3677, -4570, -5026, -4990, -4472, -3556, -2411, -1238, -206,
-    583, 1100, 1374, 1473, 1467, 1421, 1395, 1432, 1563, 1801, 2135, 2520,
-    2888, 3166, 3280, 3170, 2806, 2167, 1230, -4, -1470, -3011, -4387, -5345,
-    -5717, -5454, -4630, -3404, -1976, -527, 818, 1997, 3009, 3890, 4673, 5367,
-    5961, 6418, 6682, 6713, 6518, 6141, 5639, 5051, 4388, 3620, 2715, 1673,
-    543, -571, -1546, -2292, -2757, -2899, -2689, -2135, -1313, -366, 519, 1175,
-    1527, 1583, 1395, 1028, 547, 9, -506, -881, -1004, -810, -299, 455,
-    1295, 2021, 2437, 2389, 1788, 655, -891, -2698, -4597, -6411, -7973, -9147,
-    -9804, -9853, -9289, -8198, -6720, -5054, -3431, -2030, -927, -111, 504, 1049,
-    1620, 2231, 2854, 3448, 3960, 4341, 4563, 4614, 4459, 4044, 3308, 2200,
-    733, -988, -2767, -4374, -5587, -6238, -6251, -5639, -4479, -2907, -1112, 682,
-    2249, 3394, 4009, 4091, 3736, 3094, 2342, 1653, 1162, 936, 958, 1136,
-    1319, 1352, 1128, 609, -185, -1202, -2396, -3738, -5194, -6699, -8155, -9440,
-    -10420, -10965, -10992, -10506, -9608, -8464, -7261, -6161, -5266, -4604, -4139, -3768,
-    -3352, -2786, -2048, -1199, -345, 404, 952, 1217, 1123, 606, -340, -1624,
-    -3059, -4412, -5458, -6011, -5951, -5240, -3948, -2251, -380, 1440, 3048, 4349,
-    5294, 5843, 5969, 5679, 5016, 4051, 2861, 1534, 184, -1042, -1996, -2570,
-    -2737, -2541, -2064, -1393, -629, 104, 660, 903, 742, 151, -828, -2093,
-    -3496, -4861, -6002, -6761, -7034, -6789, -6074, -5029, -3860, -2778, -1941, -1410,
-    -1127, -953, -740, -377, 191, 979, 1975, 3139, 4393, 5591, 6541, 7042,
-    6931, 6116, 4613, 2574, 279, -1898, -3560, -4384, -4201, -3031, -1091, 1265,
-    3641, 5698, 7223, 8146, 8516, 8454, 8118, 7669, 7266, 7032, 7018, 7181,
-    7385, 7452, 7226, 6629, 5676, 4438, 3013, 1484, -89, -1660, -3193, -4645,
-    -5950, -7034, -7827, -8267, -8306, -7933, -7182, -6110, -4804, -3375, -1932, -571,
-    607, 1499, 2028, 2154, 1874, 1248, 400, -518, -1356, -1961, -2207, -2050,
-    -1555, -897, -326, -73, -238, -748, -1405, -1960, -2203, -2033, -1465, -598,
-    423, 1438, 2299, 2900, 3181, 3142, 2840, 2387, 1953, 1749, 1965, 2690,
-    3874, 5337, 6823, 8092, 8975, 9369, 9223, 8544, 7392, 5871, 4130, 2338,
-    630, -914, -2256, -3393, -4344, -5125, -5712, -6051, -6081, -5766, -5127, -4257,
-    -3271, -2253, -1267, -387, 287, 639, 563, 12, -958, -2204, -3527, -4730,
-    -5655, -6218, -6437, -6404, -6231, -6012, -5800, -5600, -5381, -5100, -4709, -4150,
-    -3384, -2435, -1388, -339, 631, 1462, 2110, 2534, 2664, 2438, 1862, 1028,
-    87, -745, -1238, -1207, -574, 616, 2191, 3888, 5418, 6538, 7083, 6971,
-    6202, 4863, 3124, 1200, -711, -2477, -4050, -5434, -6633, -7604, -8250, -8464,
-    -8151, -7256, -5813, -3949, -1862, 207, 1997, 3276, 3906, 3853, 3186, 2086,
-    799, -423, -1364, -1862, -1860, -1436, -800, -242, -67, -478, -1479, -2868,
-    -4315, -5465, -6030, -5865, -4984, -3546, -1824, -140, 1222, 2094, 2456, 2422,
-    2198, 2019, 2068, 2429, 3078, 3891, 4668, 5199, 5335, 5023, 4296, 3280,
-    2157, 1116, 293, -265, -620, -938, -1405, -2131, -3118, -4271, -5422, -6382,
-    -6999, -7176, -6865, -6076, -4869, -3358, -1703, -85, 1331, 2435, 3180, 3578,
-    3683, 3576, 3350, 3102, 2927, 2901, 3055, 3357, 3714, 3996, 4071, 3840,
-    3283, 2481, 1596, 818, 313, 161, 339, 756, 1298, 1842, 2290, 2589,
-    2721, 2720, 2670, 2666, 2755, 2928, 3150, 3364, 3513, 3576, 3570, 3508,
-    3393, 3236, 3042, 2792, 2451, 1986, 1348, 483, -643, -2030, -3626, -5310,
-    -6904, -8197, -8990, -9127, -8539, -7278, -5515, -3503, -1503, 270, 1683, 2697,
-    3345, 3701, 3850, 3882, 3886, 3929, 4046, 4232, 4442, 4611, 4690, 4644,
-    4438, 4045, 3440, 2609, 1564, 373, -853, -1967, -2816, -3277, -3288, -2828,
-    -1926, -686, 727, 2142, 3415, 4450, 5212, 5681, 5816, 5570, 4942, 4003,
-    2892, 1803, 924, 381, 225, 440, 929, 1522, 2022, 2249, 2092, 1540,
-    659, -470, -1772, -3171, -4585, -5911, -7017, -7779, -8110, -7961, -7337, -6345,
-    -5176, -4049, -3146, -2551, -2197, -1911, -1527, -942, -129, 861, 1913, 2909,
-    3752, 4351, 4672, 4763, 4719, 4620, 4490, 4284, 3906, 3282, 2400, 1305,
-    63, -1254, -2568, -3760, -4672, -5142, -5069, -4446, -3375, -2067, -773, 279,
-    929, 1121, 924, 490, -13, -427, -635, -578, -243, 346, 1106, 1871,
-    2425, 2569, 2176, 1241, -129, -1785, -3565, -5301, -6844, -8066, -8847, -9097,
-    -8782, -7901, -6497, -4700, -2730, -803, 915, 2331, 3462, 4421, 5302, 6107,
-    6777, 7244, 7466, 7462, 7303, 7054, 6755, 6429, 6065, 5624, 5067, 4369,
-    3515, 2525, 1440, 273, -988, -2326, -3674, -4930, -5961, -6647, -6936, -6844,
-    -6421, -5760, -4999, -4259, -3604, -3035, -2473, -1778, -847, 310, 1569, 2760,
-    3717, 4327, 4525, 4269, 3549, 2405, 940, -687, -2282, -3650, -4629, -5096,
-    -4995, -4365, -3318, -1994, -559, 832, 2073, 3136, 4046, 4862, 5651, 6452,
-    7260, 8026, 8663, 9081, 9223, 9059, 8586, 7849, 6945, 5996, 5139, 4485,
-    4046, 3720, 3363, 2856, 2124, 1141, -64, -1446, -2957, -4515, -6001, -7266,
-    -8140, -8456, -8130, -7189, -5773, -4104, -2449, -1030, 43, 780, 1293, 1729,
-    2194, 2694, 3164, 3497, 3590, 3395, 2958, 2390, 1826, 1372, 1043, 770,
-    452, 1, -637, -1467, -2400, -3274, -3902, -4118, -3836, -3083, -1986, -724,
-    524, 1603, 2408, 2900, 3120, 3178, 3226, 3411, 3806, 4391, 5071, 5731,
-    6271, 6621, 6745, 6624, 6232, 5555, 4604, 3408, 1997, 426, -1216, -2850,
-    -4420, -5878, -7144, -8096, -8586, -8490, -7782, -6546, -4958, -3242, -1617, -241,
-    825, 1614, 2240, 2838, 3482, 4165, 4818, 5329, 5597, 5593, 5351, 4923,
-    4365, 3737, 3067, 2334, 1484, 467, -738, -2067, -3345, -4351, -4897, -4896,
-    -4383, -3497, -2435, -1396, -526, 150, 703, 1226, 1781, 2409, 3126, 3921,
-    4748, 5516, 6059, 6192, 5792, 4853, 3484, 1889, 285, -1184, -2446, -3485,
-    -4334, -5080, -5825, -6636, -7501, -8298, -8831, -8924, -8507, -7639, -6488, -5252,
-    -4078, -3052, -2201, -1491, -835, -139, 686, 1707, 2930, 4275, 5609, 6806,
-    7759, 8392, 8653, 8514, 7997, 7214, 6355, 5619, 5139, 4905, 4765, 4517,
-    4001, 3129, 1879, 307, -1490, -3408, -5329, -7098, -8555, -9581, -10104, -10102,
-    -9623, -8774, -7701, -6550, -5428, -4376, -3395, -2466, -1569, -711, 67, 733,
-    1285, 1735, 2099, 2412, 2685, 2878, 2926, 2766, 2354, 1695, 873, 28,
-    -682, -1103, -1121, -725, -7, 899, 1870, 2818, 3685, 4438, 5053, 5515,
-    5811, 5904, 5727, 5209, 4311, 3062, 1590, 98, -1191, -2101, -2559, -2630,
-    -2501, -2410, -2572, -3096, -3921, -4810, -5449, -5603, -5187, -4263, -2995, -1593,
-    -282, 714, 1192, 1018, 185, -1155, -2735, -4251, -5428, -6065, -6067, -5463,
-    -4381, -2992, -1478, 8, 1360, 2498, 3342, 3801, 3797, 3303, 2349, 1034,
-    -484, -1994, -3266, -4091, -4343, -4011, -3189, -2043, -748, 565, 1817, 2971,
-    4018, 4959, 5770, 6379, 6686, 6620, 6147, 5268, 4030, 2536, 914, -715,
-    -2235, -3529, -4499, -5065, -5145, -4665, -3621, -2118, -368, 1360, 2813, 3833,
-    4394, 4555, 4395, 3972, 3322, 2477, 1473, 347, -863, -2131, -3436, -4744,
-    -5979, -7027, -7779, -8156, -8119, -7692, -6969, -6100, -5248, -4554, -4103, -3900,
-    -3867, -3868, -3751, -3378, -2653, -1550, -135, 1465, 3100, 4619, 5882, 6796,
-    7315, 7417, 7101, 6396, 5359, 4065, 2603, 1061, -521, -2144, -3786, -5377,
-    -6821, -7997, -8744, -8912, -8431, -7331, -5759, -3965, -2236, -781, 323, 1121,
-    1718, 2210, 2640, 3006, 3275, 3424, 3442, 3319, 3019, 2498, 1733, 719,
-    -557, -2080, -3780, -5522, -7124, -8366, -9044, -9034, -8318, -6969, -5152, -3103,
-    -1084, 685, 2083, 3090, 3767, 4196, 4432, 4455, 4179, 3546, 2593, 1425,
-    157, -1105, -2275, -3325, -4278, -5168, -6027, -6870, -7668, -8348, -8823, -9013,
-    -8835, -8231, -7212, -5859, -4302, -2695, -1201, 43, 944, 1474, 1668, 1605,
-    1391, 1147, 995, 1032, 1313, 1852, 2617, 3536, 4513, 5444, 6244, 6851,
-    7209, 7248, 6889, 6093, 4880, 3340, 1622, -111, -1730, -3167, -4392, -5372,
-    -6047, -6346, -6221, -5666, -4713, -3445, -1977, -415, 1164, 2676, 3999, 4978,
-    5458, 5332, 4592, 3346, 1768, 37, -1694, -3329, -4812, -6088, -7074, -7703,
-    -7936, -7741, -7105, -6071, -4757, -3329, -1956, -750, 268, 1140, 1920, 2655,
-    3383, 4140, 4964, 5862, 6781, 7630, 8327, 8815, 9058, 9030, 8706, 8050,
-    7043, 5724, 4176, 2492, 762, -930, -2511, -3899, -4989, -5698, -6006, -5953,
-    -5620, -5115, -4539, -3936, -3308, -2634, -1875, -995, 6, 1096, 2219, 3293,
-    4200, 4819, 5059, 4877, 4292, 3386, 2272, 1075, -90, -1135, -1992, -2600,
-    -2905, -2863, -2440, -1623, -448, 980, 2529, 4066, 5480, 6701, 7698, 8453,
-    8962, 9234, 9288, 9130, 8756, 8164, 7364, 6386, 5300, 4217, 3285, 2661,
-    2470, 2740, 3353, 4062, 4563, 4605, 4067, 2965, 1413, -429, -2394, -4333,
-    -6110, -7617, -8774, -9494, -9691, -9325, -8439, -7152, -5622, -4025, -2509, -1170,
-    -47, 874, 1636, 2261, 2729, 2985, 2956, 2553, 1735, 572, -737, -1918,
-    -2698, -2867, -2340, -1176, 451, 2312, 4194, 5939, 7435, 8587, 9335, 9634,
-    9442, 8747, 7602, 6108, 4392, 2592, 831, -836, -2405, -3883, -5284, -6625,
-    -7866, -8886, -9544, -9736, -9426, -8646, -7499, -6126, -4674, -3266, -1987, -879,
-    52, 834, 1520, 2157, 2759, 3298, 3717, 3949, 3967, 3816, 3573, 3321,
-    3129, 3039, 3068, 3215, 3471, 3804, 4153, 4450, 4619, 4576, 4239, 3573,
-    2593, 1348, -78, -1574, -3024, -4320, -5349, -6005, -6217, -5974, -5341, -4433,
-    -3396, -2379, -1491, -782, -260, 84, 253, 229, -25, -529, -1285, -2273,
-    -3462, -4776, -6094, -7263, -8137, -8603, -8583, -8042, -7009, -5590, -3950, -2258,
-    -633, 863, 2210, 3390, 4358, 5038, 5332, 5149, 4431, 3201, 1594, -142,
-    -1669, -2634, -2775, -2008, -438, 1675, 3974, 6093, 7723, 8670, 8888, 8450,
-    7493, 6185, 4707, 3219, 1834, 622, -384, -1211, -1942, -2680, -3497, -4428,
-    -5452, -6480, -7383, -8023, -8278, -8061, -7373, -6310, -5030, -3709, -2493, -1456,
-    -598, 129, 792, 1464, 2181, 2915, 3597, 4150, 4511, 4633, 4492, 4095,
-    3487, 2747, 1970, 1242, 614, 113, -237, -413, -396, -162, 344, 1172,
-    2313, 3693, 5168, 6534, 7566, 8082, 7981, 7260, 6000, 4339, 2453, 524,
-    -1328, -3065, -4672, -6104, -7281, -8119, -8543, -8513, -8046, -7223, -6171, -5044,
-    -3991, -3104, -2406, -1869, -1432, -1008, -499, 171, 1031, 2059, 3185, 4319,
-    5374, 6284, 7006, 7497, 7701, 7563, 7065, 6225, 5081, 3721, 2270, 848,
-    -416, -1364, -1866, -1884, -1468, -733, 151, 1005, 1704, 2188, 2445, 2516,
-    2471, 2351, 2148, 1847, 1439, 931, 338, -319, -1043, -1862, -2790, -3807,
-    -4878, -5961, -7009, -7969, -8769, -9303, -9449, -9127, -8323, -7084, -5517, -3778,
-    -2029, -399, 1041, 2279, 3342, 4269, 5078, 5760, 6265, 6524, 6453, 5983,
-    5094, 3825, 2263, 520, -1279, -3017, -4612, -6009, -7160, -8015, -8509, -8588,
-    -8255, -7581, -6663, -5598, -4489, -3439, -2519, -1741, -1073, -480, 65, 585,
-    1076, 1508, 1869, 2166, 2394, 2504, 2424, 2079, 1421, 476, -646, -1765,
-    -2661, -3138, -3090, -2523, -1535, -279, 1094, 2465, 3761, 4962, 6082, 7144,
-    8151, 9059, 9753, 10077, 9915, 9222, 8044, 6546, 4949, 3434, 2125, 1085,
-    272, -448, -1191, -2043, -3070, -4242, -5384, -6279, -6764, -6726, -6139, -5104,
-    -3804, -2421, -1125, -40, 806, 1461, 2003, 2526, 3126, 3847, 4656, 5484,
-    6256, 6904, 7379, 7658, 7737, 7629, 7346, 6888, 6248, 5418, 4390, 3185,
-    1903, 704, -245, -817, -947, -665, -103, 549, 1083, 1336, 1268, 973,
-    603, 333, 321, 633, 1207, 1916, 2617, 3145, 3368, 3250, 2833, 2189,
-    1401, 528, -416, -1421, -2437, -3396, -4209, -4745, -4874, -4533, -3722, -2504,
-    -1027, 507, 1928, 3126, 4051, 4711, 5152, 5434, 5611, 5733, 5838, 5951,
-    6063, 6120, 6063, 5870, 5545, 5089, 4498, 3762, 2858, 1780, 539, -854,
-    -2373, -3952, -5518, -7001, -8286, -9209, -9639, -9523, -8886, -7827, -6503, -5070,
-    -3651, -2347, -1218, -271, 496, 1075, 1468, 1666, 1621, 1259, 553, -440,
-    -1572, -2632, -3408, -3749, -3581, -2923, -1894, -667, 590, 1760, 2785, 3666,
-    4437, 5113, 5662, 6015, 6102, 5888, 5377, 4582, 3509, 2175, 626, -1057,
-    -2776, -4433, -5950, -7261, -8283, -8926, -9122, -8826, -8033, -6822, -5351, -3802,
-    -2345, -1104, -100, 740, 1505, 2244, 2961, 3612, 4137, 4495, 4680, 4705,
-    4595, 4373, 4037, 3583, 2989, 2206, 1201, 3, -1308, -2610, -3741, -4556,
-    -4975, -4983, -4617, -3990, -3277, -2649, -2215, -1978, -1849, -1688, -1364, -827,
-    -143, 534, 1054, 1298, 1211, 848, 342, -181, -618, -902, -1038, -1095,
-    -1147, -1281, -1590, -2105, -2768, -3460, -4005, -4206, -3929, -3158, -1972, -523,
-    1002, 2449, 3740, 4860, 5845, 6730, 7500, 8091, 8435, 8461, 8108, 7355,
-    6240, 4835, 3239, 1576, -28, -1500, -2846, -4119, -5356, -6536, -7556, -8253,
-    -8498, -8249, -7551, -6512, -5279, -4004, -2822, -1838, -1091, -521, 16, 674,
-    1536, 2574, 3666, 4656, 5398, 5820, 5930, 5764, 5339, 4680, 3832, 2820,
-    1678, 480, -698, -1806, -2764, -3466, -3846, -3871, -3540, -2913, -2128, -1338,
-    -666, -186, 101, 256, 372, 534, 750, 933, 955, 703, 94, -893,
-    -2184, -3647, -5144, -6540, -7701, -8508, -8858, -8650, -7848, -6518, -4814, -2937,
-    -1104, 518, 1865, 2941, 3759, 4309, 4572, 4534, 4220, 3731, 3193, 2709,
-    2321, 2009, 1688, 1277, 740, 68, -722, -1553, -2318, -2916, -3258, -3293,
-    -3056, -2664, -2289, -2119, -2279, -2754, -3419, -4070, -4466, -4446, -4004, -3250,
-    -2345, -1460, -710, -141, 205, 288, 108, -311, -916, -1600, -2273, -2929,
-    -3591, -4269, -4963, -5605, -6040, -6152, -5898, -5259, -4269, -3035, -1661, -234,
-    1142, 2401, 3565, 4664, 5695, 6640, 7424, 7914, 7996, 7628, 6825, 5680,
-    4331, 2909, 1531, 294, -760, -1639, -2386, -3073, -3766, -4481, -5200, -5874,
-    -6399, -6676, -6649, -6295, -5631, -4733, -3682, -2549, -1418, -345, 681, 1673,
-    2622, 3521, 4336, 4991, 5448, 5718, 5809, 5750, 5591, 5307, 4803, 4022,
-    2952, 1604, 59, -1553, -3120, -4532, -5659, -6382, -6617, -6315, -5521, -4375,
-    -3054, -1756, -640, 240, 893, 1330, 1609, 1826, 2040, 2277, 2565, 2909,
-    3282, 3685, 4136, 4624, 5127, 5608, 5987, 6173, 6110, 5757, 5080, 4094,
-    2866, 1515, 245, -684, -1069, -833, -18, 1218, 2660, 4120, 5456, 6546,
-    7281, 7568, 7329, 6532, 5226, 3534, 1622, -321, -2128, -3691, -4920, -5737,
-    -6118, -6081, -5638, -4835, -3798, -2667, -1554, -574, 158, 600, 796, 851,
-    904, 1080, 1432, 1942, 2546, 3150, 3678, 4104, 4421, 4645, 4824, 4997,
-    5178, 5371, 5543, 5622, 5553, 5300, 4813, 4065, 3090, 1933, 647, -661,
-    -1859, -2858, -3609, -4106, -4410, -4596, -4697, -4697, -4518, -4063, -3318, -2384,
-    -1402, -524, 91, 332, 144, -516, -1622, -3013, -4438, -5628, -6333, -6394,
-    -5799, -4649, -3123, -1441, 211, 1724, 3042, 4159, 5126, 5964, 6620, 7044,
-    7239, 7238, 7093, 6865, 6570, 6161, 5569, 4739, 3636, 2271, 718, -886,
-    -2388, -3632, -4488, -4903, -4931, -4705, -4367, -4028, -3763, -3587, -3453, -3266,
-    -2944, -2456, -1834, -1156, -534, -82, 128, 84, -180, -617, -1178, -1813,
-    -2458, -3031, -3442, -3608, -3464, -3001, -2248, -1263, -142, 985, 2000, 2851,
-    3533, 4085, 4571, 5046, 5547, 6074, 6587, 7020, 7310, 7388, 7174, 6622,
-    5740, 4580, 3240, 1868, 589, -545, -1548, -2492, -3485, -4593, -5806, -7056,
-    -8230, -9178, -9753, -9825, -9312, -8230, -6726, -5010, -3301, -1758, -417, 779,
-    1885, 2928, 3932, 4876, 5692, 6324, 6739, 6889, 6734, 6277, 5544, 4577,
-    3455, 2254, 1020, -218, -1451, -2687, -3911, -5071, -6127, -7050, -7781, -8264,
-    -8459, -8334, -7906, -7266, -6510, -5689, -4835, -3966, -3063, -2127, -1202, -306,
-    590, 1490, 2362, 3171, 3869, 4402, 4765, 4984, 5055, 4940, 4596, 3974,
-    3055, 1900, 613, -706, -1956, -3025, -3828, -4321, -4504, -4429, -4211, -3989,
-    -3859, -3838, -3869, -3855, -3698, -3339, -2789, -2113, -1412, -806, -420, -343,
-    -605, -1168, -1939, -2813, -3720, -4612, -5434, -6123, -6622, -6859, -6747, -6232,
-    -5326, -4090, -2622, -1051, 495, 1932, 3220, 4349, 5335, 6207, 6962, 7551,
-    7908, 7980, 7761, 7278, 6570, 5671, 4632, 3506, 2337, 1165, 19, -1110,
-    -2280, -3541, -4894, -6276, -7543, -8527, -9110, -9244, -8916, -8175, -7132, -5906,
-    -4607, -3347, -2233, -1324, -624, -83, 410, 977, 1680, 2498, 3351, 4153,
-    4837, 5331, 5550, 5413, 4857, 3876, 2580, 1198, -9, -811, -1023, -572,
-    476, 1941, 3569, 5074, 6223, 6911, 7126, 6893, 6282, 5403, 4382, 3342,
-    2388, 1559, 834, 147, -593, -1462, -2493, -3676, -4967, -6260, -7397, -8221,
-    -8608, -8467, -7770, -6575, -5004, -3215, -1405, 233, 1589, 2651, 3482, 4176,
-    4825, 5477, 6136, 6776, 7339, 7745, 7935, 7891, 7611, 7079, 6289, 5248,
-    3978, 2526, 938, -741, -2458, -4114, -5583, -6724, -7411, -7564, -7180, -6336,
-    -5190, -3943, -2774, -1796, -1042, -474, -8, 433, 912, 1478, 2160, 2955,
-    3828, 4691, 5418, 5893, 6023, 5739, 4999, 3826, 2341, 758, -631, -1539,
-    -1788, -1371, -433, 794, 2051, 3103, 3787, 4035, 3855, 3318, 2537, 1649,
-    761, -54, -766, -1423, -2122, -2939, -3887, -4926, -5974, -6933, -7732, -8301,
-    -8538, -8340, -7668, -6548, -5066, -3367, -1590, 167, 1836, 3359, 4703, 5826,
-    6649, 7108, 7178, 6848, 6158, 5227, 4201, 3213, 2401, 1857, 1562, 1410,
-    1262, 954, 354, -564, -1733, -3066, -4447, -5742, -6852, -7701, -8195, -8273,
-    -7940, -7226, -6187, -4945, -3655, -2432, -1350, -431, 376, 1145, 1898, 2614,
-    3255, 3767, 4098, 4212, 4075, 3654, 2985, 2205, 1524, 1162, 1290, 1975,
-    3142, 4589, 6044, 7250, 8022, 8261, 7957, 7182, 6053, 4717, 3336, 2054,
-    943, 19, -754, -1462, -2194, -3012, -3942, -4960, -5956, -6783, -7309, -7423,
-    -7053, -6234, -5110, -3863, -2667, -1654, -871, -298, 127, 496, 924, 1497,
-    2257, 3206, 4279, 5369, 6400, 7325, 8090, 8638, 8924, 8874, 8416, 7528,
-    6222, 4524, 2521, 369, -1766, -3714, -5293, -6379, -6937, -6973, -6518, -5677,
-    -4606, -3450, -2331, -1326, -438, 370, 1123, 1828, 2470, 3012, 3421, 3699,
-    3862, 3938, 3966, 3956, 3857, 3581, 3050, 2225, 1131, -133, -1400, -2434,
-    -2991, -2915, -2216, -1056, 293, 1537, 2464, 3005, 3197, 3128, 2920, 2692,
-    2527, 2451, 2437, 2420, 2317, 2044, 1554, 868, 54, -811, -1684, -2553,
-    -3446, -4382, -5310, -6112, -6646, -6768, -6379, -5461, -4083, -2381, -545, 1216,
-    2745, 3972, 4904, 5594, 6099, 6436, 6593, 6542, 6258, 5738, 4996, 4035,
-    2846, 1469, -1, -1477, -2901, -4219, -5400, -6444, -7344, -8065, -8542, -8689,
-    -8421, -7717, -6652, -5366, -4019, -2737, -1583, -562, 341, 1158, 1934, 2695,
-    3426, 4090, 4653, 5088, 5373, 5469, 5321, 4882, 4124, 3047, 1689, 138,
-    -1517, -3197, -4822, -6287, -7457, -8184, -8344, -7906, -6947, -5610, -4065, -2480,
-    -980, 354, 1484, 2407, 3138, 3683, 4052, 4261, 4331, 4287, 4157, 3945,
-    3618, 3137, 2471, 1604, 550, -630, -1860, -3051, -4098, -4893, -5364, -5502,
-    -5366, -5063, -4709, -4387, -4117, -3846, -3472, -2917, -2147, -1179, -103, 916,
-    1710, 2160, 2200, 1839, 1180, 348, -562, -1471, -2319, -3082, -3740, -4220,
-    -4425, -4281, -3770, -2958, -1968, -908, 153, 1171, 2128, 3044, 3935, 4788,
-    5563, 6175, 6493, 6410, 5877, 4909, 3600, 2124, 654, -697, -1878, -2905,
-    -3840, -4727, -5582, -6418, -7235, -7994, -8627, -9051, -9156, -8864, -8178, -7171,
-    -5954, -4651, -3344, -2044, -729, 602, 1956, 3326, 4662, 5865, 6816, 7407,
-    7593, 7425, 7010, 6446, 5796, 5074, 4261, 3340, 2325, 1242, 116, -1044,
-    -2239, -3446, -4588, -5565, -6270, -6602, -6522, -6079, -5359, -4433, -3394, -2352,
-    -1401, -620, -63, 283, 506, 685, 874, 1110, 1401, 1725, 2050, 2317,
-    2406, 2175, 1535, 487, -853, -2251, -3427, -4129, -4194, -3609, -2487, -1012,
-    605, 2150, 3454, 4436, 5086, 5442, 5571, 5511, 5248, 4751, 4013, 3065,
-    2000, 960, 61, -658, -1217, -1675, -2113, -2596, -3170, -3867, -4656, -5419,
-    -5995, -6218, -5953, -5158, -3911, -2334, -565, 1231, 2910, 4389, 5629, 6618,
-    7389, 7981, 8390, 8585, 8506, 8068, 7229, 6026, 4539, 2868, 1149, -475,
-    -1915, -3143, -4180, -5076, -5842, -6428, -6761, -6764, -6357, -5512, -4297, -2833,
-    -1267, 219, 1477, 2475, 3270, 3933, 4547, 5184, 5864, 6558, 7214, 7739,
-    8012, 7918, 7367, 6310, 4789, 2914, 820, -1344, -3401, -5174, -6517, -7335,
-    -7589, -7298, -6523, -5385, -4071, -2778, -1652, -781, -165, 302, 769, 1349,
-    2099, 3011, 4009, 4992, 5895, 6687, 7347, 7832, 8060, 7932, 7378, 6375,
-    4960, 3239, 1371, -478, -2153, -3518, -4460, -4907, -4832, -4290, -3436, -2467,
-    -1571, -867, -351, 95, 592, 1187, 1841, 2463, 2959, 3284, 3412, 3311,
-    2943, 2308, 1440, 433, -535, -1255, -1528, -1200, -226, 1286, 3121, 5041,
-    6819, 8313, 9490, 10355, 10868, 10980, 10668, 9927, 8810, 7443, 5972, 4532,
-    3254, 2201, 1308, 460, -433, -1446, -2639, -4016, -5513, -7008, -8315, -9206,
-    -9485, -9037, -7874, -6175, -4213, -2243, -448, 1079, 2356, 3467, 4474, 5406,
-    6254, 6945, 7374, 7487, 7294, 6833, 6160, 5324, 4316, 3105, 1693, 112,
-    -1573, -3231, -4698, -5841, -6562, -6796, -6536, -5860, -4916, -3915, -3042, -2387,
-    -1939, -1635, -1371, -1037, -582, 4, 726, 1570, 2488, 3423, 4310, 5055,
-    5552, 5720, 5497, 4862, 3837, 2472, 845, -892, -2516, -3773, -4429, -4344,
-    -3531, -2171, -551, 1000, 2202, 2892, 3036, 2716, 2092, 1331, 544, -213,
-    -928, -1632, -2363, -3120, -3882, -4648, -5409, -6139, -6810, -7382, -7790, -7956,
-    -7824, -7355, -6564, -5543, -4438, -3401, -2560, -1968, -1573, -1258, -891, -363,
-    359, 1198, 2014, 2662, 3009, 2968, 2525, 1707, 581, -734, -2105, -3426,
-    -4626, -5676, -6615, -7508, -8374, -9162, -9769, -10056, -9894, -9226, -8093, -6617,
-    -4975, -3336, -1830, -544, 502, 1387, 2235, 3111, 4010, 4881, 5618, 6084,
-    6156, 5751, 4838, 3468, 1761, -144, -2110, -4011, -5775, -7372, -8754, -9833,
-    -10504, -10654, -10196, -9130, -7555, -5651, -3662, -1827, -293, 906, 1824, 2559,
-    3199, 3766, 4248, 4631, 4884, 4966, 4876, 4646, 4298, 3838, 3231, 2406,
-    1312, -29, -1547, -3150, -4719, -6125, -7265, -8038, -8344, -8126, -7400, -6253,
-    -4849, -3382, -1992, -755, 303, 1226, 2104, 2973, 3805, 4557, 5175, 5584,
-    5750, 5673, 5339, 4746, 3930, 2927, 1762, 513, -689, -1704, -2370, -2550,
-    -2224, -1514, -624, 210, 785, 1014, 955, 760, 631, 746, 1173, 1846,
-    2618, 3307, 3764, 3935, 3853, 3576, 3169, 2689, 2157, 1571, 921, 204,
-    -575, -1362, -2056, -2529, -2627, -2204, -1204, 307, 2154, 4098, 5896, 7378,
-    8453, 9086, 9272, 9010, 8294, 7152, 5661, 3946, 2169, 478, -1057, -2416,
-    -3564, -4447, -5053, -5414, -5620, -5815, -6090, -6396, -6573, -6434, -5833, -4738,
-    -3255, -1573, 132, 1723, 3122, 4307, 5291, 6107, 6789, 7317, 7610, 7617,
-    7359, 6892, 6272, 5557, 4779, 3954, 3107, 2242, 1313, 272, -893, -2169,
-    -3517, -4834, -6008, -6956, -7590, -7819, -7603, -6961, -5960, -4734, -3466, -2314,
-    -1377, -698, -246, 92, 435, 858, 1392, 2032, 2746, 3509, 4306, 5104,
-    5835, 6396, 6650, 6480, 5845, 4766, 3303, 1572, -286, -2175, -4036, -5793,
-    -7349, -8610, -9467, -9837, -9718, -9159, -8217, -6981, -5587, -4151, -2740, -1391,
-    -104, 1142, 2338, 3442, 4412, 5211, 5794, 6130, 6205, 6007, 5540, 4815,
-    3833, 2603, 1183, -350, -1905, -3348, -4536, -5394, -5908, -6079, -5930, -5517,
-    -4909, -4177, -3382, -2545, -1653, -711, 259, 1223, 2127, 2915, 3570, 4096,
-    4497, 4807, 5070, 5279, 5406, 5417, 5247, 4817, 4085, 3034, 1668, 55,
-    -1676, -3402, -4996, -6295, -7162, -7526, -7376, -6773, -5844, -4716, -3490, -2268,
-    -1125, -73, 907, 1845, 2790, 3772, 4763, 5713, 6564, 7225, 7625, 7732,
-    7501, 6865, 5801, 4349, 2592, 687, -1156, -2742, -3935, -4649, -4908, -4836,
-    -4578, -4245, -3907, -3578, -3206, -2715, -2024, -1084, 52, 1235, 2298, 3106,
-    3581, 3743, 3683, 3498, 3286, 3144, 3102, 3103, 3055, 2832, 2289, 1360,
-    127, -1217, -2413, -3184, -3326, -2791, -1687, -249, 1218, 2429, 3193, 3438,
-    3210, 2645, 1922, 1202, 597, 150, -167, -415, -644, -882, -1136, -1417,
-    -1754, -2169, -2652, -3132, -3493, -3611, -3401, -2822, -1871, -607, 818, 2212,
-    3408, 4296, 4858, 5179, 5406, 5646, 5924, 6187, 6322, 6204, 5737, 4885,
-    3685, 2253, 758, -650, -1903, -3026, -4098, -5181, -6278, -7332, -8241, -8900,
-    -9210, -9075, -8424, -7256, -5681, -3910, -2188, -703, 469, 1372, 2119, 2834,
-    3580, 4339, 5043, 5630, 6051, 6258, 6199, 5832, 5142, 4152, 2913, 1509,
-    24, -1505, -3079, -4686, -6260, -7685, -8803, -9446, -9530, -9070, -8135, -6824,
-    -5265, -3595, -1938, -384, 1039, 2351, 3550, 4591, 5429, 6016, 6297, 6256,
-    5952, 5450, 4784, 3956, 2954, 1765, 414, -1040, -2538, -4030, -5459, -6745,
-    -7801, -8530, -8843, -8676, -8037, -7022, -5768, -4402, -3022, -1685, -394, 875,
-    2122, 3342, 4523, 5596, 6447, 6976, 7119, 6845, 6177, 5166, 3864, 2349,
-    725, -946, -2621, -4199, -5561, -6636, -7364, -7676, -7557, -7054, -6230, -5204,
-    -4140, -3157, -2292, -1541, -864, -177, 587, 1439, 2373, 3367, 4385, 5384,
-    6276, 6917, 7175, 6983, 6324, 5214, 3713, 1911, -77, -2089, -3941, -5484,
-    -6612, -7251, -7377, -7017, -6245, -5182, -3977, -2759, -1627, -637, 217, 1003,
-    1795, 2649, 3591, 4602, 5611, 6536, 7298, 7810, 7988, 7755, 7072, 5952,
-    4484, 2822, 1166, -308, -1488, -2308, -2744, -2860, -2808, -2737, -2727, -2767,
-    -2758, -2579, -2177, -1595, -918, -229, 403, 938, 1367, 1692, 1947, 2179,
-    2404, 2573, 2612, 2440, 1998, 1304, 486, -263, -743, -789, -322, 595,
-    1762, 2887, 3671, 3897, 3506, 2627, 1536, 545, -99, -280, -41, 465,
-    1051, 1549, 1829, 1822, 1515, 933, 163, -652, -1397, -2033, -2541, -2886,
-    -3023, -2889, -2419, -1641, -662, 405, 1472, 2425, 3168, 3674, 3975, 4139,
-    4267, 4411, 4521, 4480, 4172, 3535, 2609, 1513, 384, -659, -1541, -2269,
-    -2915, -3550, -4220, -4953, -5702, -6324, -6655, -6568, -5977, -4875, -3365, -1628,
-    132, 1733, 3068, 4139, 5007, 5723, 6288, 6678, 6858, 6794, 6447, 5790,
-    4828, 3600, 2176, 661, -813, -2138, -3272, -4237, -5113, -5985, -6870, -7683,
-    -8279, -8509, -8257, -7477, -6227, -4655, -2938, -1224, 393, 1872, 3196, 4349,
-    5319, 6109, 6719, 7125, 7281, 7134, 6646, 5822, 4712, 3383, 1903, 327,
-    -1313, -2975, -4570, -5982, -7130, -7965, -8431, -8488, -8124, -7345, -6215, -4872,
-    -3458, -2052, -712, 517, 1655, 2753, 3828, 4873, 5871, 6759, 7452, 7886,
-    7998, 7702, 6944, 5725, 4084, 2125, 0, -2144, -4166, -5892, -7186, -7988,
-    -8266, -8019, -7311, -6219, -4796, -3136, -1385, 344, 1963, 3398, 4632, 5683,
-    6518, 7072, 7334, 7310, 6994, 6407, 5592, 4578, 3407, 2140, 805, -609,
-    -2101, -3637, -5164, -6602, -7851, -8809, -9368, -9427, -8938, -7925, -6459, -4676,
-    -2749, -851, 879, 2361, 3588, 4593, 5394, 5988, 6348, 6436, 6232, 5758,
-    5072, 4243, 3341, 2385, 1345, 188, -1121, -2610, -4233, -5846, -7272, -8360,
-    -8974, -9014, -8445, -7302, -5707, -3880, -2047, -355, 1134, 2412, 3513, 4455,
-    5219, 5794, 6192, 6430, 6521, 6471, 6259, 5836, 5151, 4143, 2775, 1084,
-    -822, -2793, -4671, -6319, -7648, -8559, -8928, -8690, -7897, -6687, -5262, -3860,
-    -2647, -1676, -939, -381, 134, 758, 1580, 2628, 3884, 5242, 6537, 7610,
-    8322, 8554, 8243, 7387, 6011, 4182, 2021, -324, -2691, -4911, -6833, -8340,
-    -9327, -9703, -9426, -8512, -7048, -5223, -3298, -1514, -36, 1065, 1827, 2374,
-    2842, 3344, 3942, 4612, 5258, 5777, 6082, 6102, 5807, 5234, 4475, 3650,
-    2892, 2285, 1822, 1438, 1048, 530, -218, -1207, -2360, -3550, -4617, -5420,
-    -5906, -6089, -5980, -5595, -4967, -4124, -3088, -1894, -569, 863, 2342, 3764,
-    5025, 6027, 6693, 7014, 7028, 6760, 6219, 5436, 4453, 3303, 2018, 621,
-    -876, -2423, -3935, -5339, -6586, -7606, -8332, -8728, -8768, -8456, -7830, -6931,
-    -5787, -4446, -2969, -1416, 165, 1718, 3186, 4501, 5587, 6391, 6891, 7080,
-    6949, 6501, 5738, 4680, 3396, 1994, 572, -802, -2096, -3324, -4498, -5589,
-    -6553, -7363, -7980, -8344, -8380, -8020, -7227, -6011, -4428, -2581, -617, 1285,
-    2967, 4313, 5269, 5832, 6012, 5824, 5319, 4576, 3666, 2642, 1545, 391,
-    -821, -2071, -3316, -4500, -5557, -6407, -6985, -7245, -7155, -6735, -6054, -5192,
-    -4204, -3108, -1890, -549, 869, 2299, 3687, 4961, 6017, 6755, 7096, 6987,
-    6411, 5385, 3935, 2135, 128, -1922, -3878, -5635, -7098, -8183, -8800, -8858,
-    -8315, -7213, -5701, -4007, -2337, -789, 618, 1877, 2983, 3952, 4796, 5505,
-    6054, 6400, 6497, 6315, 5846, 5075, 3989, 2586, 889, -1026, -3012, -4882,
-    -6444, -7532, -8029, -7887, -7131, -5883, -4376, -2886, -1632, -740, -227, -2,
-    97, 217, 469, 932, 1623, 2478, 3400, 4305, 5121, 5783, 6238, 6411,
-    6211, 5584, 4562, 3254, 1836, 505, -591, -1374, -1819, -1956, -1877, -1705,
-    -1552, -1508, -1609, -1820, -2057, -2232, -2264, -2087, -1658, -951, 53, 1316,
-    2737, 4185, 5521, 6584, 7220, 7319, 6845, 5861, 4560, 3229, 2151, 1517,
-    1357, 1523, 1756, 1804, 1499, 811, -136, -1111, -1868, -2222, -2103, -1572,
-    -767, 153, 1047, 1801, 2331, 2566, 2439, 1912, 998, -251, -1748, -3362,
-    -4907, -6171, -6927, -6979, -6237, -4752, -2709, -390, 1902, 3911, 5463, 6479,
-    6967, 6999, 6673, 6090, 5341, 4492, 3599, 2728, 1950, 1330, 913, 701,
-    631, 563, 322, -260, -1269, -2659, -4229, -5648, -6522, -6512, -5462, -3459,
-    -806, 2077, 4768, 6931, 8351, 8931, 8674, 7679, 6117, 4225, 2260, 442,
-    -1088, -2252, -3012, -3367, -3365, -3137, -2904, -2912, -3320, -4141, -5237, -6356,
-    -7206, -7536, -7192, -6131, -4448, -2358, -130, 1985, 3797, 5208, 6213, 6863,
-    7207, 7264, 7017, 6429, 5453, 4077, 2357, 438, -1473, -3180, -4548, -5526,
-    -6129, -6415, -6433, -6190, -5664, -4802, -3540, -1872, 78, 2060, 3748, 4820,
-    5061, 4469, 3245, 1725, 290, -732, -1145, -917, -144, 988, 2276, 3569,
-    4795, 5908, 6844, 7499, 7719, 7346, 6312, 4672, 2587, 297, -1943, -3938,
-    -5568, -6760, -7489, -7799, -7768, -7465, -6950, -6281, -5480, -4539, -3453, -2257,
-    -1016, 199, 1353, 2463, 3571, 4699, 5823, 6861, 7668, 8076, 7951, 7224,
-    5915, 4129, 2028, -203, -2367, -4293, -5872, -7049, -7779, -8033, -7826, -7201,
-    -6208, -4905, -3359, -1648, 140, 1888, 3477, 4832, 5926, 6745, 7271, 7487,
-    7376, 6932, 6178, 5150, 3894, 2465, 943, -556, -1881, -2887, -3496, -3738,
-    -3730, -3628, -3581, -3696, -4016, -4491, -4980, -5297, -5267, -4799, -3894, -2624,
-    -1091, 596, 2338, 4034, 5590, 6917, 7929, 8550, 8722, 8399, 7545, 6161,
-    4319, 2170, -60, -2097, -3685, -4663, -5006, -4831, -4373, -3894, -3574, -3445,
-    -3431, -3402, -3230, -2833, -2211, -1439, -622, 133, 772, 1330, 1906, 2609,
-    3506, 4582, 5724, 6739, 7412, 7561, 7071, 5920, 4201, 2102, -146, -2329,
-    -4290, -5960, -7330, -8390, -9091, -9365, -9165, -8478, -7347, -5879, -4206, -2436,
-    -654, 1060, 2650, 4095, 5382, 6496, 7420, 8129, 8568, 8659, 8330, 7529,
-    6257, 4597, 2704, 744, -1132, -2809, -4235, -5408, -6330, -6990, -7381, -7508,
-    -7378, -6996, -6372, -5518, -4460, -3220, -1800, -191, 1568, 3364, 5050, 6492,
-    7587, 8264, 8489, 8227, 7438, 6117, 4327, 2187, -149, -2524, -4812, -6934,
-    -8812, -10329, -11356, -11776, -11491, -10479, -8837, -6776, -4558, -2414, -470, 1261,
-    2830, 4275, 5612, 6833, 7905, 8755, 9291, 9402, 8989, 8015, 6534, 4662,
-    2550, 365, -1762, -3766, -5603, -7214, -8515, -9411, -9784, -9543, -8690, -7348,
-    -5712, -3989, -2320, -752, 732, 2157, 3533, 4853, 6071, 7103, 7847, 8200,
-    8071, 7410, 6249, 4697, 2910, 1059, -723, -2368, -3861, -5187, -6297, -7112,
-    -7533, -7470, -6882, -5823, -4446, -2956, -1549, -344, 628, 1413, 2106, 2795,
-    3518, 4238, 4863, 5280, 5387, 5119, 4481, 3554, 2482, 1415, 434, -480,
-    -1408, -2427, -3538, -4654, -5606, -6211, -6346, -5994, -5227, -4183, -3024, -1890,
-    -860, 48, 857, 1627, 2415, 3231, 4015, 4655, 5007, 4938, 4389, 3412,
-    2165, 861, -310, -1260, -2013, -2654, -3261, -3844, -4326, -4567, -4424, -3806,
-    -2716, -1280, 272, 1685, 2748, 3336, 3459, 3252, 2910, 2616, 2489, 2544,
-    2680, 2741, 2581, 2115, 1357, 429, -501, -1310, -1944, -2422, -2813, -3193,
-    -3570, -3862, -3924, -3603, -2812, -1595, -128, 1354, 2628, 3539, 4048, 4219,
-    4177, 4078, 4056, 4179, 4428, 4705, 4860, 4735, 4220, 3297, 2044, 624,
-    -762, -1976, -2983, -3825, -4566, -5259, -5891, -6373, -6580, -6405, -5775, -4661,
-    -3136, -1377, 388, 1947, 3180, 4094, 4779, 5321, 5743, 6017, 6080, 5858,
-    5268, 4265, 2868, 1165, -683, -2484, -4062, -5314, -6230, -6865, -7285, -7522,
-    -7560, -7333, -6759, -5783, -4410, -2740, -947, 783, 2294, 3483, 4302, 4776,
-    4974, 4962, 4784, 4447, 3913, 3140, 2136, 980, -214, -1338, -2307, -3087,
-    -3700, -4195, -4632, -5060, -5477, -5807, -5936, -5743, -5124, -4029, -2501, -662,
-    1313, 3220, 4854, 6045, 6676, 6671, 6020, 4808, 3186, 1374, -375, -1827,
-    -2839, -3368, -3432, -3090, -2421, -1510, -465, 578, 1463, 2034, 2170, 1839,
-    1136, 261, -565, -1182, -1543, -1724, -1859, -2051, -2313, -2562, -2648, -2420,
-    -1809, -862, 283, 1443, 2453, 3220, 3741, 4079, 4299, 4427, 4439, 4241,
-    3705, 2754, 1431, -100, -1594, -2783, -3462, -3565, -3145, -2325, -1280, -220,
-    682, 1319, 1642, 1666, 1483, 1224, 1005, 935, 1107, 1559, 2254, 3109,
-    4012, 4840, 5477, 5812, 5721, 5112, 3977, 2399, 511, -1517, -3507, -5290,
-    -6691, -7538, -7722, -7221, -6098, -4506, -2674, -840, 811, 2153, 3118, 3721,
-    4023, 4095, 3990, 3744, 3365, 2859, 2238, 1508, 654, -328, -1405, -2541,
-    -3693, -4787, -5707, -6322, -6514, -6240, -5570, -4676, -3762, -3003, -2502, -2280,
-    -2281, -2395, -2481, -2394, -2010, -1248, -116, 1286, 2787, 4182, 5239, 5742,
-    5570, 4714, 3264, 1401, -645, -2656, -4458, -5908, -6904, -7415, -7464, -7103,
-    -6407, -5471, -4378, -3217, -2067, -955, 147, 1274, 2424, 3558, 4602, 5449,
-    6013, 6236, 6067, 5462, 4426, 3016, 1337, -459, -2210, -3790, -5106, -6082,
-    -6670, -6880, -6757, -6357, -5747, -4998, -4163, -3289, -2409, -1512, -554, 500,
-    1651, 2853, 4020, 5048, 5852, 6363, 6513, 6252, 5572, 4513, 3162, 1657,
-    145, -1259, -2487, -3514, -4351, -5038, -5604, -6046, -6327, -6381, -6139, -5548,
-    -4583, -3250, -1604, 236, 2113, 3889, 5471, 6806, 7857, 8579, 8901, 8737,
-    8035, 6818, 5174, 3240, 1172, -882, -2814, -4543, -5993, -7096, -7781, -7971,
-    -7604, -6686, -5298, -3568, -1654, 282, 2118, 3774, 5180, 6280, 7051, 7488,
-    7588, 7358, 6817, 5986, 4884, 3536, 1970, 228, -1618, -3469, -5216, -6733,
-    -7875, -8506, -8520, -7869, -6601, -4859, -2830, -703, 1352, 3236, 4938, 6461,
-    7745, 8687, 9185, 9134, 8457, 7179, 5432, 3395, 1252, -832, -2734, -4396,
-    -5788, -6874, -7593, -7851, -7533, -6568, -4988, -2951, -696, 1513, 3455, 4991,
-    6065, 6687, 6894, 6730, 6233, 5443, 4411, 3216, 1972, 797, -212, -981,
-    -1473, -1698, -1703, -1547, -1288, -986, -661, -286, 184, 772, 1474, 2260,
-    3076, 3852, 4497, 4899, 4941, 4539, 3693, 2509, 1180, -74, -1078, -1736,
-    -2035, -2028, -1785, -1348, -736, 44, 965, 1952, 2868, 3542, 3829, 3648,
-    3008, 2041, 978, 85, -441, -548, -352, -76, 71, -26, -356, -795,
-    -1164, -1309, -1162, -752, -178, 435, 989, 1450, 1865, 2337, 2975, 3804,
-    4733, 5573, 6081, 6015, 5230, 3754, 1792, -361, -2413, -4142, -5419, -6186,
-    -6430, -6184, -5533, -4585, -3441, -2184, -876, 425, 1646, 2702, 3518, 4053,
-    4303, 4290, 4027, 3510, 2737, 1739, 572, -677, -1869, -2829, -3382, -3401,
-    -2850, -1833, -579, 644, 1610, 2179, 2317, 2098, 1664, 1171, 760, 538,
-    551, 778, 1163, 1651, 2207, 2824, 3487, 4138, 4668, 4927, 4775, 4131,
-    3016, 1555, -48, -1524, -2616, -3183, -3258, -3006, -2651, -2387, -2298, -2325,
-    -2327, -2167, -1761, -1090, -212, 763, 1720, 2574, 3282, 3846, 4293, 4629,
-    4810, 4771, 4449, 3809, 2876, 1755, 607, -407, -1176, -1679, -2001, -2288,
-    -2655, -3122, -3617, -4017, -4177, -3979, -3371, -2395, -1163, 182, 1509, 2718,
-    3745, 4548, 5086, 5295, 5096, 4429, 3285, 1721, -141, -2142, -4096, -5821,
-    -7152, -7963, -8170, -7730, -6647, -5017, -3029, -930, 1059, 2784, 4163, 5168,
-    5797, 6050, 5911, 5356, 4387, 3059, 1460, -317, -2183, -4036, -5787, -7357,
-    -8664, -9626, -10169, -10238, -9800, -8865, -7486, -5750, -3783, -1757, 168, 1888,
-    3355, 4541, 5441, 6033, 6228, 5886, 4924, 3371, 1366, -860, -3048, -5004,
-    -6628, -7864, -8672, -9045, -8996, -8552, -7764, -6692, -5374, -3856, -2246, -691,
-    674, 1753, 2506, 2948, 3099, 2959, 2536, 1888, 1120, 361, -238, -563,
-    -591, -374, 0, 426, 797, 1048, 1136, 1015, 627, -60, -1027, -2191,
-    -3399, -4452, -5143, -5298, -4820, -3735, -2214, -529, 1038, 2298, 3174, 3668,
-    3829, 3732, 3457, 3069, 2623, 2184, 1816, 1582, 1563, 1836, 2424, 3251,
-    4153, 4921, 5362, 5350, 4830, 3819, 2404, 745, -980, -2642, -4170, -5515,
-    -6616, -7392, -7744, -7583, -6863, -5624, -3982, -2088, -104, 1804, 3482, 4828,
-    5795, 6366, 6517, 6207, 5402, 4099, 2364, 341, -1752, -3656, -5116, -5940,
-    -6051, -5493, -4408, -3023, -1604, -397, 443, 865, 895, 620, 181, -269,
-    -606, -739, -576, -59, 792, 1883, 3070, 4170, 4984, 5353, 5184, 4460,
-    3254, 1713, 20, -1663, -3215, -4570, -5686, -6510, -6961, -6978, -6528, -5626,
-    -4341, -2784, -1079, 669, 2364, 3917, 5233, 6234, 6849, 7025, 6717, 5924,
-    4714, 3217, 1557, -159, -1845, -3438, -4900, -6185, -7229, -7958, -8296, -8151,
-    -7467, -6290, -4766, -3073, -1379, 193, 1589, 2823, 3916, 4858, 5602, 6075,
-    6203, 5913, 5138, 3861, 2173, 255, -1720, -3638, -5421, -6978, -8199, -8964,
-    -9160, -8697, -7552, -5797, -3593, -1151, 1315, 3583, 5438, 6714, 7323, 7250,
-    6531, 5253, 3558, 1633, -316, -2097, -3546, -4529, -4969, -4886, -4390, -3623,
-    -2748, -1941, -1345, -1023, -946, -1003, -1027, -872, -501, 8, 523, 924,
-    1149, 1218, 1209, 1227, 1384, 1769, 2398, 3194, 4024, 4730, 5183, 5334,
-    5241, 5005, 4697, 4318, 3816, 3111, 2136, 893, -525, -1959, -3247, -4258,
-    -4902, -5122, -4903, -4289, -3386, -2347, -1321, -402, 411, 1205, 2082, 3087,
-    4197, 5357, 6495, 7515, 8298, 8715, 8649, 8020, 6829, 5177, 3223, 1145,
-    -894, -2767, -4387, -5670, -6524, -6869, -6662, -5892, -4607, -2953, -1144, 606,
-    2131, 3338, 4232, 4892, 5398, 5795, 6066, 6120, 5829, 5119, 4022, 2664,
-    1218, -133, -1263, -2141, -2805, -3321, -3733, -4051, -4241, -4247, -3998, -3420,
-    -2468, -1159, 408, 2068, 3627, 4917, 5813, 6229, 6137, 5586, 4677, 3546,
-    2354, 1251, 314, -455, -1088, -1597, -1948, -2068, -1890, -1400, -642, 278,
-    1185, 1874, 2193, 2090, 1626, 990, 452, 235, 412, 892, 1474, 1914,
-    2045, 1846, 1422, 951, 633, 608, 893, 1399, 1996, 2569, 3057, 3462,
-    3817, 4157, 4509, 4867, 5154, 5231, 4963, 4252, 3068, 1480, -341, -2212,
-    -4006, -5636, -7009, -8031, -8638, -8824, -8639, -8162, -7461, -6577, -5525, -4316,
-    -2994, -1631, -288, 1015, 2276, 3490, 4619, 5579, 6237, 6458, 6143, 5250,
-    3791, 1835, -488, -2972, -5351, -7368, -8824, -9584, -9565, -8768, -7275, -5231,
-    -2844, -381, 1892, 3793, 5262, 6325, 7020, 7341, 7218, 6581, 5416, 3781,
-    1799, -356, -2498, -4480, -6207, -7609, -8621, -9192, -9290, -8901, -8025, -6668,
-    -4868, -2746, -509, 1607, 3403, 4761, 5637, 6027, 5935, 5374, 4395, 3117,
-    1720, 401, -688, -1477, -1955, -2128, -2000, -1587, -918, -43, 941, 1863,
-    2490, 2585, 1995, 729, -1024, -2963, -4790, -6264, -7216, -7544, -7225, -6338,
-    -5041, -3537, -2003, -549, 804, 2092, 3368, 4665, 5959, 7160, 8131, 8710,
-    8751, 8168, 6972, 5270, 3231, 1034, -1152, -3185, -4962, -6419, -7519, -8214,
-    -8406, -7971, -6834, -5044, -2787, -359, 1910, 3748, 5017, 5716, 5915, 5704,
-    5169, 4386, 3420, 2328, 1171, 22, -1035, -1908, -2508, -2772, -2690, -2319,
-    -1751, -1096, -479, -27, 184, 175, 57, -22, 56, 294, 568, 699,
-    546, 62, -702, -1615, -2502, -3192, -3538, -3456, -2974, -2218, -1337, -431,
-    459, 1350, 2279, 3253, 4210, 5020, 5515, 5518, 4896, 3631, 1841, -246,
-    -2355, -4234, -5710, -6700, -7194, -7223, -6852, -6167, -5246, -4126, -2821, -1371,
-    149, 1662, 3086, 4339, 5354, 6092, 6526, 6623, 6356, 5716, 4719, 3415,
-    1900, 271, -1414, -3125, -4830, -6469, -7944, -9108, -9811, -9955, -9528, -8589,
-    -7245, -5622, -3845, -2030, -267, 1407, 3018, 4596, 6111, 7454, 8459, 8941,
-    8752, 7838, 6277, 4257, 2005, -276, -2420, -4289, -5768, -6770, -7230, -7101,
-    -6368, -5072, -3327, -1314, 718, 2485, 3735, 4315, 4200, 3474, 2300, 899,
-    -491, -1672, -2524, -3002, -3134, -2982, -2591, -1949, -1015, 216, 1693, 3294,
-    4850, 6160, 7050, 7401, 7171, 6401, 5209, 3758, 2216, 726, -618, -1772,
-    -2743, -3570, -4299, -4938, -5433, -5672, -5543, -4973, -3948, -2532, -871, 855,
-    2512, 4033, 5390, 6552, 7458, 7991, 8010, 7415, 6192, 4414, 2236, -132,
-    -2484, -4638, -6427, -7709, -8384, -8390, -7713, -6422, -4683, -2715, -755, 979,
-    2364, 3377, 4037, 4345, 4295, 3874, 3069, 1925, 586, -731, -1785, -2349,
-    -2289, -1630, -522, 825, 2180, 3298, 3974, 4084, 3604, 2614, 1290, -162,
-    -1578, -2854, -3934, -4796, -5406, -5691, -5557, -4942, -3852, -2363, -598, 1300,
-    3188, 4937, 6435, 7581, 8265, 8397, 7939, 6932, 5475, 3693, 1725, -288,
-    -2192, -3830, -5089, -5942, -6406, -6515, -6296, -5770, -4930, -3777, -2370, -837,
-    657, 1958, 2940, 3522, 3688, 3478, 2975, 2282, 1521, 824, 314, 75,
-    148, 541, 1219, 2090, 3017, 3857, 4479, 4777, 4705, 4267, 3506, 2488,
-    1318, 144, -873, -1604, -1990, -2081, -2023, -1986, -2076, -2289, -2522, -2599,
-    -2346, -1659, -551, 857, 2379, 3828, 5073, 6056, 6733, 7044, 6929, 6346,
-    5268, 3722, 1812, -303, -2477, -4595, -6541, -8171, -9304, -9765, -9438, -8326,
-    -6553, -4352, -2012, 198, 2092, 3568, 4584, 5153, 5330, 5200, 4857, 4398,
-    3901, 3410, 2954, 2535, 2114, 1629, 1026, 261, -692, -1831, -3122, -4504,
-    -5877, -7097, -8002, -8444, -8303, -7536, -6200, -4448, -2468, -444, 1482, 3216,
-    4698, 5891, 6754, 7226, 7212, 6621, 5412, 3629, 1421, -955, -3171, -4903,
-    -5887, -5947, -5034, -3274, -973, 1437, 3487, 4794, 5169, 4659, 3478, 1932,
-    336, -1056, -2119, -2867, -3391, -3794, -4128, -4328, -4226, -3654, -2556, -1020,
-    741, 2457, 3884, 4877, 5392, 5473, 5218, 4726, 4069, 3297, 2450, 1549,
-    597, -426, -1540, -2742, -3976, -5144, -6138, -6847, -7184, -7108, -6618, -5728,
-    -4497, -3044, -1503, 44, 1567, 3055, 4481, 5758, 6705, 7095, 6768, 5684,
-    3953, 1825, -358, -2242, -3549, -4143, -4072, -3539, -2825, -2205, -1869, -1876,
-    -2157, -2571, -2966, -3219, -3280, -3192, -3078, -3074, -3246, -3542, -3789, -3761,
-    -3264, -2223, -704, 1125, 3063, 4916, 6522, 7756, 8502, 8652, 8139, 6969,
-    5229, 3081, 735, -1614, -3825, -5780, -7356, -8439, -8941, -8793, -7985, -6611,
-    -4869, -3014, -1316, -14, 747, 955, 715, 198, -394, -868, -1065, -886,
-    -307, 618, 1802, 3132, 4502, 5828, 7045, 8072, 8799, 9111, 8908, 8123,
-    6744, 4831, 2529, 53, -2335, -4384, -5903, -6754, -6844, -6149, -4760, -2880,
-    -771, 1306, 3136, 4589, 5636, 6313, 6662, 6695, 6416, 5855, 5087, 4205,
-    3276, 2332, 1376, 373, -735, -1967, -3271, -4548, -5701, -6647, -7305, -7587,
-    -7415, -6734, -5546, -3929, -2049, -139, 1564, 2892, 3775, 4227, 4327, 4187,
-    3897, 3504, 3026, 2471, 1841, 1156, 486, -59, -356, -303, 132, 880,
-    1770, 2572, 3041, 2970, 2265, 994, -616, -2261, -3653, -4585, -4986, -4913,
-    -4509, -3941, -3344, -2798, -2311, -1819, -1227, -459, 495, 1586, 2726, 3833,
-    4854, 5760, 6522, 7085, 7362, 7270, 6758, 5830, 4536, 2974, 1265, -503,
-    -2285, -4054, -5762, -7336, -8645, -9518, -9802, -9420, -8386, -6818, -4936, -2988,
-    -1153, 465, 1816, 2893, 3728, 4341, 4710, 4779, 4487, 3811, 2802, 1608,
-    453, -423, -843, -761, -256, 504, 1312, 1958, 2260, 2098, 1445, 374,
-    -957, -2340, -3553, -4436, -4952, -5177, -5220, -5166, -5054, -4846, -4439, -3751,
-    -2773, -1560, -216, 1116, 2279, 3153, 3675, 3855, 3761, 3466, 2991, 2312,
-    1405, 275, -1039, -2459, -3894, -5252, -6436, -7342, -7881, -7975, -7573, -6676,
-    -5369, -3786, -2067, -346, 1260, 2660, 3772, 4514, 4808, 4633, 4042, 3167,
-    2185, 1295, 702, 581, 1030, 2006, 3315, 4636, 5604, 5910, 5388, 4026,
-    1958, -559, -3189, -5595, -7511, -8780, -9360, -9271, -8553, -7271, -5544, -3556,
-    -1517, 386, 2033, 3382, 4433, 5182, 5597, 5641, 5284, 4516, 3398, 2076,
-    750, -379, -1143, -1426, -1203, -546, 410, 1506, 2558, 3373, 3789, 3728,
-    3193, 2225, 899, -665, -2314, -3876, -5149, -5936, -6118, -5695, -4741, -3368,
-    -1725, 28, 1748, 3317, 4630, 5605, 6200, 6415, 6289, 5872, 5190, 4266,
-    3149, 1905, 591, -748, -2070, -3353, -4580, -5706, -6647, -7277, -7461, -7122,
-    -6295, -5107, -3714, -2276, -906, 367, 1571, 2719, 3788, 4727, 5441, 5810,
-    5731, 5158, 4135, 2827, 1490, 382, -322, -551, -333, 227, 991, 1801,
-    2475, 2821, 2682, 1982, 759, -833, -2559, -4168, -5428, -6165, -6324, -5969,
-    -5232, -4257, -3161, -2024, -900, 171, 1161, 2049, 2812, 3434, 3918, 4273,
-    4511, 4649, 4704, 4660, 4465, 4037, 3275, 2125, 634, -1074, -2831, -4429,
-    -5653, -6353, -6462, -5974, -4945, -3500, -1809, -70, 1488, 2678, 3438, 3813,
-    3904, 3829, 3683, 3488, 3212, 2827, 2330, 1747, 1147, 645, 350, 341,
-    637, 1165, 1755, 2183, 2241, 1801, 852, -502, -2081, -3652, -4971, -5855,
-    -6235, -6134, -5633, -4841, -3863, -2762, -1561, -262, 1135, 2601, 4062, 5436,
-    6639, 7586, 8186, 8369, 8094, 7356, 6186, 4654, 2862, 949, -950, -2734,
-    -4337, -5701, -6767, -7464, -7702, -7385, -6473, -5034, -3245, -1358, 363, 1714,
-    2579, 2920, 2747, 2122, 1162, 35, -1058, -1931, -2453, -2565, -2283, -1665,
-    -776, 337, 1600, 2884, 4007, 4774, 5023, 4668, 3722, 2291, 547, -1312,
-    -3106, -4666, -5819, -6436, -6466, -5938, -4941, -3623, -2177, -783, 400, 1230,
-    1605, 1502, 961, 51, -1136, -2472, -3790, -4896, -5576, -5659, -5073, -3879,
-    -2241, -360, 1573, 3402, 4993, 6223, 6976, 7163, 6736, 5702, 4133, 2170,
-    7, -2152, -4130, -5797, -7074, -7933, -8375, -8405, -8029, -7255, -6112, -4663,
-    -3036, -1411, 25, 1125, 1806, 2065, 1963, 1592, 1052, 461, -47, -353,
-    -367, -49, 577, 1430, 2390, 3310, 4023, 4367, 4243, 3641, 2642, 1397,
-    92, -1115, -2119, -2869, -3367, -3650, -3731, -3565, -3101, -2328, -1284, -30,
-    1344, 2749, 4133, 5489, 6802, 8036, 9129, 9979, 10443, 10382, 9721, 8470,
-    6730, 4670, 2474, 292, -1776, -3658, -5292, -6615, -7552, -8013, -7902, -7151,
-    -5753, -3809, -1536, 784, 2907, 4677, 6021, 6917, 7364, 7348, 6832, 5791,
-    4286, 2484, 639, -975, -2130, -2698, -2679, -2174, -1350, -402, 473, 1122,
-    1460, 1490, 1293, 1001, 733, 525, 324, 49, -363, -908, -1494, -1957,
-    -2142, -1959, -1385, -460, 712, 1994, 3267, 4446, 5468, 6292, 6885, 7214,
-    7230, 6883, 6131, 4972, 3474, 1769, 7, -1666, -3128, -4302, -5168, -5735,
-    -5998, -5921, -5447, -4549, -3264, -1721, -103, 1381, 2523, 3145, 3138, 2491,
-    1311, -171, -1626, -2701, -3139, -2854, -1928, -573, 944, 2394, 3630, 4547,
-    5019, 4922, 4190, 2841, 984, -1181, -3422, -5518, -7276, -8527, -9133, -9004,
-    -8123, -6588, -4603, -2405, -201, 1838, 3583, 4963, 5930, 6436, 6419, 5816,
-    4602, 2857, 783, -1346, -3229, -4571, -5143, -4852, -3768, -2117, -261, 1369,
-    2375, 2462, 1512, -357, -2814, -5420, -7737, -9416, -10278, -10312, -9586, -8208,
-    -6352, -4260, -2198, -407, 943, 1797, 2201, 2243, 2015, 1611, 1145, 730,
-    460, 386, 527, 875, 1402, 2048, 2717, 3276, 3567, 3450, 2827, 1677,
-    86, -1732, -3500, -4954, -5904, -6259, -6025, -5268, -4083, -2608, -1006, 599,
-    2138, 3575, 4872, 5982, 6842, 7382, 7567, 7376, 6783, 5769, 4382, 2750,
-    1061, -500, -1817, -2884, -3741, -4414, -4878, -5079, -4963, -4505, -3711, -2623,
-    -1345, -48, 1048, 1735, 1871, 1436, 567, -478, -1379, -1829, -1647, -833,
-    464, 2038, 3676, 5202, 6480, 7387, 7788, 7587, 6754, 5332, 3422, 1190,
-    -1156, -3388, -5293, -6705, -7530, -7727, -7274, -6198, -4615, -2723, -751, 1090,
-    2659, 3912, 4862, 5517, 5863, 5858, 5453, 4625, 3413, 1954, 475, -749,
-    -1465, -1518, -898, 266, 1747, 3266, 4527, 5258, 5292, 4620, 3395, 1874,
-    343, -954, -1879, -2411, -2620, -2636, -2595, -2572, -2558, -2485, -2272, -1856,
-    -1194, -267, 896, 2198, 3488, 4598, 5391, 5794, 5787, 5357, 4496, 3214,
-    1570, -321, -2294, -4179, -5855, -7249, -8281, -8840, -8809, -8119, -6813, -5056,
-    -3090, -1173, 474, 1703, 2455, 2740, 2604, 2132, 1461, 754, 152, -238,
-    -358, -178, 314, 1113, 2159, 3320, 4408, 5226, 5613, 5461, 4711, 3378,
-    1575, -506, -2650, -4664, -6404, -7797, -8810, -9387, -9435, -8879, -7718, -6049,
-    -4078, -2078, -296, 1123, 2144, 2817, 3213, 3377, 3312, 3041, 2654, 2298,
-    2135, 2266, 2690, 3308, 3970, 4502, 4712, 4430, 3549, 2078, 166, -1936,
-    -3971, -5736, -7087, -7915, -8138, -7725, -6704, -5181, -3328, -1341, 603, 2380,
-    3913, 5126, 5917, 6168, 5790, 4772, 3235, 1443, -252, -1502, -2047, -1795,
-    -859, 484, 1875, 2938, 3362, 2988, 1849, 140, -1843, -3767, -5323, -6286,
-    -6558, -6154, -5184, -3826, -2289, -747, 687, 1963, 3075, 4035, 4817, 5324,
-    5437, 5072, 4237, 3045, 1708, 466, -456, -885, -747, -113, 817, 1785,
-    2540, 2913, 2869, 2480, 1855, 1109, 350, -344, -908, -1271, -1364, -1138,
-    -558, 376, 1592, 2973, 4406, 5785, 7012, 8021, 8759, 9137, 9053, 8436,
-    7249, 5498, 3279, 804, -1664, -3848, -5505, -6476, -6696, -6141, -4851, -2993,
-    -826, 1382, 3406, 5098, 6415, 7385, 8029, 8334, 8254, 7726, 6709, 5239,
-    3432, 1465, -451, -2102, -3344, -4109, -4364, -4091, -3305, -2088, -596, 954,
-    2321, 3286, 3667, 3352, 2342, 757, -1173, -3149, -4859, -6049, -6545, -6249,
-    -5188, -3524, -1509, 590, 2564, 4274, 5646, 6612, 7099, 7050, 6448, 5323,
-    3765, 1910, -92, -2092, -3943, -5533, -6811, -7763, -8372, -8603, -8402, -7726,
-    -6609, -5185, -3627, -2099, -752, 285, 947, 1236, 1197, 905, 459, -46,
-    -530, -925, -1183, -1291, -1262, -1150, -1040, -1027, -1187, -1562, -2147, -2869,
-    -3602, -4228, -4663, -4859, -4800, -4512, -4041, -3422, -2683, -1851, -967, -87,
-    712, 1354, 1792, 2016, 2074, 2042, 1986, 1920, 1824, 1684, 1498, 1290,
-    1126, 1104, 1281, 1635, 2070, 2419, 2473, 2051, 1086, -367, -2163, -4091,
-    -5894, -7323, -8197, -8425, -7996, -6971, -5474, -3670, -1744, 134, 1859, 3416,
-    4834, 6111, 7155, 7802, 7868, 7231, 5891, 4000, 1833, -281, -2023, -3157,
-    -3569, -3296, -2516, -1494, -506, 219, 511, 275, -464, -1542, -2711, -3708,
-    -4310, -4395, -3963, -3105, -1957, -673, 600, 1750, 2702, 3400, 3810, 3921,
-    3762, 3425, 3059, 2820, 2809, 3068, 3594, 4328, 5138, 5825, 6159, 5940,
-    5062, 3559, 1584, -639, -2880, -4926, -6583, -7669, -8044, -7646, -6504, -4751,
-    -2603, -331, 1790, 3522, 4707, 5284, 5282, 4780, 3884, 2738, 1565, 653,
-    261, 519, 1366, 2556, 3719, 4468, 4521, 3770, 2288, 289, -1941, -4123,
-    -6043, -7556, -8566, -9006, -8837, -8062, -6754, -5068, -3209, -1380, 271, 1676,
-    2833, 3759, 4475, 4972, 5193, 5044, 4468, 3499, 2252, 904, -349, -1363,
-    -2094, -2576, -2882, -3101, -3300, -3486, -3608, -3606, -3456, -3199, -2945, -2837,
-    -2970, -3365, -3973, -4695, -5390, -5892, -6047, -5731, -4889, -3560, -1867, 19,
-    1924, 3685, 5163, 6232, 6764, 6644, 5811, 4304, 2259, -119, -2574, -4840,
-    -6686, -7937, -8476, -8242, -7254, -5633, -3612, -1514, 340, 1722, 2513, 2696,
-    2348, 1624, 715, -174, -840, -1125, -944, -285, 783, 2097, 3455, 4699,
-    5730, 6479, 6910, 7020, 6794, 6193, 5184, 3788, 2087, 198, -1760, -3679,
-    -5447, -6927, -7972, -8440, -8211, -7238, -5582, -3408, -965, 1450, 3563, 5187,
-    6211, 6572, 6266, 5368, 4010, 2391, 788, -475, -1112, -966, -91, 1265,
-    2719, 3869, 4385, 4089, 2986, 1214, -1002, -3377, -5600, -7387, -8512, -8809,
-    -8202, -6754, -4656, -2186, 342, 2639, 4483, 5731, 6298, 6127, 5196, 3573,
-    1465, -782, -2736, -3971, -4172, -3262, -1422, 957, 3369, 5323, 6448, 6572,
-    5713, 4041, 1845, -503, -2588, -4015, -4520, -4031, -2682, -772, 1279, 3015,
-    4046, 4127, 3210, 1443, -844, -3213, -5217, -6500, -6852, -6236, -4785, -2753,
-    -434, 1890, 3966, 5589, 6623, 6972, 6559, 5363, 3473, 1075, -1567, -4131,
-    -6267, -7686, -8229, -7886, -6780, -5134, -3222, -1318, 344, 1606, 2378, 2648,
-    2488, 2046, 1505, 1077, 976, 1346, 2201, 3436, 4876, 6311, 7547, 8439,
-    8882, 8798, 8170, 7044, 5510, 3686, 1713, -271, -2144, -3771, -5007, -5734,
-    -5879, -5404, -4347, -2842, -1101, 626, 2080, 3061, 3496, 3441, 3019, 2377,
-    1677, 1066, 659, 535, 723, 1185, 1831, 2540, 3156, 3496, 3394, 2755,
-    1584, -14, -1856, -3728, -5411, -6697, -7425, -7509, -6933, -5754, -4110, -2200,
-    -220, 1668, 3337, 4698, 5690, 6274, 6427, 6137, 5394, 4216, 2699, 1005,
-    -691, -2215, -3409, -4172, -4510, -4493, -4225, -3822, -3360, -2851, -2291, -1716,
-    -1171, -698, -366, -250, -368, -666, -1039, -1318, -1314, -910, -98, 1030,
-    2302, 3493, 4397, 4873, 4858, 4365, 3493, 2375, 1133, -156, -1448, -2709,
-    -3884, -4904, -5708, -6225, -6363, -6033, -5198, -3897, -2281, -568, 1035, 2370,
-    3323, 3830, 3886, 3525, 2815, 1894, 960, 216, -172, -86, 487, 1428,
-    2513, 3473, 4039, 4017, 3328, 2009, 185, -1939, -4096, -6020, -7484, -8319,
-    -8416, -7746, -6368, -4420, -2114, 279, 2473, 4220, 5340, 5704, 5247, 3999,
-    2109, -163, -2462, -4380, -5542, -5698, -4798, -3026, -780, 1425, 3106, 3913,
-    3682, 2458, 474, -1911, -4267, -6152, -7209, -7246, -6256, -4402, -1983, 649,
-    3152, 5232, 6670, 7348, 7240, 6379, 4875, 2941, 877, -976, -2310, -2948,
-    -2932, -2489, -1944, -1625, -1772, -2454, -3558, -4835, -5967, -6659, -6726, -6120,
-    -4900, -3202, -1212, 871, 2859, 4580, 5861, 6559, 6574, 5880, 4527, 2671,
-    585, -1385, -2911, -3778, -3929, -3485, -2709, -1917, -1387, -1288, -1629, -2283,
-    -3057, -3736, -4134, -4122, -3650, -2733, -1440, 113, 1807, 3530, 5155, 6541,
-    7563, 8099, 8030, 7313, 6016, 4297, 2384, 555, -944, -1982, -2546, -2714,
-    -2623, -2421, -2226, -2124, -2149, -2275, -2442, -2568, -2541, -2254, -1656, -731,
-    517, 2035, 3715, 5429, 7055, 8473, 9574, 10260, 10421, 9948, 8789, 6981,
-    4655, 2057, -493, -2672, -4244, -5092, -5219, -4730, -3790, -2589, -1328, -221,
-    533, 798, 549, -119, -999, -1816, -2287, -2203, -1479, -164, 1564, 3446,
-    5225, 6717, 7811, 8448, 8598, 8251, 7410, 6111, 4453, 2591, 680, -1141,
-    -2731, -3967, -4793, -5208, -5240, -4946, -4415, -3730, -2955, -2153, -1378, -671,
-    -84, 324, 497, 413, 100, -331, -704, -843, -626, -1, 982, 2187,
-    3444, 4586, 5446, 5881, 5803, 5185, 4048, 2463, 540, -1584, -3735, -5719,
-    -7334, -8395, -8755, -8327, -7113, -5234, -2924, -486, 1754, 3506, 4571, 4879,
-    4461, 3432, 1973, 319, -1265, -2493, -3113, -3000, -2203, -930, 473, 1593,
-    2079, 1743, 588, -1197, -3299, -5377, -7129, -8302, -8718, -8305, -7106, -5273,
-    -3055, -738, 1415, 3206, 4513, 5282, 5489, 5117, 4185, 2777, 1060, -710,
-    -2225, -3208, -3503, -3130, -2323, -1459, -909, -908, -1510, -2584, -3859, -5014,
-    -5768, -5939, -5476, -4435, -2940, -1142, 780, 2643, 4267, 5497, 6202, 6289,
-    5721, 4550, 2910, 973, -1060, -2952, -4494, -5562, -6116, -6186, -5897, -5424,
-    -4927, -4520, -4238, -4004, -3676, -3143, -2355, -1286, 58, 1626, 3324, 4988,
-    6356, 7138, 7111, 6178, 4390, 1953, -826, -3596, -6019, -7811, -8789, -8905,
-    -8228, -6929, -5252, -3476, -1860, -604, 193, 557, 640, 658, 813, 1246,
-    2033, 3160, 4511, 5903, 7140, 8044, 8463, 8282, 7434, 5941, 3933, 1620,
-    -757, -2965, -4816, -6216, -7120, -7482, -7265, -6476, -5189, -3550, -1768, -72,
-    1353, 2407, 3098, 3515, 3794, 4061, 4400, 4832, 5334, 5824, 6154, 6140,
-    5629, 4561, 2978, 1038, -1044, -3059, -4822, -6162, -6958, -7169, -6813, -5965,
-    -4763, -3363, -1899, -494, 728, 1681, 2334, 2692, 2800, 2748, 2645, 2598,
-    2697, 2989, 3470, 4095, 4771, 5387, 5838, 6012, 5771, 5016, 3757, 2066,
-    56, -2094, -4169, -5985, -7389, -8239, -8447, -8005, -6948, -5340, -3324, -1119,
-    1035, 2933, 4442, 5514, 6168, 6437, 6321, 5806, 4917, 3758, 2518, 1425,
-    671, 332, 339, 510, 606, 401, -223, -1254, -2578, -4009, -5332, -6356,
-    -6943, -7013, -6558, -5647, -4379, -2854, -1180, 542, 2237, 3835, 5251, 6391,
-    7125, 7286, 6763, 5582, 3890, 1922, -26, -1688, -2897, -3585, -3775, -3592,
-    -3236, -2917, -2804, -2986, -3453, -4107, -4798, -5360, -5642, -5531, -4966, -3957,
-    -2586, -969, 784, 2558, 4222, 5642, 6676, 7179, 7035, 6198, 4693, 2646,
-    311, -1970, -3862, -5116, -5615, -5385, -4593, -3507, -2433, -1631, -1251, -1314,
-    -1698, -2175, -2490, -2438, -1904, -870, 601, 2384, 4293, 6098, 7580, 8571,
-    8947, 8631, 7631, 6061, 4136, 2177, 532, -547, -995, -938, -638, -421,
-    -568, -1226, -2365, -3796, -5226, -6332, -6835, -6589, -5613, -4039, -2072, 31,
-    2029, 3747, 5050, 5830, 6034, 5686, 4856, 3705, 2501, 1546, 1039, 986,
-    1188, 1320, 1080, 296, -1048, -2783, -4595, -6136, -7114, -7306, -6615, -5135,
-    -3117, -866, 1314, 3174, 4569, 5450, 5799, 5626, 4996, 4047, 2993, 2103,
-    1619, 1667, 2213, 3083, 4002, 4674, 4854, 4392, 3252, 1540, -520, -2644,
-    -4571, -6089, -7048, -7361, -7016, -6062, -4638, -2978, -1370, -73, 733, 984,
-    753, 233, -331, -704, -728, -358, 362, 1335, 2410, 3403, 4155, 4538,
-    4452, 3861, 2818, 1399, -276, -1990, -3454, -4405, -4647, -4086, -2795, -981,
-    1096, 3142, 4828, 5869, 6092, 5442, 4013, 2032, -214, -2435, -4319, -5550,
-    -5901, -5280, -3753, -1572, 848, 3036, 4573, 5146, 4621, 3088, 833, -1765,
-    -4319, -6470, -7938, -8561, -8301, -7222, -5483, -3310, -942, 1403, 3525, 5253,
-    6463, 7078, 7062, 6433, 5258, 3642, 1753, -182, -1933, -3304, -4167, -4505,
-    -4399, -3972, -3362, -2729, -2205, -1858, -1718, -1791, -2044, -2394, -2728, -2904,
-    -2776, -2249, -1310, -5, 1564, 3249, 4871, 6230, 7128, 7408, 6990, 5885,
-    4199, 2125, -95, -2206, -3967, -5191, -5782, -5738, -5133, -4089, -2769, -1376,
-    -128, 795, 1284, 1326, 1025, 606, 350, 506, 1210, 2433, 3983, 5565,
-    6866, 7613, 7624, 6841, 5310, 3189, 744, -1723, -3946, -5697, -6799, -7163,
-    -6789, -5753, -4227, -2475, -783, 607, 1532, 1945, 1937, 1703, 1491, 1544,
-    2018, 2910, 4085, 5323, 6368, 6966, 6930, 6172, 4728, 2762, 531, -1690,
-    -3660, -5195, -6167, -6526, -6290, -5554, -4479, -3307, -2313, -1695, -1492, -1587,
-    -1746, -1677, -1131, -9, 1607, 3508, 5399, 6963, 7919, 8069, 7328, 5745,
-    3506, 909, -1692, -3964, -5655, -6613, -6802, -6308, -5313, -4043, -2754, -1703,
-    -1072, -913, -1132, -1508, -1744, -1587, -911, 281, 1854, 3575, 5189, 6487,
-    7314, 7571, 7227, 6320, 4980, 3451, 2068, 1144, 862, 1198, 1915, 2632,
-    2966, 2653, 1626, 5, -1948, -3896, -5493, -6446, -6574, -5840, -4361, -2368,
-    -152, 2009, 3891, 5352, 6334, 6799, 6698, 5994, 4726, 3038, 1174, -572,
-    -1940, -2754, -2955, -2606, -1879, -1014, -252, 223, 326, 74, -430, -1032,
-    -1540, -1758, -1534, -816, 319, 1700, 3136, 4474, 5616, 6504, 7080, 7265,
-    6999, 6291, 5219, 3900, 2484, 1133, 6, -768, -1132, -1133, -902, -597,
-    -357, -288, -457, -894, -1567, -2386, -3209, -3889, -4287, -4294, -3845, -2930,
-    -1598, 19, 1713, 3271, 4527, 5369, 5723, 5545, 4789, 3451, 1638, -430,
-    -2485, -4285, -5659, -6526, -6860, -6649, -5917, -4768, -3387, -2012, -894, -228,
-    -92, -420, -1035, -1691, -2139, -2182, -1714, -739, 627, 2201, 3767, 5108,
-    6051, 6495, 6414, 5834, 4822, 3475, 1914, 283, -1240, -2489, -3360, -3855,
-    -4056, -4075, -4019, -3977, -4032, -4238, -4620, -5140, -5680, -6068, -6138, -5784,
-    -4961, -3707, -2141, -418, 1305, 2850, 4027, 4683, 4722, 4102, 2860, 1168,
-    -669, -2304, -3435, -3864, -3581, -2790, -1829, -1067, -806, -1215, -2254, -3688,
-    -5186, -6410, -7075, -7009, -6189, -4725, -2828, -767, 1183, 2805, 3951, 4536,
-    4531, 3982, 3042, 1968, 1076, 636, 779, 1424, 2272, 2906, 2945, 2179,
-    623, -1483, -3737, -5693, -6994, -7438, -6983, -5723, -3879, -1753, 344, 2136,
-    3420, 4102, 4228, 3951, 3478, 3039, 2813, 2862, 3106, 3374, 3455, 3143,
-    2305, 935, -846, -2798, -4575, -5814, -6262, -5842, -4646, -2888, -851, 1179,
-    2948, 4240, 4903, 4887, 4271, 3256, 2150, 1301, 1003, 1391, 2394, 3737,
-    5022, 5881, 6080, 5533, 4277, 2460, 315, -1868, -3766, -5093, -5675, -5491,
-    -4620, -3217, -1512, 205, 1623, 2477, 2634, 2152, 1256, 252, -567, -999,
-    -960, -496, 233, 996, 1560, 1750, 1485, 777, -261, -1421, -2458, -3128,
-    -3251, -2768, -1759, -402, 1085, 2451, 3440, 3839, 3518, 2474, 858, -1040,
-    -2868, -4288, -5020, -4894, -3902, -2208, -93, 2106, 4065, 5516, 6264, 6185,
-    5240, 3511, 1206, -1384, -3921, -6071, -7569, -8264, -8126, -7237, -5777, -3994,
-    -2131, -400, 1012, 1964, 2416, 2435, 2165, 1792, 1496, 1409, 1603, 2099,
-    2843, 3683, 4398, 4761, 4604, 3851, 2534, 766, -1279, -3375, -5269, -6726,
-    -7568, -7698, -7126, -5958, -4360, -2546, -743, 870, 2196, 3190, 3850, 4214,
-    4339, 4281, 4113, 3920, 3757, 3657, 3667, 3838, 4171, 4592, 4950, 5040,
-    4694, 3854, 2547, 861, -1052, -3000, -4788, -6234, -7176, -7505, -7172, -6185,
-    -4642, -2767, -854, 809, 2007, 2652, 2794, 2566, 2140, 1725, 1529, 1674,
-    2163, 2875, 3586, 4020, 3958, 3286, 1989, 170, -1943, -4038, -5803, -6997,
-    -7480, -7213, -6227, -4634, -2662, -642, 1060, 2142, 2456, 2041, 1105, -43,
-    -1034, -1517, -1266, -246, 1376, 3261, 4989, 6190, 6640, 6262, 5105, 3337,
-    1227, -905, -2731, -3977, -4470, -4214, -3418, -2454, -1737, -1591, -2151, -3286,
-    -4649, -5815, -6439, -6306, -5365, -3733, -1655, 573, 2637, 4247, 5183, 5315,
-    4599, 3090, 983, -1413, -3716, -5537, -6568, -6667, -5905, -4535, -2933, -1499,
-    -563, -305, -704, -1526, -2404, -2954, -2887, -2102, -720, 996, 2763, 4339,
-    5530, 6202, 6289, 5792, 4809, 3556, 2300, 1275, 626, 366, 347, 344,
-    155, -341, -1156, -2178, -3207, -4040, -4513, -4515, -4007, -3043, -1769, -407,
-    805, 1713, 2277, 2529, 2512, 2280, 1911, 1520, 1260, 1275, 1619, 2244,
-    3018, 3768, 4308, 4456, 4062, 3059, 1511, -382, -2341, -4073, -5344, -6027,
-    -6083, -5528, -4440, -2965, -1287, 405, 1920, 3096, 3831, 4080, 3855, 3239,
-    2375, 1434, 604, 74, -7, 394, 1167, 2067, 2814, 3207, 3182, 2778,
-    2080, 1168, 82, -1156, -2480, -3766, -4861, -5627, -5966, -5851, -5327, -4482,
-    -3454, -2433, -1628, -1188, -1144, -1387, -1696, -1819, -1570, -886, 176, 1478,
-    2847, 4107, 5088, 5624, 5595, 4962, 3785, 2193, 364, -1496, -3174, -4487,
-    -5306, -5560, -5255, -4473, -3352, -2066, -821, 189, 837, 1102, 1045, 792,
-    514, 391, 563, 1109, 2009, 3133, 4260, 5143, 5566, 5390, 4587, 3226,
-    1451, -538, -2508, -4246, -5582, -6398, -6636, -6294, -5408, -4064, -2424, -714,
-    836, 2034, 2751, 2964, 2788, 2436, 2137, 2066, 2280, 2672, 3010, 3027,
-    2531, 1467, -69, -1837, -3514, -4775, -5371, -5186, -4257, -2762, -959, 883,
-    2515, 3721, 4312, 4164, 3270, 1801, 119, -1319, -2088, -1927, -805, 1069,
-    3316, 5481, 7138, 7985, 7912, 6996, 5454, 3596, 1774, 311, -563, -775,
-    -455, 72, 392, 161, -766, -2284, -4085, -5760, -6919, -7266, -6668, -5202,
-    -3127, -796, 1445, 3317, 4613, 5170, 4894, 3823, 2194, 414, -1038, -1772,
-    -1619, -686, 685, 2023, 2849, 2804, 1762, -123, -2443, -4649, -6232, -6862,
-    -6448, -5112, -3148, -953, 1071, 2598, 3439, 3570, 3113, 2302, 1438, 840,
-    760, 1297, 2343, 3606, 4691, 5246, 5060, 4106, 2515, 528, -1567, -3494,
-    -5017, -5980, -6312, -6032, -5233, -4091, -2840, -1722, -932, -571, -613, -908,
-    -1232, -1366, -1166, -614, 184, 1034, 1722, 2070, 1986, 1475, 622, -423,
-    -1445, -2208, -2519, -2298, -1607, -616, 471, 1471, 2219, 2566, 2399, 1676,
-    451, -1118, -2808, -4392, -5683, -6527, -6807, -6461, -5510, -4076, -2377, -662,
-    853, 2029, 2806, 3186, 3207, 2918, 2404, 1819, 1352, 1169, 1373, 1961,
-    2806, 3683, 4340, 4557, 4180, 3161, 1567, -433, -2593, -4634, -6310, -7457,
-    -7980, -7833, -7015, -5621, -3852, -1987, -324, 876, 1453, 1404, 862, 63,
-    -705, -1161, -1112, -492, 651, 2175, 3859, 5438, 6634, 7188, 6920, 5794,
-    3935, 1569, -1022, -3541, -5714, -7305, -8121, -8046, -7108, -5477, -3410, -1178,
-    956, 2749, 3991, 4542, 4387, 3684, 2736, 1902, 1492, 1679, 2444, 3596,
-    4847, 5892, 6444, 6294, 5348, 3657, 1423, -1046, -3397, -5296, -6461, -6695,
-    -5928, -4260, -1977, 473, 2555, 3796, 3925, 2939, 1110, -1082, -3084, -4396,
-    -4687, -3864, -2107, 188, 2551, 4582, 6019, 6713, 6586, 5611, 3875, 1642,
-    -639, -2430, -3282, -2996, -1693, 256, 2348, 4083, 5049, 4993, 3866, 1858,
-    -629, -3076, -4998, -6049, -6099, -5253, -3805, -2140, -624, 477, 1051, 1165,
-    1025, 900, 1036, 1589, 2591, 3928, 5360, 6568, 7252, 7225, 6449, 5019,
-    3131, 1034, -999, -2716, -3922, -4527, -4581, -4274, -3874, -3635, -3695, -4033,
-    -4487, -4830, -4854, -4437, -3558, -2293, -788, 769, 2190, 3317, 4051, 4371,
-    4327, 4012, 3544, 3059, 2687, 2507, 2504, 2557, 2450, 1942, 883, -681,
-    -2508, -4233, -5486, -5987, -5602, -4356, -2425, -105, 2245, 4278, 5689, 6257,
-    5886, 4646, 2760, 592, -1410, -2791, -3212, -2555, -983, 1098, 3147, 4642,
-    5209, 4696, 3180, 926, -1690, -4228, -6259, -7437, -7569, -6648, -4860, -2543,
-    -109, 2042, 3584, 4296, 4092, 3042, 1378, -529, -2237, -3329, -3521, -2736,
-    -1135, 923, 2971, 4567, 5398, 5319, 4347, 2637, 455, -1865, -3970, -5524,
-    -6254, -6017, -4839, -2916, -596, 1699, 3569, 4707, 4929, 4190, 2599, 397,
-    -2051, -4295, -5910, -6625, -6401, -5385, -3838, -2028, -166, 1593, 3101, 4215,
-    4847, 4978, 4663, 4035, 3279, 2587, 2129, 2033, 2334, 2943, 3655, 4209,
-    4355, 3919, 2837, 1171, -905, -3115, -5136, -6686, -7581, -7742, -7181, -6001,
-    -4389, -2588, -853, 613, 1700, 2393, 2757, 2871, 2797, 2583, 2306, 2088,
-    2069, 2341, 2865, 3457, 3855, 3815, 3186, 1942, 192, -1853, -3932, -5774,
-    -7126, -7773, -7604, -6646, -5065, -3101, -1006, 998, 2724, 4018, 4768, 4936,
-    4591, 3897, 3057, 2257, 1620, 1190, 938, 773, 550, 96, -726, -1947,
-    -3445, -4967, -6209, -6930, -7021, -6493, -5434, -3980, -2305, -608, 898, 2032,
-    2709, 2962, 2917, 2742, 2604, 2630, 2843, 3167, 3436, 3429, 2939, 1866,
-    274, -1641, -3592, -5261, -6348, -6617, -5939, -4357, -2137, 281, 2391, 3758,
-    4118, 3434, 1891, -160, -2275, -4003, -5002, -5141, -4518, -3403, -2142, -1039,
-    -270, 150, 331, 477, 815, 1500, 2547, 3838, 5145, 6193, 6725, 6580,
-    5720, 4234, 2332, 285, -1655, -3298, -4514, -5219, -5379, -5035, -4336, -3535,
-    -2921, -2703, -2916, -3409, -3905, -4097, -3751, -2777, -1268, 524, 2285, 3726,
-    4658, 5015, 4821, 4152, 3144, 2041, 1160, 786, 1048, 1843, 2863, 3710,
-    4049, 3679, 2558, 802, -1335, -3520, -5407, -6708, -7254, -7015, -6060, -4529,
-    -2625, -626, 1145, 2402, 2998, 2973, 2511, 1850, 1217, 794, 702, 997,
-    1648, 2513, 3355, 3913, 3958, 3358, 2127, 432, -1484, -3364, -4971, -6130,
-    -6758, -6839, -6384, -5430, -4070, -2465, -832, 593, 1605, 2079, 1997, 1454,
-    626, -282, -1085, -1635, -1852, -1731, -1333, -761, -155, 354, 687, 833,
-    835, 763, 714, 784, 1062, 1620, 2486, 3595, 4773, 5788, 6419, 6494,
-    5914, 4656, 2787, 483, -1961, -4170, -5774, -6506, -6261, -5096, -3204, -851,
-    1673, 4075, 6084, 7486, 8157, 8064, 7265, 5901, 4170, 2310, 584, -777,
-    -1649, -2052, -2117, -2038, -2034, -2273, -2805, -3564, -4399, -5110, -5505, -5457,
-    -4921, -3924, -2541, -896, 849, 2517, 3935, 4948, 5440, 5343, 4655, 3460,
-    1953, 441, -713, -1209, -940, -33, 1219, 2456, 3359, 3719, 3469, 2669,
-    1472, 112, -1129, -1958, -2160, -1665, -576, 858, 2313, 3490, 4188, 4344,
-    4005, 3297, 2407, 1557, 971, 817, 1152, 1875, 2730, 3375, 3487, 2859,
-    1457, -564, -2895, -5136, -6886, -7841, -7859, -6974, -5368, -3340, -1249, 564,
-    1826, 2399, 2325, 1836, 1265, 947, 1138, 1944, 3273, 4842, 6263, 7131,
-    7129, 6134, 4259, 1796, -869, -3338, -5262, -6404, -6645, -6015, -4712, -3074,
-    -1473, -203, 598, 963, 1061, 1130, 1394, 1981, 2870, 3880, 4720, 5077,
-    4720, 3607, 1918, -27, -1853, -3212, -3838, -3611, -2586, -990, 813, 2414,
-    3466, 3762, 3284, 2214, 871, -378, -1199, -1369, -852, 188, 1439, 2515,
-    3055, 2817, 1749, 1, -2113, -4201, -5909, -7011, -7422, -7164, -6328, -5055,
-    -3544, -2053, -835, -42, 320, 387, 372, 493, 876, 1518, 2312, 3087,
-    3659, 3862, 3579, 2764, 1466, -176, -1937, -3518, -4597, -4933, -4439, -3209,
-    -1496, 345, 1959, 3060, 3448, 3025, 1826, 47, -1978, -3815, -5033, -5335,
-    -4639, -3086, -986, 1272, 3328, 4915, 5831, 5937, 5183, 3648, 1538, -843,
-    -3136, -5009, -6224, -6668, -6353, -5407, -4042, -2521, -1107, -22, 597, 729,
-    482, 79, -214, -181, 273, 1123, 2260, 3533, 4770, 5786, 6392, 6422,
-    5791, 4549, 2856, 925, -1038, -2854, -4359, -5402, -5866, -5739, -5130, -4217,
-    -3174, -2152, -1272, -606, -165, 91, 268, 519, 969, 1668, 2584, 3615,
-    4602, 5369, 5769, 5699, 5124, 4092, 2749, 1294, -65, -1167, -1935, -2367,
-    -2515, -2469, -2328, -2175, -2073, -2070, -2188, -2381, -2548, -2582, -2426, -2094,
-    -1638, -1125, -622, -206, 51, 101, -50, -332, -613, -743, -617, -198,
-    488, 1363, 2304, 3167, 3821, 4171, 4155, 3724, 2861, 1617, 142, -1326,
-    -2516, -3216, -3354, -3016, -2397, -1774, -1455, -1673, -2483, -3721, -5059, -6109,
-    -6559, -6265, -5252, -3668, -1746, 241, 2020, 3344, 4048, 4106, 3619, 2765,
-    1773, 928, 495, 600, 1166, 1905, 2414, 2354, 1599, 247, -1459, -3212,
-    -4711, -5741, -6198, -6076, -5460, -4511, -3418, -2348, -1441, -766, -280, 161,
-    729, 1537, 2586, 3737, 4767, 5444, 5592, 5135, 4140, 2807, 1410, 231,
-    -507, -740, -614, -395, -361, -735, -1620, -2938, -4434, -5779, -6679, -6940,
-    -6510, -5473, -3999, -2296, -593, 890, 1992, 2655, 2923, 2921, 2795, 2669,
-    2641, 2774, 3058, 3405, 3668, 3683, 3294, 2406, 1023, -710, -2508, -4026,
-    -4972, -5210, -4787, -3869, -2662, -1351, -93, 977, 1761, 2243, 2503, 2692,
-    2971, 3434, 4084, 4868, 5731, 6594, 7318, 7713, 7606, 6895, 5574, 3724,
-    1503, -875, -3170, -5156, -6647, -7485, -7508, -6579, -4668, -1944, 1210, 4258,
-    6643, 7922, 7860, 6444, 3885, 587, -2906, -6016, -8271, -9418, -9437, -8470,
-    -6728, -4469, -1974, 496, 2773, 4794, 6543, 7974, 8959, 9315, 8915, 7787,
-    6090, 4027, 1796, -413, -2424, -4084, -5279, -5956, -6124, -5817, -5069, -3927,
-    -2490, -947, 425, 1339, 1593, 1126, 29, -1448, -2938, -4057, -4527, -4224,
-    -3176, -1532, 497, 2674, 4755, 6524, 7831, 8584, 8730, 8260, 7213, 5668,
-    3737, 1571, -657, -2738, -4400, -5336, -5304, -4241, -2344, -71, 1995, 3353,
-    3692, 2921, 1158, -1283, -3977, -6448, -8246, -9054, -8757, -7400, -5142, -2260,
-    886, 3929, 6527, 8377, 9281, 9163, 8043, 6031, 3353, 321, -2695, -5251,
-    -6878, -7233, -6202, -3926, -829, 2435, 5188, 6916, 7346, 6471, 4545, 1973,
-    -814, -3438, -5653, -7405, -8776, -9846, -10608, -10984, -10857, -10143, -8864, -7142,
-    -5153, -3088, -1085, 807, 2570, 4107, 5229, 5724, 5427, 4327, 2666, 903,
-    -442, -946, -407, 1061, 3045, 4981, 6337, 6768, 6208, 4850, 3013, 1002,
-    -923, -2547, -3708, -4319, -4399, -4086, -3581, -3058, -2604, -2210, -1813, -1353,
-    -818, -238, 312, 702, 795, 519, -102, -964, -1898, -2690, -3111, -2965,
-    -2155, -750, 987, 2646, 3784, 4047, 3272, 1526, -920, -3635, -6113, -7898,
-    -8706, -8466, -7294, -5439, -3200, -860, 1341, 3221, 4679, 5704, 6334, 6618,
-    6587, 6258, 5683, 4975, 4277, 3684, 3188, 2702, 2118, 1370, 448, -599,
-    -1651, -2529, -3057, -3137, -2787, -2142, -1414, -802, -418, -267, -274, -299,
-    -173, 264, 1129, 2446, 4089, 5788, 7228, 8137, 8322, 7697, 6280, 4198,
-    1688, -931, -3315, -5167, -6269, -6501, -5829, -4296, -2070, 517, 3004, 4908,
-    5830, 5547, 4088, 1709, -1191, -4151, -6719, -8544, -9431, -9317, -8249, -6381,
-    -3945, -1218, 1485, 3842, 5608, 6630, 6811, 6101, 4545, 2316, -267, -2762,
-    -4733, -5881, -6094, -5418, -4037, -2233, -331, 1340, 2498, 3003, 2897, 2324,
-    1449, 431, -574, -1406, -1896, -1894, -1348, -354, 876, 2097, 3109, 3797,
-    4116, 4071, 3706, 3112, 2411, 1721, 1104, 543, -32, -663, -1313, -1862,
-    -2131, -1959, -1286, -168, 1279, 2922, 4604, 6166, 7449, 8290, 8537, 8109,
-    7039, 5467, 3612, 1723, 21, -1332, -2225, -2585, -2380, -1678, -707, 154,
-    479, -37, -1442, -3496, -5776, -7828, -9279, -9884, -9544, -8285, -6224, -3569,
-    -633, 2212, 4599, 6224, 6895, 6578, 5403, 3640, 1666, -102, -1321, -1792,
-    -1494, -585, 641, 1883, 2923, 3630, 3949, 3922, 3645, 3201, 2646, 1996,
-    1189, 133, -1204, -2758, -4417, -6022, -7368, -8226, -8357, -7555, -5763, -3208,
-    -400, 2004, 3374, 3301, 1722, -1060, -4462, -7776, -10357, -11805, -12035, -11209,
-    -9623, -7585, -5347, -3103, -1032, 723, 2112, 3180, 4017, 4731, 5420, 6129,
-    6816, 7384, 7720, 7706, 7247, 6342, 5101, 3710, 2402, 1398, 822, 632,
-    659, 662, 386, -345, -1534, -3028, -4586, -5911, -6668, -6583, -5546, -3635,
-    -1117, 1602, 4092, 5977, 6945, 6782, 5469, 3218, 406, -2508, -5102, -7109,
-    -8425, -8996, -8777, -7787, -6156, -4129, -2041, -249, 990, 1577, 1550, 1069,
-    389, -217, -532, -422, 154, 1131, 2359, 3643, 4760, 5505, 5757, 5529,
-    4954, 4237, 3586, 3151, 3002, 3135, 3474, 3893, 4254, 4460, 4486, 4385,
-    4238, 4102, 4010, 3988, 4032, 4066, 3927, 3427, 2428, 930, -930, -2948,
-    -4931, -6732, -8219, -9251, -9697, -9465, -8540, -7022, -5107, -3018, -961, 820,
-    2024, 2393, 1846, 520, -1255, -3029, -4358, -4934, -4607, -3377, -1415, 965,
-    3387, 5478, 6887, 7339, 6708, 5040, 2563, -310, -3040, -5096, -6077, -5805,
-    -4382, -2131, 537, 3236, 5672, 7666, 9101, 9845, 9757, 8790, 7040, 4754,
-    2316, 143, -1476, -2442, -2794, -2673, -2308, -1964, -1858, -2108, -2697, -3484,
-    -4286, -4939, -5308, -5289, -4850, -4054, -3049, -2007, -1045, -184, 610, 1370,
-    2104, 2830, 3586, 4421, 5358, 6337, 7200, 7762, 7885, 7503, 6601, 5189,
-    3317, 1120, -1127, -3040, -4243, -4502, -3773, -2179, 19, 2469, 4763, 6523,
-    7475, 7498, 6641, 5100, 3198, 1326, -149, -968, -1028, -376, 798, 2175,
-    3367, 4017, 3873, 2842, 1023, -1315, -3827, -6180, -8095, -9373, -9919, -9734,
-    -8897, -7569, -5966, -4281, -2649, -1176, 62, 1045, 1803, 2385, 2822, 3099,
-    3162, 2953, 2478, 1847, 1264, 967, 1143, 1881, 3140, 4758, 6479, 8015,
-    9104, 9539, 9229, 8234, 6728, 4946, 3146, 1539, 228, -797, -1617, -2355,
-    -3160, -4168, -5448, -6952, -8483, -9755, -10507, -10612, -10083, -9024, -7579, -5920,
-    -4245, -2761, -1603, -781, -173, 430, 1231, 2301, 3559, 4850, 6022, 6931,
-    7424, 7366, 6670, 5353, 3582, 1623, -267, -1885, -3059, -3673, -3726, -3319,
-    -2642, -1950, -1496, -1439, -1811, -2528, -3396, -4162, -4595, -4544, -3969, -2947,
-    -1652, -280, 1000, 2038, 2701, 2909, 2656, 2045, 1289, 651, 318, 329,
-    594, 927, 1086, 836, 36, -1317, -3084, -4998, -6719, -7939, -8444, -8127,
-    -6989, -5158, -2870, -432, 1799, 3450, 4210, 3913, 2558, 337, -2374, -5085,
-    -7311, -8689, -9038, -8405, -7006, -5143, -3150, -1347, 22, 834, 1109, 996,
-    725, 503, 465, 694, 1243, 2119, 3264, 4532, 5693, 6482, 6693, 6232,
-    5111, 3435, 1367, -890, -3079, -4899, -6055, -6331, -5643, -4074, -1861, 650,
-    3055, 4944, 5977, 5969, 4914, 2983, 512, -2062, -4291, -5774, -6240, -5618,
-    -4059, -1874, 541, 2785, 4555, 5677, 6090, 5837, 5059, 3932, 2636, 1352,
-    235, -626, -1190, -1444, -1423, -1217, -917, -601, -334, -150, -50, -44,
-    -160, -408, -771, -1229, -1761, -2345, -2977, -3653, -4329, -4913, -5280, -5283,
-    -4794, -3775, -2307, -555, 1247, 2856, 4075, 4785, 4919, 4461, 3475, 2122,
-    640, -698, -1656, -2143, -2257, -2224, -2312, -2745, -3639, -4944, -6454, -7864,
-    -8851, -9173, -8758, -7719, -6281, -4693, -3185, -1942, -1083, -626, -462, -352,
-    -23, 710, 1878, 3359, 4952, 6442, 7634, 8325, 8332, 7565, 6103, 4214,
-    2318, 905, 371, 902, 2415, 4538, 6658, 8120, 8473, 7608, 5734, 3280,
-    695, -1694, -3674, -5097, -5894, -6117, -5921, -5529, -5161, -4949, -4874, -4799,
-    -4527, -3869, -2738, -1205, 535, 2238, 3682, 4724, 5318, 5474, 5250, 4797,
-    4349, 4151, 4369, 5010, 5869, 6612, 6932, 6633, 5638, 4007, 1938, -274,
-    -2298, -3826, -4656, -4752, -4202, -3176, -1925, -764, -2, 171, -228, -959,
-    -1652, -1945, -1605, -595, 947, 2781, 4644, 6297, 7564, 8356, 8626, 8365,
-    7627, 6542, 5287, 4065, 3051, 2305, 1737, 1186, 491, -484, -1803, -3443,
-    -5299, -7185, -8847, -10038, -10607, -10498, -9743, -8440, -6727, -4770, -2778, -961,
-    552, 1714, 2519, 2992, 3192, 3177, 3020, 2854, 2837, 3068, 3577, 4324,
-    5164, 5881, 6268, 6173, 5527, 4393, 2961, 1474, 165, -767, -1208, -1179,
-    -821, -381, -157, -381, -1127, -2288, -3635, -4879, -5771, -6161, -5977, -5198,
-    -3879, -2142, -145, 1923, 3869, 5540, 6848, 7722, 8106, 7965, 7303, 6201,
-    4857, 3548, 2534, 1993, 1966, 2325, 2794, 3042, 2785, 1866, 315, -1672,
-    -3824, -5875, -7585, -8747, -9187, -8782, -7501, -5461, -2934, -281, 2138, 4020,
-    5140, 5355, 4605, 2951, 623, -1977, -4348, -6021, -6681, -6243, -4855, -2840,
-    -587, 1555, 3332, 4592, 5288, 5464, 5236, 4774, 4263, 3857, 3636, 3586,
-    3598, 3496, 3092, 2257, 977, -658, -2486, -4323, -5982, -7278, -8028, -8091,
-    -7431, -6185, -4663, -3266, -2335, -1996, -2121, -2397, -2461, -2016, -936, 697,
-    2638, 4573, 6188, 7215, 7471, 6864, 5411, 3263, 729, -1788, -3890, -5255,
-    -5696, -5209, -3962, -2258, -474, 1025, 2014, 2469, 2539, 2468, 2474, 2643,
-    2905, 3092, 2983, 2357, 1101, -710, -2804, -4783, -6233, -6866, -6602, -5556,
-    -4003, -2359, -1102, -618, -1050, -2242, -3773, -5102, -5759, -5485, -4259, -2277,
-    142, 2642, 4914, 6733, 7989, 8677, 8853, 8594, 7994, 7170, 6250, 5347,
-    4508, 3699, 2842, 1874, 759, -521, -1948, -3429, -4757, -5653, -5864, -5260,
-    -3882, -1954, 145, 1978, 3166, 3489, 2944, 1743, 228, -1247, -2392, -3015,
-    -3069, -2654, -1992, -1385, -1166, -1572, -2633, -4169, -5879, -7424, -8500, -8883,
-    -8465, -7265, -5432, -3204, -831, 1481, 3580, 5343, 6652, 7411, 7604, 7302,
-    6623, 5697, 4652, 3583, 2547, 1543, 526, -599, -1915, -3436, -5064, -6609,
-    -7829, -8498, -8465, -7692, -6263, -4375, -2308, -367, 1164, 2071, 2224, 1578,
-    193, -1740, -3901, -5910, -7414, -8171, -8097, -7281, -5922, -4267, -2545, -926,
-    503, 1707, 2675, 3423, 4012, 4539, 5107, 5788, 6580, 7386, 8050, 8396,
-    8265, 7540, 6189, 4287, 2039, -234, -2151, -3382, -3723, -3136, -1742, 176,
-    2216, 3941, 4959, 5013, 4032, 2157, -304, -2936, -5284, -6930, -7573, -7083,
-    -5528, -3154, -345, 2477, 4935, 6744, 7718, 7781, 6946, 5303, 3038, 468,
-    -1983, -3884, -4919, -4963, -4117, -2661, -939, 751, 2195, 3258, 3923, 4289,
-    4516, 4753, 5087, 5519, 5958, 6257, 6252, 5797, 4787, 3211, 1181, -1081,
-    -3295, -5181, -6513, -7166, -7117, -6448, -5323, -3968, -2637, -1557, -862, -562,
-    -553, -650, -625, -277, 484, 1600, 2897, 4151, 5143, 5695, 5684, 5057,
-    3878, 2365, 858, -280, -796, -665, -108, 501, 787, 524, -270, -1332,
-    -2262, -2705, -2468, -1576, -223, 1316, 2774, 3933, 4633, 4780, 4373, 3541,
-    2538, 1688, 1248, 1328, 1862, 2646, 3403, 3851, 3770, 3061, 1763, 57,
-    -1807, -3571, -5016, -5987, -6428, -6384, -5969, -5319, -4562, -3784, -3011, -2230,
-    -1434, -673, -51, 332, 424, 227, -215, -822, -1492, -2110, -2548, -2658,
-    -2319, -1490, -225, 1339, 3010, 4582, 5860, 6667, 6859, 6359, 5204, 3557,
-    1692, -72, -1451, -2264, -2460, -2135, -1525, -967, -802, -1283, -2471, -4192,
-    -6075, -7687, -8673, -8841, -8182, -6812, -4915, -2720, -493, 1495, 3012, 3912,
-    4184, 3943, 3365, 2614, 1813, 1043, 361, -205, -663, -1061, -1443, -1815,
-    -2117, -2243, -2078, -1554, -687, 428, 1626, 2697, 3417, 3588, 3085, 1890,
-    109, -2052, -4357, -6564, -8454, -9853, -10656, -10799, -10263, -9107, -7459, -5508,
-    -3479, -1591, -1, 1211, 2018, 2430, 2500, 2310, 1984, 1706, 1676, 2028,
-    2769, 3764, 4752, 5416, 5490, 4849, 3539, 1768, -156, -1924, -3285, -4058,
-    -4133, -3510, -2307, -751, 869, 2267, 3231, 3654, 3513, 2866, 1844, 645,
-    -510, -1429, -2011, -2275, -2339, -2346, -2411, -2609, -2979, -3520, -4164, -4785,
-    -5239, -5410, -5227, -4665, -3727, -2436, -856, 894, 2654, 4258, 5551, 6412,
-    6757, 6556, 5827, 4648, 3152, 1493, -188, -1787, -3238, -4497, -5511, -6216,
-    -6552, -6480, -5971, -5016, -3640, -1903, 127, 2355, 4635, 6760, 8475, 9532,
-    9766, 9136, 7719, 5695, 3306, 835, -1404, -3070, -3869, -3669, -2592, -1034,
-    425, 1211, 972, -318, -2381, -4757, -6949, -8555, -9336, -9220, -8271, -6659,
-    -4639, -2524, -656, 646, 1187, 978, 288, -409, -607, 17, 1457, 3386,
-    5303, 6703, 7223, 6714, 5271, 3230, 1110, -506, -1154, -651, 822, 2776,
-    4583, 5687, 5741, 4680, 2700, 183, -2425, -4740, -6501, -7565, -7891, -7510,
-    -6515, -5059, -3366, -1663, -107, 1254, 2441, 3484, 4369, 5013, 5299, 5152,
-    4595, 3755, 2849, 2122, 1742, 1747, 2054, 2498, 2867, 2965, 2640, 1792,
-    392, -1463, -3546, -5546, -7127, -8010, -8045, -7229, -5679, -3607, -1289, 988,
-    2974, 4476, 5356, 5543, 5039, 3939, 2464, 942, -270, -872, -689, 278,
-    1854, 3736, 5570, 7012, 7817, 7893, 7311, 6277, 5065, 3945, 3098, 2570,
-    2277, 2030, 1591, 764, -498, -2045, -3564, -4676, -5055, -4510, -3046, -878,
-    1635, 4098, 6137, 7441, 7808, 7181, 5656, 3480, 1037, -1205, -2794, -3399,
-    -2897, -1402, 782, 3248, 5551, 7282, 8154, 8053, 7030, 5273, 3065, 719,
-    -1491, -3327, -4583, -5105, -4836, -3838, -2302, -521, 1168, 2458, 3121, 3042,
-    2249, 921, -627, -1998, -2805, -2791, -1895, -288, 1655, 3441, 4587, 4748,
-    3802, 1874, -712, -3527, -6135, -8163, -9348, -9552, -8761, -7088, -4793, -2258,
-    53, 1705, 2424, 2183, 1197, -142, -1375, -2106, -2133, -1470, -304, 1052,
-    2236, 2962, 3114, 2754, 2073, 1329, 753, 476, 514, 767, 1021, 990,
-    424, -777, -2514, -4500, -6357, -7728, -8349, -8069, -6866, -4863, -2314, 442,
-    3050, 5212, 6750, 7596, 7738, 7191, 6008, 4333, 2412, 534, -1068, -2289,
-    -3165, -3825, -4412, -5021, -5634, -6103, -6191, -5678, -4456, -2582, -257, 2220,
-    4536, 6411, 7623, 8033, 7596, 6373, 4528, 2340, 140, -1806, -3363, -4502,
-    -5275, -5804, -6222, -6587, -6853, -6896, -6559, -5727, -4390, -2653, -695, 1262,
-    2990, 4304, 5073, 5204, 4681, 3623, 2286, 983, -27, -630, -875, -931,
-    -998, -1226, -1644, -2135, -2480, -2439, -1843, -667, 947, 2719, 4306, 5398,
-    5784, 5371, 4169, 2307, 36, -2307, -4367, -5837, -6513, -6346, -5462, -4114,
-    -2615, -1265, -275, 277, 430, 304, 67, -114, -103, 170, 697, 1392,
-    2127, 2799, 3358, 3791, 4119, 4380, 4625, 4898, 5204, 5489, 5637, 5507,
-    4998, 4064, 2730, 1093, -663, -2285, -3503, -4117, -4061, -3412, -2335, -998,
-    453, 1880, 3122, 4023, 4467, 4426, 3962, 3190, 2252, 1322, 620, 340,
-    557, 1196, 2046, 2823, 3250, 3128, 2357, 955, -893, -2823, -4383, -5185,
-    -5007, -3856, -1950, 357, 2637, 4443, 5382, 5249, 4085, 2149, -185, -2532,
-    -4583, -6130, -7054, -7314, -6948, -6071, -4861, -3524, -2260, -1219, -461, 67,
-    513, 1042, 1736, 2549, 3345, 3985, 4377, 4468, 4198, 3516, 2437, 1093,
-    -269, -1361, -1972, -2024, -1568, -747, 221, 1067, 1520, 1372, 541, -886,
-    -2674, -4518, -6137, -7341, -8044, -8225, -7877, -7016, -5718, -4117, -2401, -777,
-    599, 1677, 2483, 3029, 3261, 3096, 2521, 1675, 815, 166, -209, -402,
-    -583, -916, -1501, -2349, -3386, -4481, -5444, -6053, -6102, -5468, -4176, -2393,
-    -358, 1680, 3481, 4845, 5647, 5842, 5442, 4533, 3268, 1850, 503, -573,
-    -1279, -1680, -1956, -2310, -2895, -3761, -4816, -5854, -6611, -6833, -6354, -5157,
-    -3374, -1224, 1033, 3111, 4716, 5563, 5424, 4247, 2243, -125, -2257, -3576,
-    -3694, -2540, -383, 2261, 4770, 6558, 7226, 6655, 5000, 2598, -133, -2762,
-    -4902, -6264, -6686, -6146, -4770, -2811, -557, 1734, 3844, 5608, 6928, 7730,
-    7927, 7437, 6237, 4391, 2042, -587, -3180, -5362, -6753, -7078, -6258, -4455,
-    -2034, 504, 2640, 3954, 4209, 3405, 1806, -107, -1756, -2637, -2489, -1420,
-    145, 1652, 2608, 2696, 1867, 345, -1467, -3132, -4261, -4626, -4222, -3225,
-    -1891, -491, 743, 1698, 2379, 2845, 3201, 3584, 4106, 4798, 5611, 6416,
-    7019, 7239, 6999, 6331, 5357, 4284, 3372, 2853, 2854, 3345, 4109, 4789,
-    5005, 4476, 3121, 1096, -1269, -3588, -5499, -6710, -7061, -6554, -5332, -3650,
-    -1829, -187, 1032, 1697, 1822, 1570, 1192, 928, 943, 1288, 1888, 2579,
-    3165, 3458, 3321, 2723, 1768, 667, -321, -947, -1055, -628, 208, 1202,
-    2026, 2356, 1979, 848, -901, -2960, -4935, -6451, -7241, -7184, -6301, -4735,
-    -2727, -552, 1518, 3236, 4390, 4823, 4474, 3384, 1691, -392, -2589, -4592,
-    -6099, -6876, -6825, -5999, -4579, -2811, -960, 723, 2029, 2822, 3060, 2805,
-    2201, 1450, 755, 271, 82, 188, 503, 858, 1037, 862, 288, -562,
-    -1451, -2134, -2431, -2280, -1745, -988, -210, 382, 617, 414, -167, -933,
-    -1606, -1900, -1611, -683, 794, 2621, 4514, 6136, 7171, 7385, 6682, 5134,
-    2968, 499, -1917, -3923, -5193, -5478, -4690, -2996, -835, 1202, 2559, 2857,
-    2024, 330, -1705, -3503, -4557, -4534, -3370, -1309, 1176, 3507, 5134, 5667,
-    4985, 3239, 786, -1908, -4388, -6312, -7476, -7805, -7336, -6215, -4654, -2876,
-    -1060, 680, 2274, 3677, 4859, 5802, 6481, 6856, 6868, 6432, 5460, 3934,
-    1963, -223, -2321, -3987, -4904, -4861, -3814, -1931, 403, 2661, 4329, 5024,
-    4584, 3091, 849, -1707, -4102, -5924, -6908, -6988, -6266, -4943, -3270, -1530,
-    26, 1235, 2056, 2564, 2903, 3194, 3460, 3615, 3516, 3016, 2015, 522,
-    -1306, -3193, -4790, -5756, -5873, -5129, -3706, -1929, -185, 1167, 1883, 1886,
-    1300, 444, -284, -553, -205, 719, 1987, 3247, 4144, 4422, 3970, 2848,
-    1280, -432, -1986, -3144, -3785, -3941, -3765, -3459, -3187, -3036, -2981, -2895,
-    -2598, -1931, -838, 597, 2158, 3525, 4327, 4259, 3212, 1308, -1146, -3709,
-    -5883, -7250, -7553, -6716, -4852, -2266, 611, 3327, 5453, 6639, 6725, 5787,
-    4105, 2067, 88, -1484, -2429, -2661, -2211, -1246, -61, 981, 1564, 1522,
-    889, -147, -1344, -2493, -3464, -4197, -4666, -4867, -4842, -4677, -4463, -4253,
-    -4046, -3787, -3387, -2757, -1862, -742, 490, 1668, 2586, 3039, 2868, 2006,
-    513, -1401, -3393, -5052, -5991, -5961, -4905, -2982, -541, 1954, 4042, 5352,
-    5645, 4862, 3170, 919, -1435, -3407, -4576, -4705, -3805, -2086, 117, 2415,
-    4462, 6020, 6939, 7116, 6523, 5238, 3419, 1308, -763, -2428, -3405, -3540,
-    -2813, -1351, 585, 2654, 4480, 5707, 6077, 5522, 4166, 2296, 271, -1571,
-    -3012, -3956, -4404, -4431, -4173, -3787, -3420, -3150, -2963, -2758, -2397, -1757,
-    -787, 456, 1831, 3156, 4242, 4942, 5207, 5080, 4664, 4105, 3580, 3248,
-    3216, 3527, 4114, 4769, 5208, 5190, 4584, 3404, 1803, 9, -1759, -3303,
-    -4428, -4956, -4778, -3900, -2485, -845, 632, 1604, 1868, 1417, 450, -691,
-    -1624, -2027, -1739, -833, 411, 1615, 2411, 2539, 1950, 821, -510, -1645,
-    -2232, -2063, -1140, 336, 2049, 3640, 4788, 5286, 5100, 4366, 3354, 2392,
-    1744, 1499, 1544, 1635, 1501, 943, -83, -1452, -2914, -4168, -4934, -5042,
-    -4491, -3453, -2211, -1080, -308, -1, -108, -438, -707, -622, 9, 1185,
-    2711, 4235, 5351, 5741, 5268, 3996, 2162, 112, -1792, -3250, -4068, -4192,
-    -3697, -2733, -1479, -116, 1210, 2430, 3525, 4483, 5283, 5858, 6072, 5767,
-    4860, 3378, 1465, -609, -2488, -3837, -4409, -4092, -2984, -1427, 94, 1104,
-    1268, 504, -971, -2716, -4225, -5078, -5052, -4166, -2620, -709, 1261, 3030,
-    4424, 5345, 5753, 5681, 5239, 4587, 3895, 3290, 2795, 2332, 1773, 986,
-    -127, -1553, -3138, -4643, -5800, -6375, -6239, -5425, -4104, -2529, -978, 316,
-    1223, 1699, 1780, 1594, 1346, 1239, 1427, 1986, 2877, 3944, 4969, 5722,
-    5997, 5639, 4594, 2927, 825, -1416, -3440, -4901, -5536, -5214, -3968, -2004,
-    333, 2624, 4473, 5575, 5757, 5014, 3515, 1557, -486, -2230, -3376, -3811,
-    -3609, -2960, -2122, -1368, -904, -819, -1085, -1564, -2029, -2267, -2160, -1664,
-    -812, 277, 1439, 2513, 3325, 3706, 3588, 3047, 2251, 1416, 763, 434,
-    437, 682, 1012, 1207, 1059, 463, -571, -1949, -3484, -4906, -5957, -6465,
-    -6360, -5695, -4629, -3351, -2016, -727, 441, 1431, 2194, 2711, 3016, 3199,
-    3382, 3680, 4147, 4733, 5302, 5667, 5621, 5015, 3836, 2208, 357, -1426,
-    -2832, -3644, -3806, -3412, -2694, -1989, -1605, -1683, -2175, -2889, -3534, -3802,
-    -3485, -2523, -1009, 830, 2663, 4158, 5049, 5182, 4557, 3347, 1856, 454,
-    -510, -799, -365, 645, 1944, 3196, 4098, 4467, 4252, 3522, 2449, 1258,
-    143, -788, -1523, -2145, -2804, -3635, -4674, -5839, -6932, -7676, -7813, -7205,
-    -5897, -4104, -2163, -451, 715, 1150, 834, -84, -1319, -2527, -3382, -3656,
-    -3271, -2322, -1046, 243, 1243, 1753, 1735, 1314, 710, 141, -267, -520,
-    -729, -1049, -1606, -2445, -3505, -4624, -5571, -6106, -6059, -5384, -4171, -2624,
-    -1001, 454, 1559, 2192, 2290, 1881, 1085, 79, -957, -1879, -2641, -3294,
-    -3929, -4604, -5309, -5930, -6273, -6136, -5395, -4052, -2248, -242, 1662, 3195,
-    4154, 4425, 3990, 2947, 1518, 31, -1155, -1776, -1749, -1188, -365, 375,
-    719, 458, -461, -1937, -3720, -5466, -6804, -7436, -7217, -6181, -4507, -2476,
-    -415, 1390, 2738, 3516, 3700, 3394, 2791, 2096, 1486, 1068, 813, 558,
-    99, -704, -1890, -3358, -4872, -6135, -6888, -6967, -6344, -5127, -3502, -1689,
-    78, 1572, 2626, 3163, 3209, 2906, 2469, 2096, 1921, 2010, 2337, 2788,
-    3192, 3353, 3076, 2238, 891, -741, -2351, -3638, -4362, -4407, -3781, -2583,
-    -976, 827, 2608, 4176, 5375, 6078, 6207, 5768, 4856, 3645, 2372, 1300,
-    648, 523, 884, 1545, 2211, 2564, 2358, 1489, 36, -1756, -3558, -5046,
-    -5972, -6193, -5695, -4601, -3135, -1569, -143, 988, 1773, 2251, 2543, 2798,
-    3130, 3578, 4113, 4667, 5143, 5446, 5475, 5124, 4303, 2995, 1286, -657,
-    -2611, -4328, -5577, -6174, -6014, -5107, -3614, -1841, -158, 1107, 1769, 1823,
-    1381, 617, -266, -1058, -1598, -1799, -1643, -1193, -562, 144, 870, 1589,
-    2277, 2913, 3477, 3942, 4268, 4403, 4273, 3799, 2915, 1621, 30, -1620,
-    -3009, -3808, -3772, -2843, -1201, 784, 2658, 3986, 4454, 3935, 2505, 411,
-    -1948, -4083, -5531, -5975, -5337, -3804, -1765, 332, 2119, 3384, 4102, 4374,
-    4358, 4218, 4098, 4056, 4024, 3854, 3366, 2404, 929, -917, -2873, -4679,
-    -6121, -7059, -7469, -7440, -7108, -6639, -6199, -5884, -5660, -5414, -5022, -4376,
-    -3418, -2190, -827, 497, 1619, 2425, 2881, 3057, 3102, 3183, 3421, 3844,
-    4363, 4792, 4903, 4510, 3534, 2047, 279, -1438, -2801, -3634, -3909, -3747,
-    -3380, -3064, -2963, -3088, -3296, -3345, -3002, -2154, -838, 780, 2430, 3811,
-    4665, 4819, 4211, 2947, 1314, -309, -1550, -2133, -1963, -1153, 54, 1389,
-    2603, 3521, 4101, 4435, 4689, 5048, 5659, 6575, 7712, 8852, 9689, 9926,
-    9376, 8022, 6002, 3575, 1036, -1361, -3430, -5035, -6079, -6534, -6441, -5915,
-    -5132, -4264, -3419, -2628, -1863, -1062, -147, 942, 2238, 3728, 5335, 6907,
-    8266, 9237, 9684, 9522, 8747, 7446, 5806, 4087, 2548, 1362, 558, 5,
-    -530, -1271, -2333, -3697, -5228, -6701, -7838, -8382, -8163, -7144, -5437, -3268,
-    -923, 1297, 3120, 4330, 4764, 4356, 3199, 1578, -87, -1332, -1782, -1292,
-    -12, 1678, 3314, 4479, 4907, 4536, 3474, 1921, 114, -1703, -3313, -4565,
-    -5397, -5829, -5961, -5934, -5865, -5775, -5581, -5144, -4333, -3064, -1353, 649,
-    2710, 4613, 6191, 7320, 7908, 7899, 7267, 6028, 4275, 2197, 54, -1863,
-    -3309, -4165, -4464, -4352, -3999, -3534, -3023, -2460, -1799, -976, 49, 1270,
-    2622, 3975, 5128, 5840, 5930, 5346, 4173, 2589, 822, -901, -2377, -3444,
-    -4008, -4076, -3777, -3347, -3074, -3186, -3746, -4611, -5485, -6010, -5895, -5024,
-    -3477, -1472, 672, 2578, 3884, 4349, 3903, 2672, 962, -844, -2422, -3570,
-    -4226, -4451, -4397, -4237, -4108, -4050, -3965, -3662, -2981, -1897, -558, 734,
-    1606, 1761, 1094, -306, -2197, -4206, -5906, -6924, -7046, -6253, -4726, -2800,
-    -870, 702, 1669, 1980, 1796, 1409, 1106, 1092, 1445, 2069, 2721, 3098,
-    2964, 2213, 915, -673, -2163, -3166, -3421, -2855, -1613, -9, 1573, 2788,
-    3405, 3376, 2869, 2207, 1724, 1648, 2028, 2728, 3453, 3855, 3668, 2797,
-    1325, -512, -2371, -3899, -4824, -5005, -4439, -3278, -1819, -403, 698, 1350,
-    1591, 1625, 1726, 2089, 2782, 3742, 4765, 5547, 5785, 5288, 4022, 2158,
-    53, -1865, -3239, -3850, -3651, -2788, -1557, -306, 633, 1026, 845, 290,
-    -314, -658, -539, 79, 1070, 2215, 3283, 4069, 4408, 4218, 3522, 2440,
-    1170, -47, -972, -1425, -1315, -675, 340, 1490, 2512, 3182, 3394, 3175,
-    2652, 1996, 1390, 1006, 949, 1216, 1698, 2208, 2514, 2412, 1802, 731,
-    -634, -2055, -3268, -4049, -4274, -3948, -3196, -2226, -1298, -637, -373, -514,
-    -940, -1432, -1764, -1759, -1328, -472, 710, 2074, 3468, 4724, 5656, 6100,
-    5958, 5212, 3941, 2303, 501, -1259, -2773, -3873, -4461, -4507, -4051, -3243,
-    -2320, -1503, -909, -541, -291, 16, 534, 1338, 2411, 3670, 4978, 6158,
-    6999, 7270, 6809, 5621, 3894, 1941, 120, -1262, -2024, -2131, -1666, -843,
-    5, 531, 511, -86, -1082, -2131, -2856, -3004, -2514, -1481, -114, 1328,
-    2608, 3550, 4039, 4056, 3709, 3190, 2712, 2456, 2518, 2843, 3231, 3419,
-    3180, 2410, 1170, -333, -1811, -2968, -3560, -3477, -2768, -1607, -244, 1031,
-    1960, 2392, 2315, 1839, 1168, 531, 79, -160, -270, -393, -678, -1208,
-    -1953, -2774, -3475, -3861, -3797, -3282, -2469, -1613, -966, -696, -815, -1177,
-    -1536, -1637, -1317, -544, 568, 1774, 2769, 3284, 3148, 2335, 988, -608,
-    -2097, -3136, -3492, -3125, -2199, -1005, 150, 1027, 1533, 1747, 1857, 2044,
-    2396, 2853, 3216, 3241, 2782, 1861, 662, -516, -1356, -1651, -1356, -589,
-    392, 1252, 1706, 1609, 984, 27, -934, -1558, -1612, -1025, 93, 1454,
-    2694, 3505, 3726, 3358, 2553, 1558, 639, 22, -153, 104, 609, 1057,
-    1137, 654, -387, -1793, -3260, -4483, -5230, -5375, -4914, -3950, -2679, -1352,
-    -222, 509, 737, 488, -78, -714, -1168, -1253, -902, -178, 760, 1723,
-    2521, 2992, 3041, 2668, 1972, 1126, 332, -254, -593, -768, -929, -1230,
-    -1775, -2575, -3522, -4406, -4992, -5094, -4627, -3624, -2225, -635, 916, 2205,
-    3032, 3248, 2803, 1765, 316, -1277, -2709, -3697, -4044, -3702, -2763, -1435,
-    28, 1393, 2502, 3282, 3728, 3896, 3888, 3818, 3765, 3750, 3724, 3574,
-    3167, 2418, 1333, -10, -1477, -2862, -3908, -4386, -4168, -3280, -1892, -275,
-    1288, 2569, 3416, 3741, 3529, 2854, 1893, 904, 157, -161, 10, 608,
-    1477, 2398, 3137, 3500, 3359, 2691, 1605, 317, -931, -1931, -2524, -2614,
-    -2210, -1437, -508, 306, 752, 684, 123, -765, -1720, -2463, -2780, -2611,
-    -2052, -1300, -578, -87, 48, -210, -820, -1671, -2578, -3328, -3758, -3808,
-    -3541, -3119, -2749, -2592, -2704, -3037, -3456, -3767, -3771, -3351, -2520, -1407,
-    -213, 842, 1577, 1867, 1660, 987, -16, -1129, -2128, -2867, -3323, -3577,
-    -3779, -4077, -4548, -5159, -5775, -6208, -6258, -5780, -4748, -3272, -1564, 117,
-    1504, 2399, 2717, 2484, 1838, 1007, 225, -359, -715, -926, -1152, -1574,
-    -2301, -3308, -4442, -5471, -6144, -6287, -5859, -4945, -3719, -2404, -1208, -279,
-    308, 557, 569, 520, 592, 893, 1398, 1949, 2312, 2275, 1761, 885,
-    -82, -826, -1090, -749, 163, 1470, 2907, 4190, 5080, 5446, 5306, 4809,
-    4172, 3626, 3354, 3434, 3797, 4242, 4520, 4431, 3911, 3056, 2090, 1278,
-    833, 853, 1290, 1971, 2629, 2973, 2774, 1972, 715, -680, -1857, -2533,
-    -2556, -1922, -763, 688, 2158, 3384, 4163, 4401, 4145, 3550, 2834, 2211,
-    1826, 1692, 1681, 1578, 1174, 354, -850, -2263, -3613, -4619, -5070, -4868,
-    -4042, -2729, -1152, 423, 1726, 2539, 2749, 2387, 1603, 627, -262, -813,
-    -884, -466, 331, 1300, 2168, 2650, 2547, 1807, 532, -1068, -2733, -4198,
-    -5246, -5745, -5671, -5113, -4248, -3291, -2430, -1777, -1337, -1033, -755, -415,
-    32, 582, 1187, 1759, 2188, 2353, 2130, 1428, 275, -1158, -2572, -3621,
-    -4029, -3700, -2719, -1308, 264, 1745, 2924, 3637, 3803, 3446, 2726, 1918,
-    1317, 1143, 1482, 2270, 3314, 4362, 5166, 5527, 5328, 4541, 3236, 1587,
-    -154, -1718, -2888, -3528, -3623, -3285, -2709, -2128, -1756, -1711, -1979, -2427,
-    -2841, -3002, -2766, -2108, -1121, 9, 1050, 1747, 1900, 1423, 359, -1108,
-    -2657, -3924, -4597, -4477, -3529, -1920, 16, 1885, 3363, 4262, 4564, 4393,
-    3951, 3434, 2979, 2646, 2419, 2215, 1882, 1272, 293, -1056, -2648, -4221,
-    -5447, -6030, -5792, -4741, -3076, -1146, 663, 2047, 2830, 3008, 2776, 2426,
-    2217, 2295, 2647, 3100, 3410, 3345, 2754, 1611, 3, -1883, -3796, -5466,
-    -6684, -7339, -7431, -7046, -6323, -5395, -4360, -3277, -2141, -884, 551, 2163,
-    3868, 5503, 6861, 7744, 8012, 7627, 6671, 5322, 3834, 2427, 1218, 216,
-    -667, -1577, -2625, -3852, -5215, -6565, -7696, -8389, -8479, -7928, -6840, -5413,
-    -3865, -2377, -1032, 176, 1304, 2413, 3524, 4574, 5403, 5800, 5589, 4667,
-    3057, 915, -1497, -3841, -5761, -6998, -7458, -7256, -6654, -5935, -5312, -4879,
-    -4587, -4281, -3790, -2982, -1812, -324, 1362, 3041, 4490, 5553, 6162, 6331,
-    6179, 5882, 5597, 5409, 5282, 5053, 4505, 3493, 1999, 117, -1956, -3947,
-    -5587, -6652, -6993, -6583, -5511, -3961, -2200, -518, 834, 1691, 2042, 2041,
-    1941, 2018, 2438, 3168, 3992, 4598, 4699, 4141, 2911, 1130, -954, -3040,
-    -4839, -6079, -6566, -6249, -5221, -3698, -1963, -304, 1061, 2045, 2693, 3141,
-    3556, 4070, 4724, 5438, 6013, 6224, 5890, 4897, 3272, 1182, -1134, -3371,
-    -5181, -6276, -6483, -5795, -4367, -2473, -444, 1405, 2856, 3793, 4189, 4122,
-    3754, 3285, 2926, 2819, 2988, 3358, 3749, 3927, 3694, 2960, 1770, 298,
-    -1190, -2401, -3087, -3091, -2380, -1076, 606, 2382, 3924, 4949, 5278, 4846,
-    3739, 2225, 671, -543, -1112, -929, -94, 1121, 2343, 3221, 3502, 3073,
-    2007, 523, -1086, -2495, -3421, -3685, -3227, -2144, -695, 774, 1917, 2485,
-    2417, 1849, 1047, 316, -75, 43, 678, 1681, 2785, 3652, 3994, 3658,
-    2648, 1136, -569, -2137, -3266, -3757, -3610, -3013, -2275, -1735, -1628, -2010,
-    -2766, -3644, -4317, -4489, -3963, -2726, -980, 933, 2619, 3740, 4121, 3781,
-    2904, 1806, 828, 227, 95, 322, 631, 686, 238, -774, -2217, -3792,
-    -5111, -5840, -5780, -4931, -3528, -1952, -592, 242, 447, 163, -332, -707,
-    -692, -227, 523, 1234, 1535, 1175, 132, -1391, -3028, -4384, -5161, -5234,
-    -4680, -3728, -2653, -1692, -961, -409, 113, 773, 1676, 2800, 3979, 4928,
-    5339, 4979, 3764, 1835, -459, -2699, -4492, -5549, -5783, -5291, -4301, -3129,
-    -2069, -1295, -848, -595, -296, 230, 1015, 1930, 2708, 3063, 2801, 1890,
-    491, -1083, -2447, -3233, -3227, -2429, -1039, 572, 1984, 2877, 3106, 2736,
-    2006, 1244, 761, 756, 1274, 2199, 3269, 4174, 4669, 4599, 3975, 2998,
-    1969, 1213, 984, 1339, 2136, 3101, 3863, 4087, 3588, 2353, 572, -1383,
-    -3096, -4211, -4515, -3985, -2771, -1161, 498, 1886, 2763, 3018, 2716, 2052,
-    1289, 693, 450, 640, 1229, 2061, 2873, 3357, 3278, 2567, 1336, -136,
-    -1473, -2364, -2598, -2080, -894, 732, 2497, 4044, 5063, 5390, 5000, 4003,
-    2632, 1163, -120, -963, -1224, -904, -170, 683, 1313, 1429, 878, -289,
-    -1843, -3437, -4691, -5314, -5153, -4210, -2646, -727, 1244, 2999, 4352, 5193,
-    5488, 5273, 4616, 3651, 2600, 1672, 1015, 675, 513, 274, -268, -1246,
-    -2631, -4213, -5681, -6692, -6954, -6344, -4936, -2956, -704, 1527, 3498, 5026,
-    5995, 6346, 6094, 5362, 4363, 3344, 2516, 1957, 1593, 1230, 629, -390,
-    -1884, -3730, -5625, -7193, -8089, -8080, -7137, -5418, -3186, -781, 1469, 3320,
-    4591, 5200, 5209, 4783, 4157, 3587, 3226, 3073, 2994, 2780, 2235, 1254,
-    -155, -1836, -3534, -4950, -5815, -5981, -5484, -4527, -3401, -2392, -1709, -1433,
-    -1493, -1708, -1839, -1641, -966, 147, 1484, 2706, 3476, 3597, 3055, 2039,
-    880, -102, -686, -816, -651, -474, -547, -1057, -2027, -3266, -4471, -5319,
-    -5550, -5067, -3969, -2525, -1087, 15, 573, 555, 107, -496, -939, -984,
-    -563, 200, 1006, 1493, 1407, 692, -500, -1815, -2837, -3251, -2934, -2013,
-    -820, 238, 817, 761, 136, -832, -1824, -2501, -2638, -2172, -1212, -67,
-    872, 1307, 1134, 488, -288, -808, -785, -136, 983, 2240, 3242, 3652,
-    3286, 2169, 543, -1212, -2693, -3539, -3543, -2747, -1421, 14, 1104, 1521,
-    1164, 184, -1078, -2234, -2962, -3066, -2574, -1699, -725, 53, 421, 337,
-    -101, -699, -1198, -1355, -1015, -168, 1014, 2217, 3093, 3361, 2898, 1790,
-    302, -1216, -2431, -3066, -2978, -2218, -979, 459, 1757, 2609, 2844, 2441,
-    1535, 393, -644, -1274, -1345, -885, -61, 825, 1444, 1557, 1055, -6,
-    -1392, -2789, -3893, -4465, -4410, -3763, -2647, -1277, 84, 1217, 1976, 2308,
-    2288, 2093, 1926, 1945, 2226, 2725, 3270, 3644, 3654, 3160, 2150, 751,
-    -841, -2388, -3640, -4376, -4458, -3869, -2733, -1260, 277, 1613, 2554, 2971,
-    2823, 2207, 1326, 432, -212, -432, -189, 438, 1272, 2087, 2677, 2870,
-    2570, 1790, 646, -653, -1839, -2656, -2933, -2639, -1888, -931, -92, 376,
-    363, -104, -848, -1590, -2068, -2105, -1626, -703, 455, 1556, 2326, 2583,
-    2250, 1394, 236, -939, -1847, -2255, -2068, -1367, -353, 691, 1464, 1762,
-    1515, 787, -221, -1234, -1969, -2210, -1876, -1054, 6, 967, 1509, 1428,
-    738, -329, -1417, -2177, -2399, -2080, -1379, -564, 69, 307, 81, -548,
-    -1371, -2088, -2430, -2255, -1595, -649, 286, 901, 984, 501, -425, -1536,
-    -2483, -2971, -2868, -2226, -1271, -334, 272, 361, -75, -873, -1742, -2356,
-    -2469, -2022, -1154, -161, 622, 950, 753, 177, -491, -939, -913, -299,
-    811, 2165, 3441, 4324, 4606, 4248, 3400, 2342, 1373, 740, 583, 845,
-    1294, 1638, 1601, 1022, -48, -1355, -2537, -3244, -3261, -2587, -1427, -132,
-    922, 1450, 1343, 673, -320, -1274, -1831, -1753, -958, 438, 2114, 3666,
-    4745, 5120, 4746, 3794, 2575, 1444, 709, 513, 784, 1257, 1584, 1465,
-    765, -421, -1810, -3047, -3789, -3801, -3026, -1584, 280, 2234, 3947, 5154,
-    5685, 5499, 4702, 3517, 2238, 1182, 571, 432, 579, 702, 487, -232,
-    -1405, -2787, -4010, -4673, -4509, -3461, -1654, 642, 3056, 5258, 7019, 8177,
-    8636, 8375, 7425, 5888, 3985, 2018, 278, -1050, -1939, -2523, -3034, -3677,
-    -4516, -5409, -6056, -6133, -5439, -3972, -1917, 437, 2813, 5004, 6865, 8290,
-    9158, 9326, 8686, 7241, 5151, 2729, 385, -1479, -2595, -2914, -2617, -2048,
-    -1602, -1569, -2067, -3010, -4140, -5132, -5700, -5660, -4962, -3687, -2002, -116,
-    1756, 3407, 4662, 5404, 5606, 5324, 4696, 3941, 3279, 2852, 2705, 2753,
-    2779, 2549, 1924, 884, -474, -1924, -3209, -4147, -4625, -4610, -4209, -3620,
-    -3058, -2740, -2807, -3238, -3860, -4418, -4636, -4305, -3367, -1894, -47, 1941,
-    3811, 5353, 6399, 6823, 6588, 5775, 4564, 3232, 2078, 1298, 939, 885,
-    866, 565, -221, -1524, -3209, -4994, -6531, -7505, -7686, -6992, -5556, -3683,
-    -1712, 50, 1404, 2323, 2926, 3373, 3803, 4278, 4742, 5060, 5068, 4587,
-    3497, 1814, -303, -2579, -4656, -6178, -6891, -6691, -5657, -4062, -2285, -670,
-    553, 1327, 1765, 2070, 2422, 2897, 3405, 3739, 3700, 3177, 2183, 887,
-    -434, -1508, -2143, -2282, -2050, -1701, -1493, -1609, -2096, -2812, -3467, -3770,
-    -3528, -2700, -1432, -30, 1160, 1867, 1958, 1494, 699, -118, -688, -874,
-    -700, -327, -5, 9, -435, -1312, -2434, -3497, -4163, -4190, -3525, -2323,
-    -903, 366, 1179, 1370, 935, 44, -1018, -1934, -2431, -2354, -1741, -821,
-    91, 664, 667, 76, -939, -2094, -3052, -3520, -3362, -2640, -1560, -440,
-    376, 648, 296, -603, -1805, -2966, -3780, -4059, -3784, -3113, -2339, -1765,
-    -1617, -1997, -2843, -3954, -5040, -5774, -5884, -5254, -3958, -2242, -464, 994,
-    1823, 1859, 1134, -125, -1563, -2783, -3449, -3408, -2745, -1713, -653, 59,
-    150, -448, -1625, -3125, -4575, -5590, -5929, -5507, -4394, -2825, -1135, 357,
-    1403, 1865, 1756, 1223, 476, -251, -739, -856, -583, -20, 628, 1110,
-    1216, 828, -39, -1239, -2550, -3717, -4486, -4687, -4273, -3295, -1884, -243,
-    1403, 2843, 3865, 4294, 4073, 3260, 2018, 608, -667, -1576, -1974, -1808,
-    -1175, -288, 630, 1405, 1932, 2217, 2373, 2516, 2721, 3052, 3538, 4138,
-    4757, 5261, 5470, 5205, 4380, 3028, 1289, -579, -2244, -3399, -3848, -3529,
-    -2533, -1090, 515, 2021, 3215, 3947, 4154, 3877, 3252, 2518, 1947, 1740,
-    1950, 2466, 3051, 3430, 3404, 2901, 1985, 862, -181, -866, -1003, -556,
-    317, 1324, 2161, 2601, 2558, 2131, 1541, 1031, 811, 1028, 1708, 2731,
-    3882, 4899, 5518, 5565, 5019, 4017, 2817, 1728, 1005, 748, 884, 1212,
-    1489, 1521, 1232, 708, 160, -156, -42, 580, 1630, 2873, 3992, 4709,
-    4870, 4490, 3740, 2879, 2156, 1743, 1687, 1894, 2176, 2317, 2143, 1594,
-    754, -163, -880, -1154, -889, -183, 716, 1506, 1934, 1902, 1497, 939,
-    501, 414, 762, 1436, 2186, 2694, 2669, 1972, 687, -910, -2456, -3588,
-    -4032, -3696, -2700, -1337, 25, 1048, 1530, 1458, 998, 420, -8, -122,
-    86, 466, 772, 750, 231, -799, -2158, -3538, -4609, -5121, -4959, -4197,
-    -3063, -1855, -859, -289, -219, -543, -1033, -1421, -1470, -1048, -205, 845,
-    1810, 2397, 2388, 1719, 495, -1040, -2559, -3729, -4306, -4194, -3473, -2374,
-    -1232, -382, -63, -337, -1057, -1924, -2601, -2808, -2405, -1447, -151, 1195,
-    2296, 2901, 2855, 2135, 846, -780, -2417, -3725, -4448, -4477, -3877, -2885,
-    -1841, -1069, -786, -1049, -1743, -2616, -3364, -3726, -3540, -2782, -1563, -101,
-    1359, 2596, 3417, 3679, 3325, 2403, 1070, -403, -1699, -2553, -2832, -2574,
-    -1980, -1334, -890, -802, -1092, -1638, -2212, -2566, -2517, -1993, -1036, 225,
-    1626, 3002, 4189, 5033, 5408, 5231, 4494, 3283, 1792, 285, -948, -1686,
-    -1828, -1411, -602, 324, 1085, 1492, 1500, 1197, 776, 470, 466, 839,
-    1565, 2528, 3549, 4422, 4944, 4950, 4374, 3296, 1933, 581, -450, -924,
-    -759, -53, 968, 1982, 2665, 2809, 2390, 1555, 579, -216, -573, -375,
-    363, 1498, 2778, 3901, 4603, 4715, 4220, 3279, 2185, 1261, 759, 803,
-    1344, 2172, 2976, 3433, 3319, 2569, 1310, -161, -1472, -2301, -2465, -1960,
-    -970, 192, 1194, 1771, 1799, 1338, 610, -90, -499, -458, 18, 745,
-    1437, 1794, 1607, 850, -297, -1513, -2440, -2806, -2529, -1738, -711, 217,
-    741, 671, -12, -1144, -2419, -3469, -3996, -3877, -3217, -2300, -1484, -1068,
-    -1195, -1806, -2659, -3431, -3832, -3705, -3079, -2164, -1268, -674, -537, -833,
-    -1377, -1899, -2132, -1911, -1238, -309, 573, 1094, 1048, 410, -636, -1774,
-    -2663, -3046, -2831, -2122, -1183, -356, 40, -171, -957, -2083, -3185, -3907,
-    -4022, -3516, -2582, -1543, -728, -352, -467, -960, -1593, -2082, -2193, -1817,
-    -1000, 69, 1107, 1835, 2074, 1787, 1086, 188, -647, -1191, -1316, -1028,
-    -480, 77, 377, 240, -361, -1284, -2272, -3032, -3330, -3054, -2252, -1116,
-    72, 1020, 1501, 1411, 792, -183, -1267, -2195, -2755, -2836, -2457, -1755,
-    -948, -260, 151, 219, -14, -414, -797, -976, -809, -253, 612, 1609,
-    2508, 3085, 3181, 2745, 1833, 599, -728, -1885, -2652, -2911, -2674, -2080,
-    -1350, -711, -330, -286, -553, -1003, -1442, -1667, -1533, -1000, -147, 866,
-    1846, 2605, 2994, 2927, 2391, 1468, 348, -703, -1423, -1644, -1334, -608,
-    324, 1219, 1859, 2080, 1820, 1137, 199, -747, -1424, -1597, -1161, -168,
-    1193, 2642, 3884, 4674, 4875, 4471, 3562, 2339, 1045, -59, -745, -873,
-    -445, 391, 1372, 2204, 2652, 2614, 2132, 1372, 574, -14, -195, 135,
-    951, 2098, 3315, 4299, 4788, 4655, 3945, 2849, 1640, 603, -38, -179,
-    141, 763, 1448, 1934, 2022, 1639, 867, -77, -906, -1356, -1274, -658,
-    338, 1433, 2307, 2696, 2461, 1634, 408, -919, -2028, -2653, -2653, -2065,
-    -1098, -70, 687, 933, 600, -185, -1147, -1972, -2414, -2376, -1918, -1229,
-    -560, -151, -133, -492, -1070, -1615, -1857, -1614, -866, 227, 1385, 2293,
-    2708, 2525, 1811, 776, -300, -1154, -1612, -1628, -1302, -851, -528, -537,
-    -972, -1768, -2704, -3476, -3810, -3564, -2778, -1660, -509, 398, 899, 968,
-    710, 316, 2, -55, 223, 783, 1461, 2036, 2311, 2191, 1726, 1074,
-    446, 47, 14, 368, 1016, 1773, 2411, 2727, 2641, 2226, 1678, 1245,
-    1141, 1463, 2160, 3066, 3960, 4628, 4909, 4731, 4141, 3296, 2421, 1742,
-    1413, 1460, 1785, 2197, 2490, 2488, 2097, 1338, 352, -636, -1384, -1705,
-    -1524, -906, -4, 995, 1891, 2521, 2793, 2715, 2389, 2002, 1755, 1780,
-    2103, 2653, 3284, 3813, 4066, 3917, 3311, 2305, 1066, -174, -1199, -1852,
-    -2061, -1857, -1366, -768, -262, -4, -64, -402, -883, -1318, -1528, -1406,
-    -916, -104, 907, 1928, 2761, 3230, 3230, 2745, 1867, 759, -381, -1372,
-    -2078, -2426, -2415, -2111, -1653, -1219, -972, -1009, -1323, -1802, -2278, -2584,
-    -2598, -2262, -1592, -672, 351, 1290, 1963, 2247, 2094, 1532, 656, -384,
-    -1409, -2241, -2730, -2807, -2512, -1975, -1370, -869, -606, -639, -928, -1344,
-    -1700, -1802, -1532, -891, 7, 969, 1781, 2273, 2346, 1983, 1252, 298,
-    -687, -1506, -1997, -2079, -1791, -1283, -755, -396, -334, -607, -1154, -1855,
-    -2562, -3118, -3368, -3223, -2723, -2023, -1338, -877, -769, -1023, -1541, -2162,
-    -2699, -2963, -2824, -2271, -1418, -470, 338, 812, 870, 539, -59, -744,
-    -1309, -1586, -1506, -1128, -624, -217, -89, -320, -867, -1588, -2282, -2752,
-    -2859, -2590, -2059, -1469, -1041, -954, -1283, -1965, -2822, -3614, -4105, -4150,
-    -3757, -3075, -2344, -1800, -1602, -1779, -2226, -2735, -3059, -3001, -2491, -1619,
-    -599, 309, 890, 1059, 873, 497, 151, 43, 284, 824, 1473, 1972,
-    2098, 1766, 1073, 248, -450, -813, -721, -200, 572, 1329, 1813, 1869,
-    1498, 863, 224, -176, -200, 141, 707, 1278, 1631, 1614, 1206, 525,
-    -216, -777, -974, -740, -144, 640, 1373, 1832, 1895, 1587, 1050, 494,
-    122, 67, 358, 919, 1603, 2211, 2551, 2502, 2064, 1358, 583, -52,
-    -384, -339, 50, 646, 1247, 1651, 1718, 1410, 826, 154, -402, -677,
-    -585, -147, 518, 1218, 1729, 1864, 1546, 842, -71, -956, -1582, -1784,
-    -1512, -842, 32, 839, 1309, 1276, 737, -139, -1078, -1794, -2080, -1853,
-    -1156, -150, 925, 1796, 2232, 2115, 1488, 541, -461, -1252, -1630, -1507,
-    -918, 5, 1059, 2001, 2599, 2706, 2305, 1505, 518, -393, -993, -1134,
-    -782, -18, 990, 2031, 2897, 3417, 3490, 3116, 2391, 1493, 646, 65,
-    -114, 131, 714, 1465, 2176, 2649, 2751, 2450, 1811, 974, 125, -532,
-    -825, -664, -68, 817, 1750, 2464, 2758, 2547, 1862, 850, -266, -1237,
-    -1842, -1933, -1478, -597, 482, 1496, 2217, 2485, 2238, 1527, 504, -597,
-    -1506, -1990, -1941, -1403, -545, 385, 1120, 1450, 1286, 680, -186, -1048,
-    -1654, -1832, -1523, -786, 217, 1266, 2128, 2617, 2631, 2195, 1462, 660,
-    19, -310, -307, -81, 165, 200, -150, -943, -2096, -3410, -4634, -5527,
-    -5913, -5724, -5027, -4014, -2942, -2036, -1423, -1099, -943, -780, -455, 113,
-    905, 1791, 2552, 2955, 2833, 2136, 956, -481, -1874, -2925, -3439, -3381,
-    -2883, -2197, -1624, -1403, -1599, -2081, -2608, -2924, -2830, -2246, -1257, -77,
-    1036, 1861, 2277, 2319, 2157, 2003, 2022, 2271, 2671, 3035, 3146, 2847,
-    2099, 1007, -211, -1300, -2048, -2357, -2276, -1983, -1698, -1611, -1803, -2224,
-    -2712, -3051, -3063, -2663, -1891, -893, 126, 959, 1459, 1586, 1426, 1153,
-    963, 1012, 1337, 1826, 2283, 2507, 2347, 1747, 780, -383, -1542, -2507,
-    -3124, -3332, -3183, -2828, -2475, -2307, -2407, -2720, -3076, -3250, -3047, -2382,
-    -1313, -18, 1254, 2230, 2690, 2544, 1849, 780, -423, -1521, -2337, -2780,
-    -2859, -2685, -2434, -2298, -2431, -2888, -3582, -4327, -4897, -5088, -4762, -3897,
-    -2605, -1095, 365, 1494, 2092, 2096, 1578, 704, -305, -1207, -1803, -1987,
-    -1760, -1241, -647, -213, -112, -394, -986, -1716, -2364, -2721, -2639, -2070,
-    -1079, 176, 1475, 2587, 3318, 3548, 3258, 2527, 1524, 468, -417, -955,
-    -1059, -748, -138, 593, 1244, 1633, 1643, 1248, 510, -435, -1419, -2288,
-    -2939, -3314, -3390, -3166, -2662, -1925, -1027, -51, 919, 1815, 2590, 3209,
-    3635, 3827, 3756, 3411, 2791, 1893, 717, -699, -2250, -3756, -4988, -5730,
-    -5846, -5308, -4192, -2661, -948, 684, 1991, 2793, 3014, 2701, 2014, 1171,
-    391, -152, -365, -251, 99, 514, 790, 760, 367, -311, -1090, -1731,
-    -2016, -1841, -1254, -448, 292, 667, 466, -366, -1709, -3314, -4869, -6078,
-    -6733, -6749, -6162, -5105, -3788, -2449, -1314, -542, -182, -165, -346, -559,
-    -676, -635, -463, -242, -45, 102, 222, 391, 695, 1190, 1864, 2646,
-    3415, 4017, 4294, 4133, 3500, 2472, 1234, 22, -977, -1685, -2151, -2517,
-    -2939, -3504, -4189, -4881, -5409, -5592, -5291, -4472, -3217, -1711, -185, 1169,
-    2261, 3113, 3817, 4482, 5173, 5896, 6599, 7180, 7505, 7440, 6887, 5817,
-    4309, 2556, 818, -667, -1740, -2368, -2639, -2706, -2710, -2731, -2768, -2734,
-    -2501, -1973, -1124, -6, 1266, 2544, 3695, 4621, 5266, 5634, 5783, 5781,
-    5682, 5496, 5162, 4558, 3574, 2204, 583, -1021, -2285, -2931, -2809, -1925,
-    -447, 1324, 3026, 4328, 4993, 4939, 4255, 3145, 1867, 670, -246, -778,
-    -936, -816, -565, -334, -209, -165, -87, 144, 589, 1203, 1848, 2330,
-    2456, 2097, 1230, -30, -1453, -2754, -3655, -3953, -3583, -2613, -1226, 322,
-    1757, 2858, 3494, 3627, 3311, 2677, 1897, 1132, 501, 52, -251, -522,
-    -895, -1461, -2217, -3059, -3807, -4263, -4264, -3732, -2692, -1269, 337, 1911,
-    3256, 4213, 4667, 4541, 3821, 2576, 990, -655, -2042, -2917, -3174, -2877,
-    -2228, -1480, -854, -478, -376, -483, -670, -783, -683, -285, 416, 1348,
-    2364, 3278, 3903, 4092, 3763, 2938, 1754, 438, -738, -1536, -1818, -1585,
-    -964, -160, 581, 1034, 1054, 614, -190, -1157, -2045, -2647, -2832, -2563,
-    -1887, -930, 140, 1139, 1899, 2296, 2302, 1993, 1533, 1128, 969, 1166,
-    1705, 2448, 3162, 3593, 3564, 3030, 2089, 947, -148, -985, -1442, -1503,
-    -1250, -859, -543, -498, -853, -1634, -2714, -3832, -4676, -4987, -4630, -3629,
-    -2156, -459, 1211, 2634, 3652, 4204, 4341, 4193, 3931, 3718, 3654, 3746,
-    3896, 3931, 3658, 2942, 1789, 371, -1011, -2050, -2549, -2496, -2070, -1559,
-    -1255, -1339, -1841, -2633, -3456, -3988, -3967, -3283, -2001, -331, 1439, 3030,
-    4235, 4950, 5188, 5073, 4766, 4393, 4003, 3577, 3032, 2258, 1177, -221,
-    -1845, -3488, -4855, -5666, -5758, -5143, -4006, -2632, -1294, -186, 604, 1080,
-    1328, 1495, 1735, 2143, 2685, 3190, 3419, 3184, 2427, 1255, -83, -1284,
-    -2091, -2365, -2122, -1528, -827, -250, 52, 41, -192, -457, -554, -350,
-    164, 855, 1495, 1855, 1780, 1233, 313, -764, -1733, -2358, -2486, -2093,
-    -1317, -411, 352, 764, 729, 271, -478, -1311, -1988, -2286, -2080, -1399,
-    -428, 552, 1259, 1493, 1175, 372, -725, -1852, -2747, -3203, -3126, -2564,
-    -1689, -724, 117, 666, 845, 696, 366, 50, -70, 101, 533, 1099,
-    1637, 1977, 1964, 1495, 548, -799, -2357, -3839, -4943, -5440, -5239, -4388,
-    -3052, -1458, 158, 1592, 2689, 3358, 3572, 3365, 2824, 2071, 1250, 504,
-    -71, -452, -693, -892, -1154, -1541, -2030, -2523, -2888, -2992, -2739, -2096,
-    -1110, 102, 1361, 2454, 3180, 3391, 3032, 2147, 880, -559, -1901, -2862,
-    -3222, -2901, -1991, -738, 530, 1502, 1988, 1953, 1508, 872, 295, -6,
-    86, 549, 1218, 1833, 2129, 1912, 1128, -112, -1577, -2982, -4055, -4603,
-    -4565, -4005, -3067, -1953, -888, -63, 419, 571, 507, 424, 517, 906,
-    1582, 2419, 3210, 3722, 3762, 3230, 2153, 688, -934, -2470, -3713, -4512,
-    -4794, -4571, -3954, -3145, -2385, -1877, -1699, -1783, -1933, -1921, -1583, -891,
-    29, 935, 1548, 1640, 1121, 89, -1179, -2322, -3027, -3110, -2561, -1555,
-    -410, 523, 981, 857, 243, -600, -1330, -1650, -1402, -614, 515, 1665,
-    2503, 2797, 2491, 1723, 771, -45, -491, -498, -181, 213, 394, 156,
-    -526, -1478, -2396, -2959, -2953, -2341, -1279, -44, 1061, 1793, 2039, 1861,
-    1473, 1167, 1191, 1648, 2453, 3379, 4121, 4397, 4040, 3053, 1612, 28,
-    -1342, -2213, -2474, -2201, -1607, -955, -459, -198, -114, -61, 141, 645,
-    1498, 2589, 3688, 4519, 4838, 4505, 3542, 2145, 623, -682, -1491, -1664,
-    -1231, -376, 624, 1490, 2027, 2193, 2097, 1947, 1937, 2180, 2689, 3378,
-    4084, 4630, 4873, 4717, 4156, 3302, 2378, 1633, 1263, 1328, 1720, 2221,
-    2577, 2568, 2072, 1134, -43, -1166, -1945, -2168, -1764, -815, 492, 1909,
-    3172, 4054, 4432, 4305, 3798, 3121, 2490, 2064, 1935, 2109, 2493, 2926,
-    3220, 3194, 2742, 1887, 792, -311, -1182, -1622, -1524, -901, 126, 1337,
-    2446, 3189, 3401, 3054, 2251, 1210, 207, -506, -769, -558, 33, 835,
-    1640, 2247, 2525, 2441, 2036, 1400, 662, -32, -548, -785, -686, -280,
-    323, 956, 1446, 1660, 1560, 1204, 716, 248, -56, -99, 146, 637,
-    1268, 1889, 2349, 2527, 2343, 1782, 919, -83, -1013, -1667, -1916, -1754,
-    -1285, -685, -162, 89, -48, -578, -1383, -2249, -2932, -3235, -3058, -2414,
-    -1422, -277, 788, 1544, 1832, 1608, 955, 50, -885, -1649, -2113, -2233,
-    -2054, -1714, -1421, -1371, -1664, -2272, -3052, -3787, -4253, -4292, -3852, -2993,
-    -1899, -829, -37, 300, 125, -497, -1387, -2294, -2969, -3240, -3068, -2556,
-    -1929, -1464, -1382, -1765, -2548, -3553, -4519, -5155, -5250, -4768, -3856, -2785,
-    -1858, -1291, -1134, -1285, -1563, -1757, -1686, -1261, -541, 284, 940, 1160,
-    798, -103, -1337, -2619, -3661, -4245, -4291, -3877, -3210, -2545, -2079, -1886,
-    -1890, -1912, -1752, -1285, -507, 467, 1425, 2127, 2380, 2122, 1446, 554,
-    -323, -1005, -1410, -1577, -1648, -1810, -2199, -2830, -3567, -4162, -4349, -3971,
-    -3037, -1710, -227, 1161, 2238, 2861, 2961, 2585, 1904, 1172, 623, 384,
-    424, 577, 620, 375, -206, -1030, -1884, -2516, -2720, -2404, -1627, -577,
-    499, 1372, 1880, 1961, 1668, 1133, 535, 76, -64, 187, 762, 1460,
-    2006, 2154, 1809, 1056, 111, -743, -1247, -1253, -759, 114, 1151, 2075,
-    2629, 2654, 2132, 1192, 75, -939, -1594, -1720, -1293, -448, 583, 1521,
-    2101, 2168, 1738, 961, 66, -654, -944, -696, 49, 1141, 2335, 3347,
-    3952, 4034, 3562, 2621, 1418, 222, -717, -1218, -1210, -762, -41, 732,
-    1326, 1554, 1331, 694, -200, -1096, -1733, -1914, -1562, -737, 367, 1506,
-    2450, 3017, 3094, 2667, 1825, 749, -308, -1089, -1413, -1216, -557, 377,
-    1333, 2084, 2462, 2372, 1838, 1019, 141, -576, -968, -959, -581, 53,
-    770, 1348, 1567, 1292, 524, -592, -1808, -2845, -3467, -3513, -2949, -1870,
-    -482, 940, 2119, 2846, 3032, 2702, 1971, 1035, 112, -607, -998, -1051,
-    -906, -783, -883, -1311, -2066, -3033, -4009, -4759, -5063, -4786, -3939, -2671,
-    -1212, 183, 1276, 1904, 2015, 1680, 1088, 489, 92, -6, 152, 401,
-    526, 363, -159, -1018, -2077, -3078, -3722, -3792, -3230, -2172, -902, 264,
-    1078, 1406, 1245, 724, 69, -460, -641, -374, 253, 1006, 1597, 1788,
-    1462, 667, -392, -1417, -2113, -2293, -1949, -1248, -470, 104, 318, 170,
-    -207, -590, -733, -483, 150, 1024, 1906, 2536, 2730, 2470, 1888, 1201,
-    662, 457, 628, 1053, 1499, 1710, 1514, 894, -12, -959, -1661, -1894,
-    -1573, -779, 243, 1154, 1668, 1687, 1304, 739, 262, 80, 251, 702,
-    1280, 1777, 1989, 1814, 1290, 576, -87, -469, -447, -31, 654, 1381,
-    1892, 2005, 1683, 1032, 285, -276, -457, -215, 345, 1031, 1616, 1911,
-    1811, 1331, 619, -82, -530, -571, -187, 480, 1196, 1725, 1898, 1637,
-    985, 96, -806, -1470, -1683, -1367, -621, 338, 1231, 1810, 1937, 1626,
-    998, 225, -492, -966, -1070, -766, -139, 609, 1210, 1427, 1135, 359,
-    -742, -1930, -2945, -3558, -3634, -3163, -2263, -1166, -159, 524, 771, 580,
-    44, -665, -1339, -1791, -1878, -1542, -874, -84, 592, 945, 842, 271,
-    -668, -1805, -2907, -3716, -4041, -3816, -3079, -1961, -670, 570, 1555, 2104,
-    2100, 1554, 597, -556, -1670, -2548, -3078, -3212, -2957, -2404, -1715, -1083,
-    -686, -614, -822, -1184, -1560, -1809, -1808, -1505, -920, -126, 731, 1434,
-    1801, 1742, 1253, 414, -602, -1598, -2410, -2908, -3007, -2715, -2126, -1392,
-    -697, -221, -82, -298, -781, -1342, -1770, -1905, -1673, -1083, -234, 686,
-    1456, 1872, 1801, 1225, 265, -854, -1874, -2569, -2799, -2539, -1897, -1095,
-    -400, -35, -116, -609, -1328, -2014, -2435, -2438, -1979, -1148, -163, 703,
-    1196, 1158, 593, -324, -1312, -2078, -2394, -2169, -1478, -534, 372, 959,
-    1054, 650, -102, -937, -1567, -1797, -1573, -987, -245, 397, 717, 606,
-    103, -606, -1242, -1543, -1366, -729, 184, 1072, 1640, 1712, 1268, 446,
-    -493, -1256, -1621, -1501, -959, -202, 492, 886, 862, 456, -145, -669,
-    -869, -636, -18, 802, 1576, 2064, 2111, 1705, 980, 179, -425, -606,
-    -291, 396, 1185, 1779, 1961, 1676, 1038, 274, -360, -640, -426, 274,
-    1291, 2336, 3091, 3326, 2984, 2199, 1231, 382, -91, -62, 438, 1242,
-    2097, 2726, 2917, 2622, 1966, 1186, 524, 177, 252, 723, 1435, 2167,
-    2698, 2838, 2498, 1743, 774, -148, -761, -880, -468, 359, 1381, 2327,
-    2936, 3045, 2645, 1857, 892, 22, -518, -600, -223, 489, 1314, 1995,
-    2326, 2185, 1571, 629, -380, -1185, -1584, -1474, -881, 33, 1033, 1884,
-    2395, 2462, 2105, 1464, 749, 177, -89, 18, 458, 1103, 1750, 2159,
-    2127, 1566, 535, -775, -2090, -3137, -3716, -3730, -3178, -2163, -894, 363,
-    1356, 1903, 1947, 1583, 1013, 476, 170, 211, 602, 1234, 1915, 2411,
-    2519, 2129, 1253, 15, -1362, -2610, -3477, -3793, -3499, -2682, -1555, -380,
-    597, 1190, 1323, 1051, 517, -97, -589, -774, -566, -4, 769, 1539,
-    2069, 2180, 1809, 1020, -30, -1128, -2038, -2556, -2566, -2076, -1212, -189,
-    731, 1311, 1414, 1048, 351, -444, -1078, -1345, -1153, -538, 337, 1232,
-    1910, 2188, 1973, 1287, 288, -777, -1642, -2096, -2053, -1581, -870, -169,
-    276, 305, -93, -783, -1525, -2036, -2081, -1581, -635, 529, 1622, 2365,
-    2566, 2167, 1249, 20, -1205, -2098, -2449, -2245, -1647, -922, -358, -158,
-    -353, -815, -1330, -1659, -1598, -1059, -125, 962, 1892, 2390, 2311, 1680,
-    681, -408, -1300, -1799, -1858, -1578, -1162, -845, -807, -1075, -1509, -1860,
-    -1873, -1395, -444, 793, 2036, 2999, 3472, 3375, 2784, 1899, 987, 299,
-    -11, 59, 356, 620, 604, 174, -633, -1630, -2540, -3082, -3073, -2492,
-    -1481, -296, 780, 1536, 1894, 1935, 1847, 1861, 2156, 2780, 3616, 4431,
-    4962, 5006, 4476, 3430, 2071, 673, -500, -1257, -1531, -1406, -1094, -849,
-    -868, -1228, -1866, -2594, -3169, -3384, -3111, -2331, -1159, 158, 1333, 2134,
-    2441, 2273, 1791, 1229, 807, 674, 881, 1350, 1889, 2261, 2251, 1725,
-    692, -680, -2117, -3335, -4103, -4293, -3917, -3114, -2091, -1091, -351, -35,
-    -180, -686, -1348, -1899, -2094, -1804, -1050, 13, 1140, 2053, 2517, 2407,
-    1727, 602, -751, -2064, -3087, -3653, -3696, -3258, -2491, -1642, -963, -634,
-    -722, -1186, -1890, -2638, -3222, -3450, -3189, -2419, -1250, 107, 1384, 2324,
-    2763, 2671, 2113, 1218, 189, -743, -1398, -1679, -1583, -1221, -792, -480,
-    -403, -613, -1086, -1699, -2267, -2607, -2571, -2075, -1150, 55, 1309, 2370,
-    3036, 3195, 2844, 2084, 1090, 70, -772, -1272, -1335, -980, -339, 393,
-    1000, 1295, 1183, 685, -78, -910, -1580, -1896, -1752, -1150, -208, 855,
-    1788, 2373, 2464, 2039, 1228, 270, -571, -1079, -1138, -764, -82, 723,
-    1431, 1834, 1805, 1353, 613, -176, -757, -946, -680, -11, 898, 1799,
-    2434, 2620, 2291, 1533, 572, -313, -898, -1059, -788, -205, 479, 1020,
-    1213, 956, 320, -470, -1137, -1458, -1317, -738, 115, 989, 1619, 1808,
-    1501, 800, -68, -830, -1253, -1234, -815, -144, 570, 1086, 1225, 946,
-    369, -275, -731, -819, -515, 43, 629, 1001, 985, 546, -192, -1002,
-    -1614, -1804, -1487, -751, 185, 1048, 1587, 1634, 1180, 376, -517, -1210,
-    -1484, -1270, -677, 51, 613, 763, 402, -388, -1376, -2254, -2740, -2674,
-    -2080, -1140, -119, 708, 1143, 1129, 759, 221, -268, -539, -539, -346,
-    -113, -7, -136, -509, -1030, -1521, -1772, -1619, -1014, -61, 1016, 1919,
-    2362, 2188, 1417, 231, -1064, -2115, -2622, -2444, -1619, -357, 1010, 2120,
-    2703, 2651, 2019, 1013, -78, -965, -1435, -1402, -939, -247, 413, 810,
-    813, 438, -165, -775, -1171, -1197, -805, -71, 822, 1639, 2141, 2169,
-    1694, 823, -236, -1215, -1841, -1917, -1397, -407, 782, 1836, 2458, 2467,
-    1841, 713, -666, -1988, -2953, -3328, -3010, -2067, -724, 695, 1869, 2550,
-    2601, 2026, 984, -242, -1344, -2060, -2227, -1830, -996, 50, 1051, 1768,
-    2039, 1826, 1226, 437, -299, -761, -818, -444, 290, 1220, 2111, 2719,
-    2862, 2479, 1646, 561, -505, -1275, -1540, -1228, -410, 711, 1829, 2608,
-    2806, 2349, 1332, -14, -1375, -2453, -3030, -3002, -2396, -1369, -160, 982,
-    1827, 2192, 2017, 1397, 542, -293, -856, -972, -592, 194, 1186, 2137,
-    2820, 3073, 2822, 2108, 1097, 30, -833, -1269, -1151, -516, 443, 1440,
-    2174, 2431, 2166, 1504, 671, -65, -472, -433, 9, 673, 1289, 1573,
-    1357, 642, -411, -1521, -2353, -2629, -2234, -1237, 128, 1506, 2545, 3025,
-    2926, 2402, 1722, 1186, 1011, 1261, 1833, 2482, 2896, 2816, 2140, 956,
-    -472, -1806, -2742, -3093, -2838, -2127, -1237, -448, 50, 216, 160, 103,
-    262, 734, 1463, 2281, 2952, 3253, 3055, 2387, 1419, 413, -368, -750,
-    -715, -401, -45, 101, -133, -751, -1584, -2354, -2791, -2719, -2123, -1163,
-    -121, 718, 1152, 1110, 674, 79, -385, -497, -159, 580, 1499, 2283,
-    2665, 2528, 1910, 1000, 100, -513, -702, -490, -48, 365, 510, 271,
-    -324, -1121, -1882, -2354, -2355, -1836, -887, 268, 1335, 2044, 2225, 1855,
-    1085, 191, -527, -844, -649, 11, 925, 1806, 2388, 2491, 2053, 1177,
-    90, -946, -1713, -2056, -1931, -1437, -787, -220, 63, -42, -507, -1180,
-    -1829, -2214, -2155, -1588, -585, 663, 1886, 2800, 3187, 2956, 2161, 967,
-    -374, -1574, -2374, -2624, -2336, -1674, -894, -259, 56, -20, -455, -1139,
-    -1893, -2495, -2751, -2547, -1878, -871, 251, 1236, 1872, 2009, 1592, 694,
-    -491, -1696, -2656, -3177, -3189, -2740, -1948, -984, -59, 627, 927, 777,
-    218, -595, -1430, -2069, -2345, -2171, -1570, -689, 257, 1043, 1483, 1479,
-    1043, 273, -675, -1591, -2255, -2516, -2338, -1785, -1006, -210, 403, 698,
-    603, 116, -653, -1508, -2232, -2647, -2643, -2207, -1438, -505, 401, 1102,
-    1455, 1404, 1007, 409, -209, -672, -854, -706, -272, 319, 883, 1232,
-    1229, 834, 117, -754, -1562, -2101, -2222, -1877, -1138, -187, 743, 1436,
-    1743, 1611, 1107, 401, -287, -744, -809, -446, 226, 985, 1585, 1810,
-    1558, 891, -6, -901, -1559, -1800, -1572, -967, -172, 594, 1118, 1279,
-    1091, 673, 196, -155, -240, -26, 413, 921, 1310, 1412, 1156, 599,
-    -94, -706, -1038, -966, -482, 296, 1152, 1852, 2219, 2187, 1819, 1289,
-    810, 530, 496, 661, 905, 1071, 1038, 771, 322, -184, -574, -711,
-    -567, -214, 204, 508, 558, 317, -146, -678, -1082, -1174, -877, -242,
-    578, 1367, 1909, 2058, 1782, 1153, 344, -424, -954, -1140, -987, -609,
-    -188, 108, 197, 83, -160, -400, -506, -402, -90, 349, 767, 1002,
-    947, 583, -13, -690, -1246, -1501, -1361, -848, -90, 694, 1272, 1471,
-    1221, 584, -264, -1076, -1614, -1722, -1380, -685, 175, 977, 1529, 1713,
-    1510, 992, 319, -291, -635, -610, -250, 308, 866, 1240, 1309, 1049,
-    520, -149, -789, -1221, -1314, -1029, -438, 313, 1035, 1536, 1660, 1348,
-    664, -222, -1081, -1697, -1929, -1743, -1212, -489, 235, 779, 993, 792,
-    208, -604, -1418, -2015, -2234, -2010, -1388, -506, 450, 1266, 1759, 1827,
-    1477, 822, 58, -605, -1016, -1104, -863, -374, 216, 730, 1005, 905,
-    385, -464, -1440, -2306, -2843, -2913, -2483, -1620, -464, 782, 1884, 2632,
-    2890, 2628, 1939, 1010, 70, -658, -1007, -917, -442, 276, 1027, 1567,
-    1706, 1384, 667, -295, -1284, -2053, -2409, -2265, -1653, -715, 329, 1249,
-    1870, 2095, 1926, 1472, 919, 471, 296, 482, 994, 1678, 2303, 2642,
-    2534, 1930, 909, -334, -1537, -2423, -2783, -2550, -1811, -791, 216, 935,
-    1197, 978, 378, -391, -1061, -1383, -1204, -501, 595, 1810, 2822, 3389,
-    3413, 2951, 2186, 1356, 686, 332, 349, 651, 1026, 1224, 1055, 453,
-    -479, -1496, -2313, -2704, -2552, -1887, -890, 162, 987, 1379, 1275, 795,
-    204, -210, -235, 210, 1046, 2052, 2936, 3431, 3378, 2774, 1775, 644,
-    -341, -980, -1203, -1084, -817, -637, -726, -1130, -1733, -2323, -2667, -2601,
-    -2107, -1315, -442, 288, 713, 796, 632, 388, 244, 338, 702, 1232,
-    1736, 2012, 1913, 1388, 527, -459, -1329, -1887, -2034, -1796, -1324, -831,
-    -523, -539, -895, -1458, -1997, -2270, -2120, -1539, -664, 286, 1077, 1521,
-    1530, 1149, 541, -75, -483, -548, -268, 228, 738, 1052, 1006, 535,
-    -292, -1296, -2236, -2873, -3036, -2685, -1920, -942, 3, 677, 916, 695,
-    143, -519, -1044, -1245, -1049, -506, 246, 1027, 1643, 1920, 1753, 1159,
-    278, -674, -1461, -1900, -1903, -1496, -800, -9, 663, 1030, 991, 567,
-    -97, -791, -1305, -1484, -1258, -672, 135, 979, 1676, 2061, 2036, 1606,
-    872, -4, -830, -1418, -1636, -1437, -874, -88, 717, 1336, 1621, 1496,
-    993, 256, -517, -1131, -1430, -1322, -807, 16, 966, 1815, 2345, 2417,
-    1998, 1169, 104, -956, -1770, -2154, -2018, -1391, -422, 662, 1608, 2199,
-    2306, 1917, 1126, 118, -866, -1586, -1872, -1663, -1027, -145, 739, 1387,
-    1628, 1397, 760, -117, -1026, -1761, -2146, -2085, -1605, -833, 42, 799,
-    1244, 1269, 875, 163, -681, -1427, -1861, -1854, -1400, -621, 275, 1062,
-    1539, 1573, 1135, 305, -736, -1750, -2496, -2816, -2686, -2192, -1510, -851,
-    -409, -308, -566, -1090, -1689, -2129, -2212, -1855, -1119, -187, 704, 1307,
-    1429, 1021, 206, -774, -1642, -2146, -2155, -1706, -978, -205, 381, 608,
-    431, -48, -625, -1066, -1184, -918, -361, 290, 801, 977, 726, 100,
-    -731, -1521, -2031, -2115, -1772, -1139, -424, 153, 437, 382, 55, -390,
-    -769, -929, -801, -433, 24, 376, 467, 250, -202, -722, -1095, -1138,
-    -778, -68, 828, 1680, 2262, 2436, 2186, 1607, 875, 200, -247, -393,
-    -272, -8, 222, 277, 112, -211, -544, -708, -558, -39, 778, 1721,
-    2552, 3033, 3015, 2487, 1581, 540, -357, -890, -947, -555, 135, 903,
-    1516, 1810, 1737, 1362, 833, 329, 5, -72, 70, 326, 560, 646,
-    526, 253, -52, -248, -200, 164, 815, 1622, 2386, 2898, 2989, 2570,
-    1681, 481, -797, -1887, -2541, -2597, -2028, -959, 368, 1668, 2664, 3171,
-    3126, 2558, 1594, 453, -613, -1371, -1670, -1500, -973, -282, 369, 834,
-    1048, 1021, 825, 564, 373, 353, 519, 814, 1124, 1291, 1188, 779,
-    120, -665, -1411, -1945, -2122, -1866, -1174, -141, 1033, 2111, 2879, 3175,
-    2922, 2158, 1027, -256, -1454, -2336, -2720, -2550, -1898, -934, 119, 1039,
-    1660, 1868, 1630, 1014, 179, -652, -1266, -1515, -1359, -883, -255, 338,
-    725, 805, 573, 92, -516, -1079, -1429, -1454, -1133, -537, 190, 853,
-    1269, 1311, 927, 181, -753, -1655, -2307, -2540, -2305, -1681, -843, -8,
-    614, 859, 648, 25, -859, -1777, -2470, -2749, -2547, -1928, -1059, -151,
-    584, 981, 972, 585, -44, -703, -1190, -1391, -1288, -976, -627, -408,
-    -422, -678, -1081, -1460, -1623, -1441, -897, -73, 849, 1643, 2107, 2096,
-    1587, 691, -382, -1369, -2011, -2165, -1842, -1176, -368, 348, 768, 814,
-    553, 136, -241, -408, -317, -40, 294, 538, 584, 404, 62, -300,
-    -507, -419, -9, 619, 1277, 1755, 1887, 1638, 1102, 448, -132, -495,
-    -590, -472, -289, -201, -291, -548, -889, -1173, -1251, -1034, -534, 153,
-    862, 1377, 1516, 1228, 591, -208, -924, -1339, -1330, -897, -163, 654,
-    1309, 1623, 1533, 1093, 453, -169, -583, -702, -554, -264, -9, 49,
-    -168, -611, -1149, -1614, -1843, -1732, -1283, -584, 188, 810, 1096, 965,
-    462, -265, -999, -1531, -1728, -1544, -1012, -277, 447, 960, 1126, 906,
-    388, -262, -857, -1232, -1285, -1004, -464, 192, 786, 1147, 1176, 871,
-    315, -342, -917, -1273, -1336, -1106, -671, -179, 212, 369, 228, -186,
-    -775, -1400, -1908, -2160, -2068, -1626, -905, -49, 741, 1284, 1458, 1225,
-    661, -75, -814, -1383, -1637, -1511, -1035, -326, 434, 1042, 1332, 1238,
-    782, 53, -785, -1547, -2073, -2229, -1964, -1327, -448, 483, 1270, 1757,
-    1850, 1553, 958, 216, -495, -1007, -1199, -1017, -500, 247, 1074, 1789,
-    2215, 2246, 1864, 1157, 285, -577, -1252, -1602, -1570, -1179, -529, 220,
-    885, 1305, 1411, 1228, 838, 378, 0, -196, -140, 174, 675, 1256,
-    1769, 2059, 2029, 1656, 994, 175, -632, -1246, -1528, -1427, -964, -250,
-    528, 1194, 1595, 1640, 1344, 800, 166, -355, -616, -543, -152, 428,
-    1016, 1442, 1573, 1366, 848, 123, -625, -1188, -1394, -1157, -550, 244,
-    1000, 1478, 1545, 1207, 551, -231, -897, -1256, -1206, -774, -111, 563,
-    1018, 1122, 870, 329, -337, -915, -1238, -1196, -789, -173, 442, 850,
-    902, 598, 69, -496, -898, -1002, -759, -235, 381, 880, 1087, 886,
-    327, -405, -1080, -1467, -1450, -1062, -427, 237, 705, 849, 635, 133,
-    -481, -1011, -1273, -1182, -799, -262, 226, 484, 475, 277, 36, -72,
-    38, 363, 845, 1343, 1706, 1822, 1627, 1164, 575, 28, -305, -342,
-    -130, 211, 501, 585, 388, -88, -726, -1317, -1678, -1665, -1228, -485,
-    375, 1149, 1645, 1760, 1496, 962, 354, -142, -388, -311, 33, 518,
-    988, 1261, 1235, 899, 319, -320, -813, -1019, -864, -399, 214, 787,
-    1136, 1139, 783, 141, -613, -1267, -1659, -1673, -1294, -622, 200, 981,
-    1516, 1693, 1492, 984, 347, -221, -554, -559, -260, 257, 852, 1334,
-    1558, 1446, 987, 273, -545, -1284, -1754, -1839, -1511, -826, 49, 906,
-    1553, 1814, 1614, 1017, 167, -730, -1451, -1829, -1787, -1354, -645, 178,
-    901, 1336, 1379, 1002, 313, -475, -1143, -1499, -1423, -923, -95, 908,
-    1890, 2657, 3057, 3025, 2592, 1842, 923, 18, -711, -1132, -1159, -806,
-    -178, 557, 1198, 1587, 1640, 1360, 848, 251, -289, -645, -741, -560,
-    -152, 368, 858, 1193, 1285, 1106, 698, 158, -368, -738, -846, -630,
-    -114, 592, 1330, 1917, 2191, 2077, 1598, 851, -7, -785, -1304, -1453,
-    -1213, -650, 99, 836, 1371, 1564, 1367, 854, 177, -480, -933, -1059,
-    -832, -319, 329, 914, 1258, 1244, 862, 219, -495, -1066, -1327, -1208,
-    -756, -123, 483, 893, 1000, 785, 330, -213, -665, -871, -761, -368,
-    186, 705, 994, 931, 501, -209, -1027, -1741, -2147, -2132, -1721, -1058,
-    -361, 144, 325, 180, -180, -578, -849, -856, -546, 4, 629, 1123,
-    1293, 1048, 454, -309, -1007, -1430, -1461, -1116, -529, 104, 582, 736,
-    513, -5, -662, -1243, -1540, -1467, -1074, -503, 48, 400, 451, 214,
-    -195, -613, -878, -882, -637, -252, 107, 248, 64, -417, -1064, -1677,
-    -2047, -2029, -1585, -793, 169, 1076, 1701, 1894, 1626, 982, 139, -675,
-    -1272, -1544, -1488, -1221, -906, -689, -646, -753, -904, -956, -776, -311,
-    387, 1182, 1877, 2280, 2254, 1739, 793, -413, -1651, -2668, -3229, -3185,
-    -2516, -1350, 62, 1424, 2451, 2952, 2881, 2310, 1408, 405, -482, -1098,
-    -1375, -1324, -1009, -548, -92, 257, 457, 515, 483, 440, 461, 580,
-    762, 944, 1055, 1008, 755, 303, -273, -838, -1234, -1346, -1111, -533,
-    302, 1236, 2079, 2649, 2801, 2450, 1620, 453, -829, -1956, -2669, -2802,
-    -2325, -1339, -66, 1233, 2331, 3059, 3323, 3103, 2456, 1519, 476, -467,
-    -1120, -1377, -1227, -731, -13, 766, 1452, 1924, 2130, 2082, 1843, 1518,
-    1211, 980, 842, 787, 770, 721, 581, 333, 9, -329, -580, -630,
-    -414, 70, 774, 1589, 2363, 2934, 3154, 2928, 2244, 1191, -52, -1267,
-    -2234, -2763, -2749, -2192, -1184, 104, 1430, 2528, 3176, 3267, 2820, 1952,
-    852, -264, -1216, -1869, -2154, -2072, -1695, -1151, -577, -70, 318, 578,
-    733, 805, 815, 782, 707, 580, 365, 9, -492, -1068, -1598, -1938,
-    -1976, -1683, -1130, -452, 196, 652, 760, 441, -275, -1268, -2330, -3211,
-    -3703, -3707, -3231, -2383, -1340, -316, 505, 1008, 1149, 972, 607, 198,
-    -150, -387, -531, -649, -836, -1146, -1553, -1974, -2283, -2342, -2074, -1513,
-    -787, -93, 352, 400, 32, -632, -1390, -2018, -2328, -2227, -1742, -987,
-    -151, 540, 905, 863, 451, -185, -840, -1331, -1559, -1532, -1346, -1161,
-    -1152, -1404, -1876, -2411, -2780, -2761, -2248, -1287, -52, 1207, 2236, 2826,
-    2873, 2394, 1521, 484, -479, -1206, -1639, -1822, -1873, -1916, -2024, -2203,
-    -2391, -2476, -2340, -1926, -1264, -458, 330, 913, 1145, 984, 496, -151,
-    -739, -1064, -985, -472, 367, 1322, 2155, 2647, 2633, 2072, 1079, -117,
-    -1265, -2142, -2602, -2625, -2302, -1781, -1234, -815, -609, -612, -732, -837,
-    -803, -557, -99, 507, 1147, 1678, 1977, 1975, 1682, 1186, 632, 175,
-    -62, -22, 270, 719, 1186, 1505, 1531, 1179, 470, -478, -1484, -2344,
-    -2875, -2956, -2554, -1715, -566, 688, 1825, 2649, 3018, 2882, 2309, 1477,
-    605, -111, -524, -560, -239, 336, 1000, 1573, 1908, 1907, 1551, 917,
-    161, -548, -1062, -1277, -1154, -736, -139, 489, 1001, 1291, 1324, 1128,
-    795, 467, 283, 325, 612, 1092, 1638, 2079, 2265, 2095, 1540, 669,
-    -348, -1302, -1996, -2279, -2089, -1473, -565, 444, 1332, 1887, 1979, 1610,
-    902, 57, -702, -1185, -1282, -992, -418, 256, 823, 1106, 1018, 591,
-    -35, -673, -1135, -1290, -1096, -616, 3, 557, 848, 769, 340, -318,
-    -1011, -1515, -1666, -1412, -817, -42, 678, 1115, 1136, 736, 18, -824,
-    -1555, -1966, -1934, -1459, -676, 184, 884, 1238, 1164, 720, 70, -577,
-    -1015, -1099, -811, -276, 304, 725, 837, 605, 134, -402, -818, -955,
-    -726, -176, 518, 1129, 1448, 1374, 956, 360, -211, -584, -649, -411,
-    21, 486, 802, 828, 531, 18, -519, -890, -956, -680, -154, 439,
-    898, 1061, 853, 338, -299, -827, -1050, -861, -286, 519, 1319, 1875,
-    2007, 1655, 910, 0, -812, -1312, -1389, -1063, -465, 200, 720, 945,
-    837, 485, 70, -214, -236, 22, 462, 926, 1257, 1329, 1083, 561,
-    -96, -693, -1036, -997, -579, 91, 822, 1421, 1720, 1632, 1182, 496,
-    -240, -819, -1074, -947, -494, 143, 761, 1155, 1192, 851, 217, -533,
-    -1170, -1507, -1457, -1032, -332, 465, 1144, 1515, 1472, 1017, 268, -576,
-    -1305, -1744, -1788, -1428, -759, 43, 773, 1240, 1326, 1025, 430, -310,
-    -1021, -1518, -1666, -1416, -814, 9, 854, 1518, 1855, 1803, 1382, 691,
-    -93, -768, -1177, -1233, -945, -408, 237, 853, 1315, 1523, 1427, 1049,
-    473, -152, -659, -926, -890, -551, 10, 646, 1203, 1569, 1666, 1481,
-    1093, 632, 224, -8, 30, 352, 879, 1481, 1999, 2267, 2185, 1744,
-    1013, 119, -764, -1452, -1790, -1698, -1192, -372, 614, 1583, 2339, 2734,
-    2709, 2286, 1561, 709, -64, -590, -755, -531, 13, 729, 1442, 1970,
-    2172, 2003, 1516, 827, 116, -405, -586, -396, 100, 758, 1365, 1725,
-    1730, 1349, 639, -241, -1068, -1642, -1819, -1554, -930, -138, 606, 1099,
-    1193, 859, 202, -585, -1278, -1661, -1619, -1168, -421, 458, 1269, 1822,
-    1997, 1780, 1257, 596, -9, -402, -499, -327, -23, 229, 268, -7,
-    -601, -1385, -2144, -2666, -2798, -2465, -1720, -743, 228, 966, 1303, 1191,
-    739, 162, -314, -526, -404, 2, 540, 1007, 1216, 1069, 581, -121,
-    -847, -1422, -1753, -1852, -1802, -1727, -1754, -1952, -2294, -2665, -2900, -2828,
-    -2343, -1469, -370, 717, 1551, 1950, 1848, 1326, 576, -171, -711, -928,
-    -832, -553, -262, -116, -213, -565, -1068, -1546, -1833, -1825, -1531, -1085,
-    -699, -547, -719, -1204, -1880, -2530, -2922, -2888, -2353, -1370, -137, 1060,
-    1967, 2425, 2398, 1965, 1290, 560, -48, -419, -541, -502, -442, -502,
-    -771, -1247, -1828, -2360, -2676, -2642, -2204, -1428, -470, 457, 1134, 1409,
-    1258, 767, 104, -515, -875, -837, -393, 344, 1166, 1834, 2145, 1997,
-    1395, 452, -629, -1614, -2295, -2533, -2286, -1627, -714, 250, 1071, 1599,
-    1754, 1551, 1095, 551, 90, -159, -136, 138, 560, 986, 1262, 1271,
-    970, 417, -255, -881, -1302, -1396, -1121, -539, 216, 966, 1516, 1708,
-    1476, 864, 3, -923, -1700, -2130, -2089, -1553, -601, 595, 1799, 2771,
-    3320, 3340, 2835, 1924, 817, -255, -1083, -1512, -1473, -1005, -235, 651,
-    1443, 1952, 2070, 1799, 1236, 539, -122, -601, -796, -674, -284, 247,
-    760, 1109, 1208, 1049, 691, 252, -127, -310, -204, 208, 859, 1588,
-    2187, 2478, 2361, 1840, 1020, 83, -768, -1345, -1494, -1148, -385, 608,
-    1590, 2315, 2582, 2319, 1607, 623, -406, -1239, -1684, -1647, -1155, -348,
-    549, 1297, 1724, 1763, 1454, 937, 405, 25, -103, 34, 354, 703,
-    907, 844, 488, -77, -683, -1127, -1233, -908, -182, 801, 1809, 2573,
-    2873, 2617, 1864, 798, -315, -1198, -1661, -1646, -1215, -526, 195, 742,
-    998, 943, 653, 291, 46, 41, 284, 677, 1043, 1196, 1029, 554,
-    -119, -806, -1301, -1440, -1173, -567, 206, 907, 1321, 1338, 985, 398,
-    -232, -721, -942, -857, -531, -121, 192, 278, 116, -204, -528, -712,
-    -669, -404, -2, 390, 617, 553, 141, -560, -1363, -2014, -2294, -2092,
-    -1436, -492, 488, 1254, 1622, 1517, 996, 233, -556, -1172, -1489, -1477,
-    -1214, -846, -527, -370, -421, -631, -872, -1002, -924, -630, -189, 266,
-    576, 599, 272, -367, -1189, -1991, -2549, -2690, -2359, -1614, -612, 423,
-    1250, 1666, 1573, 998, 98, -896, -1739, -2255, -2365, -2098, -1565, -933,
-    -374, -30, 34, -160, -505, -852, -1068, -1074, -865, -500, -89, 241,
-    383, 274, -88, -635, -1238, -1759, -2074, -2090, -1778, -1199, -472, 257,
-    829, 1099, 991, 524, -206, -1040, -1786, -2265, -2366, -2070, -1446, -640,
-    164, 787, 1081, 973, 497, -219, -996, -1656, -2055, -2111, -1817, -1236,
-    -483, 289, 916, 1273, 1303, 1031, 562, 35, -423, -729, -850, -798,
-    -635, -459, -367, -416, -617, -931, -1267, -1508, -1539, -1288, -743, 41,
-    950, 1830, 2518, 2884, 2850, 2406, 1626, 650, -332, -1127, -1576, -1596,
-    -1215, -565, 169, 797, 1158, 1162, 820, 250, -377, -879, -1117, -1013,
-    -578, 98, 868, 1566, 2045, 2210, 2047, 1626, 1086, 586, 263, 179,
-    317, 596, 899, 1083, 1027, 683, 92, -625, -1290, -1723, -1793, -1466,
-    -807, 28, 836, 1429, 1692, 1607, 1266, 830, 483, 369, 543, 958,
-    1500, 2034, 2417, 2541, 2380, 2013, 1569, 1183, 962, 937, 1040, 1150,
-    1139, 916, 456, -179, -853, -1392, -1625, -1440, -842, 48, 1027, 1857,
-    2337, 2378, 2024, 1415, 750, 237, 14, 107, 446, 895, 1281, 1459,
-    1372, 1060, 642, 275, 81, 77, 199, 345, 405, 293, -7, -428,
-    -837, -1076, -1012, -599, 108, 955, 1737, 2261, 2417, 2200, 1684, 1002,
-    323, -198, -479, -528, -429, -295, -224, -267, -424, -640, -807, -821,
-    -633, -252, 244, 716, 998, 978, 636, 44, -647, -1243, -1568, -1530,
-    -1136, -491, 214, 766, 1006, 868, 386, -313, -1040, -1611, -1888, -1810,
-    -1413, -834, -255, 172, 343, 225, -121, -559, -955, -1206, -1241, -1039,
-    -670, -268, 24, 99, -92, -519, -1068, -1583, -1911, -1946, -1654, -1094,
-    -400, 249, 682, 789, 540, -11, -758, -1550, -2211, -2583, -2579, -2198,
-    -1528, -732, -15, 447, 561, 328, -193, -884, -1565, -2052, -2229, -2066,
-    -1610, -984, -360, 101, 301, 212, -126, -602, -1060, -1348, -1363, -1100,
-    -642, -129, 294, 501, 412, 26, -582, -1278, -1894, -2259, -2256, -1867,
-    -1176, -345, 433, 977, 1160, 937, 354, -452, -1296, -1993, -2400, -2436,
-    -2108, -1510, -795, -125, 353, 530, 369, -66, -623, -1128, -1437, -1461,
-    -1181, -667, -60, 470, 776, 757, 403, -186, -829, -1335, -1559, -1427,
-    -964, -303, 360, 834, 971, 715, 145, -548, -1151, -1498, -1482, -1086,
-    -403, 381, 1049, 1407, 1346, 898, 221, -470, -979, -1167, -996, -533,
-    75, 638, 973, 963, 615, 57, -505, -861, -876, -529, 90, 812,
-    1426, 1747, 1674, 1233, 569, -95, -544, -641, -363, 194, 843, 1382,
-    1663, 1624, 1301, 831, 396, 151, 165, 403, 745, 1030, 1124, 965,
-    579, 84, -349, -558, -440, 10, 687, 1398, 1945, 2171, 2000, 1477,
-    765, 80, -379, -491, -239, 274, 867, 1350, 1574, 1484, 1132, 661,
-    254, 74, 194, 554, 1013, 1414, 1611, 1521, 1152, 614, 75, -283,
-    -327, -29, 512, 1118, 1606, 1839, 1761, 1400, 858, 293, -114, -224,
-    -3, 466, 1014, 1449, 1636, 1534, 1180, 665, 132, -262, -395, -223,
-    206, 749, 1221, 1466, 1414, 1083, 562, -12, -484, -710, -607, -195,
-    406, 1022, 1474, 1638, 1466, 999, 351, -318, -844, -1097, -1009, -613,
-    -27, 598, 1120, 1425, 1446, 1198, 773, 304, -69, -227, -130, 172,
-    573, 948, 1163, 1114, 766, 160, -599, -1360, -1951, -2239, -2164, -1728,
-    -1013, -169, 623, 1196, 1441, 1337, 957, 435, -69, -406, -477, -272,
-    150, 689, 1211, 1584, 1703, 1519, 1053, 385, -357, -1024, -1476, -1630,
-    -1482, -1091, -556, -14, 390, 571, 514, 256, -118, -487, -732, -764,
-    -544, -85, 528, 1162, 1679, 1970, 1977, 1705, 1203, 563, -81, -593,
-    -872, -878, -622, -192, 261, 587, 685, 503, 60, -538, -1128, -1562,
-    -1730, -1573, -1109, -439, 283, 888, 1239, 1273, 1005, 521, -45, -533,
-    -811, -808, -508, 27, 643, 1146, 1390, 1306, 901, 266, -431, -1005,
-    -1316, -1295, -962, -430, 129, 547, 710, 588, 247, -180, -537, -694,
-    -575, -192, 349, 886, 1262, 1361, 1137, 646, 33, -524, -877, -939,
-    -714, -304, 121, 392, 407, 152, -310, -844, -1268, -1427, -1255, -788,
-    -140, 517, 992, 1159, 1004, 608, 104, -355, -641, -709, -607, -456,
-    -395, -522, -846, -1290, -1715, -1957, -1908, -1568, -1033, -437, 78, 392,
-    474, 390, 249, 142, 137, 246, 398, 463, 326, -58, -641, -1285,
-    -1806, -2054, -1959, -1551, -949, -332, 132, 332, 236, -98, -521, -849,
-    -943, -754, -331, 196, 646, 845, 700, 227, -453, -1150, -1653, -1811,
-    -1579, -1033, -346, 261, 597, 571, 197, -405, -1042, -1511, -1677, -1508,
-    -1062, -480, 45, 341, 322, 6, -496, -1013, -1362, -1416, -1144, -612,
-    36, 620, 977, 1009, 696, 105, -631, -1328, -1798, -1911, -1628, -1020,
-    -253, 459, 928, 1041, 775, 202, -513, -1172, -1593, -1655, -1323, -674,
-    134, 902, 1441, 1600, 1327, 673, -219, -1133, -1841, -2186, -2112, -1659,
-    -963, -242, 280, 443, 178, -475, -1355, -2228, -2877, -3136, -2915, -2224,
-    -1172, 79, 1336, 2399, 3103, 3376, 3243, 2820, 2276, 1790, 1513, 1549,
-    1908, 2495, 3147, 3683, 3920, 3715, 3020, 1894, 460, -1110, -2621, -3896,
-    -4824, -5359, -5506, -5313, -4855, -4206, -3421, -2535, -1568, -510, 676, 1997,
-    3384, 4703, 5798, 6516, 6717, 6324, 5359, 3929, 2205, 399, -1266, -2612,
-    -3533, -4017, -4151, -4068, -3876, -3644, -3403, -3118, -2698, -2048, -1113, 109,
-    1549, 3057, 4443, 5522, 6138, 6196, 5688, 4694, 3367, 1920, 575, -492,
-    -1195, -1552, -1669, -1683, -1696, -1769, -1925, -2133, -2291, -2282, -2021, -1472,
-    -657, 330, 1341, 2223, 2847, 3144, 3126, 2889, 2576, 2327, 2231, 2280,
-    2368, 2335, 2044, 1440, 567, -447, -1429, -2190, -2584, -2567, -2202, -1633,
-    -1039, -584, -365, -370, -492, -581, -493, -151, 426, 1127, 1783, 2211,
-    2284, 1983, 1405, 713, 97, -286, -371, -197, 107, 369, 438, 257,
-    -104, -493, -722, -631, -159, 613, 1497, 2275, 2747, 2785, 2394, 1724,
-    1004, 471, 293, 512, 1019, 1604, 2029, 2115, 1783, 1085, 189, -668,
-    -1250, -1405, -1113, -494, 232, 806, 1037, 869, 396, -189, -662, -831,
-    -609, -42, 705, 1417, 1894, 2019, 1785, 1287, 690, 173, -134, -182,
-    -14, 256, 475, 502, 261, -237, -899, -1571, -2082, -2294, -2135, -1631,
-    -899, -105, 588, 1059, 1263, 1236, 1076, 905, 842, 979, 1352, 1921,
-    2565, 3126, 3451, 3436, 3058, 2369, 1473, 497, -418, -1145, -1590, -1715,
-    -1557, -1237, -914, -734, -784, -1073, -1525, -1993, -2309, -2330, -1961, -1203,
-    -172, 930, 1887, 2511, 2680, 2368, 1649, 679, -328, -1159, -1655, -1759,
-    -1512, -1045, -544, -182, -61, -202, -573, -1079, -1593, -1985, -2152, -2033,
-    -1618, -963, -180, 588, 1201, 1549, 1573, 1271, 697, -46, -825, -1501,
-    -1950, -2098, -1947, -1550, -991, -391, 106, 386, 401, 157, -278, -770,
-    -1163, -1343, -1259, -930, -446, 45, 396, 498, 301, -159, -770, -1378,
-    -1827, -2002, -1858, -1441, -864, -282, 151, 329, 217, -146, -660, -1178,
-    -1543, -1645, -1457, -1032, -494, 0, 314, 364, 141, -282, -762, -1140,
-    -1301, -1197, -864, -414, -3, 241, 249, 17, -398, -873, -1263, -1445,
-    -1366, -1055, -630, -253, -68, -151, -481, -942, -1355, -1560, -1462, -1058,
-    -449, 190, 671, 860, 705, 248, -377, -979, -1385, -1491, -1287, -865,
-    -389, -50, 8, -252, -751, -1325, -1764, -1889, -1629, -1044, -289, 436,
-    931, 1072, 859, 393, -168, -641, -880, -847, -607, -278, -11, 54,
-    -123, -473, -877, -1193, -1284, -1097, -705, -240, 151, 330, 232, -87,
-    -491, -824, -936, -750, -327, 161, 532, 640, 411, -108, -754, -1332,
-    -1675, -1680, -1340, -767, -140, 362, 614, 580, 321, -29, -309, -395,
-    -250, 73, 459, 758, 822, 581, 70, -598, -1262, -1737, -1865, -1593,
-    -980, -179, 600, 1138, 1292, 1036, 462, -260, -924, -1337, -1378, -1033,
-    -401, 350, 1022, 1434, 1476, 1160, 602, -22, -528, -766, -685, -336,
-    161, 647, 957, 974, 678, 141, -501, -1069, -1394, -1371, -990, -322,
-    493, 1279, 1858, 2096, 1934, 1413, 657, -149, -801, -1129, -1061, -629,
-    51, 803, 1426, 1763, 1743, 1379, 765, 65, -528, -862, -847, -482,
-    131, 827, 1436, 1819, 1889, 1640, 1143, 511, -122, -610, -828, -720,
-    -314, 301, 983, 1570, 1931, 2003, 1789, 1358, 828, 340, 17, -64,
-    100, 445, 871, 1263, 1509, 1518, 1248, 728, 60, -605, -1098, -1281,
-    -1105, -612, 86, 834, 1464, 1827, 1846, 1536, 991, 359, -192, -530,
-    -600, -431, -108, 247, 498, 545, 362, 3, -432, -813, -1024, -1000,
-    -743, -316, 172, 585, 805, 769, 493, 58, -405, -749, -854, -663,
-    -218, 358, 902, 1266, 1350, 1134, 692, 163, -306, -595, -639, -450,
-    -119, 223, 451, 488, 331, 46, -251, -441, -437, -221, 156, 589,
-    937, 1078, 954, 592, 84, -435, -823, -979, -883, -594, -225, 83,
-    207, 95, -224, -644, -1007, -1160, -1030, -641, -87, 494, 956, 1187,
-    1156, 906, 535, 182, -25, -22, 153, 396, 575, 577, 342, -107,
-    -670, -1196, -1534, -1578, -1318, -845, -312, 128, 377, 414, 287, 92,
-    -53, -47, 154, 513, 922, 1247, 1378, 1284, 1014, 664, 346, 168,
-    197, 428, 784, 1145, 1375, 1368, 1091, 598, 1, -572, -1000, -1196,
-    -1136, -881, -559, -302, -206, -312, -606, -1014, -1418, -1684, -1693, -1376,
-    -762, 21, 795, 1396, 1712, 1707, 1425, 965, 458, 44, -165, -136,
-    81, 384, 658, 805, 764, 520, 107, -389, -847, -1145, -1196, -979,
-    -539, 28, 613, 1091, 1341, 1295, 979, 495, -15, -408, -588, -534,
-    -284, 97, 503, 800, 880, 688, 245, -348, -937, -1378, -1574, -1475,
-    -1080, -463, 252, 921, 1410, 1623, 1537, 1201, 705, 173, -263, -502,
-    -499, -268, 107, 499, 772, 823, 603, 139, -469, -1075, -1523, -1675,
-    -1469, -942, -204, 599, 1302, 1756, 1887, 1691, 1228, 614, 3, -466,
-    -699, -659, -382, 20, 393, 604, 576, 284, -217, -803, -1321, -1641,
-    -1685, -1431, -922, -264, 400, 918, 1164, 1069, 663, 61, -583, -1112,
-    -1398, -1371, -1053, -534, 49, 519, 716, 560, 81, -604, -1324, -1901,
-    -2198, -2151, -1768, -1142, -447, 120, 409, 364, 29, -471, -967, -1298,
-    -1354, -1116, -656, -114, 343, 578, 536, 268, -113, -466, -649, -559,
-    -201, 315, 815, 1127, 1121, 770, 170, -511, -1084, -1386, -1333, -943,
-    -347, 254, 654, 720, 441, -83, -685, -1178, -1406, -1299, -906, -376,
-    82, 278, 120, -342, -945, -1479, -1755, -1660, -1191, -464, 314, 915,
-    1167, 1011, 518, -129, -698, -991, -916, -518, 49, 570, 848, 775,
-    387, -172, -709, -1046, -1071, -776, -273, 247, 597, 652, 399, -49,
-    -494, -743, -683, -320, 234, 806, 1216, 1339, 1152, 726, 210, -216,
-    -408, -303, 58, 558, 1028, 1293, 1240, 872, 297, -319, -803, -1021,
-    -918, -535, 12, 561, 940, 1025, 794, 328, -217, -662, -851, -709,
-    -266, 369, 1051, 1621, 1933, 1902, 1544, 978, 366, -128, -375, -319,
-    -6, 449, 914, 1258, 1376, 1225, 844, 329, -187, -557, -668, -485,
-    -54, 519, 1090, 1504, 1648, 1491, 1071, 493, -92, -524, -691, -560,
-    -166, 405, 1010, 1485, 1694, 1580, 1170, 563, -85, -603, -859, -791,
-    -422, 162, 831, 1434, 1829, 1913, 1656, 1124, 450, -202, -685, -895,
-    -800, -436, 96, 661, 1117, 1353, 1318, 1040, 618, 182, -146, -283,
-    -194, 107, 548, 1000, 1315, 1380, 1159, 695, 89, -519, -1001, -1268,
-    -1273, -1014, -551, -13, 453, 737, 783, 591, 223, -210, -580, -770,
-    -710, -402, 73, 577, 963, 1111, 976, 597, 70, -481, -925, -1150,
-    -1104, -814, -358, 147, 571, 807, 810, 599, 244, -143, -439, -554,
-    -450, -151, 268, 684, 967, 1020, 809, 373, -172, -674, -1000, -1061,
-    -835, -388, 133, 558, 761, 686, 354, -134, -628, -977, -1075, -889,
-    -472, 57, 559, 913, 1053, 994, 812, 612, 492, 516, 690, 943,
-    1152, 1186, 969, 509, -97, -711, -1185, -1392, -1287, -919, -406, 107,
-    475, 598, 465, 162, -171, -383, -368, -97, 371, 898, 1306, 1449,
-    1281, 855, 287, -268, -647, -745, -557, -183, 222, 499, 546, 351,
-    -7, -392, -668, -741, -580, -229, 202, 580, 804, 819, 631, 324,
-    28, -144, -133, 62, 370, 663, 823, 795, 595, 295, -5, -212,
-    -266, -141, 132, 449, 667, 674, 426, -28, -562, -1025, -1311, -1352,
-    -1121, -663, -89, 457, 833, 944, 784, 436, 24, -322, -490, -428,
-    -157, 255, 699, 1042, 1181, 1082, 768, 313, -168, -542, -713, -634,
-    -328, 105, 530, 837, 954, 848, 550, 152, -220, -453, -466, -248,
-    141, 598, 1010, 1272, 1300, 1060, 583, -35, -659, -1157, -1437, -1444,
-    -1175, -695, -128, 379, 683, 692, 413, -57, -590, -1064, -1370, -1427,
-    -1206, -758, -199, 322, 677, 794, 667, 345, -101, -581, -997, -1245,
-    -1258, -1031, -622, -126, 355, 721, 892, 819, 516, 57, -438, -839,
-    -1042, -1004, -755, -371, 44, 376, 528, 447, 145, -302, -778, -1165,
-    -1368, -1337, -1083, -689, -278, 33, 164, 78, -209, -626, -1063, -1391,
-    -1502, -1352, -973, -456, 59, 427, 553, 415, 43, -474, -993, -1353,
-    -1446, -1249, -821, -285, 214, 549, 637, 454, 44, -484, -988, -1331,
-    -1421, -1247, -878, -429, -27, 212, 230, 47, -253, -559, -758, -763,
-    -557, -190, 247, 632, 841, 790, 482, -4, -532, -929, -1062, -899,
-    -504, -6, 425, 622, 515, 154, -330, -772, -1009, -943, -596, -73,
-    483, 923, 1128, 1073, 834, 527, 269, 147, 172, 265, 315, 236,
-    -5, -381, -810, -1169, -1335, -1227, -860, -337, 189, 561, 669, 509,
-    179, -177, -420, -443, -219, 197, 678, 1067, 1211, 1032, 581, 9,
-    -507, -805, -799, -523, -103, 296, 523, 477, 159, -326, -820, -1165,
-    -1238, -1000, -523, 46, 540, 814, 794, 517, 121, -223, -377, -282,
-    26, 433, 795, 983, 921, 604, 111, -409, -796, -929, -760, -335,
-    221, 743, 1081, 1132, 878, 402, -149, -616, -873, -845, -538, -34,
-    530, 1001, 1241, 1178, 834, 316, -226, -641, -827, -747, -429, 30,
-    473, 740, 745, 484, 33, -472, -876, -1072, -1005, -655, -76, 598,
-    1201, 1586, 1651, 1374, 834, 172, -458, -903, -1036, -819, -321, 314,
-    906, 1282, 1343, 1071, 517, -203, -924, -1483, -1762, -1695, -1287, -640,
-    88, 743, 1200, 1373, 1253, 904, 431, -48, -418, -590, -526, -245,
-    174, 600, 898, 981, 829, 473, -18, -537, -962, -1184, -1135, -818,
-    -310, 259, 745, 1024, 1033, 772, 298, -281, -804, -1110, -1101, -778,
-    -225, 408, 957, 1285, 1300, 973, 361, -398, -1135, -1691, -1939, -1831,
-    -1421, -829, -209, 283, 522, 465, 152, -309, -769, -1079, -1144, -939,
-    -508, 38, 537, 846, 890, 668, 246, -244, -651, -861, -825, -562,
-    -167, 219, 455, 449, 186, -276, -825, -1312, -1586, -1551, -1206, -637,
-    7, 560, 885, 926, 701, 297, -149, -480, -590, -445, -90, 342,
-    685, 809, 669, 290, -228, -730, -1070, -1152, -949, -535, -73, 268,
-    375, 213, -172, -645, -1038, -1227, -1150, -825, -352, 111, 425, 520,
-    410, 183, -40, -167, -162, -46, 108, 201, 163, -19, -297, -583,
-    -770, -787, -621, -330, -20, 197, 243, 91, -224, -588, -843, -865,
-    -626, -194, 286, 655, 810, 738, 501, 208, -26, -124, -60, 151,
-    420, 608, 594, 340, -111, -647, -1104, -1333, -1261, -896, -315, 336,
-    882, 1187, 1189, 911, 451, -37, -407, -562, -456, -113, 364, 830,
-    1143, 1215, 1037, 677, 248, -128, -344, -352, -165, 153, 501, 759,
-    834, 699, 391, -3, -365, -579, -586, -372, 39, 559, 1049, 1376,
-    1453, 1249, 796, 205, -380, -837, -1082, -1055, -741, -192, 473, 1100,
-    1535, 1664, 1451, 964, 337, -286, -780, -1039, -1007, -709, -245, 256,
-    667, 887, 874, 656, 306, -89, -435, -638, -631, -404, -9, 448,
-    848, 1095, 1132, 939, 554, 70, -395, -733, -856, -708, -316, 215,
-    749, 1166, 1362, 1274, 909, 340, -315, -918, -1335, -1469, -1288, -826,
-    -183, 502, 1086, 1439, 1472, 1177, 636, -13, -611, -1014, -1140, -997,
-    -641, -160, 325, 683, 814, 676, 299, -204, -673, -962, -990, -755,
-    -329, 166, 587, 816, 794, 545, 147, -287, -633, -781, -693, -396,
-    42, 508, 859, 975, 805, 359, -273, -928, -1435, -1674, -1588, -1185,
-    -577, 68, 601, 909, 931, 684, 272, -169, -510, -650, -557, -306,
-    -21, 174, 185, -17, -370, -745, -1007, -1060, -875, -498, -36, 377,
-    616, 614, 392, 47, -279, -445, -368, -60, 390, 840, 1142, 1180,
-    926, 452, -104, -582, -844, -826, -564, -183, 161, 340, 286, 11,
-    -386, -745, -918, -826, -490, -19, 425, 686, 672, 374, -132, -697,
-    -1143, -1327, -1195, -801, -281, 191, 468, 483, 267, -74, -396, -569,
-    -513, -234, 159, 505, 669, 595, 314, -66, -390, -526, -414, -74,
-    398, 851, 1142, 1183, 965, 560, 95, -289, -478, -426, -163, 215,
-    575, 787, 771, 536, 176, -183, -419, -437, -214, 181, 621, 978,
-    1145, 1063, 758, 322, -138, -509, -678, -582, -240, 259, 787, 1207,
-    1409, 1350, 1061, 622, 131, -298, -548, -556, -347, -11, 334, 572,
-    620, 466, 156, -241, -635, -910, -973, -795, -409, 94, 573, 895,
-    983, 820, 439, -68, -580, -991, -1218, -1214, -984, -597, -147, 267,
-    543, 613, 476, 192, -150, -452, -622, -604, -387, -23, 390, 736,
-    914, 859, 552, 30, -623, -1296, -1851, -2156, -2144, -1838, -1326, -729,
-    -183, 197, 337, 232, -64, -435, -709, -709, -334, 411, 1433, 2586,
-    3688, 4557, 5043, 5054, 4581, 3719, 2625, 1453, 324, -675, -1497, -2167,
-    -2760, -3361, -4030, -4755, -5427, -5878, -5932, -5458, -4420, -2898, -1048, 926,
-    2783, 4281, 5247, 5598, 5344, 4590, 3522, 2362, 1314, 518, -3, -360,
-    -741, -1315, -2159, -3233, -4364, -5314, -5842, -5775, -5058, -3778, -2141, -408,
-    1171, 2396, 3155, 3441, 3357, 3073, 2757, 2532, 2446, 2453, 2407, 2148,
-    1576, 669, -511, -1801, -2976, -3837, -4249, -4163, -3637, -2823, -1901, -1036,
-    -353, 95, 345, 508, 710, 1043, 1516, 2052, 2524, 2793, 2757, 2392,
-    1763, 994, 217, -454, -964, -1324, -1590, -1823, -2072, -2343, -2591, -2726,
-    -2649, -2294, -1678, -911, -161, 405, 685, 670, 455, 192, 28, 62,
-    303, 656, 964, 1071, 870, 363, -337, -1061, -1626, -1865, -1684, -1109,
-    -276, 617, 1355, 1777, 1836, 1602, 1220, 865, 697, 787, 1094, 1489,
-    1796, 1861, 1614, 1098, 427, -243, -745, -955, -823, -373, 265, 872,
-    1223, 1193, 778, 81, -706, -1365, -1722, -1694, -1299, -651, 65, 662,
-    1001, 1020, 747, 287, -208, -572, -674, -456, 30, 640, 1175, 1454,
-    1380, 949, 243, -591, -1370, -1928, -2144, -1989, -1534, -929, -350, 50,
-    163, -29, -433, -884, -1190, -1187, -791, -40, 932, 1942, 2800, 3358,
-    3536, 3332, 2815, 2115, 1386, 759, 324, 106, 54, 78, 90, 4,
-    -257, -707, -1293, -1932, -2515, -2906, -2985, -2704, -2083, -1203, -220, 680,
-    1345, 1681, 1658, 1327, 816, 278, -153, -383, -384, -189, 101, 347,
-    418, 237, -197, -805, -1419, -1840, -1931, -1655, -1050, -222, 663, 1426,
-    1914, 2011, 1678, 1003, 165, -630, -1200, -1426, -1297, -890, -329, 235,
-    641, 792, 682, 386, 43, -186, -199, 17, 428, 954, 1448, 1738,
-    1707, 1315, 609, -264, -1093, -1690, -1937, -1790, -1301, -608, 112, 691,
-    991, 950, 619, 133, -344, -652, -679, -409, 72, 606, 997, 1081,
-    800, 214, -534, -1264, -1792, -1988, -1810, -1307, -606, 112, 660, 924,
-    889, 631, 302, 81, 97, 374, 852, 1420, 1943, 2305, 2464, 2454,
-    2364, 2295, 2328, 2459, 2606, 2651, 2489, 2047, 1331, 427, -538, -1461,
-    -2271, -2926, -3415, -3750, -3942, -3971, -3775, -3273, -2413, -1219, 218, 1740,
-    3138, 4180, 4673, 4526, 3784, 2631, 1363, 299, -329, -474, -280, -14,
-    55, -258, -993, -2009, -3024, -3726, -3879, -3392, -2344, -956, 488, 1729,
-    2580, 2954, 2879, 2484, 1953, 1486, 1227, 1199, 1307, 1382, 1274, 909,
-    314, -408, -1114, -1655, -1911, -1835, -1461, -895, -305, 122, 273, 157,
-    -132, -456, -655, -608, -286, 266, 957, 1654, 2209, 2507, 2497, 2187,
-    1651, 1010, 391, -96, -380, -469, -458, -467, -598, -914, -1413, -2002,
-    -2536, -2880, -2933, -2653, -2079, -1324, -520, 205, 754, 1081, 1193, 1129,
-    963, 792, 703, 745, 918, 1162, 1376, 1456, 1330, 976, 433, -194,
-    -761, -1133, -1218, -988, -488, 178, 874, 1457, 1811, 1876, 1656, 1223,
-    707, 257, -14, -47, 156, 531, 957, 1291, 1410, 1245, 804, 174,
-    -502, -1076, -1427, -1492, -1273, -837, -293, 233, 614, 758, 634, 286,
-    -188, -668, -1037, -1205, -1134, -846, -417, 35, 375, 485, 305, -154,
-    -797, -1466, -1985, -2211, -2057, -1520, -718, 143, 849, 1226, 1181, 744,
-    63, -667, -1248, -1509, -1351, -802, 1, 847, 1519, 1852, 1791, 1391,
-    785, 153, -335, -575, -546, -291, 74, 376, 461, 243, -276, -1006,
-    -1787, -2438, -2819, -2864, -2590, -2092, -1502, -959, -594, -497, -659, -964,
-    -1242, -1349, -1194, -778, -193, 411, 894, 1160, 1158, 896, 455, -28,
-    -424, -665, -753, -732, -672, -635, -653, -718, -787, -795, -684, -432,
-    -78, 290, 555, 621, 458, 118, -292, -649, -834, -776, -483, -55,
-    353, 595, 595, 360, -25, -421, -675, -684, -440, -23, 428, 743,
-    784, 503, -35, -672, -1206, -1462, -1345, -868, -149, 616, 1214, 1486,
-    1365, 876, 134, -677, -1369, -1803, -1931, -1809, -1559, -1307, -1134, -1072,
-    -1094, -1111, -1017, -717, -158, 650, 1603, 2545, 3340, 3901, 4193, 4245,
-    4139, 3969, 3797, 3660, 3556, 3415, 3131, 2629, 1887, 940, -140, -1259,
-    -2327, -3275, -4047, -4595, -4897, -4945, -4718, -4185, -3330, -2176, -773, 786,
-    2362, 3790, 4906, 5574, 5711, 5313, 4463, 3318, 2085, 958, 52, -615,
-    -1093, -1489, -1923, -2446, -3014, -3523, -3843, -3845, -3461, -2717, -1711, -566,
-    574, 1582, 2392, 2989, 3384, 3607, 3702, 3692, 3572, 3322, 2910, 2312,
-    1549, 701, -146, -908, -1502, -1864, -1995, -1947, -1797, -1640, -1570, -1621,
-    -1749, -1860, -1849, -1625, -1129, -355, 641, 1738, 2772, 3580, 4025, 4037,
-    3632, 2907, 2007, 1097, 334, -170, -378, -346, -193, -79, -150, -490,
-    -1089, -1835, -2553, -3059, -3220, -2976, -2356, -1468, -465, 483, 1216, 1626,
-    1681, 1428, 959, 410, -70, -366, -422, -254, 52, 364, 564, 596,
-    471, 255, 41, -85, -55, 177, 605, 1140, 1642, 1964, 1997, 1704,
-    1142, 439, -250, -770, -998, -890, -494, 70, 640, 1058, 1211, 1070,
-    675, 127, -427, -835, -1010, -954, -740, -485, -301, -261, -379, -614,
-    -883, -1083, -1138, -1027, -781, -481, -240, -134, -168, -294, -450, -561,
-    -550, -385, -114, 163, 342, 351, 165, -178, -593, -977, -1243, -1340,
-    -1274, -1103, -898, -727, -630, -582, -491, -271, 108, 636, 1270, 1918,
-    2446, 2725, 2678, 2298, 1668, 934, 264, -212, -440, -462, -387, -341,
-    -433, -731, -1234, -1854, -2447, -2860, -2974, -2737, -2206, -1520, -847, -330,
-    -49, 4, -97, -243, -319, -237, 24, 408, 797, 1056, 1077, 835,
-    386, -171, -727, -1174, -1430, -1464, -1296, -992, -639, -314, -58, 123,
-    255, 369, 472, 559, 629, 670, 636, 482, 219, -112, -461, -758,
-    -933, -949, -803, -504, -90, 363, 770, 1064, 1203, 1183, 1026, 772,
-    472, 192, -15, -134, -187, -228, -323, -511, -780, -1087, -1380, -1589,
-    -1638, -1484, -1134, -632, -56, 484, 892, 1124, 1170, 1055, 839, 608,
-    440, 368, 396, 494, 608, 684, 670, 530, 243, -166, -633, -1069,
-    -1385, -1510, -1408, -1092, -620, -62, 501, 977, 1286, 1380, 1256, 950,
-    533, 105, -229, -392, -341, -77, 350, 847, 1302, 1596, 1639, 1399,
-    924, 314, -311, -837, -1174, -1282, -1175, -920, -622, -391, -316, -429,
-    -696, -1026, -1314, -1467, -1427, -1174, -750, -248, 215, 534, 646, 534,
-    239, -158, -549, -823, -901, -754, -411, 50, 522, 893, 1082, 1048,
-    800, 405, -32, -390, -566, -505, -237, 141, 508, 758, 809, 626,
-    242, -255, -748, -1125, -1294, -1218, -938, -561, -225, -46, -74, -276,
-    -564, -815, -910, -778, -427, 66, 593, 1027, 1254, 1223, 975, 600,
-    206, -90, -199, -117, 75, 267, 356, 270, 4, -371, -739, -996,
-    -1068, -946, -694, -417, -227, -216, -416, -763, -1145, -1444, -1551, -1388,
-    -952, -332, 329, 876, 1180, 1199, 996, 689, 400, 233, 239, 390,
-    602, 762, 749, 484, -4, -583, -1084, -1353, -1299, -930, -351, 283,
-    808, 1088, 1063, 777, 359, -23, -213, -131, 207, 710, 1236, 1629,
-    1776, 1659, 1354, 998, 735, 665, 794, 1046, 1297, 1412, 1290, 891,
-    247, -537, -1312, -1934, -2312, -2425, -2321, -2115, -1924, -1820, -1817, -1877,
-    -1905, -1757, -1326, -586, 404, 1527, 2614, 3479, 3978, 4034, 3657, 2935,
-    2025, 1115, 369, -99, -266, -214, -101, -84, -266, -675, -1256, -1871,
-    -2342, -2526, -2342, -1778, -905, 124, 1106, 1845, 2203, 2136, 1720, 1110,
-    481, -9, -255, -234, -3, 327, 621, 749, 633, 281, -237, -800,
-    -1259, -1490, -1444, -1146, -656, -70, 481, 882, 1089, 1124, 1039, 910,
-    819, 815, 902, 1049, 1202, 1289, 1234, 991, 554, -43, -711, -1332,
-    -1798, -2037, -2003, -1693, -1162, -506, 164, 731, 1096, 1213, 1086, 761,
-    322, -116, -455, -631, -613, -413, -97, 239, 497, 592, 473, 140,
-    -343, -869, -1315, -1582, -1618, -1413, -1002, -468, 88, 579, 926, 1083,
-    1066, 946, 794, 676, 647, 719, 844, 957, 998, 898, 598, 109,
-    -505, -1147, -1700, -2045, -2123, -1942, -1559, -1071, -603, -263, -105, -131,
-    -299, -523, -705, -763, -658, -401, -59, 273, 503, 581, 502, 318,
-    114, -32, -82, -49, 24, 70, 8, -220, -609, -1092, -1564, -1917,
-    -2069, -1999, -1755, -1423, -1102, -886, -825, -906, -1070, -1218, -1242, -1077,
-    -739, -307, 122, 470, 691, 784, 778, 731, 705, 732, 798, 854,
-    829, 645, 267, -264, -851, -1378, -1723, -1802, -1609, -1206, -701, -235,
-    61, 138, 45, -122, -253, -253, -84, 212, 542, 780, 807, 562,
-    74, -554, -1171, -1608, -1743, -1568, -1174, -705, -309, -91, -82, -233,
-    -442, -581, -545, -292, 153, 709, 1259, 1676, 1867, 1793, 1490, 1054,
-    592, 193, -88, -243, -333, -443, -609, -817, -1024, -1157, -1123, -862,
-    -383, 248, 924, 1511, 1887, 1974, 1761, 1304, 725, 177, -208, -341,
-    -201, 147, 575, 946, 1147, 1115, 854, 435, -29, -410, -606, -571,
-    -329, 36, 415, 704, 827, 753, 509, 189, -80, -184, -50, 325,
-    863, 1429, 1886, 2116, 2043, 1659, 1031, 279, -450, -1007, -1277, -1217,
-    -857, -276, 400, 1021, 1452, 1602, 1457, 1087, 612, 163, -151, -258,
-    -136, 174, 591, 998, 1280, 1361, 1227, 916, 506, 97, -218, -382,
-    -363, -171, 132, 444, 657, 686, 502, 141, -311, -755, -1084, -1201,
-    -1056, -664, -95, 539, 1094, 1438, 1485, 1211, 665, -30, -715, -1238,
-    -1486, -1399, -1002, -410, 227, 750, 1016, 945, 565, -13, -633, -1121,
-    -1333, -1207, -775, -141, 536, 1077, 1350, 1312, 1000, 518, 24, -339,
-    -492, -413, -144, 205, 490, 603, 482, 128, -379, -888, -1247, -1348,
-    -1138, -651, -23, 561, 944, 1025, 780, 278, -334, -879, -1199, -1207,
-    -917, -444, 53, 412, 520, 351, -22, -466, -831, -983, -862, -512,
-    -59, 340, 550, 512, 255, -128, -516, -795, -886, -776, -530, -262,
-    -81, -46, -145, -298, -399, -355, -116, 297, 796, 1250, 1524, 1529,
-    1269, 835, 360, -35, -277, -351, -287, -156, -46, -37, -175, -444,
-    -756, -986, -1036, -874, -529, -82, 365, 719, 915, 929, 792, 583,
-    396, 304, 343, 486, 640, 699, 600, 323, -103, -591, -1026, -1314,
-    -1392, -1236, -881, -419, 38, 386, 550, 524, 379, 214, 114, 142,
-    317, 593, 891, 1123, 1211, 1112, 856, 519, 185, -72, -201, -189,
-    -62, 130, 316, 430, 445, 376, 265, 181, 191, 333, 608, 979,
-    1368, 1664, 1770, 1633, 1254, 694, 69, -487, -857, -951, -726, -217,
-    468, 1176, 1750, 2069, 2088, 1829, 1366, 818, 327, 11, -75, 64,
-    360, 704, 976, 1074, 930, 535, -50, -720, -1352, -1831, -2078, -2071,
-    -1845, -1472, -1056, -704, -498, -483, -671, -1027, -1490, -1985, -2431, -2735,
-    -2830, -2704, -2393, -1988, -1597, -1306, -1159, -1161, -1278, -1439, -1563, -1581,
-    -1448, -1162, -767, -330, 79, 392, 555, 559, 447, 287, 168, 182,
-    387, 776, 1301, 1882, 2412, 2798, 2992, 2994, 2843, 2626, 2454, 2415,
-    2561, 2896, 3355, 3813, 4137, 4220, 4004, 3504, 2817, 2079, 1407, 880,
-    533, 334, 204, 54, -170, -485, -869, -1269, -1611, -1819, -1840, -1669,
-    -1362, -1020, -755, -647, -723, -941, -1184, -1298, -1145, -638, 230, 1370,
-    2603, 3696, 4429, 4645, 4272, 3328, 1926, 264, -1410, -2862, -3915, -4463,
-    -4482, -4022, -3181, -2080, -840, 420, 1602, 2625, 3402, 3845, 3877, 3450,
-    2574, 1335, -108, -1555, -2790, -3613, -3901, -3643, -2945, -2015, -1102, -416,
-    -67, -52, -273, -574, -802, -867, -775, -627, -574, -733, -1127, -1691,
-    -2301, -2810, -3097, -3113, -2882, -2478, -2013, -1609, -1330, -1168, -1068, -961,
-    -792, -563, -322, -131, -41, -96, -304, -613, -924, -1125, -1127, -903,
-    -521, -117, 177, 275, 157, -116, -430, -673, -762, -665, -412, -92,
-    194, 370, 402, 313, 175, 82, 108, 281, 567, 882, 1132, 1252,
-    1218, 1054, 836, 658, 607, 755, 1131, 1696, 2352, 2971, 3425, 3623,
-    3532, 3190, 2679, 2109, 1592, 1228, 1068, 1102, 1258, 1435, 1545, 1531,
-    1372, 1099, 778, 495, 327, 318, 453, 665, 855, 925, 808, 488,
-    9, -544, -1058, -1415, -1513, -1306, -824, -170, 522, 1112, 1494, 1608,
-    1443, 1032, 456, -167, -704, -1045, -1133, -981, -660, -280, 44, 218,
-    194, -31, -420, -896, -1369, -1759, -2008, -2094, -2038, -1895, -1741, -1660,
-    -1720, -1950, -2322, -2750, -3124, -3340, -3327, -3054, -2541, -1861, -1121, -431,
-    117, 478, 641, 627, 489, 305, 167, 170, 379, 791, 1334, 1868,
-    2226, 2274, 1949, 1262, 295, -819, -1913, -2823, -3428, -3668, -3541, -3092,
-    -2388, -1501, -509, 508, 1480, 2359, 3111, 3717, 4164, 4439, 4527, 4415,
-    4095, 3569, 2853, 1976, 982, -57, -1054, -1923, -2606, -3081, -3361, -3484,
-    -3490, -3404, -3237, -2975, -2590, -2052, -1355, -523, 397, 1326, 2155, 2764,
-    3062, 3006, 2619, 1980, 1183, 319, -532, -1311, -1977, -2498, -2837, -2963,
-    -2866, -2543, -2005, -1290, -481, 302, 933, 1306, 1381, 1193, 846, 479,
-    235, 204, 388, 696, 976, 1064, 846, 304, -460, -1259, -1877, -2129,
-    -1924, -1293, -375, 615, 1439, 1902, 1916, 1512, 814, -2, -769, -1374,
-    -1771, -1955, -1944, -1768, -1452, -1003, -427, 258, 1020, 1796, 2480, 2954,
-    3120, 2944, 2457, 1751, 963, 232, -335, -694, -864, -922, -969, -1100,
-    -1356, -1708, -2077, -2346, -2396, -2141, -1569, -745, 200, 1094, 1779, 2167,
-    2253, 2091, 1770, 1400, 1077, 842, 688, 567, 402, 129, -249, -668,
-    -1018, -1166, -1007, -514, 255, 1175, 2074, 2774, 3146, 3149, 2819, 2256,
-    1612, 1057, 715, 622, 736, 956, 1146, 1178, 985, 573, -4, -653,
-    -1255, -1680, -1817, -1618, -1121, -437, 271, 851, 1203, 1286, 1106, 725,
-    257, -160, -400, -390, -120, 352, 909, 1419, 1762, 1859, 1681, 1258,
-    674, 38, -543, -991, -1266, -1371, -1347, -1260, -1190, -1222, -1414, -1760,
-    -2184, -2581, -2844, -2904, -2741, -2388, -1917, -1419, -1003, -758, -735, -929,
-    -1282, -1689, -2019, -2155, -2032, -1645, -1052, -364, 289, 788, 1050, 1045,
-    804, 407, -37, -412, -631, -654, -486, -174, 206, 576, 866, 1034,
-    1082, 1059, 1035, 1061, 1159, 1316, 1493, 1639, 1702, 1634, 1400, 989,
-    425, -236, -904, -1479, -1895, -2130, -2188, -2101, -1928, -1729, -1541, -1378,
-    -1228, -1037, -743, -307, 255, 870, 1419, 1774, 1840, 1586, 1049, 332,
-    -423, -1080, -1539, -1754, -1747, -1602, -1446, -1400, -1536, -1844, -2234, -2573,
-    -2735, -2645, -2306, -1802, -1251, -767, -429, -282, -316, -459, -607, -671,
-    -611, -430, -188, 19, 111, 61, -106, -322, -494, -530, -379, -52,
-    374, 776, 1041, 1126, 1067, 950, 890, 991, 1291, 1761, 2314, 2819,
-    3132, 3148, 2850, 2304, 1634, 1001, 545, 339, 383, 611, 910, 1154,
-    1256, 1185, 965, 674, 412, 244, 192, 233, 303, 321, 246, 105,
-    -36, -91, 28, 361, 880, 1499, 2108, 2605, 2919, 3029, 2960, 2767,
-    2530, 2319, 2161, 2031, 1866, 1594, 1168, 596, -53, -677, -1164, -1413,
-    -1386, -1126, -729, -295, 85, 334, 420, 362, 220, 62, -35, 11,
-    224, 548, 887, 1146, 1234, 1092, 743, 271, -240, -720, -1087, -1267,
-    -1237, -1022, -677, -289, 40, 245, 317, 289, 231, 227, 341, 574,
-    867, 1142, 1315, 1309, 1067, 575, -123, -935, -1736, -2389, -2782, -2853,
-    -2606, -2116, -1508, -922, -464, -207, -177, -350, -657, -1004, -1283, -1406,
-    -1329, -1061, -644, -154, 294, 588, 651, 457, 37, -508, -1043, -1453,
-    -1673, -1671, -1463, -1114, -728, -407, -239, -274, -504, -863, -1258, -1610,
-    -1866, -1994, -1982, -1859, -1693, -1564, -1556, -1727, -2063, -2469, -2819, -2995,
-    -2914, -2536, -1884, -1036, -94, 834, 1648, 2276, 2675, 2842, 2822, 2698,
-    2567, 2510, 2573, 2748, 2986, 3214, 3338, 3276, 2996, 2526, 1933, 1306,
-    737, 286, -39, -268, -479, -782, -1256, -1901, -2653, -3396, -3968, -4200,
-    -3973, -3251, -2080, -601, 981, 2448, 3602, 4289, 4449, 4113, 3368, 2340,
-    1195, 108, -791, -1434, -1826, -2038, -2162, -2269, -2397, -2541, -2639, -2598,
-    -2346, -1857, -1148, -306, 542, 1276, 1811, 2103, 2180, 2130, 2041, 1967,
-    1937, 1937, 1896, 1730, 1389, 860, 174, -587, -1308, -1895, -2300, -2530,
-    -2625, -2645, -2632, -2595, -2514, -2352, -2076, -1681, -1192, -665, -176, 219,
-    509, 726, 927, 1164, 1460, 1794, 2099, 2290, 2283, 2034, 1559, 930,
-    270, -280, -613, -693, -559, -293, 13, 302, 567, 828, 1098, 1380,
-    1656, 1874, 1971, 1911, 1684, 1308, 841, 377, 23, -126, -22, 310,
-    774, 1233, 1555, 1630, 1416, 964, 391, -169, -603, -841, -885, -802,
-    -691, -638, -710, -927, -1241, -1548, -1727, -1681, -1358, -765, 23, 884,
-    1680, 2290, 2644, 2731, 2585, 2262, 1831, 1370, 934, 542, 187, -154,
-    -523, -971, -1521, -2144, -2776, -3323, -3671, -3734, -3486, -2959, -2224, -1379,
-    -533, 233, 890, 1430, 1863, 2219, 2530, 2810, 3043, 3189, 3179, 2941,
-    2441, 1698, 774, -245, -1253, -2147, -2841, -3273, -3414, -3275, -2897, -2344,
-    -1709, -1076, -490, 44, 528, 977, 1416, 1845, 2244, 2591, 2865, 3026,
-    3018, 2801, 2357, 1693, 841, -117, -1071, -1899, -2503, -2826, -2864, -2666,
-    -2330, -1965, -1662, -1482, -1449, -1536, -1680, -1792, -1786, -1600, -1220, -689,
-    -88, 477, 895, 1090, 1039, 764, 326, -174, -626, -951, -1102, -1058,
-    -836, -507, -155, 157, 386, 521, 585, 609, 616, 618, 617, 589,
-    492, 292, -28, -440, -859, -1177, -1309, -1217, -894, -380, 247, 897,
-    1474, 1879, 2053, 2010, 1826, 1610, 1489, 1567, 1864, 2306, 2756, 3057,
-    3065, 2707, 1996, 1013, -119, -1265, -2295, -3096, -3583, -3731, -3600, -3325,
-    -3072, -2990, -3151, -3504, -3893, -4122, -4014, -3471, -2506, -1249, 121, 1421,
-    2493, 3222, 3551, 3473, 3017, 2267, 1359, 429, -414, -1093, -1586, -1933,
-    -2183, -2358, -2452, -2437, -2256, -1854, -1221, -397, 557, 1573, 2568, 3449,
-    4119, 4499, 4542, 4233, 3592, 2692, 1644, 564, -443, -1290, -1925, -2352,
-    -2604, -2730, -2780, -2779, -2692, -2434, -1932, -1148, -98, 1124, 2350, 3394,
-    4099, 4351, 4114, 3447, 2489, 1439, 527, -63, -263, -139, 154, 434,
-    532, 349, -109, -752, -1435, -2007, -2345, -2392, -2178, -1789, -1323, -852,
-    -416, -26, 336, 711, 1129, 1590, 2053, 2449, 2677, 2633, 2252, 1536,
-    551, -597, -1770, -2816, -3608, -4060, -4125, -3818, -3230, -2495, -1748, -1098,
-    -598, -232, 66, 371, 757, 1280, 1958, 2754, 3587, 4336, 4870, 5080,
-    4916, 4386, 3562, 2572, 1540, 561, -291, -973, -1487, -1866, -2139, -2332,
-    -2471, -2561, -2574, -2463, -2193, -1738, -1105, -336, 494, 1296, 1975, 2452,
-    2672, 2614, 2294, 1765, 1105, 410, -210, -664, -904, -930, -778, -520,
-    -238, 14, 210, 331, 382, 400, 426, 482, 581, 715, 844, 913,
-    878, 700, 351, -148, -710, -1212, -1536, -1590, -1334, -797, -80, 661,
-    1261, 1592, 1598, 1305, 821, 305, -92, -264, -166, 169, 632, 1078,
-    1369, 1406, 1161, 689, 94, -502, -983, -1261, -1316, -1189, -951, -683,
-    -454, -298, -206, -153, -115, -65, 2, 64, 91, 59, -51, -234,
-    -456, -672, -851, -971, -1005, -938, -775, -540, -263, 36, 361, 720,
-    1112, 1516, 1899, 2232, 2492, 2649, 2663, 2494, 2104, 1496, 737, -38,
-    -684, -1081, -1162, -920, -420, 232, 922, 1538, 1991, 2250, 2336, 2287,
-    2146, 1936, 1627, 1135, 382, -642, -1885, -3223, -4466, -5388, -5797, -5575,
-    -4709, -3297, -1535, 335, 2071, 3471, 4392, 4760, 4578, 3934, 2993, 1956,
-    1022, 327, -99, -330, -492, -711, -1072, -1563, -2075, -2450, -2551, -2300,
-    -1705, -869, 47, 877, 1492, 1824, 1887, 1754, 1516, 1264, 1061, 934,
-    873, 859, 874, 899, 911, 878, 765, 544, 186, -332, -1000, -1756,
-    -2503, -3132, -3532, -3630, -3421, -2951, -2288, -1522, -755, -47, 599, 1211,
-    1833, 2502, 3201, 3833, 4258, 4346, 4004, 3209, 2022, 568, -985, -2439,
-    -3605, -4342, -4592, -4390, -3858, -3175, -2525, -2075, -1915, -2013, -2231, -2395,
-    -2338, -1944, -1198, -205, 868, 1831, 2493, 2709, 2425, 1687, 623, -564,
-    -1633, -2357, -2593, -2318, -1627, -708, 217, 947, 1361, 1434, 1218, 804,
-    302, -172, -535, -749, -802, -708, -498, -201, 161, 565, 993, 1434,
-    1866, 2250, 2545, 2713, 2718, 2548, 2212, 1724, 1107, 403, -327, -1023,
-    -1621, -2057, -2290, -2307, -2133, -1833, -1499, -1209, -1009, -914, -900, -909,
-    -879, -764, -530, -187, 200, 540, 737, 710, 430, -67, -699, -1365,
-    -1945, -2324, -2442, -2295, -1936, -1462, -995, -636, -441, -420, -518, -630,
-    -646, -489, -125, 415, 1016, 1535, 1855, 1887, 1590, 1005, 254, -525,
-    -1197, -1636, -1759, -1563, -1117, -538, 33, 465, 667, 613, 337, -85,
-    -569, -1032, -1402, -1628, -1694, -1612, -1409, -1118, -781, -438, -108, 196,
-    455, 624, 643, 454, 19, -646, -1445, -2228, -2842, -3155, -3067, -2551,
-    -1663, -526, 710, 1875, 2835, 3530, 3968, 4194, 4270, 4255, 4160, 3963,
-    3651, 3215, 2647, 1975, 1260, 558, -109, -734, -1313, -1853, -2380, -2916,
-    -3470, -4033, -4554, -4945, -5098, -4921, -4368, -3459, -2279, -954, 389, 1641,
-    2710, 3528, 4068, 4340, 4356, 4126, 3668, 3018, 2216, 1313, 356, -609,
-    -1531, -2354, -3022, -3489, -3714, -3681, -3418, -2968, -2371, -1670, -916, -127,
-    692, 1503, 2234, 2820, 3200, 3322, 3169, 2776, 2205, 1546, 904, 369,
-    -12, -235, -346, -423, -523, -649, -777, -862, -838, -656, -326, 109,
-    587, 1007, 1256, 1289, 1137, 869, 569, 343, 285, 432, 762, 1186,
-    1564, 1760, 1683, 1303, 657, -141, -937, -1599, -2025, -2158, -2008, -1668,
-    -1266, -928, -748, -773, -986, -1317, -1659, -1895, -1924, -1704, -1253, -633,
-    76, 775, 1353, 1719, 1833, 1706, 1394, 981, 566, 233, 40, 9,
-    130, 357, 630, 884, 1057, 1114, 1046, 875, 644, 413, 239, 150,
-    149, 227, 365, 532, 689, 799, 836, 798, 712, 616, 545, 524,
-    556, 648, 812, 1035, 1264, 1432, 1489, 1397, 1146, 766, 307, -182,
-    -637, -979, -1169, -1227, -1202, -1141, -1090, -1064, -1044, -1002, -932, -832,
-    -706, -575, -473, -423, -429, -481, -568, -678, -804, -930, -1038, -1123,
-    -1191, -1241, -1268, -1262, -1206, -1078, -871, -583, -198, 284, 833, 1395,
-    1911, 2334, 2630, 2792, 2835, 2778, 2633, 2401, 2083, 1701, 1287, 879,
-    499, 154, -170, -502, -865, -1255, -1636, -1953, -2166, -2250, -2197, -2015,
-    -1740, -1419, -1090, -787, -531, -316, -107, 124, 388, 693, 1028, 1344,
-    1565, 1622, 1458, 1045, 424, -295, -992, -1569, -1941, -2065, -1962, -1691,
-    -1315, -905, -527, -206, 67, 301, 501, 667, 787, 842, 826, 743,
-    597, 405, 214, 69, -8, -17, 18, 46, 15, -105, -329, -643,
-    -998, -1332, -1605, -1799, -1911, -1974, -2040, -2141, -2266, -2376, -2408, -2283,
-    -1942, -1365, -560, 427, 1496, 2526, 3411, 4081, 4487, 4628, 4543, 4295,
-    3949, 3545, 3087, 2563, 1967, 1302, 560, -257, -1117, -1981, -2808, -3557,
-    -4185, -4653, -4907, -4882, -4523, -3806, -2743, -1391, 150, 1762, 3319, 4691,
-    5759, 6428, 6625, 6317, 5534, 4363, 2934, 1406, -61, -1356, -2427, -3258,
-    -3860, -4261, -4482, -4525, -4386, -4048, -3490, -2713, -1747, -644, 526, 1652,
-    2614, 3326, 3735, 3814, 3573, 3059, 2327, 1443, 498, -423, -1265, -1991,
-    -2558, -2937, -3118, -3100, -2892, -2538, -2100, -1628, -1159, -730, -359, -47,
-    224, 484, 773, 1120, 1522, 1946, 2341, 2650, 2806, 2763, 2510, 2075,
-    1518, 912, 335, -150, -519, -778, -950, -1056, -1131, -1208, -1297, -1375,
-    -1414, -1377, -1227, -950, -565, -112, 369, 821, 1183, 1419, 1518, 1486,
-    1345, 1134, 874, 563, 194, -229, -695, -1162, -1564, -1839, -1942, -1835,
-    -1493, -938, -242, 496, 1165, 1659, 1915, 1901, 1621, 1125, 514, -106,
-    -648, -1044, -1244, -1245, -1080, -805, -483, -178, 81, 307, 521, 740,
-    982, 1251, 1521, 1739, 1835, 1746, 1438, 921, 251, -472, -1130, -1624,
-    -1896, -1918, -1704, -1314, -831, -319, 165, 583, 923, 1193, 1396, 1526,
-    1566, 1472, 1196, 735, 142, -504, -1091, -1489, -1611, -1458, -1098, -656,
-    -288, -113, -151, -353, -627, -845, -874, -643, -150, 560, 1386, 2179,
-    2803, 3191, 3329, 3241, 2981, 2602, 2137, 1607, 1051, 507, 12, -404,
-    -728, -975, -1171, -1346, -1537, -1771, -2029, -2260, -2406, -2412, -2235, -1864,
-    -1345, -774, -267, 67, 169, 55, -194, -450, -586, -522, -263, 103,
-    452, 661, 632, 329, -198, -831, -1422, -1823, -1925, -1709, -1246, -650,
-    -40, 466, 782, 884, 791, 549, 227, -101, -389, -641, -873, -1101,
-    -1323, -1516, -1652, -1703, -1630, -1388, -964, -401, 234, 869, 1413, 1788,
-    1964, 1950, 1776, 1497, 1200, 961, 827, 821, 925, 1073, 1195, 1248,
-    1197, 1023, 745, 415, 97, -158, -320, -395, -424, -455, -527, -660,
-    -862, -1134, -1462, -1807, -2120, -2363, -2508, -2529, -2404, -2120, -1690, -1158,
-    -585, -13, 538, 1041, 1474, 1851, 2204, 2547, 2889, 3229, 3541, 3769,
-    3862, 3789, 3532, 3092, 2515, 1857, 1166, 487, -151, -762, -1383, -2032,
-    -2697, -3348, -3924, -4333, -4484, -4301, -3743, -2834, -1680, -423, 797, 1852,
-    2641, 3112, 3272, 3171, 2899, 2556, 2221, 1941, 1721, 1518, 1269, 913,
-    401, -285, -1118, -2025, -2895, -3596, -4001, -4031, -3675, -2976, -2029, -974,
-    41, 908, 1571, 2024, 2308, 2479, 2582, 2659, 2740, 2805, 2792, 2638,
-    2292, 1709, 896, -68, -1075, -2023, -2820, -3404, -3760, -3895, -3825, -3595,
-    -3272, -2884, -2404, -1808, -1107, -316, 537, 1399, 2189, 2826, 3230, 3339,
-    3136, 2664, 1987, 1170, 282, -606, -1431, -2147, -2719, -3126, -3378, -3486,
-    -3446, -3256, -2938, -2532, -2087, -1660, -1304, -1049, -909, -879, -927, -995,
-    -1030, -987, -843, -596, -274, 88, 461, 819, 1147, 1443, 1711, 1944,
-    2126, 2222, 2191, 1989, 1590, 1019, 348, -324, -898, -1288, -1434, -1335,
-    -1039, -627, -190, 171, 372, 383, 236, 17, -163, -213, -95, 177,
-    549, 933, 1236, 1393, 1375, 1179, 834, 386, -132, -700, -1284, -1841,
-    -2322, -2678, -2863, -2851, -2631, -2200, -1572, -791, 60, 874, 1540, 1965,
-    2102, 1959, 1590, 1092, 586, 173, -89, -196, -197, -175, -212, -359,
-    -611, -905, -1137, -1192, -974, -465, 261, 1055, 1747, 2181, 2270, 2017,
-    1518, 928, 419, 137, 160, 481, 1007, 1578, 2025, 2212, 2057, 1550,
-    762, -177, -1128, -1970, -2604, -2969, -3057, -2887, -2511, -2012, -1489, -1013,
-    -619, -328, -138, -13, 97, 224, 371, 519, 639, 701, 686, 577,
-    377, 111, -176, -438, -629, -703, -644, -476, -244, 7, 232, 382,
-    424, 352, 177, -69, -336, -576, -762, -890, -967, -1008, -1040, -1087,
-    -1180, -1333, -1536, -1742, -1892, -1925, -1795, -1485, -1026, -479, 78, 561,
-    883, 984, 847, 513, 60, -409, -783, -961, -881, -533, 41, 771,
-    1570, 2351, 3050, 3629, 4066, 4363, 4536, 4585, 4488, 4224, 3778, 3145,
-    2337, 1399, 396, -603, -1528, -2325, -2966, -3455, -3798, -3996, -4026, -3838,
-    -3379, -2634, -1632, -440, 859, 2169, 3402, 4462, 5246, 5677, 5718, 5380,
-    4712, 3811, 2801, 1808, 930, 220, -334, -796, -1253, -1784, -2409, -3070,
-    -3647, -3989, -3962, -3493, -2594, -1365, 25, 1373, 2484, 3225, 3556, 3506,
-    3159, 2635, 2063, 1521, 1015, 510, -41, -673, -1384, -2106, -2727, -3132,
-    -3248, -3060, -2608, -1977, -1279, -636, -140, 177, 345, 433, 527, 707,
-    1013, 1435, 1940, 2471, 2937, 3244, 3333, 3174, 2769, 2155, 1401, 582,
-    -228, -942, -1479, -1802, -1918, -1884, -1792, -1751, -1836, -2058, -2374, -2695,
-    -2901, -2884, -2582, -2006, -1230, -376, 432, 1103, 1579, 1841, 1920, 1886,
-    1804, 1708, 1600, 1459, 1247, 919, 461, -99, -693, -1233, -1623, -1785,
-    -1685, -1341, -834, -266, 264, 682, 945, 1047, 1027, 950, 873, 837,
-    853, 884, 870, 770, 577, 318, 46, -165, -244, -143, 142, 567,
-    1042, 1455, 1708, 1736, 1530, 1138, 641, 130, -299, -559, -604, -429,
-    -75, 386, 862, 1268, 1543, 1663, 1634, 1486, 1269, 1042, 852, 717,
-    620, 514, 343, 72, -304, -748, -1204, -1595, -1843, -1893, -1713, -1314,
-    -747, -98, 536, 1066, 1432, 1614, 1631, 1527, 1367, 1229, 1176, 1231,
-    1380, 1571, 1732, 1787, 1691, 1424, 1001, 483, -40, -490, -800, -919,
-    -840, -607, -282, 73, 401, 666, 860, 989, 1055, 1071, 1050, 986,
-    865, 683, 439, 136, -208, -556, -873, -1133, -1312, -1399, -1390, -1284,
-    -1088, -830, -540, -240, 52, 324, 564, 761, 898, 964, 965, 911,
-    808, 664, 488, 285, 51, -215, -502, -792, -1072, -1326, -1542, -1715,
-    -1845, -1928, -1954, -1922, -1835, -1691, -1485, -1209, -847, -392, 140, 715,
-    1293, 1838, 2312, 2683, 2926, 3029, 3006, 2890, 2713, 2492, 2232, 1937,
-    1602, 1231, 831, 410, -33, -496, -969, -1427, -1849, -2217, -2515, -2733,
-    -2864, -2907, -2849, -2671, -2354, -1886, -1256, -481, 388, 1269, 2069, 2677,
-    2994, 2968, 2617, 2027, 1330, 675, 170, -149, -319, -425, -576, -854,
-    -1290, -1849, -2444, -2954, -3257, -3270, -2974, -2407, -1649, -795, 61, 841,
-    1498, 2015, 2382, 2589, 2636, 2524, 2259, 1851, 1326, 715, 66, -564,
-    -1128, -1597, -1953, -2184, -2294, -2281, -2139, -1862, -1465, -981, -455, 60,
-    512, 855, 1056, 1106, 1026, 864, 674, 500, 370, 283, 209, 112,
-    -33, -238, -488, -748, -962, -1084, -1089, -978, -784, -561, -377, -293,
-    -345, -530, -809, -1116, -1383, -1555, -1604, -1531, -1359, -1118, -841, -558,
-    -300, -82, 100, 268, 441, 635, 864, 1126, 1394, 1630, 1795, 1845,
-    1755, 1525, 1176, 744, 281, -156, -511, -743, -831, -783, -633, -434,
-    -238, -84, 9, 49, 61, 71, 105, 185, 318, 486, 659, 801,
-    875, 847, 707, 469, 164, -168, -474, -708, -841, -866, -794, -657,
-    -488, -328, -201, -120, -77, -51, -16, 57, 184, 364, 575, 778,
-    921, 959, 867, 638, 280, -177, -677, -1160, -1570, -1866, -2025, -2052,
-    -1973, -1816, -1605, -1358, -1095, -824, -544, -246, 72, 401, 724, 1018,
-    1259, 1420, 1478, 1422, 1261, 1011, 707, 392, 105, -137, -334, -492,
-    -621, -737, -855, -980, -1107, -1219, -1289, -1283, -1177, -964, -669, -328,
-    11, 299, 491, 559, 502, 344, 125, -119, -351, -543, -677, -752,
-    -779, -775, -762, -749, -737, -705, -634, -516, -362, -193, -46, 47,
-    60, -14, -169, -382, -617, -837, -1013, -1123, -1156, -1116, -1019, -891,
-    -755, -627, -516, -428, -357, -291, -219, -149, -86, -36, 6, 47,
-    97, 165, 266, 407, 577, 761, 940, 1094, 1210, 1279, 1292, 1241,
-    1125, 948, 723, 466, 186, -114, -425, -735, -1027, -1271, -1440, -1520,
-    -1510, -1426, -1286, -1099, -865, -590, -271, 91, 479, 854, 1170, 1377,
-    1435, 1331, 1073, 689, 240, -212, -614, -920, -1101, -1159, -1115, -1009,
-    -890, -784, -691, -603, -498, -354, -166, 59, 302, 523, 682, 760,
-    751, 657, 504, 316, 112, -84, -263, -423, -555, -659, -746, -812,
-    -842, -821, -739, -596, -416, -228, -56, 71, 135, 147, 113, 52,
-    -5, -40, -49, -26, 21, 72, 118, 140, 118, 55, -39, -159,
-    -283, -382, -444, -462, -436, -393, -357, -333, -333, -352, -369, -378,
-    -381, -363, -315, -246, -159, -72, -12, 18, 23, -7, -64, -129,
-    -195, -244, -259, -247, -217, -163, -93, -21, 52, 113, 152, 180,
-    206, 228, 261, 307, 355, 403, 448, 463, 446, 400, 317, 209,
-    94, -28, -146, -234, -296, -334, -348, -352, -360, -365, -364, -362,
-    -342, -301, -247, -176, -84, 11, 108, 202, 273, 317, 341, 339,
-    318, 298, 277, 253, 232, 204, 163, 125, 90, 52, 21, -6,
-    -31, -40, -32, -19, 5, 36, 59, 73, 82, 74, 61, 61,
-    66, 73, 94, 115, 135, 167, 200, 221, 240, 247, 236, 229,
-    224, 211, 206, 209, 205, 204, 207, 203, 198, 199, 195, 185,
-    180, 174, 170, 181, 199, 216, 241, 266, 280, 297, 317, 334,
-    361, 396, 423, 442, 447, 438, 425, 400, 368, 342, 315, 299,
-    311, 339, 370, 404, 428, 438, 439, 434, 436, 441, 440, 441,
-    442, 444, 450, 449, 440, 438, 433, 417, 403, 381, 360, 355,
-    346, 328, 321, 310, 284, 255, 221, 191, 183, 185, 190, 201,
-    197, 179, 172, 165, 145, 127, 117, 108, 99, 86, 71, 57,
-    46, 39, 32, 25, 18, 7, -9, -23, -45, -67, -87, -117,
-    -137, -138, -148, -152, -139, -147, -163, -166, -185, -201, -200, -231,
-    -265, -265, -282, -306, -298, -296, -310, -308, -302, -297, -280, -264,
-    -249, -239, -230, -214, -207, -218, -229, -236, -244, -246, -244, -244,
-    -243, -240, -231, -222, -214, -205, -202, -198, -187, -186, -179, -162,
-    -168, -179, -166, -167, -170, -152, -142, -141, -129, -121, -102, -74,
-    -58, -38, -19, -14, -3, 1, -12, -14, -14, -15, -4, -2,
-    -2, 13, 13, 9, 30, 43, 49, 74, 95, 101, 109, 126,
-    138, 139, 135, 133, 129, 132, 149, 160, 164, 163, 152, 136,
-    125, 124, 134, 141, 153, 175, 175, 163, 168, 165, 153, 154,
-    150, 151, 172, 176, 167, 169, 169, 162, 159, 155, 148, 130,
-    103, 95, 104, 113, 126, 143, 158, 173, 186, 174, 143, 134,
-    129, 99, 89, 99, 83, 84, 107, 101, 102, 119, 106, 97,
-    100, 75, 55, 58, 47, 35, 34, 20, 3, 3, 8, 9,
-    29, 51, 49, 64, 95, 91, 69, 36, -23, -68, -93, -121,
-    -116, -102, -114, -117, -114, -112, -91, -72, -60, -49, -55, -62,
-    -67, -90, -111, -129, -168, -208, -241, -275, -314, -358, -396, -442,
-    -509, -552, -557, -536, -472, -376, -258, -107, 65, 252, 442, 562,
-    586, 566, 515, 424, 321, 228, 135, 56, 19, -7, -32, -21,
-    -2, -1, 13, 33, 56, 78, 42, -34, -102, -205, -321, -388,
-    -445, -490, -490, -490, -494, -467, -446, -443, -436, -462, -522, -551,
-    -543, -534, -535, -540, -535, -529, -546, -571, -598, -653, -726, -791,
-    -845, -876, -882, -855, -771, -623, -401, -64, 398, 958, 1529, 1983,
-    2238, 2253, 2029, 1641, 1171, 739, 443, 247, 151, 234, 424, 616,
-    791, 889, 893, 832, 693, 526, 399, 296, 216, 167, 124, 93,
-    71, 35, -7, -45, -90, -147, -194, -205, -202, -189, -159, -146,
-    -156, -184, -276, -419, -577, -757, -923, -1048, -1161, -1240, -1251, -1213,
-    -1134, -997, -796, -552, -281, -23, 146, 238, 262, 182, 86, 37,
-    0, 65, 198, 298, 496, 604, 297, -35, -38, -2, -30, -14,
-    -24, -29, 4, -7, -19, -3, -6, -13, -28, -45, -31, -19,
-    -30, -33, -33, -23, -9, -11, -8, 4, 0, -14, -20, -7,
-    19, 29, 16, 6, 10, 11, 11, 32, 36, 16, 12, 3,
-    -22, -20, -16, -14, -3, -12, -11, 11, 3, 2, 15, -11,
-    -16, 1, -6, 17, 44, 18, 11, 27, 20, 21, 17, -13,
-    -8, 14, 3, -1, 16, 19, 9, 1, -2, 2, 15, 15,
-    9, 11, 3, -12, 1, 11, -3, 0, 11, 7, 3, -3,
-    -7, 9, 22, 11, 7, 14, 11, 2, 6, 7, -5, -9,
-    -9, -9, -5, -7, -9, -5, -13, -22, -8, 3, -1, 0,
-    -5, -17, 2, 34, 23, 1, 17, 27, 10, 7, 12, 6,
-    9, 16, 5, -4, 2, 8, 10, 8, 0, -10, -13, -13,
-    -18, -12, 9, 17, 10, 10, 11, 7, 6, 4, 1, 8,
-    11, 6, 9, 15, 5, -9, -12, -10, -11, -8, 2, 8,
-    6, 2, 5, 8, 1, -5, -3, -4, -8, -4, -7, -22,
-    -25, -16, -15, -16, -11, -9, -10, -4, 2, 4, 11, 14,
-    6, -3, -4, -3, 2, 10, 12, 8, 7, 3, -2, 1,
-    5, -4, -11, -7, 1, 3, 1, -2, -2, 6, 11, 5,
-    3, 4, 2, 0, 4, 5, -2, -6, -6, -10, -13, -8,
-    3, 9, 8, 9, 11, 7, 2, 2, 4, 2, 1, 2,
-    -2, -8, -8, -2, 1, -1, -4, -2, 5, 9, 6, 1,
-    3, 4, 2, -2, -6, -10, -10, -6, -3, 0, -1, -6,
-    -11, -12, -11, -12, -11, -9, -7, -3, 0, 1, 4, 9,
-    10, 7, 6, 6, 6, 7, 8, 7, 4, 3, 3, 0,
-    -3, -2, 2, 4, 5, 8, 8, 3, 0, -1, -1, -3,
-    -4, -3, -3, -4, -4, -4, -5, -5, -5, -5, -2, 0,
-    1, 2, 4, 3, 1, 1, 1, 1, 0, 0, 0, 0,
-    1, 0, -1, -1, -1, 0, 1, 0, -2, -1, 0, 1,
-    2, 3, 3, 3, 2, 2, 2, 1, 1, 1, 1, 1,
-    0, 0, -1, -3, -3, -4, -3, -3, -4, -3, -3, -3,
-    -3, -3, -3, -3, -4, -3, -2, -3, -2, -2, -2, 0,
-    0, -1, 2, 2, 1, 3, 4, 3, 3, 3, 3, 3,
-    3, 4, 5, 5, 4, 4, 4, 5, 4, 2, 2, 3,
-    1, 0, 1, 1, 0, -1, -1, -2, -3, -4, -5, -4,
-    -4, -5, -3, -3, -4, -2, -1, -2, -2, -4, -5, -1,
-    -2, -5, -2, -1, 0, 2, 1, 0, 2, 1, -1, 0,
-    0, -2, -2, -2, -2, -2, -1, -2, -1, 0, -2, -1,
-    1, -1, -1, 1, 2, 1, 1, 1, 3, 4, 1, 0,
-    0, -1, -1, -2, -1, 1, -1, -2, 2, 0, -2, 1,
-    1, 0, 2, 0, -1, 2, 2, 3, 4, 3, 2, 3,
-    1, 0, -2, -3, -3, -3, -1, -2, -3, 0, 0, -1,
-    0, -1, 0, -1, -1, -1, -2, -2, 0, -1, 0, 1,
-    -2, -1, -1, -2, 1, 2, 0, 1, 0, 0, 3, 3,
-    1, 1, -1, -1, 1, 0, -2, 0, 1, 0, 0, -1,
-    0, -1, -2, 0, 1, -1, -1, 0, -1, -1, 0, -1,
-    -1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-    1, 1, 1, 1, 0, -2, -2, -1, -1, -1, -2, -2,
-    0, -1, -3, -2, -3, -5, -4, -2, -5, -5, -1, -1,
-    -4, -3, 1, -1, -4, -3, -1, 0, 0, -1, -1, -1,
-    0, -1, 0, 1, 0, 1, 3, 2, 2, 2, 4, 3,
-    2, 3, 3, 3, 3, 3, 2, 2, 2, 1, 1, 1,
-    -1, -1, 0, 1, 2, 1, 0, 0, 2, 0, -2, -1,
-    0, -1, -3, -3, -2, -3, -4, -3, -3, -4, -5, -4,
-    -5, -6, -3, -3, -4, -3, -2, -3, -2, -1, -2, -2,
-    -3, -1, 1, -1, -2, 1, 1, -1, 0, 0, -1, -2,
-    -1, 0, 1, 0, 0, 1, -1, -1, 2, 1, 0, 0,
-    1, 1, 1, 2, 2, 1, 1, 0, 0, -1, -3, -1,
-    1, 1, 1, 0, -1, 0, -2, -2, 1, -1, -2, 1,
-    1, 0, 0, 1, 0, -2, -1, 0, -1, 0, 0, -1,
-    2, 1, -2, -2, -1, -1, -1, -3, -2, -1, -1, 0,
-    -1, -2, -1, -2, -3, -2, -2, -2, 0, -1, -1, 0,
-    -1, -3, -1, 0, -1, -1, 0, 0, 1, 0, -1, -1,
-    0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0,
-    -1, -1, -1, 0, 0, 0, -1, 0, 1, 0, -1, 0,
-    0, 0, -1, -1, 0, 1, 0, 0, -1, 0, 1, 0,
-    0, 0, 0, 0, 0, 1, 2, -1, -1, 0, 0, -1,
-    0, 1, 0, 0, 0, 1, 0, -1, -1, 1, 0, -1,
-    0, -1, -1, 1, -1, -1, 0, -1, -1, -1, -2, -1,
-    -1, -1, 0, -1, -2, 0, 0, 0, 1, -1, -1, -1,
-    0, 0, 0, 0, -1, 0, 1, -1, -1, 0, -1, 0,
-    0, -1, -1, -1, -1, 0, -1, -1, -1, -1, 0, 0,
-    -1, 0, -2, -2, 0, 0, 0, 0, -1, -1, -1, 0,
-    0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-    1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-    1, 0, 0, -1, -1, -1, -1, -1, -1, 0, -1, -2,
-    -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1,
-    -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0,
-    0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1,
-    0, 0, -1, 0, 1, 0, 0, 0, 0, 1, 1, -1,
-    0, 1, -1, -2, 0, 0, 0, 0, 0, 0, 1, 0,
-    -1, 0, 0, -1, 0, 0, -1, 0, 1, 0, -1, 1,
-    0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, -1,
-    -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0,
-    -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1,
-    0, 0, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0,
-    0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, -1, 0, 0, -1, -1, -1, -1, -1, -1,
-    0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1,
-    -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-};
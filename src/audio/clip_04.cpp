@@ -1,10183 +0,0 @@
-#include "clip_04.h"
-
-// Auto-generated by wav2cpp  do not edit
-// 122112 samples, 44100 Hz, mono
-
-const int16_t CLIP_04_SAMPLES[] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1,
-    -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1,
-    0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 1, 0,
-    -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0,
-    -1, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, 0,
-    0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1,
-    0, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, -1,
-    -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0,
-    1, 0, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0,
-    0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 1, 1,
-    0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-    -1, -1, 1, 1, 0, -1, -1, 0, 0, 0, -1, -1,
-    -1, 0, 1, 0, -1, -1, -1, 0, 1, 0, -1, -1,
-    -1, 0, 0, 0, 0, -1, -2, -1, -1, -1, 0, 0,
-    0, 0, 0, 0, 1, 1, 1, 1, 0, -1, -1, 0,
-    1, 1, 1, -1, 0, 0, 1, 0, -1, -2, -1, 0,
-    -1, -2, -2, -1, 0, 0, -1, -1, -1, 0, 1, 0,
-    0, 0, 1, 1, 0, -1, -1, 0, 1, 1, 0, -2,
-    -1, -1, -2, -1, 0, 0, -1, -1, -1, -1, 0, 0,
-    0, -1, 0, 2, 3, 2, 0, 0, 1, 1, 1, -1,
-    -1, 0, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0,
-    0, 1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 1, 1, 1, 1, 0, -1, -1, -1, 1,
-    2, 0, -1, 0, 1, 1, 1, 0, -1, 0, 0, 1,
-    2, 2, 1, 0, -1, 0, 0, 0, -1, -1, 0, 1,
-    0, -2, -2, -1, 0, 0, -3, -5, -4, -2, -2, -2,
-    -3, -2, -1, 0, 1, 0, 0, 0, 2, 3, 2, 0,
-    -1, -1, 1, 2, 0, -1, -1, 0, 2, 2, 0, 0,
-    2, 3, 2, 1, 0, 0, 1, 1, 0, 0, 1, 1,
-    0, -1, -2, -2, -3, -3, -4, -4, -4, -3, -1, -1,
-    -1, 0, 0, -1, -1, -1, 0, 1, 0, -1, -2, 0,
-    2, 3, 2, 1, 1, 3, 3, 3, 2, 2, 1, 0,
-    -1, -2, -1, 0, 0, -1, -1, -1, -1, -1, -2, -3,
-    -4, -3, -2, -2, -2, -3, -2, -1, 0, -2, -3, -3,
-    -2, -1, -2, -3, -3, 0, 2, 1, -1, -2, 0, 3,
-    4, 2, 0, 1, 1, 1, 1, -1, 0, 1, 1, 1,
-    0, -1, 0, 0, -1, -2, -2, -2, -3, -4, -4, -3,
-    -2, -2, -3, -4, -4, -3, -1, 0, 0, -1, -2, -4,
-    -3, -1, 1, 2, 1, 0, 0, -1, 1, 2, 4, 4,
-    2, 0, -1, 0, 2, 3, 2, 0, -2, -2, -2, -1,
-    -1, -1, -1, 0, 0, -1, -2, -3, -3, -2, -1, -1,
-    -3, -4, -3, -2, 1, 3, 5, 5, 2, -1, -4, -4,
-    -2, 1, 1, 0, -2, -2, 1, 3, 5, 5, 4, 2,
-    0, -4, -8, -10, -6, 0, 5, 5, 0, -4, -5, -3,
-    -1, 0, -1, -5, -11, -14, -12, -4, 4, 8, 7, 2,
-    -3, -7, -8, -6, -2, 0, -1, -5, -6, -2, 5, 10,
-    11, 8, 5, 3, 1, -3, -8, -9, -5, 4, 9, 7,
-    1, -2, 0, 5, 6, 5, -1, -7, -13, -15, -11, -1,
-    10, 16, 13, 5, -3, -6, -2, 3, 4, -1, -7, -11,
-    -9, -3, 6, 12, 13, 10, 5, 0, -4, -6, -6, -2,
-    2, 5, 2, -4, -5, 0, 8, 11, 8, 0, -5, -7,
-    -7, -7, -5, -1, 4, 6, 2, -5, -9, -6, -1, 1,
-    -3, -7, -8, -5, -4, -7, -9, -5, 3, 9, 6, -3,
-    -10, -10, -3, 5, 11, 10, 2, -8, -12, -7, 4, 13,
-    13, 7, -1, -5, -3, 3, 11, 16, 14, 7, -3, -8,
-    -6, 3, 10, 11, 7, 3, 2, 4, 3, 0, -2, 0,
-    4, 3, -3, -12, -12, -1, 13, 20, 13, -1, -11, -14,
-    -9, -4, 0, -2, -9, -16, -19, -10, 6, 18, 17, 4,
-    -9, -12, -4, 5, 5, -5, -16, -16, -5, 9, 15, 13,
-    8, 4, 1, 0, 1, 3, 2, -7, -14, -10, 8, 27,
-    33, 24, 12, 5, 3, 2, 1, 1, 2, -3, -11, -18,
-    -16, -5, 5, 9, 4, -5, -11, -10, -3, 2, 5, 4,
-    5, 9, 14, 20, 25, 25, 16, -4, -26, -38, -38, -33,
-    -31, -32, -28, -17, -2, 9, 9, 4, -3, -6, -6, -5,
-    -1, 6, 15, 21, 18, 10, 3, 4, 10, 11, 0, -16,
-    -22, -16, -7, -7, -14, -10, 9, 27, 26, 5, -13, -10,
-    9, 20, 9, -21, -49, -61, -51, -22, 10, 30, 29, 18,
-    15, 34, 59, 66, 43, 4, -27, -36, -28, -17, -15, -27,
-    -42, -47, -34, -8, 13, 21, 15, 11, 14, 19, 18, 11,
-    3, 1, 1, -5, -17, -24, -11, 21, 50, 48, 12, -30,
-    -39, -4, 45, 63, 33, -19, -50, -39, -4, 19, 13, -12,
-    -32, -33, -24, -18, -20, -18, -6, 8, 12, 7, 10, 35,
-    71, 90, 74, 35, 0, -16, -17, -14, -14, -18, -22, -24,
-    -21, -10, 6, 18, 14, -7, -34, -54, -53, -29, 9, 45,
-    67, 72, 66, 51, 32, 10, -14, -32, -44, -52, -57, -54,
-    -39, -13, 11, 24, 23, 16, 12, 4, -19, -56, -86, -84,
-    -45, 2, 26, 23, 21, 43, 74, 74, 23, -47, -91, -90,
-    -74, -73, -91, -104, -96, -73, -43, -9, 31, 69, 92, 90,
-    67, 36, 18, 26, 54, 70, 53, 13, -13, -10, -3, -23,
-    -61, -75, -49, -18, -27, -62, -64, 4, 105, 155, 121, 44,
-    0, 23, 79, 105, 76, 15, -29, -35, -16, -8, -25, -48,
-    -48, -8, 55, 107, 111, 45, -84, -229, -319, -297, -177, -41,
-    28, 14, -18, 2, 81, 156, 153, 61, -58, -109, -49, 72,
-    159, 166, 130, 114, 122, 99, 13, -84, -115, -62, 17, 55,
-    37, -8, -55, -99, -144, -185, -203, -159, -22, 181, 350, 379,
-    254, 76, -30, -37, -27, -100, -263, -423, -475, -397, -264, -164,
-    -108, -29, 120, 283, 352, 290, 184, 145, 175, 166, 30, -181,
-    -314, -273, -125, -61, -216, -538, -824, -898, -769, -591, -491, -439,
-    -320, -90, 172, 367, 488, 602, 744, 864, 879, 750, 501, 184,
-    -143, -430, -634, -737, -765, -767, -778, -769, -659, -395, -23, 314,
-    487, 480, 375, 270, 215, 232, 339, 522, 692, 713, 514, 164,
-    -154, -295, -274, -256, -383, -615, -738, -576, -177, 227, 453, 522,
-    571, 650, 656, 471, 124, -213, -374, -339, -232, -205, -296, -395,
-    -327, -23, 392, 679, 687, 489, 299, 266, 330, 297, 81, -163,
-    -195, 30, 268, 241, -38, -283, -267, -61, 112, 157, 143, 101,
-    -25, -242, -471, -751, -1287, -2024, -2261, -1027, 1926, 5602, 8439, 9496,
-    8909, 7326, 5206, 2733, 115, -2344, -4436, -6106, -7286, -7818, -7590, -6629,
-    -5023, -2869, -376, 2095, 4226, 5906, 7118, 7733, 7571, 6652, 5198, 3365,
-    1154, -1291, -3470, -4835, -5278, -5156, -4829, -4344, -3563, -2437, -1012, 655,
-    2421, 3965, 4936, 5235, 5042, 4561, 3850, 2911, 1803, 597, -689, -1968,
-    -2982, -3454, -3371, -2985, -2500, -1833, -772, 683, 2210, 3390, 3993, 4044,
-    3681, 3007, 2079, 969, -218, -1401, -2525, -3476, -4015, -3902, -3099, -1808,
-    -283, 1306, 2777, 3848, 4301, 4213, 3874, 3406, 2615, 1304, -356, -1905,
-    -3009, -3672, -4057, -4230, -4130, -3657, -2722, -1311, 392, 1991, 3117, 3685,
-    3858, 3782, 3459, 2872, 2109, 1277, 400, -508, -1344, -1976, -2377, -2562,
-    -2436, -1841, -836, 218, 958, 1370, 1734, 2225, 2661, 2675, 2073, 1010,
-    -148, -1111, -1855, -2553, -3311, -3983, -4268, -3977, -3141, -1888, -333, 1350,
-    2881, 4045, 4869, 5467, 5717, 5278, 4014, 2254, 487, -1089, -2577, -3989,
-    -5091, -5669, -5729, -5334, -4382, -2779, -755, 1189, 2695, 3768, 4548, 5018,
-    5057, 4669, 4011, 3192, 2178, 941, -382, -1534, -2320, -2710, -2788, -2640,
-    -2274, -1650, -769, 267, 1287, 2137, 2687, 2813, 2466, 1803, 1163, 770,
-    468, -186, -1484, -3215, -4734, -5393, -4962, -3728, -2242, -897, 314, 1639,
-    3181, 4657, 5549, 5457, 4350, 2567, 636, -1003, -2222, -3210, -4154, -4909,
-    -5045, -4272, -2781, -1102, 295, 1245, 1823, 2185, 2441, 2568, 2381, 1709,
-    657, -362, -967, -1136, -1128, -1130, -1101, -955, -743, -572, -437, -251,
-    -18, 144, 158, 90, 41, 8, -83, -247, -402, -464, -431, -379,
-    -381, -454, -533, -491, -233, 210, 707, 1191, 1762, 2574, 3591, 4499,
-    4914, 4659, 3824, 2583, 1008, -892, -2990, -4941, -6307, -6799, -6439, -5488,
-    -4238, -2821, -1207, 625, 2516, 4120, 5090, 5303, 4932, 4298, 3637, 2940,
-    2027, 777, -671, -1954, -2723, -2876, -2569, -2046, -1468, -899, -376, 46,
-    306, 380, 292, 110, -71, -180, -206, -185, -160, -151, -168, -210,
-    -234, -155, 65, 332, 469, 383, 142, -137, -449, -863, -1326, -1574,
-    -1351, -727, -132, -11, -423, -1012, -1361, -1322, -1028, -638, -173, 419,
-    1119, 1821, 2398, 2723, 2655, 2107, 1169, 102, -853, -1645, -2368, -3054,
-    -3592, -3830, -3696, -3165, -2212, -864, 679, 2079, 3044, 3475, 3426, 2993,
-    2264, 1332, 288, -791, -1813, -2624, -3068, -3098, -2790, -2243, -1499, -606,
-    292, 1017, 1498, 1825, 2119, 2412, 2640, 2716, 2589, 2283, 1904, 1576,
-    1300, 909, 241, -656, -1546, -2237, -2715, -3030, -3167, -3132, -3081, -3181,
-    -3309, -3040, -2051, -493, 1120, 2362, 3142, 3561, 3668, 3435, 2834, 1850,
-    472, -1187, -2768, -3805, -4078, -3790, -3362, -3061, -2853, -2548, -1998, -1175,
-    -154, 923, 1909, 2735, 3411, 3938, 4240, 4223, 3872, 3232, 2321, 1136,
-    -224, -1520, -2511, -3117, -3438, -3613, -3705, -3672, -3380, -2639, -1346, 347,
-    2014, 3205, 3747, 3788, 3559, 3150, 2503, 1568, 408, -797, -1791, -2325,
-    -2301, -1878, -1391, -1096, -1012, -1034, -1129, -1325, -1525, -1465, -955, -114,
-    732, 1375, 1883, 2403, 2905, 3182, 3051, 2488, 1592, 533, -452, -1111,
-    -1344, -1301, -1229, -1186, -973, -375, 563, 1504, 1998, 1661, 285, -2025,
-    -4718, -6879, -7605, -6470, -3669, 183, 4340, 8045, 10540, 11209, 9869, 6940,
-    3236, -509, -3944, -6918, -9065, -9692, -8252, -4989, -1059, 2112, 3681, 3728,
-    2911, 1884, 968, 185, -537, -1135, -1313, -676, 868, 2799, 4174, 4276,
-    3130, 1426, -22, -723, -600, 84, 793, 943, 325, -655, -1335, -1514,
-    -1715, -2586, -4056, -5213, -5078, -3474, -1113, 1074, 2627, 3702, 4695, 5779,
-    6678, 6793, 5640, 3343, 752, -1064, -1642, -1495, -1611, -2546, -3992, -5180,
-    -5560, -5030, -3685, -1640, 787, 2925, 4070, 4038, 3252, 2223, 1062, -337,
-    -1729, -2387, -1741, -84, 1511, 2058, 1383, 40, -1381, -2713, -4025, -5122,
-    -5390, -4197, -1447, 2216, 5718, 8069, 8749, 7799, 5677, 2979, 207, -2279,
-    -4099, -4772, -3983, -2027, 140, 1483, 1605, 863, -176, -1206, -2100, -2590,
-    -2335, -1337, -51, 1010, 1680, 2032, 2052, 1656, 1030, 672, 936, 1611,
-    2103, 1977, 1246, 224, -720, -1309, -1506, -1653, -2256, -3379, -4283, -3937,
-    -2053, 472, 2256, 2586, 1883, 1148, 1060, 1569, 2140, 2298, 1991, 1570,
-    1457, 1788, 2298, 2472, 1802, 26, -2672, -5564, -7646, -8252, -7538, -6266,
-    -5032, -3728, -1815, 923, 3970, 6347, 7230, 6385, 4261, 1788, -75, -886,
-    -950, -984, -1453, -2216, -2763, -2732, -2192, -1494, -950, -623, -348, 32,
-    406, 360, -487, -2024, -3512, -3990, -2927, -627, 1902, 3524, 3609, 2367,
-    607, -910, -2014, -3042, -4197, -5038, -4683, -2570, 927, 4605, 7151, 7878,
-    6990, 5253, 3371, 1524, -588, -3248, -6225, -8721, -9823, -9080, -6743, -3543,
-    -202, 2903, 5687, 7986, 9302, 9003, 6903, 3624, 336, -1961, -2943, -2906,
-    -2348, -1658, -1099, -896, -1247, -2237, -3722, -5239, -6064, -5544, -3534, -574,
-    2451, 4868, 6465, 7274, 7249, 6271, 4395, 1988, -438, -2493, -4039, -5194,
-    -6240, -7421, -8611, -9135, -8062, -4928, -262, 4604, 8371, 10521, 11353, 11391,
-    10732, 8934, 5501, 560, -4819, -8993, -10643, -9599, -6926, -4167, -2299, -1270,
-    -446, 562, 1500, 1839, 1447, 853, 846, 1834, 3520, 5134, 5923, 5510,
-    3980, 1783, -447, -2157, -3174, -3788, -4450, -5238, -5633, -4953, -3104, -861,
-    690, 1066, 757, 729, 1575, 3085, 4503, 5113, 4679, 3507, 2175, 1105,
-    250, -789, -2270, -3860, -4733, -4193, -2271, 231, 2250, 3066, 2586, 1258,
-    -258, -1464, -2242, -2767, -3122, -3001, -1871, 443, 3278, 5328, 5469, 3591,
-    727, -1636, -2535, -2053, -1031, -253, 169, 696, 1680, 2795, 3190, 2277,
-    373, -1457, -2231, -1754, -579, 610, 1490, 2043, 2219, 1811, 684, -968,
-    -2643, -3801, -4134, -3659, -2671, -1602, -801, -345, 4, 604, 1651, 3018,
-    4338, 5252, 5636, 5623, 5374, 4782, 3438, 1000, -2326, -5691, -8078, -8935,
-    -8401, -6973, -5009, -2597, 167, 2827, 4567, 4658, 3042, 580, -1363, -1780,
-    -683, 1010, 2281, 2800, 3015, 3521, 4358, 4845, 4093, 1739, -1664, -4910,
-    -6879, -7192, -6307, -5047, -4009, -3301, -2676, -1825, -630, 717, 1770, 2160,
-    1982, 1831, 2252, 3085, 3456, 2557, 503, -1642, -2704, -2299, -1005, 229,
-    797, 734, 494, 474, 649, 563, -282, -1911, -3668, -4571, -3997, -2135,
-    181, 2063, 3090, 3400, 3402, 3426, 3504, 3365, 2633, 1173, -609, -1858,
-    -1841, -599, 963, 1750, 1341, 252, -628, -842, -656, -670, -1190, -1938,
-    -2255, -1631, -147, 1461, 2271, 1872, 708, -267, -352, 424, 1498, 2370,
-    2953, 3436, 3933, 4291, 4180, 3308, 1610, -633, -2831, -4326, -4727, -4104,
-    -2869, -1453, -99, 1091, 1990, 2398, 2232, 1719, 1346, 1524, 2228, 2958,
-    3097, 2368, 1016, -408, -1444, -1984, -2213, -2328, -2271, -1731, -474, 1268,
-    2773, 3284, 2600, 1212, -147, -1079, -1629, -1901, -1688, -599, 1434, 3825,
-    5515, 5569, 3736, 577, -2873, -5682, -7427, -8183, -8176, -7421, -5680, -2777,
-    1028, 4922, 7805, 8819, 7820, 5475, 2889, 960, -104, -790, -1809, -3511,
-    -5596, -7325, -8061, -7729, -6782, -5693, -4443, -2538, 388, 3946, 6984, 8254,
-    7245, 4507, 1264, -1345, -2862, -3570, -4023, -4459, -4582, -3926, -2432, -711,
-    278, -130, -1837, -3979, -5352, -5051, -2996, -5, 2701, 4266, 4641, 4346,
-    3804, 2897, 1151, -1648, -5005, -7854, -9213, -8837, -7343, -5696, -4471, -3534,
-    -2364, -670, 1321, 3091, 4287, 4953, 5391, 5841, 6227, 6142, 5085, 2833,
-    -298, -3525, -5967, -7073, -6837, -5735, -4448, -3482, -2901, -2403, -1743, -1122,
-    -1067, -1829, -2899, -3198, -1878, 990, 4396, 7032, 8044, 7399, 5674, 3528,
-    1294, -1001, -3258, -5031, -5706, -5029, -3424, -1798, -960, -1165, -2054, -2965,
-    -3337, -2996, -2169, -1223, -340, 590, 1764, 3122, 4210, 4399, 3315, 1180,
-    -1203, -2853, -3181, -2313, -916, 320, 1078, 1378, 1262, 640, -517, -1910,
-    -2925, -3028, -2176, -893, 102, 407, 175, -127, -206, -219, -555, -1344,
-    -2162, -2247, -1065, 1244, 3862, 5756, 6264, 5423, 3840, 2252, 1101, 433,
-    76, -127, -224, -197, -75, -38, -461, -1736, -3897, -6341, -8032, -8146,
-    -6644, -4206, -1625, 761, 3092, 5518, 7767, 9132, 8918, 6984, 3995, 1126,
-    -668, -1283, -1475, -2184, -3719, -5514, -6638, -6562, -5508, -4152, -3016, -2083,
-    -904, 951, 3449, 5967, 7596, 7702, 6370, 4391, 2729, 1845, 1452, 904,
-    -101, -1198, -1698, -1293, -436, -38, -746, -2384, -4000, -4472, -3270, -840,
-    1696, 3330, 3864, 3908, 4197, 4838, 5172, 4367, 2168, -814, -3470, -4867,
-    -4746, -3561, -2110, -1013, -386, 92, 781, 1704, 2523, 2882, 2780, 2621,
-    2841, 3456, 3930, 3541, 1959, -443, -2798, -4321, -4802, -4606, -4234, -3798,
-    -2890, -1001, 1857, 4879, 6885, 7143, 5925, 4288, 3242, 3038, 3156, 2933,
-    2195, 1334, 815, 646, 325, -696, -2437, -4240, -5186, -4742, -3130, -1127,
-    518, 1569, 2300, 3076, 3887, 4294, 3832, 2513, 972, 84, 364, 1581,
-    2896, 3377, 2559, 704, -1401, -2957, -3644, -3673, -3384, -2756, -1359, 1135,
-    4364, 7218, 8461, 7537, 4913, 1726, -965, -2742, -3847, -4730, -5528, -5914,
-    -5435, -4025, -2202, -757, -161, -211, -172, 701, 2630, 5126, 7214, 7960,
-    7005, 4784, 2228, 146, -1275, -2415, -3635, -4736, -4991, -3828, -1537, 689,
-    1523, 483, -1707, -3655, -4308, -3601, -2271, -1045, 24, 1484, 3729, 6276,
-    7850, 7297, 4559, 832, -2238, -3628, -3448, -2614, -2088, -2273, -2879, -3262,
-    -2992, -2243, -1694, -1950, -2945, -3883, -3818, -2394, -129, 1956, 3013, 2863,
-    2007, 1214, 987, 1290, 1732, 2023, 2276, 2794, 3570, 4029, 3391, 1360,
-    -1510, -4149, -5696, -5990, -5458, -4616, -3680, -2562, -1146, 437, 1742, 2216,
-    1548, -20, -1715, -2646, -2389, -1244, 48, 873, 1101, 965, 678, 210,
-    -618, -1870, -3297, -4356, -4469, -3411, -1576, 171, 1051, 922, 319, -86,
-    -108, -130, -615, -1559, -2412, -2528, -1705, -365, 732, 1011, 451, -416,
-    -896, -620, 207, 1014, 1343, 1190, 905, 757, 611, 56, -1132, -2644,
-    -3781, -3937, -2999, -1359, 389, 1783, 2649, 3065, 3202, 3111, 2599, 1378,
-    -562, -2661, -3960, -3717, -1989, 325, 2062, 2539, 1913, 954, 431, 562,
-    887, 685, -331, -1623, -2139, -1192, 855, 2761, 3365, 2487, 939, -279,
-    -803, -1001, -1402, -2108, -2711, -2677, -1792, -360, 936, 1441, 1019, 254,
-    82, 1010, 2573, 3616, 3220, 1473, -623, -1984, -2242, -1914, -1872, -2616,
-    -3830, -4536, -3797, -1535, 1220, 2981, 2928, 1486, -162, -1175, -1622, -2050,
-    -2620, -2812, -1967, -25, 2310, 4074, 4657, 4056, 2732, 1299, 209, -457,
-    -962, -1590, -2258, -2485, -1829, -389, 1132, 1899, 1506, 202, -1311, -2263,
-    -2199, -1232, 2, 757, 746, 346, 165, 387, 587, 257, -552, -1188,
-    -1024, -71, 1053, 1695, 1678, 1302, 977, 895, 966, 967, 750, 396,
-    217, 525, 1285, 1960, 1782, 315, -2160, -4773, -6595, -7118, -6366, -4676,
-    -2435, 75, 2677, 5185, 7259, 8367, 8007, 6128, 3362, 739, -968, -1716,
-    -2016, -2321, -2593, -2470, -1804, -980, -675, -1301, -2610, -3774, -3878, -2496,
-    -18, 2524, 4085, 4309, 3759, 3424, 3848, 4658, 4927, 4058, 2368, 850,
-    343, 855, 1581, 1514, 158, -2129, -4362, -5537, -5266, -3986, -2549, -1517,
-    -793, 76, 1233, 2207, 2308, 1339, -83, -904, -360, 1515, 3905, 5701,
-    6145, 5267, 3796, 2528, 1614, 453, -1605, -4350, -6536, -6734, -4505, -816,
-    2639, 4567, 4741, 3808, 2608, 1604, 764, -171, -1263, -2165, -2305, -1390,
-    202, 1582, 2003, 1439, 567, 182, 595, 1517, 2402, 2879, 2969, 2991,
-    3265, 3749, 3912, 3037, 879, -1913, -4085, -4681, -3757, -2261, -1193, -880,
-    -968, -967, -721, -382, -66, 354, 1144, 2433, 4043, 5526, 6385, 6297,
-    5246, 3462, 1269, -1034, -3169, -4822, -5686, -5574, -4494, -2624, -271, 2085,
-    3779, 4211, 3282, 1639, 335, 80, 707, 1385, 1378, 656, -198, -622,
-    -607, -620, -1069, -1852, -2409, -2204, -1160, 309, 1650, 2547, 3000, 3100,
-    2800, 1930, 441, -1375, -2931, -3635, -3227, -1966, -544, 223, -176, -1616,
-    -3326, -4325, -4068, -2839, -1500, -762, -542, -37, 1489, 3877, 5973, 6447,
-    4858, 2029, -588, -2004, -2273, -2149, -2242, -2532, -2619, -2328, -1980, -2082,
-    -2771, -3593, -3819, -3000, -1261, 823, 2616, 3745, 4170, 4068, 3666, 3119,
-    2452, 1570, 374, -1033, -2205, -2507, -1560, 310, 2095, 2727, 1856, 128,
-    -1335, -1805, -1423, -902, -785, -999, -1054, -633, 50, 453, 242, -360,
-    -732, -370, 698, 1957, 2817, 3032, 2781, 2390, 2002, 1463, 499, -989,
-    -2725, -4090, -4392, -3254, -936, 1678, 3483, 3758, 2566, 624, -1222, -2533,
-    -3401, -4135, -4822, -5176, -4772, -3479, -1660, 17, 1027, 1298, 1138, 892,
-    706, 602, 699, 1245, 2343, 3667, 4492, 4099, 2240, -694, -3904, -6580,
-    -8259, -8941, -8952, -8639, -8089, -7073, -5287, -2698, 311, 3106, 5172, 6383,
-    7025, 7567, 8287, 8987, 9009, 7657, 4740, 807, -3203, -6594, -9221, -11206,
-    -12395, -12239, -10286, -6808, -2880, 243, 1940, 2559, 3012, 3983, 5368, 6384,
-    6244, 4869, 3016, 1652, 1092, 701, -535, -3052, -6247, -8879, -9926, -9133,
-    -6940, -4036, -1023, 1681, 3789, 5098, 5459, 4782, 3130, 860, -1363, -2854,
-    -3330, -3109, -2832, -2928, -3284, -3393, -2825, -1625, -309, 536, 752, 807,
-    1469, 3127, 5286, 6743, 6405, 4111, 759, -2358, -4407, -5338, -5554, -5386,
-    -4880, -3959, -2663, -1207, 112, 1031, 1399, 1266, 938, 861, 1325, 2217,
-    3069, 3418, 3153, 2519, 1784, 903, -447, -2447, -4709, -6303, -6317, -4588,
-    -1965, 190, 954, 476, -253, -318, 339, 969, 823, -103, -1082, -1373,
-    -901, -243, -43, -481, -1274, -2043, -2582, -2806, -2595, -1809, -476, 1096,
-    2442, 3146, 2984, 1936, 197, -1809, -3497, -4346, -4191, -3337, -2392, -1899,
-    -1994, -2335, -2411, -2024, -1568, -1725, -2771, -4105, -4573, -3409, -951, 1572,
-    3002, 3028, 2134, 942, -283, -1554, -2793, -3682, -3884, -3320, -2234, -1044,
-    -162, 157, -74, -570, -977, -1166, -1337, -1781, -2512, -3149, -3167, -2326,
-    -901, 421, 933, 393, -704, -1342, -707, 1083, 2942, 3664, 2935, 1522,
-    435, -87, -700, -2094, -4087, -5637, -5730, -4248, -2007, -54, 1096, 1659,
-    2183, 2958, 3733, 3935, 3211, 1833, 580, 160, 651, 1464, 1798, 1164,
-    -417, -2534, -4575, -5879, -5977, -4880, -3146, -1500, -264, 832, 2214, 3825,
-    4974, 4870, 3345, 1051, -1028, -2272, -2721, -2805, -2847, -2804, -2427, -1631,
-    -694, -65, 62, 18, 456, 1786, 3733, 5432, 6012, 5201, 3444, 1502,
-    -95, -1322, -2495, -3887, -5403, -6536, -6613, -5237, -2646, 274, 2453, 3318,
-    3170, 2914, 3297, 4309, 5262, 5456, 4786, 3714, 2682, 1620, 55, -2274,
-    -4935, -6956, -7506, -6500, -4589, -2578, -771, 1151, 3630, 6537, 8978, 9840,
-    8680, 6150, 3557, 1914, 1318, 1122, 629, -373, -1618, -2702, -3367, -3545,
-    -3282, -2678, -1809, -632, 994, 3099, 5351, 7085, 7697, 7067, 5633, 4029,
-    2627, 1365, -19, -1598, -3041, -3790, -3530, -2597, -1897, -2233, -3534, -4720,
-    -4462, -2259, 1146, 4377, 6474, 7430, 7820, 8028, 7832, 6629, 4025, 267,
-    -3755, -6908, -8385, -8113, -6724, -5078, -3699, -2565, -1376, 10, 1381, 2358,
-    2756, 2777, 2915, 3599, 4788, 5838, 5837, 4307, 1717, -718, -1906, -1702,
-    -932, -585, -948, -1449, -1304, -315, 894, 1363, 560, -1195, -2922, -3651,
-    -3033, -1465, 318, 1800, 2892, 3699, 4175, 4075, 3236, 1867, 529, -182,
-    3, 862, 1770, 2013, 1204, -436, -2176, -3264, -3475, -3217, -3085, -3234,
-    -3158, -2086, 290, 3386, 5941, 6786, 5617, 3201, 812, -666, -1237, -1509,
-    -1936, -2361, -2291, -1556, -624, -224, -649, -1436, -1729, -976, 640, 2354,
-    3393, 3519, 3124, 2818, 2826, 2729, 1798, -315, -3136, -5574, -6631, -6032,
-    -4330, -2467, -1179, -609, -346, 182, 1233, 2524, 3466, 3688, 3371, 3057,
-    3065, 3105, 2496, 828, -1548, -3673, -4667, -4343, -3247, -2100, -1161, -68,
-    1677, 4019, 6104, 6781, 5486, 2750, -116, -1902, -2238, -1645, -969, -729,
-    -854, -921, -597, 56, 633, 704, 171, -618, -1064, -692, 541, 2177,
-    3490, 3893, 3286, 2073, 791, -367, -1663, -3377, -5245, -6396, -6017, -4146,
-    -1810, -281, -88, -647, -808, 184, 2088, 3865, 4465, 3621, 2027, 766,
-    422, 625, 418, -872, -3052, -5246, -6558, -6596, -5534, -3867, -2169, -907,
-    -274, -128, -178, -297, -575, -1000, -1157, -445, 1265, 3252, 4359, 3930,
-    2360, 741, -62, -86, -134, -1002, -2693, -4249, -4386, -2528, 582, 3279,
-    4175, 3151, 1286, -168, -737, -783, -793, -821, -588, 43, 844, 1441,
-    1618, 1377, 839, 200, -262, -297, 101, 625, 913, 884, 799, 953,
-    1321, 1520, 1138, 153, -903, -1213, -258, 1662, 3441, 3863, 2507, 98,
-    -2084, -3221, -3462, -3459, -3495, -3112, -1620, 1097, 4301, 6884, 8120, 8020,
-    7095, 5845, 4460, 2890, 1124, -609, -1913, -2491, -2413, -2165, -2401, -3517,
-    -5295, -6888, -7244, -5763, -2740, 755, 3549, 5093, 5699, 6090, 6676, 7137,
-    6691, 4823, 1877, -1036, -2782, -3040, -2495, -2196, -2661, -3536, -4079, -3920,
-    -3297, -2619, -1919, -836, 903, 3062, 4959, 5864, 5389, 3655, 1278, -817,
-    -1810, -1457, -243, 1015, 1821, 2322, 3031, 4237, 5622, 6380, 5699, 3349,
-    29, -2832, -3892, -2839, -685, 998, 1305, 579, -152, -239, 125, 377,
-    340, 422, 1143, 2574, 4230, 5403, 5615, 4889, 3732, 2776, 2263, 1802,
-    727, -1125, -3003, -3705, -2600, -256, 1937, 2777, 2030, 448, -818, -934,
-    163, 1751, 2803, 2725, 1815, 969, 837, 1223, 1341, 663, -512, -1345,
-    -1227, -264, 908, 1680, 1854, 1621, 1268, 867, 206, -988, -2627, -4050,
-    -4342, -3048, -656, 1672, 2951, 3046, 2594, 2344, 2559, 2958, 3091, 2733,
-    2025, 1348, 1083, 1382, 2041, 2573, 2470, 1516, -48, -1649, -2695, -2884,
-    -2299, -1239, 31, 1399, 2763, 3844, 4215, 3629, 2361, 1184, 869, 1577,
-    2655, 3087, 2288, 613, -904, -1399, -933, -426, -793, -2048, -3216, -3150,
-    -1490, 1081, 3421, 4708, 4797, 4025, 2829, 1516, 222, -1003, -2050, -2666,
-    -2553, -1668, -455, 331, 174, -728, -1544, -1418, -113, 1813, 3411, 4034,
-    3822, 3622, 4284, 5792, 6986, 6309, 3129, -1508, -5482, -7119, -6346, -4518,
-    -3212, -3097, -3728, -4141, -3601, -1987, 251, 2407, 3946, 4805, 5354, 5968,
-    6581, 6650, 5604, 3364, 462, -2315, -4411, -5748, -6580, -7098, -7115, -6125,
-    -3838, -774, 1747, 2469, 1312, -369, -809, 697, 3217, 5054, 5175, 3887,
-    2278, 1119, 315, -755, -2473, -4518, -6069, -6399, -5395, -3581, -1675, -89,
-    1180, 2218, 2852, 2716, 1662, 61, -1358, -1965, -1559, -382, 1049, 2130,
-    2393, 1764, 675, -205, -484, -357, -381, -905, -1705, -2161, -1797, -712,
-    472, 1075, 866, 220, -193, 65, 911, 1904, 2666, 3108, 3284, 3106,
-    2316, 768, -1275, -3168, -4214, -4036, -2759, -939, 680, 1512, 1443, 895,
-    511, 640, 1016, 961, 2, -1604, -2895, -2864, -1270, 1044, 2659, 2583,
-    967, -1045, -2227, -2152, -1330, -552, -131, 243, 973, 1943, 2476, 1925,
-    332, -1462, -2397, -1988, -678, 536, 898, 475, 43, 382, 1544, 2698,
-    2727, 1106, -1584, -3945, -4657, -3363, -928, 1132, 1643, 501, -1369, -2774,
-    -3119, -2715, -2344, -2506, -2985, -3093, -2323, -844, 565, 1094, 512, -657,
-    -1558, -1653, -1061, -299, 294, 861, 1741, 2899, 3665, 3128, 866, -2583,
-    -5940, -7918, -7982, -6611, -4891, -3701, -3092, -2380, -867, 1409, 3595, 4660,
-    4175, 2562, 717, -590, -1081, -987, -824, -1051, -1789, -2778, -3645, -4239,
-    -4664, -4947, -4772, -3687, -1636, 751, 2519, 3088, 2660, 1993, 1815, 2339,
-    3189, 3709, 3440, 2458, 1302, 490, 23, -617, -1920, -3797, -5596, -6607,
-    -6497, -5253, -2910, 440, 4327, 7785, 9761, 9750, 8041, 5384, 2492, -189,
-    -2399, -3981, -4899, -5235, -5072, -4387, -3123, -1388, 447, 1837, 2321, 1795,
-    710, -13, 518, 2449, 4835, 6160, 5460, 3109, 519, -997, -1155, -661,
-    -394, -691, -1280, -1696, -1686, -1318, -884, -719, -958, -1353, -1339, -464,
-    1188, 2995, 4300, 4925, 5161, 5265, 5009, 3773, 1155, -2429, -5681, -7070,
-    -5841, -2671, 645, 2410, 2255, 1309, 1083, 2060, 3307, 3433, 1954, -249,
-    -1730, -1687, -494, 742, 1075, 274, -1221, -2725, -3679, -3819, -3136, -1781,
-    11, 1938, 3621, 4619, 4543, 3271, 1128, -1145, -2720, -3129, -2531, -1576,
-    -955, -931, -1217, -1270, -831, -229, -143, -955, -2248, -3017, -2469, -709,
-    1354, 2755, 3131, 2723, 1897, 819, -414, -1498, -1953, -1478, -243, 1172,
-    2120, 2206, 1415, 52, -1393, -2457, -2910, -2838, -2525, -2200, -1856, -1270,
-    -225, 1220, 2608, 3232, 2587, 858, -980, -1691, -658, 1591, 3745, 4687,
-    4235, 3026, 1753, 592, -696, -2230, -3685, -4496, -4296, -3172, -1575, -41,
-    1095, 1843, 2453, 3105, 3618, 3534, 2577, 1097, -18, 19, 1241, 2828,
-    3653, 3024, 1139, -1029, -2321, -2118, -747, 772, 1505, 1315, 841, 778,
-    1142, 1244, 409, -1311, -3098, -4013, -3690, -2519, -1237, -382, 0, 224,
-    580, 1017, 1165, 739, -3, -263, 714, 2894, 5275, 6531, 5967, 3972,
-    1628, -154, -1240, -2210, -3755, -6008, -8279, -9400, -8505, -5708, -2134, 789,
-    2249, 2482, 2411, 2857, 3977, 5294, 6161, 6239, 5639, 4709, 3661, 2369,
-    529, -1925, -4515, -6385, -6882, -6091, -4790, -3797, -3279, -2665, -1290, 834,
-    2870, 3780, 3179, 1648, 274, -162, 316, 1006, 1095, 188, -1519, -3467,
-    -5112, -6167, -6576, -6341, -5432, -3881, -1903, 118, 1800, 2908, 3348, 3112,
-    2261, 977, -474, -1876, -3143, -4203, -4847, -4806, -4077, -3143, -2709, -3094,
-    -3835, -3957, -2754, -404, 2128, 3783, 4125, 3502, 2637, 2021, 1596, 939,
-    -261, -1834, -3201, -3821, -3630, -3070, -2721, -2852, -3300, -3689, -3760, -3533,
-    -3221, -3005, -2814, -2264, -882, 1437, 4074, 5842, 5737, 3762, 1061, -899,
-    -1453, -1186, -1272, -2328, -3826, -4609, -3971, -2312, -809, -449, -1265, -2381,
-    -2760, -2020, -647, 503, 947, 875, 770, 787, 568, -319, -1806, -3226,
-    -3782, -3110, -1493, 338, 1576, 1724, 894, -196, -673, -187, 751, 1163,
-    457, -1016, -2199, -2164, -870, 730, 1331, 214, -2192, -4590, -5747, -5334,
-    -3971, -2509, -1303, -132, 1270, 2718, 3638, 3562, 2557, 1211, 230, -20,
-    280, 590, 423, -303, -1242, -1944, -2251, -2441, -2983, -4092, -5444, -6305,
-    -6017, -4497, -2348, -475, 516, 673, 558, 727, 1287, 1845, 1926, 1452,
-    850, 649, 931, 1217, 923, -57, -1240, -2014, -2173, -2019, -1985, -2195,
-    -2336, -1918, -704, 979, 2298, 2410, 1105, -942, -2558, -2865, -1827, -170,
-    1151, 1517, 888, -288, -1407, -2085, -2359, -2527, -2751, -2801, -2227, -834,
-    1002, 2516, 3095, 2701, 1818, 972, 254, -702, -2268, -4258, -5835, -6034,
-    -4562, -2180, -266, 169, -733, -1762, -1584, 181, 2647, 4383, 4558, 3536,
-    2447, 2161, 2569, 2744, 1787, -377, -2889, -4589, -4872, -4067, -3080, -2627,
-    -2728, -2837, -2409, -1392, -251, 433, 478, 315, 691, 2020, 3902, 5300,
-    5318, 3930, 2005, 614, 227, 444, 375, -649, -2501, -4218, -4598, -3118,
-    -458, 1919, 2832, 2185, 823, -263, -586, -221, 486, 1149, 1462, 1303,
-    802, 212, -328, -865, -1439, -1891, -1942, -1463, -605, 335, 1163, 1896,
-    2655, 3471, 4126, 4187, 3260, 1377, -819, -2334, -2459, -1314, 158, 838,
-    257, -1060, -2051, -1988, -1010, 164, 977, 1472, 2038, 2856, 3693, 4180,
-    4174, 3832, 3411, 3053, 2692, 2078, 971, -535, -1865, -2290, -1577, -333,
-    403, -8, -1290, -2474, -2573, -1176, 1357, 4091, 6003, 6560, 6003, 5075,
-    4332, 3668, 2518, 553, -1807, -3558, -3841, -2580, -533, 1278, 2241, 2395,
-    2125, 1694, 1077, 183, -839, -1551, -1494, -525, 981, 2245, 2512, 1600,
-    133, -845, -664, 440, 1548, 1830, 1165, 145, -396, 64, 1409, 2894,
-    3544, 2817, 1109, -441, -809, 67, 1253, 1612, 698, -1029, -2710, -3715,
-    -3885, -3362, -2327, -905, 801, 2618, 4230, 5206, 5195, 4216, 2776, 1555,
-    886, 502, -117, -1135, -2126, -2456, -1881, -777, 127, 203, -779, -2535,
-    -4334, -5312, -4978, -3562, -1837, -505, 286, 874, 1645, 2689, 3811, 4698,
-    5038, 4594, 3315, 1420, -675, -2550, -3928, -4704, -4937, -4866, -4848, -5149,
-    -5708, -6081, -5675, -4130, -1595, 1250, 3490, 4440, 4020, 2796, 1608, 1052,
-    1162, 1456, 1318, 431, -996, -2386, -3238, -3527, -3693, -4195, -5040, -5736,
-    -5714, -4809, -3357, -1852, -506, 838, 2384, 3947, 4872, 4472, 2640, 92,
-    -2046, -3015, -2916, -2554, -2762, -3734, -4866, -5230, -4346, -2612, -992, -204,
-    -140, -64, 642, 1940, 3259, 3998, 3888, 2994, 1579, -14, -1492, -2754,
-    -3863, -4807, -5343, -5205, -4486, -3652, -3096, -2705, -1994, -643, 1158, 2882,
-    4077, 4585, 4504, 4078, 3582, 3142, 2550, 1365, -684, -3321, -5780, -7232,
-    -7227, -5832, -3539, -1101, 701, 1382, 1012, 144, -602, -958, -1041, -1047,
-    -953, -559, 219, 1139, 1769, 1847, 1534, 1274, 1350, 1558, 1337, 312,
-    -1228, -2420, -2470, -1343, 124, 809, 164, -1333, -2495, -2284, -579, 1719,
-    3336, 3532, 2549, 1290, 543, 434, 523, 351, -129, -556, -533, 47,
-    944, 1784, 2328, 2595, 2757, 2873, 2718, 1913, 356, -1451, -2576, -2329,
-    -863, 860, 1782, 1518, 552, -250, -331, 222, 854, 989, 424, -516,
-    -1150, -871, 402, 2099, 3373, 3686, 3125, 2191, 1346, 781, 501, 480,
-    664, 895, 941, 632, -83, -1151, -2346, -3160, -2940, -1385, 1003, 3098,
-    3959, 3546, 2659, 2164, 2286, 2520, 2110, 641, -1624, -3794, -4811, -4141,
-    -2229, -250, 743, 542, -225, -758, -677, -72, 821, 1850, 2872, 3601,
-    3631, 2652, 701, -1731, -3858, -5006, -5033, -4399, -3732, -3229, -2454, -759,
-    2016, 5223, 7692, 8424, 7181, 4619, 1916, 114, -457, -287, -252, -949,
-    -2305, -3723, -4580, -4669, -4272, -3880, -3780, -3791, -3368, -2045, 120, 2502,
-    4347, 5315, 5602, 5558, 5250, 4459, 3091, 1494, 303, -59, 237, 511,
-    13, -1590, -3956, -6181, -7239, -6567, -4439, -1813, 293, 1439, 1935, 2436,
-    3321, 4366, 4926, 4459, 3001, 1250, 161, 301, 1411, 2575, 2908, 2178,
-    853, -467, -1588, -2669, -3704, -4212, -3591, -1794, 430, 2053, 2552, 2229,
-    1834, 1913, 2439, 2907, 2740, 1734, 274, -844, -947, -3, 1307, 2055,
-    1684, 309, -1419, -2693, -2931, -2048, -513, 929, 1741, 1884, 1638, 1161,
-    325, -956, -2347, -3156, -2871, -1635, -171, 767, 941, 739, 772, 1307,
-    2026, 2321, 1912, 1183, 897, 1522, 2837, 4113, 4649, 4145, 2738, 864,
-    -902, -2064, -2453, -2308, -2032, -1829, -1581, -1070, -269, 602, 1271, 1618,
-    1735, 1852, 2186, 2771, 3390, 3749, 3783, 3746, 3878, 3986, 3443, 1773,
-    -743, -3101, -4292, -4034, -2887, -1706, -1026, -828, -749, -418, 317, 1331,
-    2294, 2848, 2845, 2441, 1972, 1679, 1539, 1339, 881, 123, -835, -1807,
-    -2554, -2827, -2476, -1546, -247, 1151, 2378, 3119, 3068, 2166, 826, -206,
-    -363, 273, 1033, 1221, 626, -431, -1471, -2247, -2835, -3454, -4192, -4822,
-    -4824, -3681, -1296, 1766, 4524, 6145, 6404, 5661, 4464, 3175, 1890, 588,
-    -688, -1781, -2502, -2789, -2836, -3030, -3657, -4586, -5252, -5055, -3842, -2060,
-    -416, 650, 1264, 1958, 3180, 4824, 6158, 6282, 4825, 2323, -114, -1575,
-    -1904, -1606, -1312, -1364, -1794, -2497, -3317, -4017, -4295, -3904, -2789, -1132,
-    681, 2208, 3194, 3751, 4270, 4996, 5674, 5672, 4534, 2437, 93, -1746,
-    -2681, -2701, -2069, -1249, -821, -1207, -2314, -3487, -3922, -3222, -1628, 225,
-    1742, 2659, 3058, 3192, 3245, 3179, 2766, 1821, 450, -948, -1954, -2418,
-    -2485, -2389, -2263, -2157, -2147, -2345, -2748, -3094, -2919, -1798, 363, 3158,
-    5748, 7194, 6944, 5198, 2845, 916, -79, -437, -878, -1826, -2968, -3505,
-    -2897, -1422, -51, 298, -516, -1761, -2430, -1978, -622, 1007, 2421, 3548,
-    4512, 5251, 5388, 4526, 2666, 346, -1640, -2732, -2923, -2675, -2514, -2626,
-    -2730, -2360, -1309, 94, 1126, 1145, 69, -1469, -2420, -1889, 303, 3406,
-    6048, 6972, 5734, 2879, -530, -3602, -5965, -7593, -8464, -8430, -7366, -5323,
-    -2534, 642, 3739, 6200, 7531, 7508, 6273, 4213, 1785, -575, -2502, -3815,
-    -4630, -5272, -5959, -6523, -6443, -5194, -2600, 1021, 4947, 8290, 10284, 10577,
-    9328, 7005, 4037, 653, -2948, -6368, -9037, -10511, -10678, -9644, -7484, -4229,
-    -144, 4023, 7194, 8470, 7664, 5467, 3115, 1735, 1702, 2441, 2840, 2033,
-    12, -2377, -4018, -4240, -3213, -1829, -1178, -1892, -3738, -5710, -6644, -5935,
-    -3880, -1406, 578, 1736, 2421, 3314, 4833, 6702, 8014, 7782, 5614, 1970,
-    -2184, -5993, -9035, -11177, -12233, -11852, -9773, -6196, -1916, 1940, 4436, 5269,
-    4797, 3637, 2147, 297, -1952, -4157, -5392, -4879, -2719, -33, 1718, 1677,
-    70, -2082, -3671, -4076, -3307, -1807, -145, 1209, 1992, 2145, 1762, 1062,
-    391, 137, 514, 1334, 2033, 2019, 1095, -425, -1992, -3245, -4185, -5013,
-    -5797, -6252, -5806, -3975, -843, 2706, 5321, 5973, 4644, 2320, 276, -755,
-    -865, -598, -398, -380, -506, -827, -1486, -2521, -3710, -4660, -5041, -4772,
-    -3991, -2899, -1602, -94, 1657, 3574, 5388, 6647, 6849, 5662, 3180, 71,
-    -2544, -3580, -2639, -420, 1570, 1967, 506, -1793, -3386, -3319, -1782, 217,
-    1661, 2127, 1835, 1276, 796, 424, -4, -587, -1217, -1650, -1688, -1274,
-    -455, 649, 1803, 2638, 2761, 1916, 59, -2638, -5679, -8121, -8753, -6736,
-    -2314, 3051, 7363, 9133, 8045, 4878, 873, -2956, -6163, -8709, -10521, -11222,
-    -10351, -7863, -4361, -775, 2239, 4569, 6402, 7801, 8549, 8325, 6949, 4529,
-    1466, -1632, -4138, -5645, -6086, -5644, -4558, -3042, -1380, -50, 342, -624,
-    -2814, -5406, -7215, -7360, -5805, -3333, -918, 974, 2578, 4357, 6336, 7855,
-    7957, 6109, 2665, -1296, -4629, -6786, -7944, -8561, -8821, -8484, -7252, -5189,
-    -2754, -441, 1580, 3466, 5371, 7075, 7917, 7136, 4440, 430, -3508, -5886,
-    -5980, -4247, -1949, -302, 241, 70, -75, 296, 1120, 1909, 2139, 1614,
-    593, -389, -850, -637, 29, 713, 969, 484, -853, -2903, -5236, -7193,
-    -8074, -7424, -5271, -2215, 752, 2677, 3144, 2521, 1724, 1603, 2392, 3627,
-    4547, 4642, 3928, 2803, 1637, 441, -1129, -3419, -6347, -9262, -11231, -11534,
-    -10029, -7165, -3728, -496, 2056, 3852, 5059, 5779, 5893, 5263, 4089, 2968,
-    2465, 2564, 2562, 1616, -548, -3342, -5720, -6908, -6885, -6225, -5448, -4475,
-    -2752, -5, 3084, 5036, 4591, 1751, -2052, -4833, -5275, -3416, -441, 2153,
-    3411, 3289, 2424, 1544, 987, 620, 112, -739, -1858, -2958, -3739, -4076,
-    -4057, -3820, -3302, -2235, -476, 1623, 3290, 3905, 3532, 2840, 2438, 2279,
-    1701, 43, -2716, -5791, -7989, -8364, -6712, -3606, 10, 3327, 5871, 7378,
-    7638, 6594, 4552, 2134, -90, -1914, -3402, -4545, -5103, -4833, -3799, -2392,
-    -1077, -187, 80, -397, -1569, -3046, -4126, -4125, -2829, -697, 1391, 2721,
-    3246, 3582, 4414, 5805, 7018, 7083, 5597, 3033, 308, -1948, -3750, -5482,
-    -7329, -8922, -9499, -8414, -5620, -1747, 2256, 5612, 7951, 9188, 9290, 8211,
-    6029, 3090, 42, -2291, -3188, -2442, -668, 893, 1132, -96, -1821, -2693,
-    -2012, -203, 1587, 2374, 2001, 1154, 770, 1271, 2220, 2668, 1952, 260,
-    -1519, -2483, -2343, -1511, -716, -501, -914, -1516, -1697, -1096, 156, 1589,
-    2812, 3810, 4834, 6010, 7043, 7298, 6233, 3881, 985, -1424, -2747, -3265,
-    -3823, -4984, -6435, -7216, -6554, -4516, -1923, 300, 1726, 2581, 3417, 4619,
-    6098, 7371, 7963, 7751, 6921, 5613, 3697, 991, -2290, -5390, -7406, -7888,
-    -7106, -5771, -4464, -3263, -1800, 314, 3025, 5674, 7308, 7274, 5689, 3402,
-    1454, 428, 178, 112, -235, -831, -1232, -995, -50, 1229, 2251, 2523,
-    1868, 475, -1209, -2674, -3524, -3561, -2762, -1239, 777, 2932, 4766, 5809,
-    5729, 4477, 2344, -155, -2534, -4547, -6185, -7441, -8080, -7663, -5860, -2819,
-    720, 3743, 5552, 6217, 6457, 6970, 7728, 7894, 6472, 3153, -1361, -5763,
-    -8877, -10183, -9868, -8507, -6627, -4462, -2080, 263, 1968, 2449, 1720, 603,
-    194, 1039, 2747, 4349, 5055, 4768, 4026, 3493, 3385, 3248, 2310, 157,
-    -2798, -5492, -6920, -6787, -5605, -4252, -3381, -3056, -2797, -1953, -185, 2287,
-    4824, 6784, 7845, 8029, 7521, 6466, 4870, 2637, -220, -3305, -5787, -6803,
-    -6046, -4008, -1574, 622, 2442, 3961, 5086, 5521, 5050, 3813, 2323, 1232,
-    950, 1320, 1637, 1129, -393, -2331, -3766, -4204, -3868, -3336, -2920, -2394,
-    -1238, 844, 3569, 6128, 7633, 7666, 6488, 4758, 3013, 1415, -69, -1347,
-    -2151, -2306, -2016, -1840, -2365, -3759, -5513, -6613, -6130, -3885, -626, 2468,
-    4564, 5585, 5985, 6240, 6500, 6583, 6150, 4918, 2874, 381, -1975, -3728,
-    -4802, -5448, -5928, -6272, -6271, -5640, -4183, -1928, 806, 3481, 5555, 6702,
-    6840, 5994, 4191, 1578, -1393, -3970, -5407, -5400, -4282, -2797, -1558, -606,
-    517, 2202, 4202, 5641, 5651, 4082, 1653, -562, -1861, -2298, -2482, -2981,
-    -3773, -4176, -3426, -1474, 744, 1947, 1544, 76, -1336, -1970, -1960, -1907,
-    -2156, -2452, -2163, -815, 1480, 3979, 5715, 6124, 5406, 4259, 3192, 2085,
-    417, -2081, -4995, -7410, -8460, -7812, -5805, -3230, -918, 663, 1566, 2195,
-    2937, 3858, 4693, 5050, 4685, 3668, 2326, 1033, -10, -785, -1299, -1439,
-    -1081, -313, 481, 828, 469, -467, -1551, -2303, -2491, -2296, -2183, -2467,
-    -2892, -2659, -1009, 2083, 5679, 8340, 8962, 7412, 4558, 1670, -390, -1612,
-    -2565, -3691, -4833, -5404, -4969, -3623, -1869, -194, 1242, 2577, 3964, 5258,
-    5959, 5544, 3953, 1738, -344, -1920, -3141, -4233, -5030, -5033, -3913, -1876,
-    438, 2316, 3284, 3264, 2617, 1984, 1890, 2363, 2952, 3133, 2697, 1800,
-    742, -217, -939, -1441, -1905, -2524, -3254, -3742, -3597, -2756, -1583, -583,
-    -48, 87, 108, 267, 615, 1015, 1340, 1668, 2245, 3189, 4210, 4672,
-    4004, 2139, -365, -2629, -3972, -4314, -4176, -4217, -4612, -4838, -4106, -2102,
-    651, 3141, 4601, 4981, 4808, 4639, 4553, 4083, 2648, 147, -2771, -5108,
-    -6260, -6401, -6137, -5774, -4982, -3189, -302, 2961, 5404, 6096, 4935, 2648,
-    260, -1554, -2720, -3461, -3786, -3354, -1854, 501, 2886, 4286, 4054, 2227,
-    -529, -3261, -5175, -5959, -5781, -4996, -3819, -2278, -422, 1503, 3134, 4210,
-    4723, 4866, 4861, 4775, 4421, 3442, 1563, -1133, -4130, -6705, -8262, -8565,
-    -7758, -6216, -4332, -2339, -311, 1664, 3290, 4114, 3839, 2615, 1040, -141,
-    -391, 402, 1885, 3383, 4222, 4087, 3135, 1740, 116, -1762, -3888, -5922,
-    -7231, -7267, -5939, -3695, -1270, 733, 2157, 3272, 4410, 5563, 6343, 6374,
-    5693, 4712, 3783, 2851, 1532, -453, -2944, -5327, -6850, -7037, -5958, -4145,
-    -2174, -259, 1746, 3937, 5995, 7278, 7305, 6124, 4272, 2428, 1061, 241,
-    -376, -1290, -2706, -4231, -5087, -4772, -3542, -2189, -1295, -702, 262, 2061,
-    4383, 6243, 6653, 5341, 2971, 666, -806, -1514, -2106, -3053, -4158, -4758,
-    -4413, -3356, -2306, -1869, -2080, -2429, -2267, -1270, 349, 2002, 3124, 3524,
-    3429, 3217, 3066, 2800, 2038, 536, -1516, -3496, -4730, -4994, -4709, -4554,
-    -4820, -5114, -4716, -3244, -962, 1491, 3584, 5101, 5988, 6153, 5442, 3751,
-    1138, -2099, -5381, -7934, -9088, -8627, -6885, -4491, -2006, 253, 2138, 3554,
-    4437, 4744, 4394, 3274, 1414, -824, -2817, -4061, -4494, -4407, -4022, -3223,
-    -1749, 352, 2492, 3837, 3869, 2739, 1115, -316, -1259, -1842, -2306, -2691,
-    -2766, -2210, -879, 1036, 3019, 4415, 4736, 3912, 2308, 449, -1298, -2813,
-    -4049, -4863, -5044, -4491, -3324, -1840, -390, 759, 1577, 2317, 3325, 4641,
-    5779, 6008, 4963, 2996, 901, -682, -1608, -2081, -2294, -2258, -1885, -1153,
-    -205, 685, 1253, 1434, 1452, 1647, 2165, 2801, 3196, 3190, 2979, 2956,
-    3360, 4030, 4404, 3809, 1927, -857, -3540, -5086, -5078, -3924, -2452, -1257,
-    -348, 677, 2114, 3726, 4794, 4697, 3571, 2355, 2025, 2649, 3261, 2753,
-    907, -1464, -3322, -4234, -4437, -4334, -4106, -3723, -3070, -1983, -318, 1804,
-    3865, 5232, 5680, 5551, 5343, 5162, 4644, 3387, 1380, -964, -3104, -4661,
-    -5541, -5897, -5975, -5902, -5545, -4600, -2892, -623, 1678, 3456, 4410, 4568,
-    4147, 3395, 2508, 1653, 988, 639, 651, 962, 1405, 1723, 1558, 559,
-    -1358, -3766, -5817, -6744, -6388, -5206, -3742, -2111, -67, 2452, 4952, 6623,
-    6942, 6059, 4612, 3225, 2124, 1096, -226, -1977, -3828, -5120, -5306, -4370,
-    -2833, -1336, -189, 689, 1473, 2119, 2356, 1902, 672, -1136, -3083, -4605,
-    -5231, -4786, -3441, -1520, 707, 2995, 4925, 5869, 5347, 3510, 1203, -572,
-    -1354, -1451, -1500, -1822, -2168, -2011, -1060, 485, 2069, 3140, 3428, 3023,
-    2257, 1481, 863, 308, -419, -1427, -2495, -3144, -2986, -2046, -745, 456,
-    1416, 2308, 3303, 4281, 4864, 4689, 3662, 2046, 378, -754, -1052, -766,
-    -554, -914, -1683, -2177, -1896, -1100, -591, -939, -1928, -2755, -2687, -1553,
-    263, 2117, 3427, 3912, 3700, 3216, 2852, 2650, 2324, 1621, 633, -286,
-    -874, -1199, -1539, -2075, -2702, -3103, -2958, -2134, -781, 711, 1902, 2587,
-    2922, 3215, 3532, 3539, 2809, 1313, -440, -1786, -2418, -2502, -2386, -2301,
-    -2350, -2595, -2956, -3073, -2457, -967, 925, 2449, 3171, 3280, 3219, 3130,
-    2701, 1524, -440, -2715, -4542, -5295, -4844, -3642, -2424, -1675, -1308, -873,
-    -108, 754, 1230, 1126, 739, 566, 830, 1314, 1602, 1439, 891, 237,
-    -250, -461, -471, -470, -641, -1041, -1539, -1886, -1908, -1685, -1508, -1552,
-    -1563, -958, 643, 2929, 4983, 5930, 5535, 4180, 2346, 225, -2130, -4401,
-    -5914, -6058, -4798, -2736, -676, 924, 2128, 3257, 4478, 5571, 6044, 5479,
-    3863, 1653, -477, -2017, -2846, -3152, -3213, -3238, -3308, -3337, -3072, -2245,
-    -863, 664, 1781, 2243, 2263, 2190, 2095, 1789, 1216, 701, 711, 1404,
-    2456, 3304, 3505, 2928, 1737, 282, -1082, -2206, -3193, -4201, -5137, -5603,
-    -5175, -3742, -1617, 626, 2416, 3435, 3750, 3737, 3740, 3728, 3311, 2196,
-    601, -817, -1487, -1361, -879, -585, -764, -1321, -1895, -2124, -1909, -1500,
-    -1247, -1255, -1289, -1091, -711, -463, -537, -724, -561, 283, 1766, 3478,
-    4806, 5142, 4173, 2152, -127, -1742, -2209, -1723, -912, -348, -236, -425,
-    -638, -708, -693, -805, -1201, -1777, -2170, -2029, -1355, -572, -219, -538,
-    -1310, -2081, -2515, -2536, -2219, -1611, -678, 613, 2192, 3807, 5032, 5432,
-    4862, 3668, 2482, 1690, 1054, -40, -1913, -4177, -6008, -6822, -6668, -6039,
-    -5362, -4674, -3667, -1980, 473, 3309, 5785, 7200, 7344, 6599, 5582, 4645,
-    3716, 2569, 1195, -132, -1124, -1772, -2365, -3200, -4267, -5196, -5534, -5102,
-    -4101, -2892, -1679, -411, 1073, 2818, 4666, 6315, 7425, 7753, 7256, 6112,
-    4588, 2840, 873, -1292, -3407, -5025, -5786, -5695, -5098, -4354, -3522, -2339,
-    -547, 1744, 3969, 5417, 5679, 4896, 3627, 2468, 1730, 1372, 1152, 866,
-    494, 204, 182, 437, 723, 663, 21, -1105, -2283, -2969, -2816, -1860,
-    -467, 933, 2105, 3063, 3899, 4601, 5021, 4980, 4375, 3232, 1741, 254,
-    -852, -1414, -1608, -1772, -2052, -2253, -2047, -1321, -304, 634, 1278, 1680,
-    2033, 2441, 2770, 2711, 2045, 928, -80, -355, 286, 1364, 2026, 1619,
-    127, -1851, -3520, -4373, -4406, -3955, -3331, -2575, -1548, -225, 1128, 2098,
-    2451, 2324, 2075, 1951, 1871, 1522, 683, -489, -1475, -1751, -1220, -371,
-    27, -508, -1766, -2991, -3456, -3009, -2122, -1429, -1196, -1209, -1111, -790,
-    -425, -230, -224, -272, -276, -283, -422, -775, -1286, -1763, -1971, -1793,
-    -1326, -778, -222, 491, 1509, 2658, 3399, 3173, 1799, -406, -2793, -4695,
-    -5711, -5891, -5666, -5446, -5178, -4348, -2541, -16, 2341, 3684, 3804, 3143,
-    2336, 1794, 1594, 1574, 1470, 1072, 380, -392, -1003, -1404, -1755, -2238,
-    -2871, -3488, -3864, -3882, -3651, -3448, -3467, -3560, -3255, -2119, -146, 2198,
-    4262, 5518, 5697, 4836, 3290, 1576, 37, -1379, -2903, -4482, -5621, -5758,
-    -4745, -2924, -801, 1215, 2823, 3772, 3946, 3420, 2343, 790, -1122, -3003,
-    -4241, -4459, -3867, -3053, -2398, -1771, -823, 515, 1876, 2756, 2914, 2528,
-    2064, 1961, 2315, 2745, 2627, 1602, -40, -1497, -2042, -1568, -631, 0,
-    -153, -1056, -2292, -3313, -3681, -3237, -2169, -896, 224, 1167, 2210, 3570,
-    5075, 6204, 6498, 5912, 4751, 3323, 1728, -16, -1747, -3150, -3981, -4222,
-    -4032, -3591, -3029, -2429, -1796, -1008, 90, 1485, 2880, 3847, 4114, 3706,
-    2814, 1611, 218, -1187, -2352, -3091, -3414, -3480, -3403, -3134, -2516, -1423,
-    153, 2048, 3896, 5172, 5453, 4756, 3585, 2520, 1666, 567, -1256, -3664,
-    -5820, -6780, -6191, -4488, -2532, -1073, -404, -292, -187, 395, 1482, 2586,
-    3097, 2829, 2216, 1947, 2387, 3317, 4162, 4419, 3874, 2546, 579, -1769,
-    -4075, -5840, -6728, -6737, -6133, -5208, -4088, -2747, -1120, 794, 2864, 4783,
-    6081, 6352, 5540, 4016, 2281, 612, -958, -2331, -3170, -3149, -2328, -1189,
-    -258, 244, 385, 295, 51, -272, -596, -916, -1320, -1847, -2354, -2563,
-    -2237, -1329, -34, 1247, 2053, 2150, 1731, 1275, 1134, 1272, 1421, 1408,
-    1234, 888, 308, -400, -840, -624, 203, 1145, 1711, 1791, 1540, 1027,
-    147, -1104, -2421, -3335, -3537, -3028, -2027, -836, 247, 1005, 1380, 1471,
-    1400, 1204, 899, 641, 738, 1405, 2464, 3342, 3439, 2623, 1352, 298,
-    -244, -588, -1313, -2669, -4313, -5569, -5923, -5323, -4095, -2666, -1315, -82,
-    1142, 2413, 3594, 4434, 4783, 4728, 4494, 4257, 4051, 3767, 3192, 2112,
-    566, -969, -1821, -1741, -1273, -1322, -2256, -3502, -4093, -3560, -2221, -700,
-    641, 1767, 2693, 3361, 3754, 3932, 3895, 3509, 2665, 1478, 214, -928,
-    -1864, -2394, -2100, -648, 1740, 4199, 5734, 5891, 4955, 3567, 2186, 924,
-    -236, -1242, -2042, -2720, -3393, -3946, -4000, -3300, -2081, -872, 106, 1218,
-    2933, 5092, 6831, 7315, 6497, 5083, 3844, 3082, 2696, 2528, 2461, 2285,
-    1705, 598, -821, -2187, -3314, -4259, -5079, -5610, -5547, -4672, -2976, -613,
-    2154, 4924, 7200, 8575, 8917, 8363, 7119, 5336, 3212, 1177, -147, -274,
-    757, 2253, 3136, 2467, -32, -3762, -7466, -9796, -9916, -7763, -3902, 817,
-    5505, 9350, 11737, 12399, 11452, 9200, 5907, 1823, -2553, -6363, -8690, -9076,
-    -7746, -5335, -2450, 509, 3231, 5356, 6512, 6421, 4929, 2069, -1725, -5462,
-    -7860, -8062, -6229, -3418, -839, 852, 1658, 1898, 1906, 2005, 2498, 3502,
-    4748, 5662, 5678, 4492, 2102, -1209, -4801, -7695, -8964, -8362, -6635, -5055,
-    -4464, -4624, -4453, -2960, -51, 3385, 6083, 7154, 6471, 4613, 2523, 1104,
-    796, 1321, 1786, 1239, -645, -3278, -5536, -6488, -5902, -4224, -2207, -572,
-    174, -162, -1348, -2724, -3411, -2690, -364, 3092, 6633, 9022, 9371, 7593,
-    4429, 959, -2076, -4563, -6694, -8395, -9135, -8314, -5826, -2222, 1631, 4971,
-    7262, 8083, 7168, 4687, 1428, -1434, -2938, -2827, -1619, -264, 338, -272,
-    -1932, -3961, -5480, -5810, -4712, -2413, 499, 3230, 5024, 5454, 4630, 3115,
-    1613, 642, 384, 678, 1094, 1086, 283, -1212, -2785, -3663, -3440, -2375,
-    -1232, -788, -1367, -2696, -4088, -4761, -4128, -2002, 1248, 4697, 7187, 7899,
-    6777, 4441, 1675, -963, -3099, -4318, -4237, -2943, -1247, -319, -870, -2609,
-    -4394, -5013, -3987, -1880, 128, 1144, 1254, 1386, 2349, 3910, 4838, 3952,
-    1162, -2437, -5455, -7093, -7293, -6252, -4040, -750, 3100, 6478, 8244, 7728,
-    5047, 1015, -3193, -6425, -7929, -7604, -5944, -3642, -1141, 1442, 3943, 5835,
-    6382, 5165, 2426, -1085, -4501, -7062, -8180, -7572, -5463, -2545, 415, 2973,
-    5054, 6704, 7904, 8564, 8515, 7458, 5082, 1429, -2856, -6780, -9588, -11083,
-    -11390, -10562, -8520, -5374, -1657, 1803, 4261, 5329, 5007, 3544, 1283, -1365,
-    -3814, -5222, -4748, -2131, 1836, 5502, 7230, 6329, 3337, -520, -4185, -7258,
-    -9806, -11765, -12595, -11584, -8598, -4448, -400, 2763, 5150, 7221, 8980, 9838,
-    9240, 7276, 4577, 1725, -1102, -3945, -6702, -8984, -10255, -10017, -7985, -4279,
-    425, 4998, 8251, 9437, 8500, 5960, 2581, -951, -4144, -6649, -8139, -8286,
-    -6898, -4169, -830, 2001, 3370, 3121, 2024, 1129, 830, 604, -234, -1552,
-    -2354, -1771, 40, 2104, 3610, 4471, 4960, 5105, 4669, 3562, 1939, -125,
-    -2749, -5797, -8444, -9540, -8595, -6304, -3962, -2309, -956, 1073, 4240, 7844,
-    10367, 10541, 8276, 4725, 1399, -886, -2325, -3506, -4537, -4881, -3995, -2068,
-    -64, 959, 589, -767, -2295, -3323, -3573, -3091, -2061, -650, 1065, 3080,
-    5280, 7190, 7984, 6952, 4158, 619, -2300, -3803, -4032, -3623, -3033, -2301,
-    -1314, -89, 1195, 2288, 2905, 2825, 2119, 1226, 630, 378, 88, -497,
-    -1058, -1006, -214, 730, 1099, 742, 113, -325, -486, -465, -208, 354,
-    921, 910, 182, -436, 345, 3022, 6569, 9080, 9218, 7074, 3764, 368,
-    -2646, -5192, -7119, -8158, -8187, -7354, -5894, -3967, -1694, 715, 2996, 4937,
-    6359, 6995, 6555, 5021, 2873, 907, -239, -430, 19, 663, 1236, 1724,
-    2215, 2639, 2600, 1549, -747, -3821, -6615, -8076, -7750, -5941, -3388, -778,
-    1588, 3836, 6215, 8600, 10217, 10035, 7662, 3941, 466, -1671, -2700, -3646,
-    -5004, -6071, -5694, -3597, -791, 1379, 2433, 2928, 3543, 4248, 4410, 3498,
-    1487, -1289, -4303, -6722, -7466, -5885, -2558, 816, 2659, 2743, 2168, 2174,
-    3035, 4009, 4141, 3046, 1170, -452, -794, 445, 2497, 4045, 4295, 3545,
-    2541, 1391, -597, -3816, -7330, -9301, -8564, -5696, -2486, -443, 134, -60,
-    -129, 517, 2063, 4297, 6624, 8284, 8768, 8089, 6629, 4739, 2496, -168,
-    -3167, -6061, -8133, -8738, -7746, -5732, -3619, -1940, -435, 1477, 3724, 5253,
-    4954, 2980, 927, 451, 1702, 3280, 3752, 3007, 2020, 1547, 1407, 1033,
-    352, -185, -280, -80, 249, 893, 1989, 3007, 2905, 1129, -1658, -3977,
-    -4644, -3471, -1112, 1499, 3557, 4607, 4671, 4151, 3419, 2469, 1115, -428,
-    -1404, -1195, -91, 884, 1062, 929, 1616, 3559, 5779, 6587, 5004, 1538,
-    -2253, -4833, -5490, -4496, -2804, -1539, -1395, -2192, -2962, -2635, -848, 1827,
-    4366, 6012, 6589, 6323, 5496, 4277, 2747, 1025, -598, -1651, -1747, -998,
-    -101, 186, -176, -401, 273, 1561, 2128, 741, -2532, -6251, -8666, -8843,
-    -6972, -3933, -708, 1978, 3811, 4875, 5413, 5502, 4964, 3663, 1841, 53,
-    -1225, -1857, -1935, -1584, -1025, -697, -1030, -1962, -2831, -2974, -2407, -1749,
-    -1434, -1238, -745, -125, -116, -1085, -2332, -2616, -1399, 544, 1804, 1555,
-    165, -1160, -1258, 241, 2617, 4416, 4384, 2402, -386, -2455, -2983, -2168,
-    -751, 495, 876, -144, -2538, -5394, -7354, -7628, -6521, -4909, -3343, -1815,
-    -284, 977, 1713, 2188, 3019, 4428, 5777, 6018, 4629, 2169, -58, -922,
-    -258, 1006, 1489, 291, -2471, -5852, -8755, -10476, -10799, -9797, -7671, -4736,
-    -1426, 1767, 4377, 6061, 6707, 6493, 5770, 4792, 3546, 1845, -371, -2806,
-    -4824, -5722, -5157, -3493, -1775, -1081, -1644, -2503, -2204, -83, 3021, 5300,
-    5311, 2982, -455, -3353, -4613, -4151, -2735, -1385, -698, -507, -141, 868,
-    2222, 2980, 2323, 271, -2274, -4176, -4766, -4042, -2361, -96, 2412, 4690,
-    6085, 5969, 4109, 939, -2492, -5013, -6054, -6047, -6032, -6642, -7413, -7133,
-    -4967, -1277, 2633, 5449, 6579, 6221, 5067, 3991, 3718, 4373, 5273, 5339,
-    3927, 1315, -1613, -4043, -5518, -5762, -4591, -2248, 307, 1759, 1308, -752,
-    -3282, -5045, -5299, -3970, -1583, 944, 2754, 3592, 3957, 4550, 5482, 6066,
-    5441, 3381, 492, -2238, -3999, -4376, -3376, -1453, 540, 1725, 1715, 785,
-    -462, -1547, -2226, -2321, -1698, -483, 830, 1634, 1598, 792, -450, -1688,
-    -2458, -2501, -2046, -1715, -1885, -2081, -1247, 1189, 4479, 6916, 7102, 5002,
-    1914, -472, -1143, -304, 873, 1090, -180, -2391, -4465, -5681, -6107, -6264,
-    -6491, -6623, -6191, -4824, -2502, 414, 3338, 5697, 7129, 7523, 6907, 5397,
-    3299, 1216, -81, -31, 1318, 3160, 4192, 3256, 91, -4335, -8319, -10525,
-    -10783, -9862, -8503, -6722, -4063, -390, 3697, 7208, 9391, 10024, 9267, 7423,
-    4909, 2312, 312, -552, -159, 1075, 2278, 2441, 910, -2147, -5617, -7897,
-    -7766, -5181, -1406, 1664, 2611, 1303, -1110, -2990, -3273, -2081, -495, 366,
-    269, 64, 916, 3172, 5877, 7407, 6681, 3907, 295, -2827, -4651, -4930,
-    -3739, -1376, 1606, 4445, 6337, 6615, 4924, 1474, -2781, -6440, -8431, -8663,
-    -7887, -6866, -5696, -3918, -1182, 2249, 5532, 7650, 7904, 6352, 3961, 2203,
-    2122, 3534, 5113, 5357, 3627, 411, -3207, -6238, -8111, -8657, -8038, -6693,
-    -5174, -3889, -2968, -2341, -1867, -1333, -455, 912, 2498, 3709, 4150, 4078,
-    4195, 4961, 6118, 6844, 6240, 3776, -380, -5115, -8579, -9175, -6790, -3069,
-    -235, 536, -273, -1283, -1383, -336, 1310, 2591, 2645, 1325, -542, -1689,
-    -1406, -34, 1522, 2595, 2960, 2472, 939, -1421, -3594, -4197, -2489, 1009,
-    4817, 7352, 7651, 5681, 2318, -1015, -3101, -3697, -3670, -4198, -5698, -7434,
-    -8149, -7111, -4664, -1925, -3, 678, 537, 439, 1069, 2512, 4316, 5888,
-    6822, 6920, 6091, 4370, 2059, -236, -1847, -2415, -2123, -1634, -1739, -2897,
-    -4943, -7185, -8808, -9277, -8453, -6493, -3728, -602, 2458, 5214, 7657, 9783,
-    11321, 11716, 10460, 7518, 3526, -406, -3209, -4393, -4245, -3522, -2897, -2603,
-    -2515, -2434, -2239, -1856, -1247, -536, -84, -300, -1242, -2339, -2570, -1125,
-    1866, 5141, 6994, 6436, 3930, 1084, -436, 76, 2059, 4061, 4511, 2580,
-    -1201, -5034, -6864, -5741, -2453, 1140, 3462, 4102, 3628, 2785, 1934, 1039,
-    -71, -1506, -3218, -4903, -6005, -5958, -4529, -1931, 1362, 4766, 7515, 8662,
-    7578, 4692, 1575, -21, 546, 2412, 3994, 4123, 2552, -205, -3232, -5505,
-    -6321, -5764, -4703, -4127, -4312, -4637, -4169, -2421, 354, 3351, 5637, 6558,
-    6038, 4642, 3272, 2663, 3023, 3985, 4811, 4679, 3064, 122, -3179, -5505,
-    -5985, -4802, -3035, -1852, -1731, -2232, -2395, -1420, 747, 3244, 4736, 4314,
-    2243, -124, -1305, -729, 1014, 2773, 3625, 3193, 1544, -932, -3533, -5329,
-    -5486, -3689, -370, 3388, 6272, 7315, 6369, 4156, 1825, 257, -421, -855,
-    -1956, -4143, -6819, -8580, -8171, -5484, -1759, 1228, 2310, 1560, 112, -572,
-    430, 2929, 5701, 7294, 7023, 5318, 3199, 1451, 279, -489, -1098, -1745,
-    -2561, -3529, -4492, -5293, -5871, -6165, -5996, -5205, -3914, -2496, -1218, 62,
-    1750, 4070, 6737, 8990, 9901, 8813, 5764, 1646, -2162, -4573, -5397, -5257,
-    -4908, -4638, -4226, -3371, -2082, -717, 255, 546, 187, -531, -1241, -1651,
-    -1553, -751, 854, 2991, 4867, 5515, 4470, 2177, -296, -1960, -2425, -1964,
-    -1286, -1188, -2053, -3424, -4140, -3231, -842, 1753, 3174, 2969, 1760, 557,
-    30, 223, 615, 412, -934, -3194, -5361, -6340, -5768, -4130, -2138, -135,
-    1869, 3752, 5060, 5278, 4340, 2854, 1816, 1926, 2972, 3832, 3242, 798,
-    -2645, -5528, -6657, -5956, -4433, -3444, -3748, -4946, -5725, -4810, -1933, 1951,
-    5378, 7341, 7733, 7062, 5893, 4540, 3098, 1603, 116, -1276, -2512, -3562,
-    -4393, -4871, -4742, -3794, -2163, -483, 389, -10, -1287, -2361, -2217, -678,
-    1408, 2729, 2439, 795, -967, -1500, -353, 1685, 3212, 3285, 2016, 270,
-    -1080, -1647, -1517, -974, -275, 458, 1206, 1909, 2333, 2185, 1445, 508,
-    -149, -475, -944, -2087, -3925, -5796, -6675, -5732, -2881, 973, 4271, 5737,
-    5253, 3888, 3002, 3197, 4023, 4484, 3795, 1860, -674, -2732, -3423, -2654,
-    -1247, -348, -565, -1595, -2615, -3004, -2702, -2009, -1166, -201, 882, 1847,
-    2267, 1897, 1037, 506, 1099, 2881, 4909, 5731, 4433, 1438, -1661, -3203,
-    -2645, -881, 535, 573, -598, -1865, -2063, -830, 1135, 2556, 2448, 740,
-    -1765, -3951, -4981, -4544, -2810, -294, 2272, 4136, 4765, 4045, 2394, 681,
-    -113, 502, 2060, 3319, 3155, 1499, -549, -1582, -1009, 503, 1567, 1107,
-    -910, -3507, -5379, -5714, -4635, -3007, -1815, -1528, -1833, -1896, -953, 1169,
-    3944, 6468, 7947, 7998, 6691, 4437, 1845, -430, -1864, -2249, -1816, -1224,
-    -1256, -2299, -3948, -5176, -5081, -3613, -1611, -154, 160, -497, -1382, -1579,
-    -470, 1820, 4337, 5818, 5591, 4040, 2225, 999, 501, 343, 103, -426,
-    -1298, -2485, -3764, -4666, -4669, -3557, -1621, 435, 1767, 1736, 272, -1879,
-    -3353, -2992, -794, 1913, 3424, 2994, 1356, 42, 228, 2057, 4690, 6752,
-    6964, 4884, 1390, -1711, -2904, -2063, -368, 831, 1033, 626, 204, 62,
-    229, 671, 1260, 1662, 1433, 362, -1298, -2916, -3775, -3354, -1549, 1159,
-    3744, 5061, 4544, 2692, 830, 256, 1361, 3398, 5003, 5069, 3435, 1004,
-    -794, -953, 381, 1981, 2418, 1054, -1641, -4548, -6606, -7213, -6299, -4276,
-    -1911, -18, 986, 1366, 1889, 3279, 5650, 8291, 9983, 9672, 7140, 3224,
-    -580, -2893, -3191, -2075, -921, -1051, -2859, -5488, -7334, -7104, -4694, -1251,
-    1589, 2732, 2207, 983, 221, 543, 1775, 3206, 4084, 3992, 2971, 1426,
-    -85, -1072, -1255, -635, 478, 1465, 1612, 568, -1253, -2791, -3004, -1571,
-    901, 3219, 4158, 3011, 58, -3322, -5302, -4823, -2418, 206, 1522, 1252,
-    327, 28, 1156, 3633, 6478, 8168, 7493, 4522, 770, -1837, -2386, -1453,
-    -301, 201, -123, -1155, -2748, -4532, -5777, -5771, -4378, -2147, 63, 1493,
-    1735, 1001, 260, 767, 2958, 5749, 7233, 6299, 3565, 697, -1012, -1357,
-    -900, -411, -588, -1778, -3532, -4614, -3951, -1717, 705, 1953, 1748, 681,
-    -699, -2191, -3439, -3656, -2247, 396, 3005, 4435, 4501, 3902, 3555, 4004,
-    5159, 6261, 6131, 3901, -152, -4454, -7032, -6816, -4272, -932, 1619, 2554,
-    2027, 929, 313, 724, 1787, 2461, 1856, -27, -2290, -3784, -3835, -2489,
-    -286, 2078, 3965, 4873, 4514, 2946, 716, -1212, -1903, -1123, 308, 969,
-    -91, -2536, -4893, -5569, -3919, -631, 2688, 4375, 3592, 831, -2318, -4128,
-    -3845, -2124, -421, 142, -472, -1340, -1353, 12, 2413, 4875, 6296, 5937,
-    3730, 330, -3109, -5388, -5809, -4537, -2533, -1016, -745, -1589, -2687, -3056,
-    -2205, -364, 1729, 3207, 3442, 2332, 479, -983, -1035, 431, 2364, 3233,
-    2150, -483, -3301, -4899, -4598, -2671, -102, 1903, 2480, 1554, -139, -1524,
-    -1832, -937, 739, 2489, 3512, 3140, 1228, -1512, -3707, -4164, -2763, -610,
-    745, 391, -1346, -3148, -3520, -1706, 1735, 5071, 6376, 4830, 1356, -1996,
-    -3485, -2769, -880, 669, 816, -588, -2869, -4969, -6061, -5985, -5176, -4175,
-    -3217, -2283, -1351, -423, 688, 2298, 4384, 6232, 6777, 5414, 2505, -854,
-    -3443, -4432, -3670, -1877, -489, -854, -3157, -6050, -7573, -6640, -3773, -562,
-    1469, 1620, 161, -1851, -3003, -2308, 2, 2470, 3479, 2514, 470, -1187,
-    -1455, -167, 2202, 4748, 6283, 5749, 2913, -1282, -5165, -7274, -7080, -5096,
-    -2531, -679, -239, -868, -1446, -1014, 371, 1696, 1909, 793, -945, -2220,
-    -2170, -493, 2380, 5307, 6879, 6235, 3635, 234, -2703, -4410, -4688, -3746,
-    -2208, -1113, -1460, -3409, -5887, -7149, -5976, -2573, 1493, 4239, 4471, 2521,
-    25, -1172, -268, 1984, 3878, 3980, 2067, -749, -2666, -2241, 665, 4592,
-    7220, 6814, 3348, -1595, -5966, -8410, -8656, -7261, -5218, -3572, -2894, -2838,
-    -2334, -510, 2492, 5609, 7714, 8289, 7413, 5494, 3259, 1768, 1884, 3425,
-    4965, 4793, 2237, -1870, -5877, -8348, -8653, -7046, -4504, -2311, -1324, -1353,
-    -1346, -337, 1709, 3990, 5615, 6164, 5675, 4441, 2983, 1976, 1845, 2316,
-    2530, 1723, -196, -2683, -4948, -6206, -5801, -3531, -90, 3012, 4344, 3585,
-    1684, 25, -555, -84, 860, 1567, 1485, 500, -830, -1487, -758, 1049,
-    2722, 3078, 1871, -112, -1684, -1940, -582, 2045, 5026, 7139, 7400, 5587,
-    2330, -1298, -4297, -6022, -6272, -5366, -4079, -3235, -3118, -3219, -2628, -756,
-    2195, 5292, 7323, 7431, 5686, 3258, 1792, 2205, 3861, 4985, 4087, 1113,
-    -2632, -5528, -6584, -5703, -3448, -780, 1237, 1883, 1166, -228, -1425, -1804,
-    -1092, 687, 3075, 5105, 5714, 4581, 2562, 1083, 909, 1467, 1354, -447,
-    -3736, -7191, -9100, -8204, -4363, 1167, 6122, 8390, 7337, 4274, 1526, 745,
-    1830, 3241, 3327, 1524, -1413, -4120, -5586, -5659, -4882, -3964, -3345, -3117,
-    -3106, -2933, -2077, -151, 2691, 5632, 7601, 7915, 6590, 4188, 1537, -434,
-    -952, 72, 1662, 2221, 748, -2253, -5111, -6324, -5670, -4122, -2892, -2526,
-    -2686, -2537, -1330, 1090, 4100, 6597, 7646, 7015, 5149, 2731, 340, -1497,
-    -2153, -1142, 1311, 3965, 5091, 3631, 84, -3680, -5693, -5275, -3461, -2114,
-    -2461, -4201, -5815, -5724, -3377, 401, 3900, 5509, 4663, 2239, 88, -174,
-    1737, 4626, 6784, 7196, 5952, 3716, 1042, -1703, -3989, -5102, -4726, -3469,
-    -2579, -2950, -4358, -5649, -5641, -3932, -1091, 1715, 3325, 3203, 1856, 693,
-    1141, 3512, 6529, 8065, 6641, 2520, -2438, -5960, -6647, -4545, -876, 2650,
-    4540, 4084, 1685, -1293, -3326, -3743, -3147, -2775, -3326, -4395, -4966, -4359,
-    -2628, -222, 2406, 4727, 5950, 5347, 3019, 214, -1364, -738, 1702, 4540,
-    6207, 5733, 3153, -439, -3333, -4222, -3190, -1732, -1547, -3118, -5388, -6774,
-    -6401, -4481, -1804, 835, 2826, 3809, 3898, 3759, 4144, 5178, 6170, 6231,
-    5014, 2758, -192, -3601, -6932, -9012, -8577, -5441, -1064, 2277, 3137, 1902,
-    292, -101, 1040, 2729, 3577, 2790, 621, -1839, -3267, -2815, -640, 2036,
-    3521, 2694, -182, -3531, -5455, -4912, -2221, 1365, 4475, 6224, 6381, 5296,
-    3717, 2444, 1853, 1647, 1098, -366, -2747, -5512, -7877, -9052, -8469, -6162,
-    -3062, -658, 72, -442, -632, 831, 3844, 7002, 8813, 8702, 7023, 4463,
-    1670, -745, -2263, -2761, -2673, -2661, -3102, -3913, -4798, -5516, -5885, -5718,
-    -4932, -3729, -2523, -1603, -866, 101, 1655, 3747, 5788, 6838, 6090, 3453,
-    -154, -3171, -4263, -3146, -740, 1420, 2096, 1009, -1092, -2956, -3614, -2963,
-    -1758, -1035, -1376, -2531, -3635, -3795, -2634, -481, 1830, 3400, 3702, 2811,
-    1315, -39, -701, -454, 645, 2285, 3831, 4410, 3410, 1096, -1295, -2312,
-    -1342, 936, 3049, 3659, 2282, -497, -3283, -4622, -4025, -2491, -1763, -2706,
-    -4346, -4717, -2714, 968, 4705, 7427, 9026, 9568, 8701, 6194, 2816, 190,
-    -473, 582, 1936, 2236, 1137, -756, -2509, -3364, -2964, -1533, 27, 530,
-    -610, -2703, -4102, -3435, -677, 2860, 5533, 6394, 5541, 3808, 2269, 1759,
-    2514, 4037, 5401, 5803, 4930, 2922, 191, -2601, -4583, -5032, -3928, -2090,
-    -622, -115, -306, -403, 269, 1744, 3289, 3812, 2667, 329, -1719, -1959,
-    108, 3681, 7202, 9137, 8552, 5501, 1199, -2407, -3784, -2870, -1027, 189,
-    258, -221, -466, -311, -119, -152, -268, -217, -65, -176, -782, -1608,
-    -1944, -1134, 900, 3445, 5254, 5241, 3266, 466, -1314, -789, 1736, 4524,
-    5683, 4474, 1578, -1663, -4149, -5386, -5407, -4631, -3699, -3141, -3026, -2981,
-    -2614, -1903, -1157, -683, -545, -572, -476, 16, 1025, 2429, 3942, 5261,
-    6054, 5831, 4082, 840, -2877, -5416, -5602, -3661, -1140, 155, -628, -2841,
-    -4791, -4915, -2932, -112, 1630, 1156, -1096, -3495, -4333, -2818, 572, 4362,
-    6841, 7015, 5201, 2718, 859, 45, -105, -76, -11, 62, -141, -1031,
-    -2590, -4042, -4233, -2497, 694, 3830, 5207, 4019, 953, -2181, -3630, -2902,
-    -1087, 31, -568, -2280, -3389, -2521, 253, 3615, 6148, 7227, 6966, 5690,
-    3712, 1499, -339, -1428, -1889, -2093, -2231, -2275, -2257, -2344, -2570, -2663,
-    -2314, -1560, -792, -410, -513, -807, -671, 585, 3134, 6088, 7764, 6929,
-    3949, 623, -1291, -1426, -797, -675, -1534, -2899, -3895, -3887, -2792, -1042,
-    730, 2050, 2788, 3071, 3106, 3068, 3059, 3046, 2839, 2229, 1178, -147,
-    -1522, -2773, -3661, -3765, -2668, -396, 2316, 4290, 4616, 3321, 1438, 347,
-    809, 2454, 4153, 4909, 4455, 3117, 1320, -638, -2432, -3596, -3788, -3153,
-    -2330, -1958, -2095, -2105, -1176, 899, 3391, 5104, 5267, 4038, 2222, 640,
-    -180, 3, 1061, 2242, 2366, 715, -2141, -4612, -5319, -4097, -1881, 103,
-    957, 332, -1409, -3143, -3532, -2069, 391, 2350, 2992, 2732, 2540, 2934,
-    3701, 4367, 4643, 4422, 3572, 1936, -451, -3181, -5516, -6682, -6284, -4615,
-    -2562, -1089, -623, -816, -807, 212, 2487, 5484, 8082, 9136, 8091, 5262,
-    1563, -2060, -5058, -7295, -8757, -9296, -8662, -6749, -3758, -51, 4075, 8305,
-    11919, 13702, 12625, 8831, 3847, -401, -2933, -4186, -5310, -7056, -9137, -10336,
-    -9233, -5278, 395, 5272, 7088, 5602, 2830, 1336, 2110, 3928, 4580, 2694,
-    -1313, -5572, -7913, -7087, -3445, 1361, 5479, 7966, 9030, 9281, 8832, 7133,
-    3682, -1121, -5808, -8675, -8977, -7447, -5600, -4374, -3387, -1502, 1879, 6006,
-    9116, 9511, 6630, 1552, -3343, -5596, -4256, -671, 2432, 3015, 1240, -876,
-    -1237, 761, 4016, 6668, 7237, 5229, 1133, -3870, -8290, -10701, -10164, -6631,
-    -1113, 4631, 8871, 10718, 10450, 9151, 7896, 6994, 5805, 3288, -983, -6152,
-    -10376, -11960, -10422, -6669, -2319, 1205, 3238, 3967, 4101, 4247, 4416, 4117,
-    3031, 1488, 169, -642, -1285, -2147, -3011, -3167, -2125, -118, 2077, 3689,
-    4344, 4101, 3222, 1850, -122, -2722, -5325, -6568, -5172, -1100, 4107, 8244,
-    9731, 8267, 4640, 254, -3307, -4840, -4172, -2331, -855, -674, -1575, -2630,
-    -3008, -2405, -928, 1079, 3000, 3995, 3465, 1686, -156, -800, 79, 1731,
-    3176, 4042, 4439, 4239, 2941, 473, -2140, -3363, -2559, -650, 692, 436,
-    -1223, -3284, -4578, -4140, -1560, 2553, 6564, 8676, 8127, 5592, 2450, -277,
-    -2331, -3862, -4882, -5082, -4061, -1707, 1536, 4745, 6936, 7507, 6323, 3524,
-    -562, -5157, -8831, -9904, -7426, -1965, 4533, 9809, 12472, 12438, 10451, 7283,
-    3378, -879, -4829, -7656, -8882, -8617, -7313, -5383, -3100, -725, 1516, 3609,
-    5660, 7524, 8606, 8205, 6064, 2534, -1685, -5761, -8750, -9779, -8546, -5644,
-    -2147, 1197, 4270, 7082, 9184, 9783, 8419, 5372, 1437, -2531, -5733, -7328,
-    -6599, -3489, 1052, 5443, 8344, 9221, 8145, 5245, 688, -4720, -9225, -10938,
-    -9292, -5594, -1930, 548, 2152, 3662, 5187, 6197, 6453, 6399, 6511, 6466,
-    5254, 2144, -2522, -7403, -10931, -12132, -11028, -8461, -5468, -2602, 246, 3375,
-    6604, 9128, 10033, 8987, 6432, 3199, -19, -2879, -5203, -6720, -7054, -5992,
-    -3745, -959, 1514, 2895, 2767, 1379, -231, -702, 644, 3044, 4696, 4153,
-    1488, -1846, -4214, -4849, -3994, -2374, -685, 619, 1406, 1853, 2287, 2881,
-    3434, 3421, 2286, -123, -3167, -5456, -5575, -3185, 485, 3422, 4350, 3591,
-    2428, 1683, 997, -472, -2770, -4718, -4885, -3015, -461, 928, 413, -1071,
-    -1920, -1349, 113, 1414, 2023, 2128, 2088, 1975, 1673, 1118, 263, -1096,
-    -3150, -5603, -7461, -7518, -5265, -1434, 2348, 4607, 4935, 4038, 2922, 2023,
-    1099, -147, -1553, -2671, -3280, -3472, -3196, -2031, 321, 3309, 5588, 6012,
-    4651, 2728, 1505, 1198, 937, -276, -2599, -5257, -7285, -8252, -8250, -7334,
-    -5225, -1707, 2761, 6947, 9478, 9597, 7463, 3882, -184, -3989, -7116, -9308,
-    -10214, -9445, -7030, -3798, -1023, 552, 1318, 2233, 3603, 4574, 3972, 1616,
-    -1294, -3111, -3071, -1793, -663, -717, -1922, -3257, -3430, -1745, 1375, 4487,
-    5862, 4516, 920, -3204, -6037, -6924, -6622, -6269, -6123, -5385, -3272, -92,
-    2870, 4485, 4646, 3998, 3006, 1495, -905, -3978, -6724, -7968, -7210, -4971,
-    -2380, -446, 421, 418, 79, -6, 526, 1544, 2422, 2457, 1478, 14,
-    -1182, -1774, -1976, -2210, -2739, -3582, -4491, -4862, -3926, -1427, 1758, 3938,
-    3882, 1876, -548, -1968, -2155, -1874, -1835, -1989, -1835, -1225, -703, -1000,
-    -2248, -3713, -4311, -3408, -1237, 1267, 2975, 3135, 1808, -39, -1085, -660,
-    645, 1485, 1092, 126, 100, 1887, 4731, 6691, 6084, 2708, -2086, -6423,
-    -9180, -10470, -10959, -10762, -9137, -5435, -257, 4595, 7476, 8154, 7643, 6968,
-    6280, 5100, 3080, 312, -2892, -6152, -8915, -10493, -10491, -9161, -7185, -5048,
-    -2724, -15, 2905, 5362, 6570, 6059, 3842, 391, -3380, -6266, -7267, -6192,
-    -3774, -1064, 1313, 3243, 4568, 4726, 3192, 220, -3106, -5681, -7146, -7782,
-    -7820, -7085, -5297, -2489, 955, 4456, 7239, 8369, 7255, 4356, 1190, -725,
-    -1137, -1221, -2412, -5020, -7866, -9165, -7812, -4082, 615, 4656, 7133, 8128,
-    8184, 7491, 5636, 2251, -2107, -5896, -7638, -7136, -5614, -4524, -4165, -3501,
-    -1378, 2088, 5328, 6484, 4810, 1149, -2701, -5044, -5064, -3059, -175, 2257,
-    3475, 3600, 3272, 2950, 2605, 2016, 1217, 482, -52, -590, -1415, -2504,
-    -3530, -4204, -4486, -4411, -3815, -2465, -461, 1607, 3107, 3926, 4469, 5024,
-    5259, 4518, 2631, 290, -1440, -1954, -1428, -493, 249, 454, 106, -450,
-    -682, -349, 154, 140, -546, -1161, -728, 887, 2652, 3190, 1935, -426,
-    -2499, -3135, -2096, -98, 1775, 2912, 3614, 4627, 6081, 6944, 5796, 2354,
-    -1834, -4423, -4159, -1846, 487, 1272, 437, -891, -1422, -576, 1209, 2745,
-    2852, 1260, -1071, -2724, -3090, -2798, -2750, -2866, -2130, 49, 2847, 4696,
-    4921, 4380, 4431, 5483, 6690, 6858, 5354, 2230, -2029, -6536, -9947, -10932,
-    -9099, -5520, -2102, -183, 434, 1099, 2898, 5516, 7439, 7302, 5102, 2176,
-    104, -375, 388, 1432, 1826, 1183, -50, -785, -163, 1492, 2677, 1977,
-    -530, -3217, -4304, -3327, -1325, 197, 443, -220, -622, 390, 3055, 6300,
-    8307, 7831, 5183, 1863, -834, -2830, -4872, -7214, -8891, -8420, -5224, -354,
-    4225, 7051, 7988, 7855, 7424, 6789, 5545, 3384, 487, -2536, -5027, -6686,
-    -7715, -8527, -9181, -9077, -7373, -3831, 725, 4845, 7351, 7907, 6988, 5533,
-    4551, 4567, 5124, 4926, 2879, -746, -4276, -5906, -5110, -2909, -976, -519,
-    -1732, -3837, -5513, -5602, -3877, -1268, 822, 1627, 1533, 1533, 2224, 3344,
-    4173, 4297, 3945, 3648, 3604, 3376, 2276, 95, -2546, -4626, -5590, -5782,
-    -5983, -6518, -6802, -5798, -2987, 985, 4547, 6221, 5653, 3840, 2316, 1925,
-    2211, 1938, 299, -2259, -4294, -4518, -2886, -689, 503, 171, -740, -772,
-    599, 2403, 3027, 1641, -1135, -3816, -5239, -5321, -4904, -4897, -5405, -5506,
-    -3982, -482, 3922, 7372, 8516, 7284, 4575, 1442, -1371, -3407, -4432, -4552,
-    -4198, -3800, -3434, -2841, -1717, 69, 2396, 4792, 6381, 6225, 4019, 493,
-    -3012, -5444, -6531, -6512, -5651, -4148, -2348, -698, 632, 1935, 3578, 5396,
-    6556, 6106, 3724, 37, -3696, -6265, -7077, -6341, -4802, -3214, -1901, -670,
-    859, 2743, 4428, 4996, 3827, 1197, -1757, -3769, -4259, -3552, -2359, -1119,
-    186, 1705, 3327, 4640, 5197, 4817, 3708, 2355, 1208, 354, -540, -1857,
-    -3523, -4897, -5233, -4263, -2322, 68, 2562, 4904, 6594, 6932, 5567, 3000,
-    339, -1565, -2768, -3972, -5595, -7119, -7390, -5583, -1957, 2213, 5355, 6414,
-    5336, 3055, 1010, 344, 1230, 2837, 3991, 3943, 2627, 413, -2154, -4378,
-    -5553, -5424, -4553, -3939, -4072, -4395, -3850, -1957, 687, 2935, 3953, 3630,
-    2448, 1201, 729, 1496, 3160, 4653, 4952, 3886, 2149, 498, -947, -2528,
-    -4302, -5692, -5987, -5134, -3906, -3260, -3516, -4101, -4020, -2589, 71, 3059,
-    5197, 5792, 5105, 4088, 3476, 3048, 1866, -671, -4065, -7068, -8730, -8966,
-    -8114, -6238, -3142, 940, 4977, 7647, 8218, 6885, 4366, 1370, -1553, -3941,
-    -5497, -6283, -6673, -6940, -6874, -5873, -3496, -17, 3493, 5704, 5824, 4121,
-    1770, 118, -150, 633, 1425, 1224, -217, -2117, -3060, -1927, 1167, 4685,
-    6536, 5479, 1988, -2153, -5176, -6482, -6712, -6816, -7031, -6676, -4879, -1498,
-    2600, 6109, 8121, 8533, 7801, 6421, 4609, 2384, -106, -2350, -3619, -3498,
-    -2391, -1375, -1318, -2020, -2353, -1405, 530, 2190, 2528, 1552, 29, -1346,
-    -2274, -2553, -1897, -288, 1713, 3311, 4202, 4746, 5335, 5757, 5361, 3834,
-    1617, -533, -2262, -3765, -5242, -6355, -6377, -4905, -2380, 125, 1667, 2019,
-    1633, 1158, 1056, 1533, 2538, 3645, 4063, 3086, 760, -1921, -3663, -3815,
-    -2748, -1384, -472, -221, -387, -498, -74, 1085, 2675, 4000, 4421, 3734,
-    2136, 1, -2191, -3799, -4221, -3413, -2131, -1433, -1764, -2512, -2492, -925,
-    1922, 4862, 6504, 6120, 4134, 1844, 441, 75, -148, -1144, -2799, -4004,
-    -3743, -2085, -101, 1061, 948, -161, -1668, -2993, -3728, -3750, -3235, -2406,
-    -1191, 714, 3283, 5712, 6791, 5899, 3623, 1282, -184, -921, -1843, -3749,
-    -6619, -9514, -11000, -9865, -5886, -164, 5335, 8880, 9909, 9092, 7592, 6255,
-    5270, 4259, 2580, -240, -4011, -7678, -9816, -9530, -6981, -3064, 1278, 5285,
-    8119, 8827, 6998, 3470, 102, -1480, -1036, 291, 1029, 430, -1225, -2986,
-    -3781, -2977, -879, 1152, 1454, -609, -3867, -6098, -5807, -3394, -574, 1291,
-    2210, 3030, 4210, 5355, 5844, 5591, 4994, 4278, 3183, 1361, -1074, -3529,
-    -5388, -6355, -6408, -5639, -4275, -2720, -1316, 3, 1651, 3772, 5702, 6289,
-    4955, 2461, 456, 155, 1425, 3131, 4229, 4421, 3892, 2778, 1106, -875,
-    -2612, -3617, -3762, -3168, -1998, -603, 277, -127, -1776, -3517, -3890, -2380,
-    196, 2477, 3594, 3547, 2933, 2576, 3158, 4692, 6154, 5944, 3162, -1413,
-    -5675, -7654, -6793, -4136, -1544, -599, -1695, -3724, -4731, -3367, -29, 3487,
-    5543, 5873, 5252, 4279, 2807, 549, -2146, -4402, -5587, -5721, -5170, -4222,
-    -3052, -1849, -699, 587, 2192, 3695, 4006, 2275, -1012, -4006, -4837, -3150,
-    -385, 1458, 1399, 17, -1313, -1613, -908, 13, 262, -627, -2476, -4520,
-    -5760, -5511, -3849, -1533, 568, 2001, 2779, 3042, 2861, 2366, 1838, 1450,
-    940, -251, -2367, -4933, -7075, -8189, -8165, -6984, -4411, -378, 4368, 8317,
-    10169, 9800, 8173, 6325, 4523, 2366, -467, -3736, -6788, -8954, -9770, -8997,
-    -6694, -3348, 139, 2763, 3879, 3551, 2594, 2180, 3134, 5306, 7529, 8295,
-    6708, 3056, -1310, -4646, -5704, -4468, -2293, -1117, -2065, -4502, -6470, -6252,
-    -3706, -211, 2568, 3896, 4221, 4523, 5488, 7066, 8539, 8960, 7728, 4954,
-    1386, -2073, -4836, -6746, -7818, -7962, -7023, -5108, -2827, -1031, -130, 362,
-    1450, 3648, 6316, 8116, 8166, 6741, 4862, 3401, 2611, 2281, 1995, 1185,
-    -651, -3399, -5971, -6853, -5290, -2014, 1251, 3036, 3016, 1943, 944, 787,
-    1520, 2572, 3232, 3188, 2667, 2034, 1351, 433, -649, -1336, -1021, 242,
-    1579, 1925, 851, -1134, -2965, -3715, -3147, -1867, -953, -1166, -2235, -2882,
-    -1796, 1192, 4803, 7222, 7375, 5461, 2454, -677, -3288, -4947, -5415, -4851,
-    -3784, -2677, -1542, -131, 1513, 2911, 3632, 3739, 3554, 3067, 1882, -117,
-    -2250, -3477, -3376, -2565, -2067, -2315, -2816, -2661, -1310, 1017, 3445, 4867,
-    4488, 2265, -985, -3967, -5563, -5354, -3686, -1324, 1018, 2960, 4421, 5388,
-    5755, 5374, 4213, 2395, 121, -2357, -4659, -6295, -6894, -6403, -4949, -2551,
-    773, 4466, 7206, 7686, 5888, 3410, 2212, 2829, 3903, 3522, 1010, -2578,
-    -5485, -6588, -5824, -3769, -1137, 1366, 3100, 3733, 3444, 2751, 2078, 1533,
-    1082, 775, 691, 732, 634, 256, -229, -488, -390, -163, -255, -1020,
-    -2402, -3772, -4128, -2724, 228, 3468, 5492, 5625, 4408, 3022, 2363, 2554,
-    3038, 3009, 1892, -237, -2570, -4078, -4290, -3639, -2980, -2832, -3090, -3315,
-    -3071, -1991, 141, 3105, 6095, 8129, 8710, 8004, 6408, 4157, 1510, -884,
-    -2199, -2150, -1415, -1165, -2133, -4051, -5829, -6234, -4658, -1621, 1401, 2932,
-    2645, 1639, 1419, 2475, 3859, 4160, 2808, 465, -1705, -2932, -3084, -2287,
-    -603, 1834, 4453, 6193, 6013, 3641, -61, -3490, -5255, -4974, -3362, -1612,
-    -596, -434, -581, -257, 1062, 3264, 5531, 6699, 5987, 3621, 780, -1212,
-    -1855, -1752, -1914, -2789, -3914, -4403, -3670, -1710, 1065, 3978, 6121, 6565,
-    4912, 1710, -1798, -4487, -5963, -6472, -6403, -5956, -5182, -4084, -2621, -739,
-    1452, 3539, 4929, 5150, 4056, 1888, -695, -2653, -2950, -1263, 1522, 3691,
-    3851, 1954, -700, -2486, -2643, -1708, -989, -1558, -3516, -5953, -7600, -7645,
-    -6149, -3766, -1099, 1676, 4554, 7170, 8697, 8456, 6660, 4416, 2814, 1945,
-    854, -1449, -4885, -8157, -9650, -8604, -5617, -2242, -59, 189, -1065, -2524,
-    -2843, -1442, 1182, 3863, 5558, 5948, 5430, 4605, 3773, 2852, 1709, 426,
-    -819, -2056, -3475, -4968, -5853, -5299, -3172, -371, 1777, 2454, 1744, 324,
-    -979, -1416, -543, 1389, 3300, 3894, 2680, 404, -1593, -2445, -2238, -1629,
-    -1229, -1301, -1775, -2298, -2308, -1318, 682, 3081, 4962, 5674, 5208, 4123,
-    3093, 2393, 1721, 541, -1340, -3509, -5314, -6431, -6986, -7087, -6428, -4562,
-    -1604, 1522, 3696, 4515, 4562, 4779, 5588, 6556, 6754, 5388, 2300, -1808,
-    -5484, -7127, -5936, -2614, 912, 2755, 2323, 497, -1320, -2291, -2409, -1997,
-    -1258, -349, 377, 519, 91, -274, 289, 2175, 4925, 7382, 8261, 6829,
-    3373, -814, -4068, -5316, -4706, -3417, -2757, -3226, -4186, -4345, -2706, 631,
-    4368, 6746, 6666, 4381, 1237, -1301, -2545, -2758, -2639, -2692, -2969, -3199,
-    -3035, -2200, -579, 1658, 3990, 5697, 6218, 5425, 3614, 1309, -865, -2241,
-    -2335, -1263, 103, 655, -27, -1264, -1884, -1288, 73, 1185, 1308, 393,
-    -1042, -2205, -2299, -905, 1604, 4106, 5445, 5299, 4307, 3306, 2525, 1593,
-    264, -1080, -1782, -1696, -1435, -1730, -2596, -3239, -2868, -1543, -146, 451,
-    129, -543, -954, -882, -386, 431, 1346, 1834, 1323, -164, -1704, -2056,
-    -700, 1663, 3629, 4100, 2892, 644, -1663, -3153, -3357, -2375, -816, 544,
-    1175, 981, 173, -907, -1832, -2156, -1689, -770, -111, -165, -620, -648,
-    266, 1771, 2949, 3071, 1997, -2, -2484, -4735, -5731, -4669, -1808, 1430,
-    3479, 3906, 3594, 3643, 4173, 4276, 3082, 736, -1660, -2994, -3040, -2542,
-    -2506, -3300, -4334, -4555, -3365, -1128, 1211, 2982, 4279, 5582, 6995, 7922,
-    7500, 5356, 2001, -1389, -3604, -4016, -2897, -1230, -91, 47, -421, -668,
-    -243, 441, 428, -896, -3101, -4886, -5011, -3187, -170, 2920, 5314, 6697,
-    6870, 5604, 2990, -196, -2728, -3696, -3092, -1674, -348, 305, 108, -770,
-    -1776, -2081, -1082, 992, 3032, 3787, 2755, 407, -2316, -4593, -5889, -5900,
-    -4680, -2809, -1100, 113, 1281, 3002, 5084, 6510, 6475, 5293, 4019, 3225,
-    2453, 1020, -902, -2313, -2464, -1659, -879, -839, -1576, -2758, -4015, -4876,
-    -4748, -3328, -1059, 1074, 2377, 3005, 3609, 4518, 5383, 5599, 4961, 3824,
-    2747, 2035, 1617, 1273, 974, 1017, 1769, 3140, 4283, 3989, 1624, -2207,
-    -5964, -8235, -8601, -7559, -5749, -3353, -190, 3731, 7809, 10958, 12111, 10788,
-    7372, 2929, -1361, -4781, -7247, -9008, -10198, -10665, -10096, -8245, -5093, -968,
-    3384, 6934, 8805, 8733, 7156, 4843, 2422, 218, -1592, -2792, -3170, -2733,
-    -1838, -1065, -819, -942, -732, 484, 2608, 4605, 5221, 3981, 1528, -993,
-    -2809, -3827, -4305, -4480, -4470, -4267, -3658, -2313, -257, 1780, 2784, 2434,
-    1508, 1027, 1044, 587, -994, -2845, -3133, -867, 2973, 6193, 7181, 5917,
-    3492, 1050, -751, -1688, -1893, -1908, -2467, -3857, -5459, -6113, -5076, -2645,
-    143, 2367, 3804, 4769, 5544, 5959, 5485, 3722, 881, -2155, -4287, -4814,
-    -3713, -1430, 1450, 4269, 6185, 6353, 4477, 1220, -2085, -4305, -5163, -5154,
-    -4899, -4629, -4172, -3246, -1739, 167, 2000, 3086, 2819, 1017, -1787, -4379,
-    -5330, -3796, -251, 3466, 5110, 3515, -501, -4636, -6664, -5807, -2901, 493,
-    3096, 4290, 3949, 2227, -404, -3062, -4649, -4428, -2644, -594, 139, -1066,
-    -3196, -4245, -2812, 723, 4491, 6584, 6331, 4446, 2272, 964, 1019, 2103,
-    3120, 2780, 526, -2944, -6186, -8159, -8829, -8677, -7835, -5950, -2878, 771,
-    3946, 5965, 6877, 7070, 6714, 5660, 3738, 1049, -1971, -4599, -5984, -5509,
-    -3271, -231, 2263, 3294, 2893, 1862, 1159, 1269, 1901, 2106, 850, -2138,
-    -5837, -8315, -7979, -4765, -239, 3536, 5405, 5628, 5194, 4707, 3890, 2064,
-    -926, -4284, -6701, -7249, -5891, -3247, -18, 3310, 6286, 8295, 8698, 7219,
-    4136, 165, -3779, -6753, -8073, -7720, -6485, -5414, -4869, -4141, -2178, 1198,
-    4867, 7241, 7503, 6044, 3824, 1520, -662, -2509, -3437, -2773, -488, 2395,
-    4228, 3825, 1366, -1723, -3894, -4676, -4852, -5488, -6794, -7928, -7762, -5736,
-    -2060, 2540, 7027, 10181, 11037, 9613, 7111, 5084, 4154, 3558, 1980, -1184,
-    -5380, -9431, -12292, -13303, -12128, -8853, -4228, 452, 3957, 5756, 6065, 5372,
-    4000, 2119, 33, -1700, -2520, -2223, -1098, 294, 1495, 2312, 2647, 2213,
-    592, -2226, -5328, -7055, -6058, -2449, 1985, 4859, 4808, 2400, -367, -1594,
-    -872, 536, 901, -383, -2208, -2700, -882, 2487, 5579, 6884, 5985, 3299,
-    -468, -4436, -7364, -7896, -5374, -479, 5016, 9204, 10926, 10066, 7360, 4028,
-    1258, -379, -1243, -2267, -4093, -6424, -8160, -8188, -6185, -2866, 398, 2391,
-    2816, 2501, 2771, 4366, 6822, 8855, 9335, 7910, 4867, 746, -3693, -7282,
-    -8666, -7100, -3106, 1702, 5510, 7143, 6340, 3606, -70, -3529, -5870, -6749,
-    -6267, -4585, -1747, 2071, 6212, 9594, 11165, 10339, 7208, 2609, -1925, -4616,
-    -4391, -1726, 1491, 3205, 2591, 420, -1784, -2900, -2716, -1648, -227, 1121,
-    2018, 2117, 1298, -90, -1316, -1753, -1448, -1162, -1661, -2814, -3434, -2187,
-    1208, 5619, 9255, 10739, 9594, 6103, 1132, -3855, -7074, -7261, -4567, -594,
-    2600, 3719, 2748, 612, -1523, -2839, -3163, -2910, -2619, -2361, -1588, 330,
-    3384, 6745, 9275, 10127, 8933, 5781, 1362, -2866, -5088, -4192, -640, 3698,
-    6650, 6861, 4246, -172, -4673, -7457, -7506, -5255, -2367, -536, -219, -414,
-    348, 2683, 5788, 8009, 8038, 5888, 2916, 836, 458, 1163, 1606, 936,
-    -678, -2589, -4488, -6422, -8074, -8377, -6198, -1567, 3872, 7726, 8384, 5980,
-    2135, -1224, -3103, -3864, -4553, -5661, -6431, -5418, -1864, 3408, 8407, 11246,
-    11082, 8160, 3399, -1885, -6136, -8018, -7091, -4092, -445, 2579, 4382, 4993,
-    4788, 4249, 3702, 3036, 1706, -776, -4177, -7372, -8901, -7820, -4250, 656,
-    5204, 7907, 8217, 6796, 5032, 4088, 4231, 4901, 5220, 4381, 1863, -2240,
-    -6820, -9989, -10213, -7544, -3667, -612, 705, 796, 774, 1413, 2804, 4454,
-    5455, 4855, 2376, -989, -3324, -3085, -233, 3794, 7111, 8348, 6920, 2984,
-    -2439, -7448, -9976, -9099, -5823, -2433, -769, -881, -1192, 6, 3009, 6368,
-    8003, 6805, 3437, -267, -2671, -3260, -2489, -1074, 409, 1391, 1248, -284,
-    -2608, -4383, -4355, -2189, 1338, 4770, 6648, 6147, 3558, 279, -1972, -2366,
-    -1577, -1163, -2199, -4406, -6449, -6938, -5273, -1939, 1677, 3863, 3530, 1039,
-    -1829, -3024, -1622, 1674, 5204, 7402, 7369, 4946, 689, -4167, -8063, -9818,
-    -9208, -6948, -4169, -1842, -387, 449, 1363, 2819, 4361, 4680, 2672, -1365,
-    -5617, -7884, -6942, -3059, 2374, 7442, 10227, 9473, 5338, -437, -5462, -8155,
-    -8513, -7622, -6577, -5805, -5123, -4092, -2343, 174, 3018, 5366, 6484, 6177,
-    4819, 3028, 1397, 411, 287, 671, 617, -758, -3363, -5908, -6744, -5064,
-    -1424, 2682, 5635, 6305, 4373, 491, -3846, -6893, -7521, -5777, -2726, 294,
-    2461, 3805, 4882, 5999, 6616, 5579, 2172, -2921, -7758, -10390, -10038, -7197,
-    -2859, 2066, 6607, 9495, 9588, 6717, 2067, -2425, -5121, -5423, -3894, -1894,
-    -837, -1284, -2505, -3112, -2414, -1173, -854, -2063, -3819, -4396, -2769, 735,
-    4860, 8139, 9322, 7720, 3690, -1209, -4934, -6178, -5030, -2538, 138, 2086,
-    2539, 1015, -2097, -5282, -6702, -5585, -2906, -588, 130, -244, 94, 2628,
-    7008, 10930, 11668, 8150, 1880, -4127, -7457, -7625, -5707, -3054, -534, 1283,
-    1758, 446, -2289, -5158, -6644, -5937, -3329, 92, 3129, 5094, 6068, 6608,
-    7076, 7140, 5984, 3120, -1017, -5235, -8285, -9393, -8346, -5472, -1722, 1476,
-    2890, 2313, 739, -388, -205, 1101, 2579, 3163, 2267, 142, -2155, -3374,
-    -2986, -1630, -582, -658, -1574, -2258, -1695, 426, 3531, 6298, 7155, 5183,
-    935, -3685, -6659, -7155, -5677, -3105, 55, 3369, 5789, 5894, 3131, -1304,
-    -5121, -6620, -5852, -4243, -3228, -3119, -3008, -1612, 1585, 5709, 8899, 9536,
-    7372, 3578, -260, -3149, -4845, -5370, -4776, -3459, -2365, -2487, -3967, -5772,
-    -6372, -4848, -1544, 2159, 4674, 5155, 4005, 2591, 2254, 3310, 4885, 5675,
-    4911, 2733, -72, -2484, -3590, -3004, -1314, -1, -488, -2956, -6044, -7813,
-    -7084, -4025, 274, 4555, 7848, 9579, 9581, 8051, 5413, 2169, -1145, -4013,
-    -6148, -7639, -8675, -8994, -7819, -4665, -262, 3555, 5157, 4371, 2459, 998,
-    919, 2384, 5056, 8095, 10110, 9709, 6525, 1704, -2842, -5798, -7197, -7959,
-    -8855, -9818, -10039, -8583, -5078, -88, 5065, 8948, 10660, 10060, 7636, 4380,
-    1715, 1049, 2815, 5775, 7534, 6191, 1755, -3929, -8581, -10856, -10728, -9019,
-    -6797, -4910, -3627, -2503, -777, 1842, 4728, 6741, 7101, 5925, 4046, 2499,
-    2103, 3149, 5108, 6630, 6200, 3159, -1728, -6729, -10224, -11459, -10504, -7795,
-    -3869, 513, 4245, 6176, 5781, 3670, 1315, -23, -314, -687, -2103, -4026,
-    -4586, -2291, 2326, 6824, 8642, 6851, 2497, -2321, -5548, -5894, -3331, 675,
-    3753, 4114, 1860, -1197, -3145, -3430, -2807, -2174, -1749, -1351, -1046, -1149,
-    -1619, -1772, -853, 1062, 2835, 3046, 1184, -1721, -3599, -2735, 914, 5508,
-    8487, 8215, 4858, -69, -4812, -8153, -9545, -8980, -6977, -4471, -2373, -1028,
-    -120, 865, 2082, 3200, 3685, 3184, 1814, 281, -291, 986, 3965, 7242,
-    8959, 8054, 4875, 679, -3349, -6564, -8612, -9123, -7901, -5431, -2941, -1686,
-    -1947, -2665, -2194, 286, 3867, 6410, 6211, 3463, 192, -1331, -344, 1985,
-    3637, 3256, 901, -2221, -4556, -5018, -3513, -978, 1181, 1941, 1163, -648,
-    -2923, -5194, -6790, -6751, -4490, -641, 2974, 4571, 3803, 1986, 888, 1160,
-    1809, 1111, -1804, -5988, -9115, -9043, -5335, 402, 5623, 8433, 8433, 6370,
-    3249, -176, -3344, -5737, -7027, -7281, -6853, -6011, -4738, -2926, -688, 1582,
-    3361, 4141, 3535, 1566, -968, -2539, -1732, 1595, 5881, 8734, 8506, 5281,
-    603, -3621, -6057, -6252, -4567, -2092, -398, -792, -3309, -6351, -7674, -6121,
-    -2593, 781, 2553, 3091, 3857, 5681, 7863, 8934, 8082, 5675, 2541, -858,
-    -4357, -7378, -8741, -7442, -3655, 1113, 4875, 6248, 5008, 2034, -1151, -3072,
-    -3094, -1817, -599, -383, -846, -726, 914, 3676, 6016, 6375, 4239, 385,
-    -3615, -6134, -6123, -3526, 667, 4825, 7413, 7625, 5600, 2259, -1018, -2825,
-    -2340, 97, 2969, 4465, 3737, 1521, -483, -990, -88, 979, 913, -609,
-    -2733, -4033, -3422, -769, 2990, 6249, 7443, 5824, 1978, -2262, -4643, -3753,
-    24, 4583, 7316, 6697, 3119, -1612, -5657, -8238, -9625, -10233, -9850, -7787,
-    -3773, 1380, 6131, 9281, 10687, 10894, 10145, 7980, 3996, -1035, -5077, -6140,
-    -3858, 146, 3395, 4129, 2057, -1866, -6072, -8956, -9421, -7404, -3949, -509,
-    2067, 3956, 5777, 7704, 9204, 9545, 8394, 5897, 2448, -1381, -4688, -6377,
-    -5787, -3385, -759, 237, -1312, -4688, -7798, -8331, -5204, 612, 6556, 10076,
-    10239, 8085, 5488, 3600, 2225, 507, -1947, -4580, -6328, -6384, -4631, -1596,
-    1769, 4311, 4985, 3352, 7, -3500, -5397, -4672, -1590, 2591, 6386, 8670,
-    8832, 6744, 2859, -1722, -5577, -7669, -7892, -6949, -5693, -4553, -3387, -1714,
-    876, 4216, 7198, 8124, 5982, 1728, -1875, -2227, 908, 5131, 7398, 6332,
-    2729, -1779, -6084, -9634, -11716, -11381, -8334, -3641, 769, 3448, 4342, 4525,
-    5157, 6578, 8085, 8435, 6751, 3295, -473, -2759, -2660, -805, 1096, 1387,
-    -565, -4075, -7512, -9074, -7661, -3479, 2026, 6985, 10113, 11187, 10738, 9368,
-    7332, 4644, 1467, -1664, -4016, -5067, -4766, -3398, -1274, 1327, 3831, 5150,
-    4186, 824, -3521, -6583, -6670, -3653, 1174, 5941, 8968, 9237, 6791, 2927,
-    -367, -1720, -1414, -1023, -1877, -3792, -5253, -4757, -2025, 1803, 4875, 5663,
-    3873, 790, -1356, -888, 2044, 5593, 7737, 7730, 6139, 3722, 651, -3059,
-    -6668, -8723, -8175, -5445, -2243, -240, 200, 106, 784, 2496, 4112, 4103,
-    2056, -722, -2148, -1041, 2047, 5480, 7818, 8427, 7182, 4124, -352, -5207,
-    -9045, -10850, -10400, -8055, -4431, -416, 2810, 4268, 3935, 2843, 2199, 2365,
-    2734, 2552, 1743, 980, 1093, 2394, 4342, 5633, 4792, 1143, -4416, -9597,
-    -11987, -10541, -6187, -1157, 2393, 3524, 2790, 1621, 1244, 1878, 2782, 3091,
-    2654, 2083, 2078, 2747, 3537, 3620, 2320, -562, -4445, -7951, -9557, -8643,
-    -5900, -2527, 917, 4564, 8056, 9783, 7945, 2595, -3693, -7615, -7739, -5359,
-    -2927, -1839, -1637, -991, 790, 3022, 4113, 2789, -734, -4596, -6487, -5306,
-    -1819, 2302, 5878, 8549, 9936, 9098, 5261, -963, -7450, -11820, -12871, -10987,
-    -7564, -4207, -2093, -1475, -1505, -792, 1514, 4987, 8235, 9937, 9683, 8042,
-    6050, 4500, 3405, 1964, -777, -4940, -9440, -12634, -13399, -11597, -7745, -2637,
-    2583, 6369, 7394, 5504, 1982, -1268, -2846, -2348, -161, 2898, 5835, 7817,
-    8523, 8094, 6652, 4013, 136, -4283, -7974, -9994, -10260, -9033, -6201, -1623,
-    3757, 7643, 7930, 4685, 366, -2189, -2030, -441, 670, 539, -162, -366,
-    273, 1115, 1131, -254, -2654, -4943, -6047, -5651, -4155, -2045, 504, 3239,
-    5247, 5171, 2324, -2446, -7091, -9638, -9237, -6309, -2118, 1706, 3687, 3165,
-    763, -1944, -3497, -3486, -2537, -1497, -653, 349, 1955, 4071, 5880, 6273,
-    4620, 1252, -2759, -6340, -8897, -10150, -9737, -7332, -3304, 915, 3455, 3245,
-    814, -2031, -3344, -2173, 951, 4412, 6592, 6961, 6320, 5867, 5882, 5354,
-    3007, -1316, -6317, -10225, -11957, -11411, -9006, -5368, -1467, 1438, 2486, 1942,
-    1019, 784, 1341, 2155, 2992, 4187, 5884, 7322, 7214, 4960, 1327, -2148,
-    -4386, -5405, -5927, -6488, -6870, -6235, -3885, -131, 3434, 4787, 3012, -785,
-    -4135, -4978, -2960, 718, 4412, 6912, 7600, 6324, 3416, -284, -3751, -6279,
-    -7710, -8188, -7768, -6273, -3537, 186, 4013, 6687, 7246, 5602, 2501, -1066,
-    -4327, -6615, -7134, -5312, -1604, 2250, 4184, 3223, 78, -3538, -6044, -6675,
-    -5565, -3522, -1568, -235, 888, 2718, 5535, 8335, 9500, 8164, 4875, 994,
-    -2287, -4315, -4793, -3764, -1918, -561, -838, -2857, -5607, -7752, -8410, -7270,
-    -4334, 71, 5004, 8998, 10807, 10224, 8103, 5533, 2979, 224, -2947, -6061,
-    -7966, -7573, -4763, -758, 2387, 2946, 557, -3567, -7429, -9372, -8780, -6017,
-    -1950, 2462, 6303, 8706, 8961, 6821, 2815, -1769, -5488, -7602, -8384, -8467,
-    -7862, -5828, -1898, 3041, 6961, 8147, 6393, 2850, -1022, -4120, -5601, -4804,
-    -1808, 1969, 4217, 3260, -613, -5263, -8238, -8437, -6559, -4112, -1970, 186,
-    3070, 6535, 9283, 9941, 8348, 5600, 2839, 306, -2232, -4365, -4880, -3029,
-    222, 2561, 2089, -1268, -5965, -10148, -12633, -12919, -10827, -6517, -808, 4891,
-    9209, 11493, 11868, 10725, 8258, 4549, 9, -4378, -7332, -7901, -6000, -2519,
-    1029, 3178, 3139, 1033, -2333, -5905, -8654, -9656, -8257, -4487, 611, 5213,
-    7621, 7236, 4872, 2128, 275, -463, -702, -1008, -1224, -702, 831, 2764,
-    4020, 3861, 2180, -804, -4637, -8215, -9672, -7477, -2027, 4058, 7699, 7627,
-    4955, 1657, -1237, -3905, -6600, -8686, -8904, -6491, -1992, 2911, 6412, 7676,
-    7171, 5951, 4520, 2476, -637, -4195, -6483, -6020, -2896, 1167, 4010, 4288,
-    1937, -2045, -6076, -8594, -8724, -6655, -3365, 104, 3143, 5552, 7275, 8285,
-    8562, 7961, 6152, 2976, -1001, -4407, -5817, -4738, -1923, 1178, 3173, 3120,
-    670, -3682, -8384, -11249, -10600, -6404, -404, 4943, 7894, 8179, 6716, 4715,
-    2927, 1485, 264, -673, -985, -370, 1057, 2695, 3742, 3541, 1790, -1355,
-    -5151, -8302, -9446, -7915, -4200, 361, 4369, 6907, 7546, 6171, 3052, -949,
-    -4504, -6350, -5882, -3375, 186, 3535, 5692, 6423, 6200, 5532, 4319, 2018,
-    -1388, -4718, -6165, -4695, -920, 3344, 6271, 6889, 5185, 1826, -2121, -5467,
-    -7234, -6913, -4562, -804, 3210, 6136, 7128, 6414, 5051, 3946, 3056, 1680,
-    -487, -2674, -3516, -2247, 515, 3115, 3988, 2607, -414, -3938, -6934, -8612,
-    -8314, -5716, -1341, 3324, 6617, 7791, 7288, 5926, 4054, 1673, -747, -2049,
-    -1268, 1345, 4364, 6261, 6393, 5037, 2763, -37, -3090, -5955, -7914, -8183,
-    -6323, -2629, 1791, 5428, 7111, 6577, 4509, 2075, 335, -186, 392, 1493,
-    2500, 3117, 3426, 3583, 3469, 2649, 715, -2241, -5388, -7439, -7366, -5089,
-    -1527, 2079, 4959, 6913, 7729, 6821, 3798, -571, -4253, -5234, -3125, 469,
-    3210, 3781, 2610, 1160, 589, 943, 1374, 1031, -126, -1196, -989, 1022,
-    4154, 6841, 7589, 5880, 2352, -1729, -5156, -7113, -7134, -5089, -1402, 2814,
-    6110, 7462, 6805, 4847, 2416, -15, -2229, -3879, -4382, -3251, -568, 2847,
-    5770, 7177, 6710, 4682, 1677, -1805, -5287, -8008, -8932, -7373, -3731, 456,
-    3388, 4132, 3066, 1360, 73, -355, 3, 937, 2285, 3819, 5119, 5690,
-    5211, 3661, 1209, -1867, -5055, -7484, -8190, -6712, -3462, 546, 4272, 6903,
-    7715, 6131, 2271, -2539, -6164, -6920, -4674, -816, 2798, 4978, 5612, 5240,
-    4333, 2855, 448, -2906, -6337, -8289, -7444, -3704, 1633, 6602, 9619, 10063,
-    8172, 4608, 190, -4033, -6751, -6836, -4142, 60, 3706, 5259, 4567, 2496,
-    -44, -2527, -4435, -4985, -3637, -809, 2270, 4562, 5902, 6609, 6626, 5367,
-    2429, -1700, -5731, -8247, -8362, -6048, -2191, 1689, 4137, 4555, 3429, 1804,
-    513, -120, -21, 923, 2753, 5088, 7033, 7613, 6438, 4014, 1331, -943,
-    -2873, -4794, -6475, -6913, -5189, -1542, 2493, 5091, 5305, 3408, 409, -2527,
-    -4335, -4216, -1967, 1762, 5692, 8569, 9719, 9134, 7186, 4371, 1223, -1716,
-    -3993, -5340, -5644, -4819, -2796, 253, 3637, 6160, 6615, 4535, 686, -3114,
-    -4867, -3509, 427, 5088, 8432, 9406, 8269, 5882, 2823, -730, -4349, -6952,
-    -7358, -5320, -1851, 1573, 4075, 5649, 6512, 6427, 4779, 1339, -3077, -6722,
-    -7854, -5855, -1693, 2662, 5409, 5773, 4039, 1082, -2004, -4061, -4135, -1989,
-    1586, 5106, 7231, 7480, 6334, 4760, 3474, 2415, 845, -1851, -5260, -7866,
-    -8083, -5542, -1450, 2268, 4155, 3825, 1824, -770, -2758, -3229, -1899, 873,
-    4367, 7760, 10180, 10818, 9304, 6064, 2156, -1389, -4109, -6038, -7271, -7701,
-    -7153, -5649, -3521, -1337, 285, 925, 602, -179, -652, -174, 1469, 3965,
-    6582, 8454, 8926, 7773, 5173, 1595, -2216, -5257, -6615, -6096, -4511, -3124,
-    -2615, -2612, -2288, -1390, -590, -763, -1986, -3257, -3216, -1198, 2273, 5832,
-    8060, 8091, 5810, 1822, -2613, -5836, -6445, -4097, 176, 4564, 7517, 8417,
-    7479, 5230, 2132, -1480, -5265, -8701, -10987, -11240, -9009, -4753, 287, 4785,
-    7954, 9488, 9157, 6803, 2893, -1170, -3708, -4014, -2971, -2290, -2980, -4421,
-    -4913, -3230, 173, 3363, 4383, 2751, -241, -2561, -2918, -1560, 41, 254,
-    -1609, -4789, -7516, -8156, -6268, -2684, 1405, 5395, 9271, 12779, 14889, 14337,
-    10767, 5274, -251, -4348, -6711, -7935, -8750, -9443, -9766, -9199, -7341, -4305,
-    -942, 1422, 1845, 660, -527, -1, 2676, 6375, 9452, 10984, 10948, 9513,
-    6614, 2383, -2315, -6192, -8507, -9569, -10223, -10947, -11492, -11241, -9736, -6917,
-    -3093, 1185, 5289, 8665, 10891, 11673, 10930, 8899, 6034, 2657, -1177, -5296,
-    -8883, -10601, -9516, -6025, -1845, 991, 1392, -150, -1919, -2216, -665, 1509,
-    2701, 2590, 2475, 3732, 6048, 7459, 6216, 2408, -2311, -6293, -8900, -10164,
-    -10022, -8207, -4723, -117, 4702, 8735, 11075, 11175, 9261, 6447, 4143, 3102,
-    2883, 2244, 157, -3299, -6835, -8740, -8045, -5222, -1846, 465, 984, -34,
-    -1879, -3889, -5494, -6059, -4940, -1834, 2849, 7956, 11957, 13572, 12339, 8806,
-    4173, -423, -4479, -8077, -11297, -13668, -14278, -12460, -8454, -3418, 1185, 4289,
-    5604, 5645, 5516, 6318, 8307, 10384, 10691, 8086, 3246, -1752, -5061, -6359,
-    -6706, -7287, -8312, -8927, -8018, -5216, -1339, 2054, 3751, 3700, 2776, 1754,
-    684, -609, -1596, -1057, 1719, 5835, 9083, 9441, 6420, 1204, -4248, -8306,
-    -10311, -10550, -9690, -8110, -5686, -2214, 1988, 5975, 8667, 9445, 8398, 6197,
-    3798, 2029, 1157, 729, -58, -1716, -4118, -6669, -8655, -9401, -8307, -5040,
-    104, 6005, 10939, 13189, 11813, 7226, 1190, -4019, -6865, -7274, -6226, -4676,
-    -2887, -713, 1674, 3504, 3847, 2282, -778, -4245, -6766, -7176, -4916, -361,
-    5143, 9737, 11909, 11222, 8358, 4444, 350, -3333, -5844, -6201, -4002, -316,
-    2537, 2472, -821, -5639, -9480, -10655, -9127, -6193, -3364, -1249, 776, 3770,
-    7908, 11830, 13408, 11378, 6445, 901, -2922, -4143, -3710, -3438, -4487, -6460,
-    -7865, -7496, -5389, -2511, 350, 3145, 6075, 8782, 10306, 9813, 7235, 3241,
-    -1181, -5059, -7640, -8623, -8276, -7078, -5147, -2142, 2043, 6498, 9414, 9231,
-    5793, 521, -4444, -7330, -7377, -4960, -1386, 1688, 3162, 3192, 2920, 3231,
-    3688, 2836, -277, -4917, -9065, -10963, -10219, -7564, -3928, 63, 3911, 7041,
-    8989, 9664, 9286, 8124, 6400, 4359, 2204, -127, -2965, -6484, -10164, -12750,
-    -12925, -10279, -5832, -1544, 1002, 1743, 2013, 3127, 5016, 6348, 6002, 4310,
-    2783, 2732, 4243, 6284, 7493, 6893, 4297, 393, -3634, -6876, -9185, -10781,
-    -11466, -10529, -7677, -3825, -600, 1056, 1664, 2540, 4456, 6969, 8855, 9014,
-    7139, 3866, 445, -1956, -2949, -3124, -3509, -4708, -6389, -7481, -6940, -4573,
-    -1377, 991, 1408, 259, -771, -54, 2631, 5959, 8162, 8261, 6390, 3253,
-    -512, -4464, -8100, -10646, -11211, -9215, -4869, 663, 5636, 8581, 9144, 8240,
-    7280, 6985, 6797, 5419, 2082, -2579, -6766, -8719, -7915, -5456, -3371, -3271,
-    -5172, -7361, -7612, -4973, -588, 3277, 5130, 5224, 4752, 4368, 3732, 2415,
-    899, 396, 1693, 4253, 6414, 6452, 3677, -1147, -6260, -9992, -11707, -11899,
-    -11381, -10393, -8484, -5161, -536, 4625, 9269, 12389, 13212, 11440, 7526, 2641,
-    -1834, -4971, -6578, -6949, -6412, -5165, -3464, -1821, -821, -645, -821, -615,
-    252, 1344, 2006, 2033, 1715, 1308, 707, -218, -1157, -1468, -786, 633,
-    2198, 3411, 3909, 3257, 1078, -2443, -6259, -8813, -8848, -6070, -1304, 3877,
-    7861, 9753, 9699, 8504, 6803, 4554, 1352, -2787, -6970, -9814, -10340, -8584,
-    -5427, -1908, 1292, 3794, 5192, 5086, 3599, 1744, 997, 2237, 5010, 7780,
-    8912, 7593, 4152, -205, -4027, -6380, -7329, -7702, -8239, -8871, -8835, -7464,
-    -4801, -1503, 1675, 4270, 6162, 7465, 8352, 8821, 8581, 7278, 4932, 2063,
-    -702, -3139, -5425, -7618, -9241, -9491, -7885, -4784, -1357, 949, 1165, -635,
-    -3291, -5162, -5047, -2816, 655, 4103, 6533, 7532, 7194, 5849, 3781, 1081,
-    -2268, -6091, -9728, -12095, -12222, -9912, -5952, -1599, 2224, 5305, 7823, 9796,
-    10922, 10871, 9555, 7095, 3679, -379, -4519, -8015, -10241, -10802, -9544, -6686,
-    -3084, -50, 1503, 1874, 2299, 3655, 5465, 6312, 5210, 2469, -649, -2855,
-    -3403, -2169, 348, 2986, 4257, 3149, -181, -4482, -8182, -10221, -10324, -8761,
-    -6023, -2690, 601, 3309, 5261, 6714, 7999, 9028, 9228, 8044, 5468, 2020,
-    -1703, -5264, -8198, -9919, -10115, -9196, -8024, -7016, -5678, -3167, 681, 4989,
-    8411, 9984, 9582, 7877, 5967, 4748, 4286, 3790, 2438, 294, -1754, -3030,
-    -3878, -5207, -7299, -9259, -9725, -8058, -4817, -1229, 1715, 3782, 5346, 6755,
-    7732, 7428, 5233, 1700, -1461, -2537, -1193, 1220, 2682, 1940, -793, -4168,
-    -6582, -7027, -5544, -3099, -869, 618, 1761, 3256, 5140, 6578, 6692, 5558,
-    4203, 3532, 3328, 2475, 166, -3155, -6120, -7625, -7657, -7029, -6444, -5837,
-    -4547, -2001, 1765, 6110, 10160, 13076, 14061, 12382, 7793, 1156, -5528, -10104,
-    -11638, -10872, -9300, -7808, -6241, -4138, -1571, 843, 2581, 3620, 4220, 4528,
-    4520, 4278, 4159, 4624, 5799, 7120, 7450, 5767, 2012, -2651, -6539, -8522,
-    -8557, -7418, -6113, -5479, -5858, -6722, -6718, -4552, -164, 5028, 9251, 11725,
-    12855, 13268, 12949, 11338, 8004, 3102, -2597, -7852, -11274, -11959, -10071, -6720,
-    -3135, 16, 2487, 3945, 3975, 2710, 1171, 701, 1959, 4417, 6745, 7674,
-    6729, 4449, 1958, 87, -1267, -2864, -5067, -7122, -7641, -5865, -2371, 1436,
-    4386, 6044, 6455, 5767, 4243, 2423, 980, 320, 346, 570, 393, -657,
-    -2708, -5314, -7418, -7788, -5761, -1760, 2818, 6283, 7429, 6056, 3092, 218,
-    -981, -4, 2156, 3663, 3223, 1089, -1175, -2010, -1129, 256, 366, -1795,
-    -5662, -9418, -11141, -9967, -6452, -1931, 2445, 6182, 9185, 11291, 12151, 11481,
-    9330, 6152, 2669, -403, -2743, -4604, -6488, -8445, -9745, -9439, -7331, -4329,
-    -1736, -225, 496, 1140, 2079, 3048, 3415, 2739, 1259, -25, 69, 1986,
-    4933, 7354, 7992, 6572, 3623, -138, -4123, -7790, -10536, -11826, -11378, -9234,
-    -5739, -1547, 2483, 5609, 7529, 8396, 8466, 7722, 5886, 2823, -985, -4386,
-    -6097, -5576, -3542, -1576, -1012, -1982, -3364, -3618, -1803, 1832, 5863, 8311,
-    7732, 4220, -499, -4224, -5818, -5728, -5071, -4359, -3285, -1624, -27, 360,
-    -922, -2976, -4187, -3592, -1676, 191, 1137, 1637, 2976, 5801, 9211, 11282,
-    10562, 7133, 2436, -1818, -4608, -5879, -6187, -6158, -6056, -5718, -4909, -3758,
-    -2791, -2415, -2403, -1974, -437, 2269, 5571, 8634, 10664, 11100, 9849, 7437,
-    4738, 2287, -144, -3123, -6608, -9514, -10424, -8868, -5908, -3378, -2432, -2694,
-    -2749, -1412, 1356, 4605, 7203, 8461, 8174, 6431, 3637, 615, -1687, -2874,
-    -3442, -4201, -5193, -5346, -3449, 413, 4482, 6545, 5609, 2464, -1238, -4240,
-    -6079, -6601, -5572, -2948, 628, 3871, 5526, 5071, 2936, 204, -1947, -2885,
-    -2922, -3054, -3969, -5113, -4875, -1994, 3056, 8104, 10831, 10438, 7990, 5309,
-    3482, 2267, 688, -1856, -4991, -7777, -9578, -10471, -10763, -10265, -8282, -4409,
-    758, 5803, 9349, 10742, 10132, 8251, 6136, 4678, 3970, 3103, 967, -2434,
-    -5586, -6658, -5268, -2999, -2099, -3621, -6725, -9586, -10822, -10173, -8109, -5115,
-    -1420, 2714, 6689, 9729, 11356, 11661, 11020, 9615, 7301, 3990, 45, -3806,
-    -6923, -9046, -10122, -9990, -8448, -5688, -2592, -410, 79, -771, -1602, -1015,
-    1323, 4294, 6093, 5614, 3388, 1223, 759, 2057, 3467, 2973, -23, -4016,
-    -6488, -5880, -2758, 798, 2952, 3361, 2946, 2670, 2639, 2289, 1232, -200,
-    -1212, -1265, -571, 66, -86, -1046, -2025, -2021, -654, 1440, 3041, 3306,
-    2457, 1619, 1904, 3462, 5271, 5838, 4306, 1119, -2236, -4204, -4092, -2332,
-    -24, 1768, 2443, 1870, 222, -2120, -4534, -6212, -6400, -4764, -1606, 2242,
-    5791, 8353, 9795, 10428, 10560, 10038, 8218, 4527, -778, -6348, -10340, -11470,
-    -9730, -6286, -2784, -540, 18, -505, -882, -108, 1832, 3978, 5273, 5502,
-    5366, 5666, 6482, 7125, 6798, 5250, 2903, 534, -1180, -1992, -2140, -2100,
-    -2201, -2474, -2858, -3447, -4332, -5175, -5110, -3304, 269, 4611, 8311, 10391,
-    10700, 9678, 7852, 5504, 2669, -638, -4132, -7144, -8775, -8293, -5547, -1198,
-    3358, 6446, 6894, 4776, 1516, -962, -1485, -285, 1503, 2891, 3566, 3533,
-    2575, 372, -2816, -5809, -7107, -5987, -3054, 243, 2663, 3896, 4493, 5213,
-    6332, 7397, 7518, 6022, 3006, -617, -3646, -5294, -5568, -5126, -4784, -5072,
-    -5976, -6955, -7216, -6163, -3768, -575, 2675, 5426, 7380, 8302, 7969, 6439,
-    4330, 2653, 2138, 2604, 2972, 2016, -673, -4260, -7168, -8213, -7509, -6359,
-    -6139, -7051, -7899, -7083, -3913, 901, 5901, 9871, 12308, 13200, 12634, 10641,
-    7304, 2904, -1973, -6446, -9607, -10968, -10756, -9619, -7969, -5665, -2499, 1024,
-    3573, 3900, 1985, -709, -2200, -1406, 1120, 3665, 4652, 3751, 2006, 900,
-    1110, 1966, 2040, 315, -3022, -6697, -9119, -9223, -6938, -3181, 659, 3489,
-    5048, 5720, 5859, 5410, 4276, 2866, 1898, 1496, 726, -1566, -5349, -9025,
-    -10634, -9423, -6194, -2318, 1300, 4316, 6450, 7349, 7008, 6028, 5145, 4460,
-    3302, 985, -2232, -4994, -5833, -4472, -2272, -1242, -2429, -5104, -7493, -8266,
-    -7315, -5270, -2582, 689, 4338, 7619, 9586, 9740, 8231, 5547, 2230, -1124,
-    -3894, -5703, -6620, -6887, -6465, -5090, -2914, -933, -443, -1893, -4338, -6099,
-    -5973, -3867, -508, 3169, 6318, 8234, 8508, 7292, 5236, 2992, 751, -1674,
-    -4340, -6842, -8537, -9020, -8349, -6854, -4851, -2566, -292, 1544, 2578, 2874,
-    3023, 3719, 5047, 6176, 5902, 3635, -68, -3904, -6636, -7562, -6496, -3732,
-    -183, 2796, 4171, 4020, 3372, 3102, 3001, 2053, -391, -3762, -6522, -7165,
-    -5133, -1135, 3191, 6073, 6493, 4616, 1443, -1973, -4979, -7133, -7865, -6670,
-    -3754, -320, 2053, 2559, 1811, 1350, 2371, 4702, 6847, 7077, 4712, 619,
-    -3382, -5724, -5992, -4973, -3956, -3833, -4579, -5361, -5126, -3279, -55, 3588,
-    6467, 7765, 7376, 5812, 3802, 1913, 488, -231, -172, 280, 247, -1064,
-    -3549, -6051, -7203, -6494, -4554, -2486, -1055, -368, -40, 568, 2043, 4453,
-    6986, 8239, 7190, 4062, 264, -2582, -3691, -3447, -2905, -2900, -3418, -3670,
-    -2847, -944, 1095, 2141, 1844, 853, 144, 174, 706, 1307, 1875, 2633,
-    3676, 4617, 4703, 3366, 751, -2224, -4405, -5164, -4776, -4095, -3773, -3686,
-    -3038, -1049, 2333, 6239, 9311, 10427, 9250, 6303, 2610, -857, -3597, -5614,
-    -7093, -8059, -8384, -8077, -7387, -6437, -4838, -1943, 2254, 6532, 8998, 8452,
-    5341, 1443, -1322, -1996, -920, 674, 1507, 1063, -144, -1094, -1166, -623,
-    -327, -1093, -3274, -6575, -9927, -11638, -10205, -5474, 973, 6786, 10387, 11645,
-    11296, 9994, 7979, 5363, 2416, -469, -2933, -4755, -5901, -6490, -6593, -6036,
-    -4592, -2497, -616, 191, -16, -107, 1175, 4050, 7401, 9502, 9102, 6115,
-    1668, -2449, -4713, -4754, -3544, -2625, -2898, -3972, -4608, -3829, -1723, 726,
-    2527, 3469, 4106, 4998, 5998, 6299, 5246, 3073, 766, -878, -2045, -3622,
-    -6037, -8412, -9030, -6798, -2298, 2577, 5970, 7120, 6398, 4763, 3300, 2880,
-    3686, 4862, 4980, 3243, 302, -2259, -3328, -3144, -2900, -3686, -5750, -8358,
-    -10095, -9489, -5913, -195, 5744, 10091, 12105, 12069, 10613, 8316, 5781, 3639,
-    2170, 1017, -536, -2930, -5935, -8738, -10341, -10070, -8035, -5205, -2827, -1495,
-    -723, 513, 2789, 5693, 8111, 8929, 7698, 4956, 2045, 309, 125, 649,
-    644, -366, -1790, -2761, -3062, -3213, -3788, -4767, -5521, -5287, -3725, -1187,
-    1468, 3460, 4653, 5545, 6599, 7562, 7497, 5609, 2093, -1787, -4481, -5184,
-    -4333, -3224, -3016, -3859, -4824, -4659, -2765, 370, 3517, 5456, 5594, 4148,
-    1939, -49, -1116, -1117, -427, 319, 524, -178, -1808, -3949, -5718, -6009,
-    -4122, -467, 3321, 5294, 4610, 2281, 406, 472, 2211, 3962, 4069, 2011,
-    -1460, -4926, -7055, -7188, -5664, -3686, -2580, -2824, -3614, -3435, -1257, 2607,
-    6670, 9344, 9973, 8988, 7151, 4795, 1887, -1263, -3692, -4438, -3530, -2161,
-    -1774, -2941, -4995, -6602, -6679, -5117, -2855, -1199, -710, -623, 482, 3253,
-    6846, 9642, 10538, 9454, 6850, 3203, -917, -4679, -7332, -8753, -9396, -9633,
-    -9291, -7927, -5422, -2192, 1077, 3780, 5512, 6050, 5331, 3509, 1129, -779,
-    -1097, 460, 2685, 3514, 1756, -1702, -4605, -5300, -3982, -2139, -1159, -1568,
-    -3176, -5307, -6820, -6441, -3675, 525, 4255, 6029, 5765, 4557, 3636, 3449,
-    3415, 2371, -512, -4816, -8740, -10158, -8164, -3741, 1137, 5009, 7526, 8783,
-    8506, 6266, 2426, -1472, -3598, -3220, -1272, 409, 456, -1132, -3146, -4177,
-    -3754, -2731, -2500, -3573, -4867, -4519, -1579, 3093, 7541, 10183, 10566, 9010,
-    6038, 2305, -1270, -3783, -4908, -5031, -4783, -4565, -4551, -4863, -5426, -5668,
-    -4705, -2097, 1513, 4645, 6041, 5651, 4693, 4624, 5801, 7016, 6455, 3377,
-    -1096, -4831, -6308, -5431, -3122, -588, 939, 398, -2402, -6153, -8636, -8401,
-    -5845, -2532, 398, 2869, 5162, 7128, 8354, 8747, 8508, 7577, 5530, 2236,
-    -1642, -4986, -6993, -7450, -6444, -4236, -1561, 285, 190, -1691, -3714, -3893,
-    -1514, 2238, 5211, 5940, 4595, 2531, 1031, 439, 270, -97, -904, -1991,
-    -2977, -3409, -2956, -1663, -32, 1323, 2161, 2685, 3069, 3044, 2151, 481,
-    -1024, -1234, 30, 1586, 1757, -170, -3229, -5487, -5556, -3579, -948, 888,
-    1470, 1503, 2164, 4123, 6941, 9273, 9757, 7951, 4584, 933, -2049, -4103,
-    -5390, -6065, -6165, -5765, -5074, -4374, -3882, -3635, -3367, -2550, -726, 2037,
-    5052, 7456, 8803, 9202, 8924, 7996, 6190, 3335, -406, -4468, -8006, -10180,
-    -10567, -9467, -7759, -6296, -5271, -4158, -2332, 193, 2649, 4221, 4886, 5489,
-    6860, 8856, 10376, 10322, 8466, 5333, 1510, -2667, -6788, -10122, -11952, -12013,
-    -10419, -7337, -3131, 1123, 3752, 3672, 1559, -443, -419, 1838, 4916, 7125,
-    7703, 6990, 5796, 4652, 3457, 1674, -1106, -4662, -8181, -10764, -11888, -11398,
-    -9265, -5565, -729, 4374, 8732, 11616, 12766, 12308, 10584, 7995, 4844, 1279,
-    -2552, -6253, -9154, -10596, -10256, -8251, -5072, -1459, 1829, 4367, 6272, 7888,
-    9144, 9302, 7546, 3917, -406, -3795, -5232, -4829, -3562, -2617, -2765, -3953,
-    -5242, -5311, -3426, -177, 2825, 4206, 3941, 3190, 3013, 3320, 3120, 1727,
-    -445, -2273, -2996, -2843, -2685, -3154, -3989, -4117, -2495, 800, 4138, 5255,
-    3063, -1190, -4640, -4952, -1988, 2357, 5748, 6906, 5948, 3767, 1218, -1315,
-    -3824, -6241, -8097, -8668, -7544, -4999, -1740, 1656, 4929, 7809, 9717, 9971,
-    8267, 4953, 957, -2519, -4473, -4706, -4090, -3963, -4930, -6188, -6227, -4277,
-    -1051, 1878, 3348, 3317, 2644, 2378, 3092, 4543, 5786, 5837, 4509, 2685,
-    1607, 1697, 2039, 1084, -1948, -6193, -9599, -10369, -8220, -4448, -839, 1560,
-    2795, 3407, 3648, 3300, 2119, 378, -1033, -1093, 538, 2971, 4425, 3492,
-    415, -2824, -3966, -2346, 470, 1865, 173, -4093, -8642, -10974, -9948, -6298,
-    -1894, 1621, 3780, 5150, 6401, 7457, 7529, 5937, 2930, -330, -2707, -4100,
-    -5460, -7607, -9948, -10500, -7473, -1047, 6332, 11439, 12285, 9148, 4140, -189,
-    -2340, -2681, -2999, -4938, -8408, -11456, -11880, -9125, -4660, -529, 2370, 4605,
-    7054, 9659, 11331, 10934, 8281, 4235, 19, -3548, -6242, -8120, -9122, -8997,
-    -7542, -4929, -1885, 443, 1010, -412, -2939, -5129, -6036, -5765, -4915, -3577,
-    -1099, 3019, 8123, 12479, 14388, 13223, 9533, 4452, -826, -5224, -7934, -8764,
-    -8348, -7766, -7721, -7987, -7670, -6051, -3187, 240, 3532, 6337, 8481, 9708,
-    9786, 8856, 7466, 6151, 5009, 3721, 1893, -645, -3672, -6436, -7745, -6627,
-    -3331, 321, 1925, 238, -3768, -7453, -8189, -5001, 831, 6502, 9407, 8823,
-    6287, 4218, 3922, 4795, 5358, 4841, 3626, 2313, 764, -1697, -5200, -8636,
-    -10134, -8389, -3741, 1841, 5946, 7273, 6360, 4894, 4173, 4060, 3284, 715,
-    -3521, -7950, -10636, -10369, -7378, -3114, 751, 3397, 5141, 6761, 8518, 9817,
-    9720, 7756, 4236, -35, -4238, -7760, -10133, -10974, -10139, -7958, -5213, -2742,
-    -919, 515, 2097, 4062, 6052, 7341, 7358, 6076, 4046, 2129, 1151, 1611,
-    3432, 5794, 7231, 6273, 2455, -3040, -7879, -10114, -9532, -7657, -6412, -6645,
-    -7675, -7960, -6182, -2046, 3549, 9000, 12870, 14533, 14082, 11772, 7784, 2627,
-    -2555, -6453, -8511, -9212, -9388, -9384, -8953, -7700, -5428, -2266, 1105, 3336,
-    3125, 592, -2155, -2378, 953, 6180, 10381, 11715, 10417, 7875, 5170, 2544,
-    -170, -3000, -5698, -7823, -8857, -8418, -6585, -3998, -1465, 660, 2669, 4974,
-    7353, 8793, 8210, 5427, 1485, -2065, -4234, -5092, -5316, -5331, -4889, -3428,
-    -826, 2142, 4105, 3993, 1917, -694, -1902, -559, 2825, 6271, 7544, 5618,
-    1455, -2573, -4345, -3567, -1948, -1730, -3817, -7142, -9676, -9960, -7809, -3921,
-    798, 5519, 9422, 11692, 11737, 9512, 5739, 1811, -817, -1554, -1195, -1381,
-    -3265, -6510, -9482, -10421, -8620, -4863, -977, 1219, 1075, -381, -1135, 259,
-    3546, 7065, 9165, 9348, 8235, 6681, 5059, 3232, 967, -1701, -4416, -6702,
-    -8258, -9086, -9307, -8847, -7396, -4760, -1263, 2297, 5112, 6813, 7541, 7701,
-    7671, 7544, 6969, 5290, 2130, -1938, -5399, -6775, -5868, -4050, -3159, -3945,
-    -5459, -5892, -4047, -215, 4081, 7049, 7632, 6057, 3674, 2068, 1910, 2487,
-    2458, 1156, -881, -2692, -3946, -4981, -5863, -5792, -3770, 178, 4608, 7506,
-    7558, 4866, 879, -2286, -2936, -933, 1984, 3300, 1632, -2132, -5533, -6465,
-    -4698, -1875, -169, -688, -2741, -4417, -4041, -1390, 2354, 5739, 8105, 9555,
-    10151, 9472, 7113, 3422, -496, -3573, -5507, -6731, -7819, -8973, -9964, -10330,
-    -9570, -7315, -3549, 1170, 5782, 9188, 10845, 10988, 10226, 8912, 6889, 3878,
-    54, -3802, -6717, -8118, -8121, -7416, -6841, -6849, -7119, -6701, -4758, -1377,
-    2347, 5138, 6482, 6820, 6902, 7074, 7160, 6846, 6012, 4706, 2957, 705,
-    -2099, -5306, -8403, -10492, -10625, -8455, -4767, -1223, 778, 1260, 1694, 3645,
-    7158, 10446, 11278, 8821, 4273, -162, -2866, -3625, -3284, -2886, -3033, -3710,
-    -4479, -4875, -4751, -4216, -3208, -1286, 1857, 5572, 8224, 8382, 6218, 3537,
-    2215, 2527, 3011, 1935, -1130, -5029, -8009, -8884, -7535, -4718, -1604, 764,
-    2007, 2619, 3486, 4963, 6383, 6643, 5327, 3139, 1168, -189, -1393, -2944,
-    -4661, -5869, -6149, -5664, -4811, -3794, -2614, -1300, 62, 1439, 2840, 4152,
-    5161, 5771, 6104, 6303, 6295, 5820, 4608, 2442, -775, -4734, -8424, -10433,
-    -9917, -7400, -4485, -2600, -1935, -1482, -16, 2874, 6467, 9409, 10621, 9951,
-    8090, 5836, 3489, 1011, -1323, -2757, -2780, -1939, -1637, -2894, -5327, -7366,
-    -7511, -5457, -2253, 447, 1441, 761, -274, 103, 2785, 6957, 10541, 11671,
-    9997, 6751, 3629, 1533, 166, -1367, -3607, -6212, -8194, -8653, -7420, -5112,
-    -2604, -427, 1398, 3004, 4249, 4709, 4120, 2796, 1552, 1135, 1628, 2350,
-    2413, 1515, 251, -407, -67, 617, 524, -844, -2836, -4202, -4060, -2324,
-    525, 3703, 6084, 6402, 4057, -76, -3945, -5775, -5332, -3797, -2519, -2000,
-    -1899, -1598, -614, 1239, 3714, 6085, 7481, 7413, 5968, 3551, 688, -1842,
-    -3028, -2306, -378, 950, 158, -2613, -5585, -6786, -5544, -2849, -482, 265,
-    -546, -1512, -857, 2194, 6661, 10399, 11673, 10347, 7675, 5052, 2956, 965,
-    -1436, -4158, -6505, -7740, -7684, -6835, -5920, -5238, -4401, -2739, -45, 3083,
-    5650, 7025, 7362, 7325, 7439, 7635, 7267, 5606, 2508, -1202, -4086, -5129,
-    -4663, -4192, -5064, -7186, -9080, -9206, -7204, -3875, -240, 3111, 5870, 7663,
-    8195, 7650, 6668, 5766, 4902, 3671, 1826, -483, -2858, -4850, -6006, -5940,
-    -4560, -2258, 139, 1655, 1565, -164, -2556, -3902, -2816, 556, 4319, 6067,
-    4649, 1022, -2458, -3674, -2119, 831, 2868, 2372, -362, -3293, -4213, -2450,
-    773, 3563, 4889, 4989, 4597, 4011, 2965, 1180, -1125, -3263, -4564, -4881,
-    -4721, -4842, -5554, -6297, -5957, -3794, -181, 3533, 5974, 6702, 6381, 6091,
-    6385, 6816, 6281, 3952, 105, -3832, -6200, -6381, -5360, -4960, -6310, -8900,
-    -11038, -11240, -9233, -5787, -1868, 1936, 5336, 8056, 9823, 10554, 10393, 9539,
-    8095, 6039, 3269, -320, -4604, -8950, -12244, -13426, -12160, -9046, -5277, -2085,
-    -290, 55, -168, 456, 2811, 6280, 8940, 9005, 6305, 2438, -493, -1365,
-    -623, 262, -130, -2273, -5430, -8165, -9310, -8682, -6937, -4793, -2427, 327,
-    3348, 5968, 7448, 7620, 6991, 6164, 5203, 3548, 611, -3469, -7531, -9870,
-    -9267, -5906, -1473, 1816, 2692, 1675, 561, 895, 2721, 4642, 5061, 3452,
-    660, -1850, -3020, -2780, -1926, -1484, -2019, -3331, -4764, -5780, -6218, -5994,
-    -4740, -1991, 2119, 6452, 9366, 9815, 8114, 5699, 4042, 3517, 3086, 1145,
-    -3024, -8361, -12572, -13749, -11654, -7639, -3493, -365, 1539, 2704, 3912, 5742,
-    8026, 9732, 9679, 7612, 4499, 1688, -212, -1558, -2963, -4612, -6288, -7764,
-    -8946, -9663, -9574, -8386, -6125, -3171, -87, 2544, 4299, 5129, 5460, 5962,
-    6985, 8123, 8343, 6671, 2995, -1671, -5700, -7835, -7947, -6981, -6167, -6122,
-    -6503, -6383, -4962, -2114, 1516, 4825, 6780, 6922, 5591, 3725, 2321, 1889,
-    2277, 2947, 3393, 3310, 2485, 761, -1684, -4069, -5314, -4862, -3266, -1832,
-    -1543, -2259, -2846, -2040, 630, 4355, 7255, 7370, 4059, -1226, -5707, -7230,
-    -5757, -3052, -967, -29, 511, 1597, 3444, 5465, 6790, 6850, 5645, 3617,
-    1265, -1145, -3488, -5437, -6395, -5925, -4304, -2561, -1838, -2536, -3933, -4614,
-    -3528, -945, 1534, 2177, 666, -1408, -1734, 810, 5184, 8963, 10071, 8084,
-    4216, 283, -2518, -4154, -5376, -6811, -8318, -9136, -8597, -6682, -3974, -1169,
-    1355, 3595, 5599, 7126, 7647, 6821, 5059, 3478, 3086, 3896, 4858, 4695,
-    2819, -385, -3905, -6605, -7733, -7372, -6506, -6310, -7039, -7603, -6431, -2888,
-    2105, 6763, 9660, 10444, 9677, 8182, 6433, 4367, 1729, -1369, -4242, -6087,
-    -6635, -6268, -5487, -4395, -2800, -717, 1336, 2583, 2487, 1125, -721, -1855,
-    -1361, 639, 2826, 3531, 2058, -614, -2460, -1939, 747, 3695, 4692, 2919,
-    -356, -2706, -2391, 382, 3756, 5691, 5313, 3170, 475, -1845, -3554, -4830,
-    -5744, -6035, -5373, -3802, -1854, -181, 966, 1924, 3318, 5485, 8003, 9704,
-    9337, 6583, 2596, -592, -1549, -566, 591, 94, -2555, -6196, -8853, -9083,
-    -6946, -3930, -1764, -1004, -672, 640, 3306, 6370, 8621, 9702, 10043, 9955,
-    9119, 7011, 3606, -446, -4222, -7008, -8586, -9253, -9547, -9727, -9402, -7779,
-    -4433, 96, 4445, 7206, 7764, 6698, 5468, 5454, 6854, 8357, 8092, 5193,
-    611, -3554, -5540, -5016, -3128, -1709, -2154, -4495, -7273, -8522, -7229, -3982,
-    -211, 3072, 5691, 7682, 8724, 8425, 6952, 5012, 3185, 1460, -475, -2660,
-    -4704, -6037, -6132, -4597, -1451, 2444, 5401, 5826, 3537, 198, -1781, -1143,
-    1155, 2754, 1907, -1052, -4076, -5185, -4019, -1850, -276, 86, -171, -55,
-    854, 2114, 2936, 2976, 2647, 2645, 3127, 3386, 2448, 62, -2898, -5067,
-    -5689, -5187, -4736, -5212, -6398, -7047, -5799, -2269, 2517, 6689, 8712, 8310,
-    6541, 5028, 4856, 5803, 6451, 5239, 1760, -2780, -6441, -8005, -7720, -6794,
-    -6323, -6630, -7286, -7486, -6496, -4110, -841, 2447, 5211, 7462, 9289, 10321,
-    9964, 8127, 5483, 2867, 568, -1687, -4196, -6874, -9263, -10681, -10452, -8369,
-    -5203, -2505, -1500, -1978, -2416, -1328, 1456, 4750, 7083, 7794, 7278, 6406,
-    5681, 4859, 3320, 886, -1753, -3543, -4076, -4056, -4641, -6297, -8252, -9051,
-    -7727, -4601, -1130, 1145, 1773, 1681, 2241, 3873, 5545, 5706, 3773, 731,
-    -1626, -2046, -634, 1366, 2473, 1933, 147, -1655, -2288, -1422, 226, 1427,
-    1279, -186, -2050, -3213, -3221, -2475, -1580, -587, 922, 2943, 4540, 4562,
-    2904, 847, 16, 1026, 3088, 4731, 4843, 3324, 1135, -284, -59, 1290,
-    2092, 872, -2354, -6027, -8248, -8102, -6077, -3484, -1474, -344, 483, 1798,
-    3817, 5961, 7417, 7849, 7549, 6980, 6286, 5239, 3533, 1149, -1419, -3304,
-    -3850, -3321, -2943, -3904, -6142, -8180, -8345, -6205, -2836, 222, 2202, 3442,
-    4748, 6551, 8581, 10127, 10497, 9291, 6481, 2484, -1805, -5293, -7350, -8253,
-    -8812, -9429, -9618, -8575, -6126, -2927, 197, 2858, 4976, 6371, 6773, 6230,
-    5266, 4548, 4447, 4848, 5182, 4599, 2433, -1134, -4839, -7024, -6841, -4910,
-    -2847, -2062, -2763, -3798, -3436, -713, 3614, 7361, 8467, 6508, 2857, -530,
-    -2463, -2915, -2564, -2179, -2210, -2580, -2783, -2378, -1458, -489, 387, 1651,
-    3744, 6177, 7609, 7041, 4858, 2556, 1375, 1224, 878, -849, -4036, -7528,
-    -9725, -9596, -7236, -3697, -315, 2055, 3471, 4724, 6587, 9002, 10937, 11149,
-    9190, 5696, 1760, -1884, -5020, -7553, -9212, -9726, -9139, -7848, -6312, -4757,
-    -3071, -968, 1682, 4546, 6872, 7964, 7709, 6667, 5651, 5211, 5333, 5409,
-    4482, 1841, -2271, -6515, -9293, -9926, -9064, -7933, -7253, -6833, -5983, -4130,
-    -1169, 2441, 5810, 8045, 8805, 8450, 7571, 6379, 4645, 2207, -618, -3196,
-    -5068, -6237, -6976, -7429, -7361, -6311, -4064, -1095, 1500, 2697, 2374, 1501,
-    1444, 2891, 5288, 7191, 7254, 5161, 1857, -1102, -2640, -2877, -2876, -3630,
-    -5132, -6352, -6101, -4032, -906, 2082, 4252, 5740, 6881, 7441, 6628, 3998,
-    265, -2947, -4231, -3392, -1489, -45, -64, -1377, -2683, -2413, -20, 3333,
-    5529, 5227, 3017, 893, 581, 2230, 4454, 5435, 4161, 1042, -2413, -4646,
-    -5134, -4613, -4252, -4554, -5026, -4793, -3386, -978, 1916, 4773, 7181, 8801,
-    9341, 8560, 6378, 3085, -572, -3670, -5671, -6743, -7503, -8391, -9185, -9081,
-    -7241, -3511, 1186, 5176, 7046, 6658, 5268, 4541, 5252, 6745, 7513, 6355,
-    3206, -856, -4347, -6316, -6846, -6774, -6894, -7342, -7631, -7174, -5752, -3552,
-    -882, 2069, 5155, 8008, 9915, 10144, 8534, 5791, 3080, 1224, 177, -782,
-    -2405, -4856, -7450, -8884, -8044, -5013, -1359, 913, 1018, 38, -177, 1298,
-    3880, 6337, 7868, 8305, 7720, 6208, 4014, 1571, -736, -2723, -4310, -5437,
-    -6115, -6431, -6300, -5343, -3179, 74, 3649, 6483, 7740, 7221, 5524, 3826,
-    3119, 3323, 3220, 1534, -1740, -5121, -6749, -5728, -2591, 1185, 3984, 4786,
-    3693, 1922, 1021, 1720, 3408, 4730, 4679, 3196, 951, -1233, -2804, -3637,
-    -3993, -4257, -4577, -4744, -4463, -3723, -2734, -1517, 307, 3078, 6403, 9028,
-    9624, 7874, 4843, 2210, 979, 758, 174, -1974, -5700, -9650, -11887, -11153,
-    -7802, -3623, -540, 792, 1278, 2313, 4474, 7192, 9456, 10606, 10500, 9284,
-    7236, 4735, 2133, -383, -2719, -4699, -6154, -7192, -8164, -9184, -9765, -9108,
-    -6802, -3210, 765, 4191, 6534, 7850, 8658, 9401, 9846, 9140, 6673, 2895,
-    -900, -3602, -4967, -5382, -5307, -5160, -5420, -6358, -7516, -7798, -6354, -3362,
-    163, 3233, 5437, 6779, 7310, 7069, 6229, 5091, 3900, 2712, 1402, -266,
-    -2471, -5015, -7111, -7677, -6135, -3073, -23, 1582, 1440, 527, 233, 1232,
-    2949, 3997, 3234, 612, -2752, -5299, -6006, -4911, -2863, -797, 848, 2089,
-    2939, 3131, 2397, 973, -310, -596, 244, 1393, 1660, 419, -1802, -3622,
-    -3858, -2548, -1026, -842, -2412, -4608, -5641, -4438, -1356, 2178, 4655, 5407,
-    4918, 4382, 4730, 5827, 6580, 5865, 3409, -153, -3854, -6903, -8798, -9362,
-    -8889, -8067, -7450, -6952, -5997, -4202, -1779, 780, 3226, 5579, 7697, 9091,
-    9301, 8402, 7018, 5808, 4903, 3803, 1776, -1529, -5675, -9524, -11815, -11891,
-    -10112, -7640, -5704, -4798, -4331, -3065, -135, 4109, 8188, 10527, 10565, 8977,
-    6873, 4852, 2807, 526, -1740, -3368, -4010, -4025, -4237, -5221, -6776, -8021,
-    -8041, -6565, -4190, -1954, -533, 275, 1304, 3173, 5600, 7545, 8022, 6805,
-    4463, 1858, -348, -1922, -3047, -4100, -5242, -6092, -5917, -4328, -1774, 743,
-    2473, 3323, 3523, 3111, 1957, 222, -1438, -2251, -1908, -774, 365, 769,
-    159, -1094, -2130, -2130, -897, 927, 2217, 2079, 480, -1586, -2637, -1762,
-    527, 2478, 2390, -27, -3415, -5867, -6301, -4998, -3102, -1705, -1200, -1167,
-    -759, 613, 2774, 4922, 6342, 6951, 7083, 6781, 5530, 2859, -846, -4300,
-    -6221, -6314, -5433, -4853, -5314, -6528, -7365, -6572, -3665, 569, 4450, 6562,
-    6790, 6265, 6247, 7003, 7703, 7260, 5186, 1773, -2241, -6049, -8981, -10663,
-    -11104, -10602, -9510, -8081, -6445, -4578, -2252, 811, 4503, 8042, 10267, 10398,
-    8564, 5661, 2779, 669, -511, -1206, -2187, -3950, -6186, -7857, -7950, -6278,
-    -3647, -1320, -278, -683, -1759, -2166, -862, 2053, 5269, 7192, 7086, 5409,
-    3163, 1084, -595, -1875, -2765, -3298, -3536, -3460, -2967, -2057, -931, 254,
-    1643, 3427, 5196, 5779, 4086, 316, -3799, -6179, -5989, -4197, -2676, -2721,
-    -4157, -5557, -5249, -2508, 1835, 5835, 7777, 7404, 5932, 4851, 4685, 4823,
-    4310, 2622, -171, -3594, -6934, -9409, -10507, -10230, -8913, -6837, -4188, -1341,
-    1093, 2770, 4054, 5671, 7817, 9722, 10207, 8658, 5524, 2010, -693, -2117,
-    -2778, -3756, -5749, -8360, -10322, -10504, -8734, -5707, -2332, 723, 3037, 4421,
-    5082, 5605, 6482, 7606, 8332, 8061, 6680, 4429, 1561, -1679, -4805, -7100,
-    -8080, -7924, -7336, -6948, -6844, -6597, -5641, -3609, -524, 3088, 6270, 8075,
-    8208, 7286, 6325, 5856, 5518, 4469, 2172, -1137, -4525, -6812, -7198, -5872,
-    -4065, -3229, -3820, -4891, -5020, -3672, -1548, 321, 1578, 2555, 3537, 4265,
-    4176, 2969, 985, -838, -1446, -455, 1285, 2119, 977, -1478, -3227, -2624,
-    131, 3093, 4065, 2153, -1656, -5119, -6183, -4411, -1388, 457, -187, -2504,
-    -4432, -4509, -2835, -487, 1641, 3283, 4437, 4990, 4842, 4177, 3442, 3062,
-    3181, 3544, 3487, 2174, -811, -4877, -8480, -10044, -9072, -6463, -3813, -2304,
-    -2035, -2086, -1167, 1525, 5619, 9598, 11688, 11104, 8585, 5708, 3618, 2323,
-    1036, -1008, -4010, -7503, -10459, -11644, -10334, -7011, -3256, -636, 465, 904,
-    1735, 3232, 4931, 6370, 7525, 8500, 9028, 8465, 6329, 2885, -788, -3369,
-    -4216, -3920, -3919, -5296, -7735, -9633, -9337, -6426, -1960, 2336, 5151, 6215,
-    6242, 6341, 7175, 8390, 8835, 7544, 4616, 1111, -1913, -4168, -5929, -7264,
-    -7733, -6930, -5175, -3509, -2922, -3536, -4429, -4233, -2085, 1667, 5509, 7609,
-    6988, 4166, 784, -1457, -1731, -317, 1820, 3673, 4706, 5012, 5014, 4867,
-    4105, 1968, -1778, -6318, -10151, -12025, -11544, -9039, -5081, -233, 4864, 9401,
-    12527, 13560, 12156, 8501, 3485, -1476, -5156, -7314, -8705, -10099, -11172, -10523,
-    -6962, -948, 5279, 9099, 9303, 6811, 3798, 2039, 1759, 1765, 606, -2216,
-    -5823, -8553, -9051, -7087, -3567, 193, 3345, 5830, 7928, 9523, 9910, 8410,
-    5212, 1522, -1262, -2602, -3122, -3883, -5382, -7161, -8303, -8261, -7276, -6075,
-    -5154, -4298, -2744, 136, 4218, 8573, 11981, 13533, 12956, 10581, 7132, 3421,
-    2, -3021, -5828, -8459, -10538, -11484, -11012, -9413, -7333, -5263, -3227, -915,
-    1895, 4995, 7794, 9676, 10332, 9791, 8178, 5590, 2237, -1337, -4296, -5836,
-    -5575, -3814, -1616, -520, -1720, -5007, -8457, -9503, -6816, -1368, 4295, 7929,
-    8945, 8296, 7304, 6596, 5825, 4167, 1134, -2862, -6571, -8666, -8616, -6950,
-    -4670, -2408, -175, 2083, 3836, 4103, 2434, -248, -1987, -1303, 1459, 4276,
-    5046, 3205, -3, -2620, -3334, -2122, -23, 1620, 2027, 1481, 1006, 1333,
-    2041, 1894, 182, -2261, -3488, -2043, 1748, 5877, 8026, 7063, 3601, -662,
-    -4194, -6446, -7660, -8058, -7377, -5196, -1645, 2369, 5641, 7404, 7722, 7303,
-    6889, 6587, 5684, 3235, -909, -5570, -8844, -9395, -7382, -4351, -2272, -2373,
-    -4361, -6494, -6673, -3982, 555, 4799, 7220, 7888, 7902, 8065, 8208, 7600,
-    5708, 2555, -1379, -5362, -8607, -10543, -11046, -10382, -8872, -6635, -3722, -470,
-    2376, 4050, 4420, 4237, 4558, 5745, 7008, 7064, 5349, 2576, 120, -1109,
-    -1233, -1111, -1667, -3333, -5757, -7899, -8688, -7920, -6514, -5638, -5434, -4758,
-    -2324, 1906, 6511, 9717, 10620, 9497, 7209, 4467, 1531, -1584, -4703, -7245,
-    -8407, -7710, -5499, -2881, -1025, -304, -18, 991, 3209, 5737, 6730, 4825,
-    410, -4437, -7357, -7278, -4836, -1549, 1343, 3434, 4977, 6337, 7489, 7811,
-    6409, 2888, -2033, -6747, -9719, -10340, -8898, -5962, -2005, 2350, 6010, 7675,
-    6602, 3162, -1320, -5246, -7378, -7164, -4814, -1250, 2182, 4325, 4884, 4587,
-    4531, 5197, 6036, 6042, 4716, 2464, 109, -1837, -3362, -4613, -5570, -6079,
-    -6020, -5306, -3819, -1516, 1346, 4202, 6447, 7687, 7789, 6819, 5096, 3245,
-    2000, 1752, 2188, 2371, 1270, -1555, -5512, -9157, -10997, -10454, -8215, -5596,
-    -3472, -1728, 316, 3018, 5904, 7945, 8312, 7020, 4999, 3503, 3236, 3862,
-    4354, 3864, 2307, 170, -2088, -4329, -6517, -8385, -9412, -9100, -7275, -4237,
-    -714, 2428, 4634, 5939, 6784, 7480, 7842, 7331, 5541, 2610, -703, -3319,
-    -4400, -3926, -2799, -2232, -2768, -3787, -3981, -2421, 687, 4096, 6310, 6462,
-    4737, 2109, -378, -2242, -3606, -4691, -5335, -5030, -3406, -662, 2456, 5042,
-    6482, 6660, 5820, 4234, 1985, -853, -3813, -5897, -6022, -3804, -56, 3426,
-    4765, 3124, -614, -4241, -5668, -4452, -2064, -574, -905, -2264, -3072, -2309,
-    -34, 3000, 5941, 8119, 9099, 8735, 7180, 4766, 1837, -1328, -4454, -7195,
-    -9106, -9750, -8951, -7007, -4554, -2118, 165, 2266, 3813, 4225, 3479, 2578,
-    2924, 5068, 8097, 10268, 10224, 7724, 3547, -1062, -4972, -7594, -9009, -9662,
-    -9802, -9193, -7395, -4329, -558, 2976, 5504, 6817, 7241, 7297, 7318, 7323,
-    7167, 6764, 6110, 5125, 3569, 1191, -1938, -5193, -7502, -7882, -6172, -3422,
-    -1397, -1360, -3049, -4799, -4769, -2310, 1643, 5318, 7361, 7648, 7116, 6791,
-    6819, 6359, 4417, 782, -3766, -7965, -10605, -10782, -8157, -3349, 2066, 6356,
-    8629, 8990, 7829, 5279, 1560, -2438, -5363, -6353, -5656, -4244, -2909, -1732,
-    -239, 2013, 4849, 7255, 7911, 6311, 3516, 1596, 2017, 4393, 6746, 6972,
-    4261, -440, -4996, -7321, -6665, -4159, -2029, -1882, -3469, -5056, -5023, -3183,
-    -704, 1109, 1950, 2637, 4234, 6970, 9859, 11359, 10545, 7777, 4285, 1060,
-    -1872, -5108, -8802, -11962, -12941, -10799, -6316, -1616, 1357, 2171, 1922, 2122,
-    3596, 6171, 9018, 11121, 11692, 10513, 8012, 4873, 1508, -2028, -5636, -8853,
-    -11061, -11903, -11398, -9751, -7212, -4054, -537, 3109, 6467, 8754, 9241, 8082,
-    6513, 5798, 5912, 5487, 3216, -842, -5306, -8525, -9456, -7933, -4725, -1421,
-    262, -379, -2459, -4228, -4474, -3267, -1528, -44, 1124, 2526, 4690, 7407,
-    9531, 9616, 7036, 2555, -2214, -5930, -8138, -8987, -8634, -7027, -4123, -233,
-    3789, 6702, 7473, 6073, 3707, 1986, 1599, 1734, 884, -1703, -5288, -8175,
-    -8971, -7453, -4490, -1221, 1772, 4626, 7686, 10856, 13411, 14353, 12970, 9276,
-    4157, -907, -4584, -6437, -6990, -6991, -6655, -5764, -4413, -3336, -3277, -4112,
-    -4759, -4014, -1466, 2281, 6119, 9140, 11031, 11947, 12039, 11097, 8735, 4946,
-    405, -3806, -6764, -8055, -7821, -6738, -5821, -5867, -6756, -7389, -6548, -3913,
-    -245, 3373, 6346, 8691, 10588, 11972, 12484, 11722, 9546, 6278, 2586, -894,
-    -3894, -6496, -8817, -10733, -11822, -11529, -9480, -5905, -1797, 1573, 3622, 4931,
-    6573, 8865, 10854, 11091, 8869, 4774, 271, -3138, -4607, -4252, -2953, -1695,
-    -890, -327, 187, 276, -756, -3053, -5678, -7057, -6063, -2866, 1137, 4301,
-    5909, 6548, 7263, 8221, 8255, 5936, 1200, -4129, -7518, -7572, -4963, -1817,
-    -170, -621, -2033, -2440, -586, 3002, 6297, 7257, 5325, 1673, -1934, -4549,
-    -6465, -8365, -10171, -10783, -8988, -4645, 1022, 6237, 9767, 11369, 11438, 10428,
-    8562, 5915, 2669, -639, -3124, -4005, -3287, -2013, -1657, -3063, -5827, -8621,
-    -10072, -9490, -7083, -3682, -216, 2800, 5361, 7617, 9465, 10573, 10729, 9974,
-    8357, 5770, 2223, -1798, -5485, -8234, -9909, -10596, -10343, -9283, -7794, -6208,
-    -4365, -1718, 1915, 5796, 8617, 9452, 8400, 6448, 4823, 4286, 4678, 4934,
-    3712, 399, -4284, -8674, -11284, -11743, -10812, -9582, -8545, -7257, -4778, -577,
-    4789, 9812, 12902, 13321, 11427, 8132, 4208, 76, -3888, -7024, -8547, -8119,
-    -6277, -4235, -3098, -3074, -3345, -2755, -801, 1832, 3666, 3553, 1695, -339,
-    -767, 921, 3441, 4697, 3469, 392, -2561, -3544, -2121, 467, 2156, 1457,
-    -1451, -4782, -6414, -5401, -2447, 984, 3880, 6012, 7292, 7209, 5112, 1021,
-    -3987, -8227, -10312, -9849, -7536, -4659, -2271, -577, 993, 3059, 5532, 7506,
-    7908, 6375, 3648, 1186, 193, 712, 1504, 950, -1638, -5424, -8713, -10250,
-    -9951, -8518, -6553, -4125, -1087, 2403, 5736, 8173, 9262, 9040, 7955, 6574,
-    5237, 3870, 2130, -166, -2695, -4765, -5893, -6277, -6619, -7357, -8054, -7641,
-    -5392, -1733, 1914, 4142, 4515, 3738, 3031, 3311, 4713, 6638, 8178, 8646,
-    7893, 6199, 3886, 1054, -2277, -5797, -8757, -10298, -10023, -8313, -6064, -3985,
-    -2045, 375, 3657, 7186, 9484, 9308, 6743, 3301, 873, 435, 1493, 2535,
-    2088, -275, -3514, -5646, -5084, -1946, 1775, 3553, 2209, -1195, -4229, -4942,
-    -3195, -475, 1465, 1953, 1655, 1686, 2477, 3436, 3618, 2677, 1162, -29,
-    -424, -237, 16, 111, 389, 1448, 3486, 5788, 6888, 5515, 1682, -3023,
-    -6386, -7106, -5681, -3912, -3406, -4317, -5307, -4728, -2041, 1690, 4630, 5615,
-    4986, 4159, 4372, 5703, 7112, 7326, 5802, 3012, -58, -2701, -4889, -6946,
-    -8883, -10097, -9821, -7897, -5089, -2589, -1139, -531, 168, 1869, 4770, 8143,
-    10736, 11533, 10348, 7815, 4782, 1660, -1692, -5469, -9313, -12201, -12993, -11227,
-    -7518, -3230, 310, 2411, 3062, 2610, 1546, 555, 480, 1926, 4724, 7821,
-    9819, 9747, 7528, 3904, -18, -3301, -5553, -6966, -7951, -8628, -8611, -7310,
-    -4541, -921, 2322, 4069, 4096, 3291, 3024, 4055, 5862, 7001, 6199, 3273,
-    -818, -4652, -7135, -7933, -7420, -6236, -4756, -2890, -476, 2095, 3792, 3706,
-    1992, -61, -1033, -542, 520, 863, -30, -1453, -2094, -1198, 685, 2008,
-    1408, -1176, -4330, -6053, -5040, -1485, 3019, 6384, 7237, 5705, 3173, 1124,
-    9, -879, -2464, -4869, -7253, -8529, -8171, -6475, -4247, -2271, -891, 98,
-    1191, 2713, 4525, 6146, 7141, 7414, 7153, 6525, 5406, 3428, 396, -3222,
-    -6306, -7833, -7794, -7302, -7596, -8801, -9711, -8811, -5581, -892, 3694, 7006,
-    8835, 9685, 10041, 9805, 8410, 5526, 1623, -2216, -5110, -6956, -8192, -9077,
-    -9320, -8451, -6520, -4359, -3100, -3278, -4221, -4356, -2328, 1859, 6678, 10094,
-    10924, 9459, 6986, 4762, 3244, 1999, 230, -2461, -5650, -8369, -9883, -10188,
-    -9755, -8860, -7279, -4661, -1076, 2858, 6293, 8569, 9418, 8927, 7340, 4824,
-    1466, -2412, -5946, -7930, -7508, -4788, -853, 2763, 4727, 4483, 2617, 660,
-    106, 1201, 2648, 2714, 795, -2048, -4035, -4126, -2761, -1435, -1566, -3423,
-    -5797, -6716, -4850, -560, 4327, 7844, 9169, 8834, 7914, 7068, 6195, 4815,
-    2698, 200, -2010, -3580, -4863, -6574, -8976, -11391, -12576, -11637, -8703, -4791,
-    -1081, 1818, 4076, 6244, 8592, 10728, 11821, 11251, 9128, 6252, 3552, 1414,
-    -560, -3156, -6735, -10707, -13814, -15029, -14218, -11949, -8785, -4896, -327, 4577,
-    9113, 12486, 14075, 13621, 11398, 8176, 4745, 1357, -2215, -5956, -9101, -10621,
-    -10223, -8699, -7256, -6566, -6439, -6142, -4875, -2208, 1570, 5410, 8065, 8932,
-    8384, 7283, 6246, 5367, 4415, 3091, 1169, -1322, -3967, -6159, -7579, -8379,
-    -8839, -8931, -8376, -7038, -5051, -2558, 425, 3696, 6548, 7985, 7356, 4760,
-    958, -2913, -5565, -5961, -3975, -808, 1572, 1851, 449, -828, -407, 1617,
-    3567, 3708, 1785, -812, -2316, -2073, -943, -438, -1447, -3613, -5713, -6592,
-    -5874, -3972, -1507, 1229, 4247, 7333, 9698, 10318, 8761, 5733, 2790, 1346,
-    1687, 2671, 2479, -11, -4222, -8203, -10100, -9516, -7492, -5324, -3510, -1773,
-    242, 2547, 4913, 7051, 8577, 9065, 8369, 6904, 5427, 4487, 4090, 3802,
-    3037, 1313, -1526, -5076, -8418, -10585, -11093, -10077, -7953, -5070, -1677, 1923,
-    5308, 8020, 9697, 10150, 9430, 7825, 5723, 3417, 1030, -1375, -3676, -5680,
-    -7219, -8199, -8581, -8340, -7426, -5763, -3343, -370, 2670, 5182, 6767, 7382,
-    7238, 6577, 5617, 4623, 3902, 3574, 3348, 2608, 870, -1734, -4432, -6364,
-    -7232, -7415, -7419, -7223, -6236, -3877, -199, 3989, 7472, 9109, 8329, 5571,
-    2327, 401, 636, 2190, 3174, 2222, -444, -3369, -5159, -5424, -4657, -3499,
-    -2218, -825, 553, 1561, 1933, 1822, 1739, 2053, 2526, 2399, 1020, -1525,
-    -4298, -6015, -5790, -3680, -730, 1572, 2205, 1348, 308, 552, 2538, 5332,
-    7323, 7406, 5597, 2706, -418, -3321, -5828, -7742, -8795, -8836, -7923, -6227,
-    -3902, -1151, 1657, 4047, 5688, 6600, 7097, 7542, 8095, 8624, 8787, 8248,
-    6885, 4793, 2083, -1241, -5075, -8859, -11595, -12408, -11174, -8591, -5625, -2865,
-    -286, 2504, 5763, 9204, 11964, 13112, 12376, 10387, 8083, 5833, 3220, -275,
-    -4490, -8542, -11456, -12715, -12288, -10412, -7470, -3970, -466, 2576, 4823, 6105,
-    6553, 6678, 7148, 8234, 9437, 9710, 8176, 4803, 529, -3297, -5785, -7062,
-    -7965, -9068, -9911, -9291, -6402, -1718, 3226, 6885, 8547, 8418, 7199, 5670,
-    4413, 3601, 2946, 2006, 662, -745, -1810, -2507, -3081, -3488, -3164, -1588,
-    913, 3104, 3796, 2890, 1467, 806, 1338, 2406, 2852, 1813, -732, -3827,
-    -5916, -5777, -3498, -601, 1066, 814, -370, -727, 847, 4067, 7649, 10197,
-    10890, 9610, 6693, 2642, -1958, -6352, -9719, -11557, -11993, -11528, -10392, -8284,
-    -4888, -549, 3754, 7087, 9067, 9752, 9340, 8205, 7005, 6344, 6180, 5739,
-    4162, 1237, -2507, -6220, -9141, -10783, -11047, -10260, -8929, -7302, -5235, -2546,
-    563, 3562, 6028, 7920, 9445, 10744, 11696, 11895, 10761, 7853, 3310, -1959,
-    -6638, -9712, -10937, -10701, -9511, -7612, -5028, -1935, 1065, 3132, 3810, 3527,
-    3383, 4277, 6151, 8072, 9039, 8696, 7342, 5405, 2994, -17, -3538, -6910,
-    -9080, -9265, -7540, -4810, -2135, -64, 1427, 2517, 3189, 3275, 2684, 1581,
-    425, -129, 353, 1524, 2220, 1353, -902, -2929, -2944, -582, 2751, 5052,
-    5273, 3911, 2380, 1807, 2191, 2444, 1289, -1645, -5384, -8231, -8949, -7541,
-    -5126, -3126, -2361, -2569, -2628, -1399, 1369, 4849, 7841, 9657, 10347, 10205,
-    9306, 7564, 5036, 1955, -1472, -5094, -8592, -11397, -12963, -13131, -12102, -10073,
-    -7024, -2966, 1644, 5852, 8757, 10162, 10690, 11126, 11625, 11561, 10173, 7287,
-    3415, -723, -4616, -7972, -10561, -12196, -12774, -12237, -10557, -7928, -4902, -2108,
-    306, 2801, 5852, 9212, 11880, 12840, 11816, 9371, 6388, 3466, 665, -2255,
-    -5303, -7905, -9167, -8622, -6716, -4498, -2813, -1818, -1168, -453, 589, 2060,
-    3869, 5737, 7362, 8551, 9069, 8450, 6273, 2791, -869, -3425, -4423, -4420,
-    -4222, -4084, -3673, -2631, -1039, 591, 1635, 1767, 1259, 934, 1592, 3262,
-    4976, 5381, 3751, 564, -2743, -4605, -4188, -1798, 1386, 4089, 5647, 6122,
-    5833, 4881, 3140, 589, -2430, -5239, -7033, -7156, -5464, -2588, 217, 1727,
-    1488, 32, -1594, -2557, -2602, -1879, -514, 1551, 4281, 7132, 9040, 9012,
-    6875, 3511, 313, -1710, -2510, -2896, -3856, -5754, -7948, -9183, -8538, -6159,
-    -3109, -481, 1375, 2868, 4576, 6650, 8630, 9685, 9173, 7221, 4811, 3065,
-    2230, 1463, -233, -2828, -5187, -6197, -5883, -5334, -5635, -6907, -8266, -8536,
-    -7011, -3798, 369, 4561, 8045, 10394, 11429, 11143, 9670, 7194, 3885, 15,
-    -3843, -6929, -8807, -9711, -10165, -10215, -9230, -6621, -2651, 1602, 5013, 7019,
-    7602, 7029, 5747, 4250, 2744, 962, -1412, -4060, -5968, -6263, -5047, -3252,
-    -1699, -416, 1051, 2798, 4143, 4100, 2269, -630, -3059, -3578, -1772, 1394,
-    4004, 4239, 1541, -2806, -6240, -6535, -3350, 1603, 5987, 8523, 9362, 9025,
-    7380, 3910, -1148, -6263, -9454, -9727, -7788, -5409, -4048, -3777, -3312, -1171,
-    2843, 7059, 8965, 7191, 2799, -1356, -2762, -1114, 1662, 3171, 2459, 456,
-    -1247, -1937, -2213, -3097, -4894, -6858, -7766, -6760, -3913, -281, 2650, 3909,
-    3767, 3453, 3958, 5053, 5558, 4565, 2298, -199, -2027, -3026, -3603, -4182,
-    -4765, -4844, -3761, -1426, 1195, 2518, 1627, -717, -2452, -1813, 1237, 4950,
-    7126, 6692, 4372, 1992, 1035, 1559, 2301, 1754, -726, -4524, -8103, -9702,
-    -8185, -3804, 1717, 6199, 8422, 8590, 7390, 4921, 949, -3869, -7597, -8366,
-    -6125, -2826, -757, -704, -1544, -1382, 909, 4807, 8328, 9196, 6372, 897,
-    -4700, -8081, -8501, -6835, -4434, -2021, 448, 3070, 5341, 6242, 5013, 1863,
-    -2024, -5206, -6817, -6895, -6031, -4739, -3041, -593, 2726, 6230, 8462, 8057,
-    4851, 201, -3893, -6197, -6922, -7156, -7642, -8055, -7373, -4966, -1423, 1681,
-    2969, 2432, 1501, 1909, 4279, 7623, 10072, 10134, 7541, 3212, -1496, -5656,
-    -9110, -12015, -14144, -14727, -13070, -9238, -4073, 1316, 5907, 8812, 9478, 8130,
-    5769, 3342, 968, -1682, -4233, -5369, -4187, -1634, -74, -1153, -4171, -6644,
-    -6368, -3019, 1789, 5580, 6315, 3394, -1930, -7061, -9400, -7795, -3087, 2590,
-    7168, 9684, 10310, 9539, 7387, 3485, -1988, -7629, -11379, -12000, -9978, -6894,
-    -3955, -1239, 1708, 4762, 6872, 6791, 4143, -91, -4054, -6125, -5927, -4484,
-    -3313, -3121, -3257, -2427, -17, 3255, 5932, 6987, 6448, 5035, 3360, 1511,
-    -748, -3533, -6559, -9113, -10227, -9052, -5380, 9, 5556, 9649, 11320, 10436,
-    7440, 3118, -1449, -4974, -6362, -5245, -2239, 1314, 3991, 4993, 4509, 3459,
-    2682, 2197, 1258, -750, -3476, -5689, -6227, -4839, -2253, 364, 1971, 2020,
-    729, -854, -1341, 68, 2931, 5832, 7384, 7034, 5070, 2072, -1503, -5210,
-    -8261, -9543, -8257, -4763, -738, 1822, 2134, 1298, 1298, 3150, 5908, 7476,
-    6390, 2932, -1266, -4536, -6241, -6898, -7456, -8296, -8697, -7315, -3489, 1726,
-    5922, 7012, 4781, 880, -2605, -4540, -4906, -4035, -2050, 883, 4067, 6321,
-    6688, 5100, 2389, -313, -2287, -3516, -4465, -5575, -6835, -7673, -7250, -5008,
-    -1171, 3147, 6433, 7673, 7037, 5738, 5036, 5160, 5081, 3412, -333, -5166,
-    -9199, -10798, -9427, -5697, -853, 3773, 7062, 8236, 6977, 3570, -1057, -5511,
-    -8363, -8697, -6524, -2784, 1144, 4141, 5768, 6145, 5507, 3914, 1361, -1874,
-    -5037, -7053, -6983, -4591, -697, 3001, 4781, 3978, 1441, -1146, -2603, -3044,
-    -3383, -4090, -4521, -3580, -1052, 1807, 3145, 2096, -420, -2444, -2558, -852,
-    1460, 3196, 3947, 3891, 3176, 1674, -713, -3617, -6097, -6987, -5486, -1763,
-    2783, 5994, 6166, 3284, -779, -3477, -3345, -886, 2070, 3834, 3924, 3066,
-    2396, 2562, 3226, 3229, 1421, -2281, -6483, -9119, -8976, -6516, -3159, 153,
-    3457, 6814, 9230, 9074, 5784, 969, -2518, -2764, -186, 3010, 4547, 3468,
-    414, -2964, -4968, -4794, -3056, -1404, -1325, -2963, -4967, -5559, -3907, -653,
-    2742, 5149, 6378, 6851, 6855, 6244, 4824, 2866, 1036, -213, -1091, -2202,
-    -3871, -5750, -7034, -7019, -5545, -3159, -898, 281, 201, -336, -178, 1142,
-    2967, 4111, 3920, 2807, 1851, 1887, 2815, 3580, 2881, 243, -3348, -5910,
-    -5900, -3445, -233, 1853, 2082, 1094, 84, -128, 542, 1588, 2253, 1933,
-    554, -1369, -3139, -4364, -4947, -4595, -2648, 1192, 5854, 8939, 8308, 3965,
-    -1644, -5391, -5768, -3749, -1621, -1065, -2028, -3047, -2494, 146, 3722, 6012,
-    5224, 1372, -3661, -7491, -8784, -7630, -4719, -567, 4351, 9025, 11911, 11795,
-    8659, 3740, -1239, -5007, -7226, -8315, -8819, -8785, -7656, -4833, -476, 4164,
-    7267, 7580, 5402, 2651, 1683, 3515, 6850, 8968, 7882, 3911, -770, -3987,
-    -5037, -4706, -4311, -4736, -5914, -6794, -5983, -2966, 1093, 4031, 4482, 3005,
-    1404, 1083, 2217, 4211, 6413, 8182, 8697, 7255, 3875, -561, -4803, -7753,
-    -8658, -7255, -4107, -673, 1408, 1456, 269, -548, 132, 2183, 4525, 6118,
-    6749, 6968, 7342, 7770, 7512, 5871, 2819, -963, -4560, -7279, -8828, -9199,
-    -8400, -6256, -2570, 2307, 7029, 9649, 8876, 5155, 512, -2862, -4070, -3841,
-    -3557, -3875, -4099, -2878, 324, 4299, 6707, 5881, 2250, -1876, -3984, -3094,
-    -312, 2052, 2141, -107, -2901, -4003, -2547, 302, 2435, 2510, 743, -1613,
-    -3257, -3452, -2199, -134, 1853, 3162, 3676, 3457, 2511, 1135, 258, 841,
-    2653, 3969, 2924, -780, -5585, -9339, -10649, -9339, -6263, -2932, -775, -135,
-    86, 1376, 4084, 7060, 8822, 8803, 7414, 5281, 2821, 393, -1621, -3038,
-    -3995, -4701, -5292, -6003, -7225, -9006, -10504, -10271, -7361, -2239, 3394, 7663,
-    9534, 9133, 7342, 5065, 2690, 99, -2835, -5733, -7668, -7676, -5460, -1850,
-    1325, 2131, -184, -4444, -8162, -9260, -7437, -4003, -471, 2626, 5599, 8542,
-    10631, 10606, 7947, 3502, -1145, -4939, -7895, -10310, -11683, -10775, -6919, -1151,
-    4147, 6755, 5906, 2582, -1018, -2508, -690, 3377, 6761, 6740, 2952, -2428,
-    -6608, -8220, -7725, -6366, -5032, -3854, -2393, -150, 2766, 5313, 6126, 4675,
-    1788, -1096, -3036, -3825, -3432, -1750, 896, 3353, 4132, 2420, -1416, -6079,
-    -9861, -11161, -9137, -4336, 1363, 5828, 7964, 8087, 7164, 5789, 3857, 996,
-    -2752, -6583, -9160, -9343, -7021, -3434, -563, 113, -1393, -3616, -4662, -3461,
-    -344, 3373, 6355, 8011, 8532, 8373, 7681, 6174, 3525, -116, -3955, -7022,
-    -8882, -9870, -10483, -10520, -9013, -5263, 24, 4800, 7071, 6436, 4406, 3246,
-    4250, 6744, 8506, 7419, 3133, -2578, -7181, -9270, -9301, -8675, -8313, -8156,
-    -7701, -6623, -4837, -2326, 763, 3891, 6255, 7291, 6995, 5794, 4224, 2797,
-    1938, 1749, 1713, 832, -1656, -5524, -9467, -11879, -11904, -9942, -7250, -4968,
-    -3324, -1627, 962, 4481, 7858, 9516, 8448, 4920, 312, -3695, -5957, -6274,
-    -5278, -3977, -3151, -2927, -2824, -2288, -1245, -156, 468, 530, 373, 480,
-    1207, 2645, 4479, 5921, 6000, 4152, 606, -3763, -7831, -10398, -10310, -6999,
-    -1307, 4422, 7592, 7164, 4395, 1768, 1058, 2175, 3587, 3750, 2317, 236,
-    -1181, -1402, -1044, -1204, -2432, -4276, -5725, -5979, -4848, -2589, 424, 3814,
-    7039, 9247, 9460, 7167, 2956, -1439, -4023, -3843, -1688, 472, 887, -837,
-    -3659, -5989, -6760, -5935, -4249, -2493, -930, 772, 3089, 6014, 8730, 9907,
-    8530, 4685, -368, -4985, -8124, -9627, -9703, -8416, -5875, -2784, -412, 292,
-    -432, -1304, -1070, 505, 2603, 4169, 4780, 4838, 5016, 5491, 5680, 4714,
-    2168, -1650, -5937, -9663, -11651, -10879, -7265, -2256, 1808, 3370, 2841, 2048,
-    2521, 4354, 6519, 7932, 8118, 7151, 5356, 3125, 786, -1515, -3774, -5922,
-    -7686, -8711, -8750, -7699, -5509, -2216, 1854, 5926, 8900, 9821, 8493, 5813,
-    3385, 2428, 2787, 3015, 1675, -1291, -4442, -6118, -5845, -4568, -3623, -3550,
-    -3799, -3356, -1585, 1393, 4822, 7667, 9016, 8461, 6318, 3421, 554, -1955,
-    -4077, -5600, -6061, -5277, -3795, -2518, -1774, -933, 856, 3508, 5697, 5822,
-    3432, -146, -2574, -2159, 841, 4337, 5923, 4567, 1078, -2835, -5813, -7310,
-    -7305, -6014, -3896, -1581, 519, 2448, 4395, 6152, 7073, 6585, 4694, 1976,
-    -726, -2590, -3043, -2060, -308, 1146, 1437, 312, -1883, -4386, -6161, -6144,
-    -3828, 178, 4240, 6621, 6598, 4868, 2904, 1798, 1502, 1058, -393, -2701,
-    -4691, -5062, -3428, -646, 1757, 2552, 1485, -641, -2430, -2666, -974, 1991,
-    4924, 6598, 6442, 4673, 1988, -885, -3435, -5322, -6257, -6089, -5031, -3626,
-    -2294, -930, 871, 3071, 4801, 4933, 3155, 451, -1482, -1389, 745, 3712,
-    5801, 5789, 3641, 409, -2592, -4673, -5931, -6686, -6906, -6233, -4436, -1729,
-    1322, 4072, 6003, 6801, 6392, 4955, 2929, 1006, -36, 245, 1511, 2669,
-    2566, 830, -1907, -4505, -5985, -5874, -4257, -1804, 374, 1242, 566, -806,
-    -1501, -644, 1476, 3622, 4533, 3852, 2362, 1320, 1404, 2179, 2504, 1484,
-    -907, -3910, -6474, -7693, -7070, -4731, -1473, 1520, 3247, 3328, 2073, 285,
-    -1014, -967, 618, 2924, 4443, 3962, 1565, -1236, -2488, -1259, 1574, 3872,
-    3801, 1206, -2264, -4377, -3879, -1254, 1758, 3356, 2734, 411, -2252, -3958,
-    -4209, -3381, -2192, -1086, -34, 1193, 2673, 4227, 5551, 6367, 6479, 5739,
-    4047, 1498, -1377, -3596, -4215, -3095, -1218, -59, -438, -1930, -3349, -3757,
-    -3040, -1701, -334, 722, 1463, 2159, 3183, 4708, 6475, 7865, 8208, 7114,
-    4652, 1405, -1666, -3648, -4202, -3726, -2976, -2523, -2556, -3048, -3813, -4336,
-    -3793, -1586, 2005, 5753, 8237, 8761, 7740, 6272, 5287, 4831, 4033, 1908,
-    -1528, -4850, -6159, -4680, -1559, 978, 1310, -567, -3359, -5479, -5770, -3789,
-    30, 4361, 7481, 8252, 6819, 4318, 1902, 60, -1267, -2203, -2738, -2843,
-    -2534, -1747, -336, 1632, 3555, 4384, 3170, -232, -4734, -8252, -8728, -5508,
-    -36, 4917, 7078, 6061, 3262, 593, -705, -456, 678, 1645, 1598, 501,
-    -748, -1015, 74, 1782, 2836, 2311, 117, -3005, -5774, -6917, -5927, -3494,
-    -1055, 283, 440, 117, 65, 659, 1917, 3571, 5028, 5511, 4511, 2161,
-    -794, -3377, -4807, -4883, -4207, -3899, -4692, -6089, -6573, -4916, -1380, 2372,
-    4535, 4368, 2468, 210, -1020, -475, 1575, 3934, 5170, 4505, 2241, -597,
-    -3002, -4470, -5026, -4981, -4742, -4685, -4998, -5475, -5460, -4157, -1207, 2842,
-    6638, 8705, 8303, 5874, 2816, 680, 237, 998, 1616, 1002, -761, -2546,
-    -3273, -2875, -2246, -2337, -3358, -4703, -5417, -4721, -2363, 1224, 5077, 8145,
-    9738, 9651, 8003, 5128, 1631, -1639, -3897, -4805, -4591, -3845, -3124, -2592,
-    -1888, -479, 1650, 3599, 4088, 2612, 82, -1767, -1666, 374, 3221, 5295,
-    5280, 2770, -1273, -4783, -5809, -3935, -627, 1904, 2317, 887, -994, -1928,
-    -1353, 307, 2088, 3159, 3241, 2547, 1476, 422, -227, -221, 208, 280,
-    -765, -2835, -4816, -5354, -3859, -822, 2656, 5459, 6746, 6098, 3740, 627,
-    -2011, -3427, -3746, -3565, -3219, -2491, -1030, 1007, 2794, 3298, 1998, -679,
-    -3490, -5004, -4386, -1832, 1640, 4848, 7001, 7753, 6945, 4533, 880, -3022,
-    -5869, -6824, -6099, -4749, -3768, -3229, -2270, -34, 3236, 6020, 6600, 4482,
-    855, -2271, -3412, -2304, 262, 2920, 4198, 3090, -265, -4416, -7386, -7922,
-    -6180, -3367, -867, 435, 406, -359, -852, -256, 1507, 3736, 5429, 5789,
-    4486, 1805, -1267, -3353, -3546, -2207, -816, -821, -2462, -4594, -5559, -4362,
-    -1349, 1964, 3832, 3459, 1555, -191, -378, 1130, 3207, 4299, 3442, 901,
-    -1892, -3213, -2306, -55, 1637, 1358, -771, -3355, -4904, -4761, -3207, -978,
-    1253, 3099, 4382, 4932, 4549, 3278, 1632, 327, -362, -857, -1709, -2808,
-    -3287, -2293, 201, 3259, 5465, 5609, 3320, -542, -4148, -5744, -4789, -2172,
-    648, 2647, 3498, 3227, 1970, 80, -1795, -2970, -3087, -2274, -1027, 89,
-    828, 1475, 2561, 4160, 5465, 5258, 2933, -907, -4783, -7203, -7343, -5352,
-    -2327, 151, 946, 195, -795, -613, 1165, 3804, 6133, 7359, 7391, 6648,
-    5637, 4503, 2875, 235, -3342, -6834, -8782, -8304, -5676, -2005, 1549, 4245,
-    5697, 5707, 4336, 2135, 129, -618, 411, 2844, 5569, 7257, 7007, 4800,
-    1518, -1545, -3440, -4067, -4001, -3798, -3430, -2385, -258, 2733, 5721, 7579,
-    7490, 5437, 2372, -212, -1164, -358, 1386, 2989, 3670, 3019, 910, -2325,
-    -5691, -7810, -7699, -5420, -2044, 1022, 2839, 3432, 3691, 4621, 6372, 7863,
-    7548, 4763, 414, -3668, -6045, -6491, -5789, -4991, -4786, -5217, -5684, -5233,
-    -3168, 331, 4098, 6629, 7109, 6027, 4806, 4654, 5531, 6177, 5222, 2421,
-    -1139, -3997, -5456, -5827, -5729, -5368, -4566, -3302, -1989, -1079, -488, 434,
-    2286, 4968, 7621, 9173, 8969, 7081, 4241, 1488, -415, -1506, -2590, -4431,
-    -6817, -8470, -8008, -5016, -264, 4863, 8953, 10832, 9879, 6506, 2222, -1158,
-    -2587, -2156, -635, 1078, 2110, 1773, 25, -2259, -3839, -4119, -3513, -2824,
-    -2395, -1917, -809, 1361, 4592, 8146, 10509, 10071, 6305, 388, -5424, -9184,
-    -10250, -9290, -7564, -6040, -4840, -3353, -1051, 1716, 3777, 4156, 2987, 1410,
-    643, 1218, 2867, 4761, 5771, 4925, 2068, -1843, -5330, -7414, -8050, -7629,
-    -6356, -4295, -1869, 79, 934, 987, 1291, 2745, 5226, 7579, 8490, 7501,
-    5302, 3081, 1501, 244, -1532, -4265, -7423, -9765, -10127, -8134, -4339, 183,
-    4403, 7650, 9541, 9773, 8142, 4861, 869, -2287, -3176, -1482, 1488, 3437,
-    2685, -509, -4159, -6241, -6261, -5261, -4486, -4261, -4015, -2995, -736, 2782,
-    6890, 10099, 10760, 8340, 4041, -141, -3031, -4865, -6396, -7747, -8342, -7736,
-    -6211, -4494, -3107, -2089, -1246, -501, 38, 320, 625, 1488, 3207, 5336,
-    6751, 6354, 3832, -163, -4413, -7649, -8954, -8149, -6049, -4118, -3438, -3776,
-    -3755, -2087, 1266, 5032, 7550, 7791, 5823, 2696, -70, -1294, -920, -106,
-    -335, -2146, -4676, -6449, -6571, -5135, -2672, 435, 3772, 6386, 6971, 4916,
-    1158, -2220, -3437, -2227, 116, 1712, 1293, -1024, -3756, -4973, -3723, -892,
-    1379, 1401, -703, -3142, -3797, -1595, 2937, 7956, 11149, 10899, 7203, 1645,
-    -3679, -7418, -9401, -10157, -10249, -9920, -8987, -6904, -3195, 1818, 6703, 9602,
-    9477, 6772, 3010, -116, -1430, -633, 1494, 3277, 3011, 94, -4536, -9093,
-    -12084, -12957, -12022, -10034, -7754, -5525, -3048, 289, 4607, 9017, 12022, 12525,
-    10501, 6832, 2705, -836, -3079, -3870, -3809, -3976, -5168, -7239, -9240, -10169,
-    -9541, -7316, -3639, 1022, 5552, 8444, 8811, 7224, 5349, 4559, 4803, 4775,
-    3124, -354, -4447, -7261, -7477, -5360, -2740, -1773, -3299, -6164, -8076, -7234,
-    -3390, 2201, 7537, 10726, 10713, 7697, 2957, -1907, -5754, -8121, -8975, -8519,
-    -7171, -5373, -3222, -449, 2976, 6265, 8075, 7453, 4518, 345, -3549, -5649,
-    -4987, -1909, 1612, 2985, 926, -3434, -7381, -8646, -6781, -3008, 848, 3348,
-    4022, 3546, 3322, 4405, 6505, 8091, 7675, 5025, 1160, -2658, -5720, -7760,
-    -8549, -7941, -6311, -4550, -3375, -2649, -1514, 772, 4104, 7518, 9760, 9984,
-    8218, 5430, 3040, 2044, 2290, 2570, 1504, -1461, -5667, -9601, -11682, -11067,
-    -8160, -4419, -1422, 226, 1213, 2722, 5297, 8395, 10887, 11831, 10888, 8291,
-    4646, 704, -2891, -5725, -7593, -8450, -8516, -8262, -7998, -7357, -5431, -1723,
-    3042, 7206, 9351, 9133, 7137, 4344, 1895, 950, 2038, 4279, 5627, 4416,
-    838, -3200, -5737, -6225, -5539, -4879, -4777, -4880, -4277, -2092, 1808, 6360,
-    9707, 10425, 8538, 5294, 1983, -864, -3104, -4243, -3558, -1122, 1596, 2596,
-    1017, -2011, -4241, -4099, -1821, 934, 2546, 2694, 2447, 3169, 5207, 7484,
-    8297, 6573, 2521, -2594, -7091, -9437, -8740, -5264, -566, 3211, 4640, 3856,
-    2238, 1296, 1774, 3461, 5498, 6795, 6529, 4615, 1823, -700, -2144, -2416,
-    -2004, -1653, -2036, -3310, -4703, -4730, -2303, 2093, 6416, 8458, 7367, 4001,
-    106, -2657, -3257, -1605, 1256, 3519, 3766, 2065, -163, -1524, -1835, -1929,
-    -2467, -3181, -3232, -2052, 296, 3313, 6312, 8489, 9059, 7629, 4470, 413,
-    -3521, -6390, -7501, -6678, -4548, -2388, -1305, -1304, -1135, 725, 4623, 9034,
-    11370, 9859, 5092, -144, -2822, -1912, 978, 3045, 2465, -547, -4333, -7113,
-    -7844, -6417, -3548, -518, 1432, 1873, 1460, 1334, 2218, 4013, 6092, 7715,
-    8209, 7101, 4470, 1209, -1323, -2166, -1399, -29, 664, -200, -2648, -5652,
-    -7439, -6518, -2923, 1522, 4483, 4966, 3996, 3451, 4267, 5739, 6398, 5378,
-    2983, 227, -1972, -3247, -3729, -3754, -3571, -3253, -2815, -2344, -1913, -1331,
-    -125, 2039, 4819, 7107, 7603, 5630, 1612, -3040, -6535, -7579, -6097, -3306,
-    -887, 239, 522, 1230, 3197, 5975, 8012, 7680, 4437, -583, -5013, -6610,
-    -4725, -742, 2947, 4569, 3810, 1394, -1738, -4699, -6450, -5974, -3052, 1182,
-    4780, 6314, 5805, 4457, 3569, 3584, 3936, 3585, 1805, -1239, -4443, -6340,
-    -5989, -3618, -561, 1452, 1264, -1002, -3853, -5154, -3426, 1010, 6014, 8966,
-    8557, 5608, 2251, 241, -183, -84, -710, -2487, -4837, -6736, -7457, -6945,
-    -5657, -4095, -2504, -974, 308, 1086, 1411, 1851, 3082, 5118, 6970, 7214,
-    5051, 943, -3637, -7080, -8483, -8024, -6735, -5811, -5781, -6136, -5791, -4086,
-    -1466, 874, 2129, 2709, 3829, 6164, 8862, 10017, 8280, 4073, -789, -4684,
-    -7324, -9353, -11029, -11572, -9927, -5998, -980, 3518, 6533, 8021, 8379, 7981,
-    7089, 5868, 4260, 1945, -1304, -5110, -8444, -10225, -10025, -8197, -5404, -2161,
-    1212, 4362, 6838, 8255, 8443, 7435, 5389, 2609, -486, -3482, -6058, -7853,
-    -8346, -7123, -4507, -1807, -625, -1611, -3849, -5532, -5315, -3099, 270, 3754,
-    6519, 7902, 7471, 5346, 2325, -604, -2979, -4975, -6717, -7570, -6413, -2813,
-    2058, 5842, 6565, 4040, -63, -3467, -4836, -4517, -4079, -4999, -7379, -9663,
-    -9687, -6376, -673, 5116, 8918, 9994, 8796, 6223, 3245, 923, 102, 683,
-    1331, 414, -2496, -6071, -8256, -7824, -5049, -1186, 2307, 4117, 3290, -196,
-    -4853, -8093, -7788, -3813, 1881, 6765, 9422, 9970, 9191, 7507, 4849, 1254,
-    -2708, -6176, -8581, -9870, -10234, -9727, -8187, -5456, -1628, 2804, 6969, 9852,
-    10778, 9855, 7922, 5918, 4237, 2703, 1047, -786, -2839, -5318, -8194, -10642,
-    -11287, -9366, -5592, -1583, 1589, 4023, 6122, 7475, 7097, 4807, 1925, 236,
-    351, 1334, 1902, 1646, 954, 82, -1223, -3100, -4936, -5652, -4661, -2429,
-    -119, 1226, 1243, 318, -677, -839, 249, 2194, 4030, 4922, 4764, 4124,
-    3601, 3241, 2556, 1069, -1194, -3690, -5767, -7006, -7230, -6355, -4398, -1699,
-    1055, 3208, 4569, 5351, 5642, 5089, 3310, 579, -2118, -3872, -4569, -4672,
-    -4366, -3202, -731, 2659, 5730, 7248, 6755, 4589, 1449, -1952, -5011, -7358,
-    -8939, -9750, -9387, -7087, -2569, 3082, 7612, 9041, 7099, 3348, -79, -1937,
-    -2351, -2187, -2073, -1923, -1216, 341, 2399, 4139, 4821, 4154, 2235, -670,
-    -4105, -7255, -9080, -8873, -6709, -3309, 481, 3969, 6533, 7656, 7350, 6379,
-    5676, 5327, 4304, 1477, -3097, -7970, -11383, -12450, -11386, -8918, -5741, -2413,
-    605, 3051, 4940, 6377, 7296, 7478, 6826, 5501, 3754, 1723, -484, -2586,
-    -4140, -4858, -4864, -4609, -4528, -4739, -4975, -4734, -3544, -1252, 1762, 4601,
-    6177, 5772, 3560, 700, -1254, -1375, -36, 1471, 2092, 1824, 1355, 1012,
-    301, -1416, -4022, -6639, -8451, -9241, -9048, -7648, -4780, -831, 3082, 5940,
-    7569, 8347, 8328, 7021, 4143, 307, -3331, -6059, -7966, -9327, -9913, -9151,
-    -6888, -3725, -550, 2125, 4302, 6096, 7344, 7576, 6259, 3148, -1336, -5939,
-    -8941, -9043, -6214, -1736, 2585, 5365, 6012, 4531, 1276, -2972, -6907, -9053,
-    -8581, -5944, -2622, -41, 1431, 2492, 3886, 5407, 5929, 4443, 1055, -3019,
-    -6275, -7718, -7068, -4634, -1245, 1859, 3552, 3555, 2654, 2011, 2192, 2837,
-    3182, 2718, 1364, -740, -3287, -5664, -7046, -6909, -5490, -3610, -1981, -705,
-    590, 2221, 4135, 5997, 7432, 8135, 7870, 6514, 4200, 1392, -1277, -3312,
-    -4620, -5485, -6252, -6927, -7064, -6070, -3719, -409, 3009, 5679, 7114, 7312,
-    6625, 5483, 4135, 2579, 794, -940, -2071, -2246, -1784, -1516, -2088, -3417,
-    -4894, -6009, -6607, -6577, -5570, -3323, -247, 2588, 4278, 4885, 5306, 6308,
-    7748, 8713, 8330, 6406, 3433, 181, -2687, -4833, -6287, -7310, -8063, -8282,
-    -7324, -4666, -518, 4021, 7470, 8807, 8022, 5964, 3638, 1557, -294, -1941,
-    -2982, -2818, -1365, 537, 1591, 1016, -874, -2995, -4300, -4316, -3137, -1193,
-    906, 2499, 3142, 2871, 2115, 1279, 433, -549, -1597, -2298, -2203, -1218,
-    330, 1956, 3253, 3893, 3576, 2212, 223, -1448, -1868, -887, 592, 1203,
-    179, -1999, -3953, -4429, -3120, -678, 1890, 3801, 4642, 4251, 2695, 402,
-    -1790, -2915, -2372, -302, 2464, 4908, 6458, 7244, 7695, 7807, 6830, 3886,
-    -991, -6409, -10372, -11592, -10165, -7119, -3448, 363, 4115, 7463, 9844, 10726,
-    9858, 7364, 3770, -69, -3285, -5445, -6699, -7401, -7540, -6668, -4500, -1565,
-    864, 1650, 707, -916, -1843, -1371, 191, 2021, 3570, 4892, 6296, 7742,
-    8661, 8353, 6544, 3570, 91, -3263, -6005, -7720, -8118, -7189, -5251, -2746,
-    -6, 2764, 5329, 7361, 8579, 8885, 8327, 6999, 5064, 2887, 988, -281,
-    -1061, -1911, -3335, -5295, -7116, -7860, -6857, -4083, -191, 3750, 6677, 7932,
-    7517, 6077, 4559, 3622, 3145, 2272, 134, -3293, -6952, -9360, -9549, -7500,
-    -3864, 474, 4541, 7339, 8197, 7235, 5320, 3360, 1589, -370, -2784, -5300,
-    -7146, -7692, -6703, -4240, -675, 3078, 5571, 5504, 2635, -1918, -6326, -9043,
-    -9337, -7188, -3046, 2203, 7213, 10520, 11198, 9327, 5781, 1536, -2854, -7114,
-    -10721, -12728, -12275, -9305, -4735, 116, 4225, 7118, 8701, 9133, 8838, 8312,
-    7630, 6211, 3342, -889, -5304, -8407, -9489, -8976, -7831, -6793, -6079, -5484,
-    -4499, -2495, 822, 4893, 8383, 9981, 9261, 6850, 3908, 1529, 387, 496,
-    1029, 603, -1782, -5801, -9830, -12079, -11776, -9382, -5872, -2032, 1663, 4843,
-    7233, 8804, 9742, 10163, 9912, 8688, 6335, 3033, -674, -3984, -6112, -6737,
-    -6323, -5893, -6304, -7564, -8805, -8879, -7088, -3535, 983, 5398, 8840, 10939,
-    11790, 11612, 10431, 8081, 4485, -81, -4972, -9357, -12428, -13616, -12779, -10263,
-    -6727, -2847, 863, 4037, 6434, 8002, 8846, 8960, 7990, 5461, 1427, -3112,
-    -6551, -7578, -5906, -2413, 1220, 3158, 2297, -919, -4470, -5935, -4224, -395,
-    3209, 4754, 4112, 2634, 1920, 2649, 4166, 4973, 3771, 393, -4058, -7943,
-    -10053, -10036, -8197, -5213, -2049, 245, 1109, 983, 1041, 2220, 4436, 6726,
-    7979, 7504, 5122, 1168, -3412, -7239, -9205, -9214, -8133, -6889, -5617, -3746,
-    -836, 2767, 6076, 8127, 8510, 7455, 5645, 3899, 2775, 2230, 1627, 175,
-    -2508, -6149, -9917, -12677, -13288, -11062, -6270, -223, 5350, 9224, 11171, 11674,
-    11302, 10283, 8446, 5433, 1105, -3990, -8481, -10759, -9992, -6780, -2853, -112,
-    297, -1553, -4421, -6454, -6159, -3276, 1127, 5464, 8560, 9982, 9836, 8619,
-    7174, 6266, 5810, 4630, 1396, -3969, -9885, -14205, -15718, -14653, -11976, -8472,
-    -4451, -55, 4368, 8201, 10761, 11593, 10659, 8263, 4776, 484, -4211, -8467,
-    -11075, -11142, -8836, -5456, -2627, -1221, -875, -454, 953, 3280, 5542, 6647,
-    6293, 5166, 4280, 4049, 4023, 3451, 2030, -4, -2322, -4756, -6941, -7976,
-    -6890, -3692, 216, 2946, 3575, 2724, 1877, 2261, 4199, 6995, 9150, 8964,
-    5626, 63, -5464, -8899, -9667, -8526, -6456, -4011, -1581, 279, 1228, 1697,
-    2652, 4595, 6902, 8292, 7969, 6317, 4552, 3711, 3791, 3708, 2150, -1286,
-    -5611, -9089, -10445, -9576, -7253, -4316, -1209, 1944, 5053, 7897, 10083, 11076,
-    10416, 8045, 4441, 339, -3686, -7295, -10106, -11564, -11304, -9603, -7289, -5085,
-    -3080, -904, 1691, 4529, 7208, 9327, 10402, 9819, 7303, 3573, 281, -1077,
-    -339, 1211, 1891, 752, -2080, -5726, -8957, -10543, -9758, -6869, -3051, 416,
-    2993, 5005, 7065, 9378, 11444, 12240, 10778, 6834, 1361, -3891, -7391, -8639,
-    -8134, -6755, -5285, -4300, -4050, -4210, -3911, -2331, 596, 4092, 7110, 8950,
-    9470, 8935, 7781, 6345, 4649, 2454, -340, -3368, -5947, -7545, -7956, -7062,
-    -4733, -1225, 2429, 4835, 5314, 4529, 3872, 4187, 5098, 5496, 4492, 1907,
-    -1834, -5889, -9029, -9910, -7828, -3439, 1436, 4975, 6515, 6666, 6407, 6138,
-    5515, 4025, 1684, -720, -1996, -1347, 936, 3493, 4786, 4114, 1831, -1287,
-    -4627, -7608, -9277, -8560, -5162, -103, 4845, 8335, 10153, 10978, 11588, 12141,
-    11909, 9688, 4769, -2150, -9027, -13679, -15153, -14053, -11717, -9158, -6682, -4155,
-    -1369, 1781, 5238, 8691, 11521, 12890, 12046, 8855, 4260, 134, -1775, -1203,
-    198, 28, -2929, -7660, -11676, -12853, -10823, -6906, -2915, 84, 2123, 3773,
-    5364, 6688, 7323, 7113, 6254, 4955, 3111, 463, -2846, -5903, -7425, -6787,
-    -4754, -3061, -3057, -4618, -6313, -6581, -4747, -1189, 3055, 6700, 8572, 8130,
-    5874, 3120, 1142, 355, 190, -408, -2277, -5428, -8783, -10602, -9616, -6076,
-    -1657, 1795, 3523, 4037, 4353, 5167, 6494, 7617, 7314, 4537, -648, -6692,
-    -11302, -12789, -10877, -6541, -1288, 3421, 6512, 7530, 6750, 5015, 3239, 1847,
-    553, -1236, -3554, -5329, -4973, -1914, 2365, 5091, 4320, 429, -4391, -7936,
-    -9239, -8420, -5907, -2177, 1941, 5182, 6447, 5624, 3780, 2454, 2577, 3893,
-    5255, 5457, 3902, 809, -2942, -6133, -7774, -7734, -6836, -6078, -5592, -4468,
-    -1756, 2429, 6819, 9838, 10427, 8363, 4335, -55, -2835, -2841, -700, 1501,
-    1749, -469, -3997, -7001, -8167, -7266, -4928, -1979, 1034, 3812, 5985, 7125,
-    7158, 6552, 5757, 4515, 2067, -1755, -5830, -8377, -8303, -5911, -2488, 504,
-    1959, 1446, -505, -2489, -2997, -1479, 1246, 3597, 4354, 3470, 2028, 1397,
-    2146, 3558, 4250, 3337, 1045, -1730, -4232, -6114, -7193, -7339, -6724, -5835,
-    -4998, -3940, -2074, 757, 3934, 6468, 7655, 7316, 5595, 2738, -862, -4474,
-    -7049, -7660, -6185, -3607, -1474, -775, -1230, -1651, -1014, 771, 2897, 4242,
-    4012, 2197, -317, -2198, -2515, -1343, 391, 1559, 1423, -97, -2274, -3714,
-    -3133, -488, 2653, 4165, 3020, 6, -3041, -4531, -3871, -1491, 1459, 3538,
-    3642, 1617, -1627, -4611, -6087, -5687, -4086, -2529, -1875, -1876, -1481, 45,
-    2301, 4074, 4381, 3139, 1098, -543, -563, 1604, 5117, 7801, 7499, 3742,
-    -1879, -6947, -9820, -10242, -8867, -6495, -3603, -293, 3416, 7123, 9874, 10655,
-    9189, 6185, 2734, -485, -3354, -5852, -7689, -8457, -8013, -6644, -4866, -3130,
-    -1681, -566, 303, 1182, 2474, 4450, 6752, 8274, 7886, 5502, 2358, 55,
-    -680, -271, 407, 679, 121, -1515, -3981, -6345, -7555, -7332, -6314, -5197,
-    -3934, -1909, 1230, 5060, 8591, 10778, 10919, 8895, 5254, 1038, -2626, -4938,
-    -5679, -5293, -4696, -4664, -5168, -5358, -4367, -2103, 825, 3742, 6176, 7622,
-    7638, 6512, 5443, 5470, 6148, 5753, 3050, -1314, -5365, -7501, -7407, -5590,
-    -2664, 638, 3200, 3916, 2590, 341, -1115, -695, 1350, 3717, 4956, 4281,
-    1878, -1283, -3894, -4853, -3810, -1448, 876, 2072, 2105, 1826, 1994, 2529,
-    2751, 2216, 1175, 320, 289, 1366, 3381, 5670, 7232, 7187, 5245, 1805,
-    -2304, -6124, -8788, -9721, -8829, -6487, -3323, -6, 2899, 5109, 6766, 8212,
-    9435, 9817, 8653, 5899, 2251, -1503, -4967, -7931, -10020, -10899, -10673, -9743,
-    -8183, -5570, -1638, 3040, 7176, 9529, 9514, 7389, 4233, 1681, 1127, 2709,
-    5028, 6065, 4537, 559, -4647, -9452, -12482, -13168, -11987, -10016, -7977, -5709,
-    -2643, 1262, 5248, 8393, 10265, 10886, 10271, 8336, 5285, 1887, -869, -2484,
-    -3300, -4154, -5650, -7692, -9618, -10667, -10337, -8470, -5264, -1322, 2469, 5353,
-    7120, 8022, 8302, 7875, 6512, 4176, 1099, -2320, -5509, -7722, -8402, -7725,
-    -6590, -5810, -5297, -4168, -1652, 2130, 6152, 9025, 9598, 7443, 3159, -1794,
-    -5795, -7868, -7953, -6592, -4465, -2156, -59, 1646, 2889, 3513, 3238, 1908,
-    -298, -2914, -5276, -6481, -5501, -1888, 3374, 7965, 9577, 7406, 2440, -3431,
-    -8377, -11044, -10760, -7897, -3909, -539, 1355, 2209, 3075, 4605, 6587, 8138,
-    8184, 6007, 1803, -3139, -7022, -8674, -8261, -6958, -5889, -5340, -4809, -3613,
-    -1397, 1704, 5118, 7920, 9101, 8132, 5511, 2688, 1140, 1275, 2144, 2225,
-    570, -2656, -6421, -9415, -10576, -9516, -6738, -3391, -534, 1509, 3125, 4842,
-    6835, 8842, 10279, 10367, 8431, 4482, -419, -4551, -6572, -6349, -4934, -3800,
-    -3914, -5156, -6374, -6106, -3628, 418, 4357, 6554, 6405, 4616, 2743, 2285,
-    3762, 6276, 8005, 7442, 4424, 78, -4133, -7267, -9069, -9680, -9455, -8829,
-    -7982, -6504, -3617, 1003, 6534, 11242, 13488, 12681, 9481, 5260, 1331, -1566,
-    -3316, -4126, -4197, -3638, -2620, -1503, -734, -598, -1051, -1750, -2221, -2083,
-    -1191, 344, 2318, 4566, 6896, 8823, 9455, 7824, 3637, -2130, -7381, -9914,
-    -8733, -4712, -74, 2982, 3566, 2458, 1433, 2029, 4504, 7597, 9329, 8381,
-    5049, 974, -2079, -3308, -3026, -2102, -1401, -1471, -2277, -3023, -2541, -265,
-    3018, 5543, 5829, 3735, 507, -2018, -2373, -216, 3355, 6211, 6363, 3258,
-    -1852, -6802, -9924, -10824, -10107, -8520, -6289, -3127, 1192, 6198, 10624, 13005,
-    12521, 9401, 4660, -438, -4775, -7600, -8707, -8486, -7629, -6637, -5556, -4186,
-    -2446, -487, 1475, 3281, 4739, 5582, 5650, 5174, 4777, 5069, 6102, 7183,
-    7193, 5248, 1242, -3995, -8994, -12224, -12748, -10681, -7160, -3742, -1523, -550,
-    79, 1525, 4364, 8098, 11312, 12429, 10662, 6491, 1320, -3334, -6447, -7623,
-    -7100, -5811, -5100, -5808, -7394, -8139, -6551, -2681, 1931, 5506, 7217, 7420,
-    7112, 7212, 7962, 8624, 7866, 4809, -53, -5031, -8433, -9624, -9070, -7633,
-    -5979, -4430, -2981, -1319, 963, 3897, 6881, 8951, 9360, 7957, 5176, 1866,
-    -964, -2569, -2944, -2862, -3218, -4181, -4984, -4587, -2615, 278, 2840, 3994,
-    3376, 1450, -710, -1869, -1187, 1278, 4495, 6934, 7333, 5248, 1154, -3807,
-    -8179, -10658, -10592, -8253, -4573, -516, 3330, 6633, 9054, 10274, 10221, 9040,
-    6790, 3406, -867, -5082, -7891, -8396, -6777, -4207, -2203, -1842, -3146, -4937,
-    -5475, -3638, 259, 4742, 8260, 10027, 10080, 8874, 6968, 4820, 2596, 150,
-    -2608, -5320, -7309, -8176, -8099, -7480, -6461, -4979, -3154, -1306, 484, 2556,
-    5179, 7922, 9749, 9801, 8027, 5057, 1635, -1703, -4544, -6471, -7270, -7181,
-    -6799, -6556, -6276, -5332, -3296, -433, 2447, 4610, 5846, 6393, 6593, 6685,
-    6785, 6843, 6538, 5326, 2775, -1035, -5374, -9100, -11127, -10900, -8655, -5289,
-    -1872, 891, 2919, 4599, 6394, 8414, 10178, 10770, 9462, 6368, 2498, -948,
-    -3389, -5006, -6217, -7170, -7711, -7580, -6531, -4447, -1649, 957, 2344, 2241,
-    1488, 1393, 2637, 4772, 6624, 7082, 5659, 2669, -897, -3832, -5396, -5744,
-    -5640, -5618, -5358, -3948, -858, 3220, 6467, 7021, 4232, -871, -6250, -10047,
-    -11328, -10041, -6627, -1850, 3139, 6952, 8452, 7258, 3847, -716, -5163, -8357,
-    -9568, -8674, -6141, -2798, 451, 2844, 3918, 3654, 2508, 1176, 168, -551,
-    -1519, -3264, -5649, -7623, -7723, -5092, -235, 5127, 9035, 10362, 9262, 6852,
-    4447, 2828, 1875, 764, -1333, -4518, -7963, -10464, -11284, -10549, -8871, -6646,
-    -3794, -278, 3201, 5237, 4770, 2240, -370, -873, 1521, 5721, 9633, 11412,
-    10184, 6134, 373, -5359, -9369, -10867, -10300, -8836, -7479, -6572, -5875, -4819,
-    -2735, 795, 5464, 10077, 13087, 13526, 11547, 8186, 4650, 1709, -522, -2434,
-    -4519, -6867, -8930, -9820, -9021, -6852, -4273, -2192, -933, -266, 199, 727,
-    1470, 2586, 4192, 6157, 7999, 9037, 8712, 6824, 3562, -607, -5035, -8941,
-    -11513, -12162, -10846, -8174, -5067, -2151, 619, 3693, 7219, 10576, 12648, 12570,
-    10262, 6346, 1738, -2628, -5883, -7397, -7105, -5664, -4129, -3323, -3381, -3744,
-    -3536, -2057, 776, 4252, 7098, 8103, 6796, 3757, 400, -1677, -1476, 849,
-    3994, 6180, 6120, 3611, -533, -4936, -8043, -8455, -5506, 63, 6033, 9725,
-    9559, 5938, 795, -3696, -6230, -6733, -6057, -5301, -5047, -4914, -3875, -1229,
-    2603, 6263, 8442, 8666, 7214, 4573, 1287, -1753, -3310, -2499, 362, 3757,
-    5904, 5799, 3554, 45, -3596, -6334, -7507, -7005, -5209, -2651, 248, 3125,
-    5531, 7064, 7695, 7807, 7738, 7293, 5821, 2847, -1383, -5917, -9572, -11443,
-    -11200, -9203, -6377, -3765, -1917, -594, 882, 2945, 5379, 7562, 9006, 9654,
-    9714, 9329, 8454, 6995, 4998, 2666, 233, -2174, -4522, -6719, -8475, -9354,
-    -9019, -7476, -5032, -2031, 1310, 4744, 7739, 9543, 9661, 8278, 6151, 4027,
-    2130, 215, -1971, -4284, -6189, -7092, -6676, -5053, -2707, -337, 1371, 2021,
-    1747, 1242, 1416, 2755, 4861, 6599, 6863, 5339, 2636, -276, -2717, -4483,
-    -5584, -5940, -5370, -3765, -1251, 1754, 4587, 6521, 7086, 6346, 4905, 3534,
-    2679, 2191, 1486, 50, -2031, -3899, -4394, -2940, -194, 2213, 2802, 1377,
-    -831, -2130, -1583, 542, 3260, 5629, 7080, 7308, 6159, 3766, 677, -2320,
-    -4583, -5854, -6187, -5752, -4717, -3216, -1311, 998, 3633, 6247, 8241, 9033,
-    8354, 6335, 3399, 98, -3038, -5674, -7795, -9554, -10896, -11321, -10132, -7003,
-    -2356, 2805, 7396, 10626, 12080, 11664, 9634, 6641, 3577, 1206, -193, -901,
-    -1458, -2277, -3442, -4820, -6262, -7648, -8735, -9021, -7904, -5095, -989, 3372,
-    6788, 8536, 8696, 7929, 6922, 5928, 4725, 2935, 394, -2680, -5738, -8110,
-    -9316, -9337, -8649, -7843, -7091, -5931, -3666, -84, 4125, 7674, 9451, 9183,
-    7507, 5452, 3754, 2497, 1274, -313, -2224, -3965, -4966, -5033, -4485, -3877,
-    -3571, -3483, -3225, -2433, -1019, 827, 2770, 4458, 5617, 6140, 6129, 5745,
-    4984, 3631, 1527, -1088, -3573, -5275, -5928, -5696, -4952, -4072, -3338, -2841,
-    -2344, -1365, 431, 2828, 5093, 6489, 6761, 6170, 5108, 3741, 1998, -198,
-    -2690, -5031, -6601, -6854, -5590, -3111, -118, 2611, 4539, 5500, 5596, 5013,
-    3895, 2306, 288, -2034, -4330, -6050, -6593, -5605, -3209, -8, 3131, 5390,
-    6293, 5888, 4704, 3449, 2572, 2052, 1573, 882, -44, -1168, -2550, -4220,
-    -5928, -7149, -7433, -6714, -5215, -3115, -426, 2769, 6052, 8761, 10340, 10587,
-    9602, 7633, 5014, 2151, -603, -3128, -5531, -7915, -10140, -11814, -12481, -11794,
-    -9579, -5896, -1148, 3889, 8291, 11353, 12840, 12950, 12064, 10512, 8456, 5900,
-    2785, -825, -4570, -7819, -9960, -10765, -10511, -9697, -8586, -6988, -4509, -1046,
-    2922, 6515, 8940, 9876, 9475, 8086, 6012, 3438, 516, -2549, -5437, -7703,
-    -8896, -8787, -7582, -5853, -4210, -2964, -2076, -1318, -409, 962, 3029, 5628,
-    8000, 9091, 8281, 5870, 2816, -20, -2388, -4479, -6406, -7923, -8578, -8044,
-    -6332, -3819, -1108, 1249, 3040, 4466, 5862, 7300, 8445, 8761, 7835, 5608,
-    2457, -851, -3455, -4923, -5572, -6115, -6819, -7039, -5783, -2828, 781, 3464,
-    4380, 3970, 3373, 3402, 4076, 4883, 5249, 4766, 3226, 700, -2364, -5258,
-    -7347, -8323, -8166, -6938, -4684, -1533, 2185, 5920, 9001, 10783, 10858, 9257,
-    6483, 3245, 48, -2992, -5938, -8649, -10614, -11157, -9854, -6820, -2732, 1430,
-    4747, 6690, 7286, 7046, 6687, 6727, 7159, 7419, 6760, 4789, 1759, -1635,
-    -4700, -7051, -8569, -9256, -9154, -8334, -6815, -4533, -1508, 1906, 5041, 7315,
-    8601, 9124, 9021, 8124, 6263, 3689, 1053, -1074, -2610, -3901, -5315, -6920,
-    -8459, -9482, -9501, -8189, -5604, -2278, 1017, 3691, 5614, 6989, 7976, 8437,
-    8021, 6486, 3977, 1059, -1535, -3305, -4276, -4938, -5795, -6872, -7638, -7433,
-    -6018, -3689, -942, 1886, 4636, 7084, 8845, 9536, 9003, 7363, 4910, 2062,
-    -616, -2485, -3086, -2436, -1114, -12, 94, -1067, -3132, -5293, -6637, -6476,
-    -4587, -1335, 2394, 5547, 7434, 8019, 7686, 6708, 5017, 2532, -368, -2865,
-    -4212, -4198, -3114, -1394, 606, 2542, 4002, 4567, 3965, 2184, -428, -3065,
-    -4617, -4218, -1889, 1322, 3925, 4851, 3926, 1772, -581, -2080, -2014, -322,
-    2343, 4996, 6878, 7716, 7516, 6271, 4010, 1085, -1781, -3911, -5140, -5832,
-    -6398, -6842, -6770, -5739, -3559, -323, 3665, 7860, 11406, 13289, 12776, 9911,
-    5646, 1424, -1600, -3204, -4119, -5361, -7339, -9432, -10395, -9295, -6215, -2209,
-    1399, 3792, 4941, 5346, 5554, 5860, 6271, 6599, 6532, 5741, 4076, 1750,
-    -760, -3082, -5220, -7351, -9328, -10487, -10090, -7986, -4784, -1349, 1781, 4529,
-    6968, 9070, 10687, 11586, 11393, 9674, 6307, 1846, -2617, -6068, -8101, -8904,
-    -8865, -8312, -7521, -6692, -5776, -4403, -2212, 691, 3679, 6071, 7625, 8516,
-    8914, 8682, 7524, 5330, 2321, -1050, -4253, -6737, -8028, -7928, -6642, -4650,
-    -2424, -260, 1660, 3158, 4088, 4431, 4306, 3895, 3422, 3156, 3253, 3487,
-    3204, 1799, -638, -3154, -4551, -4290, -2864, -1355, -602, -676, -971, -718,
-    494, 2491, 4684, 6411, 7198, 6820, 5270, 2750, -334, -3456, -6085, -7726,
-    -7943, -6516, -3701, -254, 2933, 5319, 6846, 7667, 7833, 7251, 5808, 3440,
-    205, -3510, -6844, -8720, -8469, -6251, -2884, 638, 3432, 4789, 4377, 2667,
-    981, 753, 2448, 5159, 7292, 7708, 6321, 3834, 1089, -1355, -3273, -4670,
-    -5675, -6413, -6834, -6649, -5497, -3255, -204, 3096, 6085, 8353, 9594, 9557,
-    8174, 5759, 2982, 541, -1246, -2579, -3947, -5703, -7734, -9459, -10168, -9481,
-    -7584, -5057, -2455, -20, 2287, 4555, 6707, 8427, 9241, 8760, 6997, 4471,
-    1902, -292, -2239, -4307, -6596, -8730, -10100, -10248, -9081, -6861, -4073, -1241,
-    1305, 3524, 5525, 7297, 8576, 8988, 8310, 6615, 4227, 1548, -1075, -3390,
-    -5187, -6279, -6591, -6307, -5818, -5433, -5110, -4515, -3375, -1739, 145, 2092,
-    4042, 5849, 7143, 7499, 6758, 5140, 3032, 718, -1659, -3915, -5688, -6548,
-    -6246, -4832, -2538, 316, 3182, 5129, 5109, 2729, -1128, -4576, -5851, -4386,
-    -1017, 2686, 5279, 5967, 4755, 2339, -217, -1990, -2599, -2236, -1331, -235,
-    863, 1813, 2415, 2471, 1891, 742, -810, -2609, -4569, -6600, -8454, -9664,
-    -9657, -8004, -4650, -46, 4911, 9137, 11761, 12429, 11305, 8847, 5604, 2143,
-    -1057, -3803, -6285, -8788, -11230, -13013, -13387, -11992, -9065, -5225, -1140, 2630,
-    5676, 7765, 8876, 9166, 8855, 8113, 6998, 5465, 3439, 903, -2056, -5248,
-    -8351, -10875, -12240, -12059, -10409, -7806, -4875, -2005, 707, 3281, 5680, 7743,
-    9201, 9737, 9131, 7419, 4913, 2064, -716, -3160, -5188, -6892, -8392, -9605,
-    -10153, -9614, -7906, -5387, -2589, 133, 2670, 4987, 6984, 8450, 9105, 8692,
-    7146, 4725, 1899, -914, -3479, -5633, -7174, -7955, -8035, -7565, -6560, -4910,
-    -2702, -410, 1368, 2375, 2833, 3174, 3720, 4562, 5531, 6170, 5860, 4217,
-    1466, -1631, -4271, -6062, -7062, -7497, -7507, -7073, -6090, -4485, -2380, -153,
-    1711, 2925, 3546, 3788, 3716, 3169, 2037, 531, -856, -1674, -1818, -1517,
-    -1087, -682, -234, 410, 1295, 2232, 2842, 2759, 1856, 295, -1628, -3659,
-    -5558, -6930, -7235, -6121, -3813, -1090, 1168, 2470, 2842, 2643, 2355, 2436,
-    3122, 4238, 5259, 5673, 5293, 4167, 2268, -518, -4031, -7557, -10108, -11049,
-    -10448, -8819, -6602, -3893, -608, 3179, 7024, 10165, 11803, 11467, 9305, 6062,
-    2723, 26, -1829, -3124, -4324, -5760, -7447, -9078, -10158, -10251, -9201, -7174,
-    -4487, -1408, 1856, 4985, 7503, 8964, 9205, 8371, 6730, 4531, 2014, -589,
-    -3170, -5764, -8289, -10285, -11070, -10282, -8211, -5534, -2790, -187, 2197, 4274,
-    6011, 7439, 8434, 8618, 7679, 5773, 3426, 1033, -1395, -3916, -6308, -8212,
-    -9505, -10295, -10502, -9705, -7546, -4206, -357, 3275, 6222, 8267, 9383, 9718,
-    9451, 8547, 6735, 3895, 399, -3015, -5728, -7513, -8407, -8511, -7940, -6802,
-    -5082, -2652, 379, 3349, 5292, 5682, 4895, 3884, 3405, 3577, 4061, 4455,
-    4468, 3889, 2604, 700, -1511, -3638, -5387, -6580, -7056, -6603, -5082, -2647,
-    182, 2715, 4433, 5139, 4841, 3573, 1421, -1291, -3955, -5881, -6563, -5777,
-    -3567, -269, 3450, 6711, 8721, 9042, 7681, 5050, 1886, -928, -2690, -3226,
-    -2961, -2649, -2930, -4000, -5503, -6698, -6851, -5671, -3477, -925, 1468, 3570,
-    5461, 7135, 8391, 8961, 8671, 7491, 5517, 2929, -56, -3225, -6288, -8761,
-    -10014, -9621, -7739, -5072, -2372, 59, 2362, 4681, 6792, 8209, 8562, 7830,
-    6273, 4257, 2126, 116, -1718, -3484, -5227, -6738, -7627, -7642, -6878, -5661,
-    -4267, -2775, -1138, 713, 2799, 5009, 7036, 8446, 8891, 8277, 6724, 4452,
-    1766, -924, -3219, -4958, -6239, -7175, -7642, -7341, -6087, -3982, -1370, 1317,
-    3682, 5513, 6880, 8038, 9100, 9817, 9719, 8494, 6217, 3262, 93, -2871,
-    -5341, -7200, -8443, -9024, -8792, -7648, -5724, -3325, -730, 1885, 4316, 6289,
-    7625, 8336, 8424, 7670, 5787, 2874, -398, -3132, -4724, -5070, -4422, -3196,
-    -1866, -830, -234, 61, 303, 644, 1100, 1635, 2195, 2689, 2983, 2944,
-    2490, 1680, 813, 379, 715, 1624, 2394, 2370, 1519, 447, -144, 44,
-    851, 1907, 2810, 3153, 2571, 916, -1586, -4356, -6680, -7978, -7996, -6801,
-    -4621, -1692, 1766, 5433, 8833, 11396, 12599, 12086, 9786, 6056, 1711, -2253,
-    -5120, -6750, -7458, -7632, -7456, -6950, -6164, -5252, -4344, -3345, -1892, 407,
-    3571, 7011, 9727, 10887, 10322, 8514, 6116, 3457, 485, -2888, -6434, -9577,
-    -11665, -12288, -11436, -9457, -6858, -4053, -1180, 1847, 5037, 8046, 10223, 11011,
-    10335, 8614, 6430, 4157, 1879, -455, -2863, -5258, -7465, -9262, -10402, -10647,
-    -9819, -7900, -5142, -2050, 847, 3269, 5246, 6893, 8159, 8828, 8701, 7703,
-    5838, 3167, -84, -3470, -6489, -8824, -10359, -10987, -10515, -8857, -6300, -3479,
-    -1015, 868, 2365, 3803, 5299, 6704, 7758, 8264, 8069, 7004, 4971, 2161,
-    -905, -3674, -5935, -7810, -9344, -10193, -9804, -7925, -4892, -1430, 1770, 4322,
-    6146, 7321, 7939, 8007, 7445, 6159, 4135, 1508, -1407, -4106, -6025, -6815,
-    -6499, -5320, -3479, -1160, 1150, 2586, 2465, 991, -727, -1501, -909, 621,
-    2359, 3737, 4399, 4099, 2808, 899, -931, -1999, -1994, -1103, 122, 1100,
-    1577, 1759, 2068, 2698, 3395, 3614, 2900, 1137, -1378, -4011, -6002, -6798,
-    -6340, -5005, -3226, -1177, 1162, 3674, 5955, 7531, 8180, 8000, 7172, 5731,
-    3605, 862, -2110, -4720, -6462, -7157, -6978, -6322, -5590, -4984, -4387, -3429,
-    -1758, 646, 3379, 5814, 7413, 7942, 7509, 6485, 5286, 4092, 2684, 643,
-    -2187, -5354, -7938, -9051, -8347, -6174, -3340, -647, 1553, 3429, 5296, 7116,
-    8390, 8600, 7709, 6155, 4396, 2568, 603, -1453, -3360, -4873, -5912, -6517,
-    -6725, -6523, -5844, -4588, -2711, -376, 2010, 4020, 5482, 6475, 7042, 6998,
-    6078, 4261, 1864, -663, -2986, -4961, -6583, -7892, -8865, -9283, -8739, -6897,
-    -3867, -285, 3000, 5396, 6751, 7218, 7015, 6339, 5371, 4255, 3032, 1649,
-    66, -1652, -3325, -4730, -5685, -6113, -6090, -5776, -5225, -4250, -2564, -146,
-    2542, 4748, 5902, 5875, 4868, 3142, 962, -1276, -3037, -3889, -3748, -2865,
-    -1584, -146, 1316, 2699, 3892, 4762, 5124, 4720, 3345, 1052, -1739, -4337,
-    -6027, -6352, -5332, -3523, -1795, -842, -731, -889, -538, 772, 2939, 5440,
-    7591, 8792, 8750, 7617, 5826, 3685, 1117, -2109, -5856, -9404, -11836, -12626,
-    -11835, -9825, -6894, -3230, 894, 4981, 8375, 10492, 11070, 10298, 8705, 6809,
-    4809, 2599, 109, -2429, -4593, -6128, -7135, -7873, -8413, -8499, -7738, -5903,
-    -3099, 293, 3777, 6856, 9084, 10132, 9897, 8583, 6601, 4343, 1984, -515,
-    -3229, -6060, -8619, -10282, -10448, -8901, -6005, -2533, 780, 3574, 5826, 7597,
-    8860, 9513, 9446, 8576, 6916, 4666, 2191, -152, -2166, -3810, -5114, -6146,
-    -6985, -7568, -7548, -6461, -4171, -1116, 1960, 4530, 6498, 7970, 8939, 9228,
-    8627, 7010, 4419, 1154, -2206, -4998, -6797, -7576, -7580, -7104, -6353, -5407,
-    -4214, -2641, -614, 1758, 4178, 6269, 7691, 8248, 7992, 7229, 6293, 5216,
-    3669, 1319, -1705, -4694, -6747, -7310, -6460, -4752, -2820, -1033, 551, 1984,
-    3243, 4263, 5037, 5558, 5632, 4891, 3117, 559, -2123, -4162, -4942, -4132,
-    -1920, 797, 2712, 2968, 1836, 471, -74, 430, 1484, 2427, 2816, 2462,
-    1406, -81, -1585, -2761, -3464, -3720, -3665, -3459, -3117, -2328, -603, 2204,
-    5510, 8257, 9630, 9509, 8280, 6343, 3857, 822, -2677, -6282, -9280, -10811,
-    -10367, -8201, -5166, -2053, 899, 3839, 6755, 9225, 10697, 10897, 9939, 8128,
-    5752, 3048, 266, -2303, -4378, -5822, -6742, -7415, -8036, -8445, -8122, -6510,
-    -3445, 634, 4873, 8464, 10987, 12387, 12644, 11591, 9110, 5504, 1511, -2122,
-    -5088, -7526, -9634, -11354, -12356, -12233, -10713, -7855, -4133, -278, 3122, 5902,
-    8195, 10068, 11348, 11766, 11142, 9395, 6541, 2834, -1139, -4637, -7145, -8586,
-    -9207, -9338, -9210, -8831, -7912, -6022, -2985, 787, 4437, 7187, 8748, 9300,
-    9181, 8612, 7584, 5883, 3297, -57, -3560, -6348, -7838, -8024, -7310, -6145,
-    -4854, -3659, -2626, -1539, 8, 2204, 4673, 6610, 7367, 6951, 5967, 5097,
-    4575, 4060, 2981, 1039, -1494, -3870, -5293, -5380, -4315, -2633, -809, 964,
-    2658, 4099, 4872, 4606, 3410, 1957, 1031, 880, 1003, 617, -564, -1952,
-    -2491, -1516, 648, 2881, 4054, 3766, 2466, 988, -21, -363, -196, 190,
-    549, 742, 715, 435, -145, -1005, -1936, -2524, -2381, -1421, 52, 1569,
-    2825, 3820, 4709, 5539, 6078, 5895, 4641, 2317, -665, -3656, -6062, -7526,
-    -7939, -7339, -5835, -3588, -845, 2051, 4703, 6794, 8199, 8971, 9152, 8580,
-    6918, 3987, 132, -3738, -6598, -7930, -7993, -7476, -6858, -6121, -5014, -3514,
-    -1882, -304, 1371, 3421, 5822, 8122, 9715, 10146, 9186, 6825, 3366, -535,
-    -4114, -6894, -8786, -9845, -10039, -9313, -7753, -5527, -2726, 570, 4031, 7026,
-    8983, 9768, 9657, 8983, 7896, 6405, 4499, 2184, -466, -3229, -5751, -7732,
-    -9030, -9523, -8991, -7317, -4824, -2177, 168, 2321, 4634, 7105, 9259, 10582,
-    10868, 10112, 8333, 5696, 2684, -169, -2740, -5294, -7911, -10081, -11050, -10496,
-    -8712, -6216, -3389, -502, 2174, 4469, 6428, 8106, 9276, 9511, 8620, 6881,
-    4801, 2723, 740, -1129, -2822, -4258, -5313, -5799, -5573, -4722, -3517, -2114,
-    -416, 1603, 3494, 4451, 3973, 2364, 538, -630, -794, -174, 720, 1431,
-    1838, 2199, 2840, 3703, 4242, 3872, 2566, 959, -167, -535, -582, -1072,
-    -2420, -4247, -5561, -5529, -4204, -2507, -1389, -968, -502, 820, 3136, 5862,
-    8181, 9478, 9485, 8265, 6135, 3470, 497, -2667, -5743, -8202, -9601, -9995,
-    -9808, -9237, -7916, -5316, -1479, 2741, 6201, 8264, 9129, 9508, 9958, 10378,
-    10055, 8235, 4784, 389, -3885, -7218, -9336, -10364, -10575, -10219, -9401, -7966,
-    -5618, -2317, 1455, 4922, 7568, 9337, 10334, 10478, 9644, 8002, 5966, 3728,
-    1049, -2297, -5959, -9068, -10892, -11313, -10636, -9104, -6762, -3714, -301, 3044,
-    6007, 8375, 9900, 10345, 9686, 8185, 6186, 3884, 1340, -1310, -3753, -5663,
-    -6926, -7663, -8007, -7869, -6945, -5005, -2175, 1036, 4005, 6309, 7796, 8438,
-    8206, 7134, 5442, 3494, 1571, -282, -2147, -4014, -5695, -6956, -7645, -7690,
-    -7040, -5713, -3881, -1827, 244, 2288, 4267, 5947, 6933, 6979, 6172, 4799,
-    3069, 1059, -1067, -2938, -4177, -4722, -4847, -4830, -4673, -4171, -3228, -2005,
-    -764, 368, 1445, 2525, 3475, 3961, 3597, 2210, 74, -2070, -3313, -3075,
-    -1456, 827, 2857, 3939, 3799, 2565, 681, -1229, -2590, -3121, -2961, -2539,
-    -2308, -2481, -2926, -3268, -3160, -2568, -1809, -1246, -920, -516, 276, 1434,
-    2700, 3934, 5188, 6346, 6813, 5800, 3046, -776, -4426, -6892, -7894, -7807,
-    -7251, -6711, -6286, -5617, -4168, -1756, 1089, 3418, 4624, 4911, 4984, 5301,
-    5694, 5664, 4923, 3591, 1974, 245, -1645, -3832, -6302, -8729, -10507, -11057,
-    -10192, -8230, -5724, -3068, -390, 2233, 4533, 6076, 6545, 6050, 5206, 4822,
-    5319, 6242, 6393, 4635, 778, -4242, -9010, -12458, -14156, -14077, -12298, -8958,
-    -4353, 1016, 6399, 10788, 13172, 13063, 10873, 7615, 4096, 454, -3473, -7434,
-    -10604, -12138, -11783, -9915, -7156, -4102, -1285, 919, 2527, 3986, 5723, 7586,
-    8787, 8479, 6420, 3124, -493, -3554, -5394, -5641, -4374, -2292, -529, -73,
-    -1184, -3313, -5564, -7204, -7769, -6848, -4079, 429, 5647, 9770, 11092, 8994,
-    4295, -1265, -5966, -8782, -9438, -8042, -4781, -49, 5147, 9094, 10039, 7290,
-    1861, -4025, -8300, -10182, -10182, -9151, -7350, -4429, -241, 4459, 8210, 9831,
-    9238, 7364, 5345, 3820, 2846, 2176, 1448, 262, -1556, -3612, -5040, -5159,
-    -4046, -2355, -645, 900, 2052, 2207, 835, -1686, -3938, -4379, -2407, 1369,
-    5651, 9125, 10873, 10618, 8762, 6023, 2848, -761, -4721, -8285, -10274, -9990,
-    -7786, -4640, -1297, 2031, 5264, 8026, 9722, 9910, 8518, 5896, 2823, 380,
-    -570, -56, 830, 641, -1342, -4540, -7466, -8722, -7827, -5380, -2510, -87,
-    1717, 3220, 4661, 5882, 6563, 6622, 6273, 5670, 4648, 2891, 334, -2674,
-    -5571, -7811, -8920, -8503, -6421, -3076, 580, 3437, 4751, 4398, 2802, 753,
-    -781, -960, 476, 2926, 5213, 6308, 5898, 4326, 2090, -515, -3337, -6148,
-    -8565, -10103, -10218, -8449, -4813, -136, 4202, 7110, 8419, 8641, 8152, 6799,
-    4314, 924, -2615, -5482, -7143, -7343, -6074, -3656, -664, 2409, 5332, 7765,
-    8825, 7417, 3290, -2317, -7295, -10035, -10191, -8326, -5131, -1131, 3131, 6974,
-    9741, 10962, 10334, 7748, 3493, -1566, -6153, -9047, -9525, -7605, -4080, -303,
-    2376, 3267, 2590, 1076, -680, -2458, -4096, -5118, -4838, -2852, 574, 4576,
-    8113, 10377, 10980, 9910, 7441, 4068, 433, -2815, -5245, -6788, -7678, -8201,
-    -8474, -8376, -7651, -6067, -3590, -484, 2750, 5618, 7856, 9392, 10127, 9822,
-    8305, 5785, 2854, 112, -2229, -4354, -6490, -8521, -9948, -10206, -9065, -6783,
-    -3903, -887, 2074, 4910, 7421, 9209, 9858, 9114, 6963, 3683, -37, -3139,
-    -4588, -3951, -1677, 1147, 3295, 3795, 2180, -1267, -5427, -8750, -10066, -9147,
-    -6544, -2940, 1203, 5458, 9142, 11418, 11741, 10135, 7091, 3281, -649, -4171,
-    -6928, -8733, -9491, -9143, -7741, -5544, -2957, -302, 2287, 4694, 6570, 7367,
-    6700, 4720, 2091, -398, -2254, -3369, -3796, -3484, -2263, -55, 2870, 5794,
-    7629, 7226, 3980, -1479, -7109, -10332, -9629, -5606, -474, 3649, 6045, 7170,
-    7447, 6584, 4125, 442, -3086, -4935, -4464, -2211, 592, 2758, 3634, 3235,
-    2089, 881, 93, -163, -48, 224, 540, 930, 1457, 2020, 2151, 1130,
-    -1468, -5126, -8288, -9150, -6856, -2175, 2953, 6642, 8133, 7929, 7048, 6140,
-    5191, 3893, 2119, 17, -2223, -4509, -6681, -8333, -8946, -8212, -6204, -3246,
-    244, 3734, 6542, 8040, 7965, 6504, 4046, 983, -2196, -4721, -5763, -5001,
-    -3001, -916, 258, 193, -860, -2484, -4321, -5997, -7002, -6802, -5133, -2189,
-    1413, 4825, 7210, 8030, 7299, 5599, 3683, 1904, 8, -2390, -5110, -7251,
-    -7862, -6794, -4850, -3097, -2049, -1432, -594, 954, 3233, 5736, 7574, 7861,
-    6252, 3251, -55, -2670, -4192, -4771, -4722, -4286, -3692, -3263, -3291, -3736,
-    -4111, -3741, -2261, 77, 2580, 4619, 5994, 6796, 6955, 6048, 3665, 1,
-    -3983, -7018, -8210, -7389, -4992, -1749, 1557, 4231, 5751, 5855, 4602, 2389,
-    -118, -2200, -3352, -3386, -2338, -420, 1820, 3393, 3283, 1291, -1538, -3572,
-    -3908, -3072, -2395, -2720, -3740, -4459, -4120, -2654, -480, 1890, 4032, 5617,
-    6402, 6202, 4816, 2072, -1875, -6164, -9292, -9823, -7332, -2799, 1958, 5429,
-    7194, 7759, 7662, 6771, 4481, 598, -4013, -7762, -9383, -8731, -6620, -4037,
-    -1568, 497, 1799, 1927, 898, -520, -1151, -204, 2168, 5024, 7267, 8187,
-    7599, 5690, 2861, -348, -3345, -5646, -7022, -7504, -7245, -6356, -4851, -2786,
-    -412, 1803, 3425, 4364, 4934, 5526, 6174, 6467, 5923, 4464, 2502, 580,
-    -1044, -2458, -3832, -5114, -5996, -6146, -5515, -4492, -3719, -3607, -3911, -3763,
-    -2273, 737, 4503, 7778, 9584, 9640, 8258, 5939, 3054, -168, -3443, -6251,
-    -7926, -8046, -6802, -4945, -3231, -1854, -434, 1424, 3582, 5421, 6394, 6488,
-    6128, 5699, 5179, 4206, 2467, 44, -2556, -4706, -6052, -6668, -6839, -6710,
-    -6174, -5114, -3693, -2324, -1312, -547, 432, 2070, 4437, 7087, 9158, 9680,
-    8063, 4518, 79, -3920, -6559, -7673, -7587, -6616, -4872, -2479, 128, 2209,
-    3060, 2386, 476, -1897, -3751, -4235, -2978, -316, 2732, 4841, 4989, 3029,
-    -210, -3411, -5542, -6311, -5957, -4698, -2481, 653, 4037, 6371, 6461, 4084,
-    229, -3558, -6164, -7481, -8150, -8742, -9086, -8346, -5819, -1782, 2472, 5520,
-    6836, 6990, 6857, 6668, 5837, 3654, 76, -4125, -7860, -10335, -11303, -10901,
-    -9337, -6693, -3048, 1152, 4846, 6688, 5919, 3105, -59, -1851, -1605, 125,
-    2316, 4253, 5635, 6181, 5428, 3074, -528, -4316, -7070, -8126, -7682, -6453,
-    -5020, -3409, -1254, 1620, 4769, 7278, 8370, 7939, 6551, 4961, 3612, 2486,
-    1309, -138, -1853, -3640, -5256, -6515, -7268, -7301, -6371, -4420, -1800, 840,
-    2989, 4603, 5924, 6977, 7361, 6649, 4948, 2926, 1201, -201, -1717, -3606,
-    -5539, -6836, -7019, -6096, -4407, -2325, -142, 1920, 3670, 4928, 5482, 5101,
-    3747, 1834, 207, -333, 365, 1615, 2398, 2146, 1129, 66, -680, -1530,
-    -3219, -5793, -8096, -8426, -5934, -1469, 2991, 5813, 6725, 6546, 6121, 5606,
-    4638, 2942, 685, -1649, -3549, -4671, -4925, -4469, -3589, -2471, -1085, 677,
-    2709, 4587, 5743, 5769, 4579, 2407, -258, -2765, -4433, -4744, -3530, -1093,
-    1795, 4110, 5030, 4420, 2907, 1403, 447, -12, -218, -137, 494, 1661,
-    2749, 2883, 1627, -623, -2938, -4476, -4883, -4233, -2753, -672, 1718, 3971,
-    5571, 6194, 5897, 5040, 3957, 2728, 1293, -193, -1257, -1475, -992, -594,
-    -1138, -2803, -4878, -6262, -6224, -4815, -2688, -562, 1237, 2857, 4580, 6344,
-    7575, 7581, 6202, 4081, 2203, 1102, 509, -236, -1504, -3071, -4393, -5032,
-    -4843, -3906, -2414, -611, 1274, 3076, 4642, 5746, 6115, 5640, 4512, 3058,
-    1455, -331, -2243, -3866, -4582, -4108, -2869, -1815, -1758, -2740, -3950, -4257,
-    -2996, -396, 2652, 5255, 6993, 7822, 7718, 6594, 4603, 2305, 357, -1013,
-    -2069, -3072, -3847, -3982, -3371, -2389, -1464, -617, 444, 1816, 3153, 3993,
-    4223, 4132, 4015, 3818, 3206, 1937, 155, -1634, -2834, -3060, -2321, -1011,
-    240, 833, 484, -539, -1452, -1362, 99, 2399, 4409, 5188, 4569, 3019,
-    1026, -1216, -3528, -5323, -5720, -4172, -945, 3064, 6894, 9892, 11674, 11988,
-    10752, 8157, 4643, 742, -2972, -5872, -7418, -7467, -6430, -4978, -3540, -2078,
-    -385, 1485, 3149, 4248, 4809, 5221, 5826, 6541, 6855, 6245, 4686, 2792,
-    1396, 885, 843, 380, -1113, -3453, -5791, -7218, -7299, -6176, -4273, -1926,
-    784, 3851, 6979, 9398, 10173, 8896, 6117, 2986, 371, -1677, -3545, -5270,
-    -6310, -6168, -5107, -4050, -3733, -4027, -4132, -3364, -1696, 391, 2428, 4276,
-    5984, 7447, 8253, 7885, 6132, 3347, 289, -2333, -4243, -5572, -6495, -6947,
-    -6683, -5593, -3913, -2128, -669, 354, 1178, 2156, 3412, 4632, 5231, 4800,
-    3440, 1635, -209, -2005, -3719, -4951, -5035, -3751, -1886, -889, -1723, -3970,
-    -6068, -6498, -4856, -1965, 933, 3107, 4646, 6001, 7252, 7803, 6807, 3995,
-    101, -3569, -6056, -7279, -7711, -7652, -6926, -5249, -2793, -285, 1441, 2015,
-    1755, 1391, 1520, 2148, 2713, 2592, 1694, 531, -320, -780, -1237, -1976,
-    -2763, -3059, -2602, -1710, -1021, -997, -1628, -2474, -2900, -2399, -866, 1283,
-    3274, 4316, 3927, 2119, -559, -3144, -4622, -4436, -2782, -403, 1926, 3750,
-    4862, 5059, 4105, 1955, -1071, -4340, -7123, -8802, -9056, -7997, -6128, -4042,
-    -2069, -254, 1351, 2482, 2902, 2837, 3013, 4085, 5926, 7533, 7711, 5947,
-    2740, -866, -4056, -6620, -8671, -10086, -10331, -8922, -6038, -2623, 223, 2023,
-    3137, 4246, 5646, 6974, 7546, 6913, 5167, 2807, 336, -2086, -4660, -7574,
-    -10515, -12519, -12498, -10129, -6347, -2842, -841, -211, 259, 1645, 3906, 6018,
-    7010, 6801, 6073, 5435, 4780, 3453, 965, -2445, -5909, -8511, -9848, -10068,
-    -9444, -7962, -5389, -1768, 2198, 5394, 7002, 7059, 6328, 5643, 5315, 5039,
-    4277, 2742, 593, -1751, -3959, -5961, -7750, -9072, -9408, -8367, -6089, -3197,
-    -351, 2111, 4069, 5326, 5591, 4835, 3569, 2602, 2420, 2760, 2776, 1688,
-    -602, -3363, -5489, -6218, -5590, -4255, -2789, -1160, 1059, 3871, 6290, 6790,
-    4542, 310, -3928, -6372, -6570, -5355, -3759, -2075, 36, 2614, 4759, 5084,
-    2956, -678, -3766, -4646, -3231, -841, 1064, 1984, 2315, 2440, 2114, 794,
-    -1557, -4140, -5838, -6055, -5119, -3948, -3282, -3076, -2517, -734, 2319, 5591,
-    7619, 7614, 5956, 3671, 1466, -676, -3083, -5711, -7961, -9078, -8675, -6901,
-    -4231, -1199, 1718, 4074, 5466, 5686, 4908, 3699, 2720, 2295, 2210, 1941,
-    1108, -242, -1775, -3207, -4473, -5584, -6389, -6533, -5670, -3733, -1045, 1798,
-    4212, 5908, 6978, 7639, 7830, 7091, 5007, 1854, -1306, -3349, -3997, -3971,
-    -4227, -5079, -6094, -6675, -6588, -5911, -4694, -2831, -298, 2590, 5204, 6885,
-    7307, 6699, 5716, 4960, 4468, 3645, 1808, -1142, -4507, -7233, -8578, -8508,
-    -7607, -6593, -5724, -4545, -2299, 1188, 4976, 7517, 7850, 6328, 4135, 2169,
-    482, -1245, -2934, -4002, -3983, -3132, -2340, -2461, -3689, -5447, -6809, -7074,
-    -6076, -4092, -1568, 1042, 3234, 4467, 4394, 3140, 1260, -647, -2261, -3489,
-    -4220, -4289, -3730, -2933, -2399, -2299, -2331, -2024, -1154, 113, 1404, 2372,
-    2757, 2365, 1116, -832, -3060, -5048, -6383, -6787, -5996, -3811, -473, 3006,
-    5160, 5086, 3278, 1336, 644, 1264, 2128, 2270, 1738, 1252, 1108, 637,
-    -1143, -4341, -7724, -9507, -8688, -5700, -1837, 1910, 5369, 8642, 11277, 12262,
-    10915, 7633, 3646, 119, -2439, -4066, -5027, -5735, -6646, -7867, -8802, -8481,
-    -6418, -3081, 591, 4036, 7294, 10465, 13173, 14680, 14460, 12579, 9607, 6231,
-    2921, -165, -3030, -5586, -7585, -8819, -9304, -9134, -8182, -6109, -2827, 1161,
-    5038, 8293, 10912, 12989, 14314, 14516, 13459, 11302, 8171, 4061, -781, -5501,
-    -8956, -10518, -10508, -9802, -9055, -8295, -7119, -5098, -2026, 1973, 6358, 10233,
-    12703, 13339, 12345, 10248, 7453, 4128, 455, -3134, -6020, -7719, -8144, -7624,
-    -6683, -5701, -4649, -3126, -733, 2491, 5943, 8734, 10119, 9790, 7959, 5235,
-    2263, -683, -3722, -6806, -9145, -9512, -7410, -3896, -949, 132, -321, -963,
-    -807, 172, 1537, 3089, 4845, 6510, 7295, 6425, 3800, 132, -3564, -6578,
-    -8679, -9752, -9439, -7284, -3330, 1501, 5763, 8315, 8855, 7784, 5721, 3237,
-    876, -871, -1800, -2163, -2498, -3203, -4229, -5137, -5450, -4982, -3842, -2149,
-    165, 3177, 6541, 9366, 10647, 9920, 7493, 4134, 602, -2587, -5172, -7065,
-    -8220, -8506, -7760, -6053, -3810, -1518, 689, 3009, 5536, 7984, 9932, 11141,
-    11447, 10487, 7858, 3707, -1056, -5259, -8168, -9651, -9857, -8991, -7378, -5481,
-    -3679, -2075, -531, 1195, 3391, 6210, 9351, 11974, 13175, 12637, 10684, 7756,
-    4052, -173, -4213, -7143, -8477, -8419, -7449, -5904, -4036, -2207, -667, 822,
-    2832, 5543, 8312, 10147, 10600, 10085, 9264, 8252, 6500, 3462, -676, -4898,
-    -7978, -9232, -8788, -7232, -5097, -2683, -237, 1894, 3460, 4590, 5745, 7254,
-    8921, 10127, 10342, 9478, 7758, 5352, 2269, -1351, -4958, -7724, -8995, -8621,
-    -6907, -4350, -1438, 1424, 3941, 5931, 7273, 7908, 7989, 7953, 8242, 8790,
-    8892, 7765, 5236, 1808, -1911, -5625, -9080, -11611, -12254, -10423, -6442, -1434,
-    3226, 6480, 7959, 8062, 7616, 7201, 6724, 5686, 3853, 1541, -712, -2585,
-    -4017, -4991, -5476, -5483, -4964, -3644, -1244, 1918, 4644, 5495, 3897, 670,
-    -2581, -4641, -5363, -5340, -5015, -4154, -2244, 587, 3165, 3983, 2472, -437,
-    -3015, -3978, -3085, -849, 1991, 4638, 6233, 6106, 4142, 845, -3012, -6736,
-    -9769, -11604, -11848, -10417, -7606, -3954, -69, 3451, 6075, 7469, 7676, 7145,
-    6473, 5964, 5358, 4020, 1494, -2042, -5824, -8980, -10974, -11667, -11144, -9573,
-    -7169, -4180, -865, 2458, 5362, 7424, 8443, 8519, 7878, 6679, 5038, 3134,
-    1109, -1114, -3707, -6488, -8687, -9381, -8248, -5836, -3092, -723, 994, 1983,
-    2237, 1973, 1719, 2070, 3272, 5076, 6901, 8070, 7907, 5872, 1882, -3354,
-    -8427, -11851, -12817, -11471, -8560, -4868, -955, 2717, 5639, 7403, 8010, 7938,
-    7759, 7626, 7129, 5694, 3175, 123, -2543, -4189, -4936, -5557, -6823, -8736,
-    -10248, -9863, -6804, -1837, 3077, 6138, 6904, 6232, 5158, 3990, 2488, 717,
-    -602, -651, 683, 2618, 3958, 3729, 1585, -2000, -5796, -8277, -8395, -6134,
-    -2419, 1490, 4576, 6304, 6587, 5640, 3771, 1199, -1912, -5165, -7767, -8820,
-    -7904, -5410, -2245, 793, 3381, 5506, 7049, 7633, 6941, 5180, 3155, 1756,
-    1287, 1274, 907, -337, -2452, -5041, -7517, -9225, -9658, -8734, -6822, -4366,
-    -1540, 1589, 4624, 6819, 7714, 7671, 7558, 7801, 7841, 6603, 3508, -960,
-    -5563, -9132, -11213, -12113, -12376, -12115, -10777, -7640, -2698, 2908, 7441, 9709,
-    9829, 8913, 7995, 7188, 5813, 3320, 53, -2906, -4656, -5249, -5573, -6504,
-    -8206, -10093, -11289, -11050, -8944, -4995, 161, 5335, 9225, 11007, 10631, 8717,
-    6237, 4119, 2798, 1882, 372, -2485, -6344, -9833, -11619, -11430, -10000, -8120,
-    -5911, -3085, 309, 3635, 6144, 7524, 7947, 7732, 7118, 6311, 5529, 4888,
-    4251, 3230, 1336, -1757, -5888, -10169, -13182, -13681, -11354, -6994, -1919, 2782,
-    6560, 9181, 10394, 9876, 7459, 3440, -1302, -5533, -8196, -8893, -7961, -6081,
-    -3796, -1309, 1357, 4056, 6289, 7268, 6392, 3843, 689, -1867, -3473, -4707,
-    -6034, -6881, -6086, -3364, -46, 1927, 1731, 295, -713, -368, 961, 2170,
-    2407, 1697, 959, 1356, 3307, 5888, 7310, 6238, 2819, -1554, -5394, -8018,
-    -9461, -9801, -8803, -6231, -2367, 1886, 5476, 7813, 8983, 9381, 9161, 8052,
-    5758, 2483, -993, -3818, -5637, -6710, -7546, -8451, -9329, -9769, -9255, -7414,
-    -4225, -105, 4204, 7867, 10227, 11033, 10538, 9328, 7852, 5993, 3201, -772,
-    -5237, -8804, -10430, -10236, -9259, -8397, -7643, -6296, -3762, -114, 3986, 7699,
-    10379, 11779, 12087, 11672, 10655, 8730, 5562, 1427, -2708, -5867, -7814, -9003,
-    -9835, -10139, -9460, -7700, -5269, -2607, 235, 3429, 6858, 9932, 11932, 12480,
-    11640, 9676, 6821, 3303, -489, -3998, -6707, -8391, -9120, -9039, -8189, -6594,
-    -4506, -2421, -704, 821, 2769, 5521, 8601, 10812, 11099, 9394, 6622, 3899,
-    1669, -404, -2751, -5118, -6567, -6338, -4800, -3439, -3690, -5622, -7763, -8294,
-    -6453, -2891, 1123, 4580, 6894, 7619, 6493, 3862, 781, -1553, -2497, -2060,
-    -536, 1664, 3738, 4414, 2584, -1751, -7224, -11873, -14258, -13986, -11457, -7336,
-    -2292, 2913, 7274, 9641, 9202, 6100, 1666, -2118, -3696, -2747, -150, 2703,
-    4552, 4526, 2232, -2031, -7152, -11554, -13962, -14016, -12237, -9461, -6282, -2934,
-    441, 3512, 5795, 6978, 7200, 6933, 6540, 5971, 4927, 3269, 1160, -1215,
-    -3885, -6901, -9914, -12148, -12875, -11925, -9717, -6893, -4014, -1469, 565, 2199,
-    3741, 5334, 6688, 7252, 6741, 5429, 3880, 2404, 826, -1241, -3916, -6798,
-    -9131, -10227, -9864, -8355, -6249, -3912, -1397, 1295, 3888, 5899, 7067, 7630,
-    8060, 8459, 8310, 6923, 4199, 899, -1912, -3733, -4954, -6307, -7994, -9396,
-    -9626, -8353, -6062, -3556, -1288, 820, 3005, 5230, 7125, 8259, 8422, 7653,
-    6091, 3864, 1132, -1805, -4504, -6583, -7933, -8705, -9007, -8631, -7167, -4498,
-    -1215, 1545, 2835, 2636, 1971, 2226, 4133, 7155, 9773, 10473, 8730, 5236,
-    1290, -2114, -4747, -6907, -8809, -10175, -10333, -8764, -5640, -1894, 1298, 3224,
-    3920, 3853, 3439, 2925, 2628, 2967, 4066, 5369, 5857, 4804, 2349, -661,
-    -3298, -5078, -6015, -6392, -6473, -6314, -5757, -4676, -3290, -2180, -1841, -2120,
-    -2139, -879, 2002, 5745, 8782, 9603, 7673, 3793, -424, -3600, -5305, -5833,
-    -5431, -3983, -1537, 1005, 2078, 573, -3108, -7133, -9422, -8965, -6232, -2497,
-    1234, 4727, 8074, 10849, 11890, 10114, 5625, -70, -5013, -8031, -9128, -8977,
-    -8296, -7628, -7353, -7555, -7871, -7697, -6647, -4780, -2373, 387, 3399, 6400,
-    8888, 10317, 10338, 8866, 6048, 2268, -1876, -5694, -8595, -10242, -10657, -10248,
-    -9604, -9043, -8259, -6518, -3378, 768, 4897, 8097, 10055, 10897, 10740, 9534,
-    7292, 4312, 1113, -1819, -4202, -5947, -7053, -7565, -7644, -7656, -8041, -8898,
-    -9591, -8932, -6033, -1157, 4291, 8674, 11091, 11569, 10561, 8445, 5480, 1988,
-    -1588, -4761, -7084, -8220, -8118, -7158, -5994, -5121, -4545, -3900, -2855, -1397,
-    269, 1962, 3646, 5295, 6684, 7344, 6813, 5050, 2634, 451, -946, -1730,
-    -2539, -3834, -5537, -7219, -8480, -9058, -8669, -6993, -3980, -164, 3385, 5542,
-    5693, 3995, 1210, -1752, -4198, -5679, -5816, -4334, -1457, 1760, 3772, 3507,
-    1113, -2256, -5381, -7683, -9088, -9460, -8388, -5614, -1588, 2491, 5235, 5838,
-    4453, 1952, -707, -2970, -4626, -5403, -4806, -2534, 871, 3924, 4930, 3059,
-    -1078, -5780, -9263, -10654, -10321, -9306, -8312, -7093, -4833, -1145, 3291, 7119,
-    9310, 9803, 9279, 8427, 7413, 5897, 3446, 18, -3811, -7083, -9055, -9687,
-    -9549, -9177, -8555, -7244, -4989, -2113, 696, 2916, 4499, 5719, 6816, 7748,
-    8236, 8005, 7025, 5511, 3655, 1378, -1574, -5190, -8866, -11586, -12512, -11479,
-    -8994, -5827, -2574, 508, 3384, 6002, 8143, 9495, 9879, 9386, 8280, 6763,
-    4869, 2567, -95, -2986, -5930, -8633, -10575, -11152, -10114, -7874, -5290, -3013,
-    -1022, 1191, 3967, 6997, 9436, 10484, 9929, 8236, 6147, 4109, 1973, -755,
-    -4272, -7984, -10693, -11402, -10085, -7649, -5118, -2828, -476, 2103, 4377, 5502,
-    5278, 4572, 4643, 5975, 7787, 8672, 7685, 4897, 1078, -2958, -6680, -9653,
-    -11258, -10797, -8018, -3601, 976, 4214, 5454, 5124, 4229, 3646, 3758, 4513,
-    5561, 6310, 6090, 4540, 1923, -1006, -3541, -5455, -6882, -7838, -7938, -6685,
-    -4093, -997, 1364, 2231, 1908, 1408, 1471, 1930, 2101, 1759, 1515, 2133,
-    3524, 4591, 4111, 1746, -1760, -5115, -7111, -6938, -4379, -51, 4583, 7733,
-    8146, 5740, 1565, -2798, -6000, -7426, -7222, -5898, -3819, -1067, 2232, 5506,
-    7812, 8437, 7434, 5552, 3600, 1906, 351, -1159, -2382, -2959, -2920, -2887,
-    -3653, -5463, -7658, -9068, -8819, -6845, -3745, -215, 3334, 6706, 9588, 11403,
-    11559, 9898, 6950, 3705, 996, -993, -2706, -4674, -6959, -9051, -10237, -10035,
-    -8357, -5415, -1604, 2553, 6457, 9572, 11584, 12453, 12330, 11409, 9830, 7694,
-    5145, 2383, -454, -3397, -6522, -9639, -12121, -13155, -12246, -9511, -5527, -972,
-    3579, 7660, 10907, 13085, 14057, 13670, 11799, 8568, 4498, 303, -3485, -6645,
-    -9071, -10581, -11050, -10612, -9568, -8069, -5969, -3082, 481, 4280, 7784, 10582,
-    12379, 12960, 12244, 10385, 7735, 4703, 1619, -1308, -3959, -6235, -7994, -9058,
-    -9294, -8646, -7037, -4313, -444, 4098, 8243, 10800, 11178, 9674, 7095, 4147,
-    1219, -1367, -3073, -3269, -1713, 1036, 3693, 4846, 3737, 675, -3197, -6551,
-    -8393, -8199, -5863, -1768, 3103, 7382, 9905, 10218, 8578, 5567, 1841, -1753,
-    -4064, -3996, -1297, 2935, 6624, 7889, 6162, 2375, -1867, -5318, -7445, -8050,
-    -6928, -4140, -518, 2466, 3647, 3083, 1978, 1699, 2802, 4846, 6910, 8226,
-    8502, 7857, 6525, 4550, 1794, -1705, -5367, -8197, -9406, -8933, -7387, -5539,
-    -3850, -2365, -839, 1044, 3394, 5914, 8016, 9278, 9778, 9898, 9774, 9045,
-    7178, 4030, 67, -3893, -7098, -9138, -9991, -9862, -8913, -7106, -4379, -971,
-    2482, 5301, 7178, 8235, 8740, 8884, 8784, 8500, 7901, 6614, 4296, 1012,
-    -2707, -6199, -8990, -10834, -11619, -11358, -10215, -8380, -5907, -2819, 615, 3807,
-    6204, 7687, 8544, 9058, 9169, 8549, 6912, 4222, 704, -3249, -7128, -10352,
-    -12359, -12772, -11641, -9534, -7269, -5342, -3548, -1250, 1878, 5402, 8430, 10307,
-    10958, 10620, 9427, 7335, 4357, 777, -2864, -5947, -7994, -8854, -8717, -7880,
-    -6496, -4565, -2187, 327, 2665, 4792, 6860, 8862, 10474, 11317, 11239, 10247,
-    8241, 5048, 824, -3653, -7224, -9020, -8954, -7661, -5945, -4203, -2300, 7,
-    2502, 4447, 5224, 5056, 4971, 5913, 7849, 9779, 10574, 9738, 7463, 4172,
-    219, -3993, -7741, -9986, -9789, -6926, -2286, 2341, 5124, 5184, 2981, -152,
-    -2828, -4104, -3528, -1083, 2714, 6792, 9866, 10980, 9858, 6855, 2755, -1370,
-    -4343, -5288, -4123, -1723, 528, 1552, 1166, 6, -1096, -1745, -2103, -2454,
-    -2710, -2353, -873, 1719, 4769, 7316, 8609, 8461, 7255, 5649, 4133, 2751,
-    1209, -727, -2895, -4797, -5965, -6266, -5878, -5011, -3676, -1717, 928, 3983,
-    6837, 8841, 9677, 9481, 8651, 7518, 6213, 4763, 3227, 1677, 106, -1593,
-    -3487, -5438, -7049, -7798, -7297, -5526, -2861, 178, 3201, 6011, 8418, 10097,
-    10725, 10234, 8859, 6914, 4582, 1947, -841, -3528, -5842, -7576, -8569, -8697,
-    -7900, -6203, -3683, -499, 3009, 6290, 8779, 10187, 10585, 10206, 9244, 7830,
-    6134, 4364, 2633, 878, -1064, -3286, -5646, -7708, -8856, -8600, -6893, -4142,
-    -905, 2433, 5639, 8411, 10321, 11030, 10502, 8969, 6790, 4407, 2327, 898,
-    32, -759, -1944, -3588, -5392, -6977, -8034, -8247, -7319, -5168, -2067, 1494,
-    5031, 8131, 10403, 11537, 11417, 10086, 7611, 4128, 112, -3518, -5777, -6188,
-    -5029, -3108, -1365, -524, -791, -1694, -2324, -1987, -711, 925, 2398, 3578,
-    4494, 5021, 4950, 4310, 3452, 2810, 2614, 2783, 2877, 2195, 205, -2845,
-    -5809, -7355, -6931, -5040, -2653, -511, 1015, 1719, 1519, 617, -503, -1292,
-    -1296, -156, 2236, 5409, 8253, 9585, 8927, 6744, 3950, 1238, -1181, -3456,
-    -5829, -8314, -10421, -11250, -10097, -7110, -3286, 259, 2985, 4982, 6544, 7851,
-    8925, 9624, 9607, 8526, 6388, 3661, 930, -1536, -3760, -5738, -7312, -8350,
-    -8833, -8682, -7665, -5652, -2902, 56, 2850, 5436, 7840, 9881, 11208, 11469,
-    10350, 7615, 3398, -1511, -5881, -8719, -9763, -9353, -7996, -6159, -4307, -2827,
-    -1773, -818, 430, 2086, 3961, 5770, 7284, 8366, 8989, 9163, 8702, 7080,
-    3792, -928, -5849, -9429, -10873, -10502, -9180, -7514, -5606, -3341, -710, 2096,
-    4733, 6814, 8123, 8768, 9032, 8992, 8364, 6812, 4356, 1397, -1606, -4354,
-    -6612, -8105, -8635, -8258, -7238, -5858, -4316, -2731, -1081, 865, 3361, 6273,
-    8902, 10392, 10362, 9114, 7232, 5060, 2592, -250, -3286, -6005, -7743, -8027,
-    -6868, -4794, -2495, -409, 1374, 2832, 3762, 3953, 3570, 3260, 3768, 5392,
-    7720, 9768, 10421, 8981, 5556, 1072, -3205, -6297, -7836, -7911, -6745, -4600,
-    -1927, 560, 2102, 2323, 1523, 577, 428, 1492, 3371, 5107, 5825, 5288,
-    3984, 2728, 2106, 2134, 2289, 1894, 567, -1505, -3693, -5313, -5998, -5803,
-    -5009, -3839, -2303, -281, 2218, 4837, 6925, 7873, 7478, 6029, 4065, 2070,
-    312, -1114, -2174, -2838, -3083, -3012, -2958, -3416, -4662, -6376, -7680, -7674,
-    -6030, -3109, 415, 3945, 7022, 9199, 10031, 9280, 7158, 4345, 1714, -157,
-    -1337, -2453, -4101, -6266, -8302, -9494, -9595, -8804, -7371, -5340, -2656, 636,
-    4305, 7895, 10702, 11978, 11397, 9398, 6887, 4512, 2235, -363, -3438, -6614,
-    -9247, -10829, -11200, -10532, -9172, -7384, -5149, -2256, 1334, 5255, 8905, 11746,
-    13350, 13262, 11137, 7170, 2277, -2340, -5836, -7942, -8743, -8541, -7903, -7517,
-    -7675, -7875, -7144, -4814, -1028, 3440, 7684, 11018, 13090, 13856, 13391, 11642,
-    8424, 3820, -1436, -6171, -9462, -11086, -11328, -10545, -9048, -7206, -5343, -3475,
-    -1349, 1125, 3620, 5724, 7412, 8981, 10494, 11455, 11146, 9222, 5972, 2095,
-    -1686, -4922, -7502, -9490, -10809, -11154, -10305, -8505, -6309, -3969, -1144, 2540,
-    6676, 10014, 11325, 10311, 7690, 4614, 2085, 654, 300, 439, 265, -680,
-    -2232, -3905, -5403, -6741, -7922, -8629, -8316, -6586, -3528, 175, 3502, 5640,
-    6507, 6692, 6748, 6550, 5496, 3372, 843, -1071, -1967, -2377, -3150, -4630,
-    -6431, -7821, -8220, -7472, -5832, -3743, -1520, 795, 3234, 5548, 7182, 7657,
-    6947, 5491, 3909, 2754, 2314, 2374, 2119, 566, -2599, -6555, -9841, -11385,
-    -11095, -9580, -7471, -5031, -2222, 974, 4259, 6923, 8146, 7619, 5959, 4352,
-    3646, 3734, 3809, 3096, 1318, -1336, -4401, -7267, -9367, -10431, -10524, -9721,
-    -7860, -4772, -775, 3249, 6371, 8159, 8709, 8286, 7066, 5199, 2941, 675,
-    -1169, -2269, -2677, -2966, -3922, -5844, -8129, -9677, -9776, -8539, -6511, -4024,
-    -1074, 2291, 5637, 8278, 9663, 9645, 8490, 6706, 4771, 2884, 926, -1305,
-    -3798, -6248, -8215, -9340, -9437, -8536, -6868, -4728, -2268, 520, 3529, 6268,
-    8045, 8509, 7986, 7204, 6671, 6334, 5749, 4485, 2375, -447, -3620, -6656,
-    -9095, -10643, -11190, -10732, -9303, -6998, -3995, -560, 2938, 5989, 8040, 8787,
-    8448, 7661, 6982, 6434, 5551, 3876, 1393, -1512, -4425, -7136, -9521, -11263,
-    -11844, -10898, -8616, -5766, -3250, -1538, -415, 764, 2567, 5097, 7923, 10284,
-    11395, 10755, 8332, 4559, 117, -4334, -8272, -11261, -12895, -12942, -11597, -9543,
-    -7611, -6241, -5202, -3870, -1845, 671, 3081, 4965, 6393, 7645, 8661, 8843,
-    7506, 4530, 568, -3415, -6832, -9700, -12231, -14194, -14772, -13154, -9357, -4503,
-    -205, 2451, 3470, 3712, 4176, 5410, 7293, 9102, 9831, 8724, 5781, 1791,
-    -2229, -5684, -8547, -10975, -12898, -13989, -13888, -12409, -9624, -5907, -1846, 1998,
-    5310, 7981, 9898, 10925, 11050, 10381, 8870, 6205, 2222, -2545, -6967, -10092,
-    -11746, -12344, -12248, -11492, -10018, -7917, -5355, -2441, 683, 3699, 6205, 7925,
-    8782, 8848, 8337, 7562, 6626, 5128, 2401, -1700, -6320, -10098, -12172, -12643,
-    -12093, -10900, -9045, -6379, -2893, 1173, 5243, 8468, 10147, 10250, 9465, 8588,
-    7865, 6933, 5274, 2664, -678, -4178, -7135, -9127, -10307, -11174, -11908, -12039,
-    -10909, -8449, -5294, -2125, 915, 4037, 7193, 9839, 11313, 11304, 9939, 7572,
-    4568, 1215, -2266, -5606, -8341, -9866, -9843, -8620, -7158, -6401, -6607, -7221,
-    -7304, -6085, -3308, 691, 5101, 8931, 11373, 12037, 10930, 8293, 4509, 130,
-    -4130, -7551, -9656, -10383, -10068, -9216, -8196, -7068, -5698, -4019, -2116, -53,
-    2330, 5237, 8455, 11141, 12234, 11210, 8446, 4863, 1274, -1921, -4538, -6359,
-    -7235, -7360, -7284, -7497, -8008, -8352, -8004, -6737, -4605, -1699, 1914, 5947,
-    9665, 12060, 12394, 10635, 7401, 3496, -448, -3980, -6618, -7868, -7529, -5978,
-    -4071, -2706, -2416, -3232, -4751, -6246, -6829, -5771, -2889, 1261, 5607, 9058,
-    10922, 11000, 9433, 6526, 2691, -1530, -5484, -8558, -10377, -10950, -10594, -9678,
-    -8354, -6526, -4104, -1273, 1541, 4013, 6176, 8206, 9955, 10802, 10134, 7964,
-    4988, 1960, -883, -3712, -6514, -8814, -10059, -10178, -9624, -8849, -7845, -6237,
-    -3756, -555, 2897, 6113, 8725, 10389, 10727, 9481, 6767, 3117, -812, -4583,
-    -8003, -10856, -12743, -13305, -12579, -11012, -9045, -6738, -3895, -541, 2821, 5495,
-    7130, 7935, 8362, 8592, 8299, 6928, 4204, 448, -3580, -7131, -9798, -11514,
-    -12332, -12289, -11448, -9934, -7837, -5099, -1622, 2426, 6431, 9541, 11155, 11264,
-    10315, 8720, 6494, 3428, -365, -4093, -6585, -7100, -5957, -4409, -3807, -4719,
-    -6634, -8344, -8643, -6885, -3180, 1687, 6540, 10210, 11966, 11758, 10065, 7448,
-    4225, 609, -2889, -5390, -6155, -5225, -3465, -1928, -1203, -1366, -2340, -4047,
-    -6081, -7476, -7087, -4415, -71, 4600, 8389, 10766, 11748, 11431, 9805, 7014,
-    3643, 593, -1411, -2264, -2479, -2815, -3836, -5652, -7883, -9812, -10688, -10003,
-    -7629, -3782, 1016, 5940, 9959, 12182, 12279, 10639, 8110, 5545, 3478, 2043,
-    995, -199, -2103, -4910, -8184, -11027, -12614, -12627, -11215, -8629, -5000, -522,
-    4246, 8394, 11071, 11873, 10899, 8571, 5537, 2644, 685, -100, -310, -1008,
-    -2888, -5715, -8518, -10316, -10699, -9864, -8213, -5960, -3047, 594, 4677, 8445,
-    10974, 11705, 10763, 8770, 6318, 3607, 548, -2859, -6279, -9158, -11025, -11664,
-    -11096, -9466, -6996, -3957, -615, 2784, 5967, 8567, 10212, 10742, 10306, 9212,
-    7659, 5654, 3188, 423, -2364, -4976, -7368, -9465, -10948, -11297, -10103, -7373,
-    -3558, 703, 4863, 8536, 11370, 12956, 12937, 11238, 8194, 4467, 854, -1923,
-    -3447, -3824, -3698, -3899, -4887, -6416, -7687, -7848, -6453, -3635, -3, 3671,
-    6835, 9341, 11224, 12275, 11924, 9724, 5974, 1773, -1668, -3801, -4902, -5593,
-    -6297, -7041, -7551, -7396, -6163, -3734, -509, 2720, 5270, 6975, 8065, 8630,
-    8324, 6714, 3916, 795, -1548, -2490, -2151, -1103, 63, 943, 1304, 1000,
-    -99, -2039, -4510, -6572, -6876, -4548, -82, 4726, 7916, 8568, 7031, 4252,
-    1141, -1461, -2645, -1711, 1233, 5040, 8026, 8841, 7050, 3139, -1868, -6786,
-    -10529, -12283, -11713, -9103, -5227, -961, 3091, 6619, 9400, 11174, 11827, 11566,
-    10774, 9637, 7996, 5616, 2562, -704, -3587, -5715, -7092, -7993, -8652, -8948,
-    -8351, -6303, -2772, 1520, 5492, 8390, 10112, 10943, 11093, 10599, 9580, 8322,
-    6935, 5013, 1913, -2411, -6947, -10181, -11198, -10141, -7609, -3829, 1313, 7428,
-    13113, 16492, 16362, 12861, 7198, 874, -4932, -9519, -12469, -13349, -11677, -7336,
-    -1154, 5023, 9138, 10090, 8323, 5380, 2875, 1653, 1533, 1586, 758, -1401,
-    -4286, -6466, -6565, -4220, -329, 3628, 6592, 8375, 9234, 9152, 7702, 4657,
-    583, -3343, -6172, -7746, -8434, -8469, -7672, -5772, -2843, 616, 3953, 6657,
-    8503, 9530, 9890, 9671, 8842, 7346, 5186, 2384, -1051, -4980, -8895, -11938,
-    -13301, -12680, -10371, -6947, -2858, 1641, 6215, 10156, 12511, 12661, 10838, 7949,
-    4805, 1566, -1997, -5817, -9274, -11632, -12491, -11719, -9204, -4979, 360, 5644,
-    9706, 11983, 12559, 11791, 10009, 7482, 4430, 1026, -2514, -5777, -8193, -9296,
-    -8960, -7370, -4902, -2114, 260, 1551, 1633, 1173, 1318, 2935, 5946, 9279,
-    11499, 11649, 9662, 6126, 1795, -2645, -6498, -9127, -10293, -10355, -9919, -9207,
-    -7825, -5185, -1105, 3918, 8880, 12644, 14379, 13900, 11721, 8675, 5370, 1950,
-    -1664, -5380, -8776, -11250, -12309, -11784, -9870, -6967, -3482, 303, 4199, 8025,
-    11492, 14056, 14876, 13182, 8921, 3106, -2659, -7119, -9866, -11070, -11008, -9955,
-    -8233, -6000, -2999, 1118, 6007, 10368, 12678, 12258, 9566, 5639, 1468, -2171,
-    -4702, -5908, -6096, -5916, -5878, -6013, -5919, -5072, -3150, -256, 3073, 6098,
-    8210, 9149, 8973, 7881, 6055, 3594, 574, -2791, -6024, -8462, -9541, -9024,
-    -7092, -4326, -1637, 25, 241, -459, -855, 109, 2593, 5826, 8630, 9988,
-    9366, 6819, 2926, -1448, -5462, -8514, -10325, -10952, -10658, -9592, -7552, -4231,
-    189, 4796, 8444, 10531, 11213, 10967, 10118, 8756, 6812, 4088, 391, -4080,
-    -8486, -11712, -13077, -12656, -10941, -8328, -5010, -1182, 2792, 6373, 8941, 9976,
-    9335, 7395, 4816, 2149, -286, -2202, -3319, -3704, -4010, -5083, -7154, -9459,
-    -10722, -10050, -7451, -3674, 303, 3673, 5925, 6827, 6463, 5271, 3872, 2701,
-    1713, 503, -1281, -3639, -6276, -8774, -10647, -11364, -10548, -8204, -4707, -609,
-    3443, 6667, 8353, 8308, 6990, 4989, 2432, -899, -4851, -8561, -10998, -11753,
-    -11159, -9756, -7829, -5458, -2767, 2, 2570, 4668, 6020, 6389, 5691, 4098,
-    2064, 197, -1103, -2010, -3172, -5000, -6993, -7939, -6956, -4354, -1463, 313,
-    340, -1020, -2675, -3327, -2159, 575, 3576, 5303, 4975, 2959, 270, -2205,
-    -4126, -5532, -6475, -6875, -6664, -5990, -5141, -4231, -3036, -1204, 1334, 4207,
-    6789, 8482, 8864, 7769, 5413, 2357, -778, -3615, -5986, -7688, -8432, -8087,
-    -6798, -4753, -1964, 1519, 5164, 7956, 8995, 8120, 5934, 3254, 536, -2229,
-    -5134, -7839, -9481, -9224, -7035, -3881, -1047, 770, 1708, 2268, 2829, 3589,
-    4608, 5621, 5940, 4894, 2542, -185, -2171, -2921, -2730, -2251, -2048, -2442,
-    -3450, -4701, -5499, -5188, -3594, -1152, 1371, 3314, 4412, 4785, 4692, 4288,
-    3551, 2385, 718, -1455, -4022, -6637, -8737, -9791, -9590, -8281, -6148, -3495,
-    -717, 1695, 3408, 4493, 5258, 5799, 5807, 4863, 2903, 342, -2216, -4344,
-    -5932, -7087, -7894, -8235, -7821, -6424, -4096, -1190, 1784, 4284, 5848, 6264,
-    5708, 4566, 3016, 846, -2158, -5680, -8865, -10879, -11384, -10471, -8358, -5333,
-    -1939, 1051, 2987, 3688, 3462, 2872, 2464, 2525, 2932, 3220, 2930, 1968,
-    636, -665, -1737, -2660, -3664, -4907, -6244, -7158, -7019, -5548, -3080, -332,
-    2056, 3775, 4786, 5209, 5298, 5307, 5162, 4321, 2164, -1306, -5155, -8033,
-    -9092, -8505, -7169, -5925, -4997, -4056, -2688, -772, 1495, 3753, 5563, 6421,
-    5909, 4015, 1272, -1489, -3606, -4850, -5359, -5410, -5247, -4945, -4351, -3184,
-    -1327, 951, 3093, 4595, 5246, 5083, 4225, 2804, 978, -1064, -3141, -5086,
-    -6714, -7813, -8158, -7547, -5870, -3263, -249, 2329, 3643, 3314, 1690, -184,
-    -1008, 4, 2451, 4795, 5352, 3523, 189, -3109, -5386, -6686, -7586, -8425,
-    -9006, -8805, -7321, -4336, -160, 4277, 7711, 9207, 8724, 7074, 5265, 3767,
-    2280, 145, -2936, -6440, -9218, -10227, -9237, -6925, -4303, -2003, -32, 1922,
-    4039, 6161, 7882, 8738, 8377, 6726, 4088, 1045, -1843, -4307, -6356, -7993,
-    -8967, -8853, -7363, -4628, -1182, 2277, 5155, 7110, 8068, 8144, 7491, 6171,
-    4159, 1535, -1342, -3901, -5647, -6395, -6247, -5419, -4153, -2747, -1492, -494,
-    417, 1491, 2738, 3866, 4579, 4895, 5134, 5535, 5882, 5508, 3724, 385,
-    -3807, -7565, -9695, -9739, -8126, -5798, -3610, -1895, -384, 1507, 4125, 7114,
-    9474, 10232, 9158, 6799, 3845, 580, -2971, -6498, -9232, -10403, -9747, -7561,
-    -4388, -795, 2647, 5446, 7368, 8463, 8818, 8351, 6972, 4943, 2911, 1444,
-    536, -381, -1897, -4076, -6385, -8041, -8408, -7171, -4392, -563, 3416, 6565,
-    8332, 8840, 8558, 7692, 5989, 3198, -315, -3542, -5441, -5607, -4404, -2583,
-    -852, 303, 624, 166, -589, -812, 209, 2508, 5272, 7339, 7997, 7394,
-    6222, 5044, 3887, 2374, 139, -2815, -5961, -8341, -8984, -7508, -4445, -924,
-    2063, 4170, 5575, 6522, 7015, 6843, 5738, 3544, 426, -2980, -5754, -7229,
-    -7439, -6958, -6228, -5090, -3061, -55, 3244, 5832, 7169, 7495, 7370, 6992,
-    6044, 4148, 1386, -1661, -4290, -6024, -6698, -6429, -5585, -4652, -3888, -3042,
-    -1540, 906, 3829, 6207, 7187, 6680, 5310, 3841, 2632, 1534, 206, -1524,
-    -3538, -5554, -7265, -8346, -8435, -7259, -4909, -1941, 894, 3146, 4908, 6545,
-    8156, 9305, 9296, 7732, 4863, 1445, -1696, -4063, -5625, -6702, -7649, -8506,
-    -8824, -7913, -5396, -1616, 2507, 6041, 8522, 9949, 10465, 10068, 8561, 5721,
-    1592, -3247, -7722, -10727, -11730, -10937, -8889, -5968, -2358, 1591, 5206, 7792,
-    9076, 9282, 8817, 7934, 6628, 4740, 2119, -1229, -5000, -8562, -11120, -12026,
-    -11100, -8751, -5779, -2912, -392, 2054, 4768, 7628, 9918, 10751, 9715, 7187,
-    4066, 1168, -1212, -3288, -5446, -7893, -10456, -12523, -13179, -11671, -7998, -3091,
-    1745, 5660, 8510, 10396, 11224, 10858, 9501, 7553, 5069, 1666, -2817, -7698,
-    -11720, -13945, -14281, -13236, -11397, -9152, -6612, -3574, 284, 4872, 9316, 12331,
-    13103, 11785, 9088, 5565, 1382, -3311, -8009, -11922, -14317, -14797, -13378, -10428,
-    -6542, -2322, 1809, 5641, 9028, 11666, 13057, 12752, 10733, 7550, 3993, 543,
-    -2852, -6417, -10012, -12957, -14420, -13953, -11764, -8596, -5312, -2451, -2, 2445,
-    5253, 8377, 11274, 13067, 12895, 10372, 5963, 874, -3660, -7116, -9693, -11666,
-    -12862, -12803, -11195, -8116, -3927, 753, 5023, 7980, 9271, 9277, 8684, 7929,
-    7112, 6198, 4998, 3011, -305, -4816, -9341, -12281, -12723, -10933, -7874, -4391,
-    -849, 2674, 6030, 8825, 10486, 10486, 8656, 5375, 1477, -2156, -5062, -7324,
-    -9200, -10541, -10666, -8943, -5546, -1513, 2045, 4724, 6745, 8242, 8923, 8456,
-    6957, 4898, 2646, 288, -2136, -4459, -6483, -8070, -9026, -9022, -7830, -5633,
-    -2985, -454, 1679, 3391, 4751, 5806, 6543, 6839, 6466, 5189, 2887, -334,
-    -4032, -7416, -9616, -10168, -9282, -7560, -5470, -3174, -799, 1370, 3103, 4497,
-    5813, 7000, 7547, 6889, 4957, 2263, -495, -2860, -4746, -6264, -7469, -8229,
-    -8261, -7308, -5359, -2763, -137, 1962, 3398, 4505, 5653, 6673, 6805, 5379,
-    2555, -715, -3483, -5470, -6918, -7983, -8458, -8050, -6707, -4635, -2152, 344,
-    2412, 3749, 4357, 4430, 4077, 3294, 2251, 1431, 1283, 1711, 1991, 1282,
-    -726, -3569, -6322, -8106, -8453, -7366, -5173, -2365, 508, 2941, 4609, 5453,
-    5590, 5127, 4086, 2524, 664, -1139, -2573, -3498, -3937, -3989, -3754, -3274,
-    -2559, -1656, -662, 365, 1511, 2870, 4276, 5198, 5062, 3694, 1474, -910,
-    -2816, -3861, -4014, -3603, -3110, -2753, -2244, -1082, 819, 2868, 4224, 4516,
-    4106, 3673, 3564, 3493, 2814, 1102, -1402, -3834, -5233, -5168, -3934, -2185,
-    -366, 1511, 3585, 5707, 7306, 7727, 6728, 4701, 2409, 438, -1123, -2507,
-    -3785, -4622, -4564, -3559, -2148, -1087, -741, -849, -811, -187, 1066, 2696,
-    4346, 5615, 6119, 5677, 4496, 3023, 1509, -223, -2460, -5015, -7128, -8014,
-    -7451, -5764, -3330, -321, 3040, 6209, 8504, 9555, 9445, 8435, 6719, 4513,
-    2199, 162, -1535, -3172, -4959, -6667, -7736, -7753, -6786, -5240, -3441, -1372,
-    1182, 4226, 7289, 9563, 10365, 9515, 7344, 4404, 1171, -2036, -4970, -7343,
-    -8759, -8804, -7302, -4610, -1588, 899, 2566, 3752, 4857, 5800, 6128, 5646,
-    4770, 4149, 3994, 3850, 3061, 1362, -942, -3246, -4981, -5772, -5504, -4410,
-    -3024, -1885, -1157, -554, 331, 1632, 3148, 4575, 5709, 6422, 6542, 5856,
-    4226, 1703, -1404, -4495, -6792, -7669, -7025, -5312, -3139, -843, 1526, 3876,
-    5827, 6866, 6708, 5516, 3826, 2271, 1271, 844, 672, 386, -187, -1023,
-    -2067, -3258, -4387, -5031, -4767, -3434, -1168, 1709, 4682, 6977, 7771, 6763,
-    4530, 2178, 530, -370, -1002, -1744, -2523, -2951, -2659, -1551, 108, 1795,
-    3005, 3546, 3575, 3330, 2871, 2135, 1226, 508, 320, 618, 941, 769,
-    -70, -1267, -2233, -2453, -1780, -501, 896, 2102, 3210, 4526, 6084, 7381,
-    7638, 6416, 4005, 1231, -1096, -2614, -3428, -3820, -3888, -3383, -1871, 806,
-    4144, 7116, 8835, 9143, 8518, 7442, 6000, 4099, 1922, -39, -1412, -2302,
-    -3132, -4194, -5337, -6030, -5679, -3983, -1156, 2128, 5056, 7060, 7998, 8100,
-    7785, 7408, 6976, 6045, 4041, 879, -2718, -5660, -7329, -7962, -8191, -8271,
-    -7809, -6193, -3204, 731, 4760, 7991, 9830, 10141, 9216, 7537, 5491, 3257,
-    928, -1330, -3302, -4888, -6184, -7324, -8227, -8561, -7967, -6346, -3928, -1077,
-    1931, 4953, 7816, 10110, 11182, 10424, 7710, 3630, -743, -4410, -6902, -8287,
-    -8841, -8726, -7907, -6285, -3881, -986, 1868, 4162, 5711, 6706, 7337, 7406,
-    6452, 4324, 1564, -907, -2477, -3223, -3674, -4318, -5293, -6332, -6848, -6177,
-    -4006, -730, 2630, 5011, 5920, 5628, 4826, 4102, 3581, 2932, 1691, -312,
-    -2727, -4857, -6062, -6081, -5041, -3292, -1233, 765, 2424, 3609, 4312, 4575,
-    4416, 3844, 2922, 1795, 643, -401, -1308, -2134, -2933, -3689, -4259, -4390,
-    -3797, -2337, -170, 2239, 4346, 5785, 6438, 6289, 5344, 3722, 1759, -129,
-    -1699, -2961, -3976, -4657, -4803, -4270, -3031, -1117, 1357, 4073, 6488, 8051,
-    8468, 7794, 6324, 4441, 2465, 546, -1367, -3336, -5150, -6238, -6005, -4333,
-    -1813, 565, 2044, 2565, 2719, 3249, 4491, 6175, 7639, 8218, 7520, 5527,
-    2584, -706, -3737, -6156, -7902, -8954, -9089, -7956, -5417, -1815, 2117, 5582,
-    8037, 9315, 9544, 8974, 7813, 6192, 4211, 1970, -464, -3063, -5725, -8194,
-    -10135, -11287, -11471, -10494, -8188, -4678, -547, 3398, 6580, 8839, 10195, 10560,
-    9756, 7756, 4794, 1263, -2411, -5770, -8354, -9875, -10381, -10158, -9389, -7914,
-    -5394, -1786, 2342, 5995, 8303, 8981, 8323, 6869, 5071, 3172, 1199, -1009,
-    -3637, -6612, -9407, -11205, -11344, -9707, -6789, -3446, -492, 1702, 3377, 5084,
-    7028, 8646, 8904, 7152, 3714, -305, -3759, -6085, -7391, -8129, -8635, -8855,
-    -8390, -6865, -4337, -1357, 1362, 3372, 4644, 5411, 5896, 6111, 5804, 4591,
-    2287, -808, -3967, -6455, -7931, -8451, -8140, -6973, -4927, -2280, 370, 2462,
-    3841, 4762, 5509, 6041, 5983, 4932, 2759, -303, -3741, -6870, -8974, -9558,
-    -8581, -6463, -3804, -1077, 1498, 3842, 5850, 7266, 7661, 6624, 4126, 772,
-    -2407, -4590, -5649, -6025, -6178, -6242, -6172, -6016, -5845, -5436, -4237, -1837,
-    1493, 4795, 7024, 7718, 7151, 5879, 4181, 1923, -1077, -4607, -7967, -10315,
-    -11102, -10288, -8261, -5632, -2984, -652, 1387, 3358, 5335, 6987, 7722, 7125,
-    5281, 2690, -118, -2851, -5401, -7615, -9226, -10011, -9970, -9256, -7915, -5791,
-    -2771, 830, 4255, 6737, 7967, 8130, 7529, 6267, 4302, 1692, -1298, -4297,
-    -6936, -8877, -9836, -9665, -8366, -6020, -2769, 1046, 4764, 7577, 8955, 8914,
-    7855, 6183, 4100, 1708, -809, -3187, -5202, -6721, -7632, -7787, -7055, -5435,
-    -3091, -310, 2548, 5082, 6916, 7821, 7785, 6956, 5480, 3453, 1033, -1459,
-    -3629, -5242, -6290, -6793, -6558, -5252, -2787, 378, 3379, 5488, 6589, 7151,
-    7666, 8047, 7610, 5717, 2527, -950, -3620, -5121, -5833, -6178, -6062, -5106,
-    -3310, -1296, 184, 913, 1347, 2175, 3732, 5747, 7518, 8348, 7909, 6302,
-    3820, 710, -2780, -6147, -8572, -9290, -8061, -5308, -1813, 1666, 4553, 6431,
-    7096, 6704, 5776, 4880, 4221, 3505, 2261, 335, -1934, -3979, -5459, -6398,
-    -6930, -6971, -6188, -4312, -1450, 1900, 5124, 7783, 9664, 10598, 10284, 8388,
-    4901, 421, -3940, -7055, -8306, -7810, -6270, -4556, -3236, -2280, -1172, 561,
-    2838, 5008, 6360, 6630, 6044, 4972, 3630, 2091, 425, -1241, -2738, -3875,
-    -4446, -4326, -3596, -2550, -1530, -682, 165, 1378, 3194, 5405, 7343, 8252,
-    7781, 6169, 3970, 1625, -742, -3148, -5462, -7276, -8025, -7255, -4890, -1332,
-    2652, 6199, 8649, 9706, 9421, 8060, 5962, 3469, 928, -1329, -3083, -4314,
-    -5149, -5661, -5748, -5210, -3935, -2005, 339, 2769, 4904, 6404, 7091, 6992,
-    6238, 4950, 3248, 1330, -561, -2291, -3854, -5173, -5916, -5606, -4001, -1398,
-    1485, 3951, 5714, 6894, 7620, 7676, 6604, 4239, 1132, -1623, -3097, -3135,
-    -2358, -1652, -1625, -2385, -3575, -4547, -4597, -3291, -739, 2404, 5290, 7341,
-    8420, 8583, 7679, 5325, 1388, -3467, -7776, -9975, -9260, -5931, -1060, 4157,
-    8843, 12455, 14528, 14477, 11801, 6628, 73, -6106, -10441, -12481, -12681, -11646,
-    -9554, -6286, -1967, 2725, 6797, 9465, 10516, 10265, 9228, 7795, 6132, 4276,
-    2239, 18, -2385, -4850, -7041, -8490, -8788, -7705, -5210, -1524, 2751, 6649,
-    9205, 9932, 9027, 7184, 5200, 3683, 2886, 2635, 2375, 1408, -706, -3784,
-    -6933, -8886, -8618, -5896, -1381, 3746, 8269, 11235, 12043, 10545, 7124, 2613,
-    -1983, -5745, -7965, -8219, -6518, -3357, 490, 4323, 7674, 10146, 11204, 10261,
-    7066, 2099, -3432, -8050, -10678, -11039, -9550, -6857, -3455, 363, 4326, 8020,
-    10845, 12119, 11380, 8754, 5050, 1378, -1417, -2978, -3239, -2310, -679, 636,
-    533, -1376, -4417, -7318, -8995, -8964, -7254, -4217, -458, 3238, 6110, 7703,
-    8042, 7601, 7019, 6706, 6560, 6081, 4762, 2399, -908, -4857, -8927, -12336,
-    -14242, -14153, -12142, -8669, -4242, 688, 5571, 9641, 12086, 12401, 10616, 7243,
-    3009, -1389, -5415, -8734, -11209, -12798, -13343, -12489, -9928, -5858, -1125, 3190,
-    6373, 8312, 9240, 9392, 8868, 7600, 5382, 2100, -1865, -5541, -7916, -8689,
-    -8383, -7682, -6791, -5520, -3817, -2001, -449, 768, 1874, 3086, 4404, 5647,
-    6646, 7387, 7924, 8080, 7256, 4766, 578, -4286, -8232, -10105, -9785, -7926,
-    -5344, -2678, -421, 1074, 1728, 1805, 1754, 1963, 2652, 3882, 5545, 7313,
-    8645, 8940, 7751, 4971, 903, -3741, -7919, -10479, -10591, -8208, -4153, 327,
-    4224, 7044, 8587, 8668, 7216, 4548, 1360, -1631, -3966, -5380, -5571, -4198,
-    -1172, 3000, 7110, 9596, 9260, 5990, 881, -4435, -8676, -11278, -12110, -11074,
-    -8091, -3387, 2290, 7720, 11558, 12869, 11630, 8714, 5230, 1826, -1326, -3980,
-    -5561, -5693, -4793, -3866, -3646, -4060, -4532, -4611, -4166, -3126, -1335, 1232,
-    4213, 6917, 8691, 9219, 8549, 6869, 4362, 1327, -1576, -3391, -3443, -2034,
-    -504, -389, -2318, -5563, -8582, -10010, -9310, -6731, -2881, 1625, 6172, 10025,
-    12393, 12720, 10982, 7675, 3528, -840, -5067, -8950, -12184, -14185, -14249, -12063,
-    -8092, -3373, 1164, 5121, 8398, 10761, 11873, 11687, 10500, 8493, 5436, 1105,
-    -4041, -8826, -12069, -13275, -12659, -10706, -7822, -4286, -330, 3746, 7455, 10117,
-    11114, 10301, 8184, 5692, 3674, 2469, 1769, 850, -923, -3629, -6711, -9321,
-    -10755, -10681, -9155, -6584, -3574, -622, 2166, 4969, 7812, 10236, 11472, 10961,
-    8739, 5383, 1641, -1964, -5229, -8051, -10151, -11127, -10794, -9399, -7354, -4802,
-    -1578, 2339, 6475, 10034, 12346, 13070, 12046, 9209, 4764, -647, -6062, -10555,
-    -13497, -14600, -13821, -11246, -7032, -1467, 4823, 10718, 14786, 15882, 13801, 9432,
-    4206, -730, -4892, -8121, -10048, -10133, -8302, -5406, -2815, -1490, -1451, -2034,
-    -2445, -2049, -456, 2266, 5378, 7701, 8317, 7141, 4859, 2365, 194, -1706,
-    -3769, -6289, -8875, -10448, -9953, -7269, -3438, 11, 2017, 2476, 2110, 2007,
-    3035, 5280, 7819, 9193, 8336, 5232, 805, -3723, -7377, -9616, -10313, -9680,
-    -8095, -5807, -2819, 870, 4852, 8218, 9937, 9447, 6948, 3234, -724, -4121,
-    -6465, -7604, -7685, -6986, -5681, -3711, -956, 2441, 5908, 8606, 9741, 8810,
-    5756, 1106, -4044, -8373, -10918, -11448, -10332, -8073, -4979, -1223, 2893, 6780,
-    9664, 10885, 10157, 7646, 3861, -495, -4609, -7707, -9343, -9650, -9184, -8386,
-    -7193, -5229, -2388, 875, 3808, 5860, 6923, 7254, 7231, 7088, 6699, 5600,
-    3392, 195, -3298, -6276, -8287, -9288, -9394, -8724, -7447, -5795, -3909, -1758,
-    726, 3417, 5973, 8011, 9296, 9820, 9767, 9388, 8739, 7447, 4818, 429,
-    -5236, -10732, -14392, -15267, -13489, -9851, -5139, 118, 5431, 10111, 13360, 14585,
-    13640, 10861, 6919, 2554, -1729, -5720, -9187, -11516, -11874, -9913, -6266, -2202,
-    1225, 3682, 5362, 6598, 7741, 9100, 10612, 11557, 10890, 8121, 3856, -590,
-    -4112, -6371, -7672, -8451, -8861, -8591, -7030, -3800, 665, 5085, 8088, 9148,
-    8839, 8209, 7931, 7963, 7766, 6687, 4277, 552, -3810, -7660, -9973, -10438,
-    -9537, -8049, -6494, -4914, -2983, -281, 3344, 7424, 10868, 12526, 11950, 9610,
-    6347, 2712, -1086, -4752, -7728, -9540, -10124, -9669, -8219, -5628, -1912, 2543,
-    7120, 11159, 13934, 14682, 12977, 9139, 4159, -890, -5323, -8791, -10993, -11652,
-    -10728, -8491, -5343, -1683, 1989, 4994, 6728, 7050, 6369, 5256, 3970, 2379,
-    329, -1924, -3640, -4017, -2824, -754, 881, 962, -651, -2980, -4523, -4161,
-    -1824, 1424, 3901, 4239, 2226, -1037, -3866, -5091, -4636, -3202, -1542, -54,
-    1124, 1915, 2278, 2272, 1939, 1150, -305, -2372, -4479, -5693, -5232, -3000,
-    175, 2793, 3395, 1394, -2546, -6888, -10074, -11210, -10164, -7270, -3083, 1673,
-    6090, 9217, 10309, 9061, 5710, 920, -4469, -9637, -13781, -16033, -15658, -12556,
-    -7579, -2175, 2453, 5889, 8318, 9975, 10880, 10963, 10138, 8206, 4914, 383,
-    -4578, -8800, -11519, -12770, -13003, -12459, -10983, -8334, -4504, 212, 5190, 9441,
-    11829, 11660, 9181, 5415, 1431, -2233, -5526, -8449, -10816, -12302, -12559, -11274,
-    -8323, -4044, 661, 4626, 6960, 7431, 6487, 5012, 3917, 3677, 4035, 4161,
-    3288, 1290, -1311, -3891, -6170, -8159, -9742, -10496, -9931, -7864, -4528, -413,
-    3927, 7921, 10995, 12660, 12659, 11049, 8127, 4312, 39, -4274, -8234, -11455,
-    -13556, -14190, -13129, -10404, -6364, -1602, 3230, 7552, 10859, 12706, 12815, 11234,
-    8347, 4635, 445, -3937, -7994, -10913, -11949, -10933, -8397, -5210, -2082, 684,
-    3147, 5540, 7999, 10278, 11640, 11183, 8455, 3910, -1234, -5623, -8399, -9421,
-    -9012, -7526, -5115, -1895, 1700, 4817, 6534, 6438, 4867, 2641, 620, -540,
-    -419, 1023, 3252, 5223, 5904, 4869, 2452, -614, -3619, -6028, -7429, -7571,
-    -6443, -4227, -1127, 2605, 6415, 9324, 10293, 8875, 5537, 1362, -2484, -5069,
-    -5800, -4619, -2238, 45, 1130, 925, 395, 730, 2354, 4588, 6156, 6071,
-    4269, 1606, -710, -1873, -1914, -1543, -1549, -2208, -3091, -3340, -2213, 437,
-    4035, 7534, 9869, 10336, 8794, 5686, 1839, -1934, -5214, -7933, -9896, -10446,
-    -8802, -4854, 457, 5665, 9672, 12115, 13036, 12450, 10370, 7118, 3369, -196,
-    -3212, -5602, -7301, -8103, -7790, -6392, -4319, -2220, -608, 506, 1669, 3540,
-    6224, 8971, 10610, 10374, 8358, 5243, 1722, -1737, -4709, -6716, -7496, -7277,
-    -6588, -5735, -4579, -2842, -512, 2116, 4685, 6920, 8562, 9371, 9263, 8379,
-    6908, 4891, 2309, -691, -3735, -6414, -8440, -9567, -9504, -8042, -5294, -1729,
-    2043, 5495, 8238, 10011, 10746, 10577, 9623, 7711, 4495, 0, -4934, -8956,
-    -11083, -11294, -10252, -8508, -6074, -2721, 1449, 5789, 9343, 11247, 11063, 9016,
-    5971, 3006, 774, -819, -2291, -3980, -5773, -7290, -8153, -8064, -6855, -4642,
-    -1908, 769, 3088, 5055, 6620, 7458, 7233, 6003, 4206, 2242, 186, -2027,
-    -4303, -6374, -7991, -8974, -9083, -8060, -5954, -3299, -802, 1190, 2826, 4360,
-    5739, 6662, 6950, 6699, 6025, 4776, 2628, -511, -4177, -7469, -9505, -9898,
-    -8911, -7156, -5069, -2588, 593, 4397, 7981, 10105, 9971, 7723, 4142, -36,
-    -4367, -8311, -10855, -10857, -7941, -3063, 1899, 5219, 6178, 5136, 2989, 606,
-    -1386, -2564, -2723, -2010, -932, -54, 446, 860, 1505, 2217, 2412, 1751,
-    648, 24, 477, 1695, 2639, 2294, 349, -2621, -5522, -7385, -7809, -6913,
-    -4904, -1822, 2198, 6466, 9778, 11132, 10423, 8390, 5859, 3118, 58, -3200,
-    -5992, -7524, -7525, -6445, -5000, -3588, -2139, -418, 1635, 3810, 5705, 6858,
-    6973, 6179, 5039, 4149, 3635, 3084, 1941, -82, -2957, -6424, -9899, -12378,
-    -12750, -10473, -6029, -677, 4260, 8021, 10517, 11983, 12509, 11826, 9571, 5804,
-    1212, -3273, -7057, -10035, -12227, -13437, -13378, -11996, -9503, -6099, -1844, 3076,
-    8004, 11892, 13812, 13446, 11144, 7595, 3440, -890, -5126, -9004, -12123, -13907,
-    -13801, -11656, -7969, -3641, 600, 4520, 8082, 10940, 12422, 12071, 10051, 6936,
-    3230, -748, -4644, -8009, -10511, -12030, -12432, -11444, -8946, -5346, -1461, 2010,
-    4806, 6947, 8470, 9424, 9917, 9963, 9257, 7338, 4073, -62, -4230, -7722,
-    -10200, -11592, -11906, -11164, -9402, -6658, -3027, 1167, 5260, 8470, 10332, 10910,
-    10476, 9028, 6277, 2203, -2519, -6823, -9980, -11893, -12667, -12172, -10210, -6994,
-    -3164, 720, 4502, 8116, 11129, 12805, 12609, 10546, 7035, 2653, -1955, -6136,
-    -9398, -11538, -12461, -11921, -9618, -5683, -964, 3343, 6437, 8273, 9206, 9375,
-    8517, 6350, 3046, -739, -4215, -6819, -8319, -8758, -8372, -7484, -6335, -4996,
-    -3462, -1771, 18, 1911, 3874, 5607, 6556, 6305, 4939, 2900, 550, -1997,
-    -4574, -6679, -7705, -7412, -6101, -4286, -2316, -333, 1536, 3063, 3988, 4116,
-    3416, 2141, 892, 350, 718, 1398, 1370, 28, -2324, -4817, -6707, -7643,
-    -7367, -5524, -2067, 2220, 5856, 7557, 7021, 4891, 2083, -749, -3241, -5122,
-    -6166, -6276, -5446, -3657, -946, 2346, 5466, 7532, 8007, 6902, 4577, 1452,
-    -2032, -5301, -7715, -8860, -8720, -7519, -5443, -2640, 573, 3670, 6161, 7801,
-    8469, 7962, 6102, 3085, -424, -3683, -6321, -8363, -9857, -10577, -10116, -8210,
-    -4972, -901, 3303, 6983, 9740, 11471, 12223, 11940, 10356, 7204, 2636, -2527,
-    -7056, -9978, -11073, -10762, -9568, -7736, -5291, -2294, 1046, 4379, 7241, 9153,
-    9864, 9514, 8439, 6819, 4614, 1879, -1024, -3612, -5608, -6975, -7712, -7766,
-    -7122, -5836, -3952, -1504, 1296, 3985, 6060, 7293, 7776, 7690, 7066, 5755,
-    3604, 671, -2674, -5851, -8267, -9452, -9086, -7083, -3763, 147, 3861, 6910,
-    9166, 10568, 10988, 10376, 8835, 6478, 3365, -277, -3901, -6899, -8984, -10158,
-    -10339, -9279, -6903, -3566, 170, 3840, 7042, 9262, 10008, 9175, 7115, 4326,
-    1160, -2113, -5114, -7320, -8246, -7663, -5770, -3175, -602, 1503, 3131, 4470,
-    5605, 6436, 6757, 6352, 5130, 3321, 1459, -30, -1206, -2438, -3862, -5165,
-    -5923, -5931, -5140, -3516, -1187, 1414, 3782, 5710, 7207, 8125, 8108, 6998,
-    5059, 2708, 176, -2400, -4715, -6321, -6903, -6413, -4989, -2924, -667, 1327,
-    2852, 3968, 4790, 5346, 5599, 5446, 4640, 2917, 338, -2582, -5179, -6978,
-    -7688, -7056, -4995, -1818, 1836, 5313, 8048, 9460, 9063, 6845, 3390, -498,
-    -4141, -6899, -8030, -6990, -3926, 292, 4537, 7858, 9626, 9649, 8264, 6134,
-    3736, 1118, -1787, -4766, -7331, -9001, -9433, -8437, -6118, -2971, 372, 3522,
-    6348, 8624, 9908, 9865, 8540, 6238, 3306, 123, -2847, -5216, -6843, -7694,
-    -7654, -6649, -4882, -2727, -381, 2161, 4732, 6845, 8029, 8170, 7410, 5925,
-    3980, 2038, 473, -832, -2378, -4410, -6516, -7870, -7794, -6119, -3250, 5,
-    2857, 5015, 6756, 8439, 10004, 10953, 10687, 8814, 5336, 830, -3625, -7006,
-    -8925, -9561, -9079, -7405, -4639, -1354, 1791, 4545, 6929, 8724, 9463, 8936,
-    7429, 5337, 2772, -263, -3489, -6338, -8295, -9089, -8609, -6832, -3931, -363,
-    3232, 6311, 8674, 10457, 11769, 12278, 11285, 8403, 4097, -567, -4678, -7821,
-    -9802, -10431, -9744, -8127, -5910, -2976, 883, 5254, 9074, 11416, 12082, 11354,
-    9484, 6644, 3213, -238, -3262, -5651, -7256, -7929, -7725, -6968, -5931, -4507,
-    -2329, 746, 4300, 7493, 9568, 10260, 9811, 8577, 6684, 4074, 846, -2608,
-    -5778, -8214, -9483, -9203, -7346, -4432, -1189, 1979, 4996, 7642, 9415, 10005,
-    9633, 8648, 6958, 4199, 487, -3357, -6431, -8405, -9416, -9551, -8713, -6909,
-    -4371, -1310, 2215, 6002, 9351, 11252, 11046, 8915, 5684, 2160, -1300, -4612,
-    -7499, -9385, -9777, -8628, -6219, -2867, 1083, 5012, 8130, 9954, 10546, 10098,
-    8498, 5584, 1807, -1717, -4024, -5066, -5532, -6036, -6608, -6855, -6360, -4913,
-    -2581, 255, 3009, 5199, 6653, 7394, 7331, 6191, 3812, 481, -3053, -5931,
-    -7588, -7899, -7022, -5204, -2742, -67, 2298, 3929, 4657, 4523, 3680, 2384,
-    1008, -136, -1010, -1795, -2577, -3192, -3459, -3457, -3413, -3320, -2847, -1680,
-    115, 2101, 3722, 4466, 3954, 2136, -501, -3091, -4946, -6007, -6684, -7213,
-    -7248, -6129, -3561, 0, 3617, 6462, 8155, 8628, 7870, 5884, 2840, -874,
-    -4786, -8409, -11190, -12549, -12172, -10239, -7239, -3518, 799, 5367, 9240, 11213,
-    10676, 8079, 4500, 826, -2631, -5856, -8694, -10755, -11626, -11091, -9210, -6337,
-    -3070, -38, 2454, 4585, 6721, 8817, 10140, 9688, 7012, 2681, -2065, -6123,
-    -9048, -10976, -12167, -12663, -12226, -10505, -7333, -3028, 1567, 5433, 7927, 9040,
-    9146, 8548, 7275, 5227, 2405, -1008, -4686, -8214, -11159, -13160, -13977, -13455,
-    -11517, -8259, -4071, 414, 4518, 7696, 9583, 9970, 8833, 6378, 2983, -937,
-    -5007, -8840, -11959, -13838, -14097, -12685, -9889, -6151, -1903, 2439, 6399, 9477,
-    11314, 11777, 10832, 8417, 4574, -273, -5288, -9585, -12637, -14365, -14891, -14289,
-    -12518, -9515, -5334, -327, 4757, 8932, 11390, 11841, 10515, 7863, 4272, 20,
-    -4562, -8912, -12249, -13859, -13465, -11369, -8193, -4496, -644, 3024, 6085, 8180,
-    9207, 9274, 8485, 6841, 4380, 1309, -2029, -5308, -8268, -10651, -12111, -12264,
-    -10840, -7881, -3800, 717, 4928, 8209, 10179, 10775, 10213, 8766, 6519, 3424,
-    -365, -4274, -7550, -9720, -10710, -10603, -9449, -7363, -4659, -1699, 1308, 4234,
-    6780, 8471, 8961, 8289, 6765, 4701, 2273, -415, -3222, -5858, -7811, -8436,
-    -7313, -4633, -1195, 2077, 4688, 6696, 8315, 9413, 9397, 7652, 4157, -281,
-    -4398, -7119, -7981, -7129, -5130, -2728, -537, 1208, 2610, 3744, 4414, 4364,
-    3617, 2449, 1051, -574, -2320, -3771, -4456, -4225, -3248, -1718, 234, 2333,
-    4093, 5107, 5321, 4951, 4140, 2826, 898, -1537, -4061, -6075, -7079, -6934,
-    -5894, -4350, -2515, -367, 2129, 4741, 6885, 7823, 7085, 4848, 1914, -826,
-    -2984, -4735, -6316, -7583, -8071, -7372, -5390, -2396, 971, 3846, 5565, 6094,
-    5972, 5766, 5613, 5249, 4292, 2449, -328, -3655, -6708, -8647, -9170, -8574,
-    -7276, -5383, -2749, 634, 4398, 7869, 10303, 11169, 10369, 8240, 5317, 2054,
-    -1259, -4405, -7145, -9167, -10048, -9362, -6972, -3269, 964, 4958, 8232, 10526,
-    11673, 11605, 10375, 8083, 4881, 1153, -2436, -5264, -7154, -8333, -8982, -8929,
-    -7789, -5286, -1460, 3223, 7834, 11252, 12753, 12393, 10733, 8217, 4944, 1003,
-    -3167, -6837, -9302, -10128, -9251, -7004, -4012, -892, 2024, 4690, 7121, 9181,
-    10531, 10746, 9565, 7154, 4102, 1052, -1726, -4354, -6968, -9393, -11107, -11403,
-    -9671, -5802, -542, 4708, 8686, 10964, 11879, 11908, 11241, 9839, 7607, 4435,
-    323, -4300, -8479, -11137, -11707, -10401, -7957, -5176, -2548, -72, 2589, 5631,
-    8684, 10914, 11597, 10590, 8272, 5155, 1580, -2298, -6325, -10107, -12885, -13790,
-    -12363, -8929, -4390, 322, 4624, 8277, 11188, 13220, 14045, 13152, 10178, 5390,
-    -235, -5484, -9509, -12020, -13104, -13009, -11994, -10141, -7278, -3256, 1600, 6411,
-    10196, 12402, 13002, 12223, 10277, 7287, 3351, -1291, -6044, -9982, -12249, -12525,
-    -11091, -8454, -5003, -1019, 3148, 7006, 9997, 11601, 11490, 9727, 6815, 3460,
-    237, -2552, -4807, -6559, -7926, -8982, -9541, -9151, -7405, -4321, -446, 3358,
-    6318, 8079, 8776, 8741, 8082, 6577, 4008, 574, -3084, -6188, -8079, -8356,
-    -7018, -4602, -1972, 196, 1753, 2881, 3671, 4032, 3905, 3396, 2626, 1636,
-    496, -596, -1451, -2083, -2636, -3133, -3387, -3204, -2602, -1800, -1011, -317,
-    269, 677, 761, 431, -215, -918, -1417, -1542, -1197, -379, 717, 1696,
-    2209, 2210, 1853, 1136, -196, -2258, -4656, -6652, -7696, -7669, -6687, -4881,
-    -2482, 87, 2399, 4269, 5663, 6406, 6146, 4724, 2430, -202, -2778, -5128,
-    -7080, -8349, -8726, -8262, -7150, -5489, -3287, -703, 1860, 3992, 5549, 6563,
-    6925, 6318, 4587, 2081, -552, -2921, -5107, -7257, -9096, -10014, -9578, -7816,
-    -5019, -1495, 2330, 5761, 8054, 8886, 8470, 7177, 5178, 2536, -507, -3518,
-    -6125, -8105, -9232, -9249, -8136, -6285, -4196, -1999, 557, 3572, 6588, 8812,
-    9704, 9223, 7584, 4960, 1526, -2352, -6143, -9361, -11641, -12591, -11771, -9004,
-    -4726, 125, 4627, 8288, 10943, 12431, 12516, 11124, 8475, 4908, 721, -3696,
-    -7637, -10258, -11089, -10342, -8620, -6407, -3869, -1024, 2061, 5231, 8188, 10397,
-    11234, 10411, 8266, 5461, 2384, -1028, -4817, -8490, -11136, -12026, -11033, -8525,
-    -5008, -965, 3094, 6645, 9327, 11026, 11721, 11238, 9267, 5741, 1178, -3402,
-    -6987, -9089, -9871, -9855, -9475, -8731, -7126, -4045, 563, 5772, 10068, 12341,
-    12559, 11464, 9684, 7210, 3695, -903, -5971, -10406, -13070, -13289, -11186, -7602,
-    -3576, 244, 3738, 6939, 9619, 11272, 11465, 10140, 7637, 4485, 1174, -1957,
-    -4742, -7146, -9165, -10613, -10960, -9493, -5872, -632, 4931, 9519, 12539, 14118,
-    14556, 13862, 11792, 8182, 3250, -2275, -7268, -10624, -11797, -11013, -8889, -5899,
-    -2226, 1898, 5926, 9165, 11162, 11867, 11461, 10107, 7892, 4939, 1534, -1888,
-    -4893, -7198, -8682, -9254, -8771, -7078, -4152, -234, 4088, 7956, 10554, 11520,
-    11029, 9425, 6826, 3252, -876, -4587, -6899, -7458, -6579, -4793, -2525, -188,
-    1653, 2446, 2015, 744, -537, -913, 168, 2571, 5507, 7953, 9096, 8507,
-    6084, 2058, -2836, -7327, -9997, -9949, -7294, -3039, 1554, 5602, 8688, 10450,
-    10339, 7986, 3780, -1116, -5445, -8524, -10272, -10795, -10118, -8230, -5186, -1169,
-    3382, 7633, 10537, 11336, 9942, 6847, 2749, -1683, -5823, -9085, -10988, -11214,
-    -9618, -6321, -1825, 3056, 7468, 10776, 12623, 12868, 11548, 8908, 5421, 1704,
-    -1687, -4509, -6885, -9033, -10893, -12080, -12191, -11017, -8438, -4333, 1100, 6914,
-    11587, 13837, 13338, 10645, 6583, 1791, -3265, -8054, -11852, -13863, -13568, -11075,
-    -7117, -2594, 1967, 6453, 10727, 14243, 16175, 15847, 13070, 8208, 2086, -4226,
-    -9692, -13560, -15458, -15357, -13486, -10174, -5688, -285, 5479, 10566, 13821, 14649,
-    13287, 10382, 6428, 1690, -3442, -8239, -11822, -13527, -13128, -10824, -7064, -2352,
-    2823, 7872, 12036, 14593, 15175, 13870, 11032, 7116, 2704, -1530, -5068, -7793,
-    -9881, -11466, -12411, -12347, -10851, -7688, -3116, 2023, 6660, 10080, 12126, 12829,
-    12037, 9535, 5474, 515, -4449, -8596, -11273, -12032, -10773, -7859, -3971, 188,
-    4134, 7618, 10458, 12333, 12788, 11504, 8621, 4734, 538, -3497, -7140, -10237,
-    -12590, -13881, -13620, -11304, -6896, -1185, 4491, 8993, 11852, 13061, 12655, 10624,
-    7091, 2382, -3002, -8293, -12400, -14256, -13443, -10460, -6277, -1692, 2851, 6973,
-    10102, 11630, 11273, 9288, 6354, 3222, 385, -2013, -4062, -5931, -7759, -9507,
-    -10808, -11037, -9718, -6894, -3062, 1209, 5481, 9314, 12139, 13372, 12581, 9540,
-    4386, -2051, -8206, -12444, -13979, -13141, -10743, -7342, -3166, 1473, 5970, 9631,
-    11985, 12872, 12386, 10766, 8303, 5260, 1856, -1684, -5100, -8077, -10209, -11019,
-    -10138, -7541, -3613, 984, 5498, 9242, 11727, 12750, 12262, 10152, 6325, 1126,
-    -4421, -9017, -11831, -12796, -12264, -10543, -7804, -4227, -69, 4346, 8547, 11844,
-    13508, 13126, 10802, 7062, 2629, -1778, -5593, -8469, -10199, -10600, -9544, -7132,
-    -3757, 66, 3907, 7475, 10549, 12885, 14116, 13731, 11299, 6949, 1599, -3456,
-    -7296, -9739, -11019, -11255, -10279, -7850, -3931, 1110, 6422, 10796, 13125, 12909,
-    10458, 6621, 2360, -1549, -4603, -6534, -7243, -6789, -5444, -3658, -1839, -91,
-    1786, 4006, 6547, 9114, 11200, 12127, 11259, 8449, 4343, 59, -3533, -6224,
-    -8199, -9538, -10022, -9270, -6954, -3021, 2050, 7181, 11086, 12931, 12687, 10836,
-    7864, 4046, -329, -4698, -8279, -10403, -10804, -9625, -7199, -3883, -106, 3584,
-    6697, 9039, 10673, 11553, 11350, 9777, 7022, 3709, 405, -2726, -5786, -8779,
-    -11390, -12961, -12614, -9679, -4338, 2095, 7776, 11422, 12865, 12602, 10995, 8024,
-    3721, -1376, -6281, -10016, -11998, -12115, -10607, -7942, -4716, -1496, 1416, 4044,
-    6500, 8625, 9913, 9853, 8295, 5494, 1864, -2168, -6165, -9707, -12451, -14034,
-    -13865, -11308, -6350, -103, 5598, 9311, 10737, 10474, 9206, 7206, 4414, 786,
-    -3447, -7654, -10879, -12204, -11287, -8632, -5240, -1903, 1212, 4325, 7416, 9900,
-    10957, 10169, 7822, 4601, 1113, -2290, -5375, -7946, -9904, -11189, -11563, -10596,
-    -8074, -4382, -359, 3277, 6247, 8497, 9856, 10018, 8747, 5976, 1825, -3220,
-    -8128, -11592, -12776, -11848, -9722, -7241, -4626, -1655, 1772, 5319, 8374, 10380,
-    11005, 10143, 7918, 4734, 1142, -2436, -5862, -8997, -11313, -11965, -10430, -7032,
-    -2743, 1524, 5331, 8532, 10901, 12048, 11546, 9073, 4585, -1342, -7348, -11786,
-    -13654, -13124, -11126, -8485, -5501, -2177, 1418, 5051, 8405, 11035, 12335, 11771,
-    9295, 5505, 1279, -2764, -6439, -9647, -11984, -12791, -11638, -8701, -4664, -322,
-    3717, 7109, 9754, 11672, 12713, 12310, 9738, 4868, -1301, -7067, -11085, -13032,
-    -13328, -12473, -10726, -8219, -5046, -1241, 3087, 7426, 10824, 12395, 11942, 10022,
-    7375, 4352, 883, -3083, -7164, -10549, -12389, -12259, -10355, -7323, -3829, -197,
-    3583, 7461, 10889, 12850, 12473, 9744, 5568, 1090, -3019, -6595, -9511, -11446,
-    -12155, -11702, -10206, -7487, -3300, 1975, 7096, 10627, 11883, 11198, 9354, 6862,
-    3742, -143, -4603, -8896, -11952, -12933, -11741, -9022, -5656, -2199, 1231, 4635,
-    7769, 10116, 11146, 10569, 8425, 5044, 1008, -2920, -6056, -8155, -9477, -10312,
-    -10375, -8855, -5262, -226, 4715, 8177, 9752, 9836, 8905, 7111, 4473, 1205,
-    -2225, -5244, -7349, -8254, -8020, -7031, -5769, -4545, -3391, -2119, -450, 1805,
-    4509, 7074, 8656, 8611, 6871, 3916, 411, -3154, -6495, -9245, -10735, -10228,
-    -7506, -3219, 1419, 5327, 8016, 9507, 10011, 9694, 8570, 6452, 3116, -1245,
-    -5721, -9013, -10235, -9439, -7378, -4835, -2207, 443, 3111, 5668, 7837, 9269,
-    9678, 8944, 7136, 4442, 1105, -2568, -6168, -9128, -10742, -10372, -7810, -3534,
-    1428, 5964, 9285, 11042, 11240, 10102, 7891, 4759, 778, -3730, -7958, -10834,
-    -11608, -10254, -7400, -3933, -640, 2056, 4210, 6178, 8174, 9900, 10669, 9943,
-    7747, 4595, 1057, -2553, -6106, -9286, -11365, -11466, -9171, -4942, 92, 4791,
-    8472, 10899, 12034, 11893, 10524, 7970, 4294, -220, -4879, -8733, -11031, -11575,
-    -10677, -8862, -6589, -4105, -1425, 1523, 4626, 7434, 9325, 9873, 9043, 7082,
-    4288, 898, -2849, -6564, -9635, -11354, -11215, -9198, -5782, -1712, 2288, 5685,
-    8202, 9745, 10173, 9122, 6187, 1481, -4031, -8929, -12182, -13605, -13574, -12436,
-    -10291, -7193, -3381, 732, 4669, 7951, 10124, 10845, 10016, 7849, 4782, 1289,
-    -2296, -5786, -8964, -11398, -12476, -11699, -8969, -4692, 378, 5401, 9683, 12714,
-    14042, 13189, 9894, 4561, -1625, -7205, -11200, -13382, -13941, -13055, -10874, -7704,
-    -3992, -93, 3776, 7309, 9946, 11089, 10514, 8502, 5560, 2059, -1826, -5854,
-    -9467, -11872, -12409, -10923, -7807, -3749, 574, 4652, 8118, 10661, 11947, 11636,
-    9554, 5917, 1381, -3219, -7225, -10267, -12126, -12651, -11860, -9977, -7219, -3588,
-    911, 5765, 9839, 11990, 11862, 10061, 7543, 4859, 1975, -1322, -4915, -8218,
-    -10454, -11079, -10018, -7613, -4362, -686, 3117, 6759, 9796, 11614, 11651, 9725,
-    6206, 1821, -2715, -6886, -10288, -12525, -13304, -12564, -10396, -6880, -2195, 3042,
-    7707, 10690, 11549, 10648, 8639, 5899, 2445, -1691, -6095, -9954, -12359, -12739,
-    -11121, -8053, -4264, -322, 3444, 6795, 9399, 10821, 10708, 9012, 6078, 2479,
-    -1237, -4711, -7726, -10126, -11768, -12425, -11634, -8804, -3786, 2506, 8228, 11651,
-    12250, 10783, 8373, 5592, 2347, -1505, -5624, -9184, -11358, -11783, -10685, -8608,
-    -6021, -3148, -86, 2997, 5804, 7984, 9229, 9310, 8112, 5685, 2279, -1650,
-    -5540, -8890, -11384, -12764, -12597, -10333, -5857, -15, 5586, 9501, 11233, 11146,
-    9753, 7224, 3545, -1052, -5882, -9997, -12534, -13024, -11553, -8671, -5092, -1354,
-    2290, 5697, 8568, 10378, 10638, 9272, 6740, 3718, 662, -2341, -5340, -8236,
-    -10698, -12220, -12185, -10063, -5813, -193, 5462, 9890, 12427, 12995, 11763, 8957,
-    4894, 101, -4674, -8534, -10629, -10509, -8418, -5242, -2021, 620, 2663, 4416,
-    6047, 7394, 8166, 8249, 7746, 6714, 5013, 2500, -669, -4023, -7027, -9191,
-    -9973, -8825, -5602, -936, 3986, 8057, 10674, 11630, 10846, 8363, 4521, 15,
-    -4293, -7645, -9566, -9944, -8998, -7145, -4801, -2224, 530, 3480, 6501, 9182,
-    10953, 11388, 10413, 8217, 5062, 1241, -2855, -6749, -9953, -11965, -12249, -10457,
-    -6782, -2018, 2876, 7232, 10695, 12940, 13607, 12543, 9944, 6184, 1625, -3269,
-    -7729, -10802, -11835, -10851, -8449, -5305, -1769, 2062, 5921, 9143, 10987, 11180,
-    10058, 8125, 5618, 2576, -783, -3959, -6457, -8021, -8558, -7970, -6188, -3305,
-    379, 4386, 8071, 10723, 11817, 11222, 9084, 5594, 1023, -3968, -8257, -10745,
-    -10999, -9434, -6853, -3855, -647, 2687, 5842, 8309, 9696, 9980, 9343, 7862,
-    5481, 2324, -1148, -4412, -7207, -9427, -10747, -10604, -8690, -5335, -1297, 2745,
-    6413, 9455, 11573, 12478, 11989, 10047, 6736, 2427, -2152, -6120, -8814, -10016,
-    -9891, -8730, -6744, -4034, -706, 2979, 6567, 9488, 11204, 11376, 10020, 7529,
-    4450, 1157, -2221, -5504, -8175, -9556, -9290, -7563, -4836, -1486, 2197, 5827,
-    8920, 11074, 11996, 11335, 8713, 4141, -1585, -7037, -10856, -12385, -11759, -9527,
-    -6246, -2352, 1739, 5535, 8520, 10303, 10716, 9825, 7882, 5254, 2283, -852,
-    -4098, -7254, -9739, -10758, -9807, -7043, -3188, 908, 4618, 7629, 9851, 11256,
-    11680, 10768, 8210, 4157, -602, -4981, -8164, -9915, -10449, -10096, -9066, -7343,
-    -4754, -1192, 3037, 7079, 9826, 10520, 9146, 6300, 2692, -1220, -5146, -8588,
-    -10677, -10534, -7936, -3643, 945, 4557, 6613, 7259, 7040, 6516, 5975, 5313,
-    4177, 2287, -289, -3146, -5754, -7632, -8432, -8002, -6412, -3843, -453, 3509,
-    7386, 10092, 10652, 8902, 5608, 1852, -1675, -4829, -7607, -9691, -10438, -9299,
-    -6304, -2171, 2056, 5541, 7961, 9417, 10156, 10333, 9856, 8404, 5672, 1767,
-    -2639, -6601, -9372, -10626, -10378, -8840, -6340, -3169, 543, 4673, 8699, 11616,
-    12475, 11097, 8170, 4648, 1104, -2338, -5595, -8250, -9580, -8935, -6185, -1913,
-    2799, 6833, 9437, 10370, 9846, 8327, 6214, 3660, 682, -2481, -5243, -7005,
-    -7584, -7242, -6348, -5117, -3600, -1737, 631, 3579, 6758, 9339, 10473, 9862,
-    7840, 4936, 1502, -2248, -5936, -8891, -10301, -9574, -6668, -2189, 2843, 7395,
-    10744, 12581, 12963, 12166, 10412, 7702, 4003, -323, -4405, -7345, -8807, -9100,
-    -8739, -8009, -6869, -5057, -2272, 1509, 5726, 9299, 11213, 11105, 9312, 6418,
-    2850, -1132, -5190, -8726, -10964, -11251, -9397, -5790, -1207, 3493, 7552, 10405,
-    11795, 11800, 10610, 8232, 4587, -32, -4719, -8349, -10238, -10418, -9365, -7585,
-    -5376, -2774, 343, 3938, 7516, 10190, 11198, 10367, 8089, 4914, 1216, -2748,
-    -6561, -9491, -10686, -9630, -6498, -2064, 2725, 7083, 10404, 12226, 12381, 11089,
-    8715, 5415, 1219, -3462, -7625, -10176, -10672, -9537, -7617, -5587, -3643, -1545,
-    1095, 4374, 7781, 10318, 11072, 9768, 6866, 3162, -706, -4438, -7835, -10443,
-    -11562, -10698, -8000, -4165, 45, 4084, 7483, 9756, 10631, 10240, 8845, 6424,
-    2788, -1812, -6405, -9803, -11361, -11203, -9855, -7775, -5191, -2163, 1251, 4796,
-    7935, 9986, 10461, 9349, 7068, 4152, 892, -2683, -6425, -9663, -11352, -10814,
-    -8299, -4724, -908, 2805, 6227, 8998, 10718, 11206, 10374, 8006, 4008, -1035,
-    -5828, -9108, -10460, -10352, -9515, -8343, -6776, -4550, -1540, 2014, 5478, 8055,
-    9155, 8674, 6992, 4656, 1971, -1097, -4511, -7650, -9400, -8951, -6484, -2976,
-    600, 3732, 6169, 7638, 7943, 7116, 5261, 2364, -1464, -5568, -8855, -10488,
-    -10427, -9240, -7493, -5408, -2985, -291, 2418, 4751, 6303, 6753, 5971, 4105,
-    1569, -1150, -3776, -6292, -8571, -10004, -9727, -7400, -3681, 207, 3353, 5523,
-    6814, 7269, 6870, 5643, 3563, 527, -3300, -7129, -9804, -10577, -9596, -7607,
-    -5246, -2681, 173, 3221, 6006, 7901, 8458, 7609, 5624, 2951, 79, -2609,
-    -4984, -7135, -9029, -10196, -9929, -7917, -4604, -850, 2660, 5587, 7692, 8711,
-    8513, 7162, 4733, 1259, -2953, -7042, -9892, -10847, -10083, -8278, -5995, -3404,
-    -503, 2503, 5112, 6768, 7193, 6457, 4813, 2528, -110, -2765, -5148, -7091,
-    -8386, -8608, -7317, -4549, -998, 2425, 5146, 7031, 8069, 8172, 7275, 5432,
-    2752, -589, -4169, -7243, -9081, -9431, -8612, -7137, -5281, -2996, -198, 2889,
-    5667, 7423, 7702, 6493, 4136, 1141, -1938, -4615, -6631, -7957, -8543, -8109,
-    -6342, -3367, 113, 3244, 5539, 6950, 7586, 7514, 6781, 5423, 3409, 733,
-    -2332, -5135, -6929, -7319, -6432, -4718, -2603, -313, 2038, 4248, 5941, 6713,
-    6379, 5043, 2970, 469, -2109, -4374, -6028, -6946, -7054, -6186, -4237, -1464,
-    1504, 4023, 5775, 6734, 6922, 6334, 5011, 3069, 652, -2036, -4621, -6590,
-    -7532, -7359, -6289, -4625, -2549, -110, 2592, 5210, 7160, 7918, 7326, 5600,
-    3092, 130, -2923, -5627, -7592, -8591, -8469, -7043, -4282, -608, 3122, 6029,
-    7636, 7920, 7123, 5568, 3544, 1236, -1276, -3865, -6194, -7765, -8154, -7232,
-    -5212, -2532, 339, 3030, 5252, 6684, 6975, 5959, 3845, 1124, -1723, -4342,
-    -6407, -7587, -7718, -6922, -5446, -3428, -964, 1643, 3824, 5047, 5137, 4305,
-    2912, 1247, -532, -2331, -3994, -5261, -5856, -5650, -4715, -3240, -1422, 564,
-    2545, 4355, 5796, 6567, 6318, 4903, 2586, -73, -2556, -4590, -6082, -6963,
-    -7156, -6599, -5219, -2960, 26, 3196, 5723, 6909, 6568, 5058, 2970, 764,
-    -1373, -3383, -5117, -6288, -6653, -6199, -5109, -3584, -1747, 301, 2405, 4354,
-    5884, 6650, 6304, 4724, 2209, -617, -3114, -4877, -5752, -5745, -4959, -3548,
-    -1678, 491, 2726, 4638, 5735, 5647, 4374, 2310, 17, -2115, -3967, -5480,
-    -6393, -6307, -5044, -2896, -443, 1843, 3786, 5371, 6543, 7158, 7034, 6011,
-    4045, 1347, -1564, -4026, -5559, -6046, -5679, -4735, -3389, -1689, 336, 2551,
-    4645, 6166, 6658, 5852, 3847, 1134, -1627, -3932, -5561, -6363, -6049, -4346,
-    -1423, 1944, 4766, 6433, 6929, 6571, 5649, 4322, 2697, 879, -1049, -2972,
-    -4657, -5750, -5951, -5224, -3797, -1991, -23, 1986, 3872, 5349, 6086, 5870,
-    4671, 2622, 24, -2658, -4909, -6373, -6933, -6558, -5143, -2642, 606, 3814,
-    6148, 7236, 7273, 6662, 5630, 4189, 2339, 200, -2042, -4187, -5987, -7098,
-    -7200, -6211, -4355, -1998, 567, 3125, 5391, 6946, 7405, 6628, 4780, 2226,
-    -595, -3236, -5335, -6698, -7233, -6777, -5052, -1970, 1991, 5809, 8441, 9385,
-    8784, 7058, 4563, 1566, -1581, -4422, -6566, -7812, -8073, -7258, -5351, -2633,
-    323, 2959, 5046, 6626, 7651, 7789, 6672, 4298, 1129, -2163, -5010, -7062,
-    -8143, -8198, -7222, -5184, -2096, 1730, 5496, 8133, 8880, 7713, 5242, 2214,
-    -860, -3679, -5926, -7226, -7346, -6379, -4647, -2465, -56, 2332, 4367, 5821,
-    6736, 7263, 7289, 6357, 4113, 808, -2730, -5633, -7467, -8229, -8035, -6922,
-    -4888, -2024, 1381, 4799, 7520, 8885, 8599, 6864, 4203, 1141, -1968, -4844,
-    -7108, -8296, -8101, -6599, -4196, -1360, 1550, 4229, 6338, 7612, 8027, 7696,
-    6585, 4484, 1398, -2116, -5149, -7026, -7654, -7301, -6179, -4301, -1681, 1433,
-    4530, 7001, 8334, 8258, 6800, 4259, 1114, -2123, -5033, -7296, -8605, -8625,
-    -7162, -4399, -916, 2582, 5546, 7648, 8722, 8795, 8083, 6804, 4927, 2274,
-    -1037, -4374, -6915, -8215, -8356, -7606, -6060, -3661, -506, 2964, 6060, 8105,
-    8665, 7631, 5212, 1881, -1707, -4912, -7323, -8772, -9111, -8073, -5521, -1834,
-    2089, 5336, 7458, 8467, 8512, 7708, 6165, 3991, 1239, -1953, -5128, -7532,
-    -8570, -8208, -6885, -5037, -2795, -122, 2831, 5563, 7396, 7852, 6880, 4790,
-    2017, -1031, -3965, -6435, -8197, -9076, -8779, -6920, -3443, 950, 5018, 7762,
-    8962, 8958, 8074, 6380, 3913, 907, -2222, -4985, -6911, -7666, -7227, -5905,
-    -4128, -2148, 29, 2463, 5002, 7151, 8251, 7875, 6122, 3509, 601, -2229,
-    -4733, -6645, -7669, -7538, -6035, -3129, 736, 4545, 7172, 8061, 7447, 5918,
-    3893, 1543, -946, -3230, -4937, -5827, -5831, -5028, -3603, -1794, 186, 2188,
-    4116, 5851, 7121, 7436, 6300, 3661, 152, -3219, -5703, -7113, -7598, -7273,
-    -6131, -4180, -1564, 1393, 4143, 6017, 6542, 5739, 4051, 1962, -260, -2497,
-    -4579, -6220, -7083, -6907, -5637, -3508, -977, 1490, 3580, 5157, 6194, 6674,
-    6464, 5256, 2819, -568, -3999, -6430, -7392, -7152, -6237, -4922, -3210, -1138,
-    1031, 2876, 4002, 4174, 3416, 1992, 268, -1461, -3037, -4377, -5381, -5848,
-    -5485, -4076, -1784, 765, 2805, 3902, 4132, 3831, 3269, 2533, 1554, 188,
-    -1618, -3595, -5177, -5875, -5672, -4920, -3874, -2445, -457, 1918, 4072, 5287,
-    5149, 3722, 1430, -1203, -3738, -5859, -7321, -7954, -7672, -6437, -4234, -1229,
-    2014, 4624, 5915, 5841, 4895, 3586, 2096, 398, -1442, -3177, -4481, -5077,
-    -4835, -3860, -2481, -1041, 348, 1783, 3316, 4710, 5493, 5238, 3833, 1578,
-    -979, -3313, -5101, -6213, -6601, -6258, -5225, -3566, -1352, 1223, 3677, 5346,
-    5779, 5020, 3455, 1421, -944, -3476, -5778, -7309, -7688, -6858, -5063, -2703,
-    -198, 2108, 3995, 5356, 6150, 6324, 5768, 4345, 2087, -636, -3193, -5043,
-    -6003, -6157, -5563, -4175, -2031, 573, 3156, 5223, 6370, 6359, 5234, 3370,
-    1282, -691, -2500, -4166, -5499, -6075, -5524, -3856, -1513, 904, 2975, 4565,
-    5674, 6251, 6195, 5432, 3919, 1659, -1129, -3844, -5676, -6130, -5352, -3866,
-    -2040, 100, 2522, 4846, 6448, 6876, 6093, 4389, 2158, -219, -2403, -4142,
-    -5325, -5934, -5891, -4991, -3071, -321, 2652, 5130, 6717, 7435, 7419, 6638,
-    4992, 2607, -89, -2572, -4442, -5435, -5406, -4422, -2800, -919, 1029, 3017,
-    4867, 6076, 6062, 4625, 2173, -527, -2805, -4362, -5188, -5317, -4711, -3342,
-    -1309, 1121, 3558, 5527, 6547, 6341, 5053, 3208, 1342, -342, -1932, -3466,
-    -4682, -5162, -4662, -3296, -1444, 495, 2266, 3789, 5055, 5978, 6333, 5812,
-    4228, 1710, -1243, -3926, -5736, -6423, -6079, -4933, -3168, -956, 1402, 3461,
-    4793, 5159, 4532, 3050, 1006, -1205, -3217, -4832, -5952, -6381, -5780, -3948,
-    -1144, 1920, 4476, 6103, 6785, 6670, 5846, 4339, 2242, -223, -2748, -4975,
-    -6495, -6934, -6171, -4482, -2370, -194, 1986, 4144, 5945, 6813, 6367, 4741,
-    2427, -85, -2453, -4395, -5652, -6112, -5831, -4862, -3117, -564, 2443, 5134,
-    6751, 7011, 6173, 4688, 2873, 888, -1088, -2792, -3993, -4592, -4551, -3795,
-    -2295, -251, 1921, 3832, 5300, 6210, 6284, 5175, 2858, -147, -3042, -5214,
-    -6436, -6717, -6117, -4748, -2812, -547, 1847, 4155, 6020, 6986, 6741, 5362,
-    3286, 1000, -1227, -3321, -5135, -6290, -6369, -5283, -3371, -1149, 1008, 2924,
-    4503, 5673, 6401, 6623, 6115, 4567, 1943, -1236, -4063, -5786, -6224, -5694,
-    -4597, -3088, -1144, 1146, 3417, 5157, 5979, 5724, 4400, 2173, -561, -3195,
-    -5189, -6306, -6518, -5722, -3747, -724, 2666, 5494, 7169, 7713, 7486, 6772,
-    5636, 4047, 2037, -264, -2626, -4681, -5961, -6082, -4993, -3035, -704, 1656,
-    3901, 5829, 7009, 6995, 5714, 3573, 1147, -1172, -3214, -4873, -6024, -6532,
-    -6219, -4855, -2339, 978, 4261, 6599, 7550, 7301, 6357, 5097, 3596, 1767,
-    -377, -2582, -4421, -5468, -5469, -4425, -2587, -359, 1895, 3982, 5782, 7007,
-    7172, 5942, 3538, 706, -1779, -3561, -4733, -5522, -5997, -6004, -5259, -3553,
-    -986, 1932, 4444, 5897, 6038, 5034, 3248, 993, -1522, -4022, -6005, -6855,
-    -6230, -4355, -1899, 482, 2453, 3956, 4975, 5389, 4965, 3457, 803, -2619,
-    -5939, -8160, -8708, -7724, -5820, -3591, -1307, 1003, 3243, 5069, 5983, 5625,
-    4005, 1491, -1369, -4049, -6188, -7649, -8438, -8483, -7502, -5220, -1829, 1851,
-    4803, 6459, 6900, 6514, 5557, 4052, 1972, -593, -3384, -5945, -7665, -7966,
-    -6629, -3988, -771, 2299, 4808, 6590, 7442, 7013, 5081, 1933, -1638, -4775,
-    -6996, -8221, -8500, -7842, -6233, -3714, -407, 3387, 7023, 9575, 10262, 8935,
-    6136, 2686, -803, -4063, -6931, -9073, -9980, -9263, -6969, -3631, -2, 3295,
-    5944, 7886, 9136, 9585, 8914, 6774, 3188, -1170, -5178, -7871, -8914, -8564,
-    -7250, -5224, -2544, 715, 4217, 7298, 9144, 9186, 7422, 4419, 963, -2330,
-    -5174, -7459, -8976, -9318, -8075, -5213, -1266, 2866, 6374, 8839, 10169, 10363,
-    9364, 7100, 3635, -666, -5047, -8505, -10189, -9810, -7714, -4567, -973, 2670,
-    6043, 8725, 10183, 9992, 8121, 5017, 1393, -2115, -5129, -7446, -8874, -9193,
-    -8199, -5792, -2132, 2205, 6269, 9112, 10253, 9819, 8260, 5965, 3147, -8,
-    -3154, -5772, -7328, -7483, -6219, -3820, -747, 2503, 5488, 7859, 9330, 9620,
-    8444, 5710, 1790, -2450, -6008, -8202, -8849, -8097, -6208, -3494, -323, 2892,
-    5712, 7666, 8330, 7541, 5540, 2871, 73, -2526, -4766, -6481, -7415, -7305,
-    -6044, -3790, -932, 2054, 4755, 6880, 8239, 8691, 8081, 6244, 3156, -804,
-    -4776, -7758, -9138, -8929, -7514, -5227, -2257, 1150, 4534, 7312, 8977, 9208,
-    7941, 5427, 2213, -1051, -3895, -6126, -7664, -8276, -7548, -5196, -1487, 2671,
-    6151, 8223, 8810, 8238, 6807, 4647, 1872, -1236, -4219, -6541, -7680, -7257,
-    -5218, -1952, 1812, 5314, 8040, 9741, 10239, 9286, 6711, 2781, -1645, -5449,
-    -7846, -8692, -8259, -6832, -4562, -1639, 1579, 4639, 7133, 8710, 9061, 8038,
-    5796, 2768, -556, -3793, -6584, -8427, -8730, -7152, -3935, 120, 4061, 7203,
-    9245, 10099, 9707, 8032, 5166, 1433, -2560, -5985, -8041, -8340, -7124, -5021,
-    -2540, 190, 3179, 6165, 8531, 9611, 9055, 6960, 3777, 158, -3242, -5983,
-    -7925, -9031, -9051, -7503, -4118, 630, 5506, 9151, 10849, 10729, 9309, 6964,
-    3838, 158, -3540, -6531, -8201, -8227, -6614, -3726, -256, 3010, 5577, 7408,
-    8649, 9173, 8493, 6207, 2560, -1505, -4901, -7056, -8056, -8209, -7561, -5869,
-    -3016, 652, 4384, 7367, 9000, 8990, 7365, 4490, 969, -2607, -5847, -8464,
-    -10008, -9827, -7482, -3275, 1692, 6081, 9041, 10433, 10495, 9391, 7106, 3701,
-    -460, -4702, -8225, -10312, -10569, -9080, -6358, -3024, 525, 4129, 7539, 10180,
-    11301, 10424, 7655, 3605, -916, -5172, -8630, -10962, -11978, -11499, -9315, -5385,
-    -186, 5164, 9301, 11300, 11064, 9087, 5919, 1931, -2465, -6534, -9322, -10093,
-    -8677, -5480, -1277, 3006, 6496, 8637, 9376, 9007, 7730, 5405, 1844, -2603,
-    -6863, -9688, -10449, -9401, -7228, -4421, -1117, 2579, 6254, 9210, 10734, 10361,
-    8024, 4127, -475, -4750, -7938, -9849, -10678, -10492, -8949, -5646, -804, 4480,
-    8729, 10947, 11036, 9514, 6966, 3794, 321, -3067, -5950, -7938, -8693, -7979,
-    -5864, -2876, 196, 2781, 4806, 6473, 7730, 8083, 6969, 4315, 703, -2976,
-    -5986, -7911, -8560, -7864, -5902, -2932, 635, 4238, 7147, 8574, 8031, 5678,
-    2288, -1225, -4276, -6650, -8187, -8551, -7399, -4763, -1206, 2400, 5297, 7119,
-    7903, 7909, 7390, 6394, 4709, 2068, -1443, -5134, -7941, -9051, -8355, -6327,
-    -3510, -192, 3427, 6867, 9316, 10000, 8639, 5615, 1765, -1988, -4949, -6808,
-    -7614, -7585, -6841, -5264, -2665, 829, 4532, 7430, 8749, 8357, 6630, 4019,
-    822, -2647, -5816, -7928, -8423, -7244, -4801, -1703, 1516, 4504, 7044, 8924,
-    9835, 9383, 7281, 3639, -886, -5262, -8520, -10141, -10110, -8643, -5945, -2259,
-    1901, 5668, 8093, 8585, 7177, 4450, 1220, -1819, -4305, -6183, -7453, -7913,
-    -7148, -4869, -1346, 2492, 5482, 6875, 6691, 5464, 3698, 1556, -964, -3658,
-    -6017, -7461, -7614, -6393, -3949, -647, 2956, 6235, 8668, 9881, 9561, 7470,
-    3695, -1080, -5658, -8864, -10118, -9598, -7885, -5488, -2681, 321, 3151, 5343,
-    6551, 6676, 5799, 4053, 1602, -1295, -4264, -6847, -8523, -8777, -7294, -4255,
-    -444, 3033, 5314, 6195, 6054, 5382, 4369, 2903, 921, -1319, -3305, -4578,
-    -4920, -4338, -2971, -1081, 971, 2841, 4315, 5243, 5394, 4503, 2577, 118,
-    -2085, -3480, -4079, -4257, -4268, -3993, -3133, -1589, 373, 2271, 3649, 4196,
-    3768, 2420, 453, -1658, -3461, -4670, -5121, -4671, -3262, -1133, 1103, 2730,
-    3355, 3091, 2339, 1421, 449, -515, -1257, -1460, -948, 123, 1303, 2091,
-    2169, 1546, 567, -236, -452, -85, 445, 638, 311, -347, -1068, -1762,
-    -2422, -2840, -2550, -1188, 1087, 3545, 5264, 5591, 4351, 1839, -1264, -4050,
-    -5719, -5991, -5209, -3943, -2454, -637, 1522, 3546, 4719, 4727, 3917, 2849,
-    1696, 222, -1682, -3591, -4779, -4785, -3700, -1953, 41, 1994, 3668, 4860,
-    5487, 5577, 5100, 3881, 1799, -860, -3361, -4950, -5356, -4832, -3714, -2034,
-    345, 3238, 5908, 7397, 7128, 5212, 2282, -874, -3603, -5520, -6552, -6813,
-    -6337, -4914, -2309, 1234, 4785, 7164, 7724, 6715, 4901, 2875, 775, -1421,
-    -3517, -5075, -5719, -5368, -4171, -2324, -27, 2433, 4689, 6422, 7445, 7577,
-    6525, 4050, 406, -3440, -6208, -7050, -5982, -3629, -655, 2462, 5238, 7037,
-    7325, 6089, 3886, 1442, -781, -2654, -4156, -5215, -5705, -5489, -4428, -2434,
-    348, 3397, 5948, 7369, 7442, 6330, 4314, 1632, -1431, -4372, -6510, -7277,
-    -6516, -4524, -1846, 959, 3426, 5218, 6165, 6265, 5558, 3992, 1520, -1593,
-    -4609, -6611, -7061, -6085, -4200, -1851, 732, 3286, 5306, 6202, 5669, 3860,
-    1252, -1600, -4177, -6020, -6819, -6557, -5517, -4075, -2441, -629, 1327, 3184,
-    4562, 5202, 5099, 4349, 2942, 802, -1941, -4775, -6960, -7878, -7270, -5259,
-    -2259, 1113, 4187, 6438, 7570, 7423, 5888, 3036, -613, -4109, -6537, -7565,
-    -7538, -7012, -6215, -4943, -2927, -225, 2687, 5148, 6591, 6692, 5412, 2981,
-    -146, -3437, -6452, -8873, -10331, -10279, -8223, -4286, 494, 4585, 6886, 7306,
-    6476, 4969, 2890, 159, -2975, -5848, -7725, -8184, -7196, -5022, -2091, 1097,
-    4080, 6484, 7944, 8037, 6418, 3127, -1224, -5607, -8991, -10713, -10599, -8871,
-    -5972, -2447, 1114, 4122, 6087, 6732, 6070, 4340, 1882, -959, -3863, -6531,
-    -8634, -9727, -9270, -6920, -2958, 1577, 5362, 7541, 8050, 7232, 5258, 2085,
-    -2038, -6187, -9071, -9794, -8346, -5450, -2016, 1282, 4073, 6167, 7423, 7696,
-    6814, 4644, 1260, -2847, -6753, -9427, -10219, -9143, -6705, -3485, 94, 3612,
-    6415, 7705, 6965, 4348, 636, -3157, -6230, -8192, -8994, -8709, -7358, -4934,
-    -1633, 1960, 4995, 6780, 7122, 6253, 4459, 1850, -1480, -5131, -8301, -10062,
-    -9808, -7538, -3826, 458, 4459, 7532, 9276, 9500, 8195, 5513, 1752, -2594,
-    -6734, -9660, -10539, -9220, -6352, -2900, 485, 3603, 6289, 8043, 8236, 6639,
-    3682, 170, -3180, -5963, -8008, -9217, -9459, -8542, -6326, -2968, 907, 4359,
-    6574, 7215, 6395, 4410, 1571, -1741, -4986, -7519, -8773, -8445, -6601, -3677,
-    -344, 2755, 5216, 6883, 7653, 7314, 5596, 2433, -1733, -5887, -8767, -9494,
-    -8073, -5304, -2136, 943, 3878, 6514, 8251, 8375, 6710, 3856, 761, -1902,
-    -3971, -5582, -6858, -7768, -8100, -7476, -5499, -2099, 2152, 6140, 8752, 9448,
-    8375, 6021, 2833, -804, -4364, -7109, -8345, -7776, -5647, -2554, 834, 3971,
-    6468, 8052, 8503, 7655, 5502, 2354, -1124, -4128, -6067, -6759, -6319, -4881,
-    -2506, 642, 4037, 6800, 8056, 7418, 5217, 2255, -687, -3197, -5184, -6587,
-    -7204, -6788, -5225, -2623, 672, 4057, 6738, 8052, 7853, 6540, 4602, 2165,
-    -886, -4298, -7127, -8161, -6776, -3380, 888, 4833, 7660, 9053, 9014, 7715,
-    5388, 2304, -1148, -4378, -6674, -7482, -6688, -4647, -1942, 921, 3634, 5994,
-    7721, 8400, 7629, 5297, 1761, -2222, -5768, -8163, -9014, -8239, -5998, -2616,
-    1427, 5467, 8670, 10230, 9733, 7419, 4053, 436, -3008, -6161, -8772, -10184,
-    -9621, -6810, -2343, 2577, 6776, 9601, 10939, 10928, 9703, 7345, 3983, -99,
-    -4378, -8050, -10186, -10118, -7863, -4157, -3, 3880, 7166, 9566, 10529, 9458,
-    6273, 1712, -2954, -6553, -8477, -8742, -7695, -5690, -2929, 422, 3992, 7079,
-    8870, 8841, 7015, 3885, 118, -3652, -6855, -8930, -9343, -7745, -4225, 512,
-    5260, 8786, 10394, 10133, 8510, 6027, 2959, -501, -4019, -7035, -8850, -8886,
-    -7007, -3728, 4, 3386, 6169, 8430, 9948, 9958, 7731, 3404, -1790, -6175,
-    -8567, -8762, -7373, -5277, -3085, -890, 1557, 4379, 7181, 9119, 9406, 7793,
-    4688, 878, -2854, -5938, -8032, -8871, -8163, -5707, -1721, 2949, 7076, 9635,
-    10250, 9146, 6794, 3672, 268, -2898, -5339, -6699, -6779, -5581, -3396, -736,
-    1956, 4545, 7001, 8932, 9480, 7917, 4406, 67, -3771, -6385, -7776, -8142,
-    -7429, -5416, -2142, 1841, 5610, 8222, 9016, 7787, 4875, 1119, -2434, -5023,
-    -6537, -7352, -7724, -7329, -5512, -2091, 2118, 5725, 7761, 8245, 7777, 6698,
-    4792, 1809, -1885, -5288, -7381, -7697, -6361, -3773, -417, 3081, 5958, 7583,
-    7771, 6774, 4926, 2390, -687, -3849, -6329, -7469, -7111, -5505, -2920, 474,
-    4302, 7679, 9449, 8862, 6060, 1949, -2348, -5975, -8482, -9697, -9524, -7854,
-    -4671, -333, 4272, 7956, 9796, 9586, 7792, 5113, 2049, -1174, -4407, -7320,
-    -9312, -9664, -7931, -4322, 248, 4585, 7811, 9642, 10215, 9699, 8093, 5313,
-    1470, -2872, -6678, -8817, -8684, -6580, -3440, -148, 2874, 5454, 7241, 7704,
-    6567, 4113, 987, -2198, -5015, -7085, -8029, -7619, -5912, -3195, 117, 3451,
-    6044, 7160, 6475, 4263, 1166, -2186, -5331, -7845, -9202, -8867, -6616, -2844,
-    1436, 4982, 6945, 7291, 6666, 5765, 4765, 3280, 863, -2408, -5757, -8057,
-    -8451, -6826, -3817, -350, 2900, 5656, 7732, 8674, 7873, 5090, 853, -3692,
-    -7355, -9385, -9576, -8155, -5644, -2693, 162, 2698, 4891, 6563, 7191, 6218,
-    3607, 35, -3524, -6401, -8376, -9302, -8805, -6575, -2929, 1063, 4194, 5898,
-    6389, 6104, 5141, 3315, 672, -2213, -4507, -5655, -5629, -4754, -3381, -1742,
-    21, 1815, 3573, 5146, 6099, 5709, 3413, -517, -4771, -7668, -8262, -6862,
-    -4504, -1964, 637, 3355, 5783, 7053, 6453, 3983, 377, -3288, -6018, -7234,
-    -6958, -5744, -4269, -2839, -1274, 726, 3114, 5391, 6880, 7085, 5871, 3461,
-    345, -2869, -5574, -7239, -7447, -6016, -3171, 439, 3966, 6690, 8181, 8238,
-    6819, 4085, 476, -3300, -6410, -8121, -8102, -6601, -4276, -1676, 1135, 4315,
-    7538, 9694, 9533, 6696, 2100, -2696, -6457, -8717, -9538, -9137, -7715, -5431,
-    -2383, 1311, 5255, 8596, 10305, 9808, 7413, 4070, 651, -2534, -5578, -8371,
-    -10231, -10195, -7741, -3300, 1905, 6539, 9743, 11232, 10998, 9070, 5583, 994,
-    -3843, -7885, -10250, -10500, -8734, -5457, -1352, 2910, 6708, 9400, 10376, 9297,
-    6375, 2387, -1694, -5167, -7780, -9493, -10120, -9271, -6669, -2531, 2329, 6741,
-    9561, 10026, 8046, 4292, -87, -4068, -7180, -9338, -10281, -9387, -6254, -1444,
-    3542, 7195, 8933, 9132, 8364, 6769, 4156, 567, -3396, -6772, -8698, -8758,
-    -7049, -4040, -350, 3423, 6738, 9080, 9966, 9052, 6297, 2112, -2612, -6689,
-    -9104, -9517, -8341, -6254, -3602, -365, 3278, 6520, 8251, 7861, 5666, 2570,
-    -584, -3334, -5476, -6853, -7257, -6444, -4263, -942, 2674, 5348, 6168, 5172,
-    3210, 1154, -723, -2598, -4478, -5863, -6017, -4532, -1644, 1848, 4942, 6838,
-    7225, 6312, 4571, 2381, -136, -2960, -5839, -8087, -8749, -7132, -3367, 1468,
-    5877, 8771, 9879, 9448, 7665, 4527, 277, -4233, -7806, -9600, -9509, -7913,
-    -5220, -1772, 1936, 5182, 7337, 8176, 7820, 6397, 3918, 529, -3234, -6560,
-    -8772, -9556, -8851, -6644, -3032, 1508, 6024, 9412, 10916, 10417, 8317, 5184,
-    1511, -2295, -5763, -8300, -9335, -8599, -6280, -2927, 852, 4608, 8021, 10707,
-    12106, 11629, 8972, 4419, -1085, -6208, -9752, -11173, -10706, -8993, -6532, -3447,
-    254, 4254, 7810, 10033, 10315, 8579, 5275, 1188, -2872, -6347, -8981, -10544,
-    -10552, -8432, -4130, 1410, 6526, 9759, 10624, 9581, 7379, 4480, 1072, -2553,
-    -5749, -7674, -7694, -5745, -2406, 1345, 4582, 6810, 8009, 8321, 7721, 6009,
-    3143, -456, -3966, -6556, -7777, -7643, -6410, -4291, -1381, 2162, 5860, 8852,
-    10169, 9202, 6053, 1514, -3279, -7293, -9883, -10792, -9937, -7245, -2805, 2739,
-    7994, 11264, 11473, 8818, 4497, -201, -4548, -8218, -10712, -11232, -9188, -4808,
-    829, 6292, 10338, 12147, 11398, 8353, 3870, -860, -4807, -7446, -8705, -8638,
-    -7217, -4446, -627, 3583, 7395, 10142, 11293, 10363, 7105, 1975, -3650, -8039,
-    -10108, -9937, -8264, -5600, -1973, 2473, 6900, 9976, 10656, 8731, 4750, -320,
-    -5329, -9165, -11127, -11187, -9759, -7135, -3273, 1721, 6949, 10776, 11730, 9508,
-    5168, 376, -3594, -6303, -7822, -8153, -7059, -4444, -779, 2981, 5936, 7658,
-    8129, 7470, 5899, 3861, 1898, 216, -1485, -3524, -5565, -6566, -5554, -2426,
-    1957, 6296, 9355, 10178, 8325, 4248, -621, -4508, -6348, -6292, -5198, -3651,
-    -1537, 1435, 4897, 7601, 8130, 5945, 1897, -2212, -4680, -4845, -3370, -1735,
-    -1260, -2220, -3614, -3845, -1947, 1580, 5048, 6837, 6587, 5286, 4239, 3875,
-    3485, 2027, -791, -4112, -6493, -6866, -5152, -2158, 990, 3432, 4859, 5432,
-    5478, 5144, 4228, 2384, -428, -3624, -6159, -7092, -6086, -3510, -181, 2961,
-    5088, 5696, 4820, 3041, 1169, -256, -1239, -2156, -3297, -4497, -5145, -4575,
-    -2592, 268, 2981, 4664, 5126, 4877, 4549, 4226, 3303, 1061, -2473, -6146,
-    -8199, -7400, -3947, 588, 4271, 6021, 6118, 5686, 5613, 5781, 5203, 2929,
-    -1011, -5427, -8688, -9713, -8422, -5413, -1402, 2975, 6975, 9654, 10180, 8282,
-    4428, -392, -5042, -8531, -10206, -9850, -7657, -4081, 304, 4811, 8631, 10956,
-    11266, 9561, 6346, 2345, -1842, -5902, -9606, -12370, -13119, -10829, -5512, 1319,
-    7345, 10864, 11656, 10564, 8380, 5246, 1058, -3762, -8046, -10422, -10082, -7176,
-    -2642, 2303, 6666, 9878, 11634, 11627, 9518, 5268, -494, -6440, -10993, -12967,
-    -12016, -8651, -3869, 1330, 6185, 10083, 12372, 12418, 9959, 5426, -127, -5467,
-    -9630, -12125, -12838, -11848, -9299, -5424, -709, 4015, 7748, 9734, 9772, 8133,
-    5197, 1249, -3362, -7932, -11363, -12534, -10849, -6668, -1283, 3649, 6933, 8305,
-    8151, 6797, 4196, 381, -3910, -7285, -8500, -7242, -4186, -455, 2972, 5509,
-    6955, 7345, 6755, 5175, 2641, -487, -3451, -5438, -6038, -5398, -4032, -2520,
-    -1311, -541, 36, 809, 1827, 2550, 2272, 858, -1012, -2372, -2712, -2193,
-    -1311, -502, -32, -10, -354, -799, -1141, -1484, -2173, -3362, -4659, -5239,
-    -4408, -2161, 695, 2968, 3781, 3055, 1453, -168, -1330, -2132, -2980, -4114,
-    -5273, -5722, -4680, -1963, 1636, 4650, 5843, 5022, 3034, 947, -777, -2370,
-    -4135, -5820, -6639, -5873, -3460, -88, 3163, 5271, 5574, 3975, 1138, -1585,
-    -2782, -1958, -16, 1373, 1106, -508, -2185, -2845, -2377, -1423, -669, -392,
-    -466, -534, -178, 793, 2046, 2770, 2237, 488, -1551, -2722, -2515, -1432,
-    -538, -546, -1206, -1521, -655, 1225, 2981, 3429, 2340, 608, -524, -428,
-    549, 1465, 1456, 235, -1774, -3651, -4419, -3517, -1058, 2219, 5226, 6878,
-    6444, 3863, -179, -4548, -8197, -10531, -11312, -10345, -7398, -2579, 3229, 8426,
-    11387, 11301, 8504, 4137, -516, -4480, -7217, -8559, -8634, -7698, -5932, -3364,
-    -112, 3314, 6080, 7543, 7704, 7053, 5927, 4115, 1197, -2722, -6651, -9161,
-    -9284, -7082, -3448, 600, 4444, 7756, 9986, 10193, 7615, 2526, -3566, -8699,
-    -11571, -11984, -10431, -7436, -3328, 1519, 6397, 10217, 11774, 10246, 5747, -483,
-    -6595, -11090, -13413, -13719, -12173, -8702, -3434, 2766, 8357, 11808, 12338, 10202,
-    6453, 2366, -1175, -3984, -6322, -8267, -9282, -8486, -5424, -672, 4320, 8011,
-    9576, 9146, 7386, 4847, 1684, -2023, -5747, -8446, -9138, -7548, -4210, 7,
-    4305, 7925, 9942, 9492, 6386, 1509, -3550, -7386, -9436, -9888, -9062, -6947,
-    -3371, 1391, 6195, 9338, 9467, 6419, 1370, -3819, -7576, -9284, -9303, -8389,
-    -6964, -4802, -1448, 2951, 7257, 9879, 9845, 7426, 3786, 90, -3086, -5662,
-    -7621, -8707, -8479, -6589, -3093, 1397, 5858, 9260, 10934, 10689, 8682, 5299,
-    1140, -3010, -6336, -8216, -8365, -6839, -3923, 17, 4554, 9002, 12170, 12575,
-    9357, 3263, -3402, -8172, -10025, -9681, -8405, -6635, -3886, 188, 4869, 8583,
-    9956, 8706, 5723, 2442, -3, -1346, -2162, -3216, -4673, -5819, -5618, -3642,
-    -556, 2282, 3780, 3845, 3351, 3364, 4244, 5321, 5408, 3730, 534, -3052,
-    -5696, -6519, -5347, -2642, 736, 3801, 5762, 6256, 5387, 3568, 1318, -864,
-    -2564, -3498, -3560, -2827, -1572, -289, 384, -2, -1245, -2370, -2182, -215,
-    2746, 5150, 5820, 4734, 2775, 817, -900, -2588, -4318, -5708, -6125, -5075,
-    -2453, 1345, 5359, 8231, 8755, 6587, 2547, -1804, -4979, -6198, -5518, -3611,
-    -1363, 551, 1985, 3261, 4697, 6077, 6627, 5577, 2857, -694, -3806, -5573,
-    -5962, -5665, -5380, -5098, -4055, -1463, 2535, 6603, 8979, 8670, 6120, 2808,
-    183, -1260, -2103, -3298, -5183, -6980, -7234, -4948, -499, 4456, 8030, 9222,
-    8242, 5995, 3375, 939, -1028, -2409, -3205, -3451, -3074, -1904, 48, 2299,
-    3992, 4417, 3512, 1892, 411, -353, -328, 139, 572, 716, 763, 1222,
-    2389, 3821, 4398, 3145, 153, -3255, -5356, -5184, -3070, -267, 1956, 3018,
-    3152, 2984, 2927, 2826, 2113, 384, -2106, -4450, -5672, -5390, -4026, -2387,
-    -984, 309, 1970, 4146, 6235, 7176, 6232, 3534, -107, -3800, -6905, -8854,
-    -8980, -6862, -2876, 1789, 5862, 8709, 10290, 10537, 9067, 5649, 844, -4018,
-    -7565, -9052, -8430, -6045, -2461, 1542, 5118, 7715, 9242, 9777, 9149, 6979,
-    3245, -1291, -5348, -7896, -8692, -8088, -6440, -3779, -55, 4363, 8492, 11058,
-    11111, 8508, 3980, -1235, -5932, -9345, -11183, -11368, -9798, -6409, -1512, 3946,
-    8595, 11245, 11471, 9665, 6569, 2743, -1514, -5809, -9330, -11044, -10302, -7326,
-    -3114, 1132, 4577, 6936, 8263, 8645, 8010, 6186, 3148, -694, -4447, -7111,
-    -8137, -7704, -6395, -4576, -2143, 1093, 4773, 7793, 8842, 7260, 3546, -853,
-    -4340, -6021, -6090, -5474, -4962, -4517, -3362, -868, 2575, 5552, 6584, 5240,
-    2421, -359, -2020, -2441, -2220, -2064, -2295, -2731, -2882, -2339, -1130, 198,
-    932, 752, 34, -437, -111, 876, 1818, 1999, 1181, -306, -1869, -3051,
-    -3739, -4103, -4331, -4373, -3895, -2532, -260, 2406, 4565, 5356, 4400, 2028,
-    -800, -2895, -3447, -2539, -1165, -584, -1373, -2961, -4076, -3766, -2111, -19,
-    1608, 2511, 2999, 3407, 3676, 3419, 2299, 342, -2019, -4112, -5288, -5205,
-    -4019, -2355, -975, -299, -137, 98, 823, 1853, 2532, 2335, 1384, 350,
-    -131, 12, 287, 90, -862, -2378, -3912, -4757, -4312, -2427, 376, 3052,
-    4607, 4682, 3660, 2217, 753, -761, -2424, -3924, -4480, -3327, -432, 3179,
-    5844, 6225, 4149, 691, -2578, -4545, -5011, -4442, -3413, -2261, -1075, 186,
-    1559, 2932, 3960, 4221, 3592, 2468, 1458, 789, 57, -1325, -3418, -5515,
-    -6600, -6010, -3758, -384, 3344, 6655, 8936, 9850, 9347, 7537, 4576, 736,
-    -3416, -7005, -9134, -9270, -7433, -4102, 0, 4084, 7426, 9484, 9967, 8816,
-    6147, 2275, -2201, -6421, -9477, -10707, -9879, -7194, -3214, 1241, 5239, 7994,
-    9093, 8587, 6877, 4472, 1739, -1214, -4363, -7413, -9595, -9962, -8051, -4326,
-    59, 3983, 6883, 8685, 9377, 8776, 6684, 3229, -943, -4738, -6948, -6798,
-    -4457, -1089, 1804, 3333, 3671, 3587, 3542, 3262, 2152, 60, -2402, -4208,
-    -4569, -3356, -1124, 1177, 2675, 3034, 2605, 2082, 1884, 1808, 1290, -19,
-    -1890, -3672, -4702, -4625, -3476, -1620, 373, 1961, 2871, 3188, 3178, 2994,
-    2506, 1433, -328, -2401, -3926, -3993, -2319, 368, 2670, 3494, 2850, 1753,
-    1276, 1617, 1997, 1447, -279, -2400, -3580, -2793, -29, 3595, 6429, 7270,
-    6072, 3832, 1760, 437, -326, -965, -1592, -1903, -1527, -386, 1216, 2739,
-    3655, 3694, 2986, 1982, 1155, 708, 531, 388, 126, -244, -550, -503,
-    159, 1419, 2813, 3635, 3444, 2443, 1346, 807, 885, 980, 280, -1542,
-    -3857, -5244, -4357, -991, 3521, 7087, 8261, 7126, 4907, 2796, 1119, -514,
-    -2445, -4431, -5735, -5637, -3921, -1057, 1982, 4226, 5232, 5247, 4870, 4487,
-    4024, 3151, 1649, -383, -2568, -4378, -5316, -5154, -4094, -2613, -1050, 652,
-    2708, 4983, 6779, 7219, 5838, 2890, -801, -4168, -6182, -6146, -4048, -713,
-    2541, 4641, 5331, 5103, 4589, 3985, 3005, 1327, -898, -2946, -3973, -3669,
-    -2539, -1486, -1005, -730, 216, 2389, 5474, 8437, 10117, 9750, 7221, 3114,
-    -1422, -5121, -7228, -7823, -7493, -6626, -5020, -2226, 1729, 5950, 9030, 9868,
-    8345, 5333, 2055, -697, -2867, -4750, -6314, -6930, -5817, -2807, 1286, 5037,
-    7218, 7411, 6066, 4074, 2217, 803, -356, -1641, -3199, -4666, -5299, -4434,
-    -1973, 1477, 4878, 7257, 8112, 7506, 5852, 3555, 811, -2274, -5394, -7934,
-    -9204, -8799, -6731, -3325, 853, 4928, 7792, 8583, 7250, 4607, 1693, -954,
-    -3385, -5674, -7403, -7786, -6357, -3505, -372, 1830, 2540, 2081, 1298, 885,
-    932, 998, 598, -310, -1262, -1664, -1294, -502, 24, -252, -1355, -2766,
-    -3686, -3420, -1754, 812, 3168, 4150, 3282, 1127, -1133, -2569, -3068, -3116,
-    -3109, -2948, -2278, -1024, 409, 1457, 1853, 1771, 1592, 1648, 2121, 3003,
-    3921, 4074, 2614, -602, -4590, -7696, -8691, -7527, -5115, -2430, 171, 2860,
-    5715, 8202, 9263, 7947, 4167, -1021, -5857, -8800, -9285, -7831, -5498, -3172,
-    -1176, 641, 2485, 4235, 5382, 5359, 3992, 1706, -680, -2438, -3341, -3714,
-    -4080, -4620, -4881, -4047, -1635, 1965, 5623, 8160, 8971, 8073, 5747, 2275,
-    -1938, -6138, -9310, -10614, -9794, -7201, -3459, 826, 5020, 8247, 9476, 8080,
-    4458, 60, -3388, -4928, -4853, -4272, -4144, -4550, -4769, -3999, -2104, 246,
-    2091, 2857, 2644, 1984, 1368, 872, 118, -1401, -3745, -6117, -7131, -5756,
-    -2226, 1956, 5013, 6024, 5278, 3711, 2052, 403, -1584, -4155, -6996, -9177,
-    -9621, -7805, -4159, 131, 3783, 6000, 6634, 5956, 4339, 2103, -480, -3135,
-    -5549, -7361, -8172, -7658, -5839, -3293, -983, 343, 715, 873, 1538, 2685,
-    3516, 3145, 1317, -1421, -4124, -5980, -6584, -5958, -4436, -2527, -715, 766,
-    2005, 3191, 4200, 4439, 3226, 473, -2993, -5831, -7016, -6400, -4643, -2690,
-    -1211, -297, 453, 1465, 2700, 3562, 3416, 2229, 655, -532, -1091, -1408,
-    -2049, -3268, -4829, -6136, -6507, -5516, -3320, -715, 1277, 2086, 1983, 1787,
-    2096, 2744, 2960, 2096, 216, -1921, -3410, -3738, -3005, -1798, -906, -940,
-    -1959, -3333, -4060, -3391, -1337, 1298, 3383, 4093, 3332, 1675, -145, -1793,
-    -3408, -5075, -6286, -6079, -3887, -285, 3152, 4891, 4468, 2661, 742, -488,
-    -1085, -1616, -2507, -3678, -4640, -4822, -3877, -1853, 735, 3060, 4399, 4583,
-    4052, 3409, 2843, 2013, 437, -1997, -4854, -7362, -8740, -8441, -6314, -2696,
-    1611, 5567, 8252, 9168, 8322, 6084, 2952, -600, -4127, -7116, -8911, -8839,
-    -6585, -2599, 1860, 5332, 7044, 7299, 6932, 6344, 5159, 2854, -347, -3375,
-    -5101, -5155, -3979, -2277, -540, 1017, 2364, 3643, 5077, 6608, 7552, 6834,
-    3851, -755, -5260, -7933, -8110, -6350, -3691, -829, 2057, 4897, 7321, 8657,
-    8261, 5885, 1920, -2594, -6320, -8246, -8171, -6627, -4317, -1654, 1212, 4053,
-    6416, 7819, 7982, 6848, 4512, 1278, -2189, -4955, -6240, -5912, -4546, -2941,
-    -1488, 4, 1882, 4079, 6010, 6995, 6755, 5475, 3533, 1262, -1067, -3213,
-    -5000, -6318, -6952, -6455, -4379, -813, 3280, 6375, 7259, 5815, 3089, 566,
-    -817, -1143, -1164, -1484, -2021, -2164, -1428, 10, 1340, 1687, 784, -781,
-    -1944, -1890, -565, 1387, 3064, 3756, 3193, 1610, -345, -1956, -2884, -3324,
-    -3651, -3904, -3671, -2517, -508, 1658, 3000, 2832, 1199, -1069, -2797, -3211,
-    -2438, -1342, -799, -1048, -1640, -1927, -1585, -795, -26, 345, 309, 267,
-    748, 1953, 3394, 3983, 2702, -522, -4471, -7286, -7702, -5827, -2825, 114,
-    2474, 4281, 5541, 5957, 5134, 2943, -285, -3775, -6511, -7611, -6781, -4524,
-    -1898, 79, 987, 1154, 1340, 2150, 3573, 4976, 5531, 4744, 2715, 21,
-    -2576, -4449, -5342, -5404, -4935, -4016, -2401, 156, 3456, 6758, 9093, 9701,
-    8299, 5166, 1090, -2868, -5807, -7330, -7518, -6556, -4467, -1264, 2631, 6196,
-    8189, 7891, 5620, 2556, -45, -1612, -2425, -3141, -4168, -5310, -5856, -5021,
-    -2537, 969, 4193, 5951, 5959, 4876, 3612, 2565, 1481, -90, -2245, -4500,
-    -5974, -5863, -3961, -875, 2300, 4631, 5750, 5755, 4831, 3091, 707, -1937,
-    -4302, -5871, -6279, -5376, -3286, -460, 2393, 4532, 5483, 5229, 4127, 2608,
-    895, -987, -2961, -4685, -5623, -5335, -3739, -1233, 1368, 3130, 3510, 2745,
-    1705, 1216, 1404, 1658, 1206, -198, -2027, -3301, -3238, -1819, 160, 1652,
-    2128, 1871, 1548, 1494, 1420, 745, -790, -2773, -4253, -4291, -2588, 240,
-    3009, 4689, 4947, 4126, 2832, 1548, 485, -401, -1294, -2283, -3156, -3477,
-    -2978, -1916, -969, -713, -1153, -1700, -1625, -606, 1036, 2548, 3228, 2822,
-    1617, 238, -696, -905, -626, -457, -848, -1659, -2215, -1921, -842, 328,
-    839, 479, -269, -533, 360, 2332, 4399, 5210, 4005, 1227, -1812, -3889,
-    -4588, -4244, -3364, -2188, -649, 1353, 3651, 5673, 6623, 5921, 3625, 480,
-    -2457, -4338, -4854, -4233, -2981, -1542, -82, 1463, 3117, 4630, 5539, 5478,
-    4487, 3031, 1713, 877, 395, -183, -1216, -2643, -3971, -4540, -3837, -1731,
-    1367, 4502, 6515, 6663, 5070, 2596, 208, -1600, -2888, -3932, -4808, -5199,
-    -4566, -2597, 373, 3390, 5449, 6157, 5858, 5155, 4327, 3231, 1626, -457,
-    -2606, -4186, -4638, -3813, -2148, -466, 548, 814, 865, 1370, 2560, 3996,
-    4827, 4363, 2552, 30, -2300, -3822, -4463, -4505, -4174, -3418, -2035, -10,
-    2251, 4020, 4633, 3858, 1999, -290, -2273, -3333, -3151, -1872, -98, 1437,
-    2286, 2446, 2112, 1377, 198, -1381, -3063, -4356, -4792, -4167, -2721, -1097,
-    20, 401, 447, 821, 1866, 3341, 4615, 5030, 4181, 2062, -854, -3747,
-    -5850, -6855, -6948, -6417, -5255, -3186, -101, 3520, 6635, 8139, 7480, 4941,
-    1429, -2030, -4713, -6331, -6895, -6506, -5222, -3118, -475, 2084, 3760, 4037,
-    3053, 1559, 468, 336, 1084, 2005, 2101, 689, -2016, -4839, -6347, -5799,
-    -3555, -646, 1979, 3862, 4920, 5162, 4556, 3110, 1028, -1219, -3016, -3863,
-    -3630, -2604, -1313, -283, 181, 150, 68, 462, 1456, 2559, 3007, 2412,
-    1081, -302, -1257, -1815, -2329, -3066, -3918, -4425, -4025, -2399, 317, 3523,
-    6371, 8082, 8241, 6908, 4496, 1485, -1750, -4871, -7425, -8863, -8766, -7055,
-    -4027, -298, 3303, 5962, 7240, 7268, 6491, 5207, 3389, 979, -1795, -4449,
-    -6508, -7636, -7586, -6251, -3875, -1084, 1455, 3463, 5075, 6434, 7285, 7031,
-    5224, 2051, -1630, -4733, -6511, -6810, -5917, -4232, -2072, 347, 2830, 5094,
-    6646, 6833, 5202, 1976, -1838, -4968, -6598, -6675, -5628, -3877, -1636, 943,
-    3521, 5496, 6203, 5282, 2974, 73, -2484, -4081, -4626, -4436, -3963, -3507,
-    -2996, -2016, -176, 2420, 5060, 6855, 7263, 6246, 4044, 1001, -2365, -5310,
-    -7087, -7292, -6008, -3644, -725, 2196, 4566, 5913, 5993, 4900, 3047, 1016,
-    -683, -1825, -2517, -3038, -3601, -4190, -4559, -4411, -3609, -2291, -747, 788,
-    2215, 3432, 4190, 4164, 3174, 1295, -1139, -3553, -5155, -5225, -3618, -1033,
-    1370, 2737, 2980, 2562, 1972, 1411, 835, 173, -503, -940, -847, -185,
-    690, 1209, 1024, 249, -645, -1140, -916, 21, 1299, 2325, 2629, 2194,
-    1411, 652, -94, -1139, -2608, -4040, -4521, -3318, -538, 2784, 5275, 6042,
-    5056, 2939, 481, -1676, -3130, -3751, -3659, -3082, -2162, -930, 515, 1898,
-    2885, 3305, 3231, 2860, 2338, 1640, 589, -932, -2701, -4090, -4437, -3547,
-    -1839, -4, 1442, 2297, 2577, 2459, 2244, 2169, 2136, 1738, 630, -1105,
-    -3004, -4523, -5255, -4952, -3555, -1327, 1127, 3095, 4123, 4178, 3502, 2357,
-    910, -653, -1988, -2663, -2447, -1564, -602, -121, -320, -989, -1681, -1916,
-    -1371, -87, 1441, 2510, 2679, 2035, 1008, -43, -1069, -2200, -3433, -4408,
-    -4481, -3145, -548, 2337, 4217, 4329, 2904, 838, -1022, -2324, -3114, -3508,
-    -3490, -2940, -1796, -243, 1236, 2081, 2045, 1408, 776, 646, 1096, 1771,
-    2099, 1599, 216, -1536, -2837, -3116, -2464, -1474, -676, -110, 582, 1678,
-    2985, 3881, 3753, 2451, 384, -1771, -3416, -4176, -3875, -2586, -758, 873,
-    1691, 1587, 948, 286, -115, -238, -172, 22, 289, 499, 400, -245,
-    -1392, -2554, -3017, -2337, -668, 1387, 3175, 4213, 4193, 3038, 1102, -853,
-    -2099, -2462, -2353, -2254, -2206, -1791, -588, 1336, 3316, 4459, 4219, 2749,
-    731, -1129, -2493, -3379, -3906, -4082, -3770, -2763, -981, 1276, 3262, 4131,
-    3546, 1991, 428, -409, -467, -248, -331, -935, -1805, -2423, -2395, -1706,
-    -697, 234, 921, 1494, 2185, 3012, 3583, 3246, 1583, -1100, -3811, -5476,
-    -5586, -4337, -2262, 115, 2332, 3935, 4579, 4195, 2966, 1168, -917, -2942,
-    -4458, -5066, -4621, -3343, -1725, -292, 682, 1316, 1937, 2710, 3413, 3605,
-    2992, 1630, -152, -1936, -3334, -4081, -4125, -3609, -2711, -1488, 87, 1967,
-    3909, 5481, 6128, 5343, 2974, -483, -3957, -6310, -6947, -6008, -4056, -1636,
-    900, 3234, 4911, 5422, 4541, 2579, 281, -1579, -2580, -2739, -2398, -2082,
-    -2299, -3175, -4146, -4161, -2473, 625, 3880, 5941, 6217, 5007, 2992, 681,
-    -1723, -4069, -5957, -6734, -5873, -3449, -275, 2532, 4188, 4574, 4078, 3238,
-    2475, 1938, 1417, 464, -1190, -3246, -4905, -5439, -4716, -3208, -1521, 54,
-    1586, 3211, 4789, 5844, 5830, 4525, 2220, -434, -2772, -4361, -5048, -4895,
-    -4085, -2828, -1255, 591, 2643, 4675, 6265, 6913, 6266, 4353, 1683, -968,
-    -2944, -3987, -4170, -3643, -2542, -1054, 554, 2067, 3379, 4369, 4807, 4526,
-    3666, 2600, 1564, 431, -1045, -2812, -4381, -5102, -4545, -2722, -115, 2492,
-    4334, 5042, 4792, 4109, 3436, 2820, 1929, 402, -1702, -3706, -4626, -3842,
-    -1593, 1155, 3375, 4596, 4989, 4959, 4704, 4086, 2883, 1145, -672, -1924,
-    -2205, -1646, -855, -514, -917, -1726, -2141, -1446, 414, 2700, 4348, 4690,
-    3790, 2199, 465, -1149, -2595, -3824, -4597, -4470, -3066, -529, 2255, 4088,
-    4277, 3107, 1490, 229, -372, -362, 83, 641, 824, 275, -852, -1898,
-    -2227, -1722, -791, 83, 710, 1145, 1375, 1162, 258, -1218, -2682, -3398,
-    -2935, -1387, 743, 2774, 4022, 4000, 2657, 505, -1625, -3076, -3712, -3809,
-    -3641, -3188, -2210, -586, 1424, 3233, 4263, 4283, 3467, 2186, 750, -682,
-    -2032, -3213, -4087, -4430, -3984, -2664, -776, 1035, 2184, 2546, 2467, 2402,
-    2557, 2778, 2646, 1686, -328, -3048, -5546, -6793, -6322, -4478, -2033, 401,
-    2590, 4436, 5686, 5943, 4967, 2918, 347, -2066, -3829, -4817, -5216, -5280,
-    -5065, -4358, -2878, -633, 1903, 3970, 4969, 4802, 3816, 2486, 1152, -5,
-    -891, -1521, -2048, -2641, -3261, -3606, -3343, -2401, -1009, 505, 1875, 2871,
-    3222, 2696, 1304, -587, -2399, -3601, -3874, -3123, -1442, 824, 3007, 4260,
-    3988, 2285, -63, -2088, -3253, -3618, -3493, -3004, -2054, -633, 953, 2225,
-    2884, 2988, 2804, 2541, 2228, 1768, 1041, -36, -1447, -2961, -4068, -4155,
-    -2898, -571, 2009, 3916, 4634, 4272, 3351, 2347, 1361, 185, -1297, -2769,
-    -3595, -3319, -2080, -511, 761, 1525, 1961, 2311, 2632, 2795, 2619, 1986,
-    927, -329, -1425, -2087, -2349, -2524, -2877, -3290, -3256, -2282, -341, 2024,
-    4016, 5040, 4930, 3855, 2142, 175, -1644, -2994, -3755, -3995, -3807, -3164,
-    -1992, -390, 1289, 2587, 3233, 3282, 2995, 2570, 1954, 932, -586, -2328,
-    -3723, -4242, -3747, -2558, -1208, -119, 580, 1002, 1337, 1688, 2018, 2204,
-    2140, 1780, 1112, 125, -1142, -2516, -3654, -4145, -3679, -2225, -94, 2139,
-    3841, 4550, 4114, 2705, 772, -1050, -2142, -2215, -1523, -733, -464, -865,
-    -1588, -2140, -2244, -1909, -1255, -350, 762, 1902, 2687, 2668, 1617, -238,
-    -2245, -3610, -3782, -2698, -796, 1151, 2340, 2266, 970, -1008, -2970, -4410,
-    -5129, -5057, -4107, -2270, 166, 2567, 4206, 4619, 3808, 2186, 335, -1278,
-    -2482, -3378, -4105, -4607, -4625, -3924, -2531, -762, 944, 2225, 2916, 3056,
-    2813, 2323, 1547, 325, -1385, -3295, -4859, -5611, -5415, -4429, -2863, -868,
-    1314, 3197, 4166, 3855, 2431, 485, -1375, -2831, -3822, -4319, -4223, -3501,
-    -2353, -1164, -283, 194, 455, 812, 1451, 2220, 2637, 2196, 782, -1148,
-    -2842, -3749, -3822, -3381, -2737, -1955, -922, 401, 1786, 2801, 3090, 2642,
-    1786, 891, 80, -762, -1712, -2604, -3100, -2928, -2044, -686, 661, 1414,
-    1193, 126, -1194, -2132, -2407, -2100, -1342, -140, 1439, 3014, 3952, 3760,
-    2412, 353, -1788, -3468, -4349, -4297, -3381, -1908, -379, 708, 1125, 1050,
-    914, 1073, 1570, 2156, 2487, 2311, 1548, 285, -1261, -2806, -4053, -4715,
-    -4555, -3488, -1689, 411, 2304, 3614, 4181, 4022, 3283, 2198, 1004, -170,
-    -1324, -2476, -3534, -4299, -4555, -4153, -3040, -1317, 695, 2517, 3720, 4146,
-    3907, 3204, 2156, 795, -798, -2386, -3577, -3987, -3473, -2275, -895, 275,
-    1236, 2287, 3556, 4631, 4733, 3339, 714, -2169, -4251, -5033, -4729, -3918,
-    -3051, -2205, -1207, 68, 1476, 2638, 3180, 2983, 2241, 1301, 444, -209,
-    -650, -919, -1092, -1302, -1684, -2246, -2815, -3114, -2891, -1996, -378, 1859,
-    4335, 6330, 6957, 5579, 2246, -2155, -6188, -8498, -8430, -6234, -2743, 1180,
-    4903, 7852, 9274, 8467, 5362, 849, -3632, -6892, -8462, -8441, -7110, -4745,
-    -1670, 1721, 4980, 7558, 8758, 7978, 5203, 1236, -2706, -5715, -7511, -8104,
-    -7330, -4898, -937, 3613, 7302, 8978, 8427, 6315, 3529, 546, -2572, -5628,
-    -7844, -8154, -6060, -2193, 2033, 5375, 7383, 8220, 8081, 6928, 4712, 1701,
-    -1498, -4186, -5811, -6108, -5158, -3372, -1292, 690, 2447, 3910, 4799, 4673,
-    3353, 1289, -560, -1316, -733, 700, 2132, 2843, 2536, 1375, -170, -1559,
-    -2395, -2546, -2138, -1447, -755, -206, 289, 972, 1970, 3034, 3602, 3207,
-    1869, 76, -1591, -2767, -3272, -2942, -1660, 414, 2689, 4311, 4565, 3233,
-    727, -2040, -4055, -4674, -3882, -2160, -109, 1826, 3407, 4527, 5157, 5277,
-    4776, 3468, 1301, -1393, -3960, -5758, -6433, -5871, -4049, -1103, 2430, 5620,
-    7545, 7765, 6416, 3954, 916, -2103, -4419, -5440, -4974, -3359, -1250, 782,
-    2520, 4024, 5337, 6230, 6261, 5092, 2802, -83, -2824, -4762, -5512, -5063,
-    -3782, -2249, -913, 182, 1281, 2489, 3479, 3733, 3073, 1930, 1008, 687,
-    738, 609, -60, -1157, -2256, -2956, -3104, -2781, -2131, -1234, -59, 1459,
-    3250, 4944, 5879, 5414, 3398, 427, -2404, -4110, -4337, -3437, -2101, -877,
-    104, 1076, 2313, 3767, 4919, 5026, 3629, 967, -2070, -4433, -5491, -5256,
-    -4125, -2423, -191, 2525, 5236, 6944, 6716, 4433, 1007, -2186, -4166, -4776,
-    -4452, -3723, -2846, -1762, -248, 1795, 4090, 5967, 6708, 6004, 4102, 1549,
-    -1167, -3680, -5589, -6402, -5748, -3666, -671, 2481, 5137, 6968, 7900, 7884,
-    6747, 4362, 994, -2596, -5529, -7311, -7931, -7460, -5734, -2591, 1546, 5469,
-    7730, 7538, 5262, 2156, -447, -1885, -2382, -2616, -3028, -3445, -3304, -2239,
-    -447, 1438, 2784, 3298, 3093, 2520, 1898, 1297, 543, -479, -1503, -1928,
-    -1326, 59, 1352, 1684, 868, -469, -1347, -1106, 225, 2044, 3587, 4316,
-    4068, 2992, 1418, -273, -1821, -3187, -4430, -5351, -5338, -3737, -567, 3177,
-    6083, 7303, 7031, 6047, 4885, 3425, 1265, -1632, -4622, -6670, -6976, -5432,
-    -2620, 578, 3430, 5567, 6904, 7449, 7116, 5674, 2937, -849, -4743, -7393,
-    -7817, -6048, -2999, 285, 3201, 5477, 6734, 6447, 4414, 1153, -2292, -4947,
-    -6359, -6542, -5655, -3807, -1171, 1798, 4324, 5629, 5359, 3764, 1432, -1131,
-    -3642, -5844, -7302, -7492, -6095, -3229, 485, 3999, 6138, 6165, 4317, 1709,
-    -486, -1901, -3021, -4366, -5697, -6069, -4656, -1540, 2240, 5343, 6903, 6860,
-    5679, 3806, 1402, -1434, -4261, -6250, -6614, -5136, -2355, 680, 2873, 3549,
-    2763, 1268, 35, -388, -185, 40, -175, -828, -1566, -1958, -1695, -718,
-    666, 1814, 2039, 1042, -860, -2879, -4210, -4450, -3724, -2436, -901, 785,
-    2483, 3709, 3761, 2319, -95, -2319, -3333, -2912, -1656, -476, -9, -316,
-    -957, -1362, -1264, -885, -693, -971, -1579, -2094, -2122, -1507, -373, 938,
-    1990, 2441, 2183, 1300, -67, -1760, -3509, -4918, -5608, -5369, -4157, -2044,
-    678, 3344, 5053, 5160, 3717, 1399, -1022, -3142, -4935, -6388, -7161, -6638,
-    -4366, -586, 3613, 6768, 7866, 6886, 4621, 2018, -376, -2449, -4209, -5495,
-    -5963, -5274, -3339, -474, 2656, 5316, 7010, 7582, 7061, 5462, 2809, -644,
-    -4248, -7077, -8324, -7694, -5525, -2558, 472, 3091, 5056, 6207, 6403, 5617,
-    4000, 1818, -625, -2965, -4722, -5412, -4841, -3304, -1488, -93, 529, 518,
-    351, 529, 1257, 2336, 3296, 3665, 3186, 1888, 74, -1756, -3074, -3547,
-    -3158, -2106, -627, 1044, 2574, 3529, 3606, 2884, 1777, 709, -180, -1015,
-    -1932, -2868, -3547, -3623, -2839, -1186, 999, 3067, 4282, 4181, 2816, 731,
-    -1380, -3070, -4291, -5172, -5646, -5345, -3905, -1433, 1373, 3612, 4753, 4859,
-    4330, 3456, 2243, 600, -1366, -3257, -4551, -4831, -3937, -2022, 436, 2730,
-    4204, 4591, 4112, 3217, 2190, 1019, -362, -1764, -2748, -2923, -2237, -972,
-    453, 1658, 2343, 2307, 1545, 331, -871, -1658, -1902, -1721, -1258, -505,
-    581, 1794, 2584, 2372, 1056, -791, -2298, -2919, -2747, -2250, -1775, -1308,
-    -656, 248, 1237, 2031, 2393, 2194, 1455, 423, -445, -700, -230, 625,
-    1308, 1448, 1065, 420, -256, -861, -1343, -1601, -1514, -1034, -212, 834,
-    1934, 2839, 3268, 3042, 2198, 973, -345, -1578, -2677, -3580, -4031, -3579,
-    -1879, 866, 3746, 5564, 5590, 4030, 1780, -279, -1785, -2847, -3617, -3981,
-    -3614, -2279, -91, 2449, 4677, 6112, 6631, 6348, 5322, 3443, 688, -2537,
-    -5353, -6799, -6358, -4196, -1026, 2258, 4931, 6637, 7353, 7180, 6142, 4197,
-    1454, -1647, -4462, -6456, -7407, -7283, -6023, -3563, -152, 3407, 5977, 6715,
-    5582, 3276, 681, -1627, -3431, -4563, -4717, -3627, -1435, 1169, 3243, 4097,
-    3641, 2333, 795, -575, -1723, -2744, -3588, -3952, -3436, -1849, 568, 3143,
-    5038, 5652, 4929, 3333, 1471, -271, -1761, -2874, -3353, -3019, -2054, -940,
-    -82, 459, 825, 1038, 961, 558, 72, -162, -51, 156, 139, -182,
-    -570, -707, -479, -95, 58, -270, -937, -1450, -1294, -335, 1057, 2239,
-    2699, 2345, 1477, 518, -307, -1082, -2000, -3026, -3745, -3596, -2314, -172,
-    2201, 4199, 5465, 5818, 5124, 3337, 691, -2245, -4775, -6372, -6819, -6112,
-    -4325, -1637, 1524, 4462, 6440, 7015, 6227, 4480, 2238, -213, -2750, -5185,
-    -7042, -7606, -6292, -3125, 1054, 4903, 7257, 7678, 6509, 4431, 1948, -771,
-    -3627, -6209, -7741, -7485, -5298, -1849, 1742, 4551, 6270, 7067, 7132, 6372,
-    4557, 1725, -1569, -4391, -5869, -5625, -3909, -1403, 1154, 3271, 4756, 5578,
-    5701, 5067, 3693, 1761, -406, -2436, -3991, -4800, -4691, -3652, -1895, 182,
-    2142, 3679, 4667, 5076, 4857, 3938, 2351, 344, -1660, -3250, -4212, -4558,
-    -4398, -3789, -2685, -1027, 1102, 3376, 5256, 6181, 5829, 4313, 2145, -37,
-    -1793, -3013, -3770, -4081, -3797, -2760, -1018, 1080, 3009, 4275, 4589, 3933,
-    2543, 801, -926, -2389, -3442, -3940, -3703, -2631, -886, 1064, 2617, 3346,
-    3205, 2500, 1623, 781, -97, -1169, -2422, -3561, -4153, -3877, -2695, -867,
-    1136, 2784, 3690, 3761, 3173, 2168, 858, -738, -2495, -4067, -5012, -5032,
-    -4118, -2505, -548, 1379, 2955, 3965, 4297, 3898, 2742, 914, -1276, -3289,
-    -4565, -4798, -4094, -2869, -1593, -543, 270, 980, 1661, 2203, 2360, 1919,
-    869, -557, -1965, -2948, -3245, -2830, -1895, -734, 415, 1430, 2240, 2721,
-    2691, 2049, 894, -496, -1830, -2937, -3732, -4108, -3901, -2994, -1413, 675,
-    3000, 5161, 6567, 6596, 4970, 2087, -1087, -3535, -4728, -4750, -4012, -2893,
-    -1589, -192, 1187, 2372, 3148, 3336, 2861, 1792, 336, -1216, -2551, -3381,
-    -3494, -2791, -1327, 626, 2538, 3716, 3586, 2068, -302, -2661, -4329, -5099,
-    -5101, -4488, -3312, -1676, 125, 1724, 2911, 3696, 4118, 4052, 3279, 1750,
-    -235, -2145, -3516, -4165, -4160, -3626, -2602, -1080, 814, 2723, 4158, 4752,
-    4458, 3499, 2161, 626, -1004, -2580, -3831, -4446, -4227, -3193, -1585, 182,
-    1640, 2449, 2557, 2204, 1700, 1175, 526, -368, -1392, -2191, -2441, -2121,
-    -1532, -1036, -770, -592, -265, 300, 963, 1471, 1632, 1401, 839, 68,
-    -760, -1488, -2041, -2479, -2906, -3243, -3132, -2153, -247, 2058, 3886, 4542,
-    3901, 2355, 457, -1403, -3058, -4400, -5231, -5250, -4216, -2169, 420, 2739,
-    3948, 3594, 1857, -555, -2813, -4394, -5223, -5444, -5064, -3845, -1610, 1334,
-    4079, 5565, 5257, 3483, 1125, -1060, -2848, -4371, -5614, -6155, -5430, -3245,
-    -58, 3239, 5781, 7065, 6963, 5558, 3064, -113, -3305, -5701, -6639, -5916,
-    -3869, -1184, 1450, 3601, 5131, 6013, 6131, 5256, 3268, 430, -2561, -4899,
-    -6126, -6326, -5846, -4834, -3108, -532, 2498, 5028, 6110, 5440, 3532, 1287,
-    -591, -1874, -2674, -3154, -3343, -3148, -2486, -1419, -189, 861, 1464, 1562,
-    1315, 960, 654, 421, 223, 64, 18, 150, 407, 601, 528, 136,
-    -411, -820, -853, -471, 141, 653, 742, 261, -644, -1565, -2055, -1892,
-    -1204, -331, 432, 1000, 1448, 1836, 2090, 2049, 1598, 774, -254, -1296,
-    -2235, -3007, -3478, -3375, -2408, -551, 1776, 3829, 4915, 4735, 3436, 1448,
-    -725, -2597, -3773, -4051, -3504, -2397, -980, 620, 2297, 3805, 4738, 4747,
-    3755, 1985, -184, -2346, -4111, -5118, -5123, -4126, -2398, -351, 1634, 3269,
-    4284, 4360, 3247, 1037, -1649, -3839, -4726, -4161, -2696, -1106, 203, 1350,
-    2564, 3637, 3844, 2508, -261, -3386, -5477, -5819, -4825, -3536, -2628, -1871,
-    -552, 1612, 4001, 5541, 5593, 4398, 2708, 1079, -457, -2117, -3890, -5362,
-    -5927, -5159, -3073, -177, 2712, 4847, 5923, 6134, 5813, 4988, 3341, 674,
-    -2592, -5472, -7046, -7027, -5735, -3578, -730, 2619, 5773, 7536, 6940, 4076,
-    200, -3062, -4664, -4438, -2675, 312, 4054, 7510, 9147, 7811, 3720, -1437,
-    -5528, -7263, -6658, -4468, -1352, 2317, 5987, 8557, 8764, 6123, 1513, -3204,
-    -6306, -7110, -5996, -3702, -725, 2639, 5839, 7878, 7763, 5231, 1072, -3255,
-    -6394, -7661, -7106, -5205, -2509, 540, 3570, 6143, 7696, 7705, 6026, 3120,
-    -122, -2902, -4918, -6262, -6911, -6409, -4188, -309, 4139, 7481, 8476, 7026,
-    3998, 407, -3178, -6468, -8873, -9361, -7123, -2484, 2937, 7122, 8877, 8315,
-    6280, 3433, -53, -3995, -7590, -9512, -8740, -5384, -734, 3519, 6212, 7046,
-    6250, 4089, 809, -3028, -6338, -7890, -7044, -4191, -481, 2903, 5283, 6496,
-    6587, 5599, 3618, 905, -2053, -4611, -6100, -6049, -4441, -1794, 1087, 3526,
-    5176, 5836, 5201, 2998, -533, -4369, -7093, -7730, -6291, -3566, -458, 2460,
-    4835, 6219, 6059, 4098, 752, -2979, -6019, -7715, -7930, -6813, -4576, -1524,
-    1821, 4732, 6502, 6702, 5311, 2678, -574, -3717, -6154, -7585, -7925, -7050,
-    -4733, -1006, 3357, 6893, 8221, 6940, 3793, -31, -3680, -6746, -8765, -8966,
-    -6737, -2378, 2735, 6873, 8942, 8878, 7254, 4639, 1354, -2296, -5717, -8064,
-    -8620, -7177, -4128, -241, 3634, 6769, 8629, 8895, 7493, 4604, 674, -3560,
-    -7089, -8840, -8128, -5086, -685, 3778, 7306, 9410, 9812, 8168, 4333, -1046,
-    -6334, -9606, -9777, -7195, -3176, 992, 4626, 7402, 8817, 8155, 5112, 395,
-    -4436, -7850, -9155, -8549, -6529, -3424, 451, 4339, 7005, 7386, 5362, 1877,
-    -1708, -4419, -5950, -6369, -5726, -4005, -1360, 1672, 4232, 5462, 4912, 2821,
-    63, -2328, -3754, -4300, -4373, -4093, -3106, -1105, 1484, 3448, 3591, 1713,
-    -1153, -3488, -4314, -3682, -2306, -869, 365, 1407, 2202, 2496, 2024, 804,
-    -807, -2338, -3523, -4379, -4969, -5104, -4334, -2347, 573, 3501, 5383, 5677,
-    4551, 2510, -72, -2960, -5669, -7258, -6785, -4092, -141, 3533, 5790, 6413,
-    5822, 4430, 2361, -308, -3192, -5608, -6928, -6874, -5560, -3345, -708, 1867,
-    4041, 5700, 6788, 7000, 5752, 2681, -1716, -6021, -8655, -8857, -7001, -4060,
-    -884, 1995, 4079, 4779, 3793, 1554, -879, -2503, -2962, -2492, -1444, -40,
-    1424, 2340, 2052, 461, -1680, -3222, -3470, -2642, -1557, -884, -649, -375,
-    355, 1459, 2353, 2378, 1298, -483, -2145, -2973, -2817, -2133, -1585, -1488,
-    -1562, -1206, -90, 1454, 2586, 2563, 1301, -557, -2104, -2751, -2503, -1780,
-    -1020, -390, 192, 834, 1426, 1632, 1125, -78, -1504, -2452, -2425, -1441,
-    19, 1333, 2075, 2168, 1811, 1267, 650, -128, -1196, -2410, -3234, -3006,
-    -1467, 929, 3214, 4506, 4479, 3407, 1841, 244, -1184, -2450, -3558, -4300,
-    -4232, -2940, -445, 2634, 5362, 6980, 7194, 6073, 3838, 829, -2392, -5070,
-    -6542, -6504, -5025, -2407, 865, 4023, 6103, 6378, 4877, 2464, 285, -988,
-    -1478, -1756, -2186, -2590, -2443, -1392, 398, 2305, 3605, 3839, 2992, 1454,
-    -192, -1474, -2258, -2706, -2938, -2723, -1614, 483, 2845, 4206, 3664, 1435,
-    -1273, -3131, -3489, -2486, -630, 1573, 3666, 5182, 5727, 5142, 3523, 1103,
-    -1777, -4553, -6448, -6771, -5349, -2658, 478, 3343, 5530, 6839, 7108, 6197,
-    4119, 1145, -2161, -5004, -6531, -6148, -3855, -346, 3276, 6018, 7375, 7321,
-    6049, 3764, 727, -2576, -5387, -6900, -6624, -4625, -1491, 1931, 4873, 6860,
-    7741, 7531, 6244, 3875, 588, -3055, -6130, -7754, -7566, -5863, -3270, -288,
-    2796, 5620, 7505, 7684, 5866, 2558, -1199, -4433, -6625, -7623, -7347, -5710,
-    -2843, 670, 3877, 5840, 6067, 4693, 2328, -295, -2662, -4575, -5960, -6569,
-    -5916, -3639, -38, 3733, 6170, 6337, 4455, 1647, -925, -2778, -4069, -4994,
-    -5312, -4498, -2334, 662, 3401, 4850, 4635, 3193, 1411, 18, -837, -1512,
-    -2370, -3263, -3516, -2457, -58, 2904, 5297, 6286, 5663, 3729, 1008, -1925,
-    -4477, -6096, -6409, -5339, -3100, -96, 3168, 6101, 8050, 8425, 6945, 3876,
-    56, -3410, -5644, -6354, -5778, -4303, -2125, 693, 3868, 6634, 7936, 7017,
-    3988, -87, -3682, -5606, -5554, -4065, -1948, 288, 2520, 4620, 6087, 6181,
-    4493, 1394, -2064, -4704, -5789, -5225, -3433, -1063, 1278, 3205, 4563, 5282,
-    5233, 4239, 2274, -401, -3252, -5616, -6831, -6386, -4167, -679, 3053, 5967,
-    7495, 7682, 6824, 5065, 2373, -1120, -4799, -7617, -8531, -7079, -3719, 339,
-    3803, 6017, 7135, 7561, 7216, 5472, 1896, -2886, -7173, -9157, -8079, -4643,
-    -441, 3050, 5152, 5979, 5936, 5209, 3657, 1175, -1868, -4567, -5944, -5566,
-    -3810, -1574, 291, 1414, 1962, 2369, 2889, 3322, 3114, 1837, -346, -2687,
-    -4358, -4972, -4645, -3648, -2116, -141, 1982, 3711, 4520, 4157, 2692, 432,
-    -2135, -4355, -5571, -5402, -3968, -1840, 247, 1755, 2551, 2874, 3037, 3057,
-    2530, 988, -1501, -4071, -5501, -5063, -3042, -445, 1748, 3131, 3791, 3894,
-    3417, 2264, 547, -1286, -2605, -2928, -2206, -893, 290, 779, 513, -61,
-    -347, -34, 699, 1332, 1373, 661, -550, -1771, -2567, -2764, -2427, -1695,
-    -665, 567, 1783, 2644, 2847, 2285, 1049, -641, -2454, -3916, -4501, -3906,
-    -2288, -211, 1704, 3099, 3908, 4149, 3740, 2536, 547, -1857, -3926, -4826,
-    -4135, -2207, -13, 1518, 2132, 2265, 2450, 2752, 2805, 2330, 1492, 709,
-    198, -192, -722, -1426, -2060, -2305, -1972, -1068, 199, 1419, 2070, 1768,
-    569, -974, -2087, -2233, -1386, 41, 1526, 2698, 3355, 3325, 2447, 761,
-    -1299, -3052, -3976, -4001, -3344, -2129, -272, 2143, 4490, 5770, 5300, 3261,
-    534, -2002, -3982, -5429, -6259, -6041, -4309, -1088, 2883, 6404, 8348, 8109,
-    5768, 1993, -2250, -6027, -8676, -9833, -9329, -7142, -3511, 905, 5085, 8002,
-    9054, 8256, 6080, 3148, 29, -2802, -4954, -6176, -6400, -5708, -4210, -2000,
-    771, 3727, 6231, 7560, 7231, 5261, 2177, -1204, -4065, -5777, -5988, -4673,
-    -2156, 967, 4015, 6384, 7575, 7201, 5149, 1837, -1787, -4692, -6321, -6708,
-    -6044, -4289, -1372, 2260, 5477, 7065, 6562, 4471, 1723, -997, -3376, -5165,
-    -5964, -5437, -3693, -1357, 760, 2107, 2588, 2428, 1909, 1195, 330, -681,
-    -1822, -3037, -4149, -4746, -4253, -2307, 798, 4060, 6313, 6910, 5935, 3846,
-    1054, -2065, -4887, -6533, -6339, -4339, -1269, 1898, 4383, 5704, 5616, 4166,
-    1797, -713, -2598, -3448, -3293, -2402, -1051, 575, 2329, 3997, 5232, 5582,
-    4663, 2409, -761, -4004, -6362, -7134, -6113, -3588, -159, 3463, 6548, 8372,
-    8326, 6188, 2401, -1938, -5510, -7373, -7307, -5706, -3215, -463, 2001, 3733,
-    4497, 4364, 3606, 2456, 965, -866, -2860, -4636, -5818, -6210, -5728, -4239,
-    -1652, 1734, 5036, 7124, 7296, 5653, 2848, -467, -3861, -6848, -8643, -8416,
-    -5944, -1973, 2131, 5155, 6582, 6531, 5321, 3175, 316, -2762, -5225, -6214,
-    -5319, -2851, 354, 3384, 5610, 6733, 6655, 5390, 3109, 185, -2840, -5340,
-    -6719, -6597, -5030, -2559, 64, 2310, 4055, 5340, 6025, 5767, 4360, 2018,
-    -723, -3321, -5416, -6755, -7084, -6193, -4074, -1051, 2199, 4746, 5710, 4700,
-    2131, -967, -3564, -5181, -5861, -5706, -4554, -2200, 1084, 4365, 6471, 6708,
-    5247, 2871, 330, -2079, -4363, -6302, -7189, -6236, -3306, 753, 4568, 7079,
-    7979, 7491, 5909, 3465, 532, -2240, -4152, -4823, -4344, -3118, -1607, -151,
-    1079, 2070, 2881, 3499, 3768, 3493, 2653, 1477, 285, -762, -1737, -2743,
-    -3614, -3854, -2950, -875, 1655, 3487, 3734, 2365, 178, -1805, -2969, -3248,
-    -2792, -1631, 231, 2446, 4156, 4384, 2733, -222, -3243, -5216, -5767, -5212,
-    -4001, -2243, 180, 3103, 5755, 7082, 6476, 4241, 1339, -1317, -3367, -4867,
-    -5783, -5755, -4408, -1888, 1021, 3363, 4637, 4984, 4830, 4422, 3703, 2539,
-    960, -804, -2410, -3488, -3713, -2950, -1385, 535, 2362, 3837, 4819, 5041,
-    4107, 1833, -1353, -4426, -6296, -6455, -5173, -3104, -698, 1996, 4943, 7585,
-    8839, 7786, 4509, 226, -3463, -5589, -6170, -5743, -4668, -2926, -496, 2239,
-    4514, 5602, 5223, 3621, 1324, -1136, -3343, -4916, -5420, -4494, -2189, 820,
-    3464, 4897, 4979, 4171, 2973, 1500, -377, -2559, -4498, -5494, -5192, -3812,
-    -1913, -7, 1675, 3130, 4383, 5302, 5555, 4742, 2676, -346, -3487, -5671,
-    -6105, -4692, -2049, 926, 3569, 5626, 6982, 7291, 6023, 2985, -1174, -5073,
-    -7358, -7471, -5766, -3002, 187, 3329, 5818, 6887, 6065, 3674, 738, -1712,
-    -3278, -4154, -4551, -4290, -3046, -938, 1260, 2594, 2623, 1679, 470, -519,
-    -1278, -2015, -2764, -3246, -3085, -2157, -754, 583, 1405, 1606, 1396, 1044,
-    630, -4, -1093, -2698, -4527, -5932, -6165, -4807, -2102, 1089, 3751, 5232,
-    5408, 4446, 2519, -205, -3339, -6164, -7803, -7618, -5532, -2104, 1678, 4791,
-    6543, 6715, 5417, 2897, -460, -3985, -6775, -8076, -7682, -5930, -3303, -141,
-    3180, 5936, 7155, 6262, 3628, 405, -2251, -3867, -4640, -4896, -4628, -3551,
-    -1559, 933, 3098, 4191, 3997, 2862, 1330, -237, -1721, -3038, -3999, -4414,
-    -4236, -3495, -2113, 49, 2832, 5506, 7020, 6686, 4631, 1626, -1507, -4247,
-    -6270, -7192, -6600, -4393, -1045, 2498, 5241, 6535, 6252, 4728, 2577, 459,
-    -1105, -1874, -1915, -1527, -1055, -700, -446, -199, -1, -64, -513, -1097,
-    -1259, -600, 689, 1909, 2425, 2155, 1522, 961, 542, 43, -669, -1409,
-    -1818, -1693, -1173, -624, -344, -347, -393, -238, 159, 646, 1097, 1534,
-    2004, 2333, 2124, 1101, -532, -2147, -3138, -3309, -2815, -1820, -326, 1608,
-    3561, 4802, 4730, 3300, 1065, -1179, -2785, -3436, -3092, -1887, -117, 1743,
-    3126, 3603, 3108, 1942, 543, -782, -1902, -2688, -2901, -2352, -1169, 188,
-    1252, 1895, 2288, 2536, 2450, 1758, 510, -830, -1746, -2100, -2143, -2135,
-    -2004, -1453, -347, 1040, 2211, 2862, 3080, 3139, 3094, 2635, 1370, -719,
-    -3097, -4984, -5841, -5595, -4434, -2500, 107, 3042, 5533, 6674, 5993, 3770,
-    823, -2035, -4336, -5890, -6536, -6074, -4462, -2031, 549, 2565, 3607, 3711,
-    3223, 2516, 1755, 875, -249, -1591, -2884, -3719, -3752, -2902, -1400, 329,
-    1895, 3124, 4028, 4566, 4455, 3297, 1005, -1873, -4326, -5490, -5177, -3858,
-    -2161, -406, 1382, 3099, 4290, 4338, 2946, 472, -2213, -4214, -5066, -4812,
-    -3768, -2248, -528, 1031, 1960, 1921, 996, -295, -1347, -1865, -1935, -1740,
-    -1300, -549, 391, 1107, 1183, 597, -195, -592, -302, 497, 1351, 1842,
-    1751, 1061, -83, -1372, -2390, -2789, -2479, -1645, -543, 716, 2130, 3534,
-    4448, 4306, 2958, 920, -953, -2124, -2713, -3173, -3658, -3775, -3006, -1351,
-    513, 1737, 1945, 1409, 676, 97, -271, -451, -381, -27, 405, 487,
-    -104, -1244, -2349, -2754, -2153, -746, 1008, 2735, 4233, 5258, 5337, 3963,
-    1116, -2399, -5239, -6308, -5399, -3186, -640, 1571, 3221, 4284, 4664, 4214,
-    2942, 1167, -571, -1773, -2256, -2243, -2184, -2420, -2916, -3273, -3016, -1926,
-    -192, 1715, 3286, 4177, 4280, 3658, 2446, 798, -1087, -2897, -4231, -4742,
-    -4315, -3090, -1329, 708, 2739, 4350, 5037, 4460, 2736, 465, -1565, -2793,
-    -3111, -2762, -2055, -1166, -151, 857, 1557, 1658, 1189, 604, 474, 990,
-    1743, 2022, 1367, -123, -1912, -3383, -4091, -3850, -2734, -1054, 767, 2381,
-    3594, 4246, 4075, 2848, 704, -1667, -3339, -3733, -2950, -1556, -88, 1221,
-    2303, 2994, 2999, 2137, 576, -1188, -2597, -3296, -3212, -2449, -1155, 502,
-    2253, 3673, 4302, 3900, 2640, 1029, -401, -1381, -1939, -2198, -2191, -1895,
-    -1405, -989, -879, -972, -781, 200, 2002, 3982, 5172, 4914, 3226, 654,
-    -2165, -4723, -6510, -6897, -5391, -2158, 1776, 5006, 6550, 6289, 4706, 2354,
-    -393, -3160, -5350, -6273, -5540, -3354, -462, 2188, 3845, 4231, 3577, 2390,
-    1098, -144, -1327, -2297, -2698, -2277, -1225, -151, 351, 148, -404, -799,
-    -737, -214, 583, 1407, 2011, 2207, 1928, 1236, 244, -938, -2133, -2991,
-    -3063, -2089, -301, 1607, 2876, 3137, 2559, 1586, 579, -293, -908, -1083,
-    -697, 61, 689, 695, -23, -1097, -1971, -2243, -1784, -658, 944, 2675,
-    4031, 4529, 3938, 2389, 270, -1945, -3789, -4870, -4972, -4174, -2779, -1101,
-    691, 2463, 3920, 4646, 4414, 3452, 2288, 1328, 591, -128, -918, -1615,
-    -1995, -2012, -1815, -1560, -1245, -732, 100, 1203, 2318, 3046, 3043, 2254,
-    1019, -103, -712, -804, -628, -317, 276, 1288, 2424, 2927, 2116, 12,
-    -2543, -4442, -5018, -4315, -2763, -734, 1568, 3835, 5447, 5694, 4266, 1569,
-    -1473, -3914, -5194, -5212, -4184, -2478, -534, 1203, 2371, 2791, 2519, 1822,
-    1072, 574, 413, 411, 284, -112, -657, -1083, -1233, -1173, -1036, -801,
-    -279, 652, 1854, 2965, 3595, 3454, 2417, 625, -1433, -3045, -3667, -3225,
-    -2035, -449, 1359, 3225, 4726, 5213, 4219, 1902, -903, -3118, -4028, -3604,
-    -2336, -806, 610, 1714, 2329, 2266, 1496, 294, -828, -1376, -1134, -256,
-    835, 1663, 1899, 1445, 428, -845, -1948, -2450, -2109, -1027, 365, 1541,
-    2179, 2305, 2140, 1802, 1173, 98, -1271, -2429, -2871, -2509, -1708, -928,
-    -366, 88, 629, 1324, 2036, 2497, 2472, 1959, 1241, 700, 505, 443,
-    73, -893, -2260, -3343, -3391, -2153, -119, 1830, 3062, 3508, 3410, 2878,
-    1810, 202, -1579, -2893, -3190, -2335, -672, 1169, 2601, 3319, 3312, 2671,
-    1470, -159, -1881, -3196, -3707, -3360, -2443, -1336, -227, 940, 2244, 3498,
-    4242, 4086, 3071, 1632, 200, -1131, -2508, -3955, -5133, -5455, -4473, -2220,
-    708, 3421, 5206, 5826, 5457, 4371, 2715, 541, -2006, -4531, -6361, -6764,
-    -5378, -2578, 625, 3173, 4543, 4818, 4275, 3044, 1153, -1198, -3479, -4974,
-    -5131, -3893, -1772, 424, 2037, 2816, 2829, 2255, 1280, 116, -1030, -2017,
-    -2761, -3146, -3028, -2358, -1290, -151, 706, 1075, 1010, 793, 704, 760,
-    694, 252, -518, -1284, -1702, -1624, -1120, -388, 330, 855, 1143, 1230,
-    1095, 610, -311, -1560, -2822, -3675, -3704, -2666, -702, 1602, 3478, 4399,
-    4278, 3311, 1743, -181, -2133, -3664, -4317, -3833, -2345, -438, 1096, 1696,
-    1349, 497, -308, -677, -451, 305, 1278, 1979, 1982, 1184, -130, -1471,
-    -2444, -2932, -3039, -2834, -2193, -973, 627, 2003, 2563, 2229, 1474, 886,
-    730, 868, 961, 719, 77, -755, -1440, -1775, -1805, -1669, -1374, -800,
-    115, 1243, 2290, 2866, 2607, 1396, -445, -2273, -3519, -3992, -3766, -2911,
-    -1437, 518, 2562, 4167, 4893, 4527, 3136, 1063, -1169, -3034, -4171, -4417,
-    -3776, -2389, -525, 1434, 3056, 3952, 3913, 3032, 1659, 201, -1084, -2093,
-    -2740, -2878, -2361, -1201, 354, 1862, 2891, 3266, 3155, 2845, 2408, 1645,
-    380, -1216, -2645, -3419, -3354, -2615, -1523, -291, 1111, 2807, 4627, 5881,
-    5696, 3721, 537, -2666, -4841, -5596, -5137, -3869, -2067, 163, 2663, 4963,
-    6335, 6218, 4673, 2398, 253, -1217, -1915, -2017, -1804, -1548, -1365, -1113,
-    -504, 577, 1898, 3048, 3762, 4064, 4111, 3925, 3314, 2066, 278, -1503,
-    -2521, -2315, -1040, 680, 2203, 3188, 3580, 3425, 2772, 1736, 555, -459,
-    -1051, -1124, -721, 52, 1049, 2057, 2791, 3000, 2627, 1836, 892, 30,
-    -580, -817, -639, -120, 580, 1272, 1756, 1816, 1332, 458, -370, -697,
-    -371, 382, 1181, 1761, 2044, 2016, 1617, 817, -219, -1075, -1303, -767,
-    228, 1172, 1730, 1884, 1763, 1443, 932, 300, -272, -588, -565, -285,
-    49, 218, 116, -177, -433, -415, 0, 756, 1625, 2311, 2612, 2526,
-    2149, 1446, 220, -1556, -3404, -4465, -4091, -2341, 110, 2503, 4383, 5569,
-    5894, 5147, 3286, 677, -1907, -3574, -3751, -2486, -416, 1606, 2977, 3570,
-    3594, 3298, 2790, 2082, 1201, 248, -619, -1251, -1573, -1620, -1480, -1154,
-    -509, 573, 1946, 3167, 3771, 3580, 2757, 1598, 342, -832, -1717, -2086,
-    -1799, -893, 409, 1745, 2704, 2980, 2514, 1493, 202, -1135, -2363, -3288,
-    -3597, -2966, -1283, 1151, 3648, 5439, 6071, 5581, 4288, 2444, 137, -2453,
-    -4764, -5972, -5503, -3477, -665, 1978, 3786, 4529, 4290, 3300, 1888, 457,
-    -611, -1132, -1209, -1150, -1219, -1442, -1623, -1538, -1114, -413, 496, 1562,
-    2622, 3318, 3243, 2249, 602, -1160, -2527, -3214, -3186, -2569, -1556, -360,
-    767, 1517, 1604, 955, -159, -1257, -1958, -2145, -1855, -1117, -11, 1151,
-    1845, 1667, 660, -721, -1938, -2670, -2848, -2522, -1786, -830, 26, 432,
-    232, -402, -1072, -1422, -1315, -798, 16, 961, 1731, 1939, 1364, 192,
-    -1067, -1916, -2180, -1999, -1597, -1105, -584, -153, -2, -249, -765, -1203,
-    -1223, -724, 113, 967, 1558, 1727, 1457, 854, 97, -659, -1327, -1859,
-    -2144, -2023, -1413, -424, 699, 1723, 2492, 2843, 2534, 1384, -454, -2402,
-    -3745, -4073, -3447, -2182, -558, 1203, 2757, 3620, 3436, 2264, 559, -1117,
-    -2370, -3060, -3245, -3080, -2709, -2169, -1405, -378, 824, 1987, 2863, 3253,
-    3079, 2381, 1265, -176, -1850, -3526, -4742, -4965, -3938, -1894, 582, 2886,
-    4593, 5430, 5202, 3846, 1587, -1022, -3257, -4518, -4573, -3614, -2078, -392,
-    1166, 2410, 3117, 3040, 2090, 524, -1085, -2136, -2322, -1746, -734, 423,
-    1558, 2510, 3029, 2874, 2033, 798, -394, -1212, -1560, -1526, -1283, -997,
-    -748, -458, 76, 990, 2144, 3112, 3445, 2971, 1872, 490, -881, -2019,
-    -2681, -2619, -1760, -355, 1099, 2141, 2570, 2468, 2040, 1460, 808, 129,
-    -485, -877, -900, -528, 120, 855, 1480, 1801, 1645, 965, -57, -1035,
-    -1564, -1400, -519, 897, 2491, 3793, 4371, 4011, 2782, 974, -1001, -2661,
-    -3540, -3357, -2182, -437, 1307, 2568, 3094, 2866, 2072, 1044, 168, -260,
-    -150, 369, 1032, 1540, 1658, 1300, 594, -161, -667, -813, -724, -620,
-    -630, -724, -817, -854, -799, -554, 24, 961, 2031, 2816, 2975, 2487,
-    1637, 768, 50, -552, -1107, -1584, -1847, -1772, -1345, -696, -54, 341,
-    367, 71, -389, -874, -1326, -1684, -1781, -1372, -332, 1144, 2563, 3385,
-    3328, 2475, 1134, -383, -1840, -3005, -3621, -3506, -2714, -1524, -267, 828,
-    1647, 2107, 2158, 1879, 1482, 1170, 952, 633, 11, -907, -1861, -2506,
-    -2599, -2093, -1099, 150, 1321, 2066, 2173, 1673, 782, -284, -1401, -2441,
-    -3154, -3231, -2539, -1275, 134, 1288, 1990, 2223, 2020, 1401, 416, -782,
-    -1918, -2660, -2763, -2189, -1172, -134, 508, 547, 85, -541, -947, -894,
-    -407, 248, 693, 640, 36, -912, -1857, -2470, -2557, -2095, -1219, -163,
-    812, 1457, 1560, 993, -172, -1587, -2723, -3137, -2733, -1782, -736, 25,
-    339, 281, 73, -87, -167, -296, -593, -1002, -1325, -1416, -1332, -1270,
-    -1381, -1634, -1859, -1879, -1636, -1205, -721, -275, 145, 602, 1101, 1499,
-    1542, 996, -181, -1751, -3247, -4158, -4162, -3254, -1743, -117, 1145, 1736,
-    1616, 986, 154, -631, -1247, -1646, -1786, -1627, -1224, -763, -478, -486,
-    -700, -901, -902, -663, -294, 35, 162, -4, -451, -1039, -1542, -1757,
-    -1621, -1237, -763, -286, 222, 776, 1214, 1203, 475, -879, -2342, -3240,
-    -3154, -2169, -778, 426, 1073, 1123, 751, 128, -702, -1737, -2821, -3567,
-    -3539, -2565, -923, 780, 1946, 2295, 1949, 1266, 561, -71, -734, -1518,
-    -2330, -2906, -3004, -2598, -1874, -1067, -292, 456, 1174, 1737, 1920, 1549,
-    645, -550, -1692, -2486, -2768, -2489, -1684, -491, 825, 1921, 2520, 2538,
-    2083, 1318, 340, -817, -2053, -3087, -3491, -2906, -1310, 874, 2942, 4270,
-    4612, 4110, 3040, 1589, -125, -1846, -3082, -3298, -2290, -400, 1627, 3052,
-    3519, 3153, 2367, 1558, 924, 483, 200, 70, 95, 206, 265, 160,
-    -94, -337, -353, 18, 773, 1704, 2441, 2616, 2080, 1018, -136, -942,
-    -1158, -801, -67, 775, 1477, 1883, 1953, 1735, 1304, 745, 191, -171,
-    -183, 153, 653, 1056, 1194, 1079, 876, 779, 882, 1117, 1333, 1455,
-    1577, 1852, 2267, 2534, 2275, 1336, -61, -1464, -2479, -2929, -2804, -2131,
-    -920, 763, 2674, 4367, 5322, 5206, 4073, 2330, 477, -1166, -2493, -3434,
-    -3811, -3426, -2292, -746, 711, 1715, 2215, 2406, 2469, 2395, 2012, 1209,
-    114, -942, -1650, -1934, -1924, -1734, -1309, -500, 696, 1979, 2834, 2808,
-    1787, 93, -1673, -2936, -3395, -3081, -2179, -847, 792, 2485, 3751, 4043,
-    3102, 1197, -978, -2676, -3473, -3381, -2687, -1699, -606, 487, 1449, 2091,
-    2263, 1973, 1415, 836, 376, 10, -377, -857, -1373, -1764, -1852, -1550,
-    -917, -141, 554, 998, 1142, 1040, 794, 482, 123, -291, -729, -1066,
-    -1139, -871, -361, 167, 521, 650, 604, 409, 24, -564, -1209, -1623,
-    -1546, -923, 60, 1089, 1872, 2211, 2032, 1384, 426, -589, -1385, -1733,
-    -1530, -846, 95, 1003, 1651, 1956, 1969, 1790, 1493, 1096, 608, 70,
-    -427, -800, -1048, -1259, -1494, -1657, -1478, -710, 610, 2099, 3235, 3682,
-    3458, 2813, 1958, 916, -392, -1897, -3227, -3838, -3374, -1965, -190, 1311,
-    2238, 2689, 2889, 2890, 2549, 1758, 641, -496, -1368, -1868, -2059, -2056,
-    -1916, -1596, -1006, -111, 979, 2003, 2646, 2683, 2068, 945, -418, -1714,
-    -2689, -3208, -3234, -2783, -1899, -689, 647, 1856, 2716, 3091, 2932, 2273,
-    1248, 86, -960, -1708, -2083, -2074, -1694, -1003, -148, 660, 1223, 1440,
-    1324, 974, 533, 119, -214, -473, -666, -751, -660, -378, 22, 449,
-    862, 1252, 1564, 1657, 1386, 709, -274, -1376, -2403, -3182, -3552, -3366,
-    -2545, -1177, 434, 1835, 2621, 2646, 2072, 1223, 366, -392, -1024, -1467,
-    -1608, -1396, -942, -489, -251, -271, -394, -388, -125, 309, 665, 715,
-    426, -14, -344, -421, -288, -93, 62, 190, 362, 581, 721, 597,
-    123, -592, -1298, -1773, -1947, -1875, -1611, -1131, -401, 488, 1286, 1697,
-    1568, 969, 107, -807, -1631, -2248, -2528, -2362, -1770, -947, -161, 395,
-    683, 752, 628, 289, -274, -981, -1669, -2166, -2361, -2226, -1793, -1127,
-    -318, 516, 1241, 1741, 1941, 1814, 1336, 481, -719, -2083, -3287, -3985,
-    -3989, -3327, -2171, -722, 816, 2192, 3108, 3315, 2729, 1488, -80, -1564,
-    -2602, -3010, -2843, -2341, -1763, -1242, -760, -247, 290, 726, 894, 711,
-    251, -315, -856, -1363, -1858, -2230, -2199, -1514, -241, 1189, 2215, 2497,
-    2075, 1232, 260, -681, -1528, -2198, -2559, -2492, -2003, -1255, -461, 255,
-    916, 1578, 2169, 2463, 2234, 1453, 329, -828, -1785, -2441, -2760, -2688,
-    -2176, -1273, -202, 714, 1218, 1265, 1022, 715, 466, 255, 3, -310,
-    -612, -798, -815, -709, -591, -546, -546, -460, -176, 255, 600, 594,
-    151, -542, -1134, -1323, -1033, -427, 231, 732, 999, 1032, 816, 321,
-    -402, -1150, -1629, -1603, -1026, -48, 1063, 2018, 2594, 2687, 2332, 1652,
-    765, -255, -1341, -2374, -3145, -3420, -3050, -2080, -775, 498, 1468, 2081,
-    2421, 2517, 2264, 1540, 415, -815, -1801, -2355, -2509, -2400, -2120, -1675,
-    -1044, -271, 500, 1099, 1426, 1506, 1426, 1240, 950, 576, 210, -21,
-    -58, 51, 218, 404, 628, 912, 1240, 1523, 1626, 1427, 916, 236,
-    -378, -749, -847, -745, -505, -126, 409, 1055, 1682, 2121, 2242, 2021,
-    1549, 959, 324, -355, -1050, -1606, -1782, -1435, -656, 268, 1034, 1460,
-    1524, 1312, 953, 566, 224, -25, -136, -61, 193, 542, 861, 1060,
-    1104, 989, 734, 401, 82, -165, -364, -546, -652, -532, -77, 661,
-    1479, 2144, 2506, 2533, 2292, 1868, 1295, 518, -503, -1652, -2627, -3100,
-    -2932, -2241, -1288, -311, 557, 1271, 1809, 2108, 2052, 1540, 617, -483,
-    -1453, -2107, -2443, -2530, -2383, -1972, -1331, -610, 1, 377, 488, 369,
-    96, -230, -496, -594, -435, 18, 671, 1263, 1482, 1169, 416, -523,
-    -1431, -2202, -2771, -3017, -2797, -2056, -905, 390, 1493, 2145, 2282, 2044,
-    1635, 1134, 453, -499, -1622, -2604, -3110, -2983, -2305, -1314, -254, 717,
-    1528, 2127, 2420, 2282, 1676, 744, -223, -951, -1318, -1359, -1167, -819,
-    -369, 131, 623, 1063, 1420, 1663, 1752, 1653, 1363, 936, 473, 91,
-    -140, -215, -173, -53, 130, 376, 662, 941, 1144, 1217, 1147, 977,
-    770, 547, 271, -92, -491, -776, -787, -474, 72, 669, 1137, 1369,
-    1355, 1149, 800, 327, -246, -816, -1233, -1400, -1343, -1140, -795, -229,
-    581, 1501, 2285, 2728, 2750, 2367, 1628, 627, -466, -1417, -1995, -2047,
-    -1565, -714, 217, 951, 1362, 1465, 1297, 840, 104, -747, -1401, -1586,
-    -1255, -589, 150, 767, 1200, 1477, 1624, 1571, 1150, 223, -1118, -2500,
-    -3435, -3598, -2979, -1806, -380, 1034, 2233, 3069, 3446, 3323, 2709, 1662,
-    320, -1104, -2371, -3274, -3679, -3516, -2794, -1631, -257, 1039, 2020, 2568,
-    2681, 2409, 1817, 1006, 156, -500, -796, -755, -591, -556, -745, -1031,
-    -1193, -1117, -899, -757, -816, -964, -917, -480, 249, 931, 1271, 1270,
-    1168, 1178, 1272, 1229, 853, 126, -811, -1763, -2548, -3030, -3134, -2852,
-    -2222, -1301, -182, 986, 2001, 2657, 2802, 2377, 1465, 316, -744, -1501,
-    -1969, -2272, -2413, -2202, -1473, -343, 790, 1528, 1733, 1525, 1099, 597,
-    104, -331, -692, -986, -1165, -1093, -644, 143, 1013, 1627, 1752, 1371,
-    652, -161, -893, -1497, -2008, -2398, -2511, -2186, -1446, -546, 224, 762,
-    1125, 1318, 1195, 618, -303, -1223, -1812, -1987, -1884, -1644, -1288, -775,
-    -157, 377, 602, 425, -37, -515, -770, -747, -563, -369, -214, -87,
-    -47, -251, -784, -1480, -1949, -1844, -1102, 8, 1052, 1621, 1476, 646,
-    -536, -1545, -1932, -1567, -651, 491, 1613, 2550, 3102, 2999, 2053, 357,
-    -1666, -3425, -4428, -4471, -3645, -2211, -451, 1395, 3079, 4291, 4724, 4225,
-    2907, 1094, -829, -2517, -3683, -4125, -3819, -2989, -1988, -1064, -223, 654,
-    1556, 2241, 2394, 1892, 906, -196, -1062, -1500, -1502, -1185, -709, -223,
-    145, 271, 63, -477, -1200, -1855, -2208, -2144, -1688, -966, -161, 539,
-    1001, 1202, 1194, 1029, 713, 278, -142, -347, -220, 169, 609, 909,
-    980, 816, 441, -77, -590, -889, -818, -365, 332, 1068, 1662, 1984,
-    1941, 1458, 523, -731, -1971, -2741, -2676, -1726, -220, 1312, 2429, 2949,
-    2912, 2402, 1451, 99, -1462, -2850, -3624, -3513, -2553, -1047, 610, 2087,
-    3177, 3752, 3717, 3012, 1686, -30, -1721, -2916, -3283, -2767, -1574, -28,
-    1553, 2894, 3730, 3817, 3025, 1451, -557, -2484, -3839, -4314, -3856, -2624,
-    -885, 1032, 2738, 3814, 3956, 3140, 1668, -12, -1529, -2686, -3389, -3540,
-    -3053, -1947, -408, 1245, 2648, 3482, 3558, 2880, 1626, 80, -1451, -2642,
-    -3165, -2790, -1559, 132, 1699, 2657, 2866, 2517, 1947, 1421, 1022, 677,
-    282, -171, -559, -714, -562, -177, 288, 717, 1079, 1378, 1579, 1609,
-    1410, 995, 447, -115, -582, -897, -1061, -1096, -992, -693, -137, 650,
-    1512, 2201, 2502, 2332, 1777, 1034, 301, -302, -755, -1052, -1121, -829,
-    -99, 957, 2030, 2778, 3006, 2717, 2004, 965, -269, -1441, -2183, -2176,
-    -1348, 79, 1699, 3088, 3916, 4001, 3331, 2051, 424, -1230, -2578, -3321,
-    -3272, -2442, -1048, 583, 2150, 3433, 4263, 4479, 3964, 2735, 1022, -756,
-    -2116, -2696, -2414, -1467, -191, 1126, 2301, 3185, 3592, 3368, 2546, 1392,
-    258, -635, -1267, -1721, -2024, -2090, -1796, -1082, -32, 1132, 2103, 2618,
-    2579, 2098, 1419, 770, 261, -118, -440, -765, -1100, -1383, -1516, -1428,
-    -1120, -653, -86, 562, 1266, 1919, 2321, 2278, 1730, 810, -217, -1069,
-    -1561, -1636, -1326, -681, 246, 1333, 2301, 2747, 2350, 1118, -544, -2036,
-    -2881, -2913, -2244, -1105, 274, 1664, 2808, 3439, 3357, 2532, 1149, -459,
-    -1950, -3097, -3778, -3880, -3252, -1835, 144, 2135, 3511, 3910, 3368, 2174,
-    628, -1055, -2659, -3872, -4368, -3989, -2858, -1325, 219, 1508, 2447, 3041,
-    3278, 3070, 2310, 1014, -595, -2134, -3237, -3730, -3665, -3209, -2495, -1565,
-    -462, 645, 1441, 1632, 1186, 406, -256, -526, -473, -376, -431, -595,
-    -699, -670, -607, -658, -861, -1106, -1239, -1174, -925, -573, -213, 76,
-    246, 279, 182, -11, -214, -300, -176, 130, 456, 610, 494, 148,
-    -317, -778, -1112, -1196, -961, -478, 58, 474, 741, 949, 1145, 1229,
-    1023, 450, -373, -1222, -1899, -2274, -2238, -1685, -611, 759, 2001, 2699,
-    2670, 2023, 1009, -157, -1337, -2380, -3081, -3271, -2936, -2209, -1236, -83,
-    1193, 2403, 3213, 3329, 2685, 1450, -114, -1762, -3233, -4204, -4385, -3713,
-    -2430, -940, 420, 1482, 2174, 2428, 2207, 1593, 791, 26, -576, -975,
-    -1143, -1049, -714, -271, 92, 254, 245, 202, 242, 379, 533, 611,
-    582, 474, 339, 198, 54, -74, -107, 62, 473, 1012, 1432, 1482,
-    1069, 311, -539, -1245, -1666, -1734, -1420, -758, 94, 871, 1341, 1446,
-    1298, 1028, 645, 74, -681, -1433, -1891, -1850, -1287, -335, 803, 1886,
-    2656, 2909, 2593, 1825, 807, -285, -1287, -1997, -2200, -1835, -1092, -297,
-    358, 945, 1636, 2404, 2926, 2824, 2003, 752, -465, -1307, -1669, -1588,
-    -1134, -415, 370, 962, 1171, 984, 531, -26, -577, -1059, -1395, -1482,
-    -1222, -568, 432, 1609, 2663, 3248, 3134, 2336, 1100, -261, -1502, -2454,
-    -2951, -2827, -2041, -782, 601, 1793, 2651, 3143, 3216, 2772, 1791, 451,
-    -912, -1969, -2530, -2541, -2043, -1164, -137, 755, 1310, 1492, 1370, 1003,
-    407, -346, -1053, -1463, -1463, -1175, -832, -590, -456, -401, -453, -649,
-    -902, -986, -706, -62, 751, 1518, 2100, 2361, 2081, 1047, -658, -2505,
-    -3720, -3754, -2616, -807, 1026, 2417, 3145, 3133, 2379, 1022, -583, -1920,
-    -2505, -2129, -956, 555, 1858, 2538, 2439, 1649, 431, -863, -1853, -2229,
-    -1868, -914, 289, 1379, 2155, 2595, 2737, 2551, 1966, 1008, -111, -1062,
-    -1572, -1560, -1112, -380, 503, 1413, 2198, 2681, 2697, 2160, 1127, -165,
-    -1329, -1972, -1904, -1239, -281, 719, 1681, 2555, 3100, 2916, 1793, 46,
-    -1574, -2393, -2283, -1639, -923, -288, 355, 982, 1274, 847, -344, -1879,
-    -3120, -3600, -3198, -2065, -476, 1230, 2653, 3413, 3287, 2332, 844, -777,
-    -2184, -3144, -3553, -3399, -2728, -1609, -137, 1508, 3001, 3922, 3933, 2985,
-    1362, -468, -2078, -3180, -3567, -3082, -1729, 157, 1940, 2970, 2957, 2087,
-    798, -535, -1737, -2715, -3302, -3278, -2535, -1221, 304, 1644, 2539, 2900,
-    2732, 2046, 859, -717, -2383, -3689, -4231, -3877, -2840, -1516, -230, 886,
-    1800, 2397, 2442, 1741, 356, -1332, -2782, -3554, -3483, -2668, -1363, 137,
-    1515, 2429, 2559, 1770, 257, -1466, -2797, -3373, -3236, -2719, -2153, -1649,
-    -1131, -569, -127, -98, -642, -1615, -2622, -3254, -3278, -2666, -1532, -107,
-    1228, 1988, 1806, 683, -970, -2565, -3654, -4056, -3768, -2849, -1442, 147,
-    1490, 2237, 2302, 1835, 1046, 88, -921, -1806, -2371, -2525, -2349, -1985,
-    -1492, -841, -59, 647, 997, 868, 429, 5, -193, -220, -278, -496,
-    -824, -1132, -1356, -1529, -1677, -1747, -1651, -1360, -915, -358, 317, 1094,
-    1838, 2305, 2287, 1746, 804, -392, -1728, -3040, -3980, -4075, -3009, -925,
-    1530, 3500, 4374, 4048, 2843, 1214, -508, -2122, -3430, -4153, -4035, -3044,
-    -1462, 238, 1634, 2515, 2879, 2808, 2355, 1542, 426, -823, -1904, -2471,
-    -2300, -1445, -271, 714, 1123, 890, 254, -426, -881, -998, -776, -269,
-    411, 1043, 1349, 1145, 495, -292, -848, -994, -826, -588, -471, -503,
-    -620, -783, -1009, -1292, -1507, -1445, -956, -101, 836, 1480, 1578, 1128,
-    360, -408, -928, -1111, -1006, -750, -520, -491, -767, -1297, -1854, -2117,
-    -1838, -976, 271, 1542, 2446, 2687, 2181, 1102, -170, -1215, -1758, -1758,
-    -1350, -710, 26, 750, 1326, 1586, 1403, 787, -99, -1012, -1747, -2190,
-    -2296, -2029, -1360, -337, 837, 1830, 2318, 2148, 1396, 287, -916, -1978,
-    -2689, -2860, -2377, -1290, 145, 1543, 2530, 2887, 2592, 1790, 707, -418,
-    -1379, -2009, -2192, -1870, -1059, 121, 1439, 2602, 3356, 3574, 3271, 2524,
-    1393, -31, -1513, -2644, -3004, -2442, -1192, 280, 1589, 2583, 3245, 3499,
-    3189, 2247, 880, -491, -1468, -1890, -1831, -1445, -827, -33, 820, 1519,
-    1844, 1729, 1330, 951, 853, 1086, 1456, 1653, 1439, 784, -118, -945,
-    -1379, -1225, -481, 645, 1801, 2629, 2921, 2693, 2134, 1459, 784, 127,
-    -497, -983, -1166, -942, -363, 405, 1190, 1901, 2483, 2845, 2853, 2423,
-    1615, 625, -302, -984, -1342, -1398, -1248, -1005, -714, -318, 269, 1018,
-    1729, 2136, 2094, 1653, 959, 111, -826, -1702, -2206, -2026, -1105, 249,
-    1518, 2270, 2349, 1825, 846, -428, -1757, -2763, -3045, -2418, -1092, 417,
-    1582, 2145, 2150, 1768, 1113, 239, -740, -1580, -1996, -1847, -1246, -489,
-    127, 465, 579, 617, 678, 740, 693, 440, -27, -622, -1227, -1726,
-    -2012, -1991, -1608, -881, 99, 1195, 2216, 2907, 2977, 2238, 756, -1106,
-    -2836, -3997, -4382, -4004, -3009, -1592, 18, 1557, 2745, 3344, 3216, 2369,
-    973, -672, -2221, -3366, -3905, -3780, -3073, -1972, -713, 496, 1518, 2265,
-    2667, 2635, 2084, 998, -510, -2153, -3505, -4134, -3797, -2566, -798, 1053,
-    2619, 3682, 4109, 3797, 2721, 1034, -897, -2619, -3771, -4205, -3954, -3106,
-    -1748, -29, 1718, 2972, 3242, 2373, 686, -1193, -2689, -3505, -3590, -2966,
-    -1690, 27, 1727, 2854, 3059, 2422, 1357, 307, -522, -1173, -1760, -2271,
-    -2535, -2347, -1644, -570, 589, 1562, 2197, 2468, 2398, 1995, 1258, 241,
-    -900, -1896, -2448, -2366, -1677, -629, 458, 1359, 1991, 2317, 2238, 1638,
-    542, -785, -1945, -2642, -2814, -2562, -2005, -1218, -321, 448, 804, 616,
-    36, -568, -847, -699, -290, 103, 283, 198, -140, -715, -1454, -2128,
-    -2376, -1907, -740, 758, 2062, 2758, 2689, 1940, 744, -594, -1757, -2481,
-    -2622, -2156, -1153, 240, 1772, 3093, 3826, 3703, 2670, 928, -1115, -2946,
-    -4090, -4269, -3488, -2012, -231, 1471, 2805, 3587, 3727, 3218, 2125, 608,
-    -1078, -2611, -3697, -4166, -4006, -3284, -2066, -430, 1415, 3065, 4014, 3901,
-    2709, 791, -1319, -3138, -4362, -4820, -4378, -2954, -681, 1946, 4144, 5194,
-    4820, 3285, 1141, -1110, -3147, -4710, -5472, -5123, -3603, -1257, 1255, 3242,
-    4250, 4187, 3267, 1845, 249, -1301, -2626, -3489, -3601, -2792, -1214, 641,
-    2174, 3003, 3102, 2695, 2013, 1160, 160, -907, -1852, -2462, -2636, -2413,
-    -1860, -972, 281, 1774, 3121, 3804, 3495, 2280, 600, -1030, -2260, -2958,
-    -3080, -2592, -1492, 60, 1680, 2842, 3112, 2404, 1053, -380, -1460, -2096,
-    -2436, -2581, -2425, -1802, -750, 405, 1284, 1737, 1902, 2001, 2092, 2027,
-    1606, 771, -350, -1517, -2504, -3151, -3360, -3056, -2181, -743, 1119, 3085,
-    4694, 5448, 4998, 3328, 829, -1806, -3853, -4825, -4584, -3280, -1242, 1060,
-    3047, 4160, 4098, 2988, 1325, -277, -1360, -1738, -1496, -902, -282, 157,
-    448, 797, 1343, 1939, 2206, 1838, 892, -217, -1020, -1341, -1390, -1541,
-    -1981, -2526, -2743, -2279, -1123, 400, 1866, 2962, 3504, 3335, 2291, 376,
-    -2038, -4223, -5406, -5159, -3603, -1301, 1032, 2793, 3632, 3465, 2446, 929,
-    -605, -1696, -2104, -1933, -1569, -1433, -1697, -2185, -2501, -2284, -1428, -135,
-    1192, 2150, 2498, 2187, 1242, -309, -2337, -4392, -5684, -5452, -3524, -571,
-    2268, 4085, 4637, 4190, 3049, 1299, -1011, -3521, -5506, -6220, -5337, -3146,
-    -344, 2353, 4492, 5889, 6448, 5995, 4340, 1539, -1864, -4888, -6525, -6278,
-    -4434, -1865, 529, 2307, 3547, 4479, 5075, 4987, 3893, 1879, -545, -2782,
-    -4496, -5622, -6107, -5754, -4361, -2017, 765, 3216, 4626, 4617, 3246, 942,
-    -1686, -4070, -5787, -6518, -5979, -4051, -1068, 2067, 4226, 4683, 3530, 1501,
-    -607, -2373, -3699, -4474, -4411, -3269, -1228, 1043, 2731, 3364, 3010, 2073,
-    945, -164, -1125, -1769, -1919, -1564, -938, -385, -153, -258, -513, -622,
-    -307, 524, 1622, 2432, 2399, 1382, -207, -1690, -2604, -2904, -2784, -2344,
-    -1526, -331, 985, 1991, 2382, 2186, 1691, 1196, 817, 484, 53, -545,
-    -1230, -1771, -1890, -1403, -339, 1038, 2341, 3244, 3639, 3664, 3539, 3320,
-    2778, 1578, -354, -2586, -4341, -4944, -4194, -2387, -38, 2377, 4458, 5789,
-    5930, 4606, 1976, -1284, -4204, -5951, -6178, -5067, -3092, -772, 1424, 3061,
-    3807, 3589, 2657, 1429, 239, -759, -1489, -1848, -1763, -1305, -652, 79,
-    908, 1871, 2824, 3453, 3463, 2755, 1430, -294, -2072, -3410, -3762, -2839,
-    -845, 1569, 3684, 5070, 5659, 5520, 4617, 2836, 248, -2638, -4944, -5835,
-    -4976, -2697, 246, 3090, 5335, 6730, 7110, 6330, 4378, 1574, -1388, -3654,
-    -4624, -4262, -3047, -1563, -70, 1538, 3362, 5087, 6034, 5666, 4062, 1865,
-    -214, -1838, -3031, -3848, -4137, -3643, -2246, -112, 2336, 4527, 5874, 5977,
-    4825, 2796, 403, -1982, -4138, -5745, -6249, -5153, -2505, 897, 3898, 5671,
-    6079, 5459, 4136, 2202, -226, -2661, -4282, -4429, -3115, -1034, 940, 2279,
-    2908, 2928, 2388, 1362, 149, -766, -1041, -766, -409, -438, -990, -1790,
-    -2339, -2178, -1120, 601, 2375, 3468, 3400, 2181, 274, -1678, -3129, -3761,
-    -3501, -2477, -991, 549, 1734, 2291, 2177, 1594, 886, 339, 19, -234,
-    -617, -1136, -1571, -1662, -1341, -773, -188, 293, 670, 983, 1262, 1570,
-    2000, 2518, 2823, 2448, 1133, -849, -2757, -3835, -3781, -2814, -1346, 371,
-    2246, 4061, 5278, 5270, 3810, 1345, -1255, -3241, -4326, -4562, -4023, -2687,
-    -644, 1691, 3653, 4641, 4400, 3069, 1073, -1039, -2754, -3750, -3965, -3515,
-    -2518, -1046, 748, 2512, 3760, 4140, 3612, 2391, 748, -1107, -2963, -4501,
-    -5309, -5062, -3721, -1587, 832, 3047, 4736, 5720, 5839, 4903, 2815, -180,
-    -3392, -5862, -6777, -5861, -3471, -364, 2682, 5101, 6506, 6579, 5107, 2242,
-    -1302, -4429, -6201, -6318, -5144, -3277, -1132, 1101, 3178, 4641, 5012, 4170,
-    2481, 554, -1157, -2516, -3562, -4269, -4472, -3988, -2761, -942, 1126, 2968,
-    4095, 4190, 3267, 1658, -173, -1835, -3075, -3700, -3534, -2501, -767, 1244,
-    3019, 4176, 4561, 4170, 3040, 1240, -979, -3089, -4391, -4363, -3008, -893,
-    1171, 2571, 3116, 2938, 2265, 1308, 313, -404, -589, -265, 204, 320,
-    -185, -1152, -2102, -2572, -2368, -1595, -488, 716, 1773, 2405, 2379, 1676,
-    567, -534, -1324, -1729, -1781, -1457, -680, 483, 1699, 2506, 2608, 2050,
-    1107, 61, -909, -1641, -1943, -1682, -936, 18, 877, 1480, 1798, 1826,
-    1577, 1162, 808, 698, 757, 645, 17, -1164, -2525, -3484, -3590, -2747,
-    -1182, 724, 2581, 3978, 4464, 3688, 1698, -907, -3208, -4478, -4530, -3653,
-    -2251, -600, 1121, 2664, 3683, 3882, 3182, 1759, -37, -1823, -3281, -4164,
-    -4259, -3395, -1593, 779, 3046, 4531, 4916, 4316, 3072, 1501, -160, -1680,
-    -2836, -3499, -3677, -3420, -2715, -1527, 56, 1770, 3273, 4286, 4634, 4190,
-    2872, 770, -1699, -3805, -4786, -4260, -2465, -113, 2046, 3555, 4263, 4101,
-    3000, 1069, -1212, -3097, -3980, -3731, -2663, -1219, 310, 1793, 3072, 3849,
-    3787, 2757, 989, -1017, -2755, -3932, -4488, -4472, -3928, -2895, -1465, 181,
-    1779, 3009, 3583, 3371, 2500, 1292, 73, -983, -1838, -2460, -2728, -2485,
-    -1669, -408, 976, 2095, 2686, 2717, 2305, 1536, 424, -887, -1952, -2193,
-    -1363, 171, 1672, 2575, 2806, 2602, 2133, 1365, 257, -996, -1950, -2183,
-    -1605, -547, 453, 1002, 1054, 800, 426, 11, -364, -546, -432, -140,
-    69, 49, -109, -279, -517, -980, -1608, -2033, -1884, -1160, -240, 476,
-    839, 910, 707, 134, -849, -1997, -2795, -2745, -1735, -174, 1242, 1964,
-    1881, 1248, 406, -381, -903, -975, -565, 55, 421, 217, -461, -1182,
-    -1481, -1116, -120, 1247, 2565, 3371, 3325, 2360, 712, -1196, -2909, -4075,
-    -4525, -4265, -3396, -2025, -282, 1582, 3152, 3989, 3843, 2755, 969, -1196,
-    -3392, -5185, -6084, -5709, -4051, -1584, 896, 2653, 3345, 3090, 2245, 1161,
-    97, -747, -1237, -1405, -1449, -1542, -1637, -1493, -932, -23, 990, 1900,
-    2593, 2915, 2589, 1402, -480, -2428, -3651, -3680, -2613, -941, 847, 2457,
-    3668, 4126, 3438, 1563, -929, -3101, -4239, -4244, -3487, -2359, -1030, 434,
-    1831, 2807, 3042, 2446, 1196, -333, -1704, -2577, -2845, -2635, -2158, -1526,
-    -718, 292, 1390, 2323, 2839, 2827, 2353, 1552, 490, -835, -2326, -3616,
-    -4161, -3588, -2014, 3, 1831, 3115, 3807, 3951, 3519, 2445, 794, -1139,
-    -2860, -3848, -3786, -2734, -1081, 686, 2230, 3371, 3925, 3640, 2393, 458,
-    -1501, -2777, -3045, -2488, -1557, -622, 197, 918, 1496, 1759, 1539, 872,
-    30, -651, -982, -988, -809, -574, -350, -152, 60, 365, 805, 1296,
-    1644, 1687, 1413, 923, 292, -490, -1400, -2223, -2576, -2142, -928, 663,
-    2044, 2744, 2614, 1821, 705, -379, -1167, -1546, -1568, -1401, -1226, -1132,
-    -1096, -1026, -811, -365, 336, 1193, 1991, 2483, 2504, 2027, 1137, -3,
-    -1162, -2103, -2675, -2868, -2713, -2150, -1051, 548, 2276, 3549, 3935, 3405,
-    2244, 759, -888, -2552, -3879, -4319, -3463, -1448, 986, 2913, 3782, 3620,
-    2765, 1465, -164, -1877, -3150, -3473, -2793, -1604, -531, 153, 620, 1170,
-    1906, 2655, 3082, 2833, 1690, -239, -2428, -4109, -4682, -4055, -2607, -845,
-    900, 2482, 3732, 4318, 3885, 2350, 72, -2276, -4057, -4919, -4800, -3790,
-    -2062, 63, 2091, 3488, 3886, 3212, 1648, -441, -2558, -4164, -4863, -4585,
-    -3586, -2239, -812, 573, 1809, 2706, 3055, 2774, 1991, 951, -130, -1146,
-    -2047, -2750, -3099, -2933, -2181, -930, 568, 1955, 2872, 3105, 2665, 1742,
-    559, -701, -1831, -2548, -2595, -1956, -918, 128, 961, 1569, 1946, 1932,
-    1344, 230, -1040, -1999, -2390, -2271, -1860, -1309, -641, 121, 786, 1022,
-    617, -260, -1088, -1370, -1022, -408, -3, -44, -453, -1018, -1532, -1815,
-    -1717, -1194, -376, 478, 1107, 1319, 995, 105, -1203, -2574, -3535, -3700,
-    -2942, -1465, 258, 1684, 2466, 2598, 2309, 1782, 1001, -100, -1400, -2538,
-    -3153, -3125, -2594, -1792, -886, 34, 907, 1666, 2216, 2424, 2152, 1356,
-    176, -1078, -2076, -2629, -2755, -2602, -2284, -1769, -931, 250, 1516, 2396,
-    2500, 1772, 484, -994, -2354, -3324, -3602, -2964, -1487, 371, 1985, 2902,
-    3015, 2464, 1433, 64, -1463, -2829, -3618, -3545, -2659, -1345, -70, 891,
-    1530, 1956, 2191, 2131, 1649, 725, -502, -1771, -2768, -3253, -3159, -2600,
-    -1751, -719, 450, 1649, 2621, 3032, 2661, 1544, -32, -1675, -3051, -3969,
-    -4337, -4071, -3077, -1381, 706, 2603, 3702, 3693, 2700, 1146, -515, -1980,
-    -3119, -3869, -4122, -3725, -2618, -1007, 639, 1812, 2273, 2128, 1644, 1007,
-    271, -510, -1192, -1606, -1678, -1452, -1019, -461, 124, 621, 930, 1018,
-    898, 593, 125, -439, -974, -1332, -1409, -1180, -688, -18, 732, 1434,
-    1893, 1866, 1183, -73, -1519, -2662, -3178, -3022, -2293, -1080, 494, 2101,
-    3193, 3278, 2263, 547, -1218, -2479, -2979, -2766, -2087, -1240, -464, 130,
-    540, 796, 919, 946, 954, 1008, 1081, 1034, 712, 66, -784, -1595,
-    -2095, -2082, -1490, -418, 893, 2127, 2999, 3342, 3138, 2466, 1444, 202,
-    -1065, -2065, -2480, -2147, -1198, -1, 1067, 1804, 2175, 2178, 1783, 1024,
-    115, -602, -863, -656, -198, 227, 427, 361, 126, -81, -39, 364,
-    1034, 1699, 2075, 2007, 1486, 590, -544, -1649, -2327, -2207, -1203, 367,
-    1940, 3028, 3438, 3235, 2550, 1472, 107, -1284, -2288, -2523, -1885, -632,
-    762, 1872, 2491, 2609, 2282, 1533, 403, -926, -2087, -2656, -2402, -1454,
-    -239, 767, 1301, 1399, 1271, 1108, 963, 779, 475, 20, -561, -1190,
-    -1744, -2070, -2027, -1555, -710, 359, 1460, 2380, 2889, 2782, 2003, 735,
-    -661, -1835, -2587, -2821, -2425, -1298, 447, 2347, 3762, 4243, 3790, 2759,
-    1547, 386, -628, -1385, -1690, -1366, -413, 903, 2141, 2903, 3054, 2764,
-    2349, 2025, 1799, 1534, 1106, 506, -154, -698, -974, -908, -508, 192,
-    1163, 2322, 3400, 3955, 3599, 2295, 458, -1268, -2350, -2576, -2021, -911,
-    480, 1854, 2898, 3339, 3040, 2093, 823, -341, -1080, -1322, -1204, -889,
-    -449, 111, 729, 1253, 1529, 1519, 1311, 1034, 763, 510, 269, 59,
-    -101, -221, -340, -466, -530, -410, -40, 515, 1082, 1485, 1627, 1482,
-    1058, 409, -311, -846, -950, -536, 256, 1147, 1873, 2266, 2248, 1778,
-    866, -331, -1474, -2146, -2092, -1395, -412, 475, 1081, 1435, 1621, 1647,
-    1464, 1075, 592, 192, 10, 62, 220, 286, 126, -202, -455, -369,
-    136, 895, 1632, 2158, 2440, 2512, 2331, 1777, 791, -447, -1493, -1851,
-    -1284, -5, 1444, 2525, 2998, 2929, 2480, 1735, 736, -351, -1196, -1471,
-    -1087, -265, 625, 1308, 1725, 1958, 2077, 2041, 1752, 1181, 450, -228,
-    -685, -894, -927, -836, -587, -124, 526, 1225, 1813, 2190, 2318, 2173,
-    1736, 1033, 180, -653, -1291, -1594, -1465, -885, 34, 1051, 1884, 2326,
-    2291, 1790, 903, -196, -1222, -1851, -1859, -1243, -226, 855, 1688, 2080,
-    1984, 1472, 689, -166, -848, -1123, -883, -244, 489, 986, 1086, 852,
-    485, 193, 104, 244, 518, 742, 727, 408, -97, -559, -778, -685,
-    -339, 149, 678, 1170, 1547, 1704, 1536, 1004, 204, -646, -1301, -1627,
-    -1629, -1380, -912, -208, 699, 1627, 2283, 2418, 1975, 1122, 150, -649,
-    -1072, -1034, -586, 92, 756, 1194, 1322, 1188, 924, 665, 504, 473,
-    537, 598, 534, 276, -129, -511, -666, -468, 55, 738, 1372, 1784,
-    1864, 1560, 897, 22, -801, -1315, -1409, -1160, -702, -96, 662, 1500,
-    2185, 2431, 2109, 1352, 451, -324, -822, -977, -762, -192, 609, 1403,
-    1911, 1947, 1524, 864, 293, 53, 174, 462, 640, 531, 156, -282,
-    -523, -392, 120, 865, 1624, 2201, 2470, 2369, 1894, 1115, 197, -620,
-    -1115, -1162, -775, -77, 744, 1492, 2002, 2175, 1981, 1447, 648, -272,
-    -1098, -1595, -1607, -1118, -254, 763, 1668, 2194, 2163, 1596, 748, -19,
-    -448, -509, -344, -105, 136, 344, 452, 403, 250, 176, 359, 801,
-    1292, 1558, 1438, 945, 196, -663, -1447, -1921, -1858, -1198, -138, 949,
-    1718, 2022, 1895, 1432, 717, -140, -938, -1425, -1444, -1038, -402, 249,
-    787, 1160, 1335, 1271, 954, 426, -223, -866, -1359, -1575, -1477, -1170,
-    -853, -685, -645, -548, -208, 385, 1027, 1442, 1459, 1079, 429, -342,
-    -1108, -1740, -2092, -2038, -1545, -723, 181, 868, 1111, 862, 272, -403,
-    -937, -1211, -1193, -884, -324, 352, 918, 1162, 1026, 622, 119, -376,
-    -826, -1165, -1258, -990, -406, 258, 715, 810, 592, 227, -150, -482,
-    -750, -914, -936, -842, -726, -671, -673, -638, -469, -129, 352, 900,
-    1387, 1625, 1428, 745, -266, -1301, -2075, -2433, -2336, -1798, -875, 277,
-    1379, 2127, 2342, 2044, 1404, 625, -137, -772, -1206, -1400, -1376, -1204,
-    -953, -648, -303, 34, 268, 325, 234, 119, 109, 214, 313, 237,
-    -97, -616, -1124, -1414, -1374, -1038, -546, -58, 319, 519, 490, 197,
-    -319, -884, -1249, -1233, -846, -275, 250, 592, 723, 652, 375, -92,
-    -638, -1065, -1196, -1006, -631, -252, 26, 208, 336, 425, 456, 423,
-    349, 265, 180, 81, -42, -192, -363, -523, -601, -504, -186, 281,
-    730, 997, 1024, 851, 538, 113, -392, -867, -1124, -1000, -468, 331,
-    1174, 1861, 2261, 2298, 1939, 1224, 307, -559, -1110, -1198, -851, -244,
-    388, 862, 1087, 1078, 914, 704, 542, 477, 503, 573, 626, 616,
-    525, 364, 160, -55, -249, -388, -433, -353, -151, 110, 334, 447,
-    446, 391, 348, 341, 362, 413, 514, 663, 796, 817, 662, 358,
-    10, -268, -389, -310, -28, 408, 890, 1265, 1402, 1257, 887, 411,
-    -53, -424, -661, -743, -669, -479, -252, -73, 17, 51, 112, 282,
-    591, 996, 1390, 1636, 1621, 1320, 819, 269, -193, -508, -680, -712,
-    -584, -289, 106, 464, 650, 625, 455, 252, 96, 5, -25, 12,
-    122, 265, 344, 244, -80, -553, -1010, -1282, -1281, -1009, -529, 65,
-    654, 1095, 1260, 1105, 719, 291, 4, -64, 34, 180, 286, 331,
-    339, 329, 299, 261, 270, 411, 733, 1194, 1672, 2031, 2187, 2125,
-    1870, 1456, 937, 411, 3, -185, -140, 62, 294, 448, 475, 390,
-    260, 178, 213, 381, 637, 912, 1151, 1317, 1370, 1246, 906, 397,
-    -125, -468, -510, -267, 129, 517, 770, 823, 673, 378, 58, -147,
-    -145, 51, 335, 589, 747, 805, 771, 634, 384, 76, -173, -261,
-    -195, -103, -133, -332, -621, -871, -1013, -1053, -1018, -893, -641, -268,
-    136, 423, 468, 237, -213, -771, -1314, -1717, -1862, -1660, -1113, -355,
-    373, 829, 906, 669, 290, -73, -340, -492, -526, -439, -257, -50,
-    95, 118, 14, -166, -333, -388, -268, 6, 326, 546, 562, 360,
-    9, -392, -753, -1003, -1082, -952, -622, -172, 261, 535, 580, 416,
-    122, -222, -549, -779, -809, -576, -137, 325, 612, 636, 449, 157,
-    -165, -477, -715, -773, -572, -153, 315, 630, 680, 506, 252, 63,
-    1, 27, 52, 6, -139, -373, -661, -942, -1126, -1123, -898, -495,
-    -15, 429, 732, 791, 543, 17, -631, -1191, -1512, -1567, -1413, -1100,
-    -644, -89, 435, 731, 652, 201, -451, -1068, -1473, -1606, -1503, -1220,
-    -794, -270, 252, 623, 723, 550, 223, -96, -297, -362, -337, -292,
-    -286, -341, -428, -476, -426, -273, -76, 104, 241, 332, 350, 243,
-    -14, -352, -611, -634, -364, 122, 661, 1106, 1373, 1437, 1279, 872,
-    225, -555, -1264, -1702, -1786, -1579, -1219, -814, -417, -60, 201, 319,
-    311, 258, 248, 300, 356, 338, 205, -43, -382, -779, -1170, -1451,
-    -1513, -1306, -884, -379, 62, 348, 462, 433, 311, 147, -6, -111,
-    -174, -241, -366, -562, -800, -1041, -1268, -1462, -1559, -1457, -1095, -544,
-    -16, 270, 228, -48, -382, -661, -886, -1099, -1282, -1339, -1182, -835,
-    -448, -210, -216, -408, -615, -674, -530, -269, -40, 42, -36, -201,
-    -372, -518, -655, -802, -919, -913, -708, -325, 81, 299, 197, -177,
-    -631, -972, -1125, -1145, -1104, -1007, -803, -487, -157, 39, 3, -254,
-    -633, -1014, -1296, -1409, -1320, -1053, -695, -373, -185, -133, -124, -43,
-    149, 380, 536, 558, 474, 333, 128, -191, -610, -977, -1068, -740,
-    -43, 792, 1476, 1790, 1647, 1112, 366, -370, -920, -1200, -1206, -968,
-    -527, 36, 581, 932, 958, 649, 125, -420, -820, -1019, -1073, -1074,
-    -1063, -1009, -870, -659, -442, -276, -160, -62, 32, 96, 87, -26,
-    -263, -622, -1051, -1433, -1622, -1534, -1202, -740, -276, 98, 318, 334,
-    128, -247, -657, -934, -967, -759, -433, -158, -48, -114, -295, -532,
-    -789, -1017, -1106, -941, -522, -9, 364, 450, 271, -48, -400, -744,
-    -1053, -1261, -1275, -1045, -631, -188, 105, 139, -81, -458, -871, -1228,
-    -1473, -1560, -1463, -1202, -861, -553, -355, -276, -282, -334, -401, -448,
-    -452, -426, -422, -493, -652, -858, -1038, -1112, -997, -656, -137, 398,
-    741, 755, 443, -70, -628, -1111, -1440, -1542, -1355, -878, -224, 379,
-    682, 560, 78, -562, -1154, -1595, -1861, -1930, -1750, -1305, -699, -141,
-    182, 225, 76, -138, -348, -546, -739, -909, -1031, -1099, -1136, -1161,
-    -1162, -1099, -934, -668, -350, -47, 181, 285, 220, -39, -446, -864,
-    -1103, -1041, -700, -226, 209, 495, 598, 516, 251, -175, -686, -1157,
-    -1445, -1449, -1162, -690, -222, 59, 68, -150, -471, -777, -1023, -1210,
-    -1335, -1350, -1198, -882, -503, -223, -146, -245, -388, -456, -446, -453,
-    -561, -767, -999, -1204, -1368, -1483, -1486, -1286, -852, -257, 351, 835,
-    1121, 1179, 987, 542, -94, -758, -1235, -1372, -1170, -772, -350, 1,
-    266, 439, 459, 265, -106, -489, -695, -649, -431, -194, -33, 57,
-    124, 191, 227, 198, 103, -7, -72, -65, -29, -41, -152, -332,
-    -468, -434, -174, 260, 734, 1107, 1294, 1285, 1119, 831, 440, -14,
-    -432, -664, -598, -249, 230, 652, 894, 935, 810, 561, 249, -32,
-    -177, -132, 69, 342, 625, 899, 1147, 1313, 1313, 1116, 804, 537,
-    437, 486, 535, 439, 192, -63, -164, -77, 91, 211, 263, 333,
-    488, 683, 788, 715, 498, 269, 151, 187, 335, 516, 656, 706,
-    640, 451, 161, -176, -479, -662, -676, -515, -211, 183, 596, 941,
-    1132, 1131, 974, 752, 553, 416, 335, 280, 224, 153, 66, -28,
-    -112, -171, -193, -147, 4, 275, 611, 901, 1047, 1037, 956, 909,
-    934, 984, 992, 941, 884, 878, 905, 865, 670, 340, 24, -110,
-    -5, 242, 475, 606, 665, 722, 792, 815, 731, 559, 390, 315,
-    354, 441, 482, 420, 262, 57, -135, -270, -320, -276, -150, 16,
-    175, 298, 391, 471, 543, 591, 619, 670, 804, 1040, 1311, 1488,
-    1461, 1209, 811, 389, 38, -220, -402, -516, -530, -398, -123, 214,
-    497, 658, 719, 770, 883, 1042, 1148, 1094, 841, 450, 29, -332,
-    -604, -786, -856, -760, -456, 12, 510, 872, 994, 873, 585, 231,
-    -105, -362, -499, -496, -363, -145, 95, 300, 438, 508, 518, 482,
-    422, 374, 377, 423, 445, 352, 119, -170, -367, -367, -181, 84,
-    322, 505, 659, 801, 871, 766, 438, -36, -472, -703, -702, -586,
-    -506, -516, -540, -471, -282, -53, 116, 202, 270, 392, 561, 673,
-    608, 325, -102, -524, -816, -936, -921, -828, -689, -515, -332, -188,
-    -124, -144, -206, -255, -254, -183, -43, 144, 323, 422, 389, 222,
-    -18, -247, -399, -459, -451, -410, -342, -229, -64, 113, 222, 207,
-    89, -44, -113, -112, -105, -156, -260, -347, -340, -225, -52, 113,
-    244, 370, 516, 652, 687, 538, 220, -148, -421, -523, -478, -356,
-    -194, 12, 269, 533, 714, 734, 585, 330, 63, -142, -256, -287,
-    -258, -195, -126, -78, -62, -62, -48, -3, 60, 107, 123, 131,
-    160, 207, 222, 144, -32, -244, -405, -480, -507, -556, -662, -785,
-    -851, -814, -696, -556, -433, -311, -146, 79, 315, 471, 480, 352,
-    164, -1, -103, -157, -192, -215, -216, -185, -139, -108, -114, -152,
-    -190, -188, -111, 54, 292, 560, 795, 932, 924, 768, 509, 223,
-    -27, -217, -356, -450, -480, -419, -276, -112, 7, 57, 78, 131,
-    240, 377, 486, 533, 527, 497, 462, 417, 348, 271, 233, 283,
-    415, 557, 619, 563, 435, 314, 260, 281, 359, 479, 634, 811,
-    977, 1094, 1124, 1042, 852, 595, 347, 192, 176, 283, 440, 551,
-    549, 425, 234, 56, -62, -129, -179, -214, -187, -48, 189, 434,
-    578, 578, 477, 363, 306, 313, 332, 301, 196, 53, -68, -131,
-    -154, -169, -174, -124, 23, 246, 473, 623, 657, 588, 467, 355,
-    305, 334, 418, 510, 567, 572, 525, 422, 250, 9, -268, -520,
-    -669, -653, -468, -186, 72, 214, 246, 247, 287, 355, 383, 323,
-    201, 89, 35, 8, -76, -277, -574, -856, -1000, -953, -766, -547,
-    -370, -233, -93, 58, 176, 208, 165, 118, 132, 211, 285, 272,
-    129, -126, -431, -712, -910, -990, -946, -788, -540, -250, 25, 235,
-    362, 408, 380, 285, 150, 35, -6, 15, 7, -132, -419, -759,
-    -1016, -1111, -1064, -950, -820, -661, -418, -63, 346, 679, 822, 760,
-    588, 430, 334, 261, 140, -60, -309, -551, -733, -817, -790, -660,
-    -451, -190, 103, 403, 660, 811, 816, 677, 439, 165, -81, -252,
-    -334, -345, -317, -266, -190, -93, 2, 66, 101, 148, 255, 434,
-    644, 813, 874, 803, 634, 444, 306, 247, 237, 230, 210, 200,
-    221, 252, 240, 150, 5, -114, -129, -17, 168, 336, 415, 393,
-    307, 196, 70, -81, -245, -369, -391, -293, -121, 48, 156, 185,
-    142, 35, -118, -287, -441, -568, -677, -773, -837, -833, -748, -610,
-    -474, -379, -320, -257, -168, -84, -84, -232, -512, -822, -1041, -1107,
-    -1038, -887, -679, -412, -101, 198, 393, 411, 233, -96, -479, -806,
-    -999, -1046, -992, -885, -733, -506, -186, 179, 490, 653, 642, 506,
-    316, 115, -115, -404, -751, -1092, -1336, -1416, -1322, -1089, -761, -378,
-    7, 327, 520, 562, 470, 284, 46, -199, -392, -481, -461, -389,
-    -342, -356, -409, -447, -442, -405, -356, -289, -177, -14, 163, 276,
-    268, 144, -20, -132, -137, -54, 57, 126, 113, 3, -193, -441,
-    -686, -874, -974, -982, -911, -773, -590, -396, -236, -136, -82, -35,
-    19, 56, 27, -80, -221, -328, -368, -366, -380, -438, -510, -533,
-    -467, -321, -135, 51, 220, 360, 449, 456, 377, 254, 155, 131,
-    188, 287, 377, 411, 357, 193, -78, -406, -691, -830, -767, -526,
-    -189, 153, 429, 603, 655, 585, 422, 225, 62, -27, -47, -51,
-    -96, -210, -360, -470, -461, -306, -50, 215, 412, 524, 591, 663,
-    745, 797, 770, 656, 498, 348, 217, 65, -153, -434, -711, -902,
-    -974, -950, -869, -741, -538, -248, 88, 386, 559, 573, 451, 251,
-    35, -154, -307, -436, -556, -665, -738, -744, -677, -563, -448, -366,
-    -308, -240, -135, -7, 92, 122, 74, -26, -147, -276, -401, -490,
-    -500, -416, -285, -192, -200, -306, -447, -547, -562, -482, -319, -106,
-    100, 222, 209, 69, -128, -312, -457, -593, -743, -883, -944, -879,
-    -703, -484, -278, -89, 109, 308, 450, 471, 369, 208, 54, -82,
-    -237, -423, -596, -687, -667, -561, -414, -246, -58, 124, 237, 222,
-    84, -92, -201, -190, -90, 22, 95, 122, 108, 29, -145, -394,
-    -618, -701, -596, -355, -79, 154, 315, 399, 412, 364, 292, 227,
-    177, 123, 52, -18, -52, -32, 1, -27, -154, -333, -450, -407,
-    -211, 44, 256, 393, 489, 571, 620, 587, 459, 282, 147, 130,
-    238, 398, 494, 440, 230, -56, -311, -451, -457, -358, -204, -35,
-    132, 289, 420, 481, 432, 269, 37, -192, -357, -427, -412, -362,
-    -336, -362, -401, -376, -240, -29, 175, 319, 412, 480, 514, 450,
-    226, -143, -549, -835, -894, -733, -456, -174, 62, 252, 381, 401,
-    284, 73, -125, -215, -176, -54, 79, 161, 169, 128, 94, 120,
-    211, 320, 380, 343, 201, -9, -218, -368, -448, -493, -530, -532,
-    -437, -226, 44, 274, 397, 402, 305, 134, -80, -293, -459, -550,
-    -562, -512, -440, -397, -413, -478, -540, -535, -408, -133, 260, 651,
-    865, 767, 372, -166, -666, -1023, -1213, -1229, -1038, -620, -29, 590,
-    1051, 1227, 1111, 806, 446, 128, -112, -247, -236, -62, 215, 455,
-    528, 395, 119, -191, -436, -555, -524, -334, 15, 517, 1119, 1689,
-    2027, 1963, 1458, 632, -294, -1104, -1633, -1775, -1484, -799, 128, 1032,
-    1618, 1691, 1262, 540, -192, -719, -937, -815, -372, 281, 901, 1205,
-    1041, 500, -154, -671, -933, -924, -638, -55, 767, 1615, 2174, 2203,
-    1705, 915, 123, -516, -995, -1312, -1355, -971, -160, 834, 1654, 2061,
-    2044, 1730, 1220, 531, -295, -1085, -1545, -1427, -712, 340, 1336, 1975,
-    2170, 2000, 1584, 1003, 343, -243, -558, -478, -41, 569, 1130, 1483,
-    1565, 1383, 975, 404, -211, -688, -834, -553, 83, 868, 1580, 2068,
-    2258, 2108, 1605, 811, -93, -852, -1253, -1215, -797, -144, 576, 1204,
-    1605, 1686, 1430, 923, 333, -146, -381, -336, -79, 270, 584, 760,
-    743, 541, 224, -102, -334, -395, -260, 46, 451, 864, 1209, 1441,
-    1525, 1428, 1121, 620, 12, -559, -956, -1106, -1021, -766, -413, -22,
-    339, 585, 633, 458, 122, -263, -604, -862, -1034, -1107, -1057, -879,
-    -605, -293, -9, 184, 231, 114, -128, -408, -637, -765, -782, -695,
-    -520, -299, -103, -22, -112, -359, -681, -964, -1117, -1100, -924, -629,
-    -265, 101, 385, 511, 447, 220, -117, -508, -903, -1239, -1433, -1410,
-    -1129, -611, 62, 751, 1290, 1548, 1483, 1163, 712, 231, -231, -637,
-    -916, -958, -699, -184, 441, 1017, 1451, 1714, 1772, 1557, 1035, 304,
-    -401, -826, -845, -517, -1, 558, 1056, 1396, 1458, 1159, 552, -152,
-    -690, -889, -743, -357, 158, 718, 1219, 1504, 1414, 912, 150, -598,
-    -1087, -1211, -1014, -615, -128, 362, 783, 1058, 1107, 889, 440, -120,
-    -639, -1001, -1156, -1103, -861, -480, -65, 249, 345, 204, -91, -407,
-    -628, -703, -648, -520, -378, -267, -213, -237, -347, -518, -690, -806,
-    -858, -887, -935, -977, -941, -765, -473, -164, 34, 46, -132, -437,
-    -781, -1080, -1272, -1311, -1167, -841, -401, 11, 229, 149, -203, -697,
-    -1168, -1491, -1581, -1379, -873, -162, 528, 926, 879, 434, -213, -868,
-    -1425, -1839, -2041, -1927, -1459, -751, -52, 399, 511, 369, 119, -146,
-    -416, -688, -907, -979, -862, -617, -371, -233, -247, -395, -629, -882,
-    -1065, -1104, -995, -807, -635, -531, -492, -494, -534, -607, -674, -663,
-    -536, -340, -202, -236, -461, -795, -1115, -1336, -1419, -1341, -1088, -699,
-    -307, -101, -207, -593, -1084, -1475, -1636, -1542, -1247, -839, -429, -116,
-    46, 69, -6, -160, -403, -739, -1121, -1462, -1681, -1738, -1613, -1288,
-    -756, -82, 568, 977, 997, 635, 44, -589, -1139, -1542, -1738, -1643,
-    -1201, -483, 307, 923, 1205, 1126, 747, 161, -517, -1120, -1445, -1346,
-    -832, -67, 709, 1299, 1583, 1509, 1070, 334, -522, -1246, -1602, -1480,
-    -930, -119, 748, 1473, 1893, 1898, 1481, 764, -24, -636, -912, -824,
-    -455, 71, 627, 1091, 1348, 1326, 1046, 629, 238, -8, -82, -21,
-    118, 301, 510, 717, 876, 935, 883, 769, 685, 698, 797, 903,
-    935, 873, 754, 633, 544, 505, 525, 599, 696, 761, 762, 710,
-    658, 650, 692, 753, 791, 784, 739, 671, 576, 427, 223, 20,
-    -71, 39, 349, 757, 1128, 1361, 1409, 1263, 937, 490, 33, -302,
-    -421, -305, -13, 342, 631, 752, 675, 446, 169, -60, -179, -161,
-    2, 297, 663, 988, 1148, 1076, 805, 460, 187, 79, 158, 394,
-    741, 1130, 1441, 1512, 1224, 619, -74, -556, -641, -348, 153, 682,
-    1118, 1381, 1400, 1140, 664, 135, -261, -421, -350, -109, 232, 594,
-    868, 929, 710, 272, -199, -483, -447, -104, 426, 990, 1445, 1645,
-    1447, 786, -209, -1214, -1863, -1962, -1574, -911, -167, 540, 1103, 1361,
-    1176, 561, -272, -1017, -1448, -1500, -1247, -811, -304, 172, 514, 628,
-    451, 6, -592, -1163, -1545, -1660, -1516, -1172, -694, -164, 311, 608,
-    637, 374, -120, -725, -1297, -1711, -1909, -1896, -1699, -1314, -725, 13,
-    714, 1127, 1091, 628, -85, -847, -1506, -1944, -2038, -1687, -920, 55,
-    907, 1336, 1209, 595, -293, -1192, -1858, -2115, -1896, -1277, -478, 215,
-    577, 532, 159, -400, -1012, -1564, -1924, -1957, -1599, -947, -243, 244,
-    362, 123, -342, -873, -1322, -1573, -1552, -1265, -823, -415, -217, -301,
-    -603, -960, -1210, -1255, -1079, -727, -284, 127, 368, 350, 81, -323,
-    -708, -948, -990, -844, -569, -272, -69, -30, -133, -291, -415, -459,
-    -414, -273, -27, 301, 622, 814, 790, 550, 181, -188, -457, -587,
-    -593, -493, -290, 15, 368, 663, 798, 762, 639, 520, 417, 260,
-    -10, -366, -715, -959, -1044, -949, -667, -221, 307, 786, 1085, 1124,
-    885, 422, -153, -682, -1025, -1116, -981, -696, -349, -20, 204, 257,
-    130, -102, -324, -445, -443, -344, -185, 5, 189, 298, 237, -63,
-    -569, -1111, -1442, -1382, -948, -344, 174, 458, 506, 383, 136, -197,
-    -509, -616, -376, 182, 838, 1316, 1454, 1260, 842, 312, -232, -659,
-    -804, -550, 62, 815, 1418, 1663, 1514, 1065, 448, -226, -841, -1238,
-    -1245, -782, 43, 955, 1654, 1958, 1848, 1404, 734, -41, -766, -1257,
-    -1374, -1101, -553, 86, 658, 1077, 1324, 1424, 1419, 1351, 1245, 1097,
-    895, 655, 432, 303, 323, 502, 812, 1195, 1561, 1788, 1750, 1399,
-    825, 236, -138, -157, 188, 797, 1511, 2133, 2461, 2346, 1785, 955,
-    146, -384, -526, -324, 106, 665, 1268, 1805, 2127, 2117, 1775, 1245,
-    731, 382, 235, 246, 366, 553, 752, 883, 900, 858, 892, 1111,
-    1499, 1918, 2218, 2327, 2239, 1955, 1469, 835, 219, -163, -184, 120,
-    588, 1055, 1419, 1622, 1615, 1375, 968, 566, 363, 458, 790, 1192,
-    1496, 1618, 1550, 1311, 913, 392, -139, -504, -556, -276, 210, 730,
-    1172, 1500, 1689, 1676, 1404, 924, 414, 74, 3, 143, 356, 523,
-    589, 562, 483, 418, 426, 520, 648, 719, 658, 436, 80, -348,
-    -753, -1015, -1035, -790, -354, 133, 530, 753, 792, 683, 484, 244,
-    -3, -233, -413, -511, -519, -475, -439, -451, -492, -511, -464, -335,
-    -123, 160, 467, 695, 721, 490, 55, -450, -893, -1182, -1250, -1052,
-    -604, -41, 400, 505, 230, -268, -741, -997, -976, -713, -265, 295,
-    836, 1172, 1144, 734, 108, -485, -852, -946, -812, -503, -28, 572,
-    1154, 1493, 1420, 959, 318, -262, -657, -861, -886, -683, -212, 443,
-    1038, 1311, 1144, 636, 16, -501, -797, -857, -736, -522, -311, -166,
-    -89, -27, 76, 233, 411, 567, 669, 688, 572, 281, -152, -589,
-    -846, -816, -535, -136, 253, 582, 843, 1002, 982, 724, 282, -182,
-    -486, -555, -449, -281, -117, 50, 223, 340, 316, 132, -111, -267,
-    -272, -184, -117, -141, -248, -388, -522, -623, -651, -564, -374, -172,
-    -74, -144, -343, -582, -781, -886, -838, -571, -82, 500, 928, 982,
-    601, -91, -884, -1602, -2121, -2348, -2192, -1621, -745, 181, 854, 1079,
-    854, 331, -305, -903, -1352, -1535, -1372, -908, -350, 20, 21, -325,
-    -847, -1354, -1721, -1858, -1688, -1186, -478, 167, 473, 340, -122, -698,
-    -1210, -1543, -1610, -1362, -853, -272, 144, 254, 91, -215, -550, -870,
-    -1160, -1376, -1438, -1287, -961, -606, -401, -435, -640, -851, -940, -884,
-    -726, -484, -150, 233, 523, 555, 277, -191, -645, -932, -1015, -945,
-    -798, -633, -482, -344, -190, 23, 310, 645, 988, 1295, 1508, 1524,
-    1224, 582, -258, -1008, -1394, -1306, -823, -122, 616, 1221, 1521, 1393,
-    845, 74, -612, -949, -837, -365, 288, 957, 1532, 1913, 1959, 1528,
-    615, -542, -1534, -2001, -1838, -1195, -323, 586, 1394, 1951, 2094, 1773,
-    1143, 515, 149, 96, 200, 251, 125, -175, -562, -906, -1048, -851,
-    -276, 541, 1320, 1773, 1744, 1269, 515, -307, -1006, -1422, -1441, -1038,
-    -332, 420, 925, 1002, 666, 79, -573, -1157, -1558, -1631, -1255, -467,
-    471, 1173, 1363, 1014, 312, -516, -1305, -1920, -2193, -1957, -1181, -73,
-    985, 1646, 1766, 1422, 803, 90, -579, -1096, -1376, -1376, -1115, -668,
-    -157, 289, 601, 806, 993, 1191, 1294, 1115, 558, -264, -1079, -1616,
-    -1739, -1464, -892, -156, 594, 1190, 1476, 1377, 960, 428, 30, -79,
-    99, 451, 865, 1276, 1604, 1693, 1360, 571, -451, -1317, -1702, -1519,
-    -896, -15, 969, 1898, 2535, 2623, 2070, 1067, 12, -733, -1036, -983,
-    -728, -374, 25, 396, 630, 651, 500, 343, 373, 684, 1210, 1764,
-    2142, 2201, 1885, 1220, 328, -556, -1137, -1184, -666, 233, 1228, 2061,
-    2559, 2615, 2194, 1388, 448, -292, -594, -444, -30, 408, 703, 800,
-    709, 484, 213, 6, -56, 34, 223, 447, 657, 796, 791, 599,
-    276, -26, -153, -57, 177, 410, 549, 587, 557, 473, 318, 98,
-    -98, -125, 109, 543, 985, 1250, 1286, 1168, 979, 718, 345, -101,
-    -455, -523, -244, 240, 684, 896, 840, 604, 312, 70, -58, -64,
-    -15, -35, -215, -527, -829, -967, -870, -548, -52, 525, 1019, 1205,
-    921, 198, -737, -1594, -2154, -2315, -2043, -1355, -370, 651, 1368, 1512,
-    1030, 113, -922, -1791, -2312, -2382, -1936, -993, 231, 1300, 1742, 1327,
-    211, -1177, -2400, -3177, -3376, -2940, -1904, -493, 868, 1718, 1805, 1200,
-    203, -843, -1679, -2143, -2148, -1721, -1035, -373, 6, -4, -318, -743,
-    -1089, -1255, -1238, -1101, -918, -743, -604, -513, -467, -449, -430, -401,
-    -379, -393, -459, -573, -735, -965, -1274, -1612, -1854, -1872, -1617, -1154,
-    -611, -100, 314, 580, 631, 410, -37, -533, -845, -835, -541, -142,
-    157, 230, 47, -323, -737, -1019, -1033, -764, -330, 79, 308, 306,
-    127, -115, -300, -331, -160, 183, 565, 783, 667, 205, -437, -1018,
-    -1366, -1419, -1162, -581, 280, 1228, 1920, 2028, 1441, 338, -921, -1981,
-    -2615, -2722, -2266, -1271, 97, 1483, 2443, 2651, 2092, 1040, -112, -1036,
-    -1537, -1543, -1105, -408, 273, 694, 747, 479, 21, -472, -826, -866,
-    -508, 148, 822, 1189, 1072, 542, -153, -757, -1119, -1188, -944, -369,
-    479, 1391, 2055, 2219, 1850, 1135, 343, -318, -735, -824, -518, 153,
-    976, 1609, 1777, 1454, 880, 376, 155, 251, 571, 979, 1331, 1492,
-    1392, 1058, 609, 186, -110, -230, -181, -30, 102, 112, 9, -52,
-    122, 598, 1232, 1752, 1945, 1766, 1300, 638, -168, -1024, -1715, -1954,
-    -1570, -654, 482, 1493, 2170, 2451, 2325, 1752, 722, -624, -1932, -2750,
-    -2775, -2041, -888, 255, 1094, 1508, 1471, 993, 193, -631, -1081, -904,
-    -188, 678, 1252, 1279, 779, -54, -978, -1766, -2207, -2125, -1484, -485,
-    484, 1059, 1118, 804, 360, -60, -403, -619, -610, -325, 134, 532,
-    659, 461, 33, -486, -981, -1351, -1454, -1145, -412, 531, 1301, 1555,
-    1180, 332, -696, -1616, -2193, -2244, -1692, -659, 521, 1440, 1816, 1606,
-    968, 156, -558, -941, -857, -341, 385, 1016, 1322, 1258, 945, 558,
-    220, -20, -146, -147, -46, 86, 170, 192, 234, 393, 682, 1002,
-    1237, 1354, 1403, 1413, 1292, 889, 173, -652, -1231, -1304, -878, -158,
-    637, 1375, 1927, 2090, 1687, 779, -257, -932, -967, -433, 384, 1211,
-    1880, 2251, 2167, 1541, 530, -463, -996, -869, -230, 562, 1167, 1382,
-    1147, 518, -310, -1025, -1314, -1037, -302, 626, 1479, 2053, 2202, 1817,
-    895, -372, -1595, -2336, -2329, -1615, -490, 671, 1565, 1973, 1733, 795,
-    -642, -2086, -2950, -2878, -1927, -483, 998, 2165, 2800, 2789, 2133, 989,
-    -347, -1538, -2321, -2576, -2321, -1690, -882, -131, 357, 476, 286, -9,
-    -193, -200, -143, -187, -379, -620, -793, -892, -1003, -1164, -1270, -1159,
-    -802, -388, -211, -440, -1006, -1684, -2255, -2590, -2597, -2169, -1277, -109,
-    932, 1440, 1257, 550, -350, -1155, -1709, -1952, -1890, -1613, -1317, -1222,
-    -1427, -1821, -2152, -2195, -1889, -1327, -671, -73, 333, 430, 165, -394,
-    -1069, -1668, -2075, -2264, -2243, -2024, -1664, -1307, -1136, -1247, -1558, -1859,
-    -1955, -1786, -1406, -885, -267, 352, 729, 546, -340, -1687, -2937, -3546,
-    -3306, -2388, -1117, 243, 1492, 2349, 2434, 1508, -235, -2139, -3446, -3763,
-    -3224, -2253, -1203, -229, 556, 947, 757, 54, -787, -1339, -1431, -1202,
-    -885, -584, -281, -4, 83, -198, -824, -1511, -1904, -1842, -1469, -1065,
-    -803, -662, -561, -511, -596, -824, -1039, -1042, -771, -357, -1, 160,
-    93, -177, -576, -976, -1213, -1174, -872, -442, -52, 168, 169, -37,
-    -383, -758, -1023, -1060, -842, -455, -60, 210, 319, 329, 329, 387,
-    531, 752, 996, 1138, 1017, 498, -420, -1583, -2725, -3563, -3870, -3505,
-    -2428, -755, 1185, 2881, 3817, 3738, 2776, 1357, -56, -1144, -1758, -1847,
-    -1457, -786, -182, 19, -288, -904, -1465, -1677, -1446, -819, 124, 1268,
-    2379, 3080, 3017, 2107, 639, -882, -2023, -2594, -2607, -2150, -1327, -310,
-    630, 1218, 1321, 1030, 588, 231, 99, 227, 588, 1077, 1488, 1567,
-    1164, 364, -524, -1138, -1233, -765, 134, 1195, 2075, 2460, 2204, 1430,
-    475, -285, -612, -490, -60, 506, 1075, 1552, 1815, 1732, 1273, 613,
-    65, -134, 12, 321, 632, 916, 1199, 1422, 1441, 1173, 718, 287,
-    44, -1, 66, 186, 366, 603, 808, 846, 685, 482, 472, 739,
-    1096, 1241, 1020, 539, 11, -446, -822, -1063, -988, -446, 453, 1303,
-    1659, 1355, 589, -271, -951, -1351, -1444, -1187, -575, 225, 874, 1061,
-    729, 102, -489, -810, -786, -425, 224, 1027, 1742, 2086, 1906, 1277,
-    447, -335, -939, -1332, -1459, -1194, -448, 660, 1765, 2423, 2384, 1712,
-    699, -317, -1082, -1445, -1344, -837, -126, 504, 817, 747, 406, 0,
-    -285, -327, -78, 422, 1024, 1484, 1589, 1293, 751, 194, -235, -522,
-    -685, -687, -478, -101, 274, 471, 464, 408, 499, 801, 1204, 1543,
-    1748, 1850, 1851, 1636, 1068, 183, -740, -1352, -1488, -1238, -809, -353,
-    67, 423, 692, 894, 1105, 1391, 1744, 2075, 2267, 2227, 1902, 1297,
-    494, -344, -1004, -1280, -1037, -292, 758, 1792, 2509, 2758, 2562, 2061,
-    1445, 911, 624, 652, 936, 1319, 1628, 1734, 1565, 1106, 408, -402,
-    -1123, -1549, -1549, -1136, -460, 255, 810, 1077, 1008, 643, 136, -274,
-    -366, -80, 428, 889, 1085, 942, 502, -146, -879, -1501, -1749, -1408,
-    -501, 646, 1562, 1923, 1733, 1235, 673, 152, -283, -512, -367, 183,
-    924, 1510, 1705, 1505, 1052, 472, -179, -824, -1281, -1330, -893, -139,
-    605, 1067, 1183, 1043, 754, 374, -10, -233, -130, 306, 854, 1191,
-    1101, 601, -91, -699, -1038, -1070, -857, -493, -67, 328, 599, 704,
-    701, 709, 824, 1061, 1359, 1613, 1667, 1355, 606, -441, -1452, -2079,
-    -2152, -1733, -1018, -219, 500, 1001, 1171, 937, 345, -399, -986, -1184,
-    -984, -578, -162, 201, 511, 679, 515, -56, -823, -1383, -1438, -1002,
-    -338, 271, 666, 791, 616, 138, -532, -1121, -1306, -924, -110, 779,
-    1396, 1592, 1406, 948, 318, -350, -840, -920, -500, 269, 1050, 1497,
-    1427, 880, 58, -776, -1387, -1604, -1345, -643, 339, 1346, 2109, 2438,
-    2250, 1590, 639, -325, -1015, -1266, -1084, -607, -13, 528, 881, 963,
-    788, 474, 184, 42, 68, 180, 245, 170, -57, -379, -710, -958,
-    -1006, -750, -196, 463, 907, 901, 451, -224, -868, -1334, -1582, -1578,
-    -1252, -586, 270, 992, 1253, 948, 267, -476, -1073, -1490, -1729, -1703,
-    -1316, -638, 54, 466, 496, 261, -42, -277, -396, -417, -412, -479,
-    -689, -1021, -1361, -1556, -1490, -1129, -531, 190, 899, 1447, 1651, 1327,
-    440, -767, -1831, -2345, -2204, -1592, -770, 67, 752, 1063, 803, -10,
-    -1063, -1904, -2194, -1853, -1008, 129, 1335, 2345, 2830, 2509, 1345, -319,
-    -1867, -2745, -2747, -2043, -962, 212, 1272, 2002, 2176, 1710, 798, -136,
-    -668, -623, -133, 515, 1083, 1452, 1559, 1330, 753, -5, -619, -800,
-    -495, 94, 683, 1085, 1263, 1256, 1119, 903, 669, 490, 422, 472,
-    600, 725, 773, 699, 507, 245, 16, -55, 103, 432, 759, 916,
-    844, 596, 246, -148, -512, -707, -582, -93, 616, 1248, 1518, 1297,
-    669, -143, -905, -1437, -1615, -1370, -750, 28, 653, 899, 762, 413,
-    42, -232, -357, -310, -111, 148, 328, 305, 38, -410, -883, -1202,
-    -1265, -1093, -774, -380, 50, 417, 553, 337, -161, -714, -1102, -1238,
-    -1146, -872, -484, -118, 49, -97, -507, -999, -1364, -1462, -1248, -765,
-    -128, 481, 837, 733, 116, -832, -1738, -2242, -2192, -1661, -799, 255,
-    1317, 2069, 2162, 1464, 213, -1102, -2040, -2407, -2241, -1654, -761, 288,
-    1237, 1778, 1712, 1092, 177, -739, -1481, -1980, -2183, -2037, -1585, -1024,
-    -609, -453, -460, -444, -306, -104, 39, 58, -32, -191, -417, -711,
-    -999, -1111, -888, -338, 323, 813, 959, 763, 321, -251, -807, -1135,
-    -1026, -435, 438, 1255, 1752, 1866, 1686, 1319, 821, 245, -273, -522,
-    -358, 148, 732, 1115, 1199, 1075, 885, 704, 548, 461, 528, 793,
-    1174, 1477, 1511, 1204, 645, 33, -420, -551, -263, 440, 1409, 2323,
-    2816, 2691, 2051, 1185, 358, -296, -689, -700, -253, 529, 1320, 1776,
-    1758, 1375, 865, 434, 188, 139, 259, 505, 796, 985, 896, 456,
-    -200, -787, -1053, -920, -454, 248, 1072, 1814, 2164, 1884, 997, -187,
-    -1263, -1953, -2174, -1946, -1314, -369, 662, 1422, 1595, 1126, 297, -454,
-    -802, -687, -255, 291, 758, 972, 812, 296, -392, -999, -1341, -1370,
-    -1122, -662, -75, 496, 871, 932, 703, 357, 81, -58, -136, -253,
-    -394, -452, -392, -349, -518, -920, -1331, -1463, -1210, -713, -189, 236,
-    540, 693, 618, 285, -182, -556, -672, -561, -402, -356, -462, -697,
-    -1070, -1598, -2157, -2424, -2066, -1042, 281, 1347, 1776, 1551, 908, 97,
-    -733, -1456, -1880, -1798, -1170, -240, 559, 870, 621, -8, -756, -1422,
-    -1858, -1920, -1514, -699, 286, 1142, 1659, 1762, 1467, 840, 21, -746,
-    -1182, -1125, -648, -36, 378, 418, 137, -278, -653, -880, -864, -492,
-    264, 1211, 1974, 2214, 1843, 1043, 92, -788, -1456, -1806, -1770, -1385,
-    -824, -328, -63, -28, -85, -92, -3, 140, 307, 522, 789, 984,
-    890, 377, -432, -1229, -1745, -1934, -1913, -1787, -1536, -1108, -572, -152,
-    -68, -342, -752, -1006, -947, -627, -195, 213, 485, 495, 142, -528,
-    -1275, -1793, -1920, -1713, -1344, -944, -576, -299, -197, -299, -484, -508,
-    -181, 461, 1134, 1503, 1407, 940, 300, -384, -1074, -1689, -2015, -1830,
-    -1116, -138, 727, 1220, 1277, 946, 318, -448, -1073, -1255, -861, -52,
-    819, 1426, 1615, 1356, 636, -530, -1958, -3216, -3792, -3415, -2254, -802,
-    437, 1190, 1417, 1190, 606, -180, -925, -1375, -1396, -1059, -574, -162,
-    34, -51, -423, -1003, -1584, -1894, -1753, -1218, -538, 33, 402, 600,
-    648, 505, 159, -259, -524, -493, -238, 9, 38, -202, -625, -1121,
-    -1616, -2033, -2232, -2042, -1395, -445, 485, 1081, 1216, 967, 508, -1,
-    -441, -722, -801, -729, -645, -685, -872, -1087, -1171, -1049, -780, -480,
-    -209, 41, 262, 346, 155, -329, -914, -1313, -1351, -1074, -673, -314,
-    -57, 94, 108, -87, -520, -1086, -1556, -1684, -1358, -662, 168, 862,
-    1210, 1098, 550, -251, -999, -1423, -1438, -1165, -787, -420, -119, 27,
-    -106, -555, -1144, -1552, -1522, -1035, -290, 466, 1080, 1481, 1584, 1266,
-    483, -585, -1552, -2048, -1956, -1463, -865, -348, 45, 301, 336, 87,
-    -342, -675, -652, -234, 385, 953, 1336, 1503, 1394, 887, -59, -1222,
-    -2149, -2446, -2060, -1293, -530, 25, 399, 677, 854, 852, 654, 350,
-    80, -85, -177, -281, -460, -737, -1089, -1443, -1678, -1665, -1359, -865,
-    -372, -25, 153, 210, 155, -50, -380, -660, -639, -208, 465, 1031,
-    1193, 893, 281, -442, -1135, -1682, -1922, -1676, -910, 158, 1136, 1701,
-    1787, 1567, 1267, 1026, 885, 856, 942, 1085, 1148, 993, 588, 58,
-    -385, -571, -459, -126, 318, 788, 1213, 1484, 1467, 1097, 468, -176,
-    -573, -571, -166, 515, 1269, 1847, 2039, 1743, 1014, 35, -944, -1665,
-    -1911, -1574, -723, 391, 1400, 1946, 1829, 1093, 24, -993, -1654, -1849,
-    -1630, -1110, -418, 287, 797, 937, 674, 150, -407, -822, -1030, -1053,
-    -938, -726, -477, -270, -182, -242, -415, -627, -798, -845, -690, -302,
-    239, 722, 909, 693, 189, -344, -669, -706, -520, -214, 138, 481,
-    719, 727, 467, 83, -150, -22, 434, 965, 1287, 1269, 957, 459,
-    -127, -691, -1055, -1035, -585, 132, 825, 1264, 1376, 1210, 832, 305,
-    -260, -678, -792, -601, -268, 8, 145, 186, 199, 189, 129, 59,
-    80, 270, 573, 817, 827, 548, 47, -543, -1086, -1451, -1492, -1094,
-    -287, 706, 1551, 2001, 2016, 1701, 1165, 473, -250, -757, -798, -349,
-    301, 742, 742, 378, -93, -469, -712, -881, -978, -901, -535, 114,
-    863, 1441, 1655, 1478, 1038, 524, 101, -134, -168, -71, 46, 80,
-    -20, -247, -548, -826, -955, -825, -405, 207, 808, 1173, 1163, 801,
-    278, -145, -291, -158, 111, 354, 485, 497, 401, 192, -123, -478,
-    -761, -868, -770, -515, -197, 103, 348, 530, 648, 696, 668, 578,
-    456, 324, 190, 52, -85, -210, -326, -448, -584, -694, -703, -550,
-    -255, 73, 308, 381, 304, 131, -85, -287, -385, -276, 74, 561,
-    960, 1028, 634, -168, -1137, -1933, -2256, -1993, -1281, -438, 226, 566,
-    623, 510, 288, -44, -439, -736, -745, -423, 39, 345, 317, 7,
-    -393, -739, -1000, -1184, -1214, -951, -332, 506, 1245, 1578, 1389, 809,
-    92, -544, -973, -1123, -935, -417, 276, 869, 1122, 973, 546, 45,
-    -341, -480, -318, 80, 520, 780, 740, 440, 23, -366, -613, -617,
-    -312, 266, 935, 1432, 1561, 1297, 767, 138, -472, -995, -1339, -1369,
-    -979, -202, 745, 1552, 1965, 1901, 1449, 799, 151, -345, -604, -620,
-    -455, -219, -33, 22, -48, -156, -181, -41, 272, 692, 1113, 1424,
-    1546, 1463, 1235, 967, 750, 613, 526, 423, 243, -46, -431, -835,
-    -1129, -1158, -808, -67, 939, 1968, 2746, 3080, 2935, 2401, 1619, 709,
-    -222, -1021, -1490, -1477, -980, -172, 693, 1398, 1817, 1886, 1600, 1062,
-    500, 186, 270, 680, 1169, 1481, 1466, 1111, 499, -210, -786, -985,
-    -670, 87, 1010, 1755, 2089, 1975, 1520, 877, 185, -393, -647, -419,
-    260, 1118, 1784, 2018, 1800, 1262, 546, -221, -865, -1155, -922, -207,
-    717, 1492, 1877, 1839, 1491, 968, 396, -87, -307, -152, 316, 835,
-    1109, 1000, 602, 119, -275, -491, -480, -216, 243, 709, 943, 800,
-    341, -221, -655, -833, -745, -452, -48, 341, 566, 503, 126, -466,
-    -1094, -1592, -1844, -1781, -1377, -690, 106, 761, 1083, 1031, 707, 249,
-    -248, -712, -1039, -1109, -879, -471, -123, -40, -252, -611, -903, -985,
-    -822, -461, 10, 468, 763, 778, 517, 129, -167, -216, -14, 312,
-    592, 685, 505, 21, -725, -1585, -2300, -2585, -2259, -1365, -149, 1048,
-    1942, 2380, 2336, 1859, 1061, 116, -749, -1309, -1430, -1120, -528, 110,
-    551, 614, 263, -343, -881, -1021, -620, 186, 1086, 1788, 2145, 2124,
-    1729, 994, 52, -827, -1328, -1270, -721, 35, 682, 1040, 1109, 990,
-    782, 575, 475, 587, 910, 1268, 1393, 1113, 476, -299, -980, -1418,
-    -1527, -1248, -593, 286, 1104, 1579, 1588, 1191, 542, -204, -889, -1305,
-    -1241, -634, 309, 1175, 1585, 1415, 815, 31, -752, -1436, -1921, -2074,
-    -1820, -1242, -566, -21, 299, 437, 484, 505, 535, 608, 735, 842,
-    766, 364, -340, -1113, -1650, -1772, -1508, -999, -371, 292, 845, 1046,
-    701, -148, -1175, -1960, -2234, -1969, -1278, -295, 827, 1826, 2343, 2101,
-    1124, -230, -1481, -2291, -2569, -2386, -1860, -1147, -466, -35, 72, 4,
-    24, 294, 759, 1226, 1528, 1604, 1441, 986, 181, -906, -1980, -2635,
-    -2603, -1936, -952, -3, 705, 1116, 1220, 997, 466, -238, -860, -1141,
-    -963, -433, 173, 553, 513, 36, -742, -1579, -2188, -2330, -1910, -1036,
-    36, 998, 1599, 1673, 1181, 241, -850, -1717, -2069, -1845, -1211, -436,
-    244, 678, 793, 581, 120, -419, -818, -925, -738, -401, -113, -2,
-    -69, -227, -374, -440, -386, -189, 118, 417, 541, 378, -33, -537,
-    -976, -1260, -1344, -1160, -639, 165, 986, 1440, 1267, 536, -410, -1188,
-    -1597, -1617, -1298, -694, 69, 725, 971, 657, -94, -977, -1676, -1979,
-    -1793, -1128, -122, 934, 1676, 1830, 1361, 485, -460, -1194, -1582, -1615,
-    -1349, -880, -350, 70, 241, 130, -164, -456, -567, -404, 4, 519,
-    923, 983, 551, -315, -1327, -2087, -2317, -1982, -1217, -174, 1020, 2150,
-    2851, 2769, 1848, 459, -809, -1527, -1637, -1348, -864, -256, 437, 1045,
-    1295, 1032, 391, -276, -655, -671, -450, -148, 164, 471, 708, 753,
-    520, 69, -395, -646, -587, -294, 56, 311, 421, 404, 299, 136,
-    -48, -189, -222, -130, 20, 113, 56, -171, -490, -740, -738, -371,
-    300, 1037, 1544, 1647, 1353, 784, 71, -652, -1195, -1340, -983, -256,
-    510, 981, 1006, 649, 84, -521, -1030, -1296, -1163, -573, 324, 1192,
-    1683, 1632, 1114, 345, -457, -1134, -1559, -1612, -1216, -441, 460, 1133,
-    1313, 978, 339, -314, -763, -892, -660, -102, 614, 1193, 1347, 973,
-    227, -590, -1197, -1437, -1262, -702, 111, 924, 1425, 1401, 878, 90,
-    -659, -1146, -1255, -963, -343, 416, 1043, 1302, 1104, 531, -221, -929,
-    -1404, -1529, -1280, -732, -54, 532, 815, 683, 176, -523, -1158, -1512,
-    -1477, -1097, -542, -49, 172, 25, -425, -976, -1379, -1452, -1159, -589,
-    97, 716, 1079, 1034, 556, -191, -907, -1328, -1368, -1130, -785, -467,
-    -247, -168, -251, -460, -667, -705, -470, -10, 502, 865, 946, 706,
-    192, -487, -1182, -1733, -2014, -1969, -1632, -1106, -540, -85, 146, 117,
-    -101, -341, -413, -217, 175, 545, 662, 409, -187, -1011, -1902, -2653,
-    -3010, -2748, -1815, -442, 902, 1725, 1765, 1085, -22, -1219, -2219, -2779,
-    -2715, -2000, -868, 244, 921, 978, 521, -182, -869, -1368, -1582, -1458,
-    -1006, -361, 219, 465, 267, -254, -838, -1266, -1444, -1359, -1002, -375,
-    417, 1134, 1496, 1346, 765, 16, -607, -925, -922, -694, -384, -130,
-    -38, -150, -437, -799, -1084, -1112, -746, 16, 968, 1754, 2047, 1746,
-    1035, 243, -365, -709, -834, -791, -592, -286, -15, 54, -112, -357,
-    -429, -172, 383, 1070, 1697, 2115, 2221, 1964, 1363, 542, -278, -861,
-    -1058, -881, -471, -14, 345, 529, 527, 393, 232, 151, 219, 436,
-    757, 1104, 1365, 1401, 1123, 570, -63, -521, -634, -404, 21, 464,
-    807, 994, 984, 738, 271, -269, -636, -605, -115, 686, 1523, 2133,
-    2359, 2169, 1620, 835, 5, -627, -855, -622, -65, 564, 1037, 1235,
-    1138, 788, 283, -200, -441, -291, 217, 856, 1328, 1426, 1128, 555,
-    -106, -664, -949, -856, -403, 242, 816, 1087, 961, 513, -52, -500,
-    -653, -445, 80, 780, 1438, 1818, 1755, 1244, 459, -347, -961, -1277,
-    -1281, -1005, -518, 64, 583, 893, 926, 727, 423, 152, 2, 2,
-    129, 310, 428, 359, 54, -403, -836, -1078, -1040, -719, -170, 491,
-    1071, 1353, 1208, 706, 94, -340, -441, -247, 79, 373, 535, 515,
-    280, -165, -697, -1077, -1067, -590, 200, 1013, 1597, 1828, 1687, 1215,
-    516, -224, -796, -1087, -1132, -1039, -875, -655, -425, -298, -350, -488,
-    -472, -102, 580, 1302, 1761, 1827, 1551, 1032, 305, -596, -1505, -2097,
-    -2069, -1371, -278, 780, 1452, 1593, 1250, 591, -138, -663, -784, -463,
-    153, 801, 1218, 1226, 783, -11, -932, -1693, -2031, -1803, -1066, -90,
-    747, 1146, 1025, 520, -156, -820, -1338, -1573, -1390, -760, 157, 1050,
-    1617, 1704, 1338, 665, -118, -817, -1279, -1430, -1311, -1043, -770, -584,
-    -501, -466, -385, -148, 321, 997, 1710, 2177, 2146, 1544, 529, -608,
-    -1589, -2223, -2395, -2060, -1290, -322, 493, 865, 725, 256, -255, -601,
-    -733, -698, -512, -149, 353, 801, 921, 572, -120, -837, -1299, -1415,
-    -1245, -879, -401, 69, 351, 294, -93, -624, -1053, -1215, -1084, -736,
-    -294, 98, 287, 150, -325, -980, -1519, -1657, -1290, -568, 199, 734,
-    918, 775, 382, -187, -816, -1308, -1447, -1130, -475, 236, 725, 856,
-    639, 156, -479, -1090, -1437, -1332, -784, -22, 656, 1072, 1204, 1091,
-    733, 156, -491, -948, -1007, -672, -138, 345, 614, 620, 396, 41,
-    -281, -388, -175, 296, 817, 1160, 1202, 963, 534, 4, -537, -948,
-    -1044, -715, -60, 631, 1062, 1126, 934, 672, 448, 266, 115, 24,
-    31, 109, 167, 127, -10, -178, -325, -444, -531, -533, -370, -33,
-    352, 585, 550, 298, -8, -218, -267, -150, 114, 461, 754, 830,
-    615, 194, -248, -539, -600, -439, -106, 318, 713, 920, 806, 357,
-    -267, -779, -919, -605, 15, 671, 1134, 1295, 1126, 634, -124, -980,
-    -1672, -1971, -1806, -1286, -599, 90, 646, 933, 847, 410, -166, -576,
-    -616, -320, 105, 457, 666, 748, 708, 510, 159, -225, -461, -439,
-    -200, 113, 350, 412, 274, -16, -313, -425, -221, 271, 867, 1338,
-    1535, 1433, 1084, 553, -98, -751, -1201, -1220, -718, 136, 967, 1420,
-    1370, 965, 457, 31, -249, -370, -296, 6, 487, 981, 1285, 1279,
-    1009, 646, 369, 265, 303, 391, 445, 414, 292, 106, -71, -140,
-    -11, 349, 888, 1481, 1956, 2135, 1891, 1204, 203, -855, -1675, -2030,
-    -1835, -1157, -170, 895, 1787, 2282, 2253, 1748, 983, 235, -305, -579,
-    -610, -424, -74, 296, 477, 339, -38, -404, -525, -319, 157, 809,
-    1538, 2179, 2482, 2240, 1475, 487, -312, -656, -549, -170, 314, 832,
-    1325, 1659, 1671, 1329, 823, 451, 407, 664, 1040, 1356, 1521, 1503,
-    1280, 859, 331, -122, -309, -137, 338, 960, 1554, 1983, 2148, 1986,
-    1512, 870, 306, 44, 133, 424, 692, 796, 740, 597, 423, 249,
-    135, 181, 464, 945, 1454, 1777, 1776, 1452, 914, 298, -292, -778,
-    -1074, -1104, -856, -442, -52, 157, 150, 16, -105, -107, 31, 243,
-    421, 480, 407, 241, -4, -359, -843, -1347, -1628, -1449, -785, 119,
-    879, 1222, 1127, 762, 308, -142, -539, -776, -714, -313, 258, 696,
-    785, 543, 178, -99, -191, -101, 135, 461, 771, 912, 773, 384,
-    -85, -420, -486, -282, 101, 539, 912, 1107, 1025, 640, 45, -553,
-    -940, -1006, -780, -368, 111, 541, 792, 737, 338, -293, -926, -1324,
-    -1364, -1060, -515, 136, 749, 1157, 1192, 782, 48, -703, -1152, -1159,
-    -830, -389, -4, 271, 412, 349, 31, -455, -867, -959, -669, -166,
-    288, 527, 549, 440, 274, 85, -87, -165, -83, 149, 445, 695,
-    817, 759, 498, 88, -298, -427, -174, 344, 845, 1085, 1024, 784,
-    478, 129, -256, -570, -616, -267, 407, 1150, 1677, 1826, 1591, 1063,
-    370, -336, -875, -1092, -959, -606, -239, 6, 139, 243, 366, 495,
-    621, 789, 1042, 1310, 1399, 1112, 419, -495, -1343, -1896, -2058, -1833,
-    -1276, -478, 387, 1079, 1382, 1237, 781, 252, -143, -307, -227, 52,
-    438, 772, 872, 632, 102, -519, -990, -1131, -891, -341, 347, 948,
-    1242, 1103, 574, -132, -722, -980, -849, -416, 204, 909, 1570, 1964,
-    1837, 1096, -66, -1244, -2066, -2383, -2262, -1843, -1241, -564, 44, 425,
-    509, 367, 149, -28, -139, -215, -292, -400, -598, -949, -1447, -1943,
-    -2201, -2048, -1504, -761, -40, 526, 894, 1027, 855, 348, -391, -1106,
-    -1499, -1402, -871, -142, 524, 966, 1157, 1122, 880, 450, -87, -574,
-    -856, -876, -699, -446, -207, -11, 150, 308, 505, 771, 1077, 1312,
-    1330, 1039, 470, -236, -887, -1309, -1369, -1008, -272, 668, 1555, 2144,
-    2311, 2082, 1581, 948, 334, -87, -148, 202, 811, 1378, 1640, 1550,
-    1261, 968, 756, 609, 534, 616, 930, 1390, 1746, 1749, 1344, 704,
-    75, -383, -611, -571, -207, 447, 1169, 1613, 1540, 990, 238, -417,
-    -813, -908, -693, -182, 498, 1072, 1238, 880, 167, -553, -965, -926,
-    -478, 225, 967, 1513, 1670, 1386, 791, 132, -369, -618, -643, -502,
-    -220, 176, 590, 838, 757, 332, -253, -727, -904, -775, -460, -77,
-    318, 687, 933, 919, 576, -6, -609, -1032, -1188, -1117, -904, -627,
-    -354, -154, -69, -74, -82, -5, 176, 401, 566, 571, 359, -49,
-    -539, -924, -1017, -737, -155, 541, 1145, 1494, 1488, 1083, 333, -575,
-    -1336, -1662, -1435, -778, 26, 699, 1083, 1148, 927, 483, -74, -561,
-    -774, -613, -165, 333, 635, 623, 343, -71, -486, -794, -904, -761,
-    -400, 53, 431, 630, 644, 541, 401, 293, 282, 417, 689, 1007,
-    1223, 1204, 901, 370, -256, -816, -1170, -1226, -945, -353, 437, 1219,
-    1744, 1830, 1460, 789, 49, -570, -972, -1123, -1006, -639, -130, 339,
-    596, 597, 445, 304, 281, 392, 595, 824, 991, 990, 761, 372,
-    3, -168, -99, 118, 358, 571, 759, 911, 968, 898, 754, 652,
-    664, 753, 810, 758, 609, 437, 306, 235, 216, 261, 389, 593,
-    817, 985, 1050, 1010, 869, 611, 217, -265, -697, -918, -845, -517,
-    -64, 382, 720, 895, 890, 736, 507, 303, 196, 203, 276, 318,
-    225, -71, -559, -1123, -1562, -1669, -1338, -635, 213, 919, 1265, 1186,
-    763, 158, -452, -909, -1104, -1005, -682, -279, 36, 153, 57, -183,
-    -454, -643, -663, -474, -106, 332, 681, 802, 640, 247, -266, -776,
-    -1155, -1273, -1033, -459, 265, 867, 1147, 1073, 754, 317, -153, -580,
-    -847, -823, -484, 20, 435, 573, 426, 140, -124, -286, -336, -284,
-    -141, 31, 103, -47, -430, -902, -1250, -1315, -1061, -552, 91, 707,
-    1115, 1152, 757, 20, -838, -1552, -1918, -1851, -1408, -755, -97, 390,
-    610, 547, 252, -176, -603, -902, -997, -909, -743, -628, -648, -804,
-    -1034, -1240, -1325, -1214, -880, -375, 171, 589, 740, 575, 143, -428,
-    -983, -1371, -1480, -1274, -826, -307, 70, 147, -102, -558, -1006, -1231,
-    -1109, -655, -5, 639, 1085, 1196, 918, 295, -519, -1275, -1711, -1672,
-    -1194, -475, 235, 755, 990, 897, 475, -181, -837, -1198, -1088, -569,
-    102, 656, 955, 993, 823, 508, 153, -86, -67, 229, 655, 986,
-    1053, 809, 308, -357, -1058, -1613, -1808, -1506, -753, 201, 1022, 1462,
-    1459, 1115, 592, 27, -484, -848, -977, -843, -528, -210, -58, -115,
-    -282, -405, -378, -189, 106, 423, 664, 729, 556, 168, -319, -752,
-    -1005, -1017, -792, -386, 93, 503, 711, 645, 327, -138, -605, -945,
-    -1073, -959, -637, -200, 209, 453, 470, 314, 111, -39, -105, -103,
-    -42, 56, 108, -22, -405, -937, -1358, -1437, -1132, -590, -1, 526,
-    947, 1185, 1116, 676, -29, -745, -1225, -1377, -1257, -966, -575, -145,
-    226, 424, 411, 266, 121, 51, 38, 35, 27, 15, -38, -203,
-    -496, -802, -913, -667, -69, 682, 1309, 1590, 1444, 925, 160, -680,
-    -1401, -1798, -1717, -1147, -248, 700, 1406, 1675, 1447, 818, 10, -695,
-    -1070, -1033, -666, -145, 349, 687, 803, 692, 411, 69, -205, -302,
-    -182, 95, 402, 601, 624, 486, 244, -53, -358, -581, -595, -330,
-    142, 615, 877, 855, 626, 338, 103, -31, -48, 56, 254, 458,
-    547, 441, 165, -171, -425, -494, -327, 68, 617, 1164, 1508, 1494,
-    1110, 506, -91, -491, -608, -460, -127, 278, 639, 856, 875, 721,
-    483, 281, 204, 284, 497, 776, 1024, 1125, 980, 584, 66, -354,
-    -492, -298, 138, 672, 1172, 1525, 1605, 1302, 613, -285, -1072, -1436,
-    -1242, -590, 263, 1030, 1501, 1560, 1176, 420, -508, -1305, -1677, -1490,
-    -830, 61, 907, 1486, 1643, 1318, 597, -264, -931, -1173, -982, -529,
-    -28, 365, 546, 443, 67, -424, -754, -716, -327, 187, 578, 736,
-    676, 425, -31, -663, -1284, -1606, -1421, -777, 46, 716, 1038, 993,
-    659, 132, -469, -970, -1174, -973, -450, 140, 518, 541, 244, -223,
-    -697, -1049, -1185, -1057, -694, -218, 195, 400, 348, 83, -298, -687,
-    -978, -1085, -963, -639, -224, 129, 295, 249, 67, -106, -150, -29,
-    187, 368, 403, 256, -34, -390, -736, -994, -1076, -896, -434, 204,
-    801, 1112, 992, 459, -315, -1097, -1685, -1961, -1877, -1430, -669, 262,
-    1108, 1596, 1586, 1151, 510, -118, -616, -947, -1088, -1013, -750, -410,
-    -143, -29, -29, -19, 108, 379, 733, 1071, 1300, 1340, 1137, 694,
-    105, -449, -769, -746, -416, 78, 566, 910, 1019, 870, 535, 180,
-    7, 140, 559, 1120, 1639, 1972, 2038, 1824, 1372, 795, 266, -17,
-    89, 583, 1292, 1945, 2311, 2316, 2043, 1636, 1214, 867, 681, 731,
-    1010, 1379, 1638, 1665, 1485, 1223, 991, 838, 795, 916, 1230, 1651,
-    1973, 1997, 1676, 1141, 587, 151, -113, -175, -6, 365, 800, 1100,
-    1137, 935, 654, 471, 491, 721, 1079, 1426, 1612, 1538, 1215, 762,
-    322, -8, -205, -271, -180, 92, 501, 900, 1106, 1032, 760, 484,
-    370, 461, 715, 1077, 1499, 1870, 1983, 1647, 845, -199, -1151, -1754,
-    -1915, -1665, -1077, -277, 540, 1148, 1410, 1347, 1092, 768, 434, 114,
-    -146, -304, -375, -447, -610, -878, -1162, -1329, -1272, -961, -452, 135,
-    648, 948, 948, 645, 121, -465, -938, -1164, -1110, -833, -445, -69,
-    170, 164, -135, -650, -1178, -1478, -1411, -1015, -467, 23, 295, 271,
-    -57, -610, -1217, -1652, -1737, -1437, -879, -276, 177, 354, 215, -200,
-    -762, -1278, -1557, -1514, -1204, -771, -359, -64, 59, -16, -272, -610,
-    -876, -955, -852, -682, -571, -565, -615, -665, -709, -767, -810, -752,
-    -518, -147, 201, 340, 179, -240, -794, -1338, -1735, -1876, -1706, -1266,
-    -680, -111, 300, 456, 328, -19, -420, -673, -657, -410, -104, 63,
-    -21, -346, -815, -1292, -1644, -1760, -1590, -1161, -581, -6, 412, 589,
-    528, 307, 26, -230, -405, -466, -415, -299, -203, -213, -370, -641,
-    -915, -1053, -945, -580, -66, 425, 739, 798, 593, 158, -413, -954,
-    -1261, -1199, -790, -187, 435, 952, 1264, 1259, 861, 137, -650, -1181,
-    -1277, -1005, -591, -241, -49, -13, -96, -234, -321, -240, 53, 476,
-    857, 1043, 965, 631, 83, -592, -1242, -1676, -1755, -1478, -977, -422,
-    64, 422, 619, 627, 451, 156, -143, -338, -389, -348, -328, -439,
-    -723, -1130, -1537, -1803, -1812, -1509, -922, -181, 517, 979, 1096, 879,
-    430, -102, -558, -802, -764, -493, -151, 68, 55, -175, -514, -837,
-    -1054, -1102, -924, -497, 119, 745, 1140, 1121, 674, -44, -809, -1440,
-    -1841, -1957, -1761, -1295, -716, -242, -26, -58, -209, -340, -382, -317,
-    -154, 63, 218, 173, -119, -541, -885, -999, -873, -582, -176, 331,
-    867, 1227, 1165, 597, -278, -1080, -1497, -1460, -1090, -531, 139, 844,
-    1402, 1574, 1231, 497, -312, -896, -1119, -1020, -705, -285, 120, 378,
-    394, 187, -107, -327, -385, -309, -176, -49, 43, 71, -1, -192,
-    -443, -632, -629, -382, 47, 507, 823, 864, 592, 84, -492, -949,
-    -1155, -1080, -788, -390, 11, 346, 577, 693, 697, 621, 533, 495,
-    511, 496, 333, -25, -501, -954, -1273, -1418, -1344, -972, -249, 717,
-    1639, 2197, 2228, 1796, 1086, 277, -485, -1054, -1278, -1101, -641, -139,
-    193, 297, 258, 191, 164, 197, 312, 526, 788, 963, 900, 559,
-    60, -404, -693, -789, -733, -551, -250, 107, 376, 412, 196, -137,
-    -396, -464, -342, -85, 250, 590, 804, 728, 287, -412, -1103, -1522,
-    -1548, -1227, -694, -92, 439, 747, 711, 326, -259, -821, -1193, -1334,
-    -1294, -1126, -866, -565, -313, -198, -241, -366, -451, -407, -237, -23,
-    131, 167, 92, -58, -261, -515, -785, -961, -914, -595, -104, 359,
-    610, 569, 261, -227, -758, -1165, -1303, -1130, -743, -328, -41, 50,
-    -53, -316, -673, -1000, -1137, -972, -529, 30, 503, 747, 712, 420,
-    -62, -605, -1027, -1153, -918, -413, 174, 659, 938, 985, 819, 492,
-    113, -173, -256, -134, 78, 228, 220, 58, -195, -475, -736, -916,
-    -917, -648, -116, 515, 992, 1123, 891, 439, -52, -465, -745, -848,
-    -734, -417, -23, 256, 281, 54, -294, -591, -718, -638, -387, -40,
-    311, 587, 733, 731, 602, 401, 213, 125, 186, 358, 522, 541,
-    357, 46, -213, -256, -43, 328, 711, 1017, 1229, 1336, 1271, 938,
-    325, -402, -955, -1100, -809, -265, 282, 670, 855, 841, 621, 214,
-    -261, -607, -674, -468, -125, 203, 442, 561, 518, 278, -109, -477,
-    -650, -585, -387, -202, -91, -28, 30, 82, 116, 152, 233, 360,
-    477, 511, 439, 287, 84, -173, -482, -780, -930, -792, -333, 318,
-    931, 1310, 1394, 1263, 1039, 796, 551, 316, 142, 85, 132, 200,
-    195, 91, -64, -197, -244, -163, 73, 430, 788, 986, 942, 727,
-    504, 385, 359, 352, 326, 303, 283, 192, -60, -471, -900, -1159,
-    -1133, -830, -334, 256, 838, 1281, 1440, 1211, 614, -188, -951, -1461,
-    -1613, -1423, -976, -376, 247, 727, 901, 711, 261, -228, -575, -724,
-    -715, -588, -362, -100, 54, -38, -366, -742, -942, -866, -576, -192,
-    204, 549, 741, 659, 284, -235, -651, -791, -660, -375, -46, 270,
-    512, 581, 399, 22, -354, -514, -383, -56, 317, 650, 931, 1122,
-    1117, 825, 292, -268, -598, -577, -280, 97, 387, 519, 505, 383,
-    191, -21, -173, -192, -60, 163, 362, 416, 258, -93, -536, -916,
-    -1093, -1010, -732, -395, -119, 59, 155, 161, 27, -270, -628, -831,
-    -701, -260, 270, 627, 688, 498, 168, -216, -589, -841, -826, -478,
-    89, 625, 895, 815, 464, -9, -463, -791, -907, -758, -371, 124,
-    537, 712, 619, 351, 60, -146, -237, -221, -107, 96, 326, 464,
-    416, 193, -93, -323, -438, -420, -225, 195, 786, 1340, 1604, 1466,
-    1038, 542, 145, -101, -190, -103, 143, 422, 542, 379, -12, -448,
-    -752, -838, -692, -324, 207, 762, 1147, 1219, 972, 532, 65, -316,
-    -567, -684, -674, -554, -375, -221, -173, -241, -339, -329, -123, 236,
-    604, 843, 894, 764, 455, -39, -655, -1209, -1467, -1310, -815, -193,
-    354, 728, 897, 843, 557, 100, -374, -687, -735, -540, -222, 74,
-    238, 220, 44, -203, -394, -416, -225, 130, 528, 834, 957, 878,
-    636, 306, -13, -218, -235, -67, 190, 398, 463, 379, 202, -18,
-    -242, -396, -357, -23, 552, 1143, 1480, 1425, 1045, 505, -67, -615,
-    -1072, -1301, -1166, -666, 2, 561, 830, 815, 635, 400, 168, -20,
-    -104, -49, 83, 148, 21, -291, -653, -914, -987, -861, -547, -79,
-    447, 861, 988, 764, 279, -284, -757, -1036, -1072, -856, -444, 20,
-    330, 332, 16, -462, -883, -1081, -1012, -722, -283, 224, 678, 902,
-    744, 207, -489, -1024, -1170, -913, -399, 209, 797, 1260, 1453, 1267,
-    743, 100, -393, -599, -551, -355, -87, 208, 456, 544, 410, 114,
-    -188, -351, -335, -189, 2, 168, 255, 222, 64, -174, -408, -559,
-    -592, -526, -411, -305, -254, -298, -459, -705, -927, -955, -663, -77,
-    606, 1125, 1315, 1163, 747, 156, -523, -1145, -1513, -1489, -1107, -572,
-    -110, 162, 252, 206, 66, -117, -247, -241, -114, 2, -42, -289,
-    -649, -989, -1231, -1363, -1376, -1218, -827, -220, 465, 1010, 1231, 1072,
-    613, -3, -637, -1183, -1543, -1624, -1390, -910, -359, 85, 326, 384,
-    339, 269, 228, 250, 323, 372, 277, -37, -520, -1004, -1313, -1368,
-    -1203, -892, -496, -72, 280, 433, 319, 6, -340, -577, -683, -733,
-    -797, -858, -859, -786, -696, -655, -651, -612, -487, -308, -157, -81,
-    -68, -103, -220, -478, -867, -1260, -1486, -1446, -1180, -814, -465, -190,
-    -17, 18, -121, -412, -748, -982, -1017, -873, -671, -549, -576, -743,
-    -995, -1272, -1506, -1622, -1564, -1341, -1035, -750, -542, -413, -348, -347,
-    -400, -455, -442, -355, -293, -380, -650, -1008, -1312, -1488, -1537, -1456,
-    -1177, -637, 104, 828, 1283, 1338, 1058, 623, 191, -167, -441, -609,
-    -625, -471, -210, 29, 135, 100, 9, -26, 53, 241, 497, 756,
-    917, 857, 521, -3, -509, -802, -817, -615, -277, 152, 610, 950,
-    992, 681, 167, -293, -520, -515, -373, -163, 100, 365, 504, 388,
-    12, -477, -886, -1094, -1081, -870, -487, -1, 440, 659, 554, 190,
-    -242, -549, -640, -527, -269, 75, 430, 672, 666, 366, -113, -542,
-    -729, -645, -410, -168, 15, 143, 209, 163, -33, -321, -561, -629,
-    -506, -271, -28, 155, 238, 188, -5, -289, -547, -661, -591, -389,
-    -147, 58, 177, 174, 33, -199, -393, -397, -142, 295, 729, 993,
-    1015, 809, 409, -154, -800, -1362, -1626, -1467, -947, -282, 291, 637,
-    746, 665, 456, 194, -23, -116, -84, -15, -20, -155, -408, -747,
-    -1153, -1569, -1857, -1826, -1374, -607, 184, 707, 846, 697, 439, 194,
-    -17, -203, -334, -359, -275, -159, -118, -216, -442, -732, -1004, -1165,
-    -1131, -868, -441, -6, 268, 291, 76, -303, -762, -1207, -1515, -1558,
-    -1284, -777, -226, 185, 368, 343, 182, -45, -282, -478, -581, -571,
-    -467, -325, -203, -130, -94, -52, 42, 214, 464, 761, 1053, 1259,
-    1275, 1027, 525, -100, -653, -964, -961, -669, -175, 403, 918, 1224,
-    1241, 1012, 691, 446, 365, 440, 607, 806, 983, 1083, 1059, 909,
-    697, 530, 495, 610, 815, 1007, 1091, 1022, 820, 547, 286, 107,
-    59, 159, 398, 735, 1105, 1420, 1579, 1500, 1172, 694, 245, -14,
-    -45, 68, 193, 254, 247, 182, 56, -113, -234, -164, 181, 736,
-    1305, 1680, 1736, 1459, 907, 186, -541, -1076, -1254, -1039, -552, -3,
-    428, 671, 752, 719, 590, 369, 108, -63, -21, 227, 510, 592,
-    358, -100, -566, -867, -958, -882, -673, -351, 23, 316, 391, 210,
-    -132, -488, -750, -879, -876, -748, -528, -294, -141, -125, -228, -381,
-    -521, -609, -628, -570, -458, -372, -411, -618, -923, -1172, -1241, -1111,
-    -840, -480, -37, 465, 905, 1082, 857, 282, -418, -996, -1322, -1393,
-    -1249, -933, -520, -157, -11, -137, -428, -685, -757, -623, -357, -48,
-    227, 386, 364, 167, -99, -277, -274, -128, 45, 154, 199, 212,
-    189, 65, -201, -537, -770, -750, -465, -43, 361, 666, 867, 959,
-    917, 739, 514, 380, 418, 593, 799, 971, 1101, 1172, 1106, 824,
-    370, -63, -253, -115, 247, 647, 960, 1163, 1272, 1272, 1137, 905,
-    705, 667, 806, 982, 994, 731, 245, -313, -794, -1109, -1197, -999,
-    -501, 197, 885, 1355, 1518, 1419, 1153, 784, 354, -69, -392, -564,
-    -622, -639, -639, -575, -409, -169, 72, 286, 506, 753, 941, 918,
-    588, 19, -607, -1114, -1410, -1463, -1251, -777, -133, 479, 843, 868,
-    629, 292, -10, -222, -324, -275, -37, 351, 740, 937, 847, 540,
-    201, -13, -69, -40, -1, 33, 84, 152, 189, 158, 81, 31,
-    75, 225, 443, 672, 858, 952, 919, 750, 473, 145, -159, -363,
-    -397, -240, 51, 357, 565, 634, 618, 603, 634, 691, 719, 685,
-    600, 493, 380, 238, 50, -151, -267, -198, 78, 462, 799, 962,
-    908, 657, 253, -230, -659, -867, -746, -341, 150, 501, 585, 416,
-    93, -288, -667, -979, -1129, -1017, -615, -15, 598, 1039, 1216, 1140,
-    868, 454, -55, -580, -995, -1176, -1073, -748, -335, 32, 290, 460,
-    614, 809, 1033, 1197, 1183, 921, 441, -152, -736, -1217, -1522, -1579,
-    -1336, -817, -155, 435, 764, 758, 491, 128, -168, -316, -329, -258,
-    -137, 41, 274, 503, 620, 555, 355, 157, 83, 130, 189, 146,
-    -12, -201, -320, -324, -228, -71, 117, 325, 547, 768, 942, 997,
-    859, 514, 44, -404, -697, -784, -694, -497, -269, -76, 14, -32,
-    -185, -348, -407, -293, -28, 287, 541, 667, 655, 523, 285, -32,
-    -355, -566, -566, -362, -72, 152, 226, 159, 10, -155, -260, -217,
-    25, 403, 739, 846, 650, 227, -282, -761, -1135, -1332, -1276, -931,
-    -373, 217, 640, 771, 616, 286, -84, -393, -595, -673, -620, -453,
-    -241, -100, -122, -306, -549, -715, -724, -583, -362, -141, 17, 81,
-    47, -67, -246, -469, -701, -867, -877, -691, -367, -47, 129, 103,
-    -75, -297, -463, -526, -495, -416, -347, -340, -420, -569, -727, -811,
-    -757, -563, -285, -1, 219, 321, 257, 6, -381, -760, -952, -854,
-    -517, -91, 280, 539, 673, 643, 381, -125, -756, -1290, -1539, -1455,
-    -1129, -699, -275, 82, 325, 412, 337, 146, -68, -218, -264, -221,
-    -150, -115, -148, -235, -320, -356, -321, -224, -78, 109, 311, 461,
-    467, 274, -72, -420, -587, -472, -118, 314, 649, 789, 732, 513,
-    169, -244, -606, -751, -561, -65, 563, 1106, 1418, 1458, 1259, 885,
-    430, 5, -289, -402, -344, -169, 62, 295, 490, 633, 726, 775,
-    780, 741, 659, 531, 334, 46, -304, -616, -767, -699, -451, -106,
-    277, 672, 1037, 1284, 1314, 1098, 701, 241, -171, -467, -610, -583,
-    -394, -100, 199, 388, 405, 284, 141, 94, 177, 327, 449, 489,
-    445, 332, 155, -77, -314, -466, -453, -252, 86, 449, 718, 816,
-    759, 639, 561, 569, 638, 730, 819, 880, 844, 625, 210, -284,
-    -653, -732, -492, -32, 503, 1001, 1404, 1679, 1795, 1727, 1494, 1178,
-    892, 720, 672, 696, 734, 743, 691, 539, 279, -16, -198, -139,
-    175, 637, 1113, 1523, 1848, 2073, 2139, 1974, 1563, 992, 424, 21,
-    -141, -100, 36, 177, 300, 430, 597, 805, 1043, 1284, 1476, 1544,
-    1427, 1124, 690, 193, -294, -677, -818, -608, -69, 614, 1188, 1483,
-    1477, 1258, 931, 576, 254, 30, -43, 44, 240, 440, 524, 419,
-    137, -232, -572, -788, -835, -714, -472, -192, 38, 172, 206, 150,
-    11, -193, -408, -571, -678, -794, -971, -1159, -1232, -1104, -816, -485,
-    -184, 97, 374, 571, 557, 258, -252, -784, -1165, -1320, -1274, -1080,
-    -766, -350, 101, 448, 547, 356, -12, -365, -568, -617, -589, -546,
-    -505, -476, -493, -583, -710, -788, -755, -621, -446, -275, -119, 17,
-    113, 133, 63, -80, -261, -441, -583, -653, -633, -531, -367, -165,
-    53, 273, 474, 634, 726, 715, 581, 326, -23, -435, -867, -1235,
-    -1416, -1294, -860, -250, 331, 736, 941, 994, 922, 708, 342, -109,
-    -515, -758, -804, -704, -553, -427, -368, -379, -438, -496, -492, -375,
-    -146, 134, 366, 474, 446, 327, 177, 30, -100, -199, -253, -263,
-    -260, -287, -362, -462, -539, -545, -447, -233, 73, 408, 671, 778,
-    701, 492, 245, 39, -91, -150, -151, -99, 6, 139, 243, 262,
-    177, 27, -111, -170, -122, 19, 210, 391, 492, 464, 306, 80,
-    -126, -249, -286, -263, -196, -78, 79, 215, 253, 168, 36, -21,
-    67, 251, 405, 424, 296, 85, -143, -361, -556, -689, -682, -481,
-    -123, 272, 558, 649, 551, 332, 81, -122, -219, -198, -92, 34,
-    117, 121, 28, -176, -475, -800, -1018, -1010, -759, -371, -9, 222,
-    311, 291, 180, -26, -301, -567, -739, -798, -805, -829, -869, -865,
-    -775, -633, -523, -470, -402, -224, 67, 330, 392, 177, -243, -728,
-    -1169, -1504, -1667, -1557, -1115, -423, 290, 776, 905, 709, 305, -200,
-    -734, -1220, -1562, -1682, -1574, -1309, -979, -644, -331, -58, 155, 307,
-    414, 476, 430, 175, -337, -1015, -1644, -2017, -2050, -1805, -1395, -893,
-    -327, 247, 712, 949, 924, 719, 465, 248, 82, -53, -177, -311,
-    -495, -774, -1118, -1405, -1473, -1243, -769, -189, 374, 848, 1174, 1268,
-    1056, 560, -58, -575, -838, -841, -686, -483, -287, -123, -31, -57,
-    -193, -332, -334, -123, 239, 612, 885, 1026, 1046, 923, 619, 154,
-    -335, -654, -674, -420, -30, 340, 585, 656, 546, 295, 2, -197,
-    -200, -15, 244, 427, 433, 247, -83, -466, -779, -878, -658, -143,
-    487, 974, 1138, 968, 583, 102, -411, -900, -1247, -1301, -993, -435,
-    139, 521, 650, 587, 418, 185, -91, -359, -535, -561, -462, -333,
-    -266, -287, -350, -387, -354, -236, -41, 186, 359, 366, 140, -271,
-    -723, -1054, -1174, -1073, -779, -326, 223, 733, 1033, 1007, 671, 159,
-    -352, -719, -864, -769, -471, -61, 335, 597, 660, 537, 298, 33,
-    -182, -297, -300, -218, -122, -101, -206, -396, -546, -525, -287, 102,
-    526, 889, 1132, 1196, 995, 474, -302, -1131, -1748, -1962, -1735, -1185,
-    -506, 125, 591, 846, 875, 687, 331, -96, -466, -685, -742, -704,
-    -661, -664, -700, -709, -617, -374, 5, 426, 755, 876, 747, 402,
-    -73, -573, -986, -1207, -1160, -834, -303, 286, 759, 989, 940, 680,
-    334, 19, -193, -279, -256, -175, -107, -107, -172, -236, -217, -86,
-    123, 338, 494, 554, 504, 342, 88, -223, -532, -773, -879, -797,
-    -524, -122, 287, 563, 614, 435, 111, -235, -504, -649, -658, -526,
-    -266, 61, 332, 417, 267, -44, -367, -570, -599, -481, -280, -69,
-    94, 172, 171, 133, 107, 122, 176, 250, 316, 345, 303, 164,
-    -72, -349, -570, -634, -502, -221, 93, 329, 421, 370, 221, 44,
-    -90, -128, -61, 88, 280, 495, 707, 854, 841, 605, 193, -238,
-    -500, -497, -261, 86, 434, 726, 951, 1098, 1135, 1037, 829, 594,
-    433, 402, 477, 570, 587, 487, 299, 115, 43, 152, 438, 817,
-    1171, 1382, 1363, 1069, 520, -165, -772, -1069, -931, -406, 306, 970,
-    1416, 1573, 1441, 1065, 528, -44, -504, -739, -725, -537, -307, -159,
-    -150, -255, -389, -445, -343, -78, 268, 560, 680, 593, 349, 32,
-    -288, -563, -747, -779, -626, -314, 54, 357, 515, 528, 455, 375,
-    345, 387, 489, 621, 735, 785, 731, 554, 277, -37, -292, -386,
-    -262, 53, 446, 760, 893, 846, 714, 601, 558, 569, 598, 631,
-    667, 689, 646, 494, 235, -57, -267, -297, -114, 237, 663, 1049,
-    1280, 1270, 998, 541, 62, -266, -347, -202, 74, 376, 635, 808,
-    866, 794, 608, 372, 167, 65, 99, 247, 445, 606, 656, 563,
-    350, 95, -98, -147, -33, 191, 429, 598, 650, 563, 330, -15,
-    -372, -594, -559, -244, 264, 820, 1282, 1554, 1591, 1408, 1066, 646,
-    227, -133, -384, -479, -396, -160, 155, 467, 730, 949, 1154, 1346,
-    1471, 1443, 1222, 868, 512, 246, 57, -124, -299, -348, -124, 387,
-    1015, 1518, 1737, 1676, 1438, 1125, 802, 509, 303, 241, 340, 538,
-    714, 764, 668, 507, 386, 360, 411, 490, 567, 621, 615, 511,
-    310, 75, -105, -169, -95, 107, 394, 675, 830, 779, 543, 233,
-    -35, -201, -264, -240, -138, 14, 158, 217, 145, -42, -256, -383,
-    -343, -132, 186, 526, 810, 968, 922, 632, 160, -326, -643, -721,
-    -622, -453, -271, -91, 52, 81, -50, -285, -483, -520, -379, -148,
-    58, 164, 153, 36, -188, -515, -907, -1256, -1429, -1350, -1062, -692,
-    -356, -94, 109, 254, 313, 268, 137, -38, -232, -444, -665, -869,
-    -1024, -1102, -1058, -821, -343, 326, 1008, 1479, 1592, 1342, 839, 224,
-    -378, -861, -1123, -1089, -761, -249, 259, 599, 720, 693, 616, 524,
-    389, 201, 31, -24, 52, 155, 149, -11, -243, -421, -479, -431,
-    -327, -208, -96, -22, -21, -106, -255, -407, -493, -465, -318, -98,
-    106, 191, 82, -238, -705, -1192, -1552, -1681, -1545, -1182, -673, -130,
-    306, 497, 370, -32, -564, -1065, -1433, -1642, -1698, -1611, -1418, -1199,
-    -1049, -1016, -1059, -1080, -995, -782, -481, -159, 110, 250, 192, -95,
-    -557, -1061, -1447, -1605, -1527, -1290, -990, -701, -466, -311, -247, -250,
-    -260, -214, -97, 45, 136, 113, -46, -323, -671, -1007, -1226, -1235,
-    -1011, -616, -177, 185, 392, 418, 271, -17, -372, -687, -860, -850,
-    -700, -500, -333, -240, -225, -282, -390, -509, -571, -520, -343, -91,
-    144, 278, 265, 104, -158, -442, -653, -714, -597, -346, -51, 196,
-    344, 395, 377, 324, 270, 247, 271, 323, 349, 290, 133, -77,
-    -270, -385, -383, -240, 47, 437, 826, 1087, 1130, 949, 623, 257,
-    -61, -275, -360, -308, -146, 61, 223, 263, 166, -5, -148, -180,
-    -78, 117, 338, 520, 615, 596, 463, 256, 45, -103, -145, -78,
-    63, 219, 325, 338, 263, 152, 64, 23, 14, 10, 7, 19,
-    54, 96, 113, 85, 20, -49, -93, -105, -108, -121, -147, -159,
-    -132, -66, 7, 51, 51, 27, 2, -14, -23, -28, -26, -16,
-    -6, -3, -14, -34, -63, -99, -140, -176, -198, -201, -184, -147,
-    -92, -21, 52, 113, 146, 144, 104, 36, -38, -92, -111, -102,
-    -79, -57, -39, -26, -17, -9, 3, 23, 41, 43, 27, 8,
-    1, 6, 13, 15, 21, 42, 78, 117, 147, 162, 159, 137,
-    95, 39, -17, -57, -66, -43, 7, 64, 106, 123, 117, 96,
-    62, 13, -45, -92, -105, -77, -26, 21, 42, 34, 8, -11,
-    1, 48, 110, 153, 157, 127, 85, 48, 18, -8, -30, -43,
-    -46, -43, -41, -41, -42, -41, -34, -13, 28, 79, 121, 137,
-    128, 103, 76, 51, 27, 1, -23, -42, -48, -38, -17, -1,
-    2, -10, -21, -16, 9, 45, 81, 111, 127, 116, 72, 1,
-    -73, -125, -135, -102, -38, 33, 83, 93, 61, 5, -51, -91,
-    -108, -99, -64, -15, 31, 51, 33, -17, -79, -126, -141, -127,
-    -101, -75, -51, -18, 24, 55, 48, -1, -69, -115, -119, -84,
-    -33, 9, 30, 26, 4, -30, -68, -105, -137, -152, -135, -87,
-    -27, 20, 42, 50, 56, 65, 64, 46, 14, -20, -44, -55,
-    -54, -45, -33, -19, -2, 20, 44, 63, 70, 67, 60, 51,
-    40, 18, -12, -40, -55, -51, -35, -20, -19, -32, -50, -62,
-    -65, -61, -50, -29, 0, 31, 48, 44, 23, -2, -20, -28,
-    -27, -20, -9, 0, 7, 11, 13, 17, 24, 35, 45, 48,
-    39, 25, 20, 31, 49, 58, 50, 35, 22, 18, 17, 19,
-    29, 45, 58, 59, 49, 35, 25, 14, 1, -6, 3, 25,
-    43, 44, 27, 8, -2, -6, -9, -11, -6, 12, 40, 65,
-    72, 61, 41, 23, 10, -4, -19, -28, -22, -6, 3, -9,
-    -33, -48, -38, -8, 24, 42, 43, 30, 8, -18, -41, -50,
-    -41, -18, 12, 40, 60, 67, 57, 33, 7, -8, -2, 27,
-    62, 83, 75, 40, -1, -30, -40, -36, -21, 1, 28, 52,
-    66, 67, 60, 51, 37, 22, 17, 29, 52, 67, 57, 26,
-    -5, -20, -17, -9, -6, -6, 2, 22, 46, 55, 43, 15,
-    -10, -23, -29, -38, -54, -70, -78, -73, -59, -39, -18, 3,
-    21, 32, 35, 34, 27, 10, -22, -65, -105, -124, -113, -81,
-    -53, -43, -46, -47, -34, -15, -5, -3, 4, 27, 50, 46,
-    2, -66, -126, -162, -171, -156, -109, -29, 61, 119, 118, 66,
-    -4, -66, -116, -157, -176, -148, -67, 33, 105, 120, 97, 74,
-    71, 69, 39, -23, -88, -122, -122, -111, -107, -99, -55, 32,
-    134, 205, 219, 190, 145, 98, 46, -19, -79, -107, -88, -35,
-    25, 70, 95, 99, 81, 42, 0, -24, -26, -30, -61, -110,
-    -133, -97, -23, 32, 35, 8, 5, 44, 89, 85, 20, -65,
-    -119, -129, -119, -116, -119, -110, -71, -12, 48, 90, 101, 80,
-    34, -17, -43, -30, 14, 54, 55, 9, -63, -128, -169, -187,
-    -182, -147, -71, 36, 133, 170, 120, 7, -109, -171, -160, -102,
-    -42, -17, -31, -66, -100, -123, -133, -128, -98, -28, 80, 200,
-    285, 294, 216, 85, -41, -124, -161, -178, -193, -201, -182, -127,
-    -55, 3, 23, 9, -8, 9, 81, 192, 288, 321, 272, 167,
-    51, -49, -126, -179, -194, -155, -68, 28, 79, 60, -10, -80,
-    -107, -75, 4, 106, 206, 273, 273, 199, 79, -31, -88, -90,
-    -66, -43, -14, 24, 54, 31, -63, -190, -267, -230, -79, 134,
-    347, 511, 587, 538, 352, 87, -146, -238, -152, 55, 286, 469,
-    564, 545, 388, 100, -242, -507, -587, -468, -235, -3, 156, 233,
-    251, 242, 249, 318, 469, 649, 742, 642, 334, -94, -526, -890,
-    -1162, -1315, -1285, -1019, -554, -38, 359, 556, 590, 549, 477, 359,
-    180, -34, -227, -375, -509, -667, -849, -1016, -1118, -1123, -994, -684,
-    -175, 458, 1034, 1358, 1337, 1024, 555, 51, -420, -798, -998, -945,
-    -655, -261, 63, 217, 227, 192, 192, 247, 335, 431, 501, 491,
-    345, 66, -261, -504, -573, -472, -263, -7, 265, 516, 668, 635,
-    399, 48, -269, -440, -450, -356, -215, -63, 68, 125, 57, -123,
-    -327, -438, -402, -250, -60, 107, 220, 248, 147, -104, -447, -749,
-    -874, -772, -507, -204, 33, 155, 153, 37, -172, -410, -599, -673,
-    -631, -521, -397, -283, -188, -130, -137, -205, -278, -284, -198, -77,
-    -4, -25, -125, -264, -425, -606, -780, -881, -834, -618, -276, 103,
-    424, 618, 644, 509, 278, 56, -66, -63, 14, 78, 69, -18,
-    -141, -250, -308, -292, -181, 29, 312, 589, 757, 747, 560, 277,
-    4, -183, -258, -234, -135, 13, 174, 301, 353, 316, 202, 41,
-    -142, -318, -450, -489, -409, -232, -17, 169, 286, 329, 306, 231,
-    121, 3, -97, -176, -258, -363, -483, -568, -564, -436, -200, 97,
-    389, 612, 717, 680, 518, 294, 96, -3, 11, 88, 145, 107,
-    -55, -313, -601, -830, -914, -805, -506, -75, 404, 851, 1195, 1363,
-    1285, 929, 345, -325, -904, -1261, -1363, -1249, -973, -574, -93, 393,
-    785, 1003, 1039, 947, 802, 649, 499, 340, 162, -26, -180, -227,
-    -94, 244, 728, 1230, 1618, 1820, 1831, 1680, 1394, 994, 527, 91,
-    -189, -220, 0, 390, 833, 1234, 1543, 1733, 1784, 1691, 1476, 1189,
-    872, 548, 228, -62, -285, -417, -469, -461, -376, -167, 193, 649,
-    1070, 1317, 1328, 1149, 880, 601, 344, 104, -127, -328, -475, -552,
-    -561, -515, -417, -253, -4, 336, 737, 1119, 1377, 1428, 1250, 900,
-    475, 65, -271, -502, -598, -531, -296, 74, 507, 915, 1213, 1355,
-    1344, 1233, 1089, 957, 835, 697, 520, 317, 125, 2, -3, 138,
-    418, 795, 1208, 1584, 1839, 1890, 1685, 1249, 705, 212, -105, -214,
-    -162, -16, 169, 353, 505, 613, 693, 775, 880, 992, 1070, 1066,
-    947, 705, 365, -2, -282, -359, -176, 230, 745, 1237, 1607, 1792,
-    1758, 1498, 1056, 539, 88, -185, -240, -95, 197, 570, 936, 1197,
-    1281, 1187, 970, 701, 423, 154, -93, -296, -432, -490, -467, -363,
-    -175, 103, 470, 890, 1267, 1457, 1336, 901, 278, -353, -865, -1212,
-    -1371, -1295, -962, -456, 25, 282, 245, 0, -299, -541, -687, -732,
-    -671, -518, -332, -212, -237, -409, -656, -878, -1001, -1003, -898, -719,
-    -515, -352, -297, -388, -604, -870, -1100, -1233, -1248, -1163, -1018, -865,
-    -755, -714, -739, -800, -859, -881, -837, -717, -548, -391, -331, -433,
-    -712, -1114, -1524, -1805, -1849, -1631, -1216, -732, -314, -55, 16, -77,
-    -279, -522, -744, -898, -961, -949, -926, -980, -1159, -1428, -1664, -1732,
-    -1561, -1180, -687, -212, 133, 272, 187, -84, -474, -915, -1335, -1641,
-    -1739, -1591, -1259, -874, -540, -283, -75, 79, 129, 37, -165, -390,
-    -569, -702, -826, -954, -1063, -1116, -1094, -986, -785, -501, -194, 39,
-    114, 14, -222, -534, -866, -1143, -1266, -1153, -816, -375, 11, 238,
-    293, 212, 28, -224, -479, -637, -623, -440, -172, 71, 207, 206,
-    86, -104, -307, -478, -605, -692, -738, -726, -648, -531, -411, -297,
-    -165, 2, 165, 261, 250, 160, 54, -23, -68, -95, -107, -95,
-    -64, -30, -10, -1, 8, 20, 22, 4, -28, -49, -38, 8,
-    67, 110, 117, 92, 57, 34, 29, 30, 25, 14, 7, 12,
-    27, 42, 46, 37, 21, 7, 2, 16, 50, 92, 123, 124,
-    97, 59, 24, -7, -38, -64, -64, -21, 55, 128, 162, 145,
-    94, 33, -22, -66, -92, -92, -67, -31, -5, 0, -11, -23,
-    -20, 0, 29, 52, 59, 48, 22, -13, -49, -76, -86, -79,
-    -55, -19, 26, 72, 104, 107, 81, 39, -6, -48, -82, -98,
-    -81, -30, 28, 68, 79, 74, 68, 60, 38, 8, -12, -6,
-    14, 25, 11, -19, -43, -45, -28, -2, 28, 55, 78, 94,
-    101, 99, 87, 59, 25, -1, -2, 13, 26, 17, -9, -29,
-    -22, 4, 31, 46, 54, 65, 81, 96, 107, 112, 108, 84,
-    38, -16, -54, -65, -58, -48, -32, 0, 47, 90, 110, 112,
-    111, 111, 95, 49, -19, -76, -97, -86, -60, -30, 0, 24,
-    33, 20, -6, -29, -39, -34, -18, 4, 16, 7, -25, -62,
-    -78, -58, -15, 27, 52, 57, 43, 17, -12, -32, -31, -15,
-    5, 18, 24, 24, 17, 3, -14, -24, -25, -22, -26, -36,
-    -43, -41, -30, -20, -13, -6, 2, 12, 21, 29, 40, 52,
-    61, 66, 73, 87, 103, 105, 81, 35, -14, -48, -61, -57,
-    -49, -43, -37, -27, -7, 15, 26, 18, -1, -14, -11, 1,
-    1, -22, -56, -79, -76, -51, -17, 11, 28, 29, 18, 2,
-    -11, -15, -15, -15, -9, 9, 38, 60, 57, 25, -18, -48,
-    -55, -44, -31, -25, -24, -17, -1, 20, 35, 34, 15, -8,
-    -22, -19, -8, 2, 6, 7, 9, 10, 4, -7, -14, -8,
-    7, 20, 21, 11, 2, 0, 2, 1, -5, -11, -11, -10,
-    -12, -20, -31, -36, -35, -29, -20, -11, -2, 7, 16, 23,
-    27, 21, 4, -17, -33, -40, -34, -20, -1, 16, 22, 13,
-    -7, -25, -36, -41, -48, -54, -51, -36, -13, 8, 23, 36,
-    45, 47, 37, 19, 2, -5, -6, -5, -8, -14, -23, -32,
-    -37, -33, -19, -1, 10, 8, 0, -6, -9, -10, -14, -18,
-    -16, -11, -10, -16, -27, -33, -34, -32, -33, -36, -39, -42,
-    -46, -49, -46, -34, -17, 0, 7, 6, -5, -22, -41, -54,
-    -57, -51, -43, -33, -20, -3, 13, 15, 1, -18, -27, -21,
-    -10, -3, -5, -7, -4, 4, 8, 6, -2, -12, -20, -22,
-    -19, -11, -5, -1, 1, 3, 4, 4, 3, 3, 8, 14,
-    17, 15, 10, 1, -9, -21, -29, -30, -22, -10, -2, 0,
-    3, 9, 15, 15, 9, 1, -2, 0, 1, -2, -5, -4,
-    2, 6, 2, -10, -20, -21, -12, 1, 10, 11, 7, 0,
-    -9, -16, -23, -28, -30, -27, -18, -5, 6, 13, 16, 16,
-    14, 10, 6, 3, 2, -2, -8, -15, -21, -24, -25, -25,
-    -23, -17, -8, 0, 7, 10, 10, 4, -8, -20, -26, -22,
-    -12, -5, -5, -10, -12, -8, 0, 3, 1, -3, -2, 2,
-    8, 11, 10, 7, 2, -3, -6, -7, -3, 3, 6, 5,
-    4, 3, 5, 6, 5, 3, 0, -3, -6, -6, -2, 1,
-    2, 0, -4, -4, -1, 3, 5, 5, 3, 0, -4, -6,
-    -5, 1, 5, 5, 2, -1, -2, 0, 2, 2, 2, 1,
-    -2, -5, -6, -5, -3, -2, -2, -2, -1, -1, -1, -3,
-    -4, -4, -3, -3, -2, 1, 6, 9, 7, 2, -3, -4,
-    -1, 2, 1, 0, -1, -1, 0, -2, -5, -6, -3, 0,
-    2, 0, -2, -2, 0, 1, -1, -2, -2, 0, 1, 1,
-    -1, -1, 2, 5, 6, 5, 2, -2, -4, -4, -3, 0,
-    0, -2, -4, -4, -2, 0, 1, 0, 0, 1, 0, -1,
-    -2, -2, -1, 0, -1, -2, -1, 1, 3, 2, 0, -2,
-    -2, 0, 2, 3, 3, 3, 2, 3, 2, 2, 2, 2,
-    1, 0, -1, -2, -2, -1, 1, 2, 0, -2, -2, -2,
-    0, 2, 2, 1, 0, -1, -2, -3, -3, -1, 2, 5,
-    6, 5, 1, -2, -3, -1, 1, 0, -2, -4, -4, -3,
-    -2, -1, 0, -1, -2, -4, -4, -3, -1, -1, -1, -2,
-    0, 1, 2, 1, -1, -2, -2, 0, 1, 1, -1, -2,
-    -3, -2, -2, -2, -3, -4, -1, 2, 4, 4, 2, 1,
-    0, 0, -1, -1, 0, 2, 1, 0, -2, -2, 0, 1,
-    0, -2, -4, -3, -1, -1, -1, -1, 0, 1, 2, 2,
-    1, 0, 1, 2, 2, 1, -2, -3, -3, -2, -3, -6,
-    -6, -4, -1, 0, -1, -3, -2, 0, 1, 1, -1, -1,
-    0, 1, 1, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-    -1, -1, -1, 0, 1, 3, 2, 0, -2, -3, -2, -1,
-    0, -2, -3, -3, -1, 0, -1, -2, -1, 0, 0, 0,
-    -1, -1, 0, 0, 0, 0, 0, 0, -1, -3, -3, -3,
-    -1, 0, 1, 1, 1, 1, 0, -1, -1, 0, 2, 2,
-    1, 0, -2, -2, -2, -2, -1, -1, -1, -1, -1, 0,
-    1, 1, 0, -1, -1, 0, 1, 3, 3, 2, 0, -2,
-    -3, -3, -1, 0, 2, 3, 1, 0, -1, -1, -1, -1,
-    0, 0, 1, 2, 1, -1, -2, -2, -1, -2, -2, -3,
-    -3, -2, -1, 0, 0, -1, -2, -2, 0, 1, 2, 2,
-    0, -1, -2, -3, -3, -2, -1, 0, 0, 0, 0, 1,
-    2, 2, 0, -1, 0, 0, 0, -2, -2, -1, -1, -2,
-    -4, -4, -2, 0, 1, 0, -1, -1, -1, -1, 0, -1,
-    -1, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 1,
-    0, -2, -2, -1, -1, -2, -1, -1, 0, 0, 0, 1,
-    1, 1, 1, 0, 1, 1, 0, -1, -3, -3, -1, 0,
-    0, 0, 1, 2, 1, 0, -1, -1, -1, 1, 1, 1,
-    1, 1, 0, -1, -2, -1, 0, 0, 0, -1, 0, 1,
-    2, 1, -1, -1, 0, 1, 1, 1, 0, 0, 0, -1,
-    -2, -2, -1, 0, 0, -1, -1, -1, -1, -2, -2, -2,
-    -1, 0, 1, 1, 1, 0, -1, -1, -1, -1, 0, 0,
-    -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2,
-    -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1,
-    -1, -1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-    0, 0, -1, -2, -1, -1, -1, -2, -2, -1, 0, 0,
-    0, 1, 1, 2, 1, 0, -1, -1, -1, -1, 0, 0,
-    0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1,
-    -1, -1, -1, 0, 1, 0, 0, 0, 1, 1, 0, 0,
-    0, 0, -1, -2, -2, -1, -1, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1,
-    0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-    -1, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-};
@@ -1,4999 +0,0 @@
-#include "clip_06.h"
-
-// Auto-generated by wav2cpp  do not edit
-// 59904 samples, 48000 Hz, mono
-
-const int16_t CLIP_06_SAMPLES[] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1,
-    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0,
-    -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
-    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1,
-    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-    -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
-    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0,
-    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
-    0, 0, 0, 0, -1, -1, 0, 0, 0, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-    0, 0, 0, 1, 0, 0, 1, 0, -1, 0, 0, -1,
-    0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
-    -1, 0, 0, -1, 0, 0, -1, 0, 1, 0, 1, 1,
-    -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
-    0, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0,
-    0, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0,
-    -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0,
-    -1, -1, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0,
-    -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0,
-    -1, 0, 1, -1, 0, 1, 0, 0, 0, -1, -1, 0,
-    -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0,
-    1, 0, 0, 1, 0, -2, -1, 0, -2, 0, 0, -1,
-    1, 2, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1,
-    -1, 0, -1, -1, -1, -1, -1, 0, -1, -1, 0, 0,
-    0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-    -1, -2, 1, 1, -1, 0, 0, 0, 0, 0, -2, -1,
-    1, -1, -1, 1, 0, -2, 1, 1, 0, 1, 2, 0,
-    -1, 1, 1, 0, 1, 0, -2, -1, 0, 0, -1, 1,
-    0, -1, 0, 1, 0, -1, -1, 0, 1, 0, -1, 0,
-    1, -1, 1, 2, 1, 1, 2, 0, 1, 2, 1, 0,
-    1, 1, 0, 2, 2, 1, 1, 3, 1, 0, 1, 2,
-    3, 4, 2, 1, 2, 3, 1, 2, 2, 3, 4, 4,
-    2, 1, 2, 3, 1, 0, 3, 3, 2, 1, 2, 2,
-    0, 0, 0, 0, 1, 1, 0, 1, 0, -1, 1, 1,
-    0, 2, 2, 0, 1, 1, 1, 1, 3, 4, 4, 2,
-    1, 2, 4, 1, -1, 0, -2, -3, 0, 0, -5, -2,
-    0, -3, 0, 4, 0, 0, 3, -1, -3, -1, -3, -1,
-    2, 0, -3, 0, 0, -2, -3, -3, -1, 3, 3, 3,
-    5, 4, 2, -1, -1, 0, -1, -1, 1, 0, 1, 6,
-    5, 3, 6, -2, -11, -2, 4, -4, -2, 4, -5, -3,
-    5, -5, -12, 0, 5, 2, 6, 0, -8, -6, -5, -12,
-    -10, -7, -12, -11, -6, -4, -3, -2, -4, -6, -9, -8,
-    -3, -5, -10, -7, -6, -12, -13, -10, -8, -7, -11, -16,
-    -14, -12, -10, -3, -6, -17, -14, -6, -14, -19, -11, -6,
-    -15, -22, -18, -12, -16, -18, -13, -18, -21, -13, -15, -24,
-    -19, -19, -32, -26, -18, -22, -12, -2, -26, -43, -31, -30,
-    -33, -19, -10, -15, -13, -9, -20, -41, -35, -2, -15, -49,
-    68, 304, 407, 352, 319, 324, 294, 250, 212, 177, 157, 136,
-    103, 80, 47, -3, -26, -41, -80, -106, -118, -144, -154, -153,
-    -187, -235, -269, -295, -306, -315, -340, -347, -339, -366, -390, -387,
-    -405, -426, -413, -409, -429, -433, -433, -437, -425, -415, -403, -373,
-    -359, -363, -347, -333, -341, -328, -300, -296, -290, -257, -224, -207,
-    -208, -201, -170, -156, -173, -173, -166, -182, -180, -162, -185, -208,
-    -195, -202, -226, -217, -200, -208, -208, -189, -171, -161, -161, -171,
-    -174, -168, -159, -151, -149, -143, -134, -134, -127, -91, -67, -76,
-    -78, -59, -48, -46, -45, -53, -66, -77, -86, -84, -73, -85,
-    -114, -128, -135, -143, -132, -115, -128, -156, -167, -166, -171, -184,
-    -195, -195, -181, -171, -169, -168, -161, -155, -148, -130, -103, -82,
-    -72, -62, -44, -24, -6, 8, 7, 0, 10, 31, 49, 72,
-    90, 81, 64, 63, 68, 72, 84, 96, 97, 98, 98, 89,
-    80, 72, 61, 48, 39, 38, 41, 40, 34, 29, 21, 0,
-    -22, -35, -40, -42, -59, -98, -133, -154, -173, -192, -208, -231,
-    -261, -282, -297, -311, -320, -327, -339, -352, -365, -377, -386, -390,
-    -398, -402, -393, -374, -349, -321, -290, -255, -226, -201, -171, -134,
-    -102, -79, -59, -40, -20, 1, 16, 26, 35, 38, 46, 72,
-    105, 123, 122, 111, 93, 82, 85, 90, 82, 61, 37, 17,
-    6, 2, -7, -30, -61, -86, -97, -104, -112, -126, -146, -165,
-    -173, -172, -171, -177, -187, -195, -193, -181, -162, -145, -136, -130,
-    -117, -94, -71, -56, -53, -58, -63, -55, -31, 0, 32, 63,
-    90, 113, 135, 153, 162, 164, 164, 163, 162, 160, 158, 160,
-    169, 183, 193, 191, 173, 142, 113, 95, 87, 80, 62, 31,
-    -6, -36, -53, -63, -76, -97, -120, -136, -139, -135, -135, -145,
-    -158, -158, -139, -106, -75, -59, -57, -55, -40, -15, 8, 15,
-    8, 3, 14, 42, 73, 86, 76, 55, 44, 56, 79, 95,
-    89, 68, 48, 46, 60, 74, 74, 61, 51, 58, 80, 99,
-    97, 76, 55, 59, 90, 127, 145, 134, 117, 122, 162, 221,
-    264, 275, 266, 270, 304, 356, 394, 399, 381, 370, 387, 422,
-    444, 434, 401, 378, 387, 417, 435, 413, 356, 290, 238, 199,
-    155, 96, 29, -27, -66, -102, -153, -217, -273, -300, -302, -307,
-    -335, -375, -381, -323, -213, -105, -48, -38, -18, 76, 258, 477,
-    668, 807, 932, 1108, 1365, 1666, 1938, 2127, 2238, 2321, 2423, 2539,
-    2625, 2632, 2547, 2406, 2261, 2147, 2061, 1968, 1835, 1647, 1417, 1167,
-    906, 622, 288, -124, -611, -1145, -1686, -2202, -2684, -3130, -3533, -3856,
-    -4059, -4122, -4057, -3905, -3697, -3440, -3128, -2764, -2391, -2062, -1804, -1597,
-    -1390, -1147, -878, -631, -438, -282, -96, 174, 529, 916, 1277, 1592,
-    1893, 2227, 2600, 2964, 3250, 3418, 3483, 3488, 3475, 3445, 3375, 3240,
-    3044, 2806, 2550, 2279, 1981, 1638, 1234, 763, 228, -353, -955, -1548,
-    -2101, -2595, -3027, -3394, -3679, -3846, -3867, -3739, -3486, -3147, -2756, -2330,
-    -1873, -1396, -931, -512, -161, 126, 356, 530, 622, 608, 482, 279,
-    52, -154, -319, -436, -491, -446, -264, 56, 461, 869, 1223, 1528,
-    1829, 2166, 2519, 2821, 3007, 3073, 3071, 3059, 3041, 2964, 2760, 2405,
-    1946, 1464, 1014, 572, 70, -537, -1220, -1908, -2534, -3084, -3575, -4015,
-    -4373, -4584, -4604, -4442, -4155, -3800, -3409, -2975, -2493, -1992, -1524, -1128,
-    -783, -425, 5, 518, 1066, 1583, 2032, 2422, 2776, 3094, 3340, 3471,
-    3468, 3351, 3163, 2936, 2664, 2327, 1915, 1451, 967, 480, -13, -515,
-    -1025, -1526, -1992, -2398, -2740, -3028, -3263, -3428, -3512, -3525, -3502, -3466,
-    -3417, -3337, -3209, -3031, -2818, -2584, -2329, -2037, -1703, -1353, -1020, -709,
-    -399, -49, 372, 865, 1381, 1858, 2279, 2670, 3054, 3414, 3707, 3894,
-    3957, 3928, 3856, 3764, 3621, 3378, 3022, 2574, 2084, 1595, 1114, 610,
-    67, -481, -973, -1360, -1616, -1754, -1804, -1772, -1630, -1354, -969, -535,
-    -116, 243, 528, 754, 926, 1010, 965, 779, 479, 108, -288, -667,
-    -1002, -1277, -1463, -1524, -1444, -1231, -913, -518, -67, 422, 929, 1423,
-    1882, 2293, 2646, 2926, 3115, 3193, 3148, 2989, 2737, 2409, 2011, 1554,
-    1055, 535, 16, -479, -937, -1353, -1717, -2003, -2195, -2296, -2317, -2270,
-    -2156, -1971, -1712, -1397, -1055, -711, -374, -45, 275, 577, 845, 1065,
-    1246, 1406, 1549, 1656, 1706, 1694, 1639, 1573, 1525, 1497, 1473, 1443,
-    1415, 1408, 1436, 1498, 1579, 1663, 1747, 1831, 1904, 1943, 1925, 1834,
-    1674, 1467, 1228, 951, 628, 276, -78, -412, -720, -1001, -1261, -1497,
-    -1695, -1829, -1895, -1918, -1928, -1940, -1955, -1967, -1965, -1942, -1900, -1835,
-    -1738, -1604, -1445, -1285, -1136, -987, -827, -656, -498, -378, -313, -306,
-    -333, -365, -394, -432, -480, -515, -499, -411, -252, -47, 180, 416,
-    667, 934, 1198, 1424, 1580, 1656, 1659, 1593, 1447, 1205, 874, 495,
-    137, -140, -323, -433, -495, -499, -416, -227, 47, 354, 635, 867,
-    1067, 1256, 1428, 1543, 1558, 1458, 1278, 1070, 855, 609, 297, -86,
-    -504, -903, -1242, -1516, -1749, -1950, -2099, -2159, -2118, -1997, -1833, -1658,
-    -1476, -1274, -1038, -776, -508, -256, -25, 199, 430, 672, 908, 1130,
-    1336, 1527, 1695, 1831, 1927, 1983, 2006, 1995, 1930, 1799, 1610, 1392,
-    1176, 975, 794, 621, 451, 290, 154, 56, -3, -30, -26, 15,
-    117, 289, 505, 716, 900, 1060, 1195, 1291, 1335, 1315, 1225, 1078,
-    907, 743, 592, 455, 340, 253, 194, 163, 154, 143, 104, 39,
-    -42, -130, -222, -309, -374, -394, -350, -238, -67, 145, 380, 620,
-    850, 1057, 1222, 1326, 1351, 1295, 1160, 956, 697, 396, 56, -329,
-    -754, -1206, -1667, -2124, -2557, -2948, -3278, -3530, -3676, -3687, -3549, -3272,
-    -2890, -2447, -1987, -1557, -1191, -915, -746, -687, -728, -851, -1032, -1237,
-    -1430, -1575, -1651, -1650, -1578, -1443, -1242, -963, -612, -208, 218, 634,
-    1020, 1377, 1723, 2053, 2328, 2512, 2587, 2562, 2457, 2286, 2048, 1714,
-    1262, 698, 60, -616, -1304, -1983, -2615, -3147, -3531, -3745, -3793, -3704,
-    -3511, -3243, -2906, -2514, -2098, -1694, -1309, -921, -502, -41, 439, 889,
-    1276, 1605, 1911, 2201, 2444, 2584, 2588, 2476, 2319, 2205, 2185, 2253,
-    2369, 2503, 2654, 2845, 3072, 3285, 3406, 3367, 3139, 2726, 2152, 1435,
-    591, -359, -1361, -2335, -3187, -3839, -4246, -4402, -4324, -4052, -3630, -3112,
-    -2547, -1988, -1473, -1020, -635, -315, -40, 230, 521, 830, 1129, 1391,
-    1594, 1732, 1830, 1924, 2041, 2188, 2370, 2585, 2833, 3122, 3454, 3802,
-    4117, 4348, 4450, 4386, 4145, 3750, 3234, 2626, 1944, 1190, 360, -537,
-    -1460, -2357, -3182, -3899, -4484, -4915, -5155, -5154, -4892, -4392, -3723, -2970,
-    -2213, -1490, -791, -104, 545, 1105, 1538, 1832, 2000, 2068, 2049, 1929,
-    1681, 1310, 868, 429, 67, -174, -294, -317, -249, -74, 220, 613,
-    1049, 1457, 1776, 1978, 2062, 2037, 1919, 1725, 1472, 1190, 921, 699,
-    523, 359, 168, -81, -403, -804, -1285, -1840, -2451, -3089, -3717, -4295,
-    -4791, -5183, -5448, -5552, -5461, -5161, -4669, -4024, -3282, -2509, -1754, -1039,
-    -379, 209, 729, 1199, 1645, 2084, 2531, 2972, 3367, 3662, 3815, 3788,
-    3559, 3134, 2547, 1835, 1038, 204, -617, -1397, -2118, -2771, -3353, -3873,
-    -4322, -4677, -4920, -5030, -4980, -4757, -4370, -3832, -3152, -2356, -1499, -637,
-    194, 966, 1645, 2204, 2621, 2857, 2867, 2629, 2154, 1474, 643, -262,
-    -1153, -1940, -2538, -2877, -2916, -2664, -2159, -1454, -613, 288, 1169, 1953,
-    2565, 2941, 3047, 2888, 2498, 1928, 1230, 467, -297, -1008, -1628, -2140,
-    -2536, -2834, -3061, -3237, -3356, -3400, -3351, -3194, -2920, -2542, -2099, -1642,
-    -1222, -879, -629, -451, -301, -134, 95, 408, 808, 1290, 1844, 2448,
-    3053, 3600, 4026, 4277, 4320, 4148, 3765, 3177, 2410, 1512, 560, -351,
-    -1127, -1701, -2044, -2165, -2094, -1879, -1576, -1244, -940, -699, -528, -407,
-    -302, -189, -46, 137, 361, 612, 854, 1033, 1114, 1085, 960, 774,
-    584, 435, 349, 337, 415, 596, 863, 1174, 1483, 1759, 1997, 2217,
-    2440, 2663, 2861, 3000, 3045, 2962, 2720, 2299, 1689, 914, 31, -863,
-    -1666, -2298, -2723, -2927, -2911, -2691, -2305, -1803, -1246, -697, -197, 252,
-    659, 1016, 1317, 1565, 1761, 1901, 1994, 2048, 2050, 1981, 1842, 1656,
-    1441, 1221, 1022, 867, 775, 760, 825, 961, 1152, 1380, 1628, 1894,
-    2197, 2539, 2902, 3270, 3629, 3947, 4176, 4270, 4190, 3908, 3411, 2721,
-    1874, 928, -43, -961, -1767, -2418, -2897, -3208, -3368, -3397, -3313, -3134,
-    -2876, -2553, -2185, -1781, -1333, -840, -321, 206, 726, 1221, 1671, 2063,
-    2377, 2578, 2641, 2568, 2367, 2043, 1619, 1129, 616, 130, -266, -513,
-    -580, -464, -178, 247, 767, 1329, 1871, 2327, 2650, 2814, 2810, 2648,
-    2343, 1897, 1319, 649, -62, -782, -1492, -2180, -2855, -3543, -4250, -4951,
-    -5603, -6153, -6530, -6664, -6516, -6083, -5397, -4524, -3547, -2537, -1543, -603,
-    253, 997, 1603, 2039, 2286, 2341, 2208, 1906, 1468, 936, 345, -274,
-    -895, -1491, -2034, -2492, -2838, -3058, -3155, -3137, -3018, -2828, -2611, -2430,
-    -2340, -2379, -2559, -2853, -3197, -3527, -3796, -3971, -4018, -3909, -3626, -3179,
-    -2613, -2001, -1429, -967, -671, -568, -654, -898, -1254, -1668, -2075, -2422,
-    -2685, -2861, -2953, -2963, -2887, -2715, -2442, -2078, -1639, -1141, -600, -29,
-    567, 1176, 1787, 2396, 3004, 3599, 4149, 4618, 4969, 5155, 5133, 4887,
-    4427, 3773, 2962, 2049, 1089, 116, -847, -1776, -2641, -3407, -4032, -4474,
-    -4707, -4727, -4540, -4158, -3598, -2904, -2138, -1361, -608, 113, 813, 1502,
-    2181, 2829, 3416, 3909, 4285, 4518, 4576, 4425, 4052, 3473, 2746, 1944,
-    1146, 424, -156, -531, -649, -487, -76, 503, 1144, 1743, 2204, 2450,
-    2436, 2154, 1635, 963, 268, -312, -688, -828, -750, -505, -156, 234,
-    601, 877, 1001, 957, 775, 508, 212, -76, -332, -550, -724, -851,
-    -934, -978, -988, -966, -898, -756, -516, -184, 212, 656, 1141, 1657,
-    2189, 2725, 3256, 3768, 4255, 4712, 5118, 5433, 5626, 5674, 5567, 5307,
-    4916, 4406, 3786, 3077, 2324, 1571, 844, 164, -446, -973, -1421, -1798,
-    -2119, -2406, -2683, -2950, -3190, -3385, -3523, -3593, -3584, -3494, -3322, -3067,
-    -2737, -2355, -1948, -1530, -1100, -661, -220, 210, 614, 981, 1313, 1608,
-    1848, 2006, 2064, 2017, 1880, 1687, 1475, 1275, 1105, 979, 909, 896,
-    940, 1033, 1163, 1304, 1432, 1523, 1564, 1547, 1473, 1346, 1174, 972,
-    764, 590, 496, 512, 643, 860, 1109, 1324, 1437, 1399, 1185, 789,
-    234, -436, -1164, -1884, -2532, -3051, -3396, -3523, -3411, -3078, -2576, -1972,
-    -1333, -720, -167, 322, 755, 1132, 1460, 1765, 2080, 2426, 2805, 3208,
-    3603, 3949, 4215, 4378, 4432, 4372, 4195, 3901, 3502, 3016, 2468, 1877,
-    1255, 602, -80, -786, -1515, -2262, -3013, -3734, -4382, -4900, -5238, -5359,
-    -5253, -4936, -4443, -3820, -3120, -2395, -1691, -1031, -416, 160, 688, 1156,
-    1566, 1925, 2228, 2458, 2594, 2610, 2476, 2160, 1652, 974, 179, -666,
-    -1491, -2224, -2803, -3182, -3334, -3245, -2925, -2421, -1804, -1141, -479, 154,
-    750, 1312, 1838, 2308, 2682, 2914, 2959, 2791, 2407, 1831, 1119, 350,
-    -396, -1064, -1631, -2106, -2520, -2911, -3309, -3721, -4127, -4488, -4755, -4876,
-    -4804, -4515, -4027, -3381, -2639, -1875, -1159, -533, -7, 423, 775, 1091,
-    1414, 1769, 2168, 2609, 3068, 3495, 3846, 4096, 4221, 4203, 4045, 3751,
-    3323, 2781, 2160, 1486, 762, -2, -795, -1613, -2453, -3283, -4059, -4733,
-    -5257, -5589, -5713, -5634, -5352, -4888, -4282, -3585, -2838, -2087, -1367, -690,
-    -52, 556, 1147, 1736, 2313, 2844, 3289, 3617, 3810, 3861, 3783, 3592,
-    3306, 2943, 2520, 2052, 1555, 1055, 572, 122, -286, -646, -959, -1233,
-    -1474, -1699, -1936, -2213, -2548, -2932, -3330, -3694, -3961, -4070, -3971, -3654,
-    -3138, -2469, -1718, -971, -304, 232, 608, 814, 856, 757, 541, 239,
-    -110, -469, -800, -1065, -1229, -1273, -1199, -1018, -745, -399, -9, 401,
-    806, 1189, 1538, 1842, 2103, 2342, 2581, 2833, 3108, 3421, 3769, 4125,
-    4457, 4731, 4913, 4977, 4922, 4747, 4440, 4000, 3451, 2825, 2145, 1438,
-    740, 84, -509, -1021, -1442, -1773, -2028, -2218, -2364, -2483, -2582, -2673,
-    -2774, -2899, -3040, -3182, -3312, -3404, -3419, -3329, -3128, -2826, -2438, -2000,
-    -1554, -1139, -772, -468, -236, -69, 58, 180, 331, 548, 849, 1232,
-    1678, 2153, 2623, 3051, 3409, 3679, 3851, 3922, 3900, 3793, 3603, 3337,
-    3000, 2596, 2129, 1613, 1065, 508, -34, -535, -976, -1342, -1629, -1851,
-    -2041, -2235, -2460, -2736, -3068, -3439, -3812, -4147, -4402, -4533, -4523, -4388,
-    -4166, -3889, -3581, -3259, -2931, -2602, -2281, -1973, -1672, -1372, -1073, -776,
-    -489, -213, 54, 320, 578, 818, 1031, 1217, 1383, 1541, 1707, 1883,
-    2070, 2275, 2505, 2755, 3015, 3278, 3526, 3733, 3876, 3943, 3921, 3804,
-    3597, 3311, 2954, 2538, 2076, 1571, 1021, 424, -222, -924, -1669, -2431,
-    -3184, -3904, -4553, -5074, -5417, -5541, -5429, -5094, -4587, -3964, -3272, -2557,
-    -1858, -1197, -579, 13, 595, 1180, 1763, 2323, 2827, 3242, 3544, 3728,
-    3789, 3728, 3554, 3289, 2958, 2580, 2164, 1710, 1212, 664, 76, -526,
-    -1097, -1584, -1934, -2100, -2038, -1728, -1196, -515, 210, 862, 1324, 1518,
-    1426, 1075, 518, -171, -901, -1583, -2156, -2593, -2912, -3165, -3411, -3697,
-    -4042, -4426, -4792, -5070, -5196, -5114, -4791, -4238, -3506, -2661, -1766, -879,
-    -44, 720, 1412, 2031, 2581, 3069, 3494, 3841, 4095, 4251, 4293, 4201,
-    3965, 3598, 3121, 2555, 1920, 1243, 546, -151, -822, -1434, -1975, -2444,
-    -2841, -3163, -3412, -3590, -3689, -3699, -3617, -3438, -3165, -2810, -2397, -1942,
-    -1459, -965, -472, 7, 459, 873, 1248, 1586, 1884, 2137, 2342, 2489,
-    2552, 2510, 2353, 2079, 1698, 1243, 773, 349, 38, -100, -28, 254,
-    713, 1299, 1948, 2603, 3220, 3779, 4267, 4690, 5054, 5355, 5582, 5717,
-    5735, 5601, 5289, 4793, 4126, 3312, 2398, 1436, 462, -509, -1464, -2376,
-    -3216, -3937, -4466, -4729, -4682, -4329, -3709, -2885, -1945, -991, -110, 631,
-    1192, 1567, 1779, 1862, 1840, 1743, 1605, 1454, 1307, 1178, 1070, 958,
-    791, 520, 117, -414, -1027, -1643, -2176, -2550, -2715, -2661, -2410, -1995,
-    -1455, -842, -211, 400, 971, 1500, 1998, 2474, 2925, 3336, 3684, 3947,
-    4105, 4150, 4085, 3914, 3648, 3307, 2911, 2471, 1993, 1476, 909, 287,
-    -381, -1091, -1847, -2644, -3446, -4199, -4846, -5323, -5582, -5606, -5406, -5000,
-    -4434, -3771, -3064, -2352, -1671, -1049, -489, 22, 489, 920, 1326, 1712,
-    2067, 2391, 2685, 2940, 3134, 3244, 3239, 3079, 2735, 2206, 1502, 647,
-    -304, -1272, -2172, -2937, -3508, -3845, -3934, -3782, -3412, -2868, -2204, -1480,
-    -753, -74, 527, 1053, 1520, 1943, 2330, 2688, 3010, 3279, 3467, 3542,
-    3464, 3193, 2704, 1999, 1100, 58, -1053, -2155, -3185, -4089, -4818, -5332,
-    -5606, -5631, -5423, -5018, -4467, -3818, -3127, -2443, -1796, -1193, -626, -74,
-    479, 1042, 1604, 2144, 2640, 3074, 3432, 3703, 3876, 3940, 3891, 3725,
-    3440, 3038, 2533, 1937, 1255, 503, -281, -1052, -1762, -2364, -2819, -3112,
-    -3238, -3195, -2990, -2665, -2283, -1913, -1617, -1445, -1410, -1478, -1585, -1660,
-    -1628, -1440, -1083, -587, -17, 541, 1005, 1312, 1429, 1367, 1171, 908,
-    639, 409, 257, 199, 203, 198, 102, -141, -540, -1060, -1632, -2162,
-    -2556, -2745, -2706, -2451, -2017, -1456, -814, -136, 544, 1201, 1828, 2429,
-    3004, 3542, 4030, 4445, 4755, 4913, 4870, 4596, 4091, 3379, 2493, 1476,
-    383, -740, -1856, -2916, -3854, -4607, -5124, -5366, -5317, -4985, -4408, -3641,
-    -2765, -1870, -1022, -259, 396, 937, 1372, 1719, 1995, 2215, 2395, 2545,
-    2670, 2765, 2805, 2748, 2567, 2243, 1760, 1123, 372, -426, -1184, -1804,
-    -2198, -2321, -2174, -1788, -1221, -567, 84, 681, 1209, 1684, 2134, 2600,
-    3100, 3628, 4162, 4676, 5135, 5490, 5693, 5707, 5509, 5096, 4482, 3707,
-    2822, 1871, 888, -94, -1050, -1967, -2834, -3622, -4292, -4802, -5114, -5200,
-    -5069, -4766, -4353, -3891, -3448, -3070, -2767, -2522, -2308, -2091, -1837, -1529,
-    -1171, -756, -269, 290, 906, 1558, 2222, 2862, 3446, 3955, 4367, 4646,
-    4757, 4684, 4423, 3983, 3379, 2633, 1763, 804, -192, -1150, -1989, -2625,
-    -2991, -3052, -2805, -2278, -1523, -617, 352, 1297, 2153, 2875, 3448, 3874,
-    4161, 4317, 4344, 4237, 3989, 3596, 3073, 2432, 1693, 876, 2, -911,
-    -1840, -2747, -3576, -4260, -4720, -4890, -4741, -4293, -3615, -2815, -2024, -1354,
-    -879, -612, -522, -541, -598, -627, -586, -454, -239, 16, 243, 358,
-    297, 28, -445, -1085, -1823, -2569, -3227, -3712, -3958, -3930, -3637, -3124,
-    -2452, -1688, -894, -114, 627, 1314, 1950, 2544, 3101, 3604, 4033, 4377,
-    4617, 4731, 4704, 4535, 4227, 3784, 3222, 2562, 1822, 1024, 184, -690,
-    -1586, -2463, -3278, -4002, -4604, -5034, -5261, -5291, -5142, -4840, -4425, -3940,
-    -3398, -2794, -2143, -1474, -797, -117, 551, 1201, 1838, 2457, 3033, 3546,
-    3983, 4323, 4536, 4608, 4532, 4306, 3931, 3420, 2786, 2056, 1269, 475,
-    -271, -897, -1330, -1520, -1447, -1114, -551, 181, 1000, 1818, 2530, 3045,
-    3314, 3334, 3134, 2766, 2310, 1842, 1420, 1080, 825, 624, 424, 168,
-    -191, -688, -1310, -2009, -2733, -3438, -4068, -4572, -4917, -5076, -5024, -4757,
-    -4301, -3702, -3011, -2287, -1580, -921, -330, 189, 653, 1094, 1537, 1989,
-    2447, 2900, 3329, 3717, 4046, 4308, 4496, 4611, 4654, 4623, 4528, 4378,
-    4166, 3875, 3490, 3006, 2428, 1770, 1060, 325, -407, -1114, -1782, -2399,
-    -2958, -3459, -3907, -4291, -4579, -4733, -4721, -4515, -4102, -3509, -2781, -1976,
-    -1156, -384, 298, 867, 1294, 1557, 1652, 1577, 1329, 925, 403, -194,
-    -825, -1445, -2011, -2498, -2878, -3108, -3156, -3004, -2641, -2067, -1320, -467,
-    418, 1259, 1975, 2493, 2761, 2747, 2442, 1871, 1099, 220, -650, -1395,
-    -1914, -2148, -2090, -1790, -1334, -807, -266, 245, 700, 1095, 1446, 1762,
-    2056, 2353, 2676, 3026, 3378, 3690, 3918, 4011, 3922, 3624, 3120, 2429,
-    1580, 617, -394, -1390, -2316, -3108, -3697, -4036, -4112, -3932, -3530, -2964,
-    -2307, -1626, -984, -438, -15, 279, 448, 501, 459, 352, 216, 90,
-    10, -7, 40, 146, 285, 405, 449, 376, 148, -254, -814, -1467,
-    -2124, -2688, -3074, -3222, -3113, -2772, -2250, -1618, -948, -293, 310, 843,
-    1312, 1723, 2083, 2390, 2642, 2824, 2918, 2905, 2774, 2519, 2144, 1667,
-    1115, 522, -75, -630, -1091, -1398, -1497, -1366, -1015, -492, 120, 698,
-    1113, 1260, 1092, 627, -62, -873, -1713, -2514, -3238, -3886, -4477, -5024,
-    -5517, -5932, -6221, -6341, -6256, -5954, -5449, -4779, -4005, -3186, -2359, -1553,
-    -793, -93, 548, 1138, 1679, 2170, 2608, 2970, 3223, 3344, 3319, 3141,
-    2805, 2317, 1699, 984, 213, -571, -1320, -1986, -2513, -2846, -2938, -2773,
-    -2372, -1789, -1084, -321, 441, 1159, 1816, 2411, 2943, 3412, 3827, 4171,
-    4395, 4443, 4278, 3884, 3269, 2472, 1566, 629, -258, -1008, -1554, -1879,
-    -2002, -1957, -1785, -1536, -1247, -948, -673, -456, -308, -219, -181, -174,
-    -175, -174, -179, -199, -247, -345, -515, -766, -1093, -1479, -1889, -2275,
-    -2584, -2773, -2811, -2687, -2409, -1995, -1468, -863, -214, 448, 1092, 1691,
-    2228, 2700, 3095, 3408, 3646, 3811, 3899, 3911, 3858, 3747, 3577, 3355,
-    3093, 2793, 2460, 2108, 1749, 1377, 987, 583, 160, -281, -721, -1128,
-    -1473, -1718, -1818, -1748, -1516, -1154, -713, -266, 111, 353, 416, 280,
-    -45, -523, -1113, -1765, -2428, -3072, -3681, -4235, -4702, -5056, -5270, -5316,
-    -5176, -4862, -4407, -3850, -3238, -2614, -2013, -1453, -944, -475, -22, 430,
-    883, 1333, 1772, 2181, 2542, 2845, 3096, 3297, 3452, 3565, 3646, 3703,
-    3749, 3807, 3891, 4008, 4142, 4269, 4363, 4403, 4374, 4264, 4060, 3748,
-    3327, 2813, 2233, 1619, 996, 389, -176, -671, -1069, -1346, -1489, -1503,
-    -1414, -1277, -1155, -1115, -1202, -1421, -1729, -2049, -2302, -2414, -2332, -2038,
-    -1570, -1008, -432, 92, 519, 821, 997, 1076, 1083, 1041, 970, 903,
-    859, 843, 847, 872, 924, 1003, 1110, 1237, 1362, 1449, 1463, 1369,
-    1135, 744, 206, -454, -1194, -1946, -2625, -3159, -3496, -3607, -3490, -3176,
-    -2720, -2181, -1617, -1079, -594, -162, 235, 623, 1027, 1465, 1937, 2430,
-    2919, 3363, 3718, 3950, 4036, 3964, 3733, 3357, 2861, 2279, 1663, 1062,
-    521, 75, -250, -439, -498, -452, -352, -262, -256, -392, -700, -1178,
-    -1790, -2476, -3150, -3727, -4152, -4408, -4496, -4444, -4306, -4156, -4043, -3986,
-    -3980, -3988, -3957, -3840, -3618, -3290, -2869, -2379, -1838, -1254, -647, -43,
-    548, 1129, 1691, 2214, 2687, 3098, 3414, 3606, 3659, 3565, 3310, 2900,
-    2356, 1698, 954, 179, -558, -1194, -1671, -1940, -1975, -1785, -1406, -893,
-    -320, 236, 715, 1083, 1334, 1489, 1581, 1634, 1659, 1645, 1567, 1395,
-    1119, 752, 329, -103, -486, -774, -926, -930, -807, -602, -370, -167,
-    -41, -18, -88, -227, -413, -625, -841, -1060, -1289, -1525, -1769, -2026,
-    -2305, -2606, -2931, -3268, -3588, -3850, -4018, -4062, -3951, -3672, -3240, -2688,
-    -2066, -1435, -846, -324, 126, 507, 830, 1108, 1357, 1596, 1844, 2107,
-    2370, 2615, 2826, 2991, 3106, 3176, 3202, 3184, 3141, 3091, 3046, 3008,
-    2984, 2971, 2954, 2932, 2908, 2876, 2824, 2755, 2675, 2581, 2467, 2327,
-    2143, 1885, 1527, 1063, 496, -161, -881, -1636, -2396, -3125, -3771, -4284,
-    -4625, -4765, -4694, -4430, -4013, -3495, -2935, -2379, -1856, -1378, -943, -537,
-    -139, 256, 637, 995, 1318, 1582, 1758, 1828, 1792, 1665, 1464, 1214,
-    930, 618, 273, -109, -526, -967, -1403, -1791, -2085, -2252, -2271, -2133,
-    -1848, -1448, -987, -524, -101, 252, 530, 740, 898, 1020, 1126, 1239,
-    1378, 1555, 1779, 2051, 2365, 2702, 3037, 3346, 3615, 3833, 3998, 4108,
-    4169, 4188, 4174, 4133, 4074, 4009, 3942, 3862, 3755, 3609, 3414, 3158,
-    2833, 2438, 1979, 1469, 931, 388, -145, -654, -1119, -1516, -1820, -2010,
-    -2062, -1972, -1751, -1428, -1047, -672, -364, -161, -78, -100, -174, -234,
-    -234, -162, -27, 142, 296, 384, 379, 265, 31, -313, -737, -1221,
-    -1749, -2305, -2873, -3442, -4007, -4548, -5027, -5402, -5633, -5684, -5540, -5216,
-    -4754, -4200, -3609, -3028, -2496, -2038, -1661, -1359, -1120, -919, -725, -513,
-    -268, 24, 373, 770, 1190, 1600, 1976, 2296, 2552, 2739, 2858, 2914,
-    2917, 2877, 2800, 2700, 2587, 2465, 2326, 2164, 1974, 1743, 1461, 1130,
-    756, 335, -129, -618, -1116, -1600, -2043, -2424, -2730, -2963, -3126, -3245,
-    -3356, -3493, -3662, -3843, -3992, -4043, -3943, -3667, -3224, -2651, -2002, -1346,
-    -740, -228, 166, 427, 559, 576, 501, 362, 190, 15, -148, -286,
-    -383, -423, -411, -365, -300, -225, -158, -121, -122, -151, -194, -233,
-    -240, -186, -47, 183, 499, 882, 1305, 1744, 2174, 2570, 2902, 3146,
-    3288, 3330, 3281, 3159, 2978, 2754, 2502, 2236, 1966, 1706, 1453, 1203,
-    951, 690, 421, 146, -134, -425, -731, -1048, -1369, -1687, -1993, -2279,
-    -2537, -2756, -2913, -2987, -2963, -2817, -2521, -2079, -1531, -919, -287, 318,
-    852, 1293, 1621, 1819, 1879, 1801, 1583, 1231, 779, 281, -219, -682,
-    -1070, -1351, -1519, -1574, -1516, -1350, -1089, -747, -345, 81, 492, 855,
-    1148, 1354, 1462, 1476, 1405, 1254, 1025, 732, 398, 55, -266, -526,
-    -697, -765, -730, -596, -383, -122, 163, 467, 785, 1105, 1419, 1730,
-    2046, 2362, 2674, 2976, 3255, 3496, 3686, 3815, 3875, 3873, 3827, 3757,
-    3663, 3526, 3326, 3055, 2707, 2271, 1746, 1155, 530, -92, -662, -1116,
-    -1405, -1512, -1438, -1205, -863, -475, -93, 241, 488, 624, 654, 591,
-    458, 293, 149, 71, 86, 202, 403, 650, 897, 1099, 1211, 1211,
-    1105, 912, 649, 342, 12, -335, -704, -1098, -1524, -2003, -2545, -3134,
-    -3749, -4375, -4985, -5524, -5935, -6182, -6240, -6092, -5748, -5245, -4636, -3977,
-    -3324, -2712, -2145, -1620, -1138, -693, -272, 141, 555, 968, 1367, 1729,
-    2032, 2272, 2451, 2569, 2628, 2630, 2569, 2440, 2249, 2007, 1712, 1363,
-    974, 565, 153, -235, -566, -812, -959, -999, -927, -754, -505, -214,
-    72, 298, 411, 374, 176, -165, -604, -1080, -1522, -1856, -2028, -2010,
-    -1801, -1428, -939, -389, 159, 645, 1021, 1266, 1375, 1356, 1223, 1007,
-    750, 488, 255, 79, -37, -100, -125, -138, -173, -253, -391, -596,
-    -874, -1210, -1595, -2029, -2515, -3041, -3590, -4136, -4641, -5049, -5321, -5418,
-    -5304, -4975, -4472, -3852, -3170, -2486, -1855, -1301, -820, -409, -50, 289,
-    631, 981, 1330, 1671, 1992, 2279, 2519, 2708, 2849, 2950, 3019, 3068,
-    3102, 3130, 3152, 3164, 3152, 3098, 2984, 2797, 2532, 2183, 1754, 1258,
-    722, 172, -356, -830, -1222, -1514, -1696, -1766, -1742, -1659, -1568, -1523,
-    -1557, -1660, -1794, -1900, -1914, -1781, -1482, -1041, -499, 88, 659, 1154,
-    1542, 1813, 1972, 2033, 2017, 1945, 1838, 1707, 1563, 1418, 1269, 1103,
-    900, 652, 348, -27, -479, -1000, -1581, -2201, -2816, -3372, -3833, -4161,
-    -4313, -4263, -4022, -3623, -3108, -2529, -1940, -1374, -856, -406, -31, 290,
-    584, 868, 1161, 1482, 1830, 2193, 2561, 2919, 3235, 3487, 3675, 3808,
-    3891, 3936, 3960, 3970, 3969, 3968, 3977, 3987, 3984, 3949, 3859, 3682,
-    3405, 3033, 2565, 2008, 1375, 698, 12, -641, -1205, -1626, -1863, -1894,
-    -1719, -1370, -901, -373, 155, 629, 1017, 1320, 1562, 1770, 1974, 2200,
-    2454, 2714, 2942, 3092, 3116, 2977, 2667, 2215, 1684, 1151, 696, 376,
-    221, 221, 333, 495, 652, 756, 776, 707, 560, 358, 123, -123,
-    -375, -640, -924, -1231, -1571, -1951, -2368, -2816, -3297, -3800, -4294, -4749,
-    -5138, -5432, -5604, -5632, -5495, -5178, -4696, -4093, -3424, -2738, -2080, -1477,
-    -928, -424, 41, 480, 902, 1295, 1642, 1937, 2174, 2335, 2416, 2432,
-    2406, 2353, 2297, 2256, 2225, 2197, 2169, 2132, 2063, 1944, 1765, 1517,
-    1194, 800, 342, -171, -714, -1255, -1762, -2202, -2526, -2692, -2679, -2485,
-    -2123, -1628, -1045, -412, 238, 871, 1460, 1992, 2459, 2855, 3174, 3413,
-    3570, 3647, 3652, 3598, 3499, 3363, 3180, 2934, 2621, 2240, 1784, 1247,
-    639, -19, -713, -1424, -2123, -2785, -3399, -3951, -4422, -4797, -5067, -5230,
-    -5281, -5219, -5059, -4819, -4510, -4149, -3764, -3381, -3015, -2671, -2344, -2022,
-    -1683, -1327, -958, -571, -160, 269, 704, 1134, 1546, 1925, 2271, 2591,
-    2885, 3137, 3335, 3459, 3481, 3376, 3126, 2719, 2150, 1448, 660, -162,
-    -963, -1677, -2244, -2614, -2759, -2674, -2385, -1942, -1413, -872, -387, -5,
-    260, 426, 529, 609, 692, 788, 902, 1039, 1202, 1403, 1646, 1923,
-    2230, 2568, 2930, 3303, 3673, 4026, 4335, 4560, 4664, 4614, 4392, 4007,
-    3482, 2850, 2156, 1456, 786, 167, -398, -913, -1401, -1883, -2372, -2879,
-    -3405, -3927, -4392, -4754, -4981, -5053, -4962, -4728, -4380, -3955, -3503, -3076,
-    -2693, -2339, -1998, -1660, -1313, -948, -575, -214, 115, 391, 588, 684,
-    681, 608, 506, 417, 369, 375, 431, 511, 576, 585, 489, 259,
-    -106, -574, -1098, -1612, -2040, -2323, -2425, -2339, -2079, -1693, -1240, -772,
-    -329, 55, 371, 627, 845, 1045, 1253, 1491, 1765, 2075, 2407, 2745,
-    3075, 3393, 3681, 3909, 4059, 4133, 4144, 4107, 4043, 3974, 3906, 3839,
-    3766, 3675, 3540, 3338, 3059, 2702, 2265, 1755, 1192, 599, 4, -557,
-    -1052, -1445, -1710, -1830, -1806, -1658, -1427, -1176, -976, -892, -970, -1222,
-    -1622, -2122, -2647, -3108, -3415, -3509, -3371, -3027, -2529, -1943, -1324, -716,
-    -149, 367, 836, 1264, 1642, 1959, 2195, 2318, 2296, 2120, 1804, 1364,
-    827, 221, -438, -1149, -1903, -2662, -3379, -4007, -4500, -4816, -4923, -4810,
-    -4482, -3966, -3317, -2600, -1874, -1188, -577, -53, 388, 767, 1109, 1445,
-    1791, 2143, 2489, 2814, 3102, 3333, 3497, 3590, 3617, 3590, 3524, 3426,
-    3294, 3119, 2884, 2566, 2144, 1615, 991, 290, -454, -1187, -1857, -2414,
-    -2806, -2986, -2933, -2664, -2219, -1653, -1029, -413, 148, 635, 1043, 1387,
-    1695, 1995, 2304, 2618, 2923, 3198, 3422, 3582, 3672, 3697, 3658, 3559,
-    3408, 3216, 3001, 2780, 2559, 2331, 2070, 1753, 1377, 944, 459, -70,
-    -638, -1247, -1905, -2610, -3343, -4066, -4727, -5267, -5643, -5829, -5818, -5619,
-    -5258, -4774, -4212, -3620, -3036, -2480, -1961, -1481, -1042, -654, -333, -95,
-    51, 98, 54, -56, -206, -369, -514, -599, -599, -522, -387, -212,
-    -25, 152, 313, 460, 580, 659, 682, 623, 455, 167, -224, -687,
-    -1170, -1611, -1955, -2170, -2232, -2126, -1863, -1474, -989, -451, 94, 622,
-    1132, 1619, 2074, 2506, 2918, 3300, 3643, 3944, 4187, 4344, 4398, 4350,
-    4191, 3915, 3531, 3059, 2514, 1922, 1315, 721, 163, -323, -689, -889,
-    -896, -706, -333, 190, 812, 1473, 2109, 2661, 3071, 3285, 3284, 3084,
-    2718, 2238, 1727, 1266, 904, 659, 532, 496, 494, 476, 414, 297,
-    124, -86, -305, -512, -700, -865, -1010, -1152, -1298, -1456, -1633, -1842,
-    -2097, -2409, -2780, -3194, -3617, -4018, -4370, -4661, -4887, -5040, -5101, -5050,
-    -4888, -4626, -4282, -3884, -3461, -3035, -2613, -2201, -1800, -1401, -990, -564,
-    -126, 325, 786, 1252, 1711, 2148, 2544, 2884, 3165, 3385, 3541, 3635,
-    3686, 3713, 3719, 3691, 3612, 3458, 3204, 2836, 2359, 1783, 1118, 395,
-    -340, -1032, -1628, -2086, -2376, -2493, -2442, -2241, -1926, -1544, -1128, -704,
-    -290, 111, 503, 881, 1231, 1541, 1819, 2069, 2294, 2494, 2663, 2789,
-    2866, 2899, 2890, 2839, 2744, 2616, 2471, 2337, 2241, 2209, 2247, 2349,
-    2495, 2654, 2795, 2883, 2880, 2758, 2500, 2100, 1567, 932, 231, -515,
-    -1286, -2049, -2770, -3423, -3981, -4410, -4691, -4825, -4825, -4719, -4554, -4375,
-    -4203, -4045, -3918, -3828, -3763, -3711, -3667, -3619, -3549, -3448, -3316, -3149,
-    -2944, -2706, -2433, -2121, -1770, -1386, -974, -541, -102, 323, 716, 1064,
-    1357, 1586, 1754, 1868, 1942, 1985, 1984, 1908, 1723, 1406, 946, 346,
-    -365, -1136, -1894, -2553, -3032, -3272, -3251, -2982, -2515, -1933, -1331, -789,
-    -357, -45, 168, 322, 465, 645, 901, 1242, 1647, 2080, 2498, 2861,
-    3136, 3311, 3390, 3392, 3340, 3261, 3169, 3078, 2992, 2907, 2807, 2668,
-    2477, 2224, 1901, 1505, 1036, 492, -114, -760, -1409, -2019, -2532, -2885,
-    -3042, -3009, -2820, -2529, -2199, -1890, -1632, -1428, -1263, -1107, -928, -715,
-    -478, -235, 5, 213, 349, 381, 297, 107, -139, -365, -503, -511,
-    -379, -139, 137, 365, 476, 428, 196, -205, -734, -1344, -2000, -2671,
-    -3330, -3953, -4518, -4992, -5337, -5523, -5528, -5353, -5016, -4551, -3997, -3402,
-    -2824, -2307, -1871, -1511, -1202, -908, -595, -247, 127, 500, 845, 1148,
-    1405, 1623, 1816, 1995, 2157, 2280, 2345, 2340, 2248, 2053, 1753, 1357,
-    889, 402, -45, -403, -650, -779, -798, -730, -605, -445, -270, -96,
-    78, 258, 445, 631, 820, 1010, 1192, 1378, 1586, 1824, 2086, 2371,
-    2678, 2996, 3314, 3641, 3963, 4243, 4454, 4593, 4660, 4656, 4597, 4489,
-    4311, 4037, 3659, 3184, 2621, 1987, 1312, 620, -56, -666, -1157, -1489,
-    -1624, -1546, -1266, -832, -305, 232, 695, 1023, 1200, 1246, 1203, 1124,
-    1054, 1003, 955, 890, 774, 566, 238, -206, -738, -1307, -1847, -2302,
-    -2644, -2861, -2957, -2955, -2876, -2722, -2483, -2155, -1741, -1246, -688, -108,
-    448, 936, 1318, 1562, 1660, 1608, 1411, 1086, 677, 225, -253, -753,
-    -1277, -1835, -2439, -3082, -3737, -4372, -4947, -5407, -5693, -5767, -5621, -5261,
-    -4714, -4030, -3275, -2515, -1805, -1189, -684, -285, 20, 249, 428, 576,
-    708, 832, 952, 1059, 1135, 1159, 1105, 944, 668, 299, -123, -547,
-    -904, -1115, -1127, -922, -512, 58, 724, 1415, 2068, 2627, 3054, 3333,
-    3470, 3476, 3381, 3224, 3042, 2857, 2690, 2559, 2467, 2408, 2366, 2323,
-    2255, 2144, 1978, 1747, 1450, 1109, 752, 388, 19, -346, -694, -1022,
-    -1321, -1565, -1733, -1812, -1789, -1644, -1370, -974, -469, 123, 768, 1427,
-    2056, 2618, 3073, 3387, 3538, 3510, 3296, 2909, 2363, 1688, 924, 124,
-    -669, -1420, -2083, -2614, -2984, -3181, -3199, -3053, -2786, -2447, -2078, -1721,
-    -1417, -1182, -1004, -857, -697, -474, -163, 214, 600, 917, 1083, 1027,
-    711, 147, -618, -1502, -2409, -3255, -3982, -4554, -4965, -5232, -5367, -5364,
-    -5219, -4943, -4559, -4095, -3591, -3079, -2586, -2128, -1715, -1338, -971, -584,
-    -158, 314, 831, 1381, 1937, 2463, 2914, 3244, 3413, 3392, 3170, 2752,
-    2160, 1433, 625, -189, -925, -1505, -1857, -1945, -1777, -1400, -876, -278,
-    327, 888, 1388, 1822, 2193, 2518, 2820, 3111, 3401, 3702, 4013, 4308,
-    4544, 4683, 4702, 4585, 4333, 3965, 3505, 2974, 2394, 1778, 1129, 441,
-    -275, -991, -1669, -2258, -2699, -2938, -2943, -2705, -2250, -1633, -928, -209,
-    464, 1049, 1533, 1938, 2303, 2650, 2978, 3261, 3453, 3494, 3330, 2948,
-    2374, 1676, 945, 270, -275, -650, -851, -915, -904, -886, -933, -1103,
-    -1411, -1831, -2330, -2883, -3466, -4049, -4612, -5125, -5548, -5840, -5990, -5998,
-    -5859, -5589, -5228, -4826, -4422, -4046, -3713, -3403, -3079, -2718, -2318, -1881,
-    -1406, -899, -372, 160, 678, 1158, 1575, 1899, 2093, 2124, 1974, 1643,
-    1144, 511, -204, -941, -1649, -2287, -2805, -3147, -3259, -3117, -2725, -2111,
-    -1339, -488, 363, 1160, 1863, 2445, 2898, 3220, 3403, 3428, 3284, 2977,
-    2527, 1973, 1376, 818, 384, 141, 128, 354, 803, 1426, 2148, 2894,
-    3602, 4231, 4754, 5163, 5446, 5595, 5605, 5482, 5223, 4823, 4283, 3616,
-    2838, 1976, 1077, 216, -527, -1071, -1353, -1342, -1042, -491, 255, 1120,
-    2019, 2873, 3623, 4233, 4690, 4992, 5145, 5165, 5061, 4845, 4534, 4143,
-    3670, 3111, 2467, 1747, 964, 145, -671, -1445, -2147, -2730, -3128, -3283,
-    -3160, -2754, -2090, -1243, -308, 625, 1486, 2222, 2796, 3188, 3381, 3360,
-    3121, 2676, 2053, 1300, 484, -334, -1097, -1742, -2189, -2363, -2206, -1707,
-    -919, 17, 915, 1591, 1902, 1779, 1238, 379, -661, -1747, -2770, -3664,
-    -4412, -5031, -5554, -5996, -6347, -6569, -6626, -6490, -6151, -5623, -4942, -4163,
-    -3337, -2520, -1764, -1116, -603, -241, -48, -37, -220, -594, -1153, -1875,
-    -2710, -3586, -4419, -5118, -5597, -5791, -5678, -5276, -4640, -3838, -2946, -2031,
-    -1150, -343, 377, 1013, 1576, 2077, 2523, 2915, 3243, 3494, 3654, 3715,
-    3670, 3507, 3217, 2792, 2228, 1536, 756, -52, -821, -1477, -1953, -2198,
-    -2170, -1855, -1270, -481, 420, 1338, 2190, 2912, 3460, 3806, 3928, 3804,
-    3420, 2791, 1968, 1039, 118, -669, -1212, -1444, -1359, -998, -433, 258,
-    998, 1724, 2388, 2961, 3433, 3813, 4110, 4320, 4441, 4489, 4475, 4397,
-    4250, 4043, 3778, 3454, 3081, 2676, 2245, 1792, 1320, 824, 286, -307,
-    -949, -1629, -2337, -3049, -3728, -4336, -4832, -5172, -5331, -5311, -5125, -4795,
-    -4356, -3841, -3274, -2679, -2085, -1509, -953, -422, 70, 521, 932, 1287,
-    1561, 1730, 1783, 1713, 1537, 1292, 1007, 698, 370, 11, -402, -891,
-    -1456, -2087, -2760, -3430, -4035, -4516, -4826, -4925, -4804, -4482, -4001, -3416,
-    -2793, -2185, -1628, -1142, -738, -414, -151, 72, 280, 496, 730, 976,
-    1221, 1443, 1614, 1711, 1734, 1697, 1613, 1490, 1333, 1136, 891, 595,
-    264, -81, -407, -665, -799, -773, -577, -222, 255, 809, 1396, 1975,
-    2515, 2995, 3400, 3715, 3937, 4076, 4150, 4167, 4132, 4048, 3921, 3752,
-    3548, 3309, 3026, 2681, 2259, 1759, 1197, 613, 63, -404, -745, -931,
-    -950, -818, -565, -233, 136, 505, 846, 1136, 1353, 1483, 1526, 1486,
-    1381, 1247, 1122, 1036, 1009, 1059, 1194, 1398, 1640, 1875, 2065, 2182,
-    2209, 2133, 1941, 1630, 1206, 687, 103, -510, -1121, -1710, -2253, -2727,
-    -3098, -3324, -3373, -3240, -2951, -2541, -2052, -1539, -1048, -601, -198, 175,
-    538, 913, 1301, 1675, 1993, 2208, 2278, 2192, 1967, 1628, 1196, 702,
-    186, -327, -837, -1352, -1891, -2467, -3091, -3750, -4416, -5048, -5599, -6024,
-    -6298, -6411, -6375, -6224, -6004, -5753, -5478, -5175, -4830, -4428, -3953, -3405,
-    -2804, -2191, -1617, -1124, -741, -492, -385, -412, -549, -770, -1045, -1340,
-    -1637, -1943, -2276, -2647, -3070, -3546, -4045, -4503, -4849, -5018, -4957, -4646,
-    -4114, -3423, -2641, -1834, -1063, -369, 239, 754, 1178, 1529, 1847, 2164,
-    2487, 2802, 3085, 3315, 3480, 3579, 3625, 3644, 3661, 3685, 3717, 3747,
-    3757, 3709, 3571, 3328, 2981, 2533, 1996, 1381, 706, 0, -697, -1334,
-    -1861, -2234, -2413, -2387, -2170, -1793, -1312, -795, -307, 117, 464, 744,
-    990, 1244, 1536, 1880, 2284, 2735, 3204, 3654, 4051, 4359, 4557, 4654,
-    4677, 4649, 4585, 4491, 4365, 4191, 3961, 3665, 3288, 2817, 2252, 1606,
-    889, 124, -662, -1445, -2203, -2907, -3521, -4009, -4329, -4453, -4377, -4123,
-    -3718, -3192, -2578, -1913, -1226, -546, 93, 662, 1150, 1545, 1834, 2009,
-    2073, 2038, 1925, 1765, 1587, 1402, 1214, 1026, 837, 639, 424, 187,
-    -76, -380, -736, -1144, -1589, -2053, -2520, -2970, -3388, -3763, -4080, -4314,
-    -4445, -4459, -4356, -4141, -3830, -3448, -3031, -2623, -2263, -1969, -1732, -1532,
-    -1340, -1128, -874, -567, -208, 195, 622, 1050, 1457, 1822, 2121, 2339,
-    2476, 2533, 2518, 2439, 2308, 2135, 1928, 1692, 1422, 1108, 748, 369,
-    14, -272, -442, -470, -351, -110, 221, 605, 1004, 1381, 1721, 2021,
-    2284, 2514, 2717, 2911, 3100, 3277, 3440, 3602, 3764, 3916, 4057, 4189,
-    4306, 4395, 4449, 4463, 4416, 4294, 4104, 3856, 3557, 3214, 2839, 2431,
-    1978, 1479, 942, 370, -238, -861, -1464, -1997, -2417, -2688, -2795, -2739,
-    -2534, -2205, -1792, -1336, -862, -390, 63, 479, 854, 1191, 1496, 1768,
-    2001, 2185, 2307, 2352, 2310, 2188, 1992, 1730, 1422, 1098, 783, 480,
-    190, -82, -335, -570, -784, -974, -1141, -1302, -1478, -1682, -1921, -2200,
-    -2527, -2895, -3288, -3673, -4004, -4218, -4255, -4078, -3686, -3099, -2365, -1548,
-    -712, 88, 800, 1374, 1778, 1995, 2004, 1793, 1369, 766, 31, -778,
-    -1594, -2357, -3034, -3607, -4054, -4354, -4485, -4434, -4197, -3799, -3301, -2789,
-    -2355, -2076, -2003, -2152, -2508, -3026, -3642, -4284, -4874, -5335, -5615, -5696,
-    -5589, -5322, -4935, -4476, -3986, -3497, -3030, -2596, -2187, -1796, -1414, -1037,
-    -661, -293, 53, 355, 590, 746, 823, 836, 807, 773, 766, 799,
-    862, 933, 975, 940, 791, 519, 142, -302, -751, -1129, -1368, -1422,
-    -1272, -946, -510, -36, 417, 807, 1108, 1324, 1487, 1637, 1808, 2034,
-    2328, 2679, 3061, 3448, 3811, 4119, 4351, 4498, 4562, 4554, 4493, 4395,
-    4271, 4123, 3942, 3708, 3401, 3018, 2573, 2095, 1621, 1189, 842, 615,
-    534, 605, 815, 1137, 1532, 1954, 2357, 2700, 2955, 3112, 3174, 3152,
-    3055, 2892, 2678, 2434, 2190, 1969, 1781, 1620, 1470, 1306, 1118, 914,
-    708, 514, 344, 215, 135, 102, 115, 170, 257, 357, 461, 559,
-    639, 702, 761, 826, 900, 989, 1095, 1206, 1293, 1330, 1292, 1160,
-    927, 619, 270, -77, -379, -600, -720, -739, -680, -589, -521, -522,
-    -637, -890, -1280, -1776, -2343, -2948, -3557, -4140, -4667, -5111, -5444, -5639,
-    -5671, -5532, -5244, -4845, -4369, -3850, -3328, -2840, -2406, -2027, -1693, -1380,
-    -1060, -712, -328, 95, 543, 989, 1407, 1771, 2060, 2266, 2397, 2460,
-    2455, 2395, 2291, 2142, 1942, 1690, 1373, 974, 490, -74, -707, -1390,
-    -2069, -2677, -3161, -3475, -3570, -3435, -3099, -2613, -2035, -1430, -858, -354,
-    60, 379, 620, 823, 1026, 1258, 1539, 1872, 2243, 2640, 3057, 3476,
-    3866, 4197, 4448, 4609, 4683, 4683, 4620, 4503, 4330, 4092, 3773, 3363,
-    2859, 2272, 1639, 1026, 502, 119, -79, -56, 192, 629, 1191, 1804,
-    2396, 2907, 3290, 3525, 3609, 3548, 3338, 2969, 2437, 1755, 956, 98,
-    -735, -1456, -1988, -2274, -2288, -2041, -1585, -994, -343, 305, 899, 1410,
-    1835, 2198, 2522, 2814, 3065, 3254, 3342, 3289, 3080, 2726, 2242, 1651,
-    985, 271, -476, -1238, -1984, -2688, -3319, -3820, -4121, -4175, -3962, -3493,
-    -2824, -2052, -1274, -565, 27, 485, 824, 1062, 1213, 1284, 1287, 1223,
-    1101, 939, 762, 587, 433, 306, 191, 63, -94, -294, -559, -899,
-    -1306, -1774, -2290, -2827, -3340, -3794, -4180, -4510, -4810, -5106, -5402, -5679,
-    -5900, -6019, -5977, -5738, -5289, -4643, -3841, -2947, -2054, -1258, -647, -279,
-    -165, -280, -563, -936, -1312, -1621, -1808, -1832, -1682, -1384, -1003, -617,
-    -296, -98, -55, -171, -429, -803, -1272, -1815, -2401, -2997, -3569, -4083,
-    -4494, -4766, -4876, -4819, -4600, -4235, -3756, -3212, -2647, -2096, -1587, -1131,
-    -730, -374, -48, 274, 611, 970, 1346, 1721, 2075, 2382, 2614, 2754,
-    2796, 2738, 2577, 2312, 1957, 1535, 1078, 629, 245, -27, -155, -118,
-    95, 467, 941, 1449, 1928, 2341, 2674, 2934, 3147, 3332, 3509, 3697,
-    3914, 4167, 4449, 4740, 5015, 5238, 5391, 5474, 5507, 5503, 5468, 5410,
-    5337, 5258, 5180, 5104, 5013, 4866, 4621, 4244, 3723, 3064, 2291, 1446,
-    593, -187, -808, -1189, -1282, -1093, -676, -120, 488, 1076, 1589, 1997,
-    2296, 2504, 2638, 2715, 2747, 2738, 2684, 2577, 2421, 2236, 2047, 1879,
-    1759, 1713, 1750, 1853, 1983, 2084, 2092, 1965, 1685, 1256, 693, 26,
-    -718, -1512, -2326, -3111, -3809, -4372, -4757, -4915, -4813, -4456, -3878, -3130,
-    -2277, -1404, -581, 146, 748, 1210, 1531, 1723, 1793, 1745, 1591, 1353,
-    1066, 764, 478, 227, 9, -198, -428, -703, -1028, -1399, -1815, -2272,
-    -2751, -3228, -3685, -4103, -4463, -4758, -4991, -5162, -5268, -5303, -5267, -5148,
-    -4932, -4607, -4171, -3626, -2991, -2311, -1640, -1027, -513, -139, 73, 123,
-    17, -226, -569, -966, -1389, -1832, -2294, -2782, -3295, -3816, -4308, -4731,
-    -5049, -5239, -5280, -5154, -4858, -4410, -3860, -3268, -2688, -2153, -1685, -1286,
-    -940, -625, -319, -3, 330, 661, 955, 1163, 1232, 1123, 828, 370,
-    -212, -855, -1473, -1974, -2283, -2354, -2184, -1812, -1290, -665, 14, 694,
-    1341, 1934, 2453, 2885, 3236, 3515, 3717, 3847, 3928, 3977, 3995, 3984,
-    3945, 3861, 3709, 3479, 3176, 2794, 2324, 1771, 1157, 517, -86, -577,
-    -894, -1006, -922, -675, -322, 79, 475, 821, 1095, 1301, 1463, 1601,
-    1734, 1892, 2095, 2346, 2638, 2959, 3282, 3562, 3771, 3905, 3963, 3942,
-    3857, 3734, 3592, 3434, 3264, 3073, 2834, 2514, 2099, 1583, 959, 236,
-    -555, -1373, -2166, -2861, -3372, -3633, -3612, -3322, -2814, -2165, -1456, -761,
-    -133, 405, 860, 1251, 1594, 1893, 2121, 2239, 2217, 2045, 1732, 1291,
-    751, 145, -500, -1171, -1850, -2509, -3103, -3575, -3858, -3885, -3609, -3023,
-    -2176, -1174, -160, 708, 1295, 1510, 1327, 786, -17, -953, -1895, -2736,
-    -3387, -3784, -3890, -3702, -3251, -2611, -1896, -1231, -728, -480, -538, -893,
-    -1479, -2203, -2975, -3712, -4354, -4868, -5238, -5452, -5499, -5387, -5137, -4778,
-    -4348, -3886, -3418, -2951, -2481, -2001, -1505, -989, -456, 78, 587, 1041,
-    1410, 1674, 1817, 1834, 1724, 1501, 1191, 822, 408, -49, -546, -1085,
-    -1670, -2289, -2899, -3445, -3868, -4108, -4121, -3890, -3441, -2830, -2139, -1452,
-    -826, -287, 168, 551, 885, 1190, 1477, 1742, 1965, 2119, 2191, 2187,
-    2129, 2043, 1956, 1889, 1850, 1837, 1842, 1851, 1849, 1823, 1776, 1720,
-    1673, 1647, 1640, 1629, 1572, 1435, 1209, 924, 628, 387, 266, 315,
-    541, 919, 1393, 1896, 2360, 2753, 3081, 3368, 3627, 3874, 4126, 4389,
-    4653, 4900, 5103, 5224, 5240, 5146, 4950, 4657, 4279, 3822, 3282, 2649,
-    1942, 1199, 472, -178, -684, -983, -1038, -849, -461, 49, 596, 1107,
-    1529, 1849, 2087, 2277, 2447, 2623, 2812, 3003, 3166, 3278, 3336, 3339,
-    3288, 3186, 3039, 2844, 2587, 2258, 1854, 1369, 792, 118, -644, -1461,
-    -2289, -3065, -3715, -4163, -4356, -4268, -3910, -3333, -2632, -1910, -1245, -673,
-    -188, 235, 625, 992, 1328, 1605, 1783, 1831, 1736, 1505, 1160, 736,
-    276, -192, -661, -1143, -1655, -2211, -2809, -3434, -4050, -4609, -5049, -5305,
-    -5326, -5087, -4596, -3891, -3026, -2073, -1109, -210, 561, 1152, 1521, 1645,
-    1516, 1148, 571, -155, -949, -1719, -2384, -2887, -3224, -3446, -3619, -3811,
-    -4066, -4409, -4833, -5302, -5762, -6144, -6381, -6430, -6279, -5948, -5475, -4901,
-    -4263, -3588, -2901, -2220, -1554, -911, -303, 256, 747, 1132, 1368, 1434,
-    1332, 1082, 718, 285, -184, -682, -1205, -1744, -2288, -2814, -3289, -3661,
-    -3877, -3900, -3710, -3319, -2767, -2113, -1424, -761, -166, 340, 760, 1115,
-    1437, 1745, 2026, 2246, 2361, 2331, 2125, 1746, 1224, 619, 4, -531,
-    -909, -1075, -1016, -749, -317, 230, 847, 1495, 2134, 2722, 3230, 3642,
-    3950, 4144, 4225, 4196, 4071, 3890, 3699, 3526, 3361, 3183, 2972, 2713,
-    2403, 2066, 1751, 1510, 1390, 1428, 1640, 2003, 2456, 2923, 3328, 3603,
-    3708, 3639, 3425, 3126, 2822, 2595, 2517, 2629, 2924, 3348, 3826, 4293,
-    4687, 4955, 5072, 5045, 4902, 4679, 4422, 4163, 3904, 3629, 3324, 2977,
-    2573, 2111, 1606, 1077, 553, 87, -266, -466, -496, -356, -69, 326,
-    789, 1279, 1749, 2162, 2498, 2751, 2914, 2987, 2975, 2883, 2720, 2506,
-    2269, 2025, 1790, 1565, 1341, 1098, 820, 495, 110, -354, -903, -1528,
-    -2205, -2887, -3510, -4006, -4303, -4345, -4105, -3599, -2870, -1993, -1068, -198,
-    532, 1066, 1373, 1454, 1340, 1070, 684, 223, -278, -795, -1319, -1844,
-    -2369, -2899, -3425, -3918, -4341, -4663, -4849, -4872, -4732, -4454, -4081, -3664,
-    -3262, -2916, -2620, -2337, -2012, -1605, -1104, -542, 5, 449, 711, 728,
-    462, -85, -874, -1825, -2820, -3711, -4357, -4647, -4530, -4015, -3176, -2137,
-    -1043, -32, 795, 1391, 1743, 1862, 1757, 1443, 933, 261, -522, -1347,
-    -2147, -2876, -3513, -4066, -4549, -4962, -5285, -5480, -5512, -5365, -5040, -4550,
-    -3923, -3209, -2464, -1725, -1026, -393, 160, 628, 1000, 1261, 1405, 1429,
-    1328, 1109, 801, 423, -13, -492, -987, -1489, -1996, -2489, -2938, -3322,
-    -3612, -3764, -3742, -3541, -3173, -2670, -2087, -1494, -952, -506, -187, 14,
-    138, 237, 361, 546, 808, 1131, 1489, 1856, 2207, 2521, 2785, 2988,
-    3114, 3157, 3122, 3030, 2895, 2722, 2503, 2214, 1836, 1372, 856, 339,
-    -117, -459, -645, -650, -474, -151, 268, 732, 1180, 1553, 1814, 1961,
-    2019, 2020, 2014, 2050, 2157, 2337, 2585, 2882, 3193, 3482, 3732, 3936,
-    4094, 4205, 4267, 4288, 4283, 4267, 4233, 4174, 4082, 3946, 3748, 3488,
-    3182, 2851, 2516, 2212, 1979, 1836, 1788, 1837, 1979, 2189, 2439, 2713,
-    2990, 3238, 3429, 3559, 3631, 3647, 3617, 3556, 3470, 3358, 3233, 3118,
-    3028, 2959, 2902, 2838, 2741, 2588, 2362, 2049, 1640, 1137, 559, -68,
-    -712, -1325, -1857, -2255, -2474, -2469, -2222, -1758, -1138, -436, 265, 888,
-    1369, 1678, 1804, 1756, 1564, 1281, 965, 660, 382, 138, -80, -291,
-    -517, -777, -1094, -1486, -1959, -2499, -3085, -3688, -4269, -4776, -5152, -5344,
-    -5312, -5050, -4587, -3975, -3272, -2540, -1835, -1193, -644, -210, 99, 281,
-    336, 263, 80, -193, -539, -939, -1370, -1822, -2308, -2835, -3380, -3912,
-    -4412, -4855, -5213, -5459, -5566, -5499, -5230, -4771, -4171, -3496, -2820, -2212,
-    -1719, -1360, -1144, -1060, -1078, -1153, -1240, -1298, -1289, -1201, -1040, -813,
-    -540, -250, 11, 204, 304, 300, 193, -7, -287, -627, -999, -1364,
-    -1681, -1907, -2002, -1946, -1740, -1404, -972, -491, -4, 444, 815, 1080,
-    1219, 1208, 1027, 671, 150, -509, -1258, -2024, -2737, -3347, -3820, -4133,
-    -4281, -4283, -4161, -3936, -3639, -3301, -2944, -2582, -2233, -1917, -1651, -1447,
-    -1307, -1217, -1141, -1041, -892, -677, -395, -62, 289, 620, 899, 1087,
-    1155, 1079, 861, 530, 122, -313, -715, -1018, -1166, -1131, -913, -533,
-    -34, 526, 1087, 1590, 1983, 2230, 2314, 2243, 2040, 1731, 1338, 882,
-    389, -112, -595, -1019, -1333, -1496, -1492, -1324, -1019, -633, -241, 82,
-    277, 316, 219, 45, -129, -233, -216, -52, 249, 650, 1101, 1555,
-    1975, 2344, 2660, 2929, 3162, 3367, 3538, 3656, 3705, 3666, 3524, 3274,
-    2925, 2488, 1980, 1433, 902, 451, 144, 27, 117, 397, 824, 1345,
-    1894, 2400, 2798, 3036, 3079, 2926, 2618, 2217, 1802, 1463, 1280, 1293,
-    1495, 1847, 2292, 2764, 3206, 3584, 3888, 4132, 4336, 4515, 4679, 4832,
-    4954, 5010, 4963, 4796, 4502, 4095, 3603, 3053, 2453, 1814, 1178, 604,
-    151, -141, -244, -156, 101, 493, 973, 1478, 1946, 2338, 2642, 2858,
-    2995, 3067, 3086, 3055, 2975, 2850, 2691, 2502, 2270, 1975, 1611, 1186,
-    715, 199, -364, -982, -1656, -2365, -3049, -3626, -4021, -4179, -4071, -3713,
-    -3170, -2543, -1928, -1393, -965, -638, -375, -140, 89, 314, 522, 693,
-    797, 810, 731, 574, 357, 118, -109, -305, -471, -614, -748, -905,
-    -1121, -1409, -1767, -2189, -2663, -3171, -3709, -4279, -4879, -5494, -6101, -6650,
-    -7072, -7308, -7325, -7110, -6672, -6045, -5288, -4461, -3616, -2795, -2024, -1304,
-    -638, -38, 482, 908, 1213, 1363, 1333, 1116, 723, 193, -425, -1093,
-    -1782, -2473, -3158, -3841, -4512, -5147, -5703, -6123, -6345, -6325, -6056, -5555,
-    -4861, -4046, -3192, -2360, -1583, -879, -245, 346, 913, 1451, 1944, 2368,
-    2686, 2858, 2872, 2750, 2529, 2251, 1955, 1677, 1426, 1197, 967, 706,
-    388, 5, -435, -919, -1424, -1920, -2375, -2766, -3080, -3314, -3478, -3582,
-    -3638, -3655, -3631, -3551, -3402, -3172, -2842, -2383, -1785, -1073, -291, 515,
-    1290, 1969, 2496, 2829, 2938, 2810, 2456, 1918, 1262, 560, -119, -712,
-    -1169, -1463, -1578, -1508, -1268, -890, -413, 142, 744, 1348, 1911, 2395,
-    2758, 2959, 2984, 2845, 2564, 2170, 1710, 1240, 792, 387, 46, -223,
-    -437, -626, -804, -973, -1130, -1255, -1306, -1248, -1068, -768, -361, 124,
-    650, 1189, 1718, 2209, 2642, 3019, 3347, 3617, 3816, 3938, 3976, 3919,
-    3767, 3533, 3223, 2839, 2389, 1897, 1389, 901, 479, 165, -14, -44,
-    81, 351, 736, 1201, 1715, 2246, 2760, 3226, 3618, 3907, 4076, 4119,
-    4042, 3861, 3600, 3286, 2938, 2568, 2196, 1843, 1526, 1269, 1109, 1082,
-    1189, 1409, 1710, 2047, 2374, 2652, 2862, 2990, 3029, 2975, 2828, 2591,
-    2286, 1955, 1632, 1328, 1040, 765, 498, 233, -27, -266, -464, -607,
-    -677, -660, -545, -322, 12, 439, 922, 1419, 1889, 2297, 2615, 2829,
-    2930, 2920, 2813, 2626, 2376, 2082, 1756, 1401, 1016, 608, 186, -244,
-    -665, -1046, -1360, -1583, -1689, -1663, -1511, -1259, -928, -543, -139, 252,
-    597, 862, 1016, 1054, 979, 796, 514, 158, -248, -676, -1086, -1428,
-    -1658, -1745, -1671, -1437, -1077, -637, -172, 263, 619, 856, 946, 867,
-    623, 239, -245, -791, -1359, -1918, -2448, -2930, -3339, -3648, -3844, -3919,
-    -3875, -3718, -3468, -3147, -2782, -2399, -2009, -1627, -1268, -945, -656, -395,
-    -168, 14, 145, 218, 218, 133, -32, -265, -562, -918, -1327, -1783,
-    -2288, -2843, -3427, -4005, -4536, -4970, -5248, -5310, -5127, -4703, -4078, -3315,
-    -2494, -1688, -965, -376, 44, 276, 322, 192, -89, -496, -1003, -1585,
-    -2216, -2862, -3484, -4048, -4533, -4927, -5215, -5368, -5359, -5173, -4809, -4297,
-    -3693, -3052, -2408, -1779, -1178, -609, -71, 427, 866, 1218, 1453, 1545,
-    1483, 1278, 947, 511, 2, -550, -1124, -1721, -2339, -2949, -3505, -3958,
-    -4268, -4410, -4363, -4124, -3719, -3192, -2590, -1962, -1357, -808, -319, 122,
-    537, 953, 1398, 1877, 2375, 2868, 3313, 3665, 3879, 3925, 3780, 3439,
-    2929, 2297, 1593, 871, 199, -356, -744, -935, -926, -750, -475, -184,
-    42, 144, 114, -13, -179, -327, -393, -344, -182, 70, 396, 781,
-    1198, 1623, 2032, 2404, 2706, 2923, 3057, 3111, 3089, 2997, 2846, 2638,
-    2366, 2022, 1602, 1114, 577, 33, -462, -850, -1087, -1144, -1019, -739,
-    -345, 113, 585, 1015, 1361, 1605, 1764, 1877, 1999, 2175, 2418, 2717,
-    3055, 3413, 3763, 4081, 4343, 4529, 4628, 4642, 4591, 4498, 4379, 4240,
-    4068, 3836, 3519, 3107, 2611, 2064, 1513, 1017, 635, 421, 396, 543,
-    821, 1178, 1553, 1896, 2186, 2421, 2606, 2750, 2867, 2979, 3105, 3266,
-    3474, 3723, 3987, 4241, 4462, 4624, 4708, 4709, 4629, 4475, 4260, 4003,
-    3720, 3415, 3088, 2730, 2327, 1869, 1362, 832, 315, -145, -499, -710,
-    -757, -652, -424, -120, 210, 524, 800, 1035, 1240, 1434, 1642, 1876,
-    2138, 2413, 2692, 2957, 3176, 3325, 3392, 3369, 3247, 3034, 2759, 2442,
-    2086, 1687, 1236, 723, 151, -462, -1078, -1648, -2111, -2419, -2540, -2463,
-    -2194, -1768, -1248, -700, -176, 284, 657, 938, 1128, 1224, 1220, 1117,
-    914, 624, 270, -112, -487, -818, -1063, -1185, -1169, -1016, -747, -398,
-    -18, 336, 618, 797, 858, 806, 659, 447, 194, -79, -350, -601,
-    -823, -1014, -1165, -1269, -1337, -1393, -1457, -1541, -1656, -1801, -1965, -2137,
-    -2305, -2451, -2563, -2644, -2700, -2729, -2727, -2694, -2621, -2499, -2324, -2112,
-    -1873, -1612, -1335, -1052, -782, -542, -353, -226, -167, -176, -247, -376,
-    -559, -788, -1046, -1318, -1593, -1861, -2114, -2357, -2608, -2876, -3158, -3448,
-    -3747, -4049, -4344, -4611, -4833, -4991, -5070, -5053, -4930, -4701, -4371, -3949,
-    -3451, -2912, -2372, -1867, -1439, -1123, -939, -882, -948, -1126, -1393, -1712,
-    -2059, -2422, -2786, -3140, -3465, -3737, -3925, -3999, -3944, -3762, -3478, -3138,
-    -2785, -2458, -2200, -2036, -1976, -2012, -2126, -2284, -2448, -2587, -2694, -2766,
-    -2807, -2832, -2857, -2892, -2941, -3007, -3078, -3123, -3101, -2984, -2749, -2397,
-    -1960, -1507, -1105, -810, -665, -707, -945, -1351, -1871, -2445, -3006, -3486,
-    -3826, -3990, -3958, -3716, -3266, -2644, -1905, -1099, -278, 502, 1194, 1764,
-    2187, 2442, 2527, 2461, 2270, 1980, 1612, 1175, 678, 143, -394, -902,
-    -1357, -1732, -2007, -2178, -2247, -2211, -2074, -1851, -1562, -1229, -881, -542,
-    -221, 76, 347, 602, 859, 1128, 1410, 1711, 2042, 2403, 2782, 3167,
-    3538, 3863, 4109, 4251, 4267, 4135, 3861, 3480, 3045, 2620, 2265, 2016,
-    1881, 1856, 1937, 2105, 2327, 2560, 2757, 2874, 2890, 2817, 2683, 2530,
-    2409, 2360, 2403, 2539, 2764, 3056, 3379, 3699, 3992, 4236, 4405, 4480,
-    4447, 4302, 4050, 3720, 3347, 2954, 2550, 2149, 1765, 1415, 1123, 918,
-    817, 814, 879, 968, 1037, 1052, 999, 888, 743, 594, 473, 406,
-    409, 479, 602, 767, 961, 1159, 1336, 1479, 1587, 1656, 1682, 1673,
-    1638, 1582, 1507, 1415, 1307, 1182, 1041, 881, 699, 491, 250, -25,
-    -334, -657, -964, -1218, -1384, -1435, -1367, -1198, -952, -658, -345, -36,
-    259, 521, 733, 896, 1035, 1169, 1312, 1472, 1653, 1836, 1995, 2119,
-    2201, 2231, 2198, 2100, 1940, 1718, 1447, 1138, 804, 455, 114, -196,
-    -457, -648, -750, -757, -676, -521, -310, -68, 178, 415, 639, 844,
-    1025, 1187, 1337, 1471, 1583, 1671, 1730, 1752, 1720, 1625, 1463, 1251,
-    1014, 778, 563, 391, 286, 254, 289, 373, 488, 604, 690, 731,
-    731, 691, 619, 526, 425, 328, 245, 188, 155, 145, 154, 180,
-    220, 284, 376, 491, 612, 728, 815, 849, 819, 732, 597, 424,
-    235, 58, -87, -192, -256, -283, -284, -264, -236, -214, -213, -250,
-    -340, -492, -699, -951, -1237, -1537, -1822, -2073, -2271, -2394, -2428, -2380,
-    -2264, -2091, -1879, -1655, -1431, -1210, -999, -813, -657, -524, -415, -328,
-    -254, -198, -178, -211, -302, -435, -588, -744, -887, -1008, -1102, -1166,
-    -1199, -1199, -1169, -1132, -1111, -1122, -1168, -1246, -1349, -1466, -1580, -1678,
-    -1736, -1733, -1656, -1513, -1319, -1095, -860, -632, -425, -255, -139, -85,
-    -89, -140, -228, -348, -498, -681, -908, -1179, -1483, -1803, -2115, -2387,
-    -2587, -2687, -2676, -2556, -2342, -2062, -1748, -1437, -1168, -972, -861, -831,
-    -870, -951, -1047, -1145, -1238, -1315, -1376, -1418, -1438, -1434, -1427, -1444,
-    -1499, -1587, -1708, -1852, -1999, -2140, -2291, -2463, -2644, -2826, -3009, -3183,
-    -3325, -3423, -3475, -3469, -3394, -3247, -3033, -2760, -2451, -2136, -1845, -1600,
-    -1418, -1305, -1255, -1262, -1324, -1430, -1567, -1720, -1875, -2015, -2130, -2214,
-    -2256, -2256, -2228, -2194, -2176, -2199, -2276, -2401, -2553, -2720, -2894, -3065,
-    -3222, -3360, -3467, -3529, -3538, -3496, -3412, -3291, -3130, -2927, -2685, -2415,
-    -2123, -1816, -1511, -1232, -996, -811, -684, -604, -549, -499, -437, -352,
-    -229, -67, 118, 296, 441, 520, 507, 394, 189, -100, -463, -879,
-    -1320, -1754, -2154, -2488, -2714, -2803, -2731, -2487, -2072, -1510, -835, -88,
-    683, 1413, 2043, 2519, 2797, 2857, 2706, 2369, 1880, 1286, 662, 78,
-    -395, -699, -789, -656, -317, 199, 861, 1626, 2440, 3247, 4000, 4657,
-    5181, 5539, 5707, 5681, 5464, 5068, 4531, 3914, 3268, 2625, 2014, 1473,
-    1030, 706, 517, 473, 564, 764, 1033, 1314, 1541, 1659, 1644, 1508,
-    1293, 1066, 893, 825, 896, 1107, 1440, 1866, 2356, 2874, 3392, 3906,
-    4417, 4917, 5390, 5820, 6170, 6375, 6378, 6142, 5656, 4935, 4043, 3074,
-    2124, 1287, 647, 269, 170, 326, 678, 1148, 1652, 2117, 2489, 2742,
-    2877, 2914, 2878, 2798, 2712, 2646, 2620, 2635, 2690, 2772, 2872, 2992,
-    3149, 3350, 3593, 3872, 4194, 4559, 4954, 5359, 5751, 6096, 6338, 6419,
-    6291, 5925, 5313, 4492, 3530, 2515, 1543, 693, 26, -426, -654, -664,
-    -482, -141, 315, 827, 1336, 1802, 2207, 2542, 2812, 3027, 3193, 3300,
-    3322, 3226, 2982, 2582, 2037, 1375, 641, -105, -812, -1440, -1953, -2311,
-    -2485, -2457, -2225, -1813, -1274, -673, -67, 497, 981, 1355, 1597, 1681,
-    1581, 1285, 794, 143, -598, -1334, -1971, -2422, -2618, -2539, -2217, -1711,
-    -1090, -439, 171, 698, 1117, 1401, 1527, 1494, 1297, 934, 424, -198,
-    -884, -1585, -2228, -2738, -3059, -3172, -3082, -2817, -2424, -1957, -1475, -1020,
-    -611, -246, 81, 379, 657, 909, 1105, 1206, 1185, 1028, 728, 297,
-    -236, -829, -1433, -1986, -2424, -2708, -2828, -2803, -2657, -2427, -2147, -1849,
-    -1553, -1275, -1026, -802, -589, -377, -159, 74, 317, 557, 775, 957,
-    1085, 1141, 1122, 1032, 871, 646, 380, 93, -209, -528, -863, -1220,
-    -1595, -1968, -2302, -2556, -2692, -2684, -2536, -2272, -1928, -1547, -1182, -873,
-    -640, -500, -466, -534, -690, -909, -1156, -1377, -1522, -1553, -1455, -1236,
-    -939, -617, -321, -99, 11, 4, -96, -264, -470, -672, -831, -922,
-    -933, -857, -711, -535, -367, -251, -219, -278, -421, -641, -930, -1273,
-    -1655, -2075, -2522, -2971, -3402, -3791, -4102, -4292, -4336, -4227, -3974, -3605,
-    -3164, -2695, -2232, -1806, -1441, -1146, -926, -787, -725, -729, -783, -869,
-    -968, -1075, -1194, -1329, -1475, -1624, -1768, -1896, -1995, -2063, -2111, -2157,
-    -2223, -2327, -2473, -2648, -2826, -2976, -3067, -3076, -2992, -2812, -2535, -2171,
-    -1744, -1284, -819, -381, 1, 302, 508, 615, 611, 498, 280, -31,
-    -431, -905, -1421, -1942, -2428, -2849, -3176, -3387, -3458, -3364, -3092, -2650,
-    -2065, -1392, -698, -43, 530, 996, 1338, 1551, 1643, 1622, 1505, 1315,
-    1068, 766, 411, 12, -420, -872, -1328, -1764, -2149, -2447, -2627, -2669,
-    -2558, -2293, -1891, -1380, -792, -165, 456, 1030, 1522, 1903, 2157, 2291,
-    2318, 2246, 2087, 1854, 1555, 1188, 760, 291, -207, -724, -1244, -1741,
-    -2194, -2569, -2813, -2884, -2768, -2466, -2003, -1422, -779, -122, 505, 1054,
-    1487, 1786, 1947, 1973, 1876, 1670, 1375, 1017, 621, 205, -208, -593,
-    -931, -1216, -1442, -1601, -1689, -1709, -1665, -1576, -1462, -1333, -1184, -1007,
-    -789, -512, -169, 228, 652, 1079, 1475, 1806, 2046, 2182, 2204, 2108,
-    1904, 1607, 1240, 831, 420, 45, -266, -495, -634, -682, -649, -557,
-    -429, -291, -171, -96, -80, -127, -223, -354, -494, -613, -685, -681,
-    -583, -382, -85, 292, 725, 1188, 1655, 2102, 2502, 2830, 3067, 3196,
-    3203, 3092, 2887, 2614, 2287, 1927, 1560, 1194, 821, 441, 61, -312,
-    -670, -989, -1239, -1395, -1436, -1340, -1108, -762, -337, 138, 637, 1135,
-    1612, 2051, 2444, 2791, 3098, 3353, 3536, 3626, 3615, 3506, 3308, 3028,
-    2680, 2281, 1845, 1386, 926, 500, 152, -81, -175, -117, 85, 402,
-    803, 1252, 1715, 2164, 2581, 2960, 3289, 3558, 3754, 3869, 3896, 3835,
-    3689, 3465, 3179, 2862, 2549, 2267, 2030, 1846, 1720, 1647, 1614, 1611,
-    1630, 1661, 1694, 1725, 1762, 1802, 1842, 1876, 1907, 1943, 1988, 2048,
-    2129, 2233, 2361, 2514, 2700, 2920, 3157, 3379, 3557, 3668, 3700, 3640,
-    3482, 3220, 2854, 2397, 1871, 1312, 770, 302, -42, -239, -293, -221,
-    -49, 194, 470, 749, 1014, 1254, 1470, 1672, 1872, 2074, 2264, 2426,
-    2551, 2633, 2663, 2638, 2566, 2460, 2328, 2178, 2024, 1884, 1766, 1667,
-    1572, 1470, 1355, 1229, 1092, 941, 773, 581, 365, 132, -114, -363,
-    -597, -795, -941, -1029, -1048, -993, -878, -713, -497, -234, 55, 349,
-    641, 923, 1178, 1395, 1568, 1690, 1752, 1751, 1688, 1563, 1370, 1100,
-    742, 280, -290, -961, -1695, -2430, -3091, -3603, -3902, -3948, -3743, -3339,
-    -2801, -2199, -1606, -1084, -673, -389, -233, -197, -261, -402, -596, -824,
-    -1072, -1333, -1611, -1906, -2215, -2525, -2814, -3062, -3244, -3338, -3326, -3215,
-    -3032, -2805, -2565, -2350, -2192, -2109, -2099, -2162, -2284, -2437, -2587, -2705,
-    -2769, -2752, -2638, -2435, -2165, -1852, -1521, -1203, -926, -709, -565, -501,
-    -514, -590, -708, -849, -1001, -1163, -1338, -1532, -1754, -2001, -2259, -2510,
-    -2744, -2950, -3112, -3217, -3258, -3232, -3132, -2963, -2739, -2468, -2157, -1810,
-    -1439, -1061, -699, -383, -141, 9, 61, 21, -99, -289, -536, -818,
-    -1117, -1426, -1737, -2041, -2334, -2613, -2870, -3085, -3238, -3302, -3254, -3081,
-    -2786, -2381, -1892, -1355, -814, -299, 160, 531, 798, 951, 984, 893,
-    693, 407, 50, -361, -809, -1284, -1780, -2270, -2713, -3079, -3350, -3512,
-    -3562, -3517, -3389, -3174, -2875, -2503, -2066, -1577, -1067, -564, -79, 381,
-    794, 1131, 1378, 1520, 1544, 1449, 1246, 956, 602, 208, -204, -616,
-    -1008, -1367, -1684, -1955, -2174, -2345, -2478, -2568, -2605, -2581, -2494, -2339,
-    -2115, -1820, -1455, -1024, -551, -68, 398, 821, 1184, 1474, 1690, 1831,
-    1892, 1865, 1743, 1522, 1201, 780, 269, -315, -942, -1577, -2191, -2749,
-    -3215, -3547, -3704, -3663, -3428, -3031, -2511, -1911, -1277, -652, -64, 476,
-    970, 1421, 1825, 2173, 2451, 2644, 2737, 2723, 2608, 2396, 2097, 1718,
-    1265, 742, 170, -418, -994, -1539, -2035, -2458, -2791, -3027, -3163, -3199,
-    -3141, -2999, -2779, -2487, -2136, -1740, -1316, -874, -425, 30, 493, 974,
-    1475, 1987, 2481, 2919, 3270, 3507, 3612, 3573, 3389, 3070, 2635, 2106,
-    1504, 852, 175, -503, -1153, -1732, -2188, -2469, -2537, -2372, -1979, -1391,
-    -663, 145, 968, 1749, 2449, 3053, 3553, 3941, 4206, 4335, 4311, 4125,
-    3785, 3316, 2748, 2111, 1450, 818, 253, -211, -541, -706, -699, -535,
-    -231, 192, 694, 1224, 1741, 2215, 2625, 2959, 3214, 3387, 3472, 3465,
-    3371, 3207, 2992, 2743, 2462, 2158, 1847, 1550, 1282, 1051, 854, 675,
-    496, 308, 110, -100, -321, -543, -751, -932, -1065, -1122, -1078, -920,
-    -649, -272, 200, 746, 1336, 1928, 2483, 2979, 3391, 3691, 3856, 3881,
-    3769, 3531, 3187, 2765, 2292, 1793, 1290, 800, 334, -97, -481, -804,
-    -1046, -1194, -1235, -1172, -1016, -787, -506, -194, 136, 474, 805, 1117,
-    1401, 1658, 1883, 2067, 2206, 2299, 2336, 2312, 2234, 2123, 2004, 1902,
-    1829, 1790, 1778, 1779, 1775, 1739, 1655, 1515, 1307, 1029, 702, 367,
-    62, -185, -348, -406, -350, -181, 97, 464, 895, 1360, 1826, 2255,
-    2617, 2895, 3063, 3103, 3017, 2828, 2562, 2245, 1908, 1585, 1299, 1065,
-    890, 772, 701, 671, 677, 713, 786, 903, 1063, 1258, 1477, 1702,
-    1916, 2108, 2271, 2385, 2439, 2432, 2367, 2238, 2050, 1821, 1568, 1301,
-    1036, 793, 575, 387, 237, 130, 69, 69, 145, 298, 524, 816,
-    1155, 1516, 1877, 2217, 2503, 2711, 2828, 2851, 2771, 2590, 2319, 1972,
-    1567, 1134, 715, 347, 52, -158, -283, -337, -341, -317, -285, -254,
-    -229, -208, -187, -156, -111, -48, 37, 147, 285, 462, 686, 955,
-    1256, 1580, 1922, 2261, 2571, 2840, 3051, 3185, 3228, 3179, 3032, 2780,
-    2429, 1986, 1453, 840, 174, -518, -1202, -1833, -2355, -2734, -2954, -3006,
-    -2894, -2649, -2319, -1934, -1520, -1109, -722, -359, -9, 329, 653, 962,
-    1246, 1491, 1681, 1802, 1834, 1763, 1586, 1317, 968, 559, 114, -343,
-    -794, -1214, -1576, -1862, -2064, -2178, -2206, -2153, -2039, -1891, -1740, -1619,
-    -1550, -1544, -1602, -1718, -1881, -2080, -2307, -2542, -2755, -2922, -3027, -3064,
-    -3024, -2909, -2724, -2483, -2199, -1893, -1586, -1294, -1028, -799, -616, -474,
-    -368, -290, -235, -194, -174, -180, -210, -266, -364, -527, -768, -1096,
-    -1517, -2024, -2587, -3169, -3728, -4213, -4570, -4762, -4779, -4635, -4371, -4036,
-    -3678, -3334, -3039, -2824, -2704, -2677, -2729, -2837, -2967, -3095, -3202, -3267,
-    -3264, -3171, -2982, -2693, -2316, -1876, -1406, -944, -535, -216, -11, 77,
-    52, -77, -294, -580, -920, -1292, -1671, -2028, -2345, -2621, -2868, -3092,
-    -3289, -3451, -3571, -3634, -3626, -3545, -3394, -3177, -2897, -2574, -2229, -1878,
-    -1541, -1252, -1049, -958, -988, -1134, -1382, -1702, -2052, -2394, -2711, -2996,
-    -3238, -3420, -3531, -3563, -3504, -3350, -3110, -2796, -2420, -1997, -1544, -1073,
-    -596, -141, 261, 593, 842, 991, 1032, 961, 777, 475, 64, -435,
-    -995, -1579, -2143, -2648, -3069, -3384, -3580, -3654, -3611, -3451, -3180, -2816,
-    -2385, -1905, -1401, -899, -426, 10, 402, 737, 1001, 1189, 1302, 1343,
-    1328, 1280, 1222, 1165, 1114, 1069, 1023, 965, 882, 761, 584, 339,
-    23, -361, -796, -1248, -1678, -2054, -2344, -2504, -2505, -2354, -2067, -1660,
-    -1167, -640, -125, 347, 755, 1084, 1338, 1530, 1672, 1780, 1864, 1921,
-    1939, 1912, 1831, 1683, 1462, 1184, 866, 519, 153, -218, -587, -946,
-    -1273, -1544, -1740, -1847, -1857, -1774, -1612, -1382, -1095, -765, -416, -63,
-    276, 581, 837, 1032, 1165, 1245, 1289, 1316, 1336, 1353, 1362, 1348,
-    1290, 1180, 1019, 813, 573, 327, 98, -98, -250, -347, -380, -351,
-    -268, -136, 36, 247, 500, 806, 1167, 1570, 1992, 2401, 2758, 3024,
-    3179, 3213, 3115, 2877, 2512, 2054, 1541, 1002, 467, -29, -459, -801,
-    -1031, -1135, -1111, -968, -717, -373, 53, 540, 1060, 1579, 2067, 2503,
-    2877, 3181, 3413, 3565, 3624, 3600, 3510, 3363, 3164, 2922, 2644, 2337,
-    2012, 1691, 1383, 1082, 783, 491, 209, -59, -298, -494, -643, -746,
-    -787, -741, -599, -363, -43, 347, 782, 1228, 1656, 2051, 2398, 2671,
-    2842, 2903, 2851, 2686, 2419, 2083, 1725, 1386, 1100, 896, 790, 775,
-    830, 927, 1040, 1140, 1203, 1209, 1149, 1028, 862, 676, 499, 356,
-    265, 238, 277, 378, 530, 719, 927, 1136, 1335, 1522, 1689, 1825,
-    1920, 1968, 1962, 1907, 1811, 1670, 1477, 1236, 959, 657, 338, 24,
-    -266, -527, -749, -906, -976, -961, -868, -704, -481, -211, 96, 429,
-    760, 1063, 1320, 1523, 1674, 1781, 1857, 1902, 1912, 1883, 1814, 1701,
-    1544, 1338, 1082, 780, 440, 78, -287, -627, -916, -1135, -1272, -1325,
-    -1305, -1228, -1115, -987, -858, -740, -635, -540, -448, -347, -227, -83,
-    90, 295, 534, 804, 1097, 1395, 1674, 1921, 2126, 2276, 2361, 2379,
-    2331, 2211, 2022, 1781, 1507, 1207, 892, 577, 275, -9, -269, -492,
-    -673, -808, -888, -900, -835, -695, -488, -221, 82, 389, 663, 877,
-    1005, 1031, 951, 776, 524, 214, -126, -463, -767, -1013, -1185, -1284,
-    -1314, -1275, -1162, -979, -728, -416, -60, 319, 700, 1066, 1391, 1653,
-    1838, 1938, 1945, 1870, 1727, 1533, 1295, 1030, 745, 443, 132, -173,
-    -468, -753, -1015, -1243, -1441, -1611, -1735, -1799, -1804, -1745, -1614, -1414,
-    -1160, -860, -521, -158, 213, 574, 905, 1182, 1386, 1502, 1507, 1395,
-    1183, 899, 574, 257, -8, -206, -336, -393, -384, -333, -271, -216,
-    -187, -202, -259, -344, -444, -543, -620, -671, -708, -734, -744, -740,
-    -725, -699, -660, -613, -564, -510, -444, -369, -287, -210, -152, -133,
-    -160, -229, -327, -443, -558, -643, -677, -648, -552, -386, -154, 128,
-    444, 782, 1122, 1431, 1680, 1849, 1920, 1883, 1742, 1505, 1176, 761,
-    281, -238, -769, -1282, -1753, -2160, -2484, -2698, -2781, -2721, -2517, -2181,
-    -1746, -1254, -742, -239, 227, 640, 984, 1244, 1398, 1427, 1323, 1091,
-    755, 353, -70, -477, -834, -1116, -1309, -1414, -1440, -1403, -1322, -1221,
-    -1115, -1009, -903, -789, -661, -509, -332, -132, 79, 292, 497, 682,
-    832, 934, 982, 968, 882, 718, 483, 193, -132, -470, -789, -1062,
-    -1274, -1414, -1470, -1436, -1317, -1127, -883, -608, -326, -56, 183, 383,
-    538, 644, 694, 688, 635, 543, 414, 253, 74, -113, -306, -496,
-    -669, -822, -957, -1070, -1152, -1196, -1197, -1152, -1065, -948, -804, -645,
-    -495, -368, -260, -173, -118, -97, -107, -146, -212, -289, -359, -421,
-    -476, -524, -571, -626, -682, -736, -791, -852, -908, -948, -970, -973,
-    -957, -933, -913, -904, -907, -926, -963, -1011, -1070, -1142, -1223, -1300,
-    -1363, -1408, -1423, -1400, -1344, -1260, -1157, -1040, -920, -802, -690, -585,
-    -496, -430, -393, -380, -376, -373, -369, -365, -367, -386, -428, -488,
-    -561, -648, -763, -910, -1090, -1306, -1551, -1805, -2044, -2250, -2409, -2508,
-    -2535, -2482, -2353, -2160, -1916, -1643, -1364, -1103, -877, -699, -582, -526,
-    -514, -528, -550, -570, -577, -571, -554, -521, -464, -387, -303, -228,
-    -173, -151, -173, -246, -362, -513, -687, -876, -1069, -1252, -1405, -1513,
-    -1567, -1559, -1486, -1355, -1179, -971, -741, -505, -275, -62, 122, 267,
-    372, 438, 464, 450, 406, 340, 252, 151, 50, -42, -128, -197,
-    -239, -247, -224, -176, -109, -34, 34, 86, 122, 146, 169, 200,
-    253, 333, 439, 555, 664, 759, 833, 877, 878, 835, 753, 642,
-    516, 391, 275, 164, 48, -83, -229, -379, -522, -660, -794, -921,
-    -1034, -1127, -1189, -1202, -1151, -1039, -874, -662, -412, -137, 150, 439,
-    714, 948, 1125, 1243, 1300, 1283, 1178, 986, 718, 383, 1, -400,
-    -795, -1161, -1472, -1703, -1846, -1902, -1865, -1739, -1540, -1291, -1005, -697,
-    -391, -113, 121, 307, 447, 554, 638, 704, 753, 787, 803, 800,
-    787, 775, 765, 749, 720, 674, 604, 513, 408, 295, 177, 53,
-    -85, -239, -402, -555, -687, -786, -840, -850, -819, -749, -634, -481,
-    -301, -93, 142, 392, 638, 880, 1121, 1361, 1592, 1812, 1999, 2128,
-    2184, 2165, 2067, 1879, 1612, 1294, 947, 590, 248, -47, -280, -443,
-    -525, -520, -448, -340, -215, -90, 22, 118, 203, 278, 335, 374,
-    411, 460, 524, 604, 696, 783, 853, 907, 950, 990, 1030, 1070,
-    1104, 1126, 1138, 1135, 1114, 1081, 1048, 1017, 986, 962, 956, 963,
-    969, 978, 997, 1018, 1031, 1038, 1045, 1045, 1037, 1025, 1020, 1027,
-    1049, 1090, 1144, 1201, 1251, 1291, 1321, 1332, 1313, 1262, 1185, 1086,
-    965, 828, 696, 584, 502, 455, 451, 484, 553, 657, 798, 971,
-    1164, 1363, 1549, 1705, 1820, 1890, 1917, 1906, 1860, 1790, 1707, 1623,
-    1541, 1459, 1373, 1284, 1190, 1084, 962, 826, 673, 503, 324, 155,
-    9, -102, -173, -200, -179, -106, 16, 180, 377, 594, 815, 1022,
-    1201, 1337, 1426, 1463, 1448, 1378, 1256, 1097, 912, 706, 486, 273,
-    84, -69, -170, -208, -186, -116, -12, 111, 236, 342, 413, 436,
-    403, 326, 224, 110, -7, -120, -221, -304, -361, -380, -353, -282,
-    -173, -31, 137, 322, 508, 684, 841, 967, 1060, 1124, 1162, 1171,
-    1146, 1087, 994, 867, 712, 532, 326, 92, -156, -397, -622, -825,
-    -995, -1116, -1183, -1189, -1135, -1024, -867, -673, -452, -220, 6, 216,
-    399, 540, 630, 674, 679, 645, 582, 494, 378, 230, 60, -120,
-    -307, -492, -659, -799, -910, -988, -1026, -1024, -988, -924, -842, -760,
-    -697, -662, -660, -685, -735, -802, -878, -945, -990, -1007, -993, -936,
-    -828, -666, -457, -205, 77, 369, 648, 884, 1049, 1116, 1069, 906,
-    637, 279, -144, -602, -1063, -1491, -1860, -2138, -2302, -2338, -2254, -2068,
-    -1795, -1449, -1050, -613, -155, 304, 741, 1127, 1433, 1636, 1730, 1716,
-    1602, 1400, 1129, 808, 461, 112, -216, -505, -745, -937, -1085, -1193,
-    -1257, -1279, -1266, -1216, -1129, -1008, -858, -676, -457, -205, 66, 336,
-    587, 800, 964, 1065, 1095, 1056, 958, 814, 634, 435, 236, 44,
-    -142, -319, -482, -621, -732, -812, -862, -879, -854, -785, -676, -531,
-    -356, -164, 33, 232, 419, 574, 681, 736, 740, 690, 592, 458,
-    296, 111, -85, -278, -459, -622, -764, -881, -969, -1021, -1027, -986,
-    -904, -797, -671, -533, -387, -240, -98, 38, 163, 274, 379, 483,
-    585, 673, 741, 780, 785, 747, 667, 546, 387, 201, 6, -182,
-    -353, -502, -623, -710, -762, -784, -778, -745, -686, -607, -510, -398,
-    -280, -165, -61, 28, 95, 135, 144, 120, 65, -14, -106, -201,
-    -292, -366, -419, -455, -478, -482, -466, -434, -385, -315, -223, -124,
-    -24, 83, 201, 321, 428, 515, 576, 605, 608, 592, 565, 524,
-    465, 387, 298, 208, 128, 57, -11, -84, -161, -237, -311, -382,
-    -447, -501, -542, -575, -604, -627, -641, -635, -602, -529, -410, -258,
-    -89, 83, 258, 437, 616, 789, 946, 1065, 1120, 1100, 1016, 887,
-    729, 553, 373, 207, 60, -65, -168, -242, -285, -301, -298, -281,
-    -253, -221, -191, -165, -139, -104, -56, 4, 77, 161, 249, 331,
-    403, 463, 505, 521, 511, 475, 413, 327, 221, 94, -58, -229,
-    -412, -598, -770, -904, -993, -1043, -1062, -1048, -1001, -922, -804, -647,
-    -465, -277, -97, 54, 166, 238, 277, 276, 233, 154, 50, -76,
-    -218, -361, -494, -606, -686, -721, -709, -653, -556, -426, -279, -132,
-    -2, 100, 176, 224, 238, 208, 136, 31, -98, -238, -372, -489,
-    -583, -652, -689, -683, -635, -555, -457, -359, -268, -186, -108, -40,
-    11, 43, 59, 55, 28, -28, -119, -256, -431, -623, -808, -972,
-    -1096, -1165, -1168, -1107, -976, -783, -555, -328, -125, 41, 162, 233,
-    259, 240, 174, 64, -78, -241, -414, -583, -735, -863, -968, -1047,
-    -1093, -1105, -1083, -1031, -951, -849, -732, -614, -503, -410, -344, -312,
-    -313, -345, -402, -476, -557, -644, -739, -840, -943, -1043, -1134, -1209,
-    -1266, -1300, -1305, -1277, -1222, -1144, -1044, -926, -798, -670, -557, -471,
-    -417, -397, -401, -415, -429, -446, -469, -494, -509, -515, -515, -513,
-    -511, -515, -527, -544, -570, -605, -649, -698, -748, -792, -827, -852,
-    -867, -866, -849, -823, -795, -761, -720, -670, -602, -513, -411, -305,
-    -196, -86, 22, 125, 225, 313, 381, 426, 442, 425, 367, 267,
-    128, -45, -240, -447, -654, -843, -994, -1094, -1130, -1099, -1013, -887,
-    -726, -529, -309, -82, 144, 359, 551, 711, 840, 932, 975, 963,
-    899, 785, 632, 454, 257, 44, -167, -356, -512, -637, -726, -780,
-    -805, -803, -768, -706, -633, -558, -482, -402, -313, -204, -79, 51,
-    177, 302, 424, 541, 653, 762, 855, 916, 945, 946, 925, 883,
-    823, 754, 679, 596, 504, 405, 308, 216, 129, 43, -43, -134,
-    -234, -344, -452, -551, -637, -707, -762, -798, -809, -783, -713, -605,
-    -463, -288, -89, 122, 335, 546, 748, 928, 1078, 1196, 1275, 1311,
-    1302, 1252, 1163, 1039, 886, 717, 546, 390, 262, 166, 102, 69,
-    64, 88, 148, 244, 363, 487, 599, 693, 765, 820, 856, 873,
-    871, 855, 838, 827, 829, 845, 867, 892, 921, 950, 969, 966,
-    938, 874, 779, 662, 537, 402, 265, 145, 59, 20, 32, 96,
-    205, 347, 514, 702, 904, 1108, 1301, 1473, 1609, 1690, 1700, 1642,
-    1529, 1378, 1199, 1007, 818, 643, 493, 386, 336, 335, 371, 433,
-    507, 578, 641, 702, 757, 800, 827, 844, 854, 862, 873, 893,
-    917, 950, 995, 1055, 1128, 1208, 1284, 1349, 1396, 1417, 1403, 1345,
-    1245, 1116, 970, 820, 666, 513, 370, 246, 145, 68, 15, -19,
-    -41, -50, -42, -16, 26, 84, 157, 242, 343, 463, 595, 728,
-    862, 996, 1119, 1220, 1298, 1350, 1361, 1322, 1236, 1100, 911, 680,
-    432, 191, -21, -184, -292, -343, -337, -271, -148, 17, 204, 393,
-    560, 690, 778, 821, 812, 745, 623, 456, 265, 72, -103, -247,
-    -349, -395, -382, -313, -199, -51, 120, 298, 479, 657, 829, 986,
-    1121, 1234, 1327, 1395, 1433, 1439, 1410, 1340, 1215, 1031, 797, 528,
-    245, -30, -274, -471, -611, -689, -695, -632, -512, -348, -155, 49,
-    244, 426, 599, 759, 894, 992, 1049, 1069, 1059, 1029, 987, 936,
-    871, 791, 700, 601, 497, 392, 291, 203, 133, 80, 47, 36,
-    43, 67, 106, 164, 237, 326, 426, 528, 626, 714, 789, 845,
-    875, 875, 839, 769, 676, 567, 448, 327, 217, 124, 56, 21,
-    21, 45, 83, 129, 172, 199, 201, 183, 144, 82, 2, -89,
-    -187, -292, -401, -504, -586, -638, -653, -631, -577, -495, -394, -284,
-    -176, -74, 17, 97, 159, 194, 194, 164, 108, 30, -64, -162,
-    -253, -331, -386, -403, -383, -335, -267, -189, -114, -54, -8, 31,
-    59, 64, 49, 22, -11, -43, -77, -112, -151, -192, -233, -271,
-    -302, -325, -336, -338, -329, -313, -291, -270, -249, -228, -208, -195,
-    -194, -206, -230, -258, -285, -310, -337, -371, -406, -441, -476, -507,
-    -526, -532, -528, -516, -494, -466, -444, -434, -435, -437, -428, -397,
-    -344, -273, -189, -95, -2, 74, 124, 139, 113, 43, -63, -200,
-    -361, -536, -712, -878, -1026, -1148, -1243, -1313, -1366, -1400, -1414, -1401,
-    -1365, -1308, -1231, -1139, -1036, -924, -800, -660, -520, -388, -267, -153,
-    -55, 18, 62, 71, 41, -33, -142, -278, -426, -580, -736, -894,
-    -1047, -1185, -1304, -1403, -1482, -1541, -1573, -1569, -1524, -1444, -1337, -1209,
-    -1062, -909, -755, -599, -443, -292, -152, -26, 82, 167, 225, 252,
-    234, 166, 51, -108, -310, -543, -792, -1037, -1265, -1464, -1621, -1730,
-    -1790, -1800, -1763, -1684, -1578, -1454, -1311, -1146, -966, -777, -586, -395,
-    -210, -34, 137, 303, 453, 572, 646, 668, 633, 543, 405, 229,
-    27, -191, -420, -648, -858, -1042, -1196, -1312, -1380, -1398, -1373, -1310,
-    -1207, -1063, -881, -667, -429, -180, 64, 295, 506, 691, 844, 960,
-    1040, 1082, 1078, 1026, 928, 788, 606, 387, 141, -116, -377, -631,
-    -864, -1062, -1212, -1302, -1324, -1278, -1170, -1012, -815, -593, -359, -123,
-    112, 339, 542, 710, 836, 917, 952, 938, 880, 777, 628, 437,
-    226, 15, -186, -371, -533, -670, -782, -872, -940, -988, -1010, -999,
-    -948, -858, -735, -591, -433, -259, -71, 126, 324, 517, 687, 813,
-    882, 897, 850, 724, 521, 257, -49, -382, -726, -1058, -1362, -1618,
-    -1806, -1916, -1953, -1927, -1837, -1686, -1483, -1237, -966, -689, -426, -182,
-    44, 252, 427, 552, 618, 634, 604, 526, 404, 250, 73, -131,
-    -358, -592, -825, -1056, -1284, -1491, -1661, -1792, -1884, -1934, -1940, -1901,
-    -1816, -1692, -1541, -1376, -1197, -1007, -806, -606, -414, -241, -94, 27,
-    120, 180, 203, 190, 148, 78, -23, -155, -313, -494, -686, -873,
-    -1045, -1203, -1346, -1461, -1539, -1577, -1578, -1548, -1500, -1447, -1389, -1317,
-    -1224, -1108, -969, -812, -649, -487, -322, -155, 1, 142, 268, 371,
-    424, 413, 347, 239, 106, -45, -207, -377, -551, -718, -864, -980,
-    -1060, -1109, -1129, -1122, -1085, -1014, -912, -783, -636, -478, -316, -151,
-    9, 148, 258, 334, 376, 386, 370, 338, 294, 245, 199, 157,
-    122, 94, 74, 52, 18, -34, -110, -212, -328, -441, -538, -609,
-    -638, -617, -545, -420, -238, -18, 218, 460, 706, 940, 1144, 1310,
-    1429, 1491, 1493, 1441, 1349, 1226, 1082, 921, 746, 564, 380, 202,
-    37, -107, -224, -318, -390, -443, -476, -481, -448, -371, -253, -92,
-    105, 328, 571, 835, 1114, 1386, 1636, 1854, 2024, 2124, 2146, 2086,
-    1942, 1723, 1446, 1129, 794, 472, 191, -44, -236, -383, -486, -550,
-    -568, -522, -407, -238, -27, 218, 485, 760, 1034, 1301, 1545, 1749,
-    1898, 1980, 1990, 1926, 1789, 1589, 1343, 1077, 810, 559, 334, 140,
-    -18, -132, -197, -214, -189, -127, -39, 62, 174, 304, 452, 612,
-    776, 924, 1038, 1116, 1179, 1238, 1291, 1338, 1375, 1392, 1386, 1365,
-    1335, 1288, 1215, 1117, 995, 853, 700, 544, 387, 225, 69, -66,
-    -170, -243, -290, -310, -302, -261, -181, -65, 78, 233, 387, 531,
-    651, 739, 788, 795, 759, 679, 561, 417, 257, 94, -47, -143,
-    -177, -137, -10, 213, 522, 900, 1323, 1758, 2158, 2484, 2700, 2787,
-    2739, 2571, 2315, 1997, 1629, 1211, 743, 230, -304, -818, -1271, -1628,
-    -1858, -1933, -1826, -1520, -1021, -377, 320, 953, 1415, 1636, 1588, 1279,
-    754, 84, -643, -1329, -1880, -2222, -2318, -2169, -1806, -1280, -650, 31,
-    709, 1321, 1799, 2076, 2112, 1886, 1401, 696, -164, -1096, -2002, -2761,
-    -3258, -3420, -3231, -2729, -1989, -1109, -185, 712, 1525, 2209, 2730, 3072,
-    3233, 3216, 3026, 2671, 2168, 1549, 869, 182, -464, -1037, -1507, -1851,
-    -2060, -2137, -2092, -1942, -1712, -1419, -1062, -638, -160, 339, 829, 1298,
-    1741, 2146, 2489, 2742, 2873, 2859, 2698, 2409, 2010, 1523, 975, 403,
-    -155, -674, -1134, -1528, -1858, -2126, -2325, -2444, -2481, -2455, -2396, -2316,
-    -2212, -2066, -1859, -1585, -1249, -867, -466, -73, 292, 615, 884, 1083,
-    1196, 1220, 1169, 1064, 938, 828, 764, 772, 870, 1068, 1356, 1699,
-    2039, 2313, 2460, 2443, 2250, 1883, 1356, 688, -89, -934, -1798, -2631,
-    -3382, -4007, -4464, -4715, -4739, -4535, -4137, -3598, -2979, -2332, -1699, -1110,
-    -586, -140, 226, 513, 727, 881, 987, 1060, 1118, 1176, 1235, 1282,
-    1301, 1276, 1199, 1064, 880, 652, 386, 93, -189, -412, -539, -561,
-    -488, -345, -170, -1, 127, 185, 143, -20, -304, -681, -1106, -1527,
-    -1893, -2162, -2300, -2287, -2112, -1786, -1344, -836, -320, 152, 536, 801,
-    935, 946, 840, 635, 361, 57, -241, -510, -734, -902, -1007, -1054,
-    -1050, -1005, -939, -874, -825, -795, -782, -769, -735, -671, -572, -431,
-    -243, -13, 242, 503, 756, 978, 1150, 1258, 1290, 1236, 1097, 894,
-    653, 391, 123, -135, -368, -565, -707, -774, -758, -665, -511, -314,
-    -98, 111, 284, 401, 446, 421, 340, 229, 120, 44, 23, 64,
-    163, 306, 468, 624, 758, 860, 920, 929, 893, 819, 716, 600,
-    488, 390, 309, 256, 246, 277, 338, 424, 538, 675, 824, 987,
-    1157, 1315, 1444, 1548, 1639, 1725, 1813, 1910, 2015, 2124, 2234, 2345,
-    2444, 2511, 2529, 2485, 2368, 2166, 1874, 1498, 1054, 576, 105, -319,
-    -660, -892, -1003, -992, -868, -650, -367, -54, 269, 590, 897, 1178,
-    1425, 1627, 1767, 1840, 1854, 1813, 1716, 1565, 1374, 1158, 926, 693,
-    475, 282, 125, 25, 0, 61, 202, 410, 660, 922, 1168, 1373,
-    1511, 1559, 1506, 1351, 1096, 749, 330, -140, -643, -1150, -1625, -2035,
-    -2355, -2563, -2643, -2588, -2397, -2079, -1663, -1186, -681, -175, 303, 726,
-    1082, 1365, 1559, 1651, 1640, 1536, 1345, 1070, 730, 347, -55, -461,
-    -848, -1192, -1474, -1681, -1805, -1849, -1815, -1705, -1522, -1275, -976, -648,
-    -321, -25, 229, 438, 598, 698, 732, 692, 573, 376, 121, -168,
-    -466, -746, -978, -1138, -1217, -1212, -1129, -982, -785, -554, -303, -53,
-    185, 413, 632, 838, 1023, 1178, 1295, 1368, 1403, 1405, 1372, 1289,
-    1149, 952, 713, 451, 182, -85, -345, -589, -800, -963, -1067, -1112,
-    -1104, -1052, -960, -829, -664, -469, -254, -28, 198, 423, 647, 871,
-    1087, 1288, 1468, 1612, 1710, 1751, 1729, 1638, 1486, 1285, 1052, 797,
-    533, 272, 23, -215, -434, -619, -766, -877, -959, -1012, -1034, -1018,
-    -957, -851, -716, -570, -418, -253, -74, 123, 340, 567, 783, 974,
-    1140, 1284, 1400, 1471, 1485, 1430, 1299, 1089, 801, 441, 23, -431,
-    -893, -1333, -1726, -2053, -2300, -2460, -2534, -2517, -2412, -2231, -2006, -1765,
-    -1530, -1309, -1105, -914, -725, -527, -325, -126, 69, 264, 449, 605,
-    720, 793, 821, 803, 741, 645, 520, 373, 214, 57, -93, -237,
-    -381, -525, -665, -796, -916, -1030, -1135, -1212, -1244, -1224, -1163, -1076,
-    -980, -891, -811, -733, -659, -605, -584, -589, -603, -614, -617, -613,
-    -608, -611, -613, -595, -549, -477, -378, -247, -79, 125, 357, 602,
-    839, 1048, 1217, 1335, 1390, 1370, 1272, 1106, 887, 629, 343, 35,
-    -277, -564, -796, -960, -1057, -1098, -1093, -1053, -981, -873, -736, -585,
-    -441, -316, -211, -132, -89, -90, -133, -207, -293, -366, -412, -429,
-    -424, -400, -362, -318, -277, -249, -244, -274, -341, -433, -536, -635,
-    -718, -774, -788, -751, -652, -491, -284, -55, 172, 373, 532, 638,
-    686, 676, 609, 489, 331, 151, -43, -251, -468, -683, -874, -1026,
-    -1129, -1187, -1208, -1205, -1185, -1146, -1083, -1001, -909, -814, -712, -601,
-    -485, -369, -262, -178, -125, -100, -97, -111, -137, -168, -203, -255,
-    -335, -447, -587, -743, -893, -1009, -1077, -1104, -1093, -1044, -956, -835,
-    -687, -522, -347, -166, 30, 241, 456, 653, 818, 950, 1048, 1111,
-    1136, 1120, 1066, 979, 863, 721, 551, 346, 103, -157, -393, -568,
-    -670, -708, -689, -613, -483, -310, -118, 65, 209, 303, 356, 382,
-    386, 362, 296, 183, 34, -127, -275, -384, -423, -366, -194, 104,
-    524, 1030, 1563, 2072, 2532, 2919, 3202, 3362, 3404, 3346, 3210, 3025,
-    2817, 2592, 2321, 1962, 1481, 864, 129, -669, -1446, -2105, -2550, -2704,
-    -2529, -2047, -1331, -504, 272, 818, 992, 735, 91, -804, -1754, -2555,
-    -3045, -3136, -2819, -2148, -1218, -147, 938, 1921, 2715, 3265, 3539, 3515,
-    3180, 2537, 1610, 467, -778, -1970, -2958, -3620, -3879, -3712, -3145, -2258,
-    -1165, -3, 1097, 2034, 2749, 3215, 3427, 3376, 3047, 2435, 1579, 553,
-    -537, -1567, -2420, -2998, -3243, -3131, -2671, -1929, -1013, -39, 890, 1691,
-    2307, 2724, 2951, 2990, 2831, 2471, 1917, 1189, 334, -563, -1398, -2076,
-    -2526, -2697, -2555, -2100, -1368, -440, 567, 1531, 2358, 2992, 3391, 3516,
-    3324, 2791, 1937, 835, -403, -1654, -2814, -3792, -4504, -4873, -4850, -4441,
-    -3720, -2807, -1827, -871, -18, 647, 1032, 1082, 818, 336, -221, -715,
-    -1041, -1139, -972, -527, 170, 1027, 1886, 2567, 2933, 2939, 2620, 2035,
-    1243, 293, -755, -1823, -2814, -3637, -4244, -4615, -4732, -4568, -4134, -3495,
-    -2760, -2049, -1461, -1046, -790, -646, -573, -535, -485, -362, -126, 227,
-    659, 1105, 1501, 1805, 1994, 2053, 1971, 1738, 1371, 910, 407, -91,
-    -549, -935, -1216, -1359, -1340, -1161, -860, -502, -159, 103, 217, 135,
-    -148, -586, -1083, -1523, -1793, -1823, -1595, -1143, -519, 218, 998, 1727,
-    2308, 2663, 2753, 2578, 2174, 1597, 898, 122, -682, -1442, -2083, -2531,
-    -2736, -2691, -2440, -2048, -1571, -1058, -560, -123, 223, 446, 531, 498,
-    410, 323, 275, 286, 365, 503, 691, 929, 1204, 1466, 1655, 1720,
-    1626, 1371, 988, 530, 43, -428, -832, -1115, -1235, -1169, -913, -511,
-    -32, 456, 905, 1283, 1566, 1739, 1786, 1691, 1462, 1145, 805, 508,
-    308, 235, 284, 432, 651, 909, 1168, 1395, 1566, 1667, 1696, 1668,
-    1608, 1530, 1438, 1328, 1194, 1022, 794, 509, 194, -109, -360, -530,
-    -597, -547, -387, -139, 169, 504, 832, 1115, 1341, 1521, 1679, 1835,
-    1985, 2114, 2192, 2191, 2079, 1830, 1429, 885, 233, -462, -1115, -1655,
-    -2029, -2215, -2208, -2019, -1681, -1238, -751, -291, 76, 314, 420, 411,
-    311, 152, -30, -207, -358, -465, -526, -552, -557, -542, -512, -480,
-    -460, -452, -443, -406, -317, -170, 8, 178, 312, 393, 410, 347,
-    188, -80, -459, -923, -1431, -1953, -2485, -3032, -3571, -4056, -4426, -4635,
-    -4668, -4539, -4266, -3857, -3323, -2693, -2022, -1372, -782, -264, 187, 572,
-    872, 1049, 1074, 960, 758, 506, 208, -146, -561, -1022, -1499, -1948,
-    -2336, -2654, -2886, -2993, -2930, -2676, -2247, -1695, -1096, -521, -8, 425,
-    754, 964, 1065, 1087, 1062, 1016, 958, 871, 732, 544, 319, 72,
-    -175, -387, -535, -599, -553, -381, -108, 209, 520, 791, 994, 1105,
-    1112, 1008, 791, 487, 141, -204, -511, -742, -873, -901, -834, -680,
-    -456, -192, 84, 347, 580, 781, 956, 1117, 1272, 1427, 1569, 1681,
-    1744, 1749, 1696, 1589, 1443, 1271, 1092, 937, 836, 796, 799, 817,
-    815, 747, 597, 396, 198, 54, 19, 133, 396, 758, 1165, 1584,
-    1996, 2396, 2799, 3211, 3609, 3947, 4173, 4229, 4062, 3634, 2941, 2014,
-    913, -270, -1433, -2486, -3343, -3929, -4175, -4034, -3501, -2640, -1587, -527,
-    358, 930, 1129, 980, 598, 164, -126, -111, 290, 1059, 2078, 3159,
-    4107, 4764, 5020, 4813, 4134, 3035, 1616, 18, -1590, -3034, -4178, -4932,
-    -5239, -5083, -4498, -3574, -2439, -1236, -105, 845, 1550, 1985, 2155, 2090,
-    1857, 1550, 1260, 1058, 983, 1045, 1231, 1514, 1861, 2234, 2569, 2780,
-    2792, 2555, 2049, 1277, 271, -903, -2149, -3341, -4344, -5045, -5373, -5313,
-    -4909, -4254, -3438, -2540, -1630, -767, 33, 789, 1524, 2255, 2988, 3701,
-    4319, 4743, 4889, 4691, 4118, 3195, 1998, 627, -817, -2229, -3510, -4585,
-    -5393, -5862, -5928, -5564, -4804, -3754, -2582, -1480, -610, -70, 124, 44,
-    -176, -386, -442, -232, 302, 1124, 2119, 3126, 3982, 4546, 4740, 4549,
-    3998, 3130, 2019, 771, -489, -1640, -2556, -3130, -3299, -3059, -2467, -1634,
-    -734, 20, 438, 408, -70, -884, -1827, -2651, -3133, -3140, -2655, -1758,
-    -603, 637, 1804, 2786, 3513, 3947, 4074, 3905, 3478, 2867, 2155, 1421,
-    737, 167, -233, -418, -359, -59, 430, 1013, 1564, 1963, 2108, 1951,
-    1498, 806, -32, -888, -1626, -2121, -2288, -2086, -1532, -694, 323, 1381,
-    2338, 3060, 3450, 3448, 3045, 2285, 1260, 91, -1091, -2159, -3005, -3554,
-    -3762, -3618, -3155, -2444, -1576, -646, 251, 1021, 1589, 1902, 1945, 1747,
-    1384, 965, 612, 423, 451, 703, 1146, 1707, 2290, 2793, 3131, 3251,
-    3134, 2810, 2336, 1773, 1174, 603, 132, -186, -335, -327, -198, -7,
-    185, 326, 373, 284, 34, -356, -813, -1234, -1516, -1581, -1409, -1041,
-    -541, 29, 601, 1100, 1457, 1632, 1621, 1461, 1219, 964, 752, 616,
-    581, 665, 874, 1184, 1539, 1874, 2131, 2277, 2313, 2251, 2103, 1868,
-    1539, 1125, 662, 207, -186, -469, -606, -573, -365, 5, 498, 1058,
-    1614, 2096, 2448, 2638, 2654, 2512, 2248, 1908, 1543, 1201, 926, 747,
-    675, 697, 776, 858, 882, 793, 550, 148, -381, -986, -1599, -2150,
-    -2571, -2812, -2850, -2686, -2354, -1904, -1390, -854, -331, 165, 638, 1103,
-    1562, 1996, 2370, 2634, 2737, 2637, 2325, 1817, 1142, 342, -547, -1495,
-    -2484, -3486, -4459, -5342, -6062, -6543, -6729, -6601, -6179, -5512, -4668, -3714,
-    -2713, -1716, -758, 145, 981, 1731, 2363, 2833, 3085, 3066, 2746, 2131,
-    1255, 183, -1005, -2234, -3437, -4545, -5491, -6223, -6689, -6826, -6591, -5988,
-    -5090, -4028, -2975, -2111, -1568, -1392, -1546, -1914, -2319, -2560, -2477, -1992,
-    -1127, 18, 1284, 2500, 3525, 4274, 4703, 4799, 4584, 4098, 3389, 2504,
-    1498, 416, -724, -1902, -3065, -4143, -5060, -5743, -6107, -6084, -5643, -4804,
-    -3641, -2278, -868, 470, 1662, 2682, 3541, 4272, 4894, 5397, 5750, 5902,
-    5788, 5364, 4638, 3644, 2439, 1105, -259, -1575, -2783, -3821, -4621, -5126,
-    -5297, -5114, -4616, -3886, -3020, -2108, -1240, -478, 168, 729, 1243, 1756,
-    2316, 2951, 3663, 4431, 5210, 5911, 6436, 6704, 6662, 6280, 5564, 4563,
-    3349, 2015, 678, -559, -1634, -2520, -3201, -3662, -3897, -3893, -3651, -3200,
-    -2592, -1885, -1129, -355, 432, 1239, 2054, 2851, 3613, 4327, 4962, 5470,
-    5793, 5865, 5643, 5123, 4325, 3278, 2033, 674, -695, -1960, -3007, -3739,
-    -4096, -4054, -3624, -2860, -1857, -735, 378, 1360, 2125, 2655, 2982, 3165,
-    3270, 3353, 3446, 3571, 3740, 3942, 4127, 4228, 4194, 3977, 3549, 2909,
-    2082, 1104, 23, -1095, -2190, -3208, -4077, -4717, -5070, -5109, -4837, -4301,
-    -3598, -2837, -2093, -1419, -855, -414, -79, 179, 384, 578, 800, 1062,
-    1346, 1628, 1877, 2062, 2161, 2167, 2066, 1849, 1522, 1106, 622, 79,
-    -489, -1031, -1487, -1796, -1917, -1848, -1637, -1362, -1106, -930, -867, -920,
-    -1063, -1253, -1433, -1539, -1515, -1331, -992, -538, -31, 451, 838, 1073,
-    1122, 976, 654, 195, -342, -881, -1345, -1683, -1874, -1919, -1845, -1702,
-    -1540, -1383, -1232, -1082, -923, -745, -557, -395, -292, -268, -328, -448,
-    -571, -631, -575, -380, -51, 378, 858, 1344, 1794, 2171, 2444, 2590,
-    2581, 2411, 2103, 1701, 1244, 764, 295, -152, -578, -982, -1344, -1648,
-    -1897, -2103, -2293, -2487, -2679, -2826, -2864, -2743, -2430, -1927, -1274, -535,
-    221, 933, 1549, 2025, 2335, 2459, 2383, 2110, 1658, 1052, 330, -447,
-    -1205, -1884, -2440, -2839, -3057, -3086, -2922, -2570, -2038, -1355, -564, 278,
-    1102, 1826, 2369, 2659, 2639, 2274, 1564, 563, -639, -1922, -3154, -4212,
-    -5003, -5470, -5590, -5369, -4846, -4104, -3254, -2425, -1724, -1208, -872, -669,
-    -533, -396, -205, 59, 395, 794, 1234, 1666, 2026, 2248, 2275, 2065,
-    1598, 886, -26, -1065, -2126, -3097, -3874, -4371, -4524, -4314, -3781, -3023,
-    -2187, -1438, -911, -665, -676, -852, -1053, -1134, -1003, -626, -13, 786,
-    1671, 2520, 3227, 3704, 3878, 3717, 3230, 2452, 1434, 259, -968, -2151,
-    -3209, -4056, -4612, -4831, -4706, -4266, -3589, -2788, -1977, -1238, -621, -132,
-    269, 638, 1017, 1439, 1922, 2445, 2955, 3402, 3744, 3948, 3992, 3875,
-    3596, 3140, 2505, 1715, 803, -204, -1256, -2286, -3223, -3997, -4527, -4749,
-    -4644, -4243, -3608, -2830, -2024, -1297, -723, -329, -95, 34, 131, 263,
-    480, 797, 1201, 1663, 2150, 2623, 3035, 3333, 3460, 3360, 2996, 2358,
-    1464, 369, -835, -2024, -3076, -3898, -4427, -4632, -4514, -4105, -3471, -2694,
-    -1854, -1020, -240, 457, 1075, 1636, 2166, 2676, 3143, 3505, 3680, 3604,
-    3238, 2576, 1660, 576, -573, -1697, -2721, -3580, -4227, -4621, -4730, -4541,
-    -4081, -3395, -2540, -1588, -611, 340, 1237, 2047, 2744, 3302, 3697, 3905,
-    3935, 3821, 3602, 3321, 3019, 2732, 2465, 2201, 1910, 1551, 1090, 526,
-    -115, -810, -1543, -2298, -3062, -3817, -4522, -5107, -5489, -5594, -5367, -4802,
-    -3944, -2876, -1699, -513, 594, 1559, 2356, 2968, 3390, 3623, 3678, 3576,
-    3363, 3097, 2820, 2549, 2284, 2016, 1729, 1397, 993, 503, -78, -732,
-    -1408, -2029, -2509, -2771, -2763, -2478, -1962, -1301, -603, 21, 471, 671,
-    580, 202, -418, -1184, -1974, -2649, -3087, -3210, -3004, -2514, -1820, -1027,
-    -236, 482, 1089, 1551, 1850, 1988, 1976, 1807, 1482, 1041, 551, 87,
-    -279, -477, -477, -307, -25, 314, 661, 985, 1272, 1515, 1699, 1815,
-    1881, 1924, 1987, 2118, 2350, 2678, 3074, 3505, 3931, 4296, 4536, 4588,
-    4391, 3909, 3155, 2189, 1092, -50, -1143, -2108, -2895, -3475, -3819, -3910,
-    -3749, -3360, -2790, -2106, -1381, -670, -3, 612, 1185, 1729, 2253, 2758,
-    3236, 3671, 4041, 4321, 4475, 4454, 4220, 3759, 3078, 2200, 1163, 33,
-    -1107, -2175, -3099, -3810, -4258, -4409, -4248, -3776, -3018, -2041, -937, 195,
-    1270, 2230, 3039, 3671, 4105, 4313, 4277, 3998, 3493, 2800, 1972, 1085,
-    213, -584, -1259, -1783, -2139, -2332, -2382, -2333, -2248, -2198, -2243, -2403,
-    -2657, -2952, -3225, -3420, -3506, -3466, -3295, -2991, -2563, -2031, -1429, -791,
-    -142, 512, 1179, 1860, 2534, 3165, 3713, 4123, 4329, 4271, 3921, 3286,
-    2400, 1321, 124, -1113, -2310, -3389, -4261, -4835, -5039, -4851, -4301, -3461,
-    -2450, -1420, -526, 115, 433, 422, 153, -246, -639, -919, -1003, -845,
-    -450, 144, 871, 1643, 2342, 2856, 3108, 3056, 2699, 2083, 1295, 441,
-    -356, -970, -1305, -1326, -1064, -615, -135, 197, 238, -83, -744, -1621,
-    -2517, -3213, -3535, -3393, -2792, -1830, -658, 563, 1696, 2644, 3359, 3827,
-    4056, 4058, 3850, 3442, 2845, 2095, 1249, 360, -539, -1418, -2245, -2978,
-    -3565, -3944, -4057, -3870, -3383, -2635, -1706, -697, 303, 1226, 2022, 2663,
-    3147, 3478, 3650, 3656, 3498, 3191, 2748, 2185, 1519, 769, -48, -902,
-    -1750, -2537, -3205, -3694, -3952, -3949, -3690, -3202, -2542, -1791, -1042, -387,
-    91, 322, 273, -20, -466, -937, -1297, -1424, -1242, -746, 0, 895,
-    1827, 2693, 3400, 3888, 4129, 4112, 3834, 3302, 2540, 1592, 532, -543,
-    -1527, -2322, -2853, -3079, -2988, -2604, -1978, -1188, -323, 536, 1326, 1996,
-    2530, 2942, 3262, 3505, 3674, 3761, 3736, 3557, 3200, 2675, 2018, 1278,
-    518, -204, -860, -1430, -1890, -2207, -2359, -2327, -2093, -1661, -1056, -320,
-    497, 1336, 2125, 2786, 3250, 3475, 3444, 3173, 2688, 2032, 1263, 448,
-    -333, -982, -1400, -1528, -1351, -905, -268, 449, 1121, 1625, 1847, 1709,
-    1208, 414, -553, -1546, -2414, -3023, -3280, -3141, -2621, -1794, -785, 264,
-    1220, 1982, 2471, 2645, 2488, 2011, 1261, 323, -681, -1615, -2343, -2760,
-    -2817, -2528, -1947, -1165, -310, 488, 1129, 1558, 1751, 1723, 1518, 1204,
-    857, 556, 379, 364, 497, 716, 931, 1046, 988, 723, 262, -352,
-    -1047, -1737, -2337, -2781, -3025, -3052, -2868, -2497, -1976, -1348, -658, 41,
-    709, 1312, 1819, 2182, 2352, 2301, 2025, 1543, 904, 181, -544, -1198,
-    -1717, -2042, -2143, -2020, -1704, -1248, -728, -221, 210, 523, 678, 649,
-    427, 40, -453, -969, -1421, -1730, -1837, -1718, -1374, -826, -119, 676,
-    1469, 2172, 2708, 3016, 3074, 2896, 2503, 1928, 1232, 488, -246, -917,
-    -1476, -1893, -2174, -2338, -2411, -2433, -2448, -2480, -2526, -2569, -2578, -2511,
-    -2331, -2017, -1563, -975, -278, 479, 1224, 1876, 2381, 2716, 2897, 2963,
-    2959, 2914, 2837, 2727, 2589, 2421, 2209, 1935, 1577, 1120, 560, -80,
-    -767, -1469, -2162, -2823, -3426, -3933, -4288, -4446, -4388, -4111, -3632, -2994,
-    -2255, -1469, -680, 72, 770, 1417, 2012, 2535, 2962, 3268, 3416, 3368,
-    3111, 2656, 2025, 1254, 390, -513, -1411, -2254, -2996, -3591, -4004, -4213,
-    -4223, -4059, -3752, -3335, -2837, -2283, -1716, -1191, -748, -392, -88, 217,
-    586, 1059, 1635, 2285, 2968, 3628, 4192, 4592, 4771, 4677, 4280, 3599,
-    2686, 1618, 481, -641, -1677, -2574, -3285, -3771, -4008, -3982, -3693, -3175,
-    -2501, -1756, -1018, -341, 263, 829, 1399, 1998, 2629, 3268, 3866, 4363,
-    4710, 4867, 4807, 4524, 4034, 3366, 2559, 1654, 696, -272, -1201, -2039,
-    -2750, -3304, -3665, -3809, -3740, -3479, -3053, -2515, -1935, -1368, -845, -378,
-    40, 438, 845, 1278, 1745, 2252, 2788, 3319, 3797, 4159, 4327, 4234,
-    3838, 3125, 2119, 904, -395, -1645, -2725, -3517, -3932, -3928, -3507, -2716,
-    -1651, -434, 823, 2027, 3096, 3974, 4637, 5077, 5269, 5189, 4840, 4252,
-    3468, 2540, 1528, 483, -561, -1579, -2547, -3435, -4200, -4778, -5094, -5083,
-    -4726, -4057, -3150, -2103, -1009, 58, 1055, 1968, 2788, 3499, 4072, 4478,
-    4686, 4670, 4414, 3920, 3211, 2345, 1410, 503, -290, -889, -1236, -1297,
-    -1080, -632, -39, 566, 1031, 1212, 1010, 410, -505, -1581, -2633, -3475,
-    -3952, -3973, -3525, -2667, -1508, -196, 1101, 2245, 3139, 3714, 3918, 3726,
-    3157, 2259, 1107, -194, -1510, -2703, -3660, -4287, -4528, -4377, -3877, -3097,
-    -2121, -1053, 12, 1003, 1875, 2585, 3108, 3447, 3639, 3729, 3761, 3767,
-    3762, 3740, 3683, 3558, 3312, 2904, 2309, 1526, 567, -518, -1632, -2660,
-    -3491, -4030, -4201, -3966, -3340, -2398, -1260, -69, 1038, 1948, 2588, 2922,
-    2949, 2700, 2236, 1640, 1020, 499, 197, 191, 495, 1061, 1794, 2576,
-    3286, 3824, 4114, 4104, 3775, 3145, 2258, 1178, -4, -1184, -2267, -3179,
-    -3856, -4246, -4323, -4091, -3578, -2828, -1911, -922, 49, 928, 1685, 2317,
-    2837, 3249, 3536, 3670, 3641, 3471, 3204, 2896, 2594, 2317, 2038, 1699,
-    1262, 723, 93, -608, -1336, -2024, -2598, -2987, -3124, -2968, -2535, -1898,
-    -1176, -510, -33, 170, 88, -219, -643, -1055, -1344, -1436, -1317, -1024,
-    -637, -265, -18, 5, -250, -771, -1464, -2176, -2731, -2970, -2792, -2181,
-    -1206, -3, 1269, 2459, 3460, 4205, 4660, 4798, 4605, 4094, 3309, 2323,
-    1218, 77, -1043, -2118, -3139, -4073, -4850, -5384, -5610, -5499, -5065, -4362,
-    -3478, -2512, -1551, -657, 131, 805, 1374, 1857, 2269, 2624, 2935, 3207,
-    3428, 3579, 3632, 3546, 3272, 2785, 2090, 1204, 158, -994, -2167, -3262,
-    -4181, -4828, -5122, -5023, -4552, -3786, -2845, -1864, -958, -192, 426, 932,
-    1386, 1838, 2311, 2806, 3305, 3766, 4124, 4310, 4272, 3982, 3448, 2713,
-    1842, 882, -138, -1183, -2198, -3121, -3901, -4478, -4786, -4777, -4450, -3838,
-    -3010, -2068, -1130, -280, 455, 1080, 1617, 2090, 2513, 2872, 3131, 3265,
-    3258, 3098, 2777, 2318, 1766, 1157, 504, -190, -923, -1704, -2534, -3383,
-    -4193, -4893, -5401, -5628, -5530, -5129, -4501, -3744, -2967, -2266, -1693, -1250,
-    -911, -624, -320, 67, 575, 1202, 1910, 2622, 3249, 3717, 3976, 3986,
-    3729, 3221, 2503, 1628, 649, -381, -1419, -2426, -3341, -4082, -4559, -4703,
-    -4477, -3900, -3032, -1965, -807, 322, 1308, 2068, 2549, 2720, 2568, 2107,
-    1371, 413, -691, -1840, -2919, -3828, -4495, -4886, -5000, -4870, -4551, -4103,
-    -3582, -3045, -2534, -2067, -1630, -1195, -729, -196, 416, 1080, 1751, 2387,
-    2952, 3411, 3741, 3925, 3931, 3727, 3315, 2725, 1996, 1170, 292, -603,
-    -1495, -2354, -3119, -3716, -4076, -4151, -3931, -3458, -2838, -2199, -1664, -1310,
-    -1144, -1111, -1119, -1066, -864, -471, 99, 793, 1551, 2303, 2972, 3499,
-    3854, 4037, 4059, 3944, 3722, 3421, 3054, 2641, 2216, 1826, 1522, 1354,
-    1346, 1473, 1658, 1798, 1791, 1560, 1072, 354, -508, -1387, -2137, -2631,
-    -2786, -2585, -2076, -1360, -570, 159, 723, 1056, 1133, 971, 630, 197,
-    -225, -539, -663, -552, -206, 338, 1023, 1767, 2474, 3055, 3447, 3612,
-    3535, 3221, 2688, 1962, 1076, 82, -957, -1962, -2847, -3520, -3903, -3947,
-    -3642, -3017, -2135, -1091, -1, 1025, 1913, 2626, 3154, 3491, 3635, 3597,
-    3396, 3055, 2602, 2067, 1488, 892, 293, -294, -844, -1324, -1709, -1973,
-    -2100, -2098, -1996, -1829, -1637, -1456, -1304, -1164, -1003, -794, -518, -166,
-    243, 669, 1071, 1415, 1668, 1807, 1826, 1739, 1569, 1360, 1156, 987,
-    865, 787, 732, 675, 613, 564, 551, 598, 717, 894, 1073, 1186,
-    1170, 982, 604, 56, -605, -1312, -2008, -2652, -3230, -3755, -4248, -4718,
-    -5147, -5494, -5699, -5695, -5428, -4875, -4046, -2988, -1791, -573, 537, 1427,
-    2031, 2322, 2313, 2044, 1569, 939, 201, -589, -1360, -2054, -2619, -3010,
-    -3186, -3123, -2824, -2321, -1681, -1014, -455, -124, -113, -464, -1155, -2094,
-    -3130, -4085, -4780, -5074, -4900, -4282, -3314, -2150, -961, 109, 988, 1664,
-    2156, 2499, 2728, 2853, 2853, 2693, 2351, 1830, 1155, 364, -504, -1409,
-    -2308, -3155, -3904, -4491, -4831, -4844, -4493, -3799, -2851, -1788, -748, 175,
-    934, 1526, 1982, 2342, 2632, 2853, 3003, 3075, 3062, 2958, 2767, 2498,
-    2176, 1820, 1436, 993, 448, -230, -1040, -1939, -2852, -3694, -4384, -4849,
-    -5032, -4915, -4514, -3877, -3088, -2251, -1454, -744, -132, 396, 876, 1345,
-    1807, 2247, 2643, 2971, 3184, 3230, 3073, 2704, 2139, 1408, 559, -354,
-    -1273, -2138, -2875, -3393, -3613, -3495, -3041, -2291, -1340, -312, 682, 1565,
-    2289, 2836, 3233, 3525, 3737, 3876, 3941, 3925, 3810, 3592, 3279, 2878,
-    2377, 1766, 1048, 244, -612, -1480, -2307, -3019, -3532, -3769, -3680, -3252,
-    -2531, -1614, -621, 342, 1189, 1864, 2355, 2692, 2932, 3134, 3339, 3549,
-    3725, 3814, 3770, 3573, 3235, 2795, 2279, 1696, 1040, 322, -426, -1160,
-    -1831, -2382, -2768, -2972, -3011, -2927, -2757, -2527, -2245, -1906, -1498, -1025,
-    -503, 49, 614, 1173, 1711, 2213, 2663, 3032, 3288, 3408, 3379, 3202,
-    2896, 2501, 2051, 1576, 1103, 657, 256, -90, -378, -617, -838, -1084,
-    -1388, -1745, -2101, -2356, -2400, -2147, -1574, -726, 291, 1344, 2300, 3059,
-    3572, 3839, 3882, 3725, 3395, 2930, 2371, 1753, 1102, 441, -205, -785,
-    -1228, -1455, -1402, -1043, -407, 430, 1343, 2178, 2779, 3032, 2883, 2326,
-    1414, 257, -996, -2177, -3132, -3730, -3886, -3577, -2831, -1736, -428, 931,
-    2188, 3219, 3931, 4284, 4300, 4036, 3548, 2878, 2064, 1150, 168, -854,
-    -1880, -2868, -3773, -4533, -5060, -5259, -5066, -4481, -3567, -2443, -1248, -104,
-    904, 1714, 2289, 2626, 2748, 2670, 2404, 1985, 1466, 908, 386, -3,
-    -175, -85, 264, 832, 1540, 2284, 2966, 3506, 3848, 3961, 3852, 3554,
-    3103, 2535, 1876, 1130, 284, -676, -1737, -2859, -3963, -4941, -5685, -6113,
-    -6191, -5926, -5368, -4605, -3734, -2838, -1984, -1221, -575, -43, 392, 762,
-    1106, 1465, 1859, 2288, 2739, 3179, 3550, 3803, 3915, 3888, 3740, 3491,
-    3160, 2758, 2296, 1793, 1268, 717, 127, -521, -1243, -2046, -2902, -3748,
-    -4493, -5028, -5258, -5127, -4624, -3791, -2709, -1500, -299, 783, 1673, 2343,
-    2801, 3063, 3142, 3031, 2705, 2131, 1307, 284, -844, -1943, -2860, -3446,
-    -3598, -3273, -2491, -1359, -61, 1179, 2141, 2638, 2552, 1875, 701, -786,
-    -2336, -3672, -4553, -4838, -4504, -3646, -2451, -1128, 155, 1287, 2212, 2931,
-    3482, 3899, 4194, 4360, 4393, 4285, 4032, 3636, 3106, 2442, 1638, 688,
-    -406, -1609, -2855, -4037, -5017, -5660, -5870, -5616, -4927, -3893, -2645, -1320,
-    -36, 1108, 2044, 2747, 3227, 3510, 3630, 3617, 3490, 3248, 2893, 2443,
-    1925, 1361, 763, 139, -504, -1148, -1785, -2422, -3069, -3719, -4361, -4975,
-    -5515, -5915, -6108, -6044, -5688, -5044, -4168, -3157, -2113, -1124, -247, 503,
-    1143, 1702, 2197, 2630, 2993, 3256, 3378, 3316, 3038, 2541, 1861, 1061,
-    210, -629, -1398, -2054, -2567, -2932, -3179, -3370, -3569, -3798, -4030, -4196,
-    -4204, -3970, -3455, -2681, -1721, -687, 296, 1130, 1768, 2216, 2507, 2676,
-    2756, 2760, 2679, 2508, 2239, 1858, 1344, 681, -132, -1074, -2094, -3117,
-    -4071, -4903, -5568, -6017, -6212, -6139, -5814, -5278, -4592, -3823, -3027, -2256,
-    -1553, -944, -434, -9, 353, 662, 907, 1050, 1048, 891, 611, 281,
-    -2, -146, -98, 153, 570, 1072, 1549, 1887, 1979, 1741, 1132, 187,
-    -984, -2205, -3265, -3977, -4223, -3979, -3302, -2315, -1168, -4, 1068, 1964,
-    2629, 3051, 3258, 3296, 3202, 3005, 2715, 2336, 1888, 1414, 956, 535,
-    163, -156, -432, -665, -851, -990, -1101, -1201, -1291, -1366, -1417, -1420,
-    -1352, -1200, -969, -662, -278, 177, 692, 1253, 1823, 2358, 2813, 3143,
-    3313, 3317, 3172, 2899, 2507, 2015, 1443, 816, 158, -502, -1150, -1780,
-    -2367, -2869, -3228, -3388, -3305, -2975, -2430, -1723, -914, -73, 730, 1445,
-    2053, 2544, 2916, 3171, 3310, 3327, 3214, 2965, 2577, 2064, 1455, 796,
-    146, -424, -830, -998, -883, -490, 136, 903, 1680, 2313, 2660, 2623,
-    2164, 1329, 245, -903, -1930, -2675, -3031, -2966, -2526, -1812, -939, -27,
-    828, 1569, 2173, 2633, 2956, 3167, 3289, 3331, 3302, 3214, 3087, 2938,
-    2781, 2617, 2432, 2217, 1979, 1725, 1458, 1183, 900, 592, 233, -200,
-    -723, -1333, -1996, -2643, -3179, -3495, -3490, -3109, -2363, -1333, -146, 1034,
-    2061, 2837, 3320, 3509, 3437, 3158, 2732, 2212, 1652, 1111, 640, 284,
-    88, 78, 251, 563, 937, 1276, 1456, 1370, 964, 256, -672, -1689,
-    -2638, -3377, -3802, -3860, -3558, -2972, -2222, -1436, -710, -105, 366, 727,
-    1020, 1289, 1579, 1922, 2309, 2703, 3061, 3333, 3475, 3477, 3368, 3187,
-    2961, 2707, 2434, 2117, 1713, 1199, 566, -177, -990, -1780, -2416, -2767,
-    -2745, -2331, -1586, -619, 440, 1458, 2327, 2987, 3428, 3671, 3755, 3718,
-    3572, 3316, 2951, 2492, 1945, 1323, 656, -13, -632, -1133, -1433, -1468,
-    -1227, -775, -252, 152, 266, 0, -632, -1506, -2419, -3135, -3469, -3336,
-    -2762, -1871, -833, 199, 1129, 1909, 2529, 3001, 3347, 3572, 3683, 3696,
-    3636, 3507, 3304, 3028, 2668, 2203, 1618, 923, 126, -775, -1757, -2764,
-    -3723, -4540, -5106, -5333, -5188, -4687, -3890, -2904, -1854, -841, 69, 838,
-    1458, 1961, 2382, 2735, 3015, 3214, 3318, 3311, 3204, 3023, 2791, 2528,
-    2250, 1957, 1633, 1262, 827, 302, -325, -1040, -1812, -2606, -3372, -4061,
-    -4630, -5047, -5269, -5261, -5009, -4520, -3819, -2964, -2034, -1096, -196, 632,
-    1374, 2030, 2598, 3054, 3363, 3502, 3467, 3268, 2929, 2483, 1964, 1400,
-    807, 187, -457, -1111, -1750, -2354, -2901, -3364, -3699, -3865, -3826, -3559,
-    -3058, -2352, -1503, -595, 295, 1115, 1850, 2512, 3102, 3595, 3944, 4105,
-    4046, 3770, 3321, 2765, 2174, 1614, 1136, 764, 487, 277, 95, -111,
-    -383, -722, -1094, -1449, -1727, -1862, -1800, -1519, -1029, -381, 346, 1077,
-    1763, 2382, 2936, 3444, 3914, 4333, 4685, 4958, 5135, 5188, 5096, 4842,
-    4420, 3839, 3135, 2352, 1528, 704, -80, -779, -1347, -1738, -1920, -1875,
-    -1601, -1124, -503, 191, 891, 1541, 2099, 2566, 2981, 3377, 3770, 4162,
-    4536, 4856, 5081, 5191, 5175, 5034, 4776, 4411, 3934, 3341, 2647, 1888,
-    1110, 354, -343, -958, -1483, -1906, -2209, -2361, -2333, -2112, -1707, -1148,
-    -482, 229, 922, 1539, 2037, 2382, 2564, 2597, 2499, 2290, 1995, 1640,
-    1236, 779, 270, -288, -883, -1488, -2052, -2518, -2843, -3009, -3014, -2871,
-    -2608, -2258, -1850, -1407, -954, -503, -61, 369, 781, 1166, 1511, 1788,
-    1970, 2039, 1975, 1769, 1422, 956, 412, -151, -661, -1043, -1247, -1250,
-    -1059, -717, -314, 42, 246, 219, -79, -628, -1354, -2147, -2876, -3411,
-    -3657, -3580, -3201, -2589, -1850, -1094, -410, 152, 571, 856, 1036, 1135,
-    1164, 1129, 1037, 897, 722, 526, 322, 118, -84, -298, -541, -835,
-    -1194, -1624, -2124, -2676, -3241, -3758, -4151, -4344, -4290, -3982, -3445, -2736,
-    -1942, -1160, -469, 86, 479, 702, 763, 686, 495, 212, -130, -496,
-    -858, -1185, -1432, -1560, -1552, -1428, -1236, -1048, -937, -967, -1181, -1593,
-    -2181, -2884, -3632, -4339, -4906, -5243, -5302, -5070, -4579, -3900, -3125, -2340,
-    -1604, -954, -411, 20, 333, 516, 562, 482, 297, 33, -279, -623,
-    -1003, -1420, -1866, -2336, -2832, -3348, -3865, -4355, -4784, -5107, -5293, -5328,
-    -5203, -4905, -4433, -3806, -3059, -2254, -1472, -780, -203, 251, 586, 819,
-    962, 1007, 943, 781, 549, 281, 21, -173, -259, -223, -71, 145,
-    345, 434, 352, 73, -402, -1036, -1760, -2487, -3126, -3593, -3809, -3723,
-    -3326, -2663, -1817, -889, 12, 786, 1367, 1729, 1887, 1872, 1722, 1468,
-    1130, 724, 278, -165, -556, -850, -1012, -1020, -886, -664, -452, -361,
-    -486, -886, -1559, -2433, -3386, -4279, -4968, -5328, -5283, -4830, -4030, -2992,
-    -1873, -832, 23, 656, 1072, 1304, 1401, 1415, 1383, 1326, 1249, 1135,
-    966, 745, 482, 176, -180, -583, -1037, -1545, -2109, -2721, -3374, -4055,
-    -4715, -5267, -5612, -5662, -5381, -4805, -4029, -3175, -2352, -1628, -1027, -536,
-    -114, 282, 680, 1081, 1456, 1754, 1921, 1929, 1792, 1548, 1235, 871,
-    456, -21, -566, -1172, -1830, -2536, -3268, -3972, -4570, -4974, -5096, -4876,
-    -4321, -3500, -2518, -1485, -502, 364, 1076, 1624, 2026, 2314, 2509, 2602,
-    2569, 2396, 2075, 1613, 1035, 378, -324, -1040, -1721, -2316, -2769, -3029,
-    -3065, -2877, -2489, -1936, -1257, -498, 292, 1067, 1785, 2423, 2978, 3463,
-    3890, 4261, 4561, 4757, 4834, 4789, 4638, 4404, 4124, 3828, 3518, 3171,
-    2761, 2264, 1673, 1014, 350, -246, -700, -939, -914, -624, -109, 565,
-    1315, 2050, 2679, 3144, 3433, 3585, 3674, 3774, 3943, 4219, 4616, 5112,
-    5655, 6176, 6592, 6816, 6785, 6472, 5891, 5084, 4127, 3119, 2159, 1330,
-    682, 237, -21, -116, -79, 71, 332, 698, 1144, 1616, 2046, 2387,
-    2614, 2737, 2798, 2849, 2933, 3070, 3267, 3518, 3795, 4064, 4290, 4455,
-    4544, 4548, 4465, 4297, 4052, 3738, 3366, 2935, 2460, 1984, 1573, 1289,
-    1178, 1262, 1538, 1969, 2494, 3048, 3570, 4011, 4334, 4515, 4554, 4466,
-    4281, 4041, 3792, 3569, 3399, 3298, 3271, 3296, 3322, 3301, 3202, 3004,
-    2696, 2290, 1821, 1320, 829, 402, 95, -58, -48, 122, 434, 854,
-    1344, 1862, 2354, 2761, 3041, 3162, 3106, 2881, 2529, 2104, 1658, 1245,
-    922, 734, 706, 842, 1116, 1457, 1768, 1942, 1894, 1585, 1046, 367,
-    -331, -932, -1336, -1480, -1347, -953, -346, 394, 1172, 1896, 2489, 2888,
-    3054, 2980, 2675, 2163, 1488, 711, -104, -896, -1595, -2129, -2442, -2509,
-    -2331, -1944, -1422, -860, -347, 49, 295, 394, 388, 346, 340, 431,
-    653, 1008, 1461, 1946, 2386, 2711, 2862, 2799, 2510, 2017, 1360, 584,
-    -257, -1100, -1879, -2514, -2920, -3025, -2805, -2293, -1565, -737, 69, 744,
-    1221, 1456, 1426, 1121, 559, -218, -1140, -2110, -3013, -3729, -4144, -4186,
-    -3850, -3197, -2347, -1478, -784, -423, -477, -962, -1823, -2911, -4012, -4906,
-    -5423, -5453, -4980, -4092, -2959, -1787, -763, -42, 291, 231, -152, -757,
-    -1479, -2234, -2968, -3658, -4301, -4899, -5455, -5957, -6386, -6723, -6962, -7114,
-    -7203, -7265, -7330, -7398, -7430, -7368, -7146, -6715, -6070, -5251, -4331, -3395,
-    -2532, -1820, -1318, -1054, -1035, -1260, -1715, -2364, -3157, -4021, -4887, -5704,
-    -6439, -7057, -7518, -7787, -7831, -7625, -7186, -6588, -5959, -5429, -5102, -5029,
-    -5190, -5498, -5820, -6041, -6094, -5958, -5645, -5202, -4698, -4193, -3723, -3307,
-    -2960, -2680, -2450, -2256, -2097, -1977, -1889, -1818, -1736, -1607, -1394, -1078,
-    -657, -150, 393, 899, 1299, 1548, 1628, 1555, 1374, 1136, 874, 598,
-    306, -7, -349, -728, -1144, -1598, -2087, -2600, -3112, -3594, -4029, -4408,
-    -4723, -4970, -5140, -5216, -5176, -4997, -4662, -4155, -3471, -2637, -1719, -812,
-    -12, 598, 965, 1079, 969, 682, 268, -221, -735, -1237, -1705, -2123,
-    -2468, -2705, -2785, -2655, -2281, -1669, -856, 89, 1068, 1965, 2668, 3088,
-    3165, 2889, 2311, 1518, 613, -283, -1048, -1572, -1786, -1660, -1220, -553,
-    225, 1015, 1750, 2391, 2914, 3321, 3640, 3911, 4179, 4469, 4770, 5046,
-    5259, 5390, 5437, 5404, 5299, 5126, 4870, 4509, 4034, 3465, 2838, 2199,
-    1618, 1177, 951, 985, 1288, 1827, 2529, 3301, 4060, 4743, 5289, 5660,
-    5835, 5811, 5598, 5218, 4712, 4134, 3557, 3078, 2784, 2730, 2922, 3324,
-    3867, 4455, 4975, 5321, 5412, 5202, 4695, 3953, 3088, 2228, 1489, 958,
-    696, 724, 1025, 1557, 2256, 3034, 3794, 4459, 4989, 5376, 5637, 5801,
-    5885, 5892, 5829, 5716, 5575, 5428, 5283, 5145, 5013, 4873, 4705, 4491,
-    4217, 3866, 3423, 2882, 2257, 1584, 916, 333, -72, -235, -122, 259,
-    858, 1581, 2322, 2980, 3479, 3777, 3874, 3791, 3558, 3228, 2872, 2550,
-    2305, 2169, 2160, 2258, 2415, 2574, 2676, 2670, 2529, 2242, 1808, 1244,
-    584, -142, -922, -1735, -2551, -3342, -4070, -4676, -5102, -5310, -5281, -5011,
-    -4527, -3883, -3148, -2398, -1707, -1121, -638, -235, 99, 364, 549, 624,
-    562, 359, 36, -374, -831, -1288, -1719, -2118, -2500, -2883, -3293, -3755,
-    -4282, -4870, -5502, -6146, -6757, -7276, -7647, -7824, -7785, -7552, -7188, -6774,
-    -6361, -5960, -5567, -5157, -4695, -4161, -3565, -2920, -2236, -1540, -884, -323,
-    92, 317, 332, 162, -147, -556, -1040, -1568, -2103, -2607, -3037, -3362,
-    -3561, -3636, -3612, -3539, -3474, -3482, -3622, -3926, -4360, -4836, -5254, -5512,
-    -5528, -5273, -4786, -4126, -3346, -2516, -1723, -1036, -496, -134, 38, 42,
-    -80, -295, -583, -923, -1299, -1693, -2072, -2404, -2669, -2869, -3033, -3206,
-    -3430, -3710, -4008, -4256, -4372, -4277, -3943, -3408, -2768, -2152, -1691, -1493,
-    -1615, -2051, -2726, -3507, -4242, -4788, -5028, -4896, -4411, -3653, -2731, -1753,
-    -821, -17, 624, 1097, 1395, 1510, 1442, 1205, 819, 330, -184, -627,
-    -910, -955, -713, -182, 577, 1461, 2341, 3088, 3588, 3770, 3619, 3169,
-    2495, 1715, 970, 398, 106, 141, 481, 1042, 1715, 2395, 3007, 3517,
-    3926, 4254, 4518, 4733, 4913, 5057, 5161, 5225, 5248, 5225, 5155, 5046,
-    4908, 4748, 4583, 4431, 4297, 4158, 3990, 3774, 3508, 3210, 2927, 2719,
-    2649, 2766, 3092, 3600, 4221, 4876, 5490, 6007, 6392, 6639, 6771, 6812,
-    6784, 6701, 6577, 6413, 6195, 5909, 5549, 5131, 4684, 4257, 3907, 3685,
-    3625, 3737, 4016, 4430, 4927, 5437, 5890, 6235, 6448, 6523, 6466, 6293,
-    6030, 5703, 5329, 4916, 4463, 3962, 3382, 2690, 1882, 1002, 138, -597,
-    -1089, -1246, -1037, -496, 290, 1207, 2130, 2939, 3541, 3893, 4000, 3900,
-    3643, 3282, 2858, 2388, 1871, 1308, 700, 39, -697, -1522, -2423, -3363,
-    -4278, -5063, -5597, -5783, -5582, -5014, -4161, -3155, -2140, -1223, -468, 101,
-    497, 758, 918, 990, 979, 882, 691, 389, -32, -557, -1152, -1781,
-    -2436, -3137, -3905, -4743, -5623, -6484, -7220, -7713, -7869, -7640, -7027, -6085,
-    -4929, -3697, -2511, -1464, -617, 7, 430, 681, 778, 732, 568, 320,
-    20, -310, -649, -983, -1319, -1683, -2101, -2591, -3160, -3796, -4459, -5082,
-    -5582, -5855, -5789, -5307, -4403, -3158, -1748, -414, 599, 1118, 1068, 483,
-    -497, -1667, -2823, -3827, -4615, -5204, -5673, -6107, -6554, -7028, -7524, -8012,
-    -8439, -8749, -8888, -8794, -8425, -7794, -6953, -5958, -4863, -3714, -2552, -1420,
-    -370, 538, 1251, 1724, 1919, 1819, 1414, 726, -194, -1253, -2355, -3419,
-    -4372, -5144, -5665, -5867, -5702, -5161, -4284, -3140, -1831, -475, 826, 1995,
-    2977, 3735, 4256, 4532, 4546, 4286, 3764, 3012, 2083, 1056, 24, -929,
-    -1736, -2343, -2708, -2822, -2698, -2369, -1883, -1290, -619, 102, 842, 1572,
-    2272, 2922, 3507, 4035, 4522, 4967, 5352, 5654, 5836, 5854, 5675, 5290,
-    4717, 4002, 3233, 2520, 1979, 1711, 1780, 2185, 2853, 3670, 4511, 5277,
-    5900, 6334, 6545, 6512, 6228, 5709, 5022, 4283, 3633, 3212, 3121, 3396,
-    3980, 4754, 5576, 6309, 6856, 7180, 7294, 7219, 6971, 6560, 5982, 5236,
-    4362, 3452, 2623, 1987, 1649, 1669, 2014, 2563, 3149, 3593, 3743, 3521,
-    2953, 2150, 1282, 553, 143, 162, 619, 1417, 2388, 3344, 4141, 4692,
-    4973, 5007, 4833, 4477, 3961, 3316, 2576, 1766, 917, 52, -832, -1753,
-    -2702, -3645, -4524, -5256, -5735, -5879, -5663, -5119, -4339, -3450, -2576, -1802,
-    -1161, -646, -208, 206, 623, 1032, 1402, 1689, 1841, 1827, 1637, 1278,
-    780, 185, -472, -1163, -1868, -2584, -3327, -4094, -4838, -5488, -5972, -6218,
-    -6171, -5830, -5249, -4508, -3699, -2931, -2301, -1847, -1566, -1451, -1485, -1630,
-    -1846, -2102, -2363, -2579, -2712, -2759, -2747, -2724, -2746, -2866, -3114, -3491,
-    -3978, -4538, -5125, -5699, -6240, -6740, -7189, -7572, -7868, -8040, -8053, -7897,
-    -7600, -7187, -6681, -6115, -5515, -4892, -4245, -3585, -2926, -2269, -1613, -965,
-    -337, 259, 792, 1220, 1519, 1690, 1751, 1728, 1659, 1578, 1501, 1427,
-    1343, 1225, 1054, 816, 491, 61, -480, -1112, -1802, -2493, -3092, -3486,
-    -3586, -3348, -2786, -1971, -1013, -26, 905, 1720, 2398, 2958, 3432, 3845,
-    4215, 4551, 4844, 5066, 5201, 5257, 5253, 5209, 5133, 5026, 4873, 4651,
-    4346, 3960, 3509, 3023, 2546, 2137, 1856, 1749, 1845, 2162, 2692, 3387,
-    4174, 4972, 5701, 6297, 6719, 6944, 6942, 6692, 6193, 5472, 4575, 3573,
-    2562, 1629, 848, 282, -9, 9, 331, 904, 1628, 2382, 3063, 3605,
-    3968, 4150, 4187, 4134, 4037, 3942, 3891, 3904, 3980, 4127, 4339, 4580,
-    4790, 4916, 4920, 4782, 4512, 4144, 3709, 3226, 2709, 2173, 1627, 1091,
-    597, 173, -165, -407, -547, -613, -677, -830, -1155, -1692, -2408, -3200,
-    -3920, -4408, -4538, -4251, -3584, -2659, -1647, -731, -58, 288, 296, 25,
-    -431, -981, -1560, -2138, -2720, -3318, -3914, -4443, -4808, -4911, -4692, -4173,
-    -3481, -2810, -2353, -2263, -2625, -3442, -4623, -6006, -7393, -8599, -9466, -9882,
-    -9783, -9171, -8108, -6699, -5077, -3403, -1839, -513, 496, 1142, 1391, 1236,
-    697, -179, -1309, -2568, -3804, -4861, -5608, -5958, -5890, -5462, -4811, -4126,
-    -3585, -3310, -3341, -3628, -4049, -4447, -4674, -4610, -4198, -3470, -2537, -1536,
-    -579, 257, 951, 1533, 2042, 2488, 2858, 3122, 3245, 3195, 2958, 2525,
-    1896, 1099, 190, -764, -1687, -2482, -3046, -3295, -3175, -2683, -1885, -902,
-    138, 1133, 2017, 2770, 3409, 3959, 4436, 4845, 5170, 5385, 5460, 5384,
-    5157, 4805, 4382, 3950, 3567, 3287, 3161, 3210, 3414, 3723, 4061, 4337,
-    4472, 4418, 4156, 3679, 2996, 2142, 1184, 220, -623, -1226, -1497, -1395,
-    -937, -201, 705, 1662, 2562, 3335, 3958, 4442, 4810, 5079, 5250, 5315,
-    5266, 5104, 4839, 4479, 4027, 3481, 2834, 2083, 1246, 347, -594, -1566,
-    -2545, -3490, -4342, -5021, -5437, -5506, -5189, -4502, -3510, -2318, -1043, 197,
-    1316, 2260, 2995, 3513, 3828, 3958, 3902, 3650, 3200, 2569, 1783, 886,
-    -63, -1016, -1951, -2844, -3651, -4318, -4786, -5011, -4982, -4735, -4324, -3803,
-    -3209, -2565, -1890, -1206, -540, 75, 598, 966, 1117, 1007, 621, -13,
-    -811, -1654, -2443, -3117, -3644, -4014, -4237, -4320, -4249, -4015, -3636, -3163,
-    -2689, -2334, -2220, -2437, -3025, -3945, -5071, -6228, -7248, -7988, -8344, -8274,
-    -7788, -6931, -5778, -4431, -2997, -1587, -312, 725, 1473, 1914, 2045, 1873,
-    1439, 795, -15, -938, -1893, -2792, -3543, -4060, -4280, -4188, -3819, -3245,
-    -2569, -1900, -1318, -886, -635, -552, -586, -670, -729, -684, -484, -133,
-    335, 887, 1491, 2109, 2717, 3295, 3813, 4242, 4574, 4830, 5032, 5194,
-    5326, 5432, 5504, 5523, 5472, 5322, 5022, 4520, 3798, 2902, 1927, 995,
-    240, -221, -326, -76, 488, 1286, 2205, 3126, 3965, 4690, 5299, 5805,
-    6222, 6552, 6787, 6922, 6963, 6925, 6823, 6666, 6452, 6179, 5851, 5469,
-    5024, 4506, 3909, 3241, 2527, 1805, 1109, 453, -148, -674, -1095, -1367,
-    -1429, -1234, -764, -35, 902, 1953, 2991, 3906, 4622, 5102, 5343, 5371,
-    5208, 4855, 4308, 3584, 2722, 1786, 868, 72, -516, -834, -862, -643,
-    -294, 29, 167, -10, -568, -1465, -2548, -3585, -4323, -4538, -4109, -3070,
-    -1603, 31, 1561, 2764, 3490, 3662, 3264, 2351, 1070, -347, -1624, -2508,
-    -2830, -2554, -1803, -821, 86, 631, 597, -109, -1434, -3189, -5105, -6905,
-    -8364, -9331, -9714, -9465, -8592, -7167, -5340, -3348, -1490, -68, 681, 634,
-    -184, -1607, -3386, -5263, -7015, -8472, -9524, -10119, -10246, -9921, -9194, -8164,
-    -6956, -5682, -4437, -3295, -2304, -1465, -754, -137, 412, 894, 1275, 1494,
-    1502, 1297, 921, 435, -133, -798, -1581, -2459, -3353, -4137, -4669, -4833,
-    -4584, -3949, -3002, -1857, -644, 526, 1584, 2495, 3259, 3917, 4513, 5054,
-    5514, 5870, 6097, 6154, 6005, 5631, 5027, 4209, 3235, 2189, 1144, 165,
-    -681, -1336, -1768, -1961, -1927, -1705, -1350, -896, -368, 204, 798, 1400,
-    1980, 2502, 2956, 3355, 3720, 4073, 4423, 4750, 4999, 5095, 4953, 4492,
-    3697, 2640, 1465, 353, -485, -866, -693, 16, 1144, 2494, 3827, 4940,
-    5706, 6076, 6064, 5749, 5254, 4701, 4203, 3842, 3646, 3575, 3544, 3444,
-    3158, 2603, 1759, 659, -624, -1970, -3235, -4295, -5058, -5456, -5459, -5098,
-    -4457, -3659, -2863, -2237, -1886, -1817, -1976, -2284, -2658, -3036, -3397, -3745,
-    -4075, -4375, -4646, -4875, -5020, -5024, -4853, -4488, -3927, -3209, -2405, -1587,
-    -807, -117, 430, 792, 949, 901, 677, 317, -146, -696, -1312, -1966,
-    -2655, -3388, -4162, -4961, -5738, -6406, -6846, -6957, -6697, -6077, -5162, -4060,
-    -2891, -1755, -735, 100, 722, 1140, 1391, 1518, 1571, 1589, 1591, 1587,
-    1577, 1540, 1445, 1262, 977, 601, 187, -185, -436, -495, -302, 168,
-    887, 1799, 2837, 3910, 4909, 5737, 6335, 6669, 6745, 6623, 6386, 6101,
-    5815, 5552, 5317, 5086, 4837, 4546, 4170, 3666, 3009, 2217, 1346, 495,
-    -215, -673, -794, -528, 123, 1090, 2241, 3412, 4444, 5209, 5624, 5656,
-    5312, 4625, 3649, 2473, 1223, 55, -877, -1439, -1538, -1147, -313, 833,
-    2093, 3236, 4038, 4335, 4050, 3201, 1897, 311, -1351, -2865, -4014, -4629,
-    -4643, -4096, -3125, -1924, -711, 352, 1196, 1845, 2372, 2865, 3386, 3936,
-    4448, 4827, 4978, 4830, 4365, 3617, 2665, 1601, 515, -524, -1475, -2332,
-    -3119, -3882, -4670, -5511, -6390, -7251, -7998, -8497, -8612, -8258, -7422, -6156,
-    -4570, -2841, -1184, 194, 1127, 1502, 1290, 555, -576, -1950, -3414, -4825,
-    -6049, -6962, -7438, -7387, -6803, -5790, -4550, -3360, -2520, -2264, -2678, -3689,
-    -5086, -6569, -7814, -8556, -8649, -8090, -6998, -5578, -4060, -2641, -1448, -518,
-    190, 742, 1191, 1550, 1794, 1870, 1723, 1330, 715, -39, -802, -1422,
-    -1769, -1770, -1427, -827, -116, 557, 1102, 1501, 1808, 2118, 2529, 3093,
-    3806, 4613, 5430, 6174, 6782, 7203, 7387, 7288, 6873, 6127, 5078, 3821,
-    2522, 1388, 628, 410, 800, 1740, 3056, 4494, 5763, 6597, 6808, 6317,
-    5161, 3493, 1573, -276, -1735, -2559, -2630, -1983, -784, 716, 2256, 3623,
-    4692, 5426, 5865, 6083, 6158, 6143, 6066, 5917, 5669, 5301, 4814, 4230,
-    3568, 2846, 2081, 1279, 436, -442, -1321, -2149, -2865, -3403, -3680, -3614,
-    -3160, -2327, -1193, 89, 1299, 2201, 2618, 2487, 1848, 832, -363, -1532,
-    -2514, -3215, -3608, -3726, -3652, -3484, -3309, -3181, -3132, -3183, -3356, -3675,
-    -4157, -4791, -5529, -6287, -6959, -7433, -7627, -7496, -7018, -6202, -5097, -3801,
-    -2437, -1142, -70, 617, 791, 397, -533, -1885, -3463, -5015, -6296, -7129,
-    -7419, -7151, -6385, -5243, -3886, -2481, -1169, -46, 858, 1570, 2140, 2611,
-    2997, 3276, 3404, 3343, 3087, 2661, 2117, 1522, 949, 471, 148, 16,
-    87, 348, 760, 1280, 1885, 2564, 3301, 4084, 4900, 5718, 6477, 7103,
-    7537, 7721, 7599, 7148, 6383, 5348, 4110, 2774, 1485, 398, -343, -626,
-    -396, 325, 1432, 2751, 4099, 5327, 6337, 7076, 7538, 7754, 7760, 7588,
-    7287, 6920, 6549, 6224, 5973, 5785, 5618, 5428, 5173, 4800, 4261, 3541,
-    2637, 1558, 342, -925, -2134, -3172, -3917, -4251, -4100, -3458, -2385, -1014,
-    470, 1868, 3004, 3744, 4011, 3800, 3172, 2241, 1164, 101, -827, -1560,
-    -2097, -2489, -2825, -3200, -3691, -4348, -5188, -6187, -7269, -8313, -9179, -9726,
-    -9836, -9439, -8542, -7242, -5695, -4090, -2623, -1469, -758, -571, -929, -1781,
-    -2989, -4345, -5591, -6479, -6836, -6608, -5848, -4696, -3337, -1960, -712, 283,
-    903, 1048, 672, -217, -1534, -3098, -4674, -6026, -6956, -7324, -7097, -6348,
-    -5212, -3855, -2459, -1177, -88, 803, 1533, 2172, 2787, 3400, 3987, 4513,
-    4950, 5264, 5422, 5411, 5215, 4808, 4174, 3317, 2265, 1092, -74, -1078,
-    -1775, -2049, -1844, -1197, -230, 900, 2035, 3048, 3862, 4469, 4905, 5231,
-    5495, 5719, 5889, 5973, 5929, 5716, 5312, 4707, 3892, 2862, 1644, 300,
-    -1091, -2422, -3561, -4382, -4801, -4777, -4321, -3520, -2520, -1485, -566, 129,
-    565, 784, 879, 960, 1128, 1446, 1928, 2536, 3199, 3829, 4348, 4703,
-    4860, 4806, 4547, 4107, 3529, 2869, 2186, 1534, 968, 526, 215, 9,
-    -131, -256, -438, -747, -1214, -1859, -2692, -3684, -4747, -5778, -6679, -7365,
-    -7795, -8000, -8041, -7939, -7689, -7276, -6682, -5890, -4935, -3906, -2904, -2018,
-    -1330, -902, -747, -834, -1112, -1520, -1987, -2460, -2919, -3383, -3897, -4514,
-    -5263, -6137, -7079, -7988, -8730, -9175, -9237, -8886, -8146, -7086, -5798, -4393,
-    -2990, -1710, -635, 206, 838, 1323, 1741, 2155, 2580, 2957, 3170, 3086,
-    2622, 1772, 641, -583, -1683, -2472, -2837, -2742, -2241, -1438, -440, 667,
-    1808, 2921, 3970, 4925, 5742, 6371, 6788, 6996, 7012, 6882, 6671, 6436,
-    6196, 5948, 5670, 5315, 4824, 4152, 3290, 2261, 1126, -27, -1103, -1997,
-    -2603, -2836, -2655, -2075, -1154, -3, 1246, 2469, 3584, 4558, 5392, 6094,
-    6671, 7113, 7391, 7466, 7314, 6940, 6374, 5660, 4857, 4023, 3192, 2391,
-    1644, 983, 422, -41, -431, -801, -1218, -1732, -2363, -3101, -3901, -4680,
-    -5342, -5803, -6003, -5920, -5586, -5074, -4472, -3872, -3363, -3006, -2814, -2757,
-    -2795, -2877, -2945, -2954, -2882, -2713, -2446, -2106, -1753, -1453, -1260, -1207,
-    -1300, -1516, -1817, -2160, -2492, -2751, -2879, -2844, -2638, -2277, -1797, -1242,
-    -656, -79, 435, 817, 994, 916, 586, 69, -529, -1080, -1462, -1568,
-    -1341, -782, 60, 1094, 2202, 3260, 4162, 4825, 5181, 5197, 4877, 4268,
-    3456, 2566, 1762, 1211, 1045, 1332, 2055, 3109, 4319, 5482, 6413, 6970,
-    7078, 6726, 5961, 4877, 3604, 2289, 1090, 161, -369, -414, 34, 873,
-    1884, 2772, 3248, 3123, 2378, 1173, -205, -1427, -2215, -2409, -1996, -1099,
-    62, 1224, 2160, 2727, 2891, 2719, 2352, 1949, 1635, 1485, 1530, 1769,
-    2172, 2689, 3252, 3762, 4113, 4221, 4049, 3605, 2938, 2122, 1233, 312,
-    -634, -1613, -2607, -3540, -4279, -4672, -4602, -4039, -3056, -1813, -507, 668,
-    1569, 2130, 2351, 2274, 1950, 1434, 773, 7, -816, -1639, -2409, -3082,
-    -3627, -4037, -4351, -4636, -4960, -5387, -5968, -6708, -7550, -8392, -9114, -9578,
-    -9653, -9255, -8371, -7063, -5465, -3787, -2262, -1093, -399, -206, -452, -1018,
-    -1766, -2581, -3385, -4133, -4807, -5411, -5959, -6460, -6892, -7204, -7328, -7204,
-    -6801, -6128, -5236, -4206, -3124, -2060, -1064, -169, 624, 1338, 2000, 2630,
-    3233, 3794, 4272, 4605, 4736, 4626, 4268, 3710, 3065, 2491, 2151, 2156,
-    2538, 3222, 4040, 4760, 5147, 5031, 4344, 3139, 1575, -102, -1607, -2698,
-    -3213, -3097, -2405, -1296, 25, 1371, 2603, 3643, 4489, 5196, 5820, 6394,
-    6924, 7391, 7749, 7961, 8020, 7945, 7746, 7421, 6964, 6368, 5618, 4717,
-    3692, 2582, 1419, 219, -1010, -2253, -3454, -4498, -5227, -5500, -5238, -4459,
-    -3266, -1823, -321, 1078, 2265, 3172, 3757, 4000, 3908, 3518, 2898, 2137,
-    1323, 526, -230, -970, -1738, -2561, -3445, -4376, -5307, -6160, -6854, -7318,
-    -7478, -7267, -6670, -5737, -4558, -3255, -1971, -817, 163, 964, 1584, 2035,
-    2334, 2471, 2421, 2181, 1772, 1222, 571, -123, -817, -1502, -2176, -2825,
-    -3423, -3918, -4224, -4263, -4002, -3447, -2637, -1647, -571, 519, 1571, 2539,
-    3394, 4137, 4775, 5299, 5688, 5907, 5903, 5627, 5052, 4198, 3127, 1950,
-    811, -140, -782, -1043, -895, -367, 444, 1374, 2250, 2919, 3277, 3291,
-    3020, 2585, 2119, 1735, 1523, 1533, 1769, 2210, 2819, 3534, 4268, 4942,
-    5490, 5864, 6041, 6035, 5878, 5597, 5207, 4713, 4112, 3407, 2616, 1788,
-    998, 315, -236, -682, -1062, -1401, -1706, -1955, -2093, -2055, -1796, -1304,
-    -596, 273, 1218, 2141, 2947, 3547, 3877, 3912, 3667, 3199, 2597, 1962,
-    1377, 895, 532, 252, -6, -300, -672, -1152, -1736, -2381, -3037, -3672,
-    -4265, -4811, -5331, -5860, -6416, -7002, -7617, -8241, -8826, -9309, -9631, -9735,
-    -9600, -9259, -8788, -8259, -7725, -7212, -6716, -6218, -5697, -5142, -4550, -3931,
-    -3317, -2753, -2297, -2004, -1900, -1974, -2188, -2502, -2879, -3290, -3716, -4139,
-    -4531, -4843, -5015, -4981, -4683, -4094, -3234, -2179, -1044, 67, 1077, 1944,
-    2636, 3134, 3422, 3484, 3322, 2981, 2546, 2111, 1773, 1612, 1666, 1928,
-    2359, 2883, 3375, 3686, 3693, 3334, 2614, 1627, 547, -415, -1072, -1296,
-    -1034, -321, 736, 1970, 3196, 4251, 5017, 5430, 5488, 5244, 4785, 4208,
-    3623, 3147, 2893, 2936, 3297, 3916, 4650, 5314, 5745, 5836, 5549, 4910,
-    3991, 2874, 1641, 373, -857, -2004, -3028, -3881, -4514, -4876, -4915, -4603,
-    -3976, -3117, -2132, -1126, -196, 600, 1244, 1725, 2034, 2174, 2152, 1978,
-    1684, 1314, 916, 529, 181, -130, -451, -835, -1313, -1895, -2572, -3295,
-    -3995, -4610, -5086, -5359, -5378, -5126, -4611, -3860, -2940, -1947, -976, -111,
-    578, 1046, 1277, 1267, 1027, 583, -18, -714, -1423, -2042, -2479, -2669,
-    -2581, -2230, -1672, -992, -292, 311, 714, 867, 780, 504, 122, -261,
-    -540, -649, -555, -263, 188, 731, 1291, 1805, 2227, 2547, 2776, 2934,
-    3044, 3138, 3246, 3399, 3618, 3907, 4237, 4557, 4813, 4965, 4991, 4890,
-    4665, 4310, 3825, 3217, 2517, 1778, 1075, 487, 68, -138, -102, 173,
-    649, 1267, 1946, 2588, 3120, 3519, 3793, 3956, 4020, 3985, 3828, 3525,
-    3092, 2580, 2049, 1560, 1169, 902, 758, 719, 752, 793, 767, 612,
-    300, -156, -690, -1195, -1551, -1669, -1506, -1073, -428, 333, 1101, 1772,
-    2259, 2503, 2472, 2183, 1684, 1025, 249, -599, -1486, -2399, -3332, -4262,
-    -5163, -6014, -6776, -7379, -7752, -7854, -7675, -7245, -6650, -5993, -5350, -4753,
-    -4203, -3682, -3168, -2661, -2190, -1793, -1508, -1375, -1415, -1636, -2026, -2565,
-    -3213, -3913, -4604, -5235, -5771, -6185, -6459, -6579, -6530, -6301, -5897, -5347,
-    -4696, -3998, -3294, -2611, -1953, -1319, -712, -136, 414, 941, 1440, 1893,
-    2282, 2576, 2742, 2752, 2608, 2330, 1954, 1546, 1199, 1003, 1015, 1237,
-    1621, 2101, 2613, 3111, 3569, 3976, 4318, 4565, 4696, 4706, 4598, 4367,
-    4001, 3490, 2843, 2100, 1342, 672, 195, 3, 158, 677, 1522, 2607,
-    3800, 4953, 5929, 6638, 7037, 7116, 6881, 6349, 5551, 4541, 3399, 2220,
-    1096, 102, -729, -1400, -1934, -2359, -2705, -2996, -3243, -3454, -3639, -3792,
-    -3886, -3888, -3776, -3533, -3169, -2726, -2263, -1819, -1407, -1034, -705, -434,
-    -239, -144, -157, -263, -440, -670, -938, -1239, -1582, -1976, -2422, -2914,
-    -3445, -3994, -4522, -4973, -5292, -5427, -5336, -4997, -4433, -3698, -2871, -2041,
-    -1279, -616, -50, 437, 850, 1189, 1448, 1627, 1741, 1821, 1897, 1994,
-    2125, 2274, 2407, 2480, 2460, 2327, 2095, 1816, 1557, 1383, 1342, 1460,
-    1738, 2170, 2742, 3418, 4122, 4769, 5285, 5620, 5759, 5730, 5577, 5339,
-    5041, 4709, 4366, 4046, 3800, 3688, 3743, 3969, 4342, 4808, 5299, 5758,
-    6137, 6387, 6458, 6313, 5927, 5290, 4433, 3410, 2277, 1084, -112, -1234,
-    -2185, -2843, -3095, -2880, -2211, -1177, 90, 1443, 2754, 3928, 4897, 5621,
-    6075, 6245, 6125, 5722, 5055, 4164, 3114, 1983, 854, -179, -1017, -1575,
-    -1794, -1648, -1178, -529, 79, 429, 369, -172, -1156, -2447, -3867, -5261,
-    -6498, -7470, -8094, -8307, -8057, -7320, -6138, -4647, -3068, -1673, -732, -448,
-    -915, -2075, -3735, -5629, -7486, -9068, -10206, -10821, -10919, -10553, -9812, -8819,
-    -7710, -6608, -5615, -4790, -4121, -3534, -2951, -2321, -1611, -822, 12, 837,
-    1602, 2255, 2738, 3014, 3061, 2852, 2373, 1640, 695, -387, -1494, -2470,
-    -3157, -3432, -3235, -2586, -1578, -366, 884, 2036, 3020, 3826, 4479, 5018,
-    5480, 5876, 6192, 6412, 6531, 6547, 6451, 6242, 5909, 5437, 4817, 4069,
-    3217, 2275, 1252, 166, -957, -2064, -3056, -3801, -4170, -4076, -3498, -2498,
-    -1204, 224, 1626, 2871, 3879, 4614, 5065, 5224, 5070, 4560, 3664, 2399,
-    848, -862, -2559, -4043, -5135, -5714, -5734, -5243, -4390, -3394, -2487, -1876,
-    -1704, -2002, -2668, -3509, -4299, -4820, -4915, -4527, -3709, -2580, -1302, -51,
-    1016, 1785, 2180, 2166, 1764, 1046, 125, -855, -1750, -2466, -2971, -3280,
-    -3441, -3525, -3599, -3703, -3866, -4112, -4426, -4737, -4947, -4969, -4744, -4254,
-    -3549, -2725, -1869, -1040, -286, 365, 923, 1407, 1828, 2190, 2513, 2815,
-    3106, 3398, 3696, 3981, 4215, 4373, 4442, 4421, 4304, 4077, 3721, 3219,
-    2578, 1840, 1068, 355, -195, -497, -508, -236, 260, 892, 1576, 2260,
-    2915, 3537, 4131, 4693, 5196, 5615, 5950, 6218, 6424, 6569, 6651, 6658,
-    6574, 6406, 6194, 5972, 5741, 5466, 5093, 4565, 3835, 2899, 1803, 632,
-    -509, -1514, -2275, -2702, -2730, -2349, -1606, -609, 512, 1629, 2641, 3483,
-    4141, 4639, 5001, 5244, 5386, 5449, 5445, 5388, 5293, 5155, 4953, 4666,
-    4288, 3811, 3226, 2543, 1782, 960, 95, -784, -1654, -2505, -3301, -3968,
-    -4435, -4667, -4664, -4466, -4167, -3884, -3700, -3663, -3799, -4118, -4598, -5201,
-    -5887, -6617, -7355, -8070, -8726, -9284, -9710, -9985, -10090, -10009, -9727, -9244,
-    -8569, -7731, -6786, -5789, -4781, -3790, -2843, -1979, -1247, -697, -358, -236,
-    -321, -580, -954, -1365, -1721, -1907, -1813, -1367, -579, 471, 1660, 2847,
-    3886, 4652, 5060, 5065, 4661, 3885, 2825, 1613, 415, -592, -1253, -1471,
-    -1226, -576, 358, 1420, 2469, 3398, 4147, 4685, 4988, 5028, 4787, 4276,
-    3559, 2744, 1956, 1316, 905, 741, 795, 1018, 1358, 1767, 2225, 2748,
-    3349, 4020, 4737, 5467, 6155, 6724, 7104, 7232, 7061, 6579, 5819, 4839,
-    3709, 2506, 1294, 103, -1064, -2213, -3344, -4435, -5403, -6128, -6494, -6430,
-    -5918, -5023, -3882, -2644, -1431, -335, 579, 1277, 1749, 1980, 1961, 1705,
-    1226, 542, -298, -1226, -2192, -3173, -4156, -5143, -6149, -7163, -8124, -8948,
-    -9552, -9850, -9786, -9368, -8671, -7807, -6895, -6032, -5262, -4576, -3942, -3329,
-    -2714, -2089, -1463, -858, -298, 181, 534, 714, 690, 460, 56, -471,
-    -1057, -1651, -2209, -2689, -3034, -3185, -3094, -2729, -2091, -1213, -160, 981,
-    2122, 3185, 4119, 4895, 5498, 5910, 6131, 6179, 6094, 5923, 5727, 5563,
-    5452, 5374, 5266, 5060, 4697, 4156, 3435, 2544, 1498, 343, -838, -1923,
-    -2768, -3239, -3242, -2761, -1854, -639, 733, 2118, 3407, 4519, 5384, 5948,
-    6180, 6069, 5613, 4821, 3729, 2419, 1004, -382, -1599, -2508, -2994, -2991,
-    -2486, -1522, -212, 1281, 2769, 4087, 5111, 5770, 6036, 5912, 5405, 4533,
-    3337, 1910, 370, -1155, -2563, -3789, -4812, -5630, -6241, -6622, -6737, -6551,
-    -6065, -5316, -4375, -3326, -2255, -1233, -303, 507, 1162, 1616, 1826, 1780,
-    1491, 992, 336, -417, -1227, -2080, -2954, -3805, -4578, -5219, -5670, -5882,
-    -5836, -5544, -5038, -4374, -3626, -2884, -2238, -1755, -1467, -1366, -1395, -1479,
-    -1545, -1535, -1403, -1127, -710, -179, 434, 1075, 1678, 2197, 2628, 3003,
-    3362, 3738, 4142, 4549, 4909, 5187, 5360, 5415, 5348, 5172, 4903, 4556,
-    4159, 3746, 3334, 2948, 2638, 2460, 2435, 2562, 2811, 3120, 3399, 3575,
-    3608, 3470, 3139, 2615, 1937, 1180, 455, -126, -487, -593, -455, -120,
-    343, 887, 1479, 2078, 2644, 3162, 3634, 4050, 4391, 4648, 4797, 4787,
-    4583, 4180, 3588, 2824, 1930, 966, -5, -914, -1698, -2321, -2788, -3121,
-    -3352, -3540, -3740, -3980, -4260, -4591, -4983, -5420, -5879, -6350, -6833, -7314,
-    -7765, -8150, -8419, -8504, -8350, -7935, -7265, -6367, -5310, -4190, -3102, -2126,
-    -1329, -752, -395, -221, -183, -248, -390, -596, -856, -1170, -1532, -1944,
-    -2426, -3012, -3713, -4496, -5283, -5972, -6456, -6636, -6465, -5965, -5207, -4279,
-    -3276, -2285, -1359, -523, 216, 861, 1433, 1969, 2511, 3081, 3678, 4268,
-    4805, 5231, 5485, 5532, 5374, 5044, 4577, 4018, 3416, 2806, 2209, 1658,
-    1215, 958, 961, 1273, 1877, 2682, 3565, 4414, 5137, 5661, 5947, 5982,
-    5768, 5333, 4733, 4043, 3343, 2723, 2275, 2074, 2150, 2494, 3053, 3745,
-    4467, 5118, 5610, 5867, 5835, 5488, 4854, 4016, 3086, 2163, 1315, 581,
-    -22, -483, -782, -895, -840, -687, -533, -475, -572, -827, -1177, -1516,
-    -1737, -1767, -1591, -1252, -853, -521, -378, -501, -916, -1602, -2489, -3485,
-    -4507, -5504, -6435, -7260, -7951, -8492, -8855, -9004, -8930, -8651, -8191, -7575,
-    -6855, -6108, -5391, -4724, -4109, -3541, -3005, -2490, -2019, -1649, -1425, -1366,
-    -1458, -1681, -2002, -2377, -2760, -3105, -3369, -3520, -3555, -3489, -3334, -3092,
-    -2765, -2346, -1839, -1263, -660, -70, 474, 932, 1269, 1466, 1515, 1432,
-    1251, 1018, 786, 608, 537, 597, 781, 1073, 1452, 1880, 2318, 2755,
-    3199, 3651, 4110, 4584, 5069, 5535, 5933, 6212, 6327, 6250, 5974, 5500,
-    4828, 3975, 2980, 1917, 893, 36, -536, -750, -570, -10, 860, 1919,
-    3029, 4058, 4902, 5504, 5855, 5965, 5860, 5580, 5182, 4724, 4261, 3829,
-    3428, 3034, 2635, 2241, 1861, 1487, 1084, 601, -7, -748, -1580, -2427,
-    -3205, -3836, -4263, -4452, -4405, -4170, -3834, -3502, -3250, -3116, -3093, -3151,
-    -3268, -3449, -3711, -4060, -4487, -4967, -5463, -5933, -6346, -6679, -6895, -6957,
-    -6847, -6561, -6108, -5518, -4840, -4133, -3455, -2866, -2411, -2109, -1951, -1913,
-    -1970, -2098, -2272, -2472, -2680, -2868, -2994, -3020, -2931, -2731, -2422, -2005,
-    -1484, -884, -241, 397, 983, 1479, 1883, 2213, 2492, 2725, 2905, 3023,
-    3085, 3107, 3107, 3091, 3062, 3029, 3011, 3034, 3116, 3248, 3409, 3576,
-    3740, 3903, 4059, 4193, 4286, 4329, 4341, 4354, 4384, 4416, 4414, 4341,
-    4178, 3941, 3666, 3396, 3170, 3033, 3033, 3213, 3585, 4109, 4698, 5250,
-    5680, 5937, 5991, 5818, 5408, 4766, 3926, 2962, 1979, 1099, 432, 69,
-    65, 436, 1144, 2094, 3157, 4192, 5077, 5712, 6019, 5956, 5516, 4728,
-    3659, 2414, 1110, -158, -1341, -2422, -3408, -4314, -5143, -5861, -6412, -6739,
-    -6803, -6590, -6125, -5466, -4687, -3867, -3091, -2447, -2000, -1765, -1694, -1711,
-    -1738, -1721, -1645, -1537, -1456, -1463, -1596, -1885, -2358, -3026, -3860, -4809,
-    -5811, -6800, -7702, -8450, -8987, -9266, -9256, -8962, -8424, -7701, -6850, -5934,
-    -5020, -4165, -3401, -2742, -2183, -1705, -1280, -875, -462, -10, 523, 1164,
-    1908, 2717, 3533, 4295, 4940, 5417, 5697, 5764, 5625, 5306, 4858, 4323,
-    3707, 2987, 2141, 1179, 159, -812, -1600, -2068, -2122, -1730, -926, 191,
-    1467, 2712, 3742, 4402, 4584, 4248, 3452, 2345, 1151, 133, -466, -490,
-    90, 1179, 2583, 4061, 5380, 6383, 6999, 7243, 7184, 6904, 6449, 5825,
-    5023, 4041, 2909, 1707, 543, -482, -1285, -1790, -1947, -1752, -1279, -670,
-    -113, 203, 155, -284, -1035, -1914, -2691, -3157, -3186, -2750, -1939, -943,
-    8, 718, 1063, 1000, 566, -152, -1058, -2065, -3095, -4104, -5088, -6053,
-    -6980, -7831, -8546, -9032, -9195, -8974, -8358, -7379, -6120, -4726, -3370, -2220,
-    -1424, -1086, -1245, -1872, -2870, -4078, -5299, -6339, -7043, -7306, -7089, -6419,
-    -5362, -4027, -2575, -1211, -131, 520, 672, 356, -305, -1131, -1930, -2509,
-    -2717, -2484, -1845, -910, 162, 1206, 2105, 2824, 3399, 3883, 4330, 4782,
-    5272, 5800, 6331, 6801, 7156, 7359, 7394, 7270, 7014, 6661, 6226, 5699,
-    5061, 4287, 3358, 2289, 1161, 108, -714, -1166, -1161, -693, 164, 1295,
-    2563, 3830, 4969, 5886, 6529, 6885, 6967, 6793, 6368, 5684, 4740, 3572,
-    2267, 960, -191, -1029, -1425, -1302, -654, 442, 1836, 3307, 4593, 5437,
-    5638, 5099, 3848, 2043, -70, -2212, -4117, -5560, -6364, -6422, -5721, -4360,
-    -2569, -660, 1037, 2262, 2863, 2814, 2188, 1124, -227, -1720, -3215, -4584,
-    -5726, -6581, -7108, -7270, -7057, -6506, -5707, -4790, -3900, -3156, -2598, -2194,
-    -1880, -1598, -1301, -966, -622, -350, -254, -416, -872, -1592, -2457, -3290,
-    -3915, -4220, -4178, -3841, -3311, -2715, -2158, -1702, -1349, -1063, -788, -460,
-    -23, 565, 1313, 2183, 3086, 3905, 4527, 4891, 5000, 4907, 4684, 4401,
-    4103, 3820, 3583, 3431, 3394, 3468, 3633, 3861, 4121, 4386, 4638, 4869,
-    5060, 5186, 5214, 5111, 4843, 4388, 3749, 2945, 2017, 1017, -5, -1004,
-    -1919, -2678, -3209, -3456, -3379, -2968, -2269, -1355, -304, 809, 1903, 2904,
-    3760, 4444, 4957, 5311, 5518, 5575, 5476, 5212, 4772, 4159, 3402, 2539,
-    1592, 574, -494, -1602, -2760, -3963, -5162, -6263, -7134, -7626, -7603, -6999,
-    -5847, -4292, -2573, -967, 281, 1015, 1192, 872, 182, -726, -1718, -2703,
-    -3633, -4501, -5315, -6069, -6740, -7282, -7641, -7770, -7644, -7256, -6608, -5717,
-    -4619, -3382, -2119, -979, -109, 398, 518, 274, -294, -1136, -2186, -3354,
-    -4530, -5595, -6436, -6962, -7125, -6924, -6387, -5569, -4549, -3417, -2252, -1116,
-    -56, 914, 1809, 2639, 3401, 4090, 4692, 5169, 5474, 5561, 5400, 4989,
-    4361, 3584, 2727, 1862, 1080, 474, 113, 19, 164, 481, 886, 1321,
-    1765, 2232, 2759, 3369, 4054, 4771, 5468, 6084, 6571, 6906, 7089, 7114,
-    6968, 6657, 6203, 5633, 4980, 4279, 3553, 2793, 1980, 1111, 220, -612,
-    -1270, -1653, -1695, -1367, -685, 284, 1426, 2599, 3633, 4370, 4714, 4636,
-    4166, 3372, 2374, 1312, 307, -554, -1229, -1726, -2093, -2385, -2655, -2963,
-    -3361, -3876, -4516, -5277, -6119, -6971, -7754, -8403, -8860, -9066, -8966, -8535,
-    -7803, -6860, -5824, -4792, -3825, -2944, -2150, -1431, -791, -256, 133, 314,
-    218, -205, -954, -1972, -3154, -4361, -5446, -6282, -6785, -6911, -6647, -6024,
-    -5110, -4005, -2830, -1698, -674, 220, 986, 1625, 2135, 2505, 2714, 2747,
-    2601, 2289, 1843, 1326, 835, 464, 286, 336, 606, 1054, 1620, 2240,
-    2868, 3474, 4048, 4587, 5087, 5546, 5937, 6216, 6330, 6239, 5919, 5368,
-    4627, 3783, 2960, 2299, 1946, 1998, 2460, 3256, 4258, 5314, 6267, 7012,
-    7518, 7790, 7851, 7736, 7479, 7083, 6532, 5824, 4988, 4058, 3062, 2015,
-    932, -153, -1150, -1922, -2322, -2245, -1671, -685, 554, 1865, 3092, 4126,
-    4914, 5439, 5700, 5711, 5498, 5081, 4464, 3661, 2706, 1640, 504, -660,
-    -1815, -2932, -3964, -4851, -5549, -6047, -6349, -6460, -6391, -6153, -5753, -5232,
-    -4667, -4159, -3797, -3650, -3763, -4143, -4758, -5537, -6359, -7055, -7449, -7419,
-    -6925, -6029, -4876, -3651, -2523, -1620, -1020, -749, -775, -1029, -1415, -1826,
-    -2169, -2379, -2448, -2414, -2344, -2311, -2376, -2566, -2862, -3205, -3529, -3759,
-    -3828, -3696, -3359, -2829, -2132, -1328, -507, 255, 907, 1408, 1736, 1895,
-    1917, 1846, 1748, 1721, 1858, 2218, 2801, 3540, 4320, 5010, 5520, 5818,
-    5934, 5928, 5856, 5741, 5576, 5347, 5051, 4702, 4320, 3910, 3449, 2915,
-    2329, 1756, 1299, 1069, 1140, 1515, 2126, 2871, 3649, 4372, 4971, 5402,
-    5639, 5677, 5526, 5228, 4856, 4489, 4189, 3980, 3855, 3778, 3682, 3506,
-    3210, 2773, 2185, 1440, 548, -469, -1571, -2670, -3635, -4321, -4613, -4454,
-    -3865, -2954, -1902, -914, -173, 191, 130, -317, -1035, -1878, -2713, -3441,
-    -3992, -4333, -4459, -4373, -4094, -3685, -3244, -2878, -2679, -2732, -3086, -3728,
-    -4593, -5597, -6637, -7594, -8363, -8874, -9092, -8999, -8594, -7898, -6950, -5834,
-    -4664, -3557, -2592, -1805, -1182, -679, -269, 35, 188, 164, -30, -348,
-    -713, -1043, -1260, -1311, -1167, -824, -290, 402, 1182, 1959, 2643, 3161,
-    3463, 3550, 3465, 3285, 3091, 2948, 2886, 2890, 2929, 3001, 3121, 3283,
-    3472, 3664, 3822, 3902, 3873, 3731, 3492, 3180, 2841, 2548, 2380, 2410,
-    2683, 3198, 3888, 4640, 5317, 5789, 5959, 5776, 5247, 4439, 3456, 2412,
-    1429, 635, 144, 16, 243, 752, 1432, 2172, 2894, 3535, 4036, 4352,
-    4460, 4366, 4105, 3739, 3324, 2878, 2393, 1874, 1375, 981, 779, 818,
-    1070, 1439, 1796, 2027, 2067, 1896, 1525, 978, 279, -543, -1446, -2374,
-    -3267, -4068, -4728, -5205, -5470, -5516, -5359, -5035, -4609, -4177, -3848, -3716,
-    -3850, -4276, -4961, -5824, -6761, -7675, -8482, -9136, -9613, -9901, -9989, -9869,
-    -9543, -9018, -8317, -7485, -6588, -5696, -4876, -4189, -3679, -3368, -3264, -3359,
-    -3625, -4015, -4462, -4879, -5161, -5214, -4975, -4426, -3596, -2553, -1386, -187,
-    952, 1927, 2633, 2976, 2893, 2376, 1491, 365, -834, -1920, -2707, -3048,
-    -2875, -2221, -1210, -16, 1187, 2273, 3178, 3886, 4394, 4693, 4766, 4606,
-    4241, 3746, 3239, 2851, 2694, 2829, 3261, 3938, 4764, 5616, 6371, 6934,
-    7258, 7347, 7245, 7010, 6689, 6307, 5864, 5350, 4746, 4051, 3279, 2461,
-    1643, 912, 385, 176, 361, 954, 1878, 2965, 3994, 4728, 4971, 4615,
-    3677, 2311, 768, -658, -1704, -2217, -2174, -1666, -860, 25, 772, 1226,
-    1312, 1037, 471, -273, -1093, -1911, -2678, -3365, -3957, -4438, -4799, -5063,
-    -5275, -5465, -5626, -5737, -5784, -5753, -5620, -5346, -4874, -4152, -3175, -2007,
-    -766, 414, 1416, 2174, 2660, 2854, 2725, 2245, 1428, 342, -893, -2140,
-    -3273, -4204, -4873, -5243, -5309, -5094, -4642, -4010, -3247, -2387, -1453, -468,
-    536, 1525, 2464, 3323, 4079, 4724, 5250, 5640, 5876, 5956, 5885, 5670,
-    5328, 4890, 4386, 3849, 3322, 2850, 2453, 2137, 1903, 1751, 1668, 1656,
-    1745, 1964, 2320, 2793, 3351, 3953, 4550, 5101, 5565, 5881, 5985, 5835,
-    5437, 4835, 4112, 3381, 2762, 2367, 2298, 2619, 3321, 4299, 5365, 6282,
-    6822, 6828, 6249, 5134, 3614, 1887, 191, -1226, -2141, -2387, -1905, -766,
-    828, 2586, 4188, 5344, 5860, 5678, 4869, 3588, 2032, 401, -1127, -2413,
-    -3354, -3872, -3929, -3548, -2828, -1940, -1112, -577, -515, -1009, -2019, -3397,
-    -4932, -6400, -7598, -8345, -8498, -7993, -6887, -5375, -3783, -2499, -1872, -2104,
-    -3187, -4913, -6933, -8861, -10373, -11272, -11510, -11158, -10358, -9276, -8048, -6786,
-    -5575, -4483, -3540, -2723, -1957, -1162, -302, 599, 1477, 2248, 2840, 3207,
-    3332, 3203, 2808, 2144, 1236, 135, -1095, -2384, -3646, -4757, -5568, -5929,
-    -5749, -5040, -3925, -2588, -1204, 109, 1300, 2359, 3306, 4165, 4949, 5661,
-    6294, 6820, 7181, 7302, 7108, 6558, 5669, 4515, 3201, 1828, 479, -790,
-    -1936, -2891, -3549, -3791, -3538, -2789, -1655, -343, 912, 1927, 2617, 2979,
-    3077, 3023, 2942, 2958, 3151, 3539, 4046, 4522, 4784, 4665, 4065, 2984,
-    1498, -265, -2149, -3975, -5563, -6754, -7433, -7550, -7132, -6279, -5136, -3869,
-    -2633, -1536, -612, 168, 876, 1585, 2317, 3032, 3642, 4056, 4202, 4050,
-    3621, 2974, 2189, 1354, 544, -216, -954, -1740, -2642, -3683, -4807, -5885,
-    -6762, -7304, -7431, -7127, -6433, -5426, -4206, -2899, -1644, -548, 321, 940,
-    1316, 1483, 1487, 1362, 1137, 853, 566, 341, 250, 358, 700, 1249,
-    1914, 2553, 3010, 3154, 2921, 2324, 1447, 418, -606, -1460, -1994, -2106,
-    -1760, -999, 69, 1302, 2563, 3738, 4755, 5583, 6220, 6668, 6924, 6976,
-    6793, 6342, 5621, 4690, 3650, 2611, 1677, 938, 457, 261, 342, 649,
-    1087, 1531, 1884, 2115, 2281, 2488, 2833, 3345, 3978, 4639, 5241, 5723,
-    6038, 6140, 5971, 5475, 4623, 3449, 2053, 598, -726, -1759, -2394, -2575,
-    -2293, -1598, -588, 596, 1796, 2853, 3629, 4026, 3985, 3496, 2588, 1321,
-    -210, -1865, -3462, -4814, -5764, -6200, -6080, -5443, -4408, -3144, -1843, -697,
-    144, 592, 631, 298, -337, -1193, -2182, -3232, -4303, -5379, -6456, -7514,
-    -8503, -9341, -9925, -10171, -10051, -9583, -8823, -7852, -6768, -5664, -4621, -3693,
-    -2895, -2195, -1550, -954, -434, -29, 253, 447, 625, 843, 1105, 1363,
-    1554, 1637, 1613, 1508, 1353, 1176, 1005, 875, 829, 914, 1141, 1472,
-    1847, 2218, 2548, 2797, 2925, 2907, 2713, 2308, 1680, 840, -194, -1390,
-    -2661, -3874, -4877, -5521, -5692, -5343, -4502, -3247, -1707, -55, 1538, 2943,
-    4078, 4921, 5508, 5896, 6118, 6165, 6008, 5605, 4925, 3996, 2887, 1670,
-    408, -841, -2035, -3164, -4212, -5136, -5896, -6482, -6891, -7109, -7117, -6892,
-    -6430, -5771, -4994, -4170, -3343, -2524, -1705, -871, -41, 728, 1394, 1943,
-    2368, 2638, 2707, 2517, 2030, 1274, 332, -703, -1768, -2813, -3779, -4579,
-    -5096, -5204, -4841, -4041, -2921, -1643, -376, 741, 1627, 2242, 2579, 2674,
-    2580, 2346, 2002, 1563, 1014, 330, -506, -1474, -2527, -3578, -4492, -5123,
-    -5350, -5105, -4387, -3278, -1927, -492, 892, 2131, 3171, 4018, 4711, 5280,
-    5724, 6033, 6203, 6239, 6155, 5979, 5733, 5419, 5002, 4427, 3642, 2631,
-    1447, 209, -920, -1766, -2190, -2138, -1662, -889, 27, 937, 1726, 2319,
-    2686, 2840, 2834, 2764, 2741, 2852, 3142, 3609, 4208, 4866, 5512, 6101,
-    6606, 7006, 7277, 7405, 7381, 7204, 6875, 6405, 5797, 5037, 4100, 2984,
-    1714, 357, -973, -2125, -2949, -3344, -3267, -2735, -1819, -641, 655, 1923,
-    3039, 3911, 4492, 4773, 4773, 4515, 4011, 3257, 2277, 1148, -3, -1018,
-    -1753, -2142, -2237, -2164, -2065, -2067, -2255, -2655, -3261, -4064, -5038, -6105,
-    -7150, -8057, -8716, -9037, -8977, -8545, -7789, -6789, -5678, -4619, -3750, -3163,
-    -2910, -3001, -3402, -4053, -4866, -5736, -6548, -7205, -7645, -7843, -7780, -7437,
-    -6806, -5933, -4919, -3881, -2912, -2047, -1256, -477, 327, 1134, 1901, 2593,
-    3194, 3698, 4096, 4370, 4501, 4495, 4396, 4264, 4134, 3994, 3787, 3434,
-    2872, 2078, 1070, -72, -1219, -2211, -2899, -3192, -3076, -2612, -1903, -1059,
-    -176, 670, 1425, 2060, 2589, 3064, 3544, 4059, 4595, 5121, 5603, 6026,
-    6410, 6786, 7144, 7424, 7556, 7503, 7260, 6847, 6305, 5665, 4936, 4129,
-    3280, 2441, 1667, 1010, 501, 140, -120, -339, -572, -849, -1173, -1524,
-    -1880, -2232, -2600, -3023, -3531, -4123, -4760, -5378, -5899, -6242, -6351, -6197,
-    -5787, -5171, -4440, -3711, -3098, -2685, -2498, -2494, -2582, -2654, -2626, -2476,
-    -2245, -1990, -1749, -1546, -1411, -1368, -1436, -1618, -1871, -2084, -2123, -1912,
-    -1469, -889, -315, 112, 315, 303, 130, -133, -409, -635, -795, -903,
-    -985, -1066, -1168, -1281, -1365, -1395, -1371, -1290, -1125, -846, -428, 132,
-    800, 1509, 2191, 2812, 3366, 3859, 4304, 4711, 5075, 5388, 5655, 5882,
-    6056, 6162, 6181, 6101, 5910, 5595, 5133, 4505, 3729, 2874, 2047, 1360,
-    906, 723, 797, 1086, 1536, 2096, 2714, 3355, 3982, 4549, 5014, 5368,
-    5616, 5764, 5814, 5761, 5583, 5247, 4717, 3971, 3025, 1947, 859, -93,
-    -767, -1047, -887, -329, 515, 1501, 2480, 3321, 3940, 4302, 4416, 4319,
-    4066, 3706, 3270, 2764, 2184, 1537, 844, 136, -563, -1240, -1886, -2496,
-    -3062, -3558, -3937, -4146, -4141, -3898, -3435, -2831, -2219, -1773, -1646, -1923,
-    -2589, -3557, -4696, -5874, -6997, -8020, -8926, -9697, -10310, -10728, -10892, -10744,
-    -10278, -9562, -8723, -7912, -7260, -6825, -6577, -6427, -6285, -6076, -5747, -5272,
-    -4649, -3899, -3082, -2303, -1682, -1304, -1193, -1307, -1550, -1788, -1878, -1690,
-    -1138, -222, 956, 2205, 3291, 3989, 4140, 3682, 2671, 1251, -357, -1876,
-    -3021, -3570, -3430, -2653, -1409, 70, 1560, 2896, 4001, 4866, 5518, 5994,
-    6331, 6554, 6663, 6630, 6423, 6031, 5467, 4770, 4011, 3273, 2618, 2070,
-    1625, 1260, 917, 512, -17, -696, -1502, -2339, -3032, -3386, -3262, -2623,
-    -1556, -263, 996, 2011, 2663, 2927, 2844, 2482, 1904, 1138, 207, -848,
-    -1971, -3098, -4175, -5161, -6027, -6736, -7230, -7445, -7329, -6861, -6085, -5113,
-    -4113, -3270, -2727, -2531, -2623, -2856, -3052, -3054, -2780, -2236, -1484, -598,
-    342, 1256, 2059, 2669, 2991, 2953, 2534, 1765, 712, -520, -1776, -2865,
-    -3607, -3858, -3552, -2739, -1587, -336, 780, 1586, 1998, 2024, 1748, 1304,
-    832, 469, 322, 440, 796, 1312, 1889, 2439, 2917, 3325, 3686, 4009,
-    4280, 4487, 4635, 4744, 4862, 5037, 5294, 5623, 6001, 6403, 6790, 7109,
-    7294, 7276, 7003, 6471, 5710, 4766, 3698, 2598, 1600, 860, 535, 732,
-    1445, 2546, 3835, 5095, 6153, 6896, 7273, 7265, 6878, 6148, 5144, 3954,
-    2665, 1354, 88, -1066, -2041, -2771, -3196, -3273, -2979, -2317, -1322, -70,
-    1322, 2726, 4029, 5148, 6041, 6694, 7099, 7214, 6992, 6416, 5523, 4392,
-    3134, 1865, 665, -443, -1483, -2500, -3549, -4653, -5773, -6793, -7556, -7904,
-    -7724, -6989, -5764, -4193, -2472, -818, 580, 1580, 2088, 2065, 1529, 554,
-    -756, -2278, -3881, -5449, -6900, -8185, -9275, -10144, -10750, -11044, -10981, -10550,
-    -9782, -8747, -7534, -6226, -4905, -3649, -2513, -1511, -631, 149, 854, 1493,
-    2047, 2468, 2701, 2685, 2378, 1767, 886, -199, -1380, -2533, -3549, -4338,
-    -4828, -4956, -4692, -4050, -3095, -1940, -717, 483, 1635, 2739, 3779, 4718,
-    5509, 6111, 6516, 6740, 6786, 6622, 6196, 5474, 4456, 3195, 1783, 327,
-    -1064, -2273, -3167, -3618, -3542, -2939, -1900, -563, 937, 2488, 3975, 5287,
-    6327, 7026, 7345, 7301, 6958, 6402, 5703, 4921, 4120, 3362, 2687, 2111,
-    1618, 1162, 689, 159, -436, -1086, -1784, -2522, -3292, -4096, -4930, -5738,
-    -6402, -6778, -6746, -6237, -5278, -4022, -2702, -1547, -742, -418, -634, -1352,
-    -2470, -3854, -5330, -6705, -7820, -8588, -8964, -8932, -8523, -7797, -6812, -5640,
-    -4390, -3212, -2277, -1754, -1762, -2305, -3249, -4345, -5293, -5825, -5787, -5167,
-    -4044, -2558, -897, 722, 2089, 3008, 3324, 2979, 2052, 722, -781, -2204,
-    -3305, -3903, -3909, -3343, -2337, -1104, 141, 1249, 2162, 2891, 3498, 4041,
-    4547, 5028, 5508, 6008, 6517, 6989, 7368, 7601, 7659, 7559, 7336, 7014,
-    6595, 6081, 5457, 4694, 3756, 2634, 1381, 131, -894, -1460, -1410, -719,
-    509, 2085, 3801, 5489, 7024, 8311, 9277, 9877, 10098, 9938, 9388, 8435,
-    7080, 5378, 3468, 1529, -276, -1836, -3070, -3907, -4272, -4088, -3353, -2203,
-    -899, 265, 1053, 1354, 1214, 825, 430, 251, 453, 1119, 2194, 3483,
-    4727, 5688, 6208, 6234, 5805, 5011, 3953, 2735, 1458, 203, -996, -2148,
-    -3302, -4505, -5758, -6997, -8128, -9041, -9620, -9768, -9441, -8664, -7530, -6205,
-    -4896, -3763, -2856, -2134, -1510, -899, -255, 403, 1018, 1525, 1857, 1943,
-    1727, 1184, 320, -830, -2191, -3656, -5099, -6382, -7386, -8053, -8396, -8473,
-    -8358, -8126, -7822, -7466, -7058, -6605, -6105, -5544, -4912, -4231, -3551, -2940,
-    -2445, -2070, -1775, -1504, -1213, -868, -447, 74, 713, 1463, 2265, 3025,
-    3655, 4097, 4317, 4287, 3988, 3427, 2676, 1892, 1301, 1129, 1522, 2485,
-    3881, 5489, 7077, 8460, 9535, 10280, 10746, 11018, 11177, 11277, 11321, 11256,
-    11011, 10538, 9824, 8890, 7792, 6628, 5517, 4551, 3765, 3140, 2603, 2041,
-    1345, 466, -576, -1717, -2856, -3875, -4657, -5128, -5268, -5126, -4841, -4636,
-    -4742, -5302, -6334, -7719, -9222, -10559, -11491, -11881, -11689, -10960, -9808, -8376,
-    -6804, -5232, -3781, -2516, -1425, -467, 405, 1227, 2011, 2719, 3286, 3658,
-    3789, 3650, 3271, 2744, 2184, 1677, 1267, 956, 709, 497, 347, 313,
-    412, 594, 764, 831, 764, 608, 447, 324, 216, 61, -196, -552,
-    -916, -1149, -1157, -926, -497, 76, 752, 1517, 2396, 3393, 4443, 5425,
-    6226, 6789, 7127, 7304, 7382, 7355, 7127, 6564, 5580, 4209, 2606, 984,
-    -504, -1829, -3084, -4397, -5808, -7181, -8220, -8589, -8059, -6636, -4620, -2537,
-    -924, -101, -39, -391, -633, -308, 747, 2309, 3907, 5051, 5454, 5126,
-    4351, 3524, 2967, 2813, 3015, 3414, 3835, 4154, 4333, 4380, 4305, 4104,
-    3771, 3309, 2733, 2092, 1455, 879, 373, -109, -641, -1297, -2124, -3121,
-    -4248, -5444, -6645, -7785, -8782, -9543, -9978, -10009, -9588, -8727, -7495, -5995,
-    -4341, -2675, -1160, 40, 795, 1025, 711, -103, -1303, -2721, -4166, -5440,
-    -6378, -6860, -6828, -6289, -5307, -3983, -2433, -794, 775, 2104, 3050, 3522,
-    3483, 2950, 1998, 734, -718, -2226, -3651, -4851, -5706, -6116, -6030, -5474,
-    -4573, -3520, -2538, -1845, -1598, -1854, -2564, -3594, -4725, -5686, -6215, -6134,
-    -5377, -4018, -2257, -342, 1546, 3322, 4962, 6465, 7830, 9020, 9954, 10547,
-    10757, 10602, 10142, 9485, 8752, 8032, 7371, 6772, 6206, 5632, 5038, 4443,
-    3865, 3301, 2734, 2144, 1489, 721, -193, -1276, -2539, -3948, -5408, -6796,
-    -7979, -8821, -9207, -9076, -8432, -7346, -5971, -4513, -3162, -2032, -1141, -423,
-    226, 888, 1574, 2231, 2767, 3083, 3101, 2781, 2127, 1181, 18, -1265,
-    -2552, -3727, -4677, -5314, -5584, -5457, -4926, -4009, -2738, -1165, 625, 2509,
-    4356, 6068, 7577, 8841, 9832, 10516, 10836, 10725, 10159, 9162, 7798, 6175,
-    4434, 2715, 1119, -307, -1569, -2723, -3850, -5000, -6166, -7289, -8292, -9106,
-    -9677, -9959, -9919, -9541, -8841, -7867, -6699, -5438, -4201, -3106, -2245, -1654,
-    -1296, -1072, -851, -520, -34, 567, 1198, 1788, 2293, 2671, 2871, 2841,
-    2568, 2105, 1596, 1243, 1237, 1684, 2582, 3836, 5302, 6834, 8307, 9618,
-    10685, 11446, 11852, 11875, 11529, 10886, 10072, 9251, 8586, 8197, 8127, 8335,
-    8703, 9069, 9282, 9231, 8865, 8199, 7318, 6337, 5346, 4403, 3537, 2748,
-    1995, 1209, 323, -712, -1920, -3265, -4648, -5957, -7107, -8036, -8674, -8919,
-    -8646, -7766, -6285, -4338, -2152, 10, 1909, 3368, 4275, 4569, 4252, 3443,
-    2378, 1345, 590, 238, 258, 485, 712, 773, 572, 83, -654, -1539,
-    -2441, -3223, -3771, -4018, -3951, -3588, -2954, -2097, -1094, -67, 828, 1446,
-    1703, 1613, 1267, 788, 276, -225, -728, -1277, -1926, -2747, -3810, -5153,
-    -6745, -8485, -10198, -11661, -12668, -13094, -12906, -12128, -10832, -9129, -7161, -5106,
-    -3147, -1423, 25, 1250, 2352, 3401, 4384, 5183, 5650, 5704, 5375, 4788,
-    4129, 3574, 3230, 3114, 3183, 3369, 3584, 3742, 3776, 3647, 3327, 2811,
-    2136, 1395, 724, 281, 204, 566, 1351, 2457, 3722, 4958, 5999, 6710,
-    6991, 6793, 6134, 5092, 3782, 2335, 874, -519, -1815, -3013, -4106, -5066,
-    -5829, -6301, -6410, -6160, -5660, -5107, -4724, -4685, -5058, -5788, -6738, -7733,
-    -8601, -9204, -9451, -9309, -8797, -7985, -6980, -5902, -4845, -3858, -2945, -2073,
-    -1187, -242, 780, 1858, 2936, 3935, 4785, 5451, 5919, 6182, 6227, 6052,
-    5672, 5135, 4524, 3929, 3401, 2925, 2430, 1833, 1059, 99, -986, -2097,
-    -3155, -4100, -4898, -5537, -6009, -6286, -6335, -6165, -5829, -5398, -4943, -4527,
-    -4160, -3799, -3401, -2960, -2483, -1960, -1375, -710, 70, 1000, 2072, 3247,
-    4506, 5846, 7244, 8645, 9957, 11037, 11699, 11791, 11248, 10098, 8427, 6374,
-    4109, 1805, -345, -2121, -3297, -3711, -3322, -2215, -581, 1319, 3212, 4863,
-    6100, 6821, 6990, 6644, 5876, 4821, 3608, 2349, 1149, 123, -614, -980,
-    -965, -650, -183, 271, 584, 686, 551, 183, -382, -1067, -1747, -2268,
-    -2477, -2280, -1685, -795, 233, 1254, 2162, 2893, 3409, 3698, 3753, 3577,
-    3188, 2621, 1923, 1153, 380, -352, -1044, -1735, -2489, -3384, -4481, -5772,
-    -7158, -8465, -9486, -10032, -9979, -9294, -8035, -6326, -4347, -2317, -475, 935,
-    1697, 1673, 846, -661, -2591, -4586, -6255, -7267, -7439, -6765, -5418, -3674,
-    -1826, -118, 1261, 2153, 2430, 2006, 888, -769, -2651, -4353, -5509, -5881,
-    -5416, -4235, -2588, -796, 840, 2112, 2964, 3476, 3807, 4109, 4471, 4898,
-    5339, 5749, 6134, 6538, 6987, 7465, 7914, 8258, 8415, 8330, 7964, 7280,
-    6241, 4855, 3188, 1346, -529, -2254, -3619, -4435, -4582, -4034, -2878, -1304,
-    463, 2217, 3807, 5151, 6234, 7083, 7729, 8198, 8495, 8584, 8400, 7879,
-    7003, 5827, 4489, 3182, 2109, 1447, 1307, 1686, 2418, 3210, 3730, 3712,
-    3029, 1739, 42, -1812, -3609, -5187, -6408, -7155, -7337, -6924, -5983, -4685,
-    -3265, -1971, -1015, -537, -586, -1119, -1997, -3000, -3887, -4442, -4516, -4041,
-    -3037, -1614, 49, 1719, 3135, 4054, 4314, 3878, 2828, 1326, -443, -2294,
-    -4053, -5576, -6759, -7543, -7900, -7823, -7316, -6389, -5063, -3384, -1445, 614,
-    2623, 4416, 5867, 6888, 7416, 7411, 6869, 5846, 4469, 2918, 1383, 0,
-    -1189, -2231, -3235, -4308, -5494, -6774, -8096, -9406, -10648, -11746, -12582, -13002,
-    -12857, -12069, -10659, -8758, -6581, -4365, -2292, -452, 1157, 2599, 3965, 5298,
-    6533, 7504, 8008, 7882, 7085, 5733, 4066, 2363, 871, -226, -822, -898,
-    -509, 224, 1127, 2006, 2708, 3172, 3431, 3586, 3754, 4021, 4404, 4844,
-    5219, 5376, 5188, 4608, 3693, 2587, 1479, 516, -236, -793, -1216, -1563,
-    -1860, -2092, -2222, -2229, -2125, -1952, -1770, -1644, -1643, -1825, -2214, -2787,
-    -3482, -4227, -4962, -5665, -6371, -7154, -8087, -9197, -10442, -11702, -12815, -13639,
-    -14090, -14135, -13770, -13004, -11855, -10372, -8673, -6940, -5348, -3993, -2853, -1786,
-    -594, 868, 2595, 4429, 6123, 7389, 7972, 7706, 6545, 4582, 2048, -720,
-    -3363, -5560, -7052, -7668, -7354, -6164, -4243, -1820, 808, 3355, 5597, 7394,
-    8669, 9408, 9622, 9337, 8603, 7487, 6050, 4332, 2386, 309, -1725, -3483,
-    -4719, -5261, -5059, -4155, -2636, -613, 1774, 4325, 6768, 8801, 10179, 10786,
-    10657, 9941, 8830, 7495, 6062, 4654, 3408, 2432, 1749, 1271, 829, 232,
-    -656, -1866, -3322, -4880, -6370, -7623, -8482, -8829, -8611, -7877, -6765, -5465,
-    -4159, -2960, -1872, -815, 318, 1595, 3033, 4591, 6170, 7636, 8851, 9694,
-    10073, 9947, 9336, 8321, 7014, 5550, 4061, 2651, 1382, 287, -632, -1401,
-    -2071, -2676, -3232, -3725, -4115, -4336, -4333, -4104, -3701, -3204, -2706, -2309,
-    -2102, -2154, -2499, -3140, -4022, -5036, -6029, -6833, -7304, -7348, -6932, -6068,
-    -4824, -3334, -1765, -255, 1127, 2391, 3601, 4831, 6088, 7292, 8304, 8989,
-    9250, 9051, 8418, 7413, 6111, 4608, 3021, 1497, 197, -739, -1223, -1243,
-    -873, -269, 379, 882, 1098, 952, 445, -362, -1353, -2357, -3156, -3541,
-    -3378, -2655, -1470, 8, 1586, 3093, 4382, 5305, 5708, 5456, 4507, 2951,
-    1004, -1032, -2843, -4179, -4895, -4956, -4417, -3404, -2088, -639, 816, 2208,
-    3505, 4694, 5768, 6714, 7526, 8200, 8725, 9069, 9194, 9092, 8792, 8351,
-    7856, 7379, 6938, 6491, 5982, 5377, 4663, 3843, 2937, 1966, 945, -109,
-    -1176, -2235, -3273, -4276, -5232, -6130, -6953, -7679, -8268, -8656, -8754, -8484,
-    -7815, -6799, -5563, -4287, -3145, -2255, -1664, -1357, -1269, -1307, -1382, -1410,
-    -1323, -1074, -658, -91, 608, 1413, 2295, 3227, 4192, 5169, 6142, 7104,
-    8041, 8927, 9732, 10418, 10944, 11278, 11400, 11292, 10925, 10283, 9369, 8211,
-    6879, 5491, 4188, 3081, 2223, 1593, 1089, 565, -100, -969, -2051, -3307,
-    -4665, -6032, -7300, -8322, -8933, -8991, -8411, -7199, -5464, -3421, -1327, 572,
-    2080, 3078, 3554, 3606, 3392, 3088, 2845, 2749, 2787, 2861, 2819, 2508,
-    1839, 849, -286, -1293, -1888, -1872, -1191, 45, 1600, 3180, 4501, 5334,
-    5534, 5046, 3927, 2336, 483, -1431, -3244, -4864, -6271, -7477, -8467, -9195,
-    -9625, -9759, -9626, -9294, -8855, -8384, -7925, -7507, -7177, -6966, -6889, -6938,
-    -7076, -7219, -7262, -7122, -6749, -6118, -5244, -4173, -2945, -1587, -114, 1470,
-    3145, 4838, 6400, 7663, 8477, 8734, 8388, 7486, 6157, 4571, 2926, 1429,
-    251, -532, -947, -1100, -1132, -1160, -1233, -1326, -1381, -1322, -1084, -616,
-    103, 1058, 2173, 3305, 4278, 4926, 5132, 4846, 4103, 2989, 1608, 62,
-    -1547, -3117, -4565, -5811, -6775, -7375, -7548, -7265, -6534, -5410, -3990, -2402,
-    -775, 766, 2095, 3089, 3643, 3677, 3165, 2147, 733, -911, -2590, -4104,
-    -5288, -6057, -6418, -6461, -6345, -6259, -6368, -6765, -7435, -8246, -8973, -9371,
-    -9251, -8525, -7216, -5441, -3368, -1170, 983, 2916, 4459, 5481, 5911, 5745,
-    5046, 3929, 2523, 949, -665, -2186, -3505, -4582, -5442, -6140, -6738, -7292,
-    -7831, -8338, -8765, -9052, -9128, -8919, -8379, -7509, -6371, -5076, -3757, -2527,
-    -1463, -599, 81, 646, 1205, 1843, 2593, 3422, 4243, 4943, 5414, 5592,
-    5455, 5033, 4434, 3845, 3493, 3559, 4096, 4988, 5998, 6871, 7432, 7633,
-    7532, 7228, 6801, 6307, 5812, 5411, 5189, 5195, 5431, 5845, 6346, 6829,
-    7187, 7312, 7111, 6541, 5637, 4493, 3239, 1993, 820, -259, -1218, -2003,
-    -2553, -2816, -2786, -2511, -2097, -1663, -1312, -1115, -1103, -1256, -1506, -1752,
-    -1876, -1766, -1367, -698, 147, 1012, 1703, 2036, 1896, 1263, 210, -1133,
-    -2620, -4121, -5549, -6846, -7981, -8924, -9635, -10064, -10167, -9923, -9351, -8520,
-    -7543, -6548, -5640, -4886, -4297, -3852, -3531, -3322, -3204, -3147, -3112, -3065,
-    -2977, -2821, -2576, -2229, -1773, -1213, -589, 46, 636, 1127, 1465, 1600,
-    1504, 1187, 730, 279, 9, 55, 473, 1231, 2242, 3413, 4678, 5987,
-    7280, 8499, 9612, 10617, 11522, 12333, 13034, 13561, 13824, 13758, 13348, 12602,
-    11550, 10256, 8807, 7298, 5841, 4536, 3416, 2427, 1487, 551, -365, -1182,
-    -1783, -2069, -2016, -1670, -1113, -449, 225, 831, 1305, 1571, 1537, 1122,
-    281, -975, -2561, -4327, -6103, -7747, -9161, -10285, -11068, -11437, -11314, -10661,
-    -9515, -8009, -6349, -4752, -3379, -2288, -1452, -793, -214, 367, 1011, 1769,
-    2685, 3774, 4996, 6259, 7425, 8335, 8844, 8865, 8379, 7406, 6005, 4284,
-    2410, 578, -999, -2114, -2614, -2438, -1632, -313, 1337, 3086, 4710, 6053,
-    7031, 7603, 7767, 7553, 7001, 6155, 5077, 3858, 2593, 1353, 171, -919,
-    -1854, -2536, -2866, -2793, -2338, -1574, -600, 493, 1647, 2812, 3924, 4893,
-    5632, 6078, 6196, 5976, 5421, 4547, 3387, 2012, 525, -966, -2394, -3745,
-    -5027, -6231, -7310, -8174, -8717, -8835, -8458, -7559, -6159, -4347, -2281, -158,
-    1831, 3523, 4797, 5582, 5846, 5575, 4796, 3610, 2202, 786, -454, -1406,
-    -2049, -2450, -2725, -3000, -3387, -3978, -4826, -5906, -7092, -8198, -9033, -9449,
-    -9377, -8850, -7989, -6943, -5847, -4813, -3920, -3190, -2599, -2107, -1669, -1237,
-    -786, -321, 159, 672, 1223, 1787, 2328, 2803, 3155, 3321, 3257, 2943,
-    2360, 1503, 408, -844, -2135, -3312, -4200, -4640, -4520, -3802, -2541, -873,
-    1017, 2932, 4708, 6229, 7423, 8227, 8584, 8475, 7933, 7052, 5984, 4917,
-    4038, 3476, 3287, 3449, 3869, 4409, 4932, 5336, 5568, 5612, 5472, 5133,
-    4553, 3708, 2630, 1406, 133, -1109, -2267, -3333, -4323, -5237, -6027, -6631,
-    -6996, -7080, -6859, -6357, -5638, -4799, -3958, -3253, -2787, -2604, -2698, -3044,
-    -3584, -4215, -4791, -5149, -5159, -4777, -4069, -3195, -2380, -1851, -1781, -2245,
-    -3224, -4595, -6116, -7459, -8297, -8388, -7642, -6137, -4084, -1748, 626, 2829,
-    4705, 6140, 7030, 7266, 6770, 5544, 3707, 1532, -576, -2174, -2917, -2664,
-    -1512, 230, 2144, 3840, 5064, 5703, 5765, 5340, 4547, 3503, 2324, 1153,
-    154, -501, -665, -271, 607, 1769, 2966, 3980, 4659, 4946, 4864, 4473,
-    3830, 2998, 2085, 1250, 652, 409, 555, 1021, 1646, 2230, 2610, 2691,
-    2469, 2024, 1469, 892, 313, -308, -1042, -1953, -3047, -4247, -5407, -6345,
-    -6886, -6897, -6333, -5251, -3821, -2291, -939, -13, 307, -41, -981, -2287,
-    -3630, -4636, -4977, -4482, -3199, -1364, 670, 2510, 3797, 4271, 3809, 2446,
-    395, -1964, -4168, -5775, -6470, -6134, -4885, -3001, -824, 1323, 3174, 4578,
-    5493, 5958, 6058, 5910, 5637, 5342, 5107, 5002, 5059, 5245, 5480, 5671,
-    5734, 5625, 5373, 5077, 4861, 4817, 4960, 5205, 5376, 5273, 4737, 3697,
-    2208, 459, -1251, -2599, -3305, -3200, -2250, -577, 1583, 3929, 6136, 7889,
-    8930, 9092, 8320, 6690, 4414, 1801, -813, -3119, -4854, -5815, -5875, -5028,
-    -3434, -1439, 502, 1950, 2607, 2415, 1584, 501, -430, -922, -850, -260,
-    654, 1622, 2354, 2611, 2247, 1258, -222, -1958, -3674, -5108, -6062, -6433,
-    -6258, -5720, -5106, -4723, -4811, -5484, -6686, -8200, -9733, -11003, -11768, -11847,
-    -11169, -9785, -7843, -5559, -3173, -886, 1196, 3020, 4520, 5572, 5993, 5593,
-    4281, 2159, -444, -3027, -5016, -5911, -5443, -3640, -820, 2462, 5536, 7799,
-    8860, 8585, 7091, 4690, 1789, -1205, -3907, -5940, -6964, -6747, -5218, -2520,
-    962, 4644, 7889, 10155, 11114, 10712, 9156, 6793, 4001, 1128, -1522, -3694,
-    -5177, -5802, -5503, -4398, -2809, -1192, -32, 286, -383, -1848, -3632, -5123,
-    -5765, -5247, -3641, -1401, 809, 2343, 2765, 1936, 27, -2558, -5298, -7675,
-    -9248, -9729, -9039, -7334, -4973, -2437, -228, 1248, 1771, 1370, 322, -915,
-    -1807, -1905, -991, 824, 3132, 5361, 6942, 7442, 6673, 4730, 1946, -1176,
-    -4049, -6106, -6936, -6379, -4544, -1772, 1428, 4473, 6809, 8001, 7813, 6286,
-    3752, 781, -1958, -3851, -4484, -3733, -1775, 975, 3948, 6538, 8234, 8738,
-    8017, 6279, 3885, 1252, -1251, -3367, -4960, -5976, -6426, -6377, -5951, -5309,
-    -4624, -4046, -3644, -3373, -3079, -2556, -1636, -279, 1400, 3177, 4791, 6008,
-    6673, 6753, 6319, 5509, 4503, 3507, 2678, 2081, 1683, 1372, 966, 280,
-    -800, -2291, -4120, -6116, -8041, -9642, -10701, -11050, -10580, -9258, -7143, -4424,
-    -1473, 1181, 2992, 3564, 2786, 908, -1499, -3727, -5166, -5449, -4500, -2537,
-    -5, 2543, 4577, 5687, 5672, 4587, 2729, 557, -1421, -2747, -3099, -2362,
-    -665, 1632, 4035, 6066, 7379, 7846, 7590, 6931, 6260, 5916, 6094, 6791,
-    7794, 8759, 9348, 9348, 8720, 7590, 6175, 4681, 3258, 2017, 1046, 398,
-    80, 50, 203, 372, 396, 172, -354, -1211, -2387, -3799, -5305, -6739,
-    -7919, -8688, -8984, -8861, -8457, -7962, -7578, -7452, -7612, -7974, -8378, -8602,
-    -8395, -7569, -6065, -3986, -1599, 682, 2378, 3084, 2610, 1047, -1231, -3661,
-    -5638, -6672, -6506, -5161, -2906, -156, 2633, 5048, 6777, 7647, 7637, 6857,
-    5538, 4028, 2750, 2085, 2253, 3231, 4741, 6292, 7323, 7393, 6334, 4281,
-    1600, -1229, -3727, -5525, -6397, -6254, -5142, -3243, -877, 1522, 3480, 4607,
-    4731, 3978, 2750, 1618, 1120, 1569, 2956, 4981, 7154, 8940, 9917, 9874,
-    8816, 6919, 4492, 1937, -308, -1846, -2407, -1940, -669, 936, 2268, 2773,
-    2130, 373, -2133, -4808, -7021, -8270, -8307, -7154, -5051, -2392, 348, 2706,
-    4290, 4814, 4159, 2465, 126, -2302, -4246, -5257, -5152, -4067, -2381, -563,
-    962, 1917, 2205, 1901, 1190, 332, -378, -671, -350, 675, 2340, 4407,
-    6506, 8253, 9364, 9730, 9434, 8714, 7882, 7216, 6880, 6902, 7189, 7548,
-    7733, 7509, 6730, 5373, 3543, 1486, -457, -1928, -2646, -2479, -1503, -36,
-    1449, 2461, 2614, 1719, -150, -2676, -5382, -7748, -9293, -9683, -8811, -6825,
-    -4070, -1018, 1825, 4009, 5209, 5252, 4122, 2000, -741, -3578, -5947, -7362,
-    -7564, -6607, -4826, -2726, -842, 392, 723, 104, -1334, -3315, -5450, -7309,
-    -8533, -8908, -8415, -7206, -5568, -3820, -2216, -888, 148, 964, 1687, 2448,
-    3337, 4373, 5503, 6622, 7581, 8205, 8335, 7880, 6862, 5430, 3841, 2398,
-    1353, 822, 772, 1042, 1384, 1534, 1288, 546, -676, -2239, -3903, -5393,
-    -6463, -6931, -6701, -5781, -4266, -2322, -176, 1898, 3619, 4747, 5132, 4747,
-    3695, 2166, 392, -1380, -2919, -4037, -4614, -4602, -4052, -3123, -2048, -1064,
-    -349, 18, 66, -99, -356, -614, -829, -1006, -1199, -1498, -2004, -2787,
-    -3857, -5150, -6522, -7775, -8716, -9220, -9258, -8861, -8102, -7087, -5939, -4775,
-    -3699, -2809, -2159, -1741, -1496, -1331, -1130, -778, -218, 512, 1275, 1862,
-    2057, 1727, 900, -221, -1330, -2110, -2339, -1948, -1029, 227, 1599, 2912,
-    4056, 4977, 5659, 6117, 6405, 6624, 6909, 7372, 8051, 8871, 9676, 10281,
-    10550, 10435, 9943, 9090, 7900, 6440, 4809, 3138, 1575, 257, -750, -1465,
-    -1952, -2290, -2572, -2893, -3324, -3889, -4559, -5245, -5812, -6113, -6034, -5532,
-    -4658, -3561, -2459, -1601, -1222, -1474, -2384, -3852, -5659, -7499, -9037, -10000,
-    -10224, -9675, -8463, -6808, -4964, -3160, -1575, -313, 628, 1320, 1862, 2350,
-    2869, 3469, 4150, 4878, 5602, 6227, 6611, 6591, 6038, 4907, 3296, 1453,
-    -261, -1477, -1927, -1521, -363, 1287, 3081, 4676, 5822, 6403, 6434, 6047,
-    5457, 4885, 4478, 4280, 4239, 4222, 4052, 3585, 2760, 1603, 197, -1346,
-    -2927, -4486, -5985, -7358, -8476, -9160, -9231, -8596, -7313, -5620, -3871, -2431,
-    -1555, -1319, -1603, -2144, -2635, -2826, -2601, -1980, -1101, -176, 551, 869,
-    649, -140, -1392, -2861, -4217, -5165, -5542, -5371, -4855, -4300, -4004, -4159,
-    -4817, -5897, -7210, -8516, -9569, -10149, -10097, -9368, -8057, -6356, -4507, -2770,
-    -1387, -526, -237, -455, -1015, -1661, -2102, -2093, -1507, -346, 1282, 3195,
-    5164, 6943, 8305, 9081, 9190, 8658, 7605, 6218, 4706, 3257, 2009, 1050,
-    443, 221, 391, 928, 1770, 2798, 3826, 4630, 5014, 4857, 4133, 2917,
-    1358, -378, -2152, -3857, -5399, -6693, -7672, -8281, -8479, -8241, -7579, -6526,
-    -5125, -3442, -1591, 267, 1931, 3180, 3802, 3638, 2640, 889, -1407, -3947,
-    -6368, -8314, -9516, -9847, -9324, -8082, -6345, -4393, -2496, -878, 298, 949,
-    1090, 817, 272, -404, -1085, -1657, -2023, -2102, -1858, -1322, -595, 193,
-    927, 1532, 1981, 2304, 2584, 2933, 3466, 4262, 5332, 6591, 7871, 8976,
-    9759, 10153, 10175, 9906, 9467, 8994, 8614, 8416, 8400, 8474, 8474, 8232,
-    7632, 6654, 5356, 3848, 2249, 677, -746, -1885, -2600, -2792, -2440, -1624,
-    -507, 689, 1731, 2432, 2707, 2590, 2206, 1734, 1345, 1147, 1145, 1253,
-    1340, 1269, 918, 205, -887, -2298, -3900, -5524, -6974, -8065, -8665, -8713,
-    -8213, -7219, -5851, -4283, -2715, -1342, -312, 293, 492, 397, 194, 94,
-    283, 862, 1837, 3122, 4564, 5983, 7215, 8151, 8719, 8879, 8631, 8037,
-    7210, 6297, 5452, 4795, 4375, 4156, 4049, 3953, 3772, 3430, 2877, 2123,
-    1245, 373, -333, -740, -789, -539, -119, 332, 727, 1038, 1274, 1447,
-    1528, 1454, 1165, 638, -88, -915, -1714, -2375, -2850, -3149, -3327, -3461,
-    -3598, -3715, -3747, -3638, -3362, -2921, -2359, -1781, -1323, -1111, -1251, -1813,
-    -2783, -4035, -5354, -6506, -7286, -7551, -7242, -6383, -5067, -3432, -1660, 48,
-    1507, 2590, 3232, 3428, 3241, 2780, 2171, 1530, 964, 554, 352, 374,
-    601, 988, 1479, 2011, 2512, 2904, 3126, 3145, 2964, 2634, 2262, 1990,
-    1947, 2218, 2814, 3662, 4632, 5577, 6375, 6928, 7169, 7070, 6632, 5883,
-    4899, 3803, 2726, 1767, 978, 356, -152, -601, -1012, -1367, -1642, -1826,
-    -1943, -2071, -2319, -2777, -3474, -4385, -5438, -6536, -7588, -8514, -9226, -9628,
-    -9635, -9198, -8321, -7084, -5631, -4117, -2666, -1373, -333, 356, 605, 357,
-    -389, -1544, -2923, -4279, -5351, -5915, -5832, -5070, -3715, -1946, 1, 1887,
-    3519, 4770, 5572, 5899, 5768, 5258, 4513, 3726, 3104, 2841, 3072, 3820,
-    4984, 6373, 7743, 8852, 9516, 9644, 9226, 8299, 6931, 5208, 3247, 1203,
-    -737, -2377, -3551, -4148, -4113, -3442, -2189, -488, 1442, 3332, 4908, 5955,
-    6359, 6125, 5363, 4251, 2991, 1784, 811, 212, 58, 344, 998, 1906,
-    2911, 3826, 4471, 4715, 4486, 3776, 2647, 1210, -412, -2114, -3797, -5365,
-    -6734, -7823, -8538, -8801, -8581, -7900, -6830, -5487, -4019, -2568, -1234, -74,
-    886, 1641, 2196, 2576, 2832, 3031, 3238, 3496, 3820, 4176, 4489, 4668,
-    4631, 4311, 3677, 2742, 1560, 223, -1134, -2341, -3241, -3731, -3762, -3341,
-    -2531, -1438, -176, 1148, 2420, 3532, 4402, 4997, 5325, 5424, 5337, 5087,
-    4656, 4002, 3089, 1913, 521, -993, -2506, -3893, -5040, -5859, -6290, -6302,
-    -5909, -5187, -4279, -3384, -2713, -2437, -2633, -3254, -4151, -5115, -5923, -6388,
-    -6408, -5979, -5181, -4152, -3060, -2049, -1205, -548, -54, 342, 717, 1131,
-    1619, 2203, 2889, 3661, 4484, 5314, 6104, 6803, 7362, 7755, 7962, 7972,
-    7795, 7453, 6961, 6319, 5526, 4575, 3453, 2159, 736, -737, -2163, -3442,
-    -4472, -5151, -5405, -5206, -4576, -3607, -2455, -1294, -273, 524, 1073, 1402,
-    1563, 1603, 1568, 1509, 1475, 1495, 1585, 1761, 2026, 2359, 2726, 3077,
-    3347, 3460, 3346, 2959, 2265, 1251, -57, -1572, -3143, -4561, -5610, -6132,
-    -6072, -5478, -4468, -3198, -1823, -464, 792, 1902, 2870, 3725, 4507, 5237,
-    5921, 6533, 7016, 7305, 7361, 7179, 6786, 6234, 5584, 4871, 4095, 3241,
-    2288, 1240, 147, -900, -1811, -2519, -2976, -3136, -2977, -2507, -1774, -873,
-    51, 851, 1417, 1696, 1686, 1429, 991, 440, -154, -706, -1113, -1282,
-    -1159, -731, -45, 804, 1665, 2365, 2735, 2651, 2059, 984, -472, -2169,
-    -3972, -5752, -7385, -8765, -9787, -10345, -10350, -9794, -8756, -7363, -5772, -4168,
-    -2710, -1477, -481, 296, 910, 1454, 1997, 2547, 3092, 3622, 4110, 4511,
-    4793, 4937, 4904, 4644, 4116, 3287, 2139, 699, -948, -2673, -4300, -5631,
-    -6498, -6807, -6529, -5694, -4386, -2745, -942, 835, 2384, 3539, 4202, 4355,
-    4063, 3455, 2697, 1951, 1356, 1010, 935, 1070, 1294, 1461, 1443, 1168,
-    623, -156, -1115, -2196, -3360, -4591, -5875, -7180, -8453, -9612, -10544, -11130,
-    -11290, -11006, -10320, -9329, -8169, -6988, -5909, -5026, -4383, -3953, -3641, -3315,
-    -2871, -2266, -1534, -747, 3, 635, 1071, 1247, 1103, 595, -281, -1464,
-    -2831, -4210, -5408, -6238, -6534, -6189, -5201, -3691, -1876, 8, 1760, 3256,
-    4450, 5340, 5922, 6182, 6111, 5720, 5028, 4071, 2902, 1596, 253, -992,
-    -1995, -2648, -2908, -2806, -2424, -1864, -1215, -558, 25, 444, 616, 473,
-    -15, -828, -1898, -3127, -4392, -5556, -6476, -7037, -7156, -6801, -6025, -4967,
-    -3820, -2780, -1991, -1509, -1288, -1207, -1119, -896, -459, 215, 1103, 2160,
-    3327, 4531, 5669, 6612, 7226, 7378, 6959, 5917, 4290, 2228, -21, -2135,
-    -3771, -4646, -4603, -3650, -1947, 223, 2536, 4695, 6485, 7784, 8567, 8888,
-    8852, 8587, 8225, 7881, 7646, 7571, 7657, 7832, 7968, 7928, 7599, 6928,
-    5936, 4704, 3329, 1876, 383, -1128, -2633, -4091, -5445, -6629, -7594, -8295,
-    -8682, -8708, -8351, -7628, -6594, -5341, -3977, -2602, -1290, -98, 912, 1679,
-    2147, 2276, 2056, 1519, 744, -152, -1031, -1750, -2184, -2255, -1967, -1417,
-    -778, -253, -19, -162, -641, -1309, -1966, -2418, -2530, -2247, -1603, -696,
-    342, 1370, 2255, 2894, 3229, 3249, 2992, 2550, 2063, 1706, 1653, 2035,
-    2878, 4099, 5531, 6973, 8239, 9185, 9722, 9795, 9374, 8477, 7171, 5573,
-    3824, 2067, 417, -1062, -2338, -3404, -4287, -5023, -5623, -6065, -6312, -6311,
-    -6016, -5425, -4602, -3636, -2598, -1557, -606, 151, 616, 700, 349, -427,
-    -1540, -2851, -4190, -5390, -6313, -6881, -7088, -7010, -6768, -6481, -6224, -6025,
-    -5857, -5662, -5384, -4978, -4408, -3660, -2762, -1781, -789, 156, 1008, 1742,
-    2334, 2737, 2873, 2678, 2142, 1330, 377, -521, -1155, -1348, -1008, -131,
-    1190, 2789, 4440, 5904, 6972, 7489, 7371, 6614, 5311, 3637, 1788, -59,
-    -1788, -3348, -4746, -6002, -7102, -7990, -8578, -8772, -8503, -7744, -6524, -4923,
-    -3066, -1110, 761, 2349, 3477, 4033, 3981, 3367, 2320, 1041, -244, -1328,
-    -2041, -2275, -2039, -1458, -755, -194, -22, -393, -1309, -2625, -4099, -5446,
-    -6391, -6725, -6353, -5315, -3785, -2022, -314, 1090, 2042, 2515, 2592, 2428,
-    2214, 2126, 2287, 2738, 3440, 4276, 5066, 5616, 5787, 5518, 4833, 3834,
-    2686, 1572, 633, -53, -489, -760, -1015, -1404, -2035, -2932, -4034, -5204,
-    -6270, -7073, -7492, -7461, -6981, -6103, -4905, -3487, -1959, -440, 947, 2105,
-    2979, 3557, 3865, 3944, 3841, 3617, 3337, 3087, 2958, 3021, 3286, 3686,
-    4089, 4337, 4294, 3903, 3209, 2333, 1436, 680, 195, 38, 189, 579,
-    1120, 1704, 2227, 2622, 2863, 2958, 2943, 2886, 2858, 2900, 3017, 3193,
-    3397, 3585, 3728, 3818, 3855, 3833, 3750, 3604, 3392, 3107, 2738, 2270,
-    1674, 905, -82, -1297, -2711, -4251, -5815, -7268, -8466, -9261, -9516, -9137,
-    -8121, -6583, -4722, -2759, -895, 725, 2022, 2984, 3634, 4016, 4191, 4236,
-    4225, 4219, 4266, 4385, 4557, 4735, 4869, 4908, 4817, 4574, 4173, 3612,
-    2894, 2023, 1009, -111, -1251, -2290, -3088, -3529, -3533, -3070, -2177, -965,
-    415, 1807, 3084, 4163, 5011, 5629, 6011, 6127, 5934, 5415, 4602, 3590,
-    2522, 1549, 801, 363, 269, 490, 936, 1481, 1970, 2248, 2209, 1817,
-    1098, 104, -1099, -2446, -3868, -5285, -6584, -7640, -8346, -8639, -8485, -7908,
-    -6999, -5911, -4818, -3878, -3188, -2745, -2446, -2150, -1734, -1124, -297, 698,
-    1761, 2775, 3634, 4264, 4637, 4792, 4808, 4764, 4707, 4631, 4477, 4164,
-    3627, 2847, 1842, 660, -635, -1962, -3218, -4273, -4991, -5283, -5121, -4534,
-    -3602, -2461, -1275, -204, 608, 1065, 1152, 937, 537, 83, -296, -498,
-    -467, -174, 381, 1134, 1945, 2626, 2992, 2898, 2286, 1206, -221, -1862,
-    -3585, -5263, -6784, -8051, -8960, -9414, -9351, -8768, -7704, -6253, -4558, -2771,
-    -1020, 603, 2035, 3253, 4285, 5171, 5934, 6560, 7024, 7294, 7367, 7287,
-    7126, 6944, 6766, 6581, 6345, 6008, 5535, 4917, 4166, 3306, 2373, 1387,
-    335, -813, -2055, -3343, -4592, -5690, -6533, -7054, -7242, -7123, -6740, -6166,
-    -5496, -4814, -4172, -3581, -2998, -2329, -1487, -444, 748, 1973, 3086, 3959,
-    4511, 4694, 4476, 3849, 2838, 1506, -34, -1625, -3097, -4295, -5098, -5423,
-    -5250, -4627, -3639, -2392, -1021, 349, 1624, 2754, 3730, 4584, 5374, 6149,
-    6935, 7728, 8483, 9116, 9539, 9697, 9562, 9137, 8468, 7639, 6745, 5880,
-    5140, 4588, 4215, 3950, 3684, 3311, 2741, 1925, 858, -430, -1889, -3445,
-    -5008, -6470, -7712, -8600, -9009, -8861, -8163, -7008, -5552, -3983, -2476, -1168,
-    -126, 658, 1254, 1762, 2264, 2788, 3297, 3707, 3924, 3883, 3584, 3085,
-    2481, 1881, 1374, 992, 695, 405, 30, -503, -1227, -2101, -3014, -3811,
-    -4329, -4444, -4099, -3338, -2270, -1043, 196, 1329, 2271, 2973, 3420, 3642,
-    3719, 3762, 3885, 4170, 4625, 5187, 5763, 6259, 6608, 6779, 6763, 6554,
-    6136, 5501, 4656, 3607, 2362, 945, -599, -2222, -3868, -5461, -6903, -8072,
-    -8838, -9092, -8789, -7965, -6730, -5235, -3651, -2133, -793, 321, 1226, 1984,
-    2678, 3368, 4061, 4719, 5278, 5678, 5885, 5894, 5726, 5407, 4959, 4411,
-    3784, 3088, 2316, 1446, 456, -660, -1867, -3060, -4089, -4802, -5096, -4936,
-    -4365, -3497, -2481, -1470, -579, 144, 727, 1237, 1748, 2323, 3002, 3781,
-    4620, 5445, 6143, 6566, 6578, 6112, 5181, 3879, 2368, 821, -631, -1919,
-    -3022, -3960, -4792, -5581, -6371, -7171, -7947, -8611, -9048, -9158, -8888, -8250,
-    -7317, -6210, -5055, -3955, -2989, -2196, -1552, -981, -390, 310, 1195, 2304,
-    3612, 5026, 6408, 7605, 8486, 8975, 9053, 8747, 8138, 7361, 6578, 5926,
-    5489, 5277, 5201, 5100, 4814, 4231, 3300, 2020, 448, -1315, -3162, -4990,
-    -6695, -8173, -9342, -10147, -10552, -10547, -10157, -9440, -8478, -7374, -6232, -5126,
-    -4097, -3157, -2284, -1443, -619, 169, 894, 1532, 2060, 2462, 2751, 2948,
-    3060, 3066, 2939, 2639, 2140, 1455, 651, -160, -849, -1290, -1393, -1133,
-    -557, 238, 1148, 2075, 2949, 3735, 4422, 5009, 5491, 5846, 6035, 5996,
-    5663, 4989, 3973, 2678, 1231, -186, -1378, -2186, -2557, -2561, -2373, -2206,
-    -2250, -2615, -3292, -4155, -4993, -5573, -5716, -5339, -4475, -3255, -1876, -559,
-    483, 1074, 1103, 546, -525, -1955, -3528, -4996, -6123, -6734, -6757, -6214,
-    -5191, -3824, -2270, -678, 830, 2149, 3187, 3871, 4156, 4025, 3482, 2560,
-    1322, -122, -1614, -2969, -4015, -4615, -4696, -4272, -3438, -2317, -1031, 313,
-    1630, 2867, 3994, 4994, 5858, 6565, 7066, 7294, 7191, 6720, 5857, 4623,
-    3099, 1405, -324, -1953, -3365, -4469, -5204, -5519, -5374, -4745, -3648, -2180,
-    -510, 1155, 2624, 3756, 4490, 4849, 4895, 4677, 4215, 3520, 2620, 1557,
-    387, -836, -2067, -3286, -4478, -5617, -6651, -7516, -8140, -8462, -8441, -8077,
-    -7438, -6645, -5833, -5119, -4590, -4281, -4162, -4148, -4124, -3978, -3601, -2912,
-    -1878, -535, 1022, 2660, 4229, 5592, 6657, 7375, 7724, 7695, 7308, 6604,
-    5622, 4409, 3028, 1554, 41, -1488, -3012, -4504, -5926, -7210, -8250, -8917,
-    -9100, -8728, -7807, -6437, -4809, -3147, -1649, -427, 506, 1209, 1760, 2233,
-    2679, 3113, 3511, 3830, 4020, 4032, 3825, 3385, 2715, 1824, 728, -568,
-    -2051, -3682, -5358, -6928, -8225, -9089, -9403, -9113, -8232, -6832, -5041, -3056,
-    -1107, 609, 1981, 2996, 3709, 4193, 4502, 4636, 4540, 4146, 3434, 2458,
-    1311, 89, -1126, -2267, -3311, -4264, -5145, -5974, -6774, -7557, -8291, -8911,
-    -9346, -9525, -9376, -8857, -7979, -6793, -5379, -3847, -2329, -946, 209, 1075,
-    1623, 1869, 1876, 1722, 1489, 1262, 1125, 1151, 1395, 1884, 2607, 3505,
-    4493, 5478, 6364, 7059, 7490, 7605, 7375, 6791, 5865, 4647, 3212, 1653,
-    64, -1471, -2891, -4149, -5193, -5970, -6427, -6537, -6296, -5718, -4825, -3658,
-    -2276, -745, 870, 2479, 3946, 5110, 5828, 6002, 5589, 4628, 3238, 1585,
-    -173, -1900, -3498, -4912, -6118, -7095, -7807, -8221, -8302, -8006, -7305, -6237,
-    -4908, -3468, -2066, -819, 225, 1084, 1817, 2490, 3164, 3882, 4669, 5534,
-    6447, 7342, 8150, 8821, 9320, 9615, 9686, 9512, 9050, 8258, 7133, 5719,
-    4088, 2333, 565, -1126, -2677, -4020, -5083, -5815, -6215, -6311, -6156, -5823,
-    -5391, -4910, -4398, -3846, -3226, -2501, -1652, -687, 368, 1476, 2587, 3627,
-    4496, 5087, 5313, 5137, 4583, 3730, 2693, 1586, 494, -530, -1446, -2207,
-    -2756, -3033, -2983, -2568, -1781, -666, 693, 2191, 3705, 5117, 6349, 7370,
-    8177, 8780, 9192, 9434, 9506, 9400, 9105, 8620, 7949, 7108, 6135, 5095,
-    4094, 3275, 2789, 2736, 3113, 3797, 4565, 5161, 5367, 5051, 4173, 2795,
-    1051, -899, -2904, -4846, -6621, -8149, -9356, -10163, -10486, -10276, -9546, -8380,
-    -6912, -5294, -3664, -2124, -747, 427, 1385, 2135, 2693, 3072, 3276, 3286,
-    3044, 2481, 1571, 389, -900, -2073, -2891, -3157, -2783, -1802, -344, 1413,
-    3276, 5078, 6693, 8034, 9046, 9705, 9993, 9882, 9347, 8394, 7070, 5462,
-    3700, 1925, 231, -1351, -2832, -4242, -5618, -6958, -8205, -9262, -10030, -10414,
-    -10348, -9826, -8907, -7687, -6287, -4844, -3466, -2198, -1056, -43, 846, 1646,
-    2388, 3075, 3682, 4164, 4461, 4537, 4410, 4150, 3847, 3578, 3398, 3321,
-    3337, 3430, 3601, 3850, 4155, 4474, 4759, 4942, 4934, 4657, 4071, 3180,
-    2023, 678, -758, -2198, -3554, -4735, -5650, -6224, -6404, -6172, -5573, -4711,
-    -3720, -2739, -1882, -1201, -696, -342, -118, -11, -29, -199, -550, -1103,
-    -1882, -2894, -4106, -5428, -6727, -7847, -8642, -9008, -8901, -8328, -7340, -6033,
-    -4528, -2949, -1395, 71, 1428, 2667, 3757, 4640, 5244, 5493, 5326, 4717,
-    3678, 2280, 679, -888, -2149, -2841, -2778, -1912, -363, 1643, 3842, 5954,
-    7713, 8933, 9521, 9462, 8808, 7685, 6267, 4724, 3205, 1824, 642, -335,
-    -1142, -1846, -2537, -3290, -4143, -5087, -6075, -7024, -7825, -8370, -8564, -8352,
-    -7746, -6817, -5670, -4427, -3199, -2069, -1080, -242, 471, 1116, 1748, 2386,
-    3016, 3603, 4105, 4471, 4664, 4654, 4419, 3962, 3322, 2574, 1805, 1102,
-    522, 81, -230, -419, -483, -400, -124, 403, 1220, 2327, 3677, 5159,
-    6608, 7830, 8638, 8890, 8513, 7532, 6053, 4232, 2255, 293, -1540, -3209,
-    -4717, -6057, -7205, -8120, -8741, -9008, -8885, -8390, -7588, -6586, -5522, -4519,
-    -3648, -2920, -2315, -1800, -1321, -813, -223, 486, 1337, 2317, 3375, 4447,
-    5478, 6417, 7208, 7793, 8121, 8143, 7834, 7204, 6288, 5134, 3803, 2382,
-    967, -321, -1338, -1954, -2115, -1848, -1237, -412, 477, 1302, 1979, 2469,
-    2767, 2896, 2895, 2787, 2573, 2252, 1829, 1319, 737, 101, -581, -1313,
-    -2102, -2955, -3872, -4851, -5878, -6926, -7943, -8859, -9593, -10046, -10122, -9756,
-    -8937, -7698, -6122, -4347, -2536, -826, 711, 2047, 3191, 4174, 5026, 5752,
-    6336, 6747, 6936, 6836, 6393, 5593, 4459, 3054, 1470, -197, -1867, -3476,
-    -4971, -6321, -7495, -8443, -9092, -9379, -9270, -8776, -7961, -6928, -5784, -4626,
-    -3547, -2618, -1857, -1241, -733, -290, 134, 559, 974, 1357, 1704, 2017,
-    2290, 2494, 2560, 2394, 1917, 1111, 37, -1162, -2279, -3106, -3484, -3343,
-    -2703, -1663, -365, 1051, 2472, 3818, 5045, 6152, 7162, 8103, 8983, 9758,
-    10327, 10567, 10384, 9737, 8658, 7261, 5712, 4170, 2772, 1615, 724, 29,
-    -595, -1270, -2087, -3094, -4246, -5392, -6343, -6946, -7105, -6777, -5995, -4877,
-    -3593, -2304, -1147, -206, 519, 1098, 1623, 2174, 2821, 3601, 4489, 5408,
-    6272, 7006, 7560, 7925, 8115, 8139, 7993, 7676, 7195, 6557, 5776, 4868,
-    3850, 2750, 1630, 591, -254, -801, -976, -770, -259, 417, 1079, 1550,
-    1711, 1547, 1148, 677, 322, 231, 459, 957, 1617, 2308, 2889, 3251,
-    3337, 3146, 2720, 2126, 1433, 669, -167, -1073, -2034, -3024, -3985, -4812,
-    -5368, -5523, -5185, -4333, -3037, -1454, 220, 1804, 3166, 4237, 5002, 5494,
-    5776, 5922, 5999, 6052, 6110, 6187, 6271, 6326, 6313, 6207, 5990, 5635,
-    5128, 4460, 3622, 2612, 1449, 161, -1232, -2700, -4189, -5643, -7013, -8234,
-    -9209, -9829, -10018, -9753, -9063, -8030, -6772, -5409, -4044, -2768, -1642, -695,
-    79, 700, 1180, 1511, 1656, 1566, 1196, 531, -389, -1453, -2491, -3323,
-    -3796, -3810, -3340, -2455, -1300, -36, 1195, 2300, 3239, 4029, 4717, 5343,
-    5900, 6335, 6575, 6550, 6215, 5573, 4663, 3542, 2263, 865, -617, -2144,
-    -3664, -5120, -6455, -7614, -8530, -9132, -9349, -9127, -8448, -7372, -6022, -4554,
-    -3113, -1804, -677, 280, 1115, 1871, 2574, 3222, 3792, 4250, 4568, 4732,
-    4743, 4627, 4433, 4193, 3903, 3529, 3015, 2297, 1336, 159, -1145, -2460,
-    -3656, -4610, -5217, -5421, -5223, -4688, -3940, -3148, -2470, -2005, -1764, -1684,
-    -1649, -1524, -1212, -693, -35, 640, 1191, 1496, 1487, 1191, 696, 124,
-    -406, -805, -1032, -1120, -1141, -1190, -1365, -1727, -2281, -2959, -3650, -4213,
-    -4508, -4414, -3871, -2897, -1590, -91, 1443, 2887, 4172, 5289, 6262, 7113,
-    7836, 8401, 8771, 8891, 8699, 8145, 7229, 6006, 4573, 3038, 1498, 25,
-    -1350, -2635, -3857, -5033, -6148, -7156, -7982, -8535, -8731, -8533, -7952, -7048,
-    -5928, -4732, -3586, -2575, -1733, -1044, -443, 165, 858, 1664, 2559, 3490,
-    4375, 5125, 5676, 6008, 6105, 5944, 5510, 4821, 3912, 2828, 1636, 420,
-    -745, -1803, -2716, -3450, -3964, -4207, -4134, -3737, -3073, -2261, -1452, -775,
-    -303, -27, 112, 199, 310, 476, 660, 782, 748, 470, -107, -993,
-    -2140, -3465, -4870, -6252, -7503, -8514, -9170, -9363, -9016, -8127, -6782, -5131,
-    -3347, -1594, 0, 1364, 2482, 3358, 3995, 4388, 4525, 4416, 4110, 3694,
-    3252, 2835, 2470, 2158, 1869, 1547, 1141, 610, -78, -921, -1847, -2731,
-    -3438, -3858, -3936, -3694, -3235, -2726, -2349, -2254, -2505, -3061, -3788, -4483,
-    -4934, -4994, -4620, -3878, -2906, -1887, -981, -288, 136, 267, 126, -228,
-    -731, -1320, -1935, -2538, -3139, -3760, -4413, -5090, -5757, -6321, -6661, -6691,
-    -6374, -5702, -4709, -3476, -2106, -691, 683, 1950, 3100, 4169, 5188, 6163,
-    7069, 7836, 8358, 8531, 8291, 7634, 6621, 5355, 3950, 2518, 1163, -43,
-    -1075, -1950, -2703, -3383, -4035, -4682, -5331, -5969, -6545, -6972, -7165, -7061,
-    -6631, -5897, -4931, -3824, -2668, -1541, -498, 463, 1369, 2246, 3100, 3913,
-    4643, 5243, 5695, 5990, 6126, 6115, 5988, 5747, 5345, 4731, 3873, 2752,
-    1381, -173, -1808, -3417, -4883, -6078, -6890, -7245, -7117, -6536, -5590, -4411,
-    -3142, -1920, -841, 52, 752, 1269, 1634, 1908, 2152, 2408, 2699, 3034,
-    3409, 3812, 4239, 4691, 5156, 5617, 6054, 6432, 6696, 6788, 6647, 6221,
-    5475, 4420, 3118, 1692, 325, -771, -1403, -1461, -938, 74, 1413, 2893,
-    4341, 5625, 6646, 7327, 7605, 7438, 6813, 5759, 4351, 2702, 942, -795,
-    -2396, -3774, -4864, -5627, -6046, -6113, -5811, -5150, -4196, -3070, -1912, -856,
-    -24, 524, 805, 901, 923, 987, 1176, 1512, 1962, 2478, 3005, 3489,
-    3903, 4245, 4515, 4719, 4886, 5050, 5232, 5436, 5643, 5798, 5830, 5683,
-    5318, 4717, 3894, 2897, 1775, 575, -635, -1769, -2761, -3571, -4179, -4612,
-    -4919, -5136, -5260, -5259, -5077, -4645, -3946, -3037, -2021, -1039, -248, 208,
-    246, -157, -980, -2132, -3447, -4725, -5775, -6429, -6579, -6200, -5333, -4072,
-    -2554, -934, 665, 2153, 3471, 4606, 5578, 6387, 7003, 7409, 7618, 7658,
-    7559, 7362, 7096, 6746, 6275, 5646, 4826, 3799, 2587, 1242, -172, -1578,
-    -2882, -3985, -4799, -5258, -5355, -5158, -4781, -4349, -3969, -3705, -3540, -3390,
-    -3162, -2787, -2246, -1579, -871, -239, 212, 410, 343, 55, -390, -943,
-    -1564, -2207, -2824, -3354, -3725, -3864, -3720, -3279, -2559, -1615, -532, 590,
-    1658, 2606, 3406, 4053, 4574, 5017, 5440, 5888, 6367, 6850, 7289, 7632,
-    7811, 7756, 7408, 6750, 5807, 4653, 3391, 2133, 953, -121, -1100, -2034,
-    -3000, -4062, -5237, -6491, -7748, -8900, -9811, -10349, -10406, -9926, -8927, -7513,
-    -5850, -4119, -2473, -1006, 265, 1374, 2365, 3283, 4169, 5027, 5815, 6470,
-    6941, 7187, 7173, 6889, 6351, 5593, 4657, 3595, 2457, 1277, 80, -1116,
-    -2307, -3486, -4628, -5692, -6637, -7425, -8017, -8379, -8490, -8342, -7955, -7385,
-    -6704, -5974, -5230, -4476, -3686, -2833, -1916, -973, -39, 865, 1724, 2524,
-    3254, 3899, 4432, 4827, 5077, 5184, 5146, 4955, 4585, 4003, 3193, 2183,
-    1039, -159, -1330, -2397, -3297, -3985, -4429, -4618, -4585, -4407, -4180, -3991,
-    -3888, -3864, -3862, -3792, -3565, -3136, -2519, -1791, -1066, -479, -151, -152,
-    -471, -1040, -1758, -2534, -3321, -4116, -4919, -5709, -6428, -6993, -7314, -7310,
-    -6935, -6183, -5075, -3680, -2109, -498, 1036, 2419, 3621, 4653, 5551, 6344,
-    7030, 7579, 7954, 8133, 8101, 7850, 7375, 6680, 5791, 4762, 3659, 2531,
-    1404, 288, -822, -1957, -3159, -4438, -5762, -7055, -8206, -9094, -9624, -9744,
-    -9440, -8743, -7738, -6539, -5257, -3996, -2857, -1902, -1134, -513, 26, 568,
-    1189, 1916, 2713, 3510, 4242, 4861, 5336, 5623, 5664, 5408, 4822, 3906,
-    2716, 1402, 164, -793, -1292, -1203, -493, 743, 2314, 3982, 5497, 6667,
-    7404, 7701, 7582, 7097, 6321, 5349, 4285, 3236, 2289, 1476, 777, 128,
-    -556, -1360, -2326, -3452, -4712, -6039, -7315, -8396, -9140, -9424, -9172, -8387,
-    -7144, -5563, -3800, -2031, -411, 969, 2085, 2975, 3718, 4398, 5067, 5745,
-    6431, 7097, 7688, 8141, 8411, 8471, 8300, 7878, 7194, 6260, 5102, 3767,
-    2306, 759, -846, -2474, -4057, -5499, -6700, -7570, -8023, -8001, -7506, -6610,
-    -5443, -4168, -2946, -1894, -1062, -437, 40, 456, 886, 1382, 1968, 2648,
-    3396, 4175, 4931, 5588, 6054, 6249, 6113, 5597, 4681, 3417, 1944, 462,
-    -801, -1635, -1907, -1603, -814, 297, 1522, 2645, 3498, 3990, 4097, 3853,
-    3341, 2651, 1866, 1039, 219, -561, -1294, -2009, -2751, -3562, -4463, -5433,
-    -6421, -7361, -8178, -8786, -9087, -8997, -8472, -7514, -6178, -4566, -2815, -1055,
-    620, 2160, 3550, 4788, 5863, 6725, 7303, 7539, 7399, 6891, 6073, 5056,
-    3981, 2991, 2205, 1690, 1434, 1352, 1310, 1166, 790, 112, -862, -2067,
-    -3403, -4756, -6012, -7089, -7927, -8465, -8649, -8454, -7893, -7007, -5884, -4647,
-    -3411, -2256, -1224, -324, 477, 1222, 1930, 2597, 3221, 3784, 4244, 4541,
-    4622, 4436, 3965, 3248, 2406, 1622, 1110, 1054, 1549, 2566, 3954, 5491,
-    6927, 8046, 8707, 8850, 8499, 7739, 6677, 5417, 4073, 2758, 1558, 518,
-    -353, -1087, -1763, -2465, -3251, -4145, -5124, -6104, -6955, -7556, -7816, -7675,
-    -7129, -6240, -5114, -3885, -2694, -1654, -818, -182, 296, 692, 1100, 1592,
-    2195, 2916, 3741, 4621, 5510, 6383, 7222, 7985, 8627, 9094, 9307, 9176,
-    8640, 7681, 6307, 4566, 2566, 449, -1645, -3574, -5201, -6419, -7170, -7434,
-    -7222, -6601, -5693, -4631, -3536, -2497, -1552, -695, 100, 862, 1602, 2312,
-    2961, 3502, 3894, 4120, 4201, 4190, 4142, 4074, 3966, 3752, 3354, 2698,
-    1757, 568, -754, -2024, -3007, -3493, -3364, -2639, -1471, -98, 1226, 2310,
-    3057, 3463, 3577, 3482, 3267, 3026, 2831, 2715, 2667, 2642, 2571, 2381,
-    2015, 1456, 730, -117, -1023, -1939, -2837, -3727, -4625, -5512, -6316, -6927,
-    -7219, -7080, -6457, -5370, -3912, -2225, -479, 1176, 2644, 3879, 4871, 5641,
-    6229, 6663, 6935, 7026, 6916, 6595, 6063, 5327, 4395, 3274, 2001, 639,
-    -747, -2118, -3443, -4697, -5862, -6920, -7833, -8549, -9022, -9197, -9016, -8446,
-    -7520, -6337, -5033, -3738, -2539, -1459, -479, 435, 1309, 2155, 2965, 3717,
-    4387, 4950, 5392, 5697, 5843, 5796, 5520, 4994, 4201, 3134, 1829, 358,
-    -1200, -2786, -4343, -5807, -7099, -8111, -8714, -8805, -8360, -7436, -6153, -4664,
-    -3117, -1626, -260, 939, 1959, 2798, 3457, 3935, 4248, 4420, 4478, 4447,
-    4353, 4198, 3957, 3590, 3065, 2359, 1462, 400, -776, -1997, -3185, -4246,
-    -5087, -5640, -5880, -5833, -5580, -5222, -4853, -4534, -4273, -4020, -3684, -3179,
-    -2455, -1523, -455, 612, 1524, 2156, 2432, 2332, 1895, 1210, 379, -520,
-    -1425, -2288, -3068, -3733, -4240, -4531, -4553, -4280, -3731, -2964, -2053, -1067,
-    -64, 918, 1867, 2792, 3702, 4593, 5438, 6178, 6715, 6946, 6800, 6251,
-    5321, 4091, 2692, 1264, -89, -1315, -2407, -3393, -4311, -5182, -6015, -6823,
-    -7610, -8354, -8994, -9453, -9650, -9519, -9036, -8234, -7183, -5974, -4694, -3403,
-    -2114, -811, 516, 1867, 3220, 4526, 5704, 6670, 7357, 7735, 7813, 7640,
-    7272, 6761, 6138, 5419, 4622, 3762, 2857, 1908, 908, -150, -1267, -2436,
-    -3626, -4761, -5743, -6474, -6873, -6900, -6586, -6010, -5246, -4357, -3416, -2499,
-    -1655, -919, -322, 128, 460, 710, 912, 1101, 1320, 1587, 1888, 2188,
-    2432, 2514, 2314, 1756, 831, -386, -1737, -3000, -3950, -4415, -4312, -3655,
-    -2557, -1180, 302, 1734, 3003, 4050, 4857, 5423, 5762, 5885, 5796, 5484,
-    4941, 4183, 3259, 2246, 1240, 328, -440, -1057, -1547, -1965, -2371, -2825,
-    -3376, -4043, -4789, -5520, -6106, -6408, -6306, -5741, -4735, -3375, -1783, -101,
-    1541, 3047, 4369, 5499, 6454, 7266, 7961, 8533, 8936, 9099, 8937, 8392,
-    7463, 6201, 4695, 3060, 1417, -127, -1505, -2703, -3749, -4689, -5541, -6275,
-    -6830, -7136, -7120, -6721, -5922, -4768, -3355, -1818, -306, 1044, 2164, 3052,
-    3758, 4355, 4918, 5508, 6144, 6802, 7422, 7924, 8219, 8216, 7847, 7083,
-    5941, 4472, 2750, 852, -1134, -3100, -4908, -6407, -7463, -7992, -7974, -7444,
-    -6494, -5271, -3946, -2680, -1591, -737, -115, 350, 769, 1255, 1875, 2649,
-    3548, 4502, 5430, 6281, 7036, 7673, 8152, 8412, 8391, 8035, 7308, 6207,
-    4769, 3063, 1209, -639, -2323, -3706, -4686, -5203, -5249, -4866, -4149, -3237,
-    -2292, -1446, -765, -230, 228, 685, 1191, 1738, 2282, 2764, 3152, 3424,
-    3541, 3442, 3075, 2423, 1530, 514, -451, -1175, -1495, -1301, -557, 669,
-    2235, 3975, 5725, 7341, 8735, 9874, 10737, 11273, 11440, 11228, 10649, 9736,
-    8565, 7243, 5866, 4520, 3299, 2258, 1370, 557, -263, -1167, -2227, -3478,
-    -4892, -6388, -7831, -9041, -9821, -10014, -9547, -8452, -6863, -4991, -3058, -1248,
-    325, 1632, 2723, 3674, 4552, 5399, 6215, 6948, 7516, 7847, 7893, 7641,
-    7115, 6367, 5436, 4335, 3075, 1674, 154, -1442, -3037, -4514, -5753, -6645,
-    -7105, -7103, -6678, -5926, -4998, -4057, -3241, -2617, -2181, -1879, -1629, -1345,
-    -966, -459, 187, 963, 1831, 2742, 3643, 4477, 5186, 5713, 5993, 5954,
-    5551, 4771, 3637, 2199, 552, -1151, -2720, -3955, -4668, -4741, -4163, -3040,
-    -1571, -6, 1414, 2496, 3125, 3268, 2980, 2380, 1606, 779, -17, -750,
-    -1442, -2138, -2862, -3607, -4357, -5097, -5805, -6467, -7086, -7651, -8104, -8366,
-    -8364, -8052, -7416, -6509, -5444, -4354, -3357, -2552, -1977, -1589, -1292, -981,
-    -559, 39, 810, 1673, 2504, 3172, 3544, 3526, 3097, 2290, 1174, -142,
-    -1526, -2873, -4125, -5258, -6280, -7233, -8156, -9037, -9813, -10397, -10683, -10572,
-    -10015, -9029, -7692, -6134, -4515, -2974, -1606, -453, 501, 1348, 2203, 3125,
-    4105, 5084, 5962, 6612, 6914, 6779, 6156, 5049, 3540, 1762, -145, -2053,
-    -3869, -5557, -7115, -8531, -9752, -10684, -11207, -11214, -10654, -9551, -7995, -6144,
-    -4211, -2395, -824, 449, 1436, 2197, 2813, 3347, 3829, 4270, 4672, 5002,
-    5215, 5279, 5182, 4920, 4506, 3946, 3228, 2314, 1179, -173, -1699, -3319,
-    -4919, -6366, -7536, -8330, -8686, -8586, -8055, -7157, -5992, -4687, -3353, -2063,
-    -866, 204, 1152, 2019, 2841, 3623, 4351, 5000, 5516, 5834, 5925, 5785,
-    5423, 4855, 4121, 3252, 2259, 1160, 24, -1043, -1908, -2425, -2491, -2113,
-    -1402, -537, 284, 884, 1163, 1134, 904, 647, 548, 737, 1233, 1955,
-    2758, 3476, 3972, 4187, 4139, 3891, 3511, 3056, 2556, 2020, 1442, 814,
-    122, -642, -1443, -2192, -2752, -2972, -2726, -1951, -672, 1002, 2886, 4776,
-    6495, 7918, 8979, 9647, 9920, 9801, 9288, 8388, 7134, 5590, 3863, 2085,
-    368, -1216, -2622, -3813, -4758, -5440, -5870, -6100, -6226, -6360, -6554, -6765,
-    -6869, -6722, -6207, -5278, -3966, -2378, -658, 1049, 2625, 3997, 5129, 6028,
-    6731, 7284, 7698, 7946, 7992, 7825, 7463, 6938, 6292, 5563, 4777, 3948,
-    3089, 2198, 1254, 239, -848, -2001, -3198, -4405, -5562, -6608, -7465, -8037,
-    -8230, -8000, -7355, -6359, -5133, -3844, -2655, -1679, -971, -521, -248, -22,
-    268, 684, 1234, 1896, 2627, 3391, 4175, 4969, 5747, 6440, 6943, 7138,
-    6934, 6295, 5239, 3827, 2168, 388, -1419, -3204, -4935, -6555, -7989, -9145,
-    -9920, -10242, -10110, -9574, -8703, -7578, -6294, -4933, -3552, -2193, -889, 351,
-    1525, 2615, 3599, 4466, 5199, 5771, 6166, 6375, 6377, 6141, 5656, 4912,
-    3896, 2633, 1191, -348, -1903, -3360, -4589, -5505, -6084, -6329, -6271, -5972,
-    -5500, -4905, -4220, -3470, -2658, -1788, -879, 46, 963, 1850, 2674, 3409,
-    4039, 4556, 4963, 5280, 5531, 5723, 5847, 5869, 5743, 5415, 4843, 3997,
-    2858, 1448, -162, -1869, -3559, -5106, -6384, -7295, -7783, -7835, -7482, -6796,
-    -5860, -4752, -3539, -2296, -1083, 65, 1132, 2116, 3032, 3908, 4763, 5599,
-    6402, 7136, 7745, 8159, 8306, 8111, 7512, 6500, 5124, 3468, 1652, -170,
-    -1844, -3240, -4257, -4846, -5039, -4953, -4720, -4438, -4168, -3919, -3640, -3256,
-    -2695, -1911, -901, 263, 1442, 2487, 3282, 3762, 3946, 3914, 3765, 3581,
-    3442, 3395, 3427, 3474, 3441, 3213, 2669, 1760, 552, -803, -2094, -3091,
-    -3594, -3493, -2791, -1603, -148, 1300, 2494, 3278, 3601, 3503, 3090, 2494,
-    1829, 1177, 583, 74, -343, -681, -955, -1174, -1345, -1506, -1711, -2006,
-    -2402, -2873, -3344, -3696, -3803, -3581, -2987, -2014, -721, 749, 2210, 3489,
-    4466, 5095, 5431, 5596, 5724, 5907, 6158, 6421, 6592, 6555, 6212, 5510,
-    4465, 3159, 1712, 241, -1162, -2451, -3613, -4671, -5668, -6638, -7584, -8470,
-    -9221, -9729, -9862, -9520, -8676, -7397, -5829, -4156, -2547, -1116, 96, 1102,
-    1966, 2762, 3528, 4258, 4916, 5471, 5900, 6196, 6352, 6335, 6085, 5544,
-    4688, 3552, 2225, 814, -607, -2026, -3462, -4927, -6395, -7789, -8973, -9793,
-    -10128, -9931, -9227, -8096, -6654, -5036, -3379, -1788, -319, 1027, 2267, 3398,
-    4391, 5207, 5811, 6183, 6324, 6261, 6025, 5634, 5084, 4361, 3452, 2364,
-    1123, -228, -1654, -3127, -4609, -6039, -7335, -8394, -9118, -9428, -9287, -8712,
-    -7774, -6588, -5273, -3935, -2643, -1411, -219, 960, 2138, 3315, 4465, 5528,
-    6421, 7061, 7375, 7315, 6876, 6085, 4984, 3632, 2118, 529, -1074, -2641,
-    -4114, -5432, -6544, -7390, -7904, -8045, -7812, -7237, -6392, -5394, -4367, -3397,
-    -2527, -1758, -1055, -367, 356, 1142, 1996, 2909, 3861, 4827, 5776, 6650,
-    7348, 7749, 7749, 7287, 6363, 5035, 3397, 1554, -387, -2309, -4097, -5642,
-    -6848, -7624, -7912, -7707, -7060, -6072, -4878, -3619, -2413, -1340, -431, 337,
-    1032, 1734, 2496, 3356, 4314, 5329, 6324, 7221, 7947, 8419, 8561, 8324,
-    7693, 6678, 5338, 3782, 2146, 565, -837, -1958, -2729, -3133, -3224, -3119,
-    -2957, -2835, -2780, -2753, -2669, -2444, -2042, -1488, -843, -178, 436, 954,
-    1368, 1694, 1958, 2198, 2442, 2674, 2835, 2847, 2635, 2159, 1450, 623,
-    -145, -660, -761, -373, 463, 1578, 2724, 3635, 4103, 4035, 3463, 2538,
-    1482, 536, -113, -372, -254, 143, 676, 1203, 1606, 1800, 1744, 1439,
-    919, 252, -477, -1198, -1869, -2456, -2916, -3198, -3244, -2994, -2420, -1563,
-    -521, 588, 1647, 2550, 3239, 3711, 4002, 4178, 4321, 4485, 4655, 4748,
-    4666, 4322, 3676, 2760, 1668, 518, -578, -1528, -2294, -2912, -3463, -4024,
-    -4645, -5330, -6015, -6581, -6897, -6860, -6404, -5520, -4259, -2729, -1070, 574,
-    2076, 3351, 4386, 5225, 5916, 6481, 6912, 7185, 7259, 7089, 6635, 5881,
-    4840, 3564, 2132, 645, -790, -2088, -3206, -4155, -4982, -5753, -6516, -7273,
-    -7959, -8473, -8702, -8540, -7924, -6863, -5452, -3828, -2134, -494, 1014, 2367,
-    3569, 4629, 5551, 6333, 6956, 7388, 7592, 7537, 7202, 6591, 5718, 4607,
-    3299, 1849, 316, -1263, -2851, -4389, -5804, -7031, -8009, -8673, -8970, -8869,
-    -8368, -7503, -6359, -5050, -3677, -2311, -1007, 196, 1301, 2336, 3331, 4293,
-    5225, 6121, 6950, 7660, 8189, 8457, 8366, 7837, 6843, 5409, 3616, 1582,
-    -558, -2666, -4609, -6262, -7533, -8366, -8725, -8609, -8056, -7128, -5884, -4388,
-    -2728, -1010, 670, 2233, 3631, 4850, 5888, 6723, 7318, 7653, 7729, 7558,
-    7151, 6521, 5691, 4694, 3568, 2347, 1046, -331, -1773, -3250, -4714, -6109,
-    -7377, -8452, -9264, -9747, -9838, -9473, -8622, -7320, -5676, -3833, -1947, -152,
-    1468, 2889, 4114, 5136, 5948, 6539, 6879, 6935, 6708, 6236, 5584, 4833,
-    4050, 3243, 2369, 1382, 250, -1054, -2538, -4144, -5753, -7233, -8453, -9287,
-    -9628, -9415, -8642, -7373, -5744, -3944, -2150, -498, 939, 2149, 3177, 4075,
-    4868, 5554, 6125, 6561, 6844, 6973, 6949, 6760, 6371, 5745, 4841, 3625,
-    2095, 314, -1611, -3550, -5372, -6958, -8220, -9084, -9476, -9349, -8711, -7642,
-    -6280, -4815, -3437, -2274, -1376, -726, -245, 204, 768, 1534, 2524, 3703,
-    4990, 6265, 7414, 8335, 8928, 9089, 8743, 7867, 6489, 4696, 2622, 408,
-    -1826, -3977, -5951, -7652, -8985, -9848, -10155, -9865, -8998, -7635, -5925, -4064,
-    -2257, -671, 593, 1527, 2194, 2695, 3138, 3613, 4167, 4801, 5458, 6049,
-    6469, 6628, 6467, 5991, 5266, 4407, 3547, 2803, 2234, 1827, 1513, 1196,
-    772, 152, -710, -1791, -3007, -4231, -5317, -6137, -6616, -6748, -6565, -6120,
-    -5472, -4673, -3753, -2722, -1568, -280, 1129, 2598, 4028, 5309, 6339, 7048,
-    7414, 7474, 7269, 6830, 6179, 5342, 4345, 3210, 1960, 607, -837, -2335,
-    -3819, -5220, -6485, -7570, -8429, -9020, -9313, -9284, -8938, -8308, -7439, -6362,
-    -5107, -3712, -2226, -693, 839, 2321, 3702, 4938, 5984, 6794, 7326, 7549,
-    7447, 7023, 6296, 5309, 4129, 2840, 1523, 229, -1024, -2236, -3420, -4584,
-    -5706, -6740, -7638, -8366, -8878, -9096, -8949, -8402, -7456, -6141, -4526, -2711,
-    -812, 1048, 2740, 4158, 5242, 5981, 6374, 6428, 6170, 5643, 4905, 4013,
-    3022, 1963, 849, -325, -1554, -2814, -4052, -5199, -6186, -6950, -7448, -7667,
-    -7610, -7292, -6746, -6010, -5111, -4055, -2853, -1531, -141, 1261, 2627, 3921,
-    5107, 6126, 6904, 7362, 7439, 7102, 6355, 5220, 3742, 1999, 103, -1836,
-    -3735, -5517, -7087, -8343, -9185, -9511, -9253, -8430, -7146, -5573, -3903, -2288,
-    -795, 578, 1843, 2999, 4048, 4982, 5779, 6418, 6881, 7140, 7171, 6961,
-    6500, 5751, 4689, 3323, 1692, -142, -2077, -3981, -5711, -7130, -8104, -8537,
-    -8391, -7683, -6510, -5057, -3563, -2228, -1189, -506, -156, -29, 19, 108,
-    335, 768, 1422, 2247, 3169, 4112, 5004, 5781, 6395, 6791, 6896, 6640,
-    5986, 4963, 3663, 2243, 883, -272, -1146, -1719, -2004, -2054, -1956, -1802,
-    -1669, -1619, -1678, -1836, -2049, -2258, -2402, -2406, -2199, -1732, -976, 66,
-    1341, 2749, 4184, 5540, 6689, 7497, 7852, 7687, 7006, 5915, 4619, 3371,
-    2393, 1824, 1674, 1818, 2039, 2116, 1883, 1283, 386, -635, -1569, -2225,
-    -2485, -2326, -1815, -1061, -187, 689, 1460, 2043, 2371, 2399, 2101, 1479,
-    564, -599, -1953, -3412, -4846, -6070, -6885, -7122, -6684, -5568, -3883, -1823,
-    383, 2503, 4334, 5747, 6700, 7202, 7300, 7071, 6603, 5961, 5189, 4338,
-    3466, 2626, 1874, 1264, 834, 591, 510, 514, 457, 168, -493, -1571,
-    -2989, -4537, -5903, -6751, -6808, -5939, -4185, -1761, 1012, 3787, 6242, 8123,
-    9270, 9621, 9208, 8146, 6600, 4763, 2838, 1008, -595, -1889, -2824, -3381,
-    -3593, -3533, -3322, -3131, -3151, -3515, -4245, -5250, -6348, -7290, -7837, -7826,
-    -7190, -5957, -4246, -2244, -146, 1880, 3697, 5207, 6373, 7206, 7733, 7976,
-    7930, 7566, 6845, 5747, 4286, 2529, 604, -1312, -3049, -4478, -5543, -6254,
-    -6661, -6821, -6763, -6490, -5964, -5122, -3910, -2335, -488, 1454, 3243, 4615,
-    5357, 5358, 4648, 3407, 1917, 490, -596, -1149, -1099, -494, 530, 1798,
-    3135, 4414, 5575, 6593, 7432, 8016, 8231, 7951, 7088, 5647, 3731, 1518,
-    -776, -2942, -4823, -6327, -7410, -8069, -8348, -8315, -8030, -7543, -6907, -6151,
-    -5277, -4290, -3207, -2056, -867, 314, 1451, 2548, 3634, 4731, 5833, 6892,
-    7804, 8437, 8656, 8365, 7522, 6154, 4364, 2291, 96, -2055, -4009, -5662,
-    -6966, -7896, -8432, -8568, -8313, -7698, -6752, -5506, -4002, -2311, -516, 1282,
-    2984, 4495, 5754, 6737, 7426, 7811, 7897, 7707, 7259, 6578, 5693, 4628,
-    3391, 2009, 548, -893, -2193, -3225, -3899, -4215, -4258, -4157, -4051, -4062,
-    -4258, -4625, -5078, -5473, -5646, -5471, -4898, -3954, -2714, -1275, 266, 1846,
-    3424, 4955, 6371, 7586, 8503, 9030, 9110, 8714, 7835, 6488, 4741, 2719,
-    592, -1440, -3165, -4416, -5107, -5252, -4975, -4484, -4005, -3686, -3560, -3558,
-    -3565, -3462, -3170, -2673, -2017, -1286, -563, 102, 698, 1264, 1869, 2588,
-    3458, 4460, 5514, 6500, 7272, 7686, 7631, 7038, 5892, 4251, 2255, 101,
-    -2012, -3931, -5575, -6934, -8024, -8841, -9348, -9495, -9247, -8601, -7597, -6305,
-    -4809, -3188, -1513, 153, 1754, 3249, 4614, 5836, 6907, 7820, 8541, 9005,
-    9136, 8881, 8215, 7138, 5698, 4001, 2172, 323, -1444, -3047, -4442, -5613,
-    -6540, -7208, -7621, -7804, -7777, -7548, -7124, -6498, -5663, -4626, -3409, -2020,
-    -471, 1194, 2900, 4558, 6071, 7341, 8287, 8849, 8983, 8654, 7849, 6582,
-    4899, 2887, 668, -1637, -3922, -6098, -8082, -9786, -11119, -11986, -12301, -12009,
-    -11100, -9640, -7774, -5696, -3597, -1611, 202, 1847, 3355, 4750, 6040, 7212,
-    8236, 9058, 9613, 9824, 9617, 8943, 7802, 6248, 4374, 2315, 212, -1832,
-    -3763, -5549, -7149, -8507, -9546, -10161, -10254, -9785, -8802, -7435, -5865, -4259,
-    -2713, -1236, 196, 1607, 3006, 4375, 5660, 6790, 7692, 8294, 8531, 8353,
-    7744, 6719, 5332, 3690, 1922, 145, -1560, -3143, -4583, -5861, -6928, -7708,
-    -8112, -8063, -7525, -6537, -5224, -3758, -2308, -1004, 84, 961, 1680, 2325,
-    2969, 3650, 4350, 4997, 5499, 5755, 5681, 5235, 4454, 3437, 2323, 1244,
-    271, -614, -1498, -2458, -3513, -4600, -5584, -6307, -6650, -6558, -6049, -5208,
-    -4166, -3056, -1968, -957, -46, 770, 1525, 2256, 2986, 3705, 4366, 4880,
-    5139, 5040, 4526, 3625, 2461, 1219, 65, -907, -1697, -2375, -3016, -3647,
-    -4238, -4712, -4952, -4836, -4282, -3291, -1944, -398, 1131, 2430, 3347, 3812,
-    3851, 3583, 3185, 2822, 2595, 2539, 2609, 2692, 2650, 2374, 1821, 1032,
-    129, -748, -1497, -2081, -2524, -2887, -3238, -3596, -3903, -4054, -3933, -3444,
-    -2559, -1350, 39, 1440, 2688, 3643, 4231, 4472, 4462, 4329, 4203, 4188,
-    4325, 4572, 4831, 4973, 4875, 4445, 3662, 2573, 1296, -21, -1248, -2319,
-    -3233, -4027, -4751, -5441, -6083, -6600, -6893, -6869, -6452, -5599, -4332, -2756,
-    -1032, 657, 2147, 3344, 4255, 4948, 5496, 5934, 6252, 6408, 6340, 5979,
-    5268, 4184, 2759, 1080, -721, -2491, -4080, -5389, -6397, -7134, -7646, -7969,
-    -8108, -8028, -7675, -7008, -6013, -4698, -3123, -1398, 335, 1930, 3255, 4229,
-    4844, 5149, 5218, 5131, 4944, 4658, 4224, 3590, 2747, 1720, 572, -598,
-    -1691, -2649, -3453, -4101, -4619, -5063, -5472, -5851, -6167, -6357, -6325, -5961,
-    -5187, -3980, -2381, -499, 1496, 3412, 5070, 6317, 7035, 7158, 6684, 5676,
-    4253, 2569, 802, -853, -2222, -3190, -3713, -3804, -3516, -2931, -2126, -1174,
-    -156, 810, 1592, 2054, 2095, 1706, 999, 163, -615, -1194, -1523, -1658,
-    -1723, -1835, -2040, -2311, -2549, -2617, -2392, -1824, -954, 102, 1198, 2202,
-    3034, 3665, 4116, 4424, 4625, 4723, 4692, 4469, 3969, 3122, 1939, 518,
-    -977, -2341, -3361, -3892, -3901, -3438, -2611, -1573, -505, 440, 1165, 1610,
-    1761, 1670, 1441, 1187, 1013, 1015, 1257, 1744, 2428, 3237, 4086, 4887,
-    5547, 5965, 6044, 5702, 4907, 3687, 2133, 361, -1512, -3367, -5082, -6523,
-    -7551, -8045, -7935, -7224, -5987, -4366, -2559, -772, 835, 2162, 3161, 3837,
-    4242, 4429, 4425, 4252, 3939, 3505, 2969, 2354, 1667, 876, -46, -1087,
-    -2206, -3357, -4475, -5471, -6244, -6706, -6798, -6514, -5912, -5101, -4216, -3398,
-    -2762, -2366, -2216, -2266, -2409, -2497, -2390, -1991, -1250, -189, 1100, 2490,
-    3844, 5002, 5783, 6037, 5684, 4714, 3211, 1346, -669, -2647, -4435, -5904,
-    -6969, -7599, -7799, -7608, -7094, -6341, -5430, -4426, -3383, -2327, -1260, -176,
-    937, 2076, 3217, 4308, 5272, 6031, 6511, 6657, 6430, 5803, 4779, 3413,
-    1796, 46, -1701, -3317, -4711, -5831, -6636, -7107, -7258, -7118, -6718, -6106,
-    -5353, -4525, -3663, -2795, -1925, -1026, -59, 985, 2078, 3176, 4216, 5128,
-    5865, 6392, 6657, 6597, 6172, 5381, 4264, 2908, 1447, 15, -1298, -2456,
-    -3458, -4327, -5088, -5752, -6294, -6667, -6822, -6723, -6337, -5644, -4633, -3315,
-    -1729, 37, 1861, 3615, 5208, 6593, 7746, 8639, 9221, 9423, 9173, 8437,
-    7239, 5663, 3831, 1868, -111, -2013, -3766, -5313, -6610, -7594, -8189, -8322,
-    -7943, -7055, -5727, -4088, -2281, -434, 1345, 2987, 4447, 5691, 6675, 7366,
-    7757, 7849, 7652, 7188, 6475, 5523, 4349, 2982, 1448, -215, -1938, -3638,
-    -5236, -6649, -7777, -8512, -8764, -8460, -7573, -6164, -4365, -2342, -269, 1702,
-    3487, 5083, 6510, 7753, 8760, 9446, 9703, 9432, 8594, 7233, 5457, 3420,
-    1290, -787, -2699, -4369, -5762, -6869, -7673, -8123, -8147, -7674, -6650, -5097,
-    -3129, -937, 1259, 3250, 4875, 6053, 6784, 7111, 7099, 6806, 6267, 5500,
-    4534, 3422, 2240, 1084, 51, -789, -1395, -1753, -1870, -1789, -1568, -1270,
-    -947, -632, -312, 63, 533, 1115, 1805, 2572, 3365, 4114, 4730, 5105,
-    5129, 4735, 3930, 2804, 1526, 290, -746, -1490, -1918, -2064, -1985, -1722,
-    -1293, -711, 5, 826, 1698, 2532, 3217, 3643, 3709, 3358, 2625, 1648,
-    636, -191, -666, -751, -554, -271, -92, -133, -399, -794, -1172, -1397,
-    -1387, -1130, -678, -124, 442, 962, 1417, 1835, 2286, 2846, 3556, 4393,
-    5262, 6010, 6443, 6376, 5691, 4389, 2602, 543, -1543, -3428, -4946, -6015,
-    -6614, -6761, -6503, -5903, -5033, -3960, -2747, -1453, -129, 1157, 2317, 3271,
-    3976, 4419, 4603, 4549, 4273, 3777, 3053, 2115, 1003, -210, -1420, -2492,
-    -3288, -3689, -3614, -3049, -2079, -880, 330, 1353, 2052, 2363, 2320, 2026,
-    1610, 1191, 864, 697, 723, 930, 1276, 1715, 2210, 2751, 3336, 3949,
-    4533, 4985, 5181, 4998, 4370, 3318, 1950, 437, -1011, -2197, -2982, -3324,
-    -3287, -3016, -2685, -2434, -2322, -2314, -2313, -2209, -1918, -1398, -665, 215,
-    1147, 2040, 2838, 3512, 4060, 4500, 4844, 5068, 5114, 4912, 4411, 3607,
-    2568, 1415, 288, -687, -1424, -1914, -2231, -2494, -2799, -3181, -3613, -4009,
-    -4251, -4231, -3887, -3210, -2255, -1118, 101, 1314, 2452, 3463, 4316, 4979,
-    5402, 5513, 5237, 4519, 3353, 1788, -68, -2071, -4052, -5839, -7274, -8240,
-    -8661, -8502, -7773, -6531, -4882, -2980, -998, 905, 2611, 4038, 5146, 5914,
-    6324, 6355, 5998, 5260, 4181, 2834, 1303, -347, -2071, -3813, -5512, -7100,
-    -8507, -9655, -10464, -10876, -10840, -10328, -9357, -7990, -6311, -4429, -2480, -593,
-    1152, 2713, 4050, 5143, 5978, 6506, 6638, 6276, 5361, 3908, 2012, -142,
-    -2334, -4373, -6125, -7516, -8517, -9138, -9402, -9333, -8952, -8280, -7341, -6156,
-    -4759, -3219, -1641, -143, 1165, 2194, 2897, 3275, 3349, 3148, 2714, 2115,
-    1429, 737, 132, -303, -514, -505, -306, 26, 409, 762, 1027, 1159,
-    1107, 820, 267, -548, -1573, -2702, -3793, -4690, -5249, -5359, -4967, -4084,
-    -2794, -1259, 309, 1718, 2829, 3574, 3950, 4018, 3862, 3559, 3179, 2779,
-    2405, 2089, 1865, 1781, 1892, 2241, 2842, 3633, 4482, 5216, 5671, 5723,
-    5313, 4452, 3209, 1701, 60, -1591, -3164, -4601, -5852, -6876, -7616, -7994,
-    -7937, -7401, -6397, -4989, -3284, -1410, 506, 2329, 3925, 5195, 6095, 6613,
-    6752, 6518, 5899, 4876, 3450, 1680, -309, -2331, -4158, -5563, -6385, -6550,
-    -6079, -5088, -3767, -2340, -1025, 10, 668, 937, 857, 517, 40, -432,
-    -785, -927, -788, -333, 422, 1422, 2574, 3748, 4784, 5526, 5845, 5659,
-    4959, 3813, 2345, 706, -958, -2536, -3964, -5195, -6181, -6870, -7210, -7155,
-    -6691, -5845, -4677, -3265, -1702, -74, 1547, 3092, 4487, 5662, 6565, 7142,
-    7334, 7106, 6455, 5418, 4073, 2524, 871, -809, -2451, -4003, -5431, -6696,
-    -7736, -8470, -8830, -8763, -8232, -7250, -5902, -4321, -2645, -995, 537, 1904,
-    3106, 4160, 5064, 5803, 6344, 6623, 6558, 6075, 5138, 3768, 2061, 167,
-    -1769, -3645, -5386, -6923, -8187, -9102, -9569, -9496, -8828, -7570, -5784, -3592,
-    -1171, 1277, 3541, 5423, 6778, 7535, 7687, 7264, 6328, 4975, 3321, 1515,
-    -284, -1935, -3329, -4365, -4968, -5128, -4892, -4341, -3594, -2809, -2129, -1639,
-    -1370, -1285, -1277, -1209, -987, -586, -36, 569, 1088, 1412, 1515, 1456,
-    1338, 1278, 1384, 1719, 2283, 3017, 3810, 4525, 5051, 5329, 5373, 5248,
-    5035, 4777, 4462, 4030, 3404, 2522, 1386, 63, -1338, -2691, -3872, -4783,
-    -5350, -5528, -5303, -4720, -3873, -2882, -1863, -901, -27, 790, 1618, 2524,
-    3531, 4618, 5735, 6823, 7801, 8566, 9010, 9040, 8589, 7655, 6297, 4614,
-    2722, 755, -1163, -2949, -4543, -5867, -6834, -7363, -7388, -6863, -5804, -4308,
-    -2539, -698, 1023, 2488, 3649, 4528, 5180, 5677, 6066, 6343, 6454, 6318,
-    5863, 5062, 3964, 2672, 1311, 1, -1153, -2100, -2850, -3434, -3883, -4228,
-    -4472, -4578, -4484, -4132, -3476, -2504, -1255, 183, 1701, 3178, 4492, 5544,
-    6257, 6571, 6451, 5917, 5040, 3926, 2715, 1555, 549, -275, -934, -1456,
-    -1853, -2096, -2123, -1882, -1370, -632, 243, 1118, 1840, 2277, 2363, 2106,
-    1602, 1028, 584, 414, 566, 976, 1497, 1943, 2164, 2100, 1790, 1349,
-    931, 691, 714, 995, 1459, 2011, 2560, 3043, 3455, 3835, 4221, 4626,
-    5048, 5452, 5744, 5791, 5481, 4747, 3576, 2029, 238, -1648, -3501, -5213,
-    -6694, -7881, -8732, -9220, -9342, -9134, -8649, -7944, -7070, -6057, -4920, -3681,
-    -2388, -1094, 168, 1394, 2588, 3750, 4856, 5831, 6554, 6898, 6765, 6107,
-    4930, 3278, 1234, -1079, -3487, -5782, -7755, -9232, -10087, -10248, -9703, -8500,
-    -6744, -4597, -2254, 79, 2226, 4065, 5542, 6647, 7389, 7762, 7744, 7302,
-    6412, 5084, 3383, 1426, -644, -2692, -4606, -6313, -7765, -8910, -9687, -10038,
-    -9924, -9325, -8246, -6726, -4842, -2721, -539, 1520, 3313, 4759, 5815, 6458,
-    6670, 6422, 5701, 4554, 3123, 1611, 223, -891, -1665, -2106, -2252, -2142,
-    -1807, -1263, -523, 368, 1307, 2135, 2667, 2730, 2211, 1114, -443, -2261,
-    -4109, -5751, -6988, -7687, -7792, -7322, -6379, -5121, -3705, -2253, -845, 488,
-    1759, 3003, 4243, 5475, 6667, 7745, 8599, 9106, 9153, 8673, 7657, 6166,
-    4309, 2222, 57, -2037, -3947, -5601, -6953, -7971, -8618, -8835, -8536, -7648,
-    -6174, -4217, -1968, 329, 2425, 4130, 5353, 6076, 6327, 6168, 5676, 4926,
-    3990, 2943, 1850, 753, -305, -1266, -2060, -2619, -2899, -2895, -2640, -2194,
-    -1627, -1031, -511, -152, 16, 32, -16, -20, 93, 311, 547, 679,
-    607, 277, -306, -1084, -1948, -2760, -3375, -3667, -3578, -3139, -2455, -1645,
-    -793, 66, 939, 1848, 2803, 3774, 4677, 5390, 5776, 5702, 5075, 3886,
-    2230, 289, -1723, -3608, -5209, -6421, -7199, -7547, -7501, -7128, -6501, -5675,
-    -4669, -3484, -2136, -664, 864, 2360, 3739, 4926, 5873, 6553, 6953, 7057,
-    6844, 6307, 5460, 4333, 2976, 1462, -141, -1793, -3472, -5143, -6745, -8192,
-    -9366, -10140, -10432, -10221, -9532, -8430, -7004, -5354, -3583, -1799, -84, 1536,
-    3086, 4589, 6035, 7360, 8444, 9142, 9331, 8934, 7938, 6409, 4476, 2297,
-    35, -2141, -4075, -5651, -6794, -7458, -7622, -7270, -6394, -5029, -3278, -1308,
-    669, 2420, 3728, 4446, 4524, 4002, 3001, 1706, 324, -951, -1975, -2672,
-    -3053, -3172, -3077, -2776, -2242, -1430, -320, 1047, 2571, 4120, 5548, 6709,
-    7490, 7817, 7643, 6967, 5866, 4468, 2917, 1362, -72, -1309, -2335, -3177,
-    -3885, -4519, -5102, -5591, -5892, -5897, -5517, -4721, -3547, -2097, -497, 1133,
-    2710, 4187, 5540, 6729, 7695, 8349, 8580, 8292, 7444, 6056, 4209, 2048,
-    -242, -2494, -4576, -6354, -7699, -8520, -8764, -8407, -7473, -6061, -4316, -2405,
-    -512, 1178, 2546, 3556, 4214, 4534, 4537, 4243, 3642, 2727, 1555, 266,
-    -963, -1943, -2504, -2532, -2020, -1056, 221, 1626, 2938, 3933, 4448, 4406,
-    3815, 2772, 1439, -8, -1431, -2740, -3885, -4836, -5566, -6023, -6135, -5830,
-    -5082, -3920, -2414, -660, 1226, 3118, 4895, 6457, 7713, 8585, 9020, 8982,
-    8453, 7446, 6015, 4245, 2256, 198, -1762, -3481, -4862, -5861, -6486, -6774,
-    -6761, -6467, -5904, -5073, -3978, -2658, -1207, 248, 1580, 2677, 3454, 3871,
-    3931, 3671, 3150, 2454, 1688, 963, 394, 72, 48, 331, 893, 1669,
-    2555, 3442, 4230, 4826, 5152, 5164, 4843, 4191, 3241, 2083, 849, -308,
-    -1247, -1871, -2162, -2202, -2135, -2111, -2215, -2444, -2710, -2874, -2788, -2347,
-    -1525, -377, 986, 2428, 3811, 5040, 6067, 6854, 7346, 7477, 7192, 6450,
-    5239, 3609, 1668, -449, -2622, -4747, -6718, -8407, -9662, -10328, -10291, -9517,
-    -8080, -6145, -3937, -1697, 371, 2132, 3532, 4567, 5253, 5616, 5685, 5498,
-    5108, 4587, 4019, 3472, 2977, 2533, 2100, 1621, 1046, 350, -480, -1451,
-    -2562, -3793, -5097, -6391, -7542, -8401, -8837, -8760, -8127, -6965, -5375, -3506,
-    -1516, 444, 2251, 3831, 5157, 6219, 7000, 7464, 7536, 7121, 6155, 4646,
-    2681, 424, -1885, -3959, -5527, -6370, -6343, -5419, -3727, -1532, 820, 2960,
-    4560, 5402, 5424, 4704, 3428, 1853, 252, -1152, -2249, -3039, -3598, -4026,
-    -4379, -4635, -4679, -4366, -3599, -2383, -833, 856, 2470, 3834, 4844, 5462,
-    5709, 5639, 5314, 4781, 4079, 3254, 2359, 1436, 507, -442, -1449, -2540,
-    -3706, -4884, -5985, -6901, -7528, -7790, -7658, -7136, -6250, -5056, -3646, -2128,
-    -601, 884, 2318, 3706, 5026, 6192, 7053, 7426, 7167, 6229, 4685, 2724,
-    615, -1348, -2915, -3922, -4315, -4170, -3658, -2999, -2414, -2072, -2045, -2289,
-    -2681, -3078, -3358, -3465, -3420, -3300, -3206, -3220, -3375, -3620, -3833, -3857,
-    -3543, -2785, -1566, 29, 1847, 3715, 5475, 6999, 8183, 8929, 9131, 8716,
-    7684, 6117, 4161, 1996, -218, -2374, -4404, -6231, -7753, -8857, -9442, -9436,
-    -8823, -7676, -6136, -4384, -2627, -1078, 86, 769, 970, 773, 323, -207,
-    -661, -911, -865, -480, 230, 1208, 2377, 3655, 4953, 6197, 7336, 8316,
-    9060, 9479, 9482, 8992, 7962, 6411, 4414, 2105, -334, -2681, -4716, -6261,
-    -7184, -7401, -6891, -5719, -4037, -2046, 35, 2007, 3710, 5049, 6008, 6623,
-    6933, 6971, 6758, 6314, 5669, 4885, 4023, 3122, 2192, 1229, 211, -894,
-    -2091, -3346, -4597, -5777, -6806, -7605, -8095, -8205, -7865, -7044, -5777, -4151,
-    -2305, -426, 1297, 2715, 3745, 4365, 4614, 4576, 4342, 3983, 3548, 3061,
-    2525, 1930, 1291, 646, 60, -377, -567, -436, 27, 770, 1664, 2513,
-    3092, 3202, 2727, 1680, 217, -1417, -2960, -4198, -4994, -5312, -5209, -4809,
-    -4254, -3665, -3127, -2662, -2223, -1722, -1072, -230, 785, 1905, 3041, 4127,
-    5128, 6023, 6790, 7398, 7785, 7869, 7582, 6902, 5842, 4457, 2853, 1150,
-    -577, -2298, -4000, -5651, -7203, -8560, -9584, -10136, -10131, -9546, -8423, -6880,
-    -5077, -3184, -1340, 337, 1771, 2931, 3822, 4460, 4859, 5016, 4905, 4499,
-    3788, 2812, 1673, 543, -378, -921, -993, -610, 105, 959, 1749, 2303,
-    2495, 2260, 1600, 572, -711, -2095, -3395, -4446, -5152, -5513, -5605, -5532,
-    -5391, -5222, -4994, -4615, -3999, -3108, -1966, -658, 672, 1857, 2779, 3383,
-    3684, 3747, 3658, 3464, 3143, 2639, 1908, 939, -242, -1570, -2971, -4374,
-    -5710, -6882, -7788, -8341, -8480, -8171, -7420, -6285, -4852, -3226, -1518, 166,
-    1733, 3109, 4221, 4994, 5354, 5260, 4727, 3853, 2804, 1784, 988, 573,
-    640, 1210, 2214, 3490, 4787, 5807, 6281, 6030, 5004, 3279, 1039, -1453,
-    -3923, -6126, -7881, -9085, -9701, -9729, -9182, -8098, -6568, -4731, -2761, -830,
-    933, 2465, 3754, 4797, 5577, 6060, 6197, 5938, 5273, 4259, 3000, 1641,
-    350, -698, -1370, -1593, -1363, -737, 174, 1238, 2312, 3237, 3854, 4052,
-    3794, 3103, 2041, 703, -793, -2327, -3779, -5015, -5895, -6307, -6192, -5555,
-    -4457, -3007, -1346, 380, 2048, 3566, 4862, 5888, 6602, 6977, 7006, 6708,
-    6116, 5268, 4225, 3067, 1857, 621, -634, -1908, -3200, -4493, -5724, -6789,
-    -7581, -8006, -8002, -7564, -6750, -5649, -4351, -2954, -1547, -186, 1111, 2334,
-    3466, 4476, 5310, 5885, 6114, 5934, 5324, 4337, 3116, 1858, 758, -35,
-    -439, -454, -131, 457, 1218, 2024, 2708, 3095, 3026, 2412, 1279, -234,
-    -1927, -3584, -5001, -6019, -6560, -6610, -6223, -5501, -4567, -3517, -2412, -1303,
-    -236, 763, 1674, 2473, 3140, 3675, 4094, 4409, 4630, 4765, 4821, 4783,
-    4620, 4285, 3723, 2881, 1744, 352, -1214, -2837, -4368, -5634, -6492, -6849,
-    -6663, -5941, -4753, -3231, -1535, 161, 1673, 2860, 3667, 4116, 4269, 4215,
-    4044, 3810, 3523, 3174, 2751, 2243, 1663, 1073, 573, 263, 220, 474,
-    974, 1590, 2140, 2445, 2353, 1787, 770, -593, -2150, -3714, -5087, -6100,
-    -6659, -6751, -6424, -5768, -4888, -3871, -2763, -1579, -318, 1027, 2446, 3900,
-    5322, 6637, 7754, 8573, 9013, 9026, 8602, 7762, 6563, 5077, 3388, 1593,
-    -204, -1923, -3524, -4979, -6260, -7309, -8035, -8305, -8007, -7113, -5696, -3919,
-    -2003, -187, 1335, 2440, 3068, 3207, 2887, 2178, 1189, 61, -1051, -1992,
-    -2641, -2924, -2820, -2356, -1579, -553, 653, 1947, 3210, 4297, 5054, 5355,
-    5126, 4357, 3109, 1507, -284, -2092, -3763, -5159, -6168, -6714, -6764, -6325,
-    -5443, -4218, -2806, -1383, -105, 899, 1532, 1749, 1555, 979, 66, -1108,
-    -2427, -3749, -4918, -5765, -6147, -5974, -5225, -3948, -2269, -361, 1593, 3433,
-    5024, 6268, 7101, 7465, 7312, 6621, 5416, 3763, 1791, -324, -2402, -4302,
-    -5924, -7204, -8121, -8685, -8897, -8743, -8216, -7325, -6104, -4642, -3081, -1582,
-    -279, 735, 1422, 1793, 1890, 1749, 1403, 911, 371, -93, -363, -353,
-    -37, 557, 1354, 2255, 3152, 3925, 4450, 4617, 4365, 3689, 2653, 1387,
-    57, -1183, -2226, -3017, -3549, -3850, -3950, -3852, -3532, -2966, -2149, -1107,
-    102, 1403, 2722, 4005, 5242, 6441, 7595, 8676, 9629, 10361, 10750, 10684,
-    10105, 9021, 7492, 5635, 3591, 1480, -609, -2596, -4408, -5986, -7273, -8193,
-    -8653, -8562, -7868, -6579, -4784, -2651, -392, 1789, 3743, 5380, 6644, 7495,
-    7897, 7818, 7235, 6175, 4738, 3073, 1354, -236, -1524, -2386, -2765, -2674,
-    -2185, -1421, -534, 323, 1011, 1439, 1581, 1480, 1230, 953, 727, 554,
-    376, 130, -233, -718, -1254, -1713, -1973, -1960, -1645, -1030, -153, 917,
-    2101, 3320, 4490, 5544, 6431, 7107, 7531, 7669, 7487, 6952, 6055, 4824,
-    3328, 1674, -10, -1608, -3038, -4241, -5175, -5825, -6180, -6221, -5923, -5282,
-    -4320, -3084, -1660, -174, 1210, 2321, 3002, 3145, 2719, 1789, 508, -900,
-    -2163, -3032, -3338, -3034, -2191, -966, 442, 1856, 3151, 4241, 5027, 5382,
-    5189, 4388, 3001, 1142, -998, -3209, -5302, -7121, -8527, -9402, -9668, -9279,
-    -8248, -6676, -4735, -2609, -470, 1542, 3318, 4799, 5941, 6692, 6995, 6788,
-    6018, 4690, 2913, 879, -1183, -3032, -4431, -5200, -5245, -4570, -3279, -1600,
-    137, 1581, 2416, 2414, 1492, -232, -2487, -4920, -7178, -8969, -10117, -10568,
-    -10349, -9524, -8182, -6450, -4502, -2541, -777, 628, 1586, 2094, 2215, 2046,
-    1692, 1256, 833, 502, 317, 308, 486, 847, 1371, 2016, 2702, 3319,
-    3736, 3833, 3519, 2759, 1579, 65, -1634, -3312, -4760, -5813, -6375, -6410,
-    -5939, -5031, -3791, -2336, -792, 735, 2187, 3539, 4776, 5877, 6801, 7491,
-    7877, 7908, 7553, 6802, 5682, 4276, 2713, 1134, -333, -1599, -2637, -3474,
-    -4142, -4650, -4981, -5099, -4954, -4515, -3784, -2803, -1653, -453, 640, 1456,
-    1855, 1761, 1203, 313, -694, -1549, -1990, -1852, -1123, 74, 1556, 3136,
-    4666, 6036, 7147, 7890, 8164, 7901, 7077, 5723, 3926, 1821, -431, -2651,
-    -4666, -6329, -7530, -8181, -8239, -7702, -6618, -5093, -3285, -1375, 476, 2144,
-    3553, 4677, 5516, 6065, 6305, 6221, 5795, 5012, 3896, 2534, 1083, -249,
-    -1226, -1664, -1497, -772, 389, 1803, 3241, 4468, 5264, 5464, 5015, 4004,
-    2622, 1099, -324, -1453, -2190, -2548, -2620, -2545, -2467, -2461, -2509, -2527,
-    -2422, -2120, -1582, -800, 204, 1381, 2646, 3884, 4963, 5764, 6198, 6228,
-    5854, 5088, 3957, 2515, 834, -988, -2822, -4553, -6118, -7475, -8546, -9221,
-    -9399, -9007, -8034, -6572, -4789, -2872, -1004, 629, 1887, 2708, 3080, 3026,
-    2620, 1998, 1297, 634, 109, -205, -280, -94, 380, 1138, 2120, 3218,
-    4298, 5200, 5774, 5903, 5519, 4593, 3168, 1366, -647, -2708, -4670, -6423,
-    -7892, -9023, -9761, -10033, -9781, -8986, -7694, -6013, -4112, -2205, -492, 899,
-    1928, 2622, 3050, 3285, 3365, 3290, 3070, 2757, 2453, 2286, 2358, 2701,
-    3263, 3921, 4520, 4886, 4854, 4307, 3212, 1637, -258, -2262, -4185, -5881,
-    -7235, -8152, -8558, -8414, -7712, -6492, -4849, -2940, -948, 962, 2669, 4106,
-    5237, 6028, 6427, 6361, 5767, 4648, 3121, 1417, -172, -1362, -1940, -1832,
-    -1112, 22, 1304, 2438, 3145, 3231, 2623, 1382, -317, -2223, -4051, -5542,
-    -6506, -6847, -6567, -5759, -4577, -3194, -1752, -350, 964, 2170, 3255, 4210,
-    5001, 5548, 5754, 5553, 4939, 3958, 2735, 1458, 334, -471, -838, -718,
-    -173, 632, 1491, 2220, 2677, 2795, 2595, 2141, 1499, 750, -14, -704,
-    -1240, -1544, -1566, -1287, -715, 128, 1195, 2416, 3727, 5067, 6359, 7530,
-    8518, 9252, 9646, 9621, 9128, 8147, 6680, 4784, 2576, 231, -2046, -4042,
-    -5573, -6511, -6794, -6410, -5396, -3847, -1927, 160, 2216, 4083, 5653, 6883,
-    7791, 8399, 8705, 8684, 8302, 7517, 6307, 4719, 2880, 969, -817, -2311,
-    -3415, -4096, -4352, -4185, -3604, -2648, -1397, 19, 1429, 2641, 3472, 3761,
-    3414, 2431, 921, -916, -2822, -4534, -5835, -6573, -6659, -6072, -4866, -3182,
-    -1218, 811, 2728, 4416, 5799, 6814, 7396, 7501, 7124, 6302, 5099, 3600,
-    1897, 80, -1773, -3575, -5225, -6638, -7769, -8588, -9062, -9144, -8795, -8007,
-    -6835, -5401, -3862, -2361, -1032, 15, 725, 1108, 1203, 1064, 758, 344,
-    -141, -649, -1106, -1437, -1599, -1582, -1420, -1208, -1066, -1094, -1340, -1806,
-    -2433, -3117, -3749, -4258, -4615, -4821, -4877, -4782, -4521, -4078, -3451, -2668,
-    -1792, -897, -52, 691, 1298, 1748, 2032, 2157, 2158, 2089, 1994, 1891,
-    1783, 1669, 1538, 1393, 1272, 1240, 1348, 1618, 2015, 2425, 2673, 2576,
-    1998, 895, -662, -2495, -4386, -6118, -7506, -8419, -8802, -8657, -8006, -6896,
-    -5408, -3660, -1791, 69, 1827, 3450, 4927, 6232, 7304, 8045, 8333, 8061,
-    7182, 5739, 3870, 1801, -196, -1863, -3005, -3524, -3441, -2888, -2055, -1140,
-    -324, 237, 426, 186, -474, -1458, -2588, -3642, -4409, -4740, -4574, -3948,
-    -2967, -1771, -500, 726, 1816, 2719, 3400, 3839, 4019, 3956, 3707, 3378,
-    3093, 2963, 3061, 3425, 4045, 4852, 5706, 6415, 6780, 6647, 5932, 4643,
-    2879, 802, -1407, -3570, -5522, -7102, -8161, -8583, -8310, -7361, -5829, -3873,
-    -1702, 457, 2400, 3963, 5031, 5564, 5588, 5163, 4369, 3319, 2184, 1174,
-    512, 371, 798, 1689, 2821, 3900, 4612, 4706, 4077, 2776, 964, -1135,
-    -3277, -5263, -6963, -8285, -9157, -9527, -9364, -8664, -7476, -5919, -4160, -2373,
-    -692, 807, 2110, 3226, 4159, 4902, 5428, 5677, 5571, 5071, 4204, 3048,
-    1733, 420, -743, -1667, -2328, -2751, -3009, -3187, -3346, -3498, -3611, -3646,
-    -3568, -3382, -3137, -2927, -2853, -2992, -3376, -3983, -4735, -5494, -6094, -6383,
-    -6251, -5650, -4596, -3171, -1497, 294, 2072, 3718, 5127, 6204, 6840, 6936,
-    6431, 5314, 3645, 1555, -763, -3091, -5214, -6950, -8158, -8743, -8649, -7881,
-    -6529, -4766, -2824, -953, 634, 1806, 2507, 2728, 2506, 1930, 1126, 246,
-    -530, -1023, -1106, -729, 83, 1232, 2545, 3836, 4968, 5875, 6525, 6927,
-    7105, 7050, 6698, 5988, 4903, 3481, 1809, 3, -1831, -3626, -5315, -6803,
-    -7966, -8674, -8800, -8263, -7067, -5302, -3123, -750, 1567, 3604, 5210, 6287,
-    6790, 6720, 6120, 5059, 3662, 2114, 649, -481, -1052, -935, -164, 1068,
-    2464, 3685, 4425, 4484, 3803, 2441, 551, -1660, -3955, -6090, -7831, -8964,
-    -9341, -8907, -7704, -5870, -3619, -1193, 1174, 3283, 4980, 6158, 6740, 6662,
-    5894, 4476, 2549, 370, -1719, -3342, -4188, -4083, -3037, -1243, 972, 3214,
-    5106, 6354, 6786, 6359, 5142, 3298, 1081, -1176, -3113, -4409, -4848, -4377,
-    -3115, -1321, 669, 2494, 3819, 4394, 4087, 2917, 1055, -1197, -3469, -5396,
-    -6685, -7158, -6759, -5560, -3748, -1575, 708, 2875, 4742, 6176, 7085, 7385,
-    6993, 5873, 4087, 1795, -772, -3336, -5618, -7379, -8452, -8753, -8293, -7182,
-    -5598, -3762, -1902, -219, 1147, 2122, 2679, 2848, 2703, 2346, 1906, 1538,
-    1409, 1640, 2262, 3222, 4409, 5679, 6886, 7915, 8676, 9080, 9042, 8512,
-    7494, 6044, 4267, 2305, 304, -1614, -3335, -4744, -5741, -6261, -6265, -5735,
-    -4699, -3250, -1536, 237, 1824, 3007, 3663, 3791, 3489, 2909, 2206, 1505,
-    908, 509, 381, 554, 1018, 1712, 2515, 3264, 3800, 3981, 3700, 2912,
-    1656, 31, -1818, -3706, -5437, -6835, -7755, -8086, -7774, -6852, -5423, -3643,
-    -1711, 181, 1904, 3393, 4620, 5579, 6267, 6656, 6684, 6297, 5475, 4247,
-    2702, 992, -717, -2268, -3516, -4352, -4750, -4777, -4545, -4184, -3810, -3463,
-    -3104, -2672, -2152, -1579, -1024, -585, -354, -371, -599, -952, -1294, -1469,
-    -1351, -876, -55, 1029, 2228, 3370, 4300, 4896, 5080, 4835, 4205, 3270,
-    2128, 872, -425, -1719, -2969, -4119, -5116, -5924, -6498, -6773, -6676, -6151,
-    -5191, -3848, -2253, -584, 990, 2336, 3366, 4019, 4263, 4098, 3567, 2767,
-    1843, 963, 287, -49, 45, 574, 1443, 2473, 3434, 4100, 4298, 3946,
-    3044, 1651, -123, -2125, -4174, -6068, -7605, -8611, -8968, -8619, -7572, -5909,
-    -3791, -1434, 917, 3018, 4661, 5705, 6065, 5706, 4657, 3024, 982, -1225,
-    -3298, -4935, -5883, -5976, -5164, -3565, -1470, 725, 2613, 3843, 4181, 3558,
-    2074, -31, -2418, -4697, -6497, -7528, -7637, -6823, -5228, -3076, -633, 1834,
-    4074, 5879, 7101, 7646, 7484, 6648, 5237, 3417, 1431, -435, -1912, -2809,
-    -3066, -2786, -2211, -1638, -1336, -1494, -2180, -3300, -4630, -5890, -6818, -7210,
-    -6969, -6110, -4731, -2966, -978, 1058, 2987, 4678, 6002, 6838, 7089, 6700,
-    5664, 4057, 2062, -48, -1967, -3419, -4235, -4387, -3990, -3252, -2431, -1760,
-    -1410, -1451, -1853, -2504, -3242, -3890, -4284, -4291, -3846, -2970, -1755, -323,
-    1199, 2710, 4152, 5482, 6645, 7557, 8110, 8186, 7697, 6639, 5119, 3334,
-    1528, -62, -1279, -2082, -2520, -2679, -2660, -2557, -2442, -2362, -2352, -2431,
-    -2576, -2723, -2784, -2659, -2272, -1595, -635, 580, 1997, 3534, 5102, 6634,
-    8064, 9318, 10300, 10895, 10963, 10392, 9153, 7325, 5059, 2575, 129, -2047,
-    -3785, -4974, -5556, -5532, -4974, -3999, -2768, -1479, -335, 490, 874, 778,
-    255, -546, -1417, -2118, -2421, -2175, -1342, 1, 1689, 3507, 5242, 6738,
-    7901, 8681, 9051, 8997, 8509, 7589, 6284, 4690, 2923, 1098, -674, -2290,
-    -3659, -4713, -5408, -5727, -5685, -5336, -4763, -4056, -3288, -2508, -1744, -1014,
-    -357, 156, 450, 478, 247, -168, -629, -968, -1045, -787, -184, 721,
-    1839, 3051, 4222, 5213, 5893, 6164, 5966, 5285, 4142, 2588, 696, -1424,
-    -3614, -5685, -7450, -8736, -9410, -9395, -8675, -7293, -5376, -3129, -802, 1358,
-    3133, 4364, 4975, 4962, 4369, 3277, 1816, 171, -1427, -2708, -3425, -3440,
-    -2768, -1570, -133, 1185, 2048, 2225, 1622, 293, -1576, -3702, -5790, -7572,
-    -8822, -9388, -9208, -8314, -6807, -4847, -2644, -414, 1645, 3383, 4710, 5573,
-    5932, 5755, 5039, 3830, 2245, 483, -1203, -2564, -3411, -3651, -3327, -2628,
-    -1839, -1247, -1065, -1392, -2182, -3277, -4451, -5461, -6097, -6224, -5796, -4841,
-    -3436, -1708, 176, 2048, 3753, 5149, 6116, 6565, 6444, 5755, 4560, 2978,
-    1163, -719, -2503, -4042, -5241, -6049, -6457, -6498, -6258, -5859, -5423, -5039,
-    -4731, -4448, -4089, -3563, -2821, -1851, -655, 758, 2349, 4025, 5626, 6920,
-    7654, 7628, 6763, 5105, 2819, 154, -2593, -5132, -7216, -8660, -9362, -9315,
-    -8597, -7348, -5753, -4024, -2373, -989, -3, 543, 716, 677, 625, 745,
-    1170, 1961, 3082, 4411, 5791, 7072, 8119, 8813, 9050, 8744, 7832, 6326,
-    4340, 2058, -315, -2570, -4522, -6057, -7135, -7745, -7866, -7490, -6645, -5388,
-    -3820, -2101, -422, 1047, 2196, 2993, 3497, 3827, 4103, 4400, 4752, 5162,
-    5604, 6030, 6355, 6451, 6174, 5424, 4173, 2478, 474, -1655, -3705, -5474,
-    -6797, -7568, -7753, -7390, -6571, -5429, -4101, -2697, -1306, -21, 1081, 1946,
-    2546, 2876, 2979, 2933, 2832, 2765, 2807, 3010, 3387, 3921, 4562, 5230,
-    5835, 6291, 6500, 6344, 5729, 4637, 3115, 1251, -829, -2962, -4983, -6745,
-    -8115, -8975, -9244, -8890, -7917, -6375, -4386, -2154, 90, 2145, 3869, 5199,
-    6136, 6712, 6939, 6805, 6298, 5446, 4336, 3124, 2003, 1142, 641, 498,
-    620, 836, 930, 714, 82, -951, -2270, -3704, -5070, -6210, -7018, -7427,
-    -7398, -6934, -6075, -4885, -3437, -1809, -93, 1612, 3226, 4684, 5924, 6878,
-    7449, 7529, 7045, 5999, 4473, 2623, 663, -1159, -2643, -3669, -4197, -4264,
-    -3992, -3567, -3184, -3001, -3110, -3517, -4139, -4831, -5436, -5814, -5860, -5520,
-    -4797, -3741, -2428, -936, 669, 2319, 3930, 5398, 6599, 7398, 7660, 7284,
-    6234, 4564, 2433, 94, -2152, -4028, -5324, -5930, -5849, -5200, -4189, -3069,
-    -2089, -1430, -1179, -1312, -1708, -2178, -2516, -2544, -2142, -1266, 48, 1692,
-    3506, 5308, 6920, 8198, 9033, 9346, 9078, 8217, 6825, 5044, 3099, 1265,
-    -183, -1061, -1344, -1166, -771, -457, -494, -1034, -2067, -3435, -4896, -6171,
-    -6995, -7189, -6684, -5524, -3839, -1828, 273, 2252, 3956, 5282, 6161, 6542,
-    6406, 5784, 4773, 3549, 2352, 1429, 935, 870, 1063, 1247, 1153, 592,
-    -488, -1998, -3726, -5396, -6734, -7507, -7561, -6848, -5447, -3552, -1412, 721,
-    2631, 4169, 5264, 5900, 6080, 5819, 5169, 4238, 3201, 2284, 1705, 1599,
-    1985, 2764, 3738, 4646, 5236, 5312, 4765, 3588, 1887, -142, -2263, -4248,
-    -5904, -7090, -7723, -7762, -7206, -6121, -4654, -3023, -1474, -219, 598, 934,
-    846, 474, -8, -431, -650, -564, -143, 580, 1526, 2578, 3580, 4377,
-    4846, 4900, 4495, 3653, 2444, 955, -690, -2310, -3686, -4618, -4946, -4571,
-    -3509, -1905, 30, 2053, 3901, 5319, 6119, 6194, 5515, 4146, 2252, 64,
-    -2159, -4139, -5601, -6323, -6179, -5164, -3407, -1172, 1183, 3279, 4780, 5435,
-    5119, 3864, 1851, -634, -3258, -5690, -7638, -8888, -9334, -8966, -7852, -6135,
-    -4014, -1698, 629, 2801, 4674, 6138, 7114, 7548, 7413, 6722, 5528, 3930,
-    2078, 161, -1627, -3111, -4165, -4735, -4859, -4634, -4177, -3608, -3040, -2553,
-    -2188, -1966, -1900, -1989, -2208, -2494, -2750, -2857, -2699, -2192, -1311, -93,
-    1376, 2974, 4550, 5940, 6988, 7561, 7563, 6954, 5762, 4080, 2057, -114,
-    -2211, -4015, -5356, -6132, -6320, -5964, -5147, -3981, -2615, -1234, -32, 830,
-    1263, 1274, 973, 555, 250, 273, 763, 1745, 3122, 4707, 6257, 7513,
-    8246, 8302, 7624, 6247, 4299, 1993, -418, -2696, -4659, -6163, -7095, -7386,
-    -7027, -6068, -4632, -2935, -1234, 235, 1308, 1911, 2067, 1903, 1615, 1428,
-    1536, 2050, 2957, 4131, 5376, 6474, 7233, 7506, 7195, 6258, 4738, 2768,
-    554, -1669, -3673, -5274, -6371, -6931, -6967, -6526, -5690, -4597, -3443, -2455,
-    -1821, -1608, -1733, -1977, -2051, -1699, -787, 656, 2467, 4411, 6223, 7655,
-    8496, 8596, 7888, 6413, 4332, 1886, -651, -3012, -4972, -6370, -7115, -7190,
-    -6664, -5683, -4443, -3159, -2036, -1241, -856, -855, -1111, -1431, -1589, -1392,
-    -736, 368, 1806, 3401, 4960, 6315, 7339, 7936, 8028, 7575, 6604, 5236,
-    3700, 2311, 1370, 1059, 1369, 2091, 2888, 3390, 3325, 2591, 1252, -512,
-    -2457, -4314, -5825, -6773, -7009, -6474, -5229, -3438, -1338, 811, 2785, 4434,
-    5692, 6543, 6972, 6939, 6396, 5334, 3831, 2064, 279, -1275, -2406, -3015,
-    -3099, -2734, -2058, -1250, -483, 89, 358, 283, -88, -637, -1207, -1633,
-    -1761, -1486, -782, 294, 1624, 3060, 4455, 5700, 6722, 7465, 7876, 7900,
-    7507, 6711, 5579, 4227, 2794, 1420, 242, -632, -1142, -1298, -1176, -888,
-    -560, -312, -240, -407, -828, -1468, -2248, -3066, -3816, -4385, -4674, -4600,
-    -4106, -3170, -1831, -200, 1556, 3247, 4690, 5733, 6280, 6285, 5734, 4646,
-    3095, 1215, -817, -2812, -4592, -6011, -6959, -7362, -7192, -6491, -5377, -4027,
-    -2650, -1442, -563, -109, -97, -456, -1039, -1658, -2120, -2255, -1958, -1207,
-    -68, 1322, 2793, 4178, 5335, 6161, 6600, 6627, 6242, 5462, 4328, 2916,
-    1349, -212, -1591, -2652, -3349, -3732, -3905, -3977, -4021, -4080, -4179, -4350,
-    -4631, -5039, -5538, -6025, -6357, -6398, -6054, -5295, -4158, -2739, -1158, 470,
-    2031, 3393, 4417, 4985, 5004, 4418, 3245, 1625, -195, -1916, -3252, -4001,
-    -4097, -3625, -2789, -1866, -1144, -862, -1169, -2085, -3471, -5056, -6505, -7504,
-    -7828, -7391, -6251, -4577, -2599, -553, 1357, 2984, 4222, 4986, 5209, 4882,
-    4075, 2964, 1811, 911, 496, 657, 1308, 2186, 2917, 3153, 2677, 1454,
-    -372, -2508, -4595, -6301, -7381, -7699, -7234, -6069, -4373, -2384, -364, 1446,
-    2876, 3834, 4309, 4364, 4116, 3712, 3309, 3055, 3032, 3216, 3489, 3670,
-    3563, 3014, 1961, 455, -1363, -3265, -4961, -6165, -6669, -6395, -5389, -3806,
-    -1862, 203, 2152, 3772, 4890, 5393, 5258, 4575, 3545, 2440, 1542, 1094,
-    1240, 1978, 3144, 4458, 5602, 6312, 6419, 5858, 4658, 2936, 876, -1288,
-    -3287, -4862, -5823, -6091, -5680, -4676, -3227, -1533, 168, 1621, 2589, 2933,
-    2665, 1938, 978, 35, -685, -1053, -1018, -604, 83, 860, 1511, 1858,
-    1791, 1285, 405, -699, -1830, -2773, -3331, -3376, -2879, -1910, -612, 835,
-    2229, 3362, 4037, 4101, 3486, 2236, 516, -1404, -3192, -4542, -5226, -5128,
-    -4257, -2750, -835, 1225, 3182, 4821, 5975, 6524, 6387, 5525, 3969, 1850,
-    -607, -3119, -5397, -7183, -8299, -8669, -8317, -7342, -5899, -4186, -2399, -712,
-    720, 1771, 2379, 2577, 2464, 2174, 1853, 1633, 1609, 1830, 2310, 3003,
-    3785, 4484, 4935, 4995, 4565, 3613, 2184, 374, -1668, -3740, -5615, -7087,
-    -8002, -8276, -7904, -6961, -5571, -3890, -2101, -374, 1170, 2454, 3434, 4104,
-    4496, 4655, 4627, 4476, 4282, 4107, 3984, 3944, 4021, 4240, 4582, 4981,
-    5319, 5443, 5223, 4583, 3518, 2069, 317, -1620, -3576, -5364, -6806, -7756,
-    -8107, -7816, -6914, -5516, -3801, -1995, -320, 1045, 2000, 2526, 2666, 2513,
-    2191, 1849, 1644, 1705, 2074, 2693, 3417, 4040, 4342, 4149, 3379, 2042,
-    238, -1847, -3947, -5786, -7141, -7863, -7885, -7221, -5962, -4256, -2324, -438,
-    1124, 2150, 2527, 2260, 1474, 406, -654, -1406, -1602, -1104, 66, 1726,
-    3579, 5284, 6529, 7106, 6931, 6037, 4544, 2645, 575, -1414, -3070, -4179,
-    -4609, -4372, -3634, -2691, -1895, -1549, -1822, -2700, -3985, -5349, -6447, -6998,
-    -6829, -5893, -4284, -2213, 50, 2227, 4050, 5300, 5831, 5580, 4560, 2874,
-    725, -1614, -3842, -5660, -6820, -7178, -6741, -5659, -4197, -2683, -1433, -685,
-    -545, -962, -1728, -2545, -3103, -3156, -2588, -1443, 109, 1846, 3552, 5040,
-    6156, 6786, 6863, 6383, 5432, 4183, 2861, 1682, 814, 322, 151, 157,
-    159, -13, -474, -1246, -2235, -3267, -4147, -4715, -4872, -4586, -3893, -2884,
-    -1689, -456, 674, 1596, 2259, 2650, 2776, 2662, 2362, 1962, 1581, 1356,
-    1398, 1746, 2353, 3107, 3844, 4381, 4557, 4263, 3453, 2159, 494, -1355,
-    -3173, -4748, -5900, -6520, -6564, -6046, -5031, -3639, -2023, -347, 1227, 2563,
-    3562, 4170, 4361, 4146, 3582, 2774, 1859, 1011, 408, 178, 359, 890,
-    1615, 2335, 2876, 3139, 3097, 2763, 2174, 1376, 391, -761, -2028, -3313,
-    -4495, -5439, -6037, -6243, -6079, -5599, -4873, -3989, -3060, -2218, -1591, -1268,
-    -1254, -1450, -1683, -1757, -1513, -880, 115, 1378, 2762, 4086, 5171, 5872,
-    6100, 5817, 5046, 3861, 2356, 634, -1170, -2891, -4357, -5411, -5941, -5910,
-    -5368, -4424, -3225, -1949, -777, 147, 755, 1040, 1049, 871, 622, 431,
-    432, 734, 1381, 2332, 3462, 4592, 5522, 6074, 6119, 5589, 4486, 2895,
-    976, -1069, -3026, -4705, -5968, -6730, -6959, -6647, -5824, -4571, -3028, -1379,
-    183, 1493, 2434, 2954, 3074, 2894, 2573, 2290, 2185, 2315, 2628, 2973,
-    3145, 2953, 2278, 1105, -468, -2224, -3878, -5133, -5763, -5656, -4837, -3451,
-    -1721, 121, 1862, 3327, 4360, 4829, 4632, 3752, 2322, 632, -930, -1976,
-    -2218, -1553, -87, 1910, 4083, 6066, 7549, 8331, 8340, 7616, 6296, 4594,
-    2776, 1117, -131, -801, -872, -492, 44, 378, 207, -598, -1966, -3652,
-    -5331, -6675, -7427, -7431, -6649, -5159, -3163, -945, 1210, 3062, 4421, 5148,
-    5163, 4458, 3138, 1454, -221, -1495, -2064, -1802, -813, 591, 1982, 2939,
-    3137, 2430, 894, -1186, -3404, -5331, -6612, -7035, -6560, -5298, -3470, -1375,
-    655, 2324, 3415, 3836, 3634, 2975, 2093, 1259, 736, 727, 1296, 2338,
-    3601, 4752, 5472, 5558, 4963, 3760, 2110, 211, -1729, -3524, -5009, -6047,
-    -6552, -6503, -5940, -4970, -3767, -2546, -1515, -830, -558, -657, -980, -1328,
-    -1510, -1398, -955, -244, 599, 1409, 2021, 2303, 2178, 1648, 782, -283,
-    -1361, -2238, -2731, -2740, -2274, -1438, -399, 676, 1638, 2356, 2708, 2596,
-    1980, 893, -552, -2179, -3796, -5231, -6342, -7007, -7143, -6727, -5803, -4470,
-    -2885, -1235, 310, 1624, 2609, 3211, 3431, 3317, 2936, 2395, 1835, 1398,
-    1194, 1304, 1766, 2529, 3438, 4284, 4845, 4925, 4401, 3268, 1629, -346,
-    -2448, -4457, -6183, -7495, -8307, -8556, -8204, -7257, -5798, -4000, -2112, -413,
-    859, 1556, 1651, 1240, 511, -304, -974, -1303, -1163, -512, 615, 2106,
-    3777, 5393, 6704, 7480, 7556, 6864, 5455, 3472, 1100, -1438, -3906, -6067,
-    -7708, -8644, -8763, -8071, -6690, -4815, -2668, -479, 1531, 3176, 4306, 4826,
-    4736, 4160, 3320, 2483, 1917, 1827, 2289, 3220, 4415, 5611, 6535, 6958,
-    6733, 5809, 4231, 2129, -276, -2692, -4807, -6337, -7072, -6906, -5864, -4102,
-    -1885, 435, 2461, 3813, 4226, 3624, 2141, 104, -2034, -3798, -4810, -4855,
-    -3911, -2154, 77, 2393, 4451, 6010, 6925, 7120, 6568, 5293, 3413, 1189,
-    -980, -2653, -3470, -3264, -2106, -277, 1818, 3746, 5122, 5666, 5233, 3848,
-    1715, -796, -3234, -5171, -6303, -6505, -5832, -4502, -2837, -1184, 171, 1043,
-    1382, 1285, 968, 694, 692, 1117, 2015, 3301, 4775, 6175, 7234, 7744,
-    7585, 6749, 5324, 3470, 1405, -630, -2414, -3774, -4603, -4893, -4746, -4355,
-    -3948, -3722, -3781, -4106, -4569, -4978, -5138, -4913, -4258, -3220, -1904, -447,
-    1012, 2347, 3451, 4241, 4662, 4715, 4455, 3979, 3420, 2922, 2607, 2523,
-    2607, 2703, 2599, 2103, 1104, -367, -2122, -3868, -5283, -6093, -6130, -5362,
-    -3896, -1938, 257, 2422, 4313, 5705, 6414, 6323, 5428, 3853, 1846, -245,
-    -2022, -3131, -3342, -2610, -1086, 895, 2907, 4520, 5388, 5314, 4288, 2466,
-    101, -2480, -4910, -6832, -7971, -8166, -7401, -5814, -3670, -1285, 1014, 2918,
-    4172, 4624, 4228, 3075, 1388, -506, -2242, -3470, -3928, -3510, -2286, -478,
-    1569, 3461, 4859, 5553, 5454, 4565, 3004, 978, -1261, -3432, -5227, -6361,
-    -6654, -6056, -4646, -2642, -363, 1849, 3683, 4888, 5298, 4852, 3598, 1691,
-    -619, -2999, -5078, -6522, -7130, -6884, -5909, -4401, -2584, -670, 1169, 2789,
-    4058, 4884, 5250, 5204, 4823, 4221, 3540, 2915, 2458, 2280, 2445, 2918,
-    3568, 4213, 4651, 4684, 4177, 3090, 1472, -534, -2691, -4726, -6400, -7539,
-    -8052, -7929, -7223, -6020, -4457, -2727, -1038, 435, 1573, 2336, 2770, 2960,
-    2965, 2826, 2596, 2356, 2192, 2200, 2447, 2916, 3481, 3952, 4124, 3822,
-    2959, 1560, -255, -2298, -4340, -6128, -7436, -8087, -7995, -7181, -5775, -3962,
-    -1948, 70, 1920, 3464, 4598, 5239, 5362, 5021, 4346, 3506, 2673, 1982,
-    1499, 1214, 1054, 897, 590, 4, -932, -2192, -3657, -5131, -6397, -7270,
-    -7623, -7399, -6616, -5362, -3776, -2035, -348, 1092, 2149, 2776, 3012, 2965,
-    2779, 2595, 2534, 2665, 2980, 3385, 3715, 3767, 3355, 2385, 901, -939,
-    -2908, -4743, -6163, -6932, -6890, -5980, -4285, -2061, 304, 2395, 3852, 4437,
-    4077, 2881, 1091, -967, -2925, -4436, -5270, -5357, -4783, -3758, -2556, -1426,
-    -534, 60, 393, 590, 817, 1230, 1926, 2918, 4123, 5374, 6452, 7127,
-    7217, 6635, 5417, 3706, 1723, -292, -2146, -3712, -4909, -5664, -5929, -5711,
-    -5101, -4288, -3524, -3044, -2965, -3247, -3714, -4117, -4207, -3804, -2861, -1468,
-    182, 1860, 3350, 4479, 5147, 5324, 5021, 4291, 3264, 2170, 1291, 875,
-    1044, 1738, 2719, 3651, 4224, 4221, 3555, 2262, 492, -1538, -3581, -5388,
-    -6746, -7513, -7617, -7053, -5874, -4215, -2286, -357, 1292, 2437, 2989, 3009,
-    2657, 2123, 1586, 1188, 1032, 1176, 1624, 2308, 3082, 3754, 4128, 4049,
-    3436, 2307, 768, -1016, -2855, -4551, -5937, -6899, -7389, -7389, -6897, -5939,
-    -4591, -2989, -1316, 211, 1393, 2106, 2321, 2081, 1487, 676, -204, -1019,
-    -1647, -1986, -1986, -1673, -1144, -535, 7, 374, 545, 568, 523, 481,
-    502, 642, 951, 1489, 2300, 3366, 4573, 5732, 6633, 7100, 7024, 6353,
-    5077, 3241, 985, -1452, -3764, -5626, -6768, -7040, -6432, -5041, -3040, -663,
-    1818, 4138, 6073, 7461, 8219, 8342, 7870, 6872, 5459, 3788, 2058, 479,
-    -782, -1644, -2125, -2306, -2314, -2296, -2393, -2699, -3238, -3949, -4702, -5328,
-    -5671, -5625, -5145, -4252, -3017, -1535, 73, 1668, 3106, 4274, 5083, 5452,
-    5321, 4673, 3574, 2180, 733, -482, -1212, -1302, -749, 301, 1597, 2849,
-    3784, 4198, 3996, 3209, 1983, 547, -826, -1874, -2394, -2273, -1527, -297,
-    1179, 2631, 3819, 4578, 4847, 4657, 4097, 3292, 2408, 1624, 1113, 1002,
-    1332, 2015, 2831, 3481, 3675, 3212, 2044, 279, -1850, -4043, -5994, -7441,
-    -8202, -8177, -7367, -5897, -4003, -1983, -139, 1278, 2115, 2354, 2104, 1590,
-    1092, 884, 1167, 2014, 3337, 4902, 6385, 7448, 7809, 7306, 5942, 3875,
-    1376, -1228, -3602, -5462, -6615, -6963, -6510, -5392, -3865, -2240, -806, 240,
-    837, 1067, 1110, 1178, 1455, 2035, 2892, 3885, 4802, 5392, 5430, 4801,
-    3541, 1822, -97, -1906, -3299, -4034, -3978, -3132, -1661, 135, 1888, 3261,
-    4013, 4038, 3381, 2222, 838, -466, -1403, -1769, -1485, -617, 622, 1922,
-    2936, 3363, 3018, 1886, 119, -1997, -4122, -5941, -7232, -7890, -7899, -7309,
-    -6224, -4797, -3235, -1780, -647, 54, 349, 374, 314, 354, 622, 1154,
-    1892, 2717, 3480, 4028, 4226, 3980, 3245, 2037, 453, -1324, -3046, -4431,
-    -5224, -5275, -4582, -3278, -1586, 222, 1861, 3079, 3687, 3568, 2706, 1214,
-    -666, -2605, -4241, -5246, -5405, -4677, -3188, -1189, 1004, 3072, 4761, 5890,
-    6328, 6000, 4918, 3205, 1070, -1213, -3351, -5094, -6278, -6831, -6757, -6129,
-    -5065, -3719, -2276, -952, 60, 636, 760, 534, 156, -145, -189, 123,
-    796, 1768, 2935, 4169, 5326, 6239, 6749, 6736, 6145, 5016, 3475, 1683,
-    -204, -2042, -3688, -5008, -5887, -6240, -6060, -5437, -4517, -3461, -2424, -1530,
-    -843, -365, -66, 118, 287, 545, 972, 1615, 2466, 3452, 4444, 5303,
-    5899, 6119, 5894, 5213, 4136, 2794, 1368, 51, -1010, -1738, -2139, -2286,
-    -2283, -2217, -2144, -2098, -2108, -2198, -2370, -2588, -2774, -2853, -2779, -2547,
-    -2181, -1720, -1206, -697, -266, 13, 92, -34, -314, -633, -846, -832,
-    -531, 67, 913, 1902, 2897, 3771, 4418, 4746, 4683, 4180, 3228, 1905,
-    386, -1100, -2333, -3146, -3470, -3346, -2894, -2279, -1705, -1408, -1572, -2249,
-    -3339, -4616, -5785, -6563, -6763, -6318, -5262, -3714, -1862, 65, 1828, 3207,
-    4049, 4305, 4027, 3344, 2446, 1563, 920, 692, 937, 1548, 2265, 2770,
-    2792, 2203, 1037, -540, -2301, -4006, -5432, -6407, -6835, -6707, -6090, -5120,
-    -3972, -2821, -1807, -1010, -432, 16, 466, 1051, 1851, 2856, 3944, 4917,
-    5575, 5771, 5446, 4642, 3499, 2207, 977, 2, -578, -742, -603, -375,
-    -295, -559, -1272, -2410, -3815, -5247, -6451, -7212, -7394, -6961, -5976, -4566,
-    -2898, -1174, 403, 1673, 2547, 3014, 3142, 3069, 2937, 2855, 2886, 3047,
-    3305, 3586, 3806, 3864, 3635, 2996, 1897, 389, -1362, -3093, -4510, -5400,
-    -5677, -5377, -4603, -3500, -2225, -928, 252, 1201, 1867, 2277, 2519, 2711,
-    2969, 3373, 3954, 4704, 5596, 6561, 7465, 8126, 8375, 8093, 7229, 5809,
-    3932, 1745, -579, -2860, -4913, -6573, -7687, -8111, -7720, -6442, -4315, -1527,
-    1580, 4570, 6988, 8453, 8727, 7758, 5685, 2797, -505, -3771, -6582, -8630,
-    -9747, -9895, -9144, -7645, -5597, -3239, -811, 1506, 3628, 5539, 7215, 8591,
-    9546, 9931, 9639, 8670, 7133, 5195, 3041, 850, -1229, -3077, -4594, -5707,
-    -6379, -6600, -6365, -5688, -4622, -3263, -1759, -319, 827, 1479, 1524, 946,
-    -154, -1561, -2984, -4120, -4726, -4662, -3909, -2549, -735, 1339, 3470, 5463,
-    7154, 8424, 9200, 9435, 9107, 8228, 6846, 5040, 2924, 653, -1579, -3550,
-    -5013, -5725, -5523, -4399, -2539, -305, 1835, 3432, 4165, 3887, 2626, 575,
-    -1959, -4605, -6980, -8744, -9646, -9563, -8494, -6556, -3963, -993, 2052, 4879,
-    7223, 8875, 9691, 9597, 8601, 6792, 4331, 1458, -1516, -4245, -6370, -7560,
-    -7580, -6378, -4115, -1144, 2035, 4872, 6897, 7819, 7548, 6187, 4007, 1371,
-    -1368, -3920, -6095, -7841, -9216, -10288, -11071, -11528, -11592, -11174, -10231, -8803,
-    -7001, -4972, -2882, -864, 1014, 2719, 4180, 5278, 5872, 5832, 5091, 3736,
-    2043, 407, -758, -1120, -530, 898, 2812, 4736, 6221, 6956, 6828, 5910,
-    4409, 2574, 639, -1196, -2755, -3887, -4502, -4602, -4287, -3732, -3129, -2611,
-    -2218, -1906, -1579, -1151, -595, 37, 634, 1052, 1158, 890, 281, -565,
-    -1512, -2395, -3053, -3345, -3154, -2409, -1139, 483, 2168, 3562, 4315, 4177,
-    3066, 1091, -1467, -4194, -6635, -8410, -9284, -9184, -8186, -6485, -4328, -1963,
-    369, 2457, 4162, 5432, 6279, 6762, 6953, 6887, 6576, 6052, 5401, 4732,
-    4130, 3623, 3167, 2665, 2037, 1247, 313, -702, -1686, -2505, -3040, -3213,
-    -3013, -2516, -1865, -1212, -681, -343, -201, -199, -233, -169, 133, 791,
-    1850, 3264, 4885, 6490, 7831, 8687, 8885, 8325, 7009, 5043, 2635, 55,
-    -2415, -4522, -6070, -6921, -6986, -6225, -4669, -2459, 120, 2670, 4763, 6034,
-    6248, 5348, 3472, 907, -1986, -4816, -7226, -8944, -9823, -9818, -8964, -7372,
-    -5223, -2733, -131, 2353, 4501, 6126, 7078, 7255, 6606, 5173, 3108, 667,
-    -1824, -4016, -5599, -6375, -6284, -5402, -3922, -2114, -272, 1344, 2538, 3198,
-    3307, 2932, 2183, 1198, 139, -827, -1557, -1935, -1880, -1383, -517, 586,
-    1764, 2855, 3719, 4267, 4452, 4277, 3805, 3152, 2440, 1754, 1131, 555,
-    -22, -632, -1250, -1801, -2172, -2247, -1945, -1246, -189, 1160, 2719, 4381,
-    6016, 7471, 8574, 9159, 9108, 8403, 7135, 5485, 3667, 1873, 240, -1131,
-    -2150, -2727, -2790, -2338, -1495, -517, 245, 452, -102, -1426, -3335, -5508,
-    -7579, -9226, -10219, -10414, -9756, -8279, -6108, -3448, -577, 2185, 4518, 6153,
-    6925, 6799, 5879, 4372, 2553, 738, -770, -1735, -2035, -1674, -780, 421,
-    1674, 2778, 3612, 4124, 4314, 4231, 3935, 3469, 2858, 2107, 1191, 72,
-    -1257, -2745, -4308, -5851, -7251, -8345, -8934, -8812, -7820, -5949, -3411, -629,
-    1853, 3490, 3873, 2854, 591, -2500, -5860, -8915, -11203, -12471, -12689, -11988,
-    -10579, -8696, -6550, -4323, -2185, -293, 1256, 2462, 3394, 4162, 4880, 5634,
-    6439, 7230, 7900, 8336, 8435, 8124, 7399, 6329, 5045, 3710, 2499, 1569,
-    1001, 771, 755, 771, 607, 78, -896, -2259, -3838, -5393, -6649, -7331,
-    -7231, -6274, -4527, -2182, 474, 3100, 5362, 6954, 7631, 7247, 5813, 3514,
-    678, -2291, -5006, -7196, -8729, -9554, -9651, -9027, -7747, -5964, -3920, -1911,
-    -218, 963, 1549, 1561, 1120, 436, -243, -701, -794, -469, 249, 1273,
-    2478, 3721, 4840, 5669, 6079, 6028, 5583, 4901, 4177, 3587, 3241, 3171,
-    3345, 3689, 4098, 4462, 4695, 4760, 4675, 4500, 4307, 4158, 4086, 4105,
-    4188, 4255, 4172, 3792, 2993, 1727, 50, -1891, -3905, -5820, -7498, -8839,
-    -9758, -10173, -10001, -9208, -7841, -6028, -3960, -1854, 52, 1527, 2373, 2471,
-    1815, 534, -1125, -2832, -4234, -5034, -5050, -4233, -2669, -565, 1790, 4071,
-    5964, 7203, 7595, 7045, 5575, 3346, 666, -2052, -4367, -5899, -6399, -5803,
-    -4241, -1977, 657, 3335, 5792, 7856, 9417, 10381, 10650, 10154, 8893, 6985,
-    4671, 2277, 135, -1509, -2534, -2945, -2855, -2456, -1985, -1665, -1659, -2030,
-    -2739, -3644, -4555, -5293, -5728, -5785, -5446, -4760, -3824, -2758, -1681, -683,
-    202, 990, 1713, 2406, 3103, 3834, 4621, 5464, 6343, 7187, 7882, 8304,
-    8349, 7937, 7019, 5594, 3727, 1566, -658, -2635, -4054, -4684, -4427, -3325,
-    -1541, 672, 3004, 5137, 6780, 7714, 7827, 7140, 5797, 4035, 2149, 452,
-    -779, -1355, -1214, -429, 806, 2206, 3447, 4232, 4338, 3663, 2238, 224,
-    -2126, -4538, -6762, -8597, -9897, -10566, -10565, -9914, -8711, -7132, -5385, -3649,
-    -2048, -665, 464, 1354, 2048, 2581, 2972, 3215, 3283, 3136, 2766, 2227,
-    1641, 1183, 1040, 1352, 2167, 3440, 5031, 6718, 8249, 9401, 9996, 9933,
-    9222, 7984, 6403, 4691, 3058, 1649, 502, -430, -1231, -2002, -2854, -3860,
-    -5045, -6396, -7845, -9236, -10365, -11053, -11184, -10720, -9724, -8338, -6731, -5070,
-    -3529, -2249, -1288, -609, -96, 427, 1133, 2100, 3284, 4569, 5813, 6866,
-    7591, 7884, 7666, 6899, 5623, 3968, 2118, 269, -1385, -2682, -3514, -3842,
-    -3703, -3214, -2565, -1967, -1603, -1584, -1930, -2569, -3363, -4123, -4644, -4756,
-    -4386, -3577, -2453, -1169, 121, 1276, 2177, 2727, 2870, 2616, 2058, 1367,
-    741, 331, 205, 345, 659, 989, 1144, 933, 221, -1022, -2692, -4566,
-    -6356, -7786, -8643, -8813, -8264, -7040, -5252, -3076, -751, 1430, 3147, 4121,
-    4177, 3277, 1528, -815, -3398, -5841, -7803, -9033, -9404, -8934, -7760, -6102,
-    -4229, -2410, -861, 282, 966, 1225, 1166, 935, 679, 540, 639, 1052,
-    1802, 2843, 4057, 5265, 6272, 6905, 7027, 6555, 5485, 3880, 1865, -375,
-    -2604, -4569, -6026, -6770, -6674, -5721, -4003, -1725, 803, 3219, 5180, 6408,
-    6714, 6045, 4495, 2283, -277, -2797, -4879, -6192, -6531, -5864, -4349, -2279,
-    4, 2180, 3996, 5300, 6030, 6181, 5786, 4948, 3821, 2573, 1358, 306,
-    -512, -1085, -1420, -1530, -1450, -1241, -961, -665, -410, -232, -136, -125,
-    -211, -404, -711, -1133, -1649, -2225, -2829, -3440, -4033, -4585, -5063, -5396,
-    -5476, -5190, -4479, -3353, -1891, -240, 1425, 2938, 4155, 4960, 5261, 5000,
-    4189, 2943, 1465, 2, -1213, -2021, -2402, -2483, -2480, -2616, -3078, -3958,
-    -5200, -6615, -7944, -8929, -9368, -9174, -8401, -7200, -5763, -4285, -2932, -1830,
-    -1053, -609, -418, -319, -112, 384, 1270, 2527, 4038, 5628, 7107, 8281,
-    8984, 9086, 8516, 7287, 5546, 3580, 1779, 562, 267, 1026, 2697, 4877,
-    7004, 8514, 9025, 8432, 6886, 4713, 2297, -43, -2112, -3808, -5073, -5897,
-    -6314, -6388, -6215, -5933, -5668, -5475, -5326, -5112, -4675, -3872, -2668, -1143,
-    549, 2215, 3664, 4773, 5500, 5836, 5800, 5472, 5016, 4628, 4495, 4734,
-    5327, 6103, 6807, 7188, 7062, 6337, 5032, 3261, 1218, -845, -2668, -4041,
-    -4827, -4986, -4567, -3702, -2577, -1426, -510, -39, -96, -593, -1295, -1884,
-    -2070, -1686, -715, 728, 2447, 4226, 5880, 7262, 8269, 8847, 8990, 8697,
-    8001, 6995, 5834, 4682, 3674, 2879, 2259, 1691, 1039, 199, -907, -2305,
-    -3949, -5747, -7567, -9229, -10523, -11282, -11427, -10957, -9935, -8478, -6726, -4825,
-    -2934, -1208, 253, 1422, 2301, 2908, 3275, 3429, 3395, 3238, 3081, 3057,
-    3262, 3734, 4439, 5258, 6014, 6525, 6645, 6283, 5435, 4205, 2771, 1343,
-    123, -738, -1163, -1166, -852, -417, -110, -156, -668, -1618, -2854, -4144,
-    -5244, -5974, -6244, -6015, -5281, -4083, -2509, -677, 1270, 3161, 4850, 6247,
-    7304, 7979, 8246, 8104, 7562, 6656, 5498, 4280, 3213, 2479, 2200, 2365,
-    2800, 3223, 3352, 2976, 2002, 478, -1426, -3496, -5519, -7303, -8677, -9489,
-    -9605, -8945, -7530, -5503, -3098, -597, 1720, 3614, 4904, 5458, 5189, 4088,
-    2249, -100, -2603, -4837, -6416, -7085, -6771, -5589, -3791, -1687, 436, 2350,
-    3896, 4985, 5597, 5762, 5558, 5108, 4574, 4112, 3822, 3717, 3735, 3750,
-    3588, 3088, 2170, 859, -744, -2495, -4238, -5833, -7160, -8100, -8519, -8318,
-    -7496, -6195, -4686, -3311, -2369, -1991, -2083, -2377, -2545, -2308, -1517, -181,
-    1544, 3421, 5197, 6636, 7539, 7756, 7213, 5928, 4018, 1693, -758, -3011,
-    -4765, -5794, -5980, -5346, -4058, -2396, -682, 792, 1837, 2404, 2579, 2527,
-    2433, 2439, 2588, 2813, 2959, 2834, 2258, 1136, -479, -2381, -4277, -5864,
-    -6871, -7134, -6639, -5519, -4026, -2505, -1346, -869, -1204, -2250, -3694, -5094,
-    -6009, -6139, -5386, -3839, -1723, 665, 3039, 5182, 6945, 8243, 9050, 9377,
-    9259, 8763, 8005, 7116, 6206, 5349, 4565, 3811, 3011, 2114, 1094, -64,
-    -1347, -2701, -4020, -5146, -5880, -6037, -5515, -4332, -2638, -712, 1092, 2446,
-    3132, 3071, 2346, 1176, -162, -1420, -2406, -2982, -3083, -2739, -2083, -1360,
-    -884, -939, -1664, -3003, -4729, -6521, -8061, -9097, -9469, -9110, -8040, -6366,
-    -4260, -1930, 417, 2612, 4538, 6099, 7222, 7864, 8031, 7775, 7191, 6389,
-    5464, 4477, 3468, 2456, 1432, 350, -848, -2210, -3727, -5312, -6810, -8042,
-    -8841, -9079, -8686, -7669, -6118, -4199, -2144, -222, 1312, 2263, 2512, 2020,
-    827, -928, -3000, -5085, -6875, -8115, -8642, -8424, -7558, -6223, -4620, -2943,
-    -1353, 42, 1208, 2161, 2943, 3606, 4216, 4836, 5511, 6261, 7070, 7878,
-    8578, 9044, 9144, 8754, 7783, 6223, 4190, 1909, -315, -2150, -3316, -3659,
-    -3170, -1966, -275, 1597, 3320, 4591, 5161, 4877, 3722, 1837, -518, -3005,
-    -5248, -6899, -7709, -7567, -6506, -4675, -2305, 327, 2926, 5212, 6959, 8005,
-    8253, 7674, 6313, 4294, 1845, -699, -2945, -4555, -5318, -5186, -4283, -2857,
-    -1187, 490, 1979, 3130, 3883, 4283, 4461, 4573, 4752, 5064, 5493, 5955,
-    6323, 6452, 6201, 5449, 4135, 2307, 140, -2109, -4190, -5896, -7078, -7660,
-    -7639, -7062, -6031, -4727, -3366, -2141, -1193, -592, -320, -277, -315, -264,
-    37, 674, 1617, 2739, 3879, 4870, 5565, 5860, 5693, 5037, 3943, 2579,
-    1210, 110, -522, -615, -272, 263, 698, 789, 412, -382, -1365, -2210,
-    -2612, -2399, -1583, -334, 1114, 2538, 3756, 4630, 5062, 5005, 4479, 3608,
-    2619, 1772, 1268, 1195, 1527, 2143, 2865, 3489, 3815, 3681, 3005, 1812,
-    227, -1553, -3296, -4789, -5874, -6473, -6594, -6320, -5778, -5091, -4353, -3622,
-    -2909, -2202, -1497, -823, -233, 215, 466, 469, 202, -309, -986, -1709,
-    -2340, -2747, -2822, -2495, -1751, -634, 758, 2289, 3814, 5186, 6267, 6924,
-    7044, 6566, 5510, 4002, 2266, 565, -855, -1827, -2281, -2255, -1883, -1374,
-    -977, -941, -1453, -2561, -4144, -5935, -7602, -8819, -9353, -9105, -8106, -6490,
-    -4459, -2251, -108, 1759, 3185, 4078, 4425, 4290, 3794, 3079, 2267, 1447,
-    688, 50, -444, -808, -1090, -1341, -1592, -1833, -1991, -1959, -1652, -1045,
-    -184, 821, 1835, 2709, 3299, 3465, 3096, 2148, 676, -1185, -3260, -5370,
-    -7349, -9051, -10356, -11164, -11394, -11010, -10046, -8611, -6856, -4955, -3086, -1388,
-    55, 1193, 1987, 2430, 2556, 2421, 2122, 1816, 1688, 1879, 2440, 3315,
-    4334, 5247, 5801, 5814, 5202, 4002, 2368, 535, -1248, -2764, -3842, -4354,
-    -4234, -3501, -2273, -752, 820, 2203, 3211, 3748, 3798, 3402, 2633, 1609,
-    483, -585, -1457, -2049, -2367, -2496, -2547, -2619, -2793, -3127, -3629, -4255,
-    -4907, -5461, -5794, -5826, -5527, -4889, -3922, -2657, -1150, 514, 2212, 3804,
-    5171, 6229, 6912, 7166, 6946, 6235, 5069, 3560, 1875, 174, -1418, -2821,
-    -4004, -4973, -5736, -6278, -6573, -6577, -6231, -5481, -4317, -2770, -893, 1232,
-    3481, 5695, 7683, 9228, 10129, 10266, 9620, 8264, 6347, 4074, 1678, -593,
-    -2477, -3711, -4113, -3661, -2516, -1012, 403, 1273, 1270, 298, -1491, -3756,
-    -6067, -8019, -9333, -9877, -9642, -8697, -7165, -5225, -3124, -1158, 370, 1233,
-    1361, 888, 125, -510, -628, -2, 1358, 3205, 5131, 6679, 7474, 7315,
-    6222, 4422, 2303, 337, -1029, -1471, -878, 596, 2552, 4472, 5854, 6338,
-    5782, 4274, 2083, -436, -2934, -5128, -6823, -7903, -8315, -8067, -7222, -5897,
-    -4266, -2536, -890, 567, 1808, 2858, 3756, 4519, 5101, 5415, 5390, 5021,
-    4373, 3571, 2790, 2201, 1917, 1968, 2305, 2797, 3249, 3459, 3260, 2546,
-    1294, -413, -2406, -4457, -6309, -7715, -8475, -8482, -7725, -6292, -4361, -2163,
-    67, 2122, 3828, 5048, 5694, 5729, 5176, 4131, 2771, 1333, 92, -697,
-    -841, -264, 973, 2679, 4566, 6300, 7587, 8243, 8230, 7641, 6665, 5531,
-    4465, 3628, 3082, 2772, 2555, 2238, 1647, 678, -646, -2153, -3579, -4637,
-    -5084, -4766, -3657, -1882, 328, 2685, 4889, 6654, 7752, 8040, 7466, 6087,
-    4088, 1770, -497, -2330, -3400, -3515, -2655, -965, 1289, 3752, 6039, 7812,
-    8827, 8957, 8203, 6691, 4638, 2309, -19, -2104, -3756, -4842, -5279, -5054,
-    -4220, -2887, -1234, 492, 2009, 3065, 3478, 3172, 2211, 798, -773, -2166,
-    -3059, -3226, -2597, -1272, 498, 2353, 3897, 4780, 4759, 3746, 1830, -720,
-    -3523, -6168, -8295, -9656, -10140, -9749, -8557, -6705, -4417, -2000, 174, 1750,
-    2486, 2339, 1481, 240, -985, -1843, -2120, -1769, -890, 306, 1544, 2557,
-    3161, 3289, 2988, 2386, 1655, 985, 537, 410, 591, 954, 1272, 1273,
-    723, -463, -2183, -4177, -6123, -7711, -8706, -8956, -8389, -7014, -4940, -2380,
-    373, 2998, 5215, 6851, 7840, 8187, 7924, 7104, 5796, 4116, 2242, 393,
-    -1237, -2524, -3438, -4050, -4493, -4898, -5333, -5774, -6099, -6113, -5616, -4501,
-    -2792, -638, 1714, 3987, 5937, 7376, 8168, 8237, 7584, 6268, 4426, 2287,
-    125, -1835, -3454, -4670, -5508, -6067, -6461, -6759, -6981, -7101, -7029, -6649,
-    -5877, -4685, -3113, -1278, 643, 2456, 3985, 5075, 5603, 5516, 4841, 3700,
-    2318, 973, -89, -735, -971, -940, -873, -982, -1367, -1973, -2613, -3029,
-    -2991, -2369, -1177, 436, 2214, 3865, 5131, 5823, 5832, 5137, 3800, 1962,
-    -173, -2347, -4289, -5750, -6544, -6594, -5968, -4855, -3496, -2142, -996, -177,
-    295, 462, 402, 223, 46, -22, 106, 474, 1059, 1768, 2488, 3116,
-    3586, 3893, 4092, 4269, 4492, 4799, 5186, 5600, 5937, 6075, 5904, 5347,
-    4366, 2996, 1348, -401, -2033, -3337, -4148, -4377, -4025, -3173, -1959, -538,
-    932, 2302, 3437, 4232, 4622, 4597, 4200, 3521, 2685, 1847, 1177, 817,
-    844, 1248, 1925, 2694, 3329, 3621, 3419, 2658, 1384, -250, -1998, -3570,
-    -4684, -5119, -4761, -3628, -1871, 249, 2394, 4194, 5317, 5548, 4844, 3341,
-    1294, -987, -3208, -5131, -6595, -7508, -7844, -7628, -6937, -5895, -4658, -3393,
-    -2245, -1304, -579, -16, 481, 1012, 1637, 2342, 3053, 3686, 4169, 4437,
-    4424, 4072, 3354, 2311, 1069, -168, -1176, -1779, -1892, -1534, -821, 70,
-    920, 1504, 1627, 1178, 153, -1339, -3101, -4904, -6536, -7828, -8661, -8972,
-    -8752, -8040, -6915, -5497, -3922, -2319, -794, 567, 1720, 2641, 3291, 3613,
-    3555, 3116, 2376, 1497, 684, 97, -216, -334, -418, -636, -1102, -1845,
-    -2831, -3963, -5089, -6023, -6581, -6615, -6038, -4869, -3232, -1309, 703, 2606,
-    4206, 5357, 5965, 6006, 5519, 4603, 3405, 2093, 840, -202, -949, -1417,
-    -1722, -2040, -2536, -3301, -4313, -5442, -6482, -7210, -7440, -7050, -6009, -4386,
-    -2345, -112, 2061, 3927, 5255, 5853, 5591, 4452, 2595, 362, -1782, -3348,
-    -3946, -3406, -1826, 460, 2980, 5228, 6767, 7316, 6792, 5296, 3075, 467,
-    -2157, -4453, -6142, -7041, -7073, -6275, -4784, -2816, -613, 1607, 3665, 5422,
-    6785, 7705, 8142, 8057, 7407, 6178, 4393, 2140, -403, -2965, -5209, -6799,
-    -7480, -7146, -5868, -3878, -1530, 769, 2639, 3782, 4026, 3360, 1961, 177,
-    -1538, -2733, -3082, -2499, -1171, 498, 2022, 2970, 3081, 2323, 886, -892,
-    -2630, -3982, -4711, -4726, -4095, -2998, -1662, -307, 901, 1880, 2626, 3180,
-    3607, 3990, 4413, 4930, 5557, 6263, 6956, 7497, 7741, 7590, 7018, 6091,
-    4980, 3920, 3152, 2849, 3065, 3696, 4490, 5121, 5286, 4787, 3569, 1740,
-    -469, -2760, -4831, -6404, -7275, -7358, -6692, -5420, -3767, -2004, -383, 899,
-    1725, 2066, 1998, 1684, 1320, 1093, 1138, 1495, 2105, 2823, 3468, 3848,
-    3815, 3315, 2416, 1293, 189, -645, -1029, -895, -298, 607, 1589, 2385,
-    2750, 2494, 1533, -75, -2126, -4302, -6238, -7607, -8193, -7930, -6891, -5259,
-    -3270, -1163, 852, 2598, 3917, 4682, 4811, 4279, 3123, 1460, -526, -2604,
-    -4522, -6036, -6953, -7159, -6651, -5529, -3982, -2234, -505, 1010, 2163, 2868,
-    3111, 2945, 2477, 1849, 1211, 684, 352, 243, 335, 551, 772, 867,
-    730, 319, -320, -1068, -1761, -2242, -2400, -2201, -1697, -1015, -327, 203,
-    448, 353, -46, -633, -1241, -1683, -1773, -1358, -374, 1127, 2970, 4877,
-    6524, 7616, 7957, 7474, 6211, 4315, 2001, -464, -2778, -4622, -5714, -5860,
-    -5021, -3367, -1265, 813, 2397, 3133, 2861, 1670, -130, -2103, -3788, -4778,
-    -4813, -3829, -1985, 370, 2766, 4700, 5766, 5738, 4620, 2622, 103, -2528,
-    -4902, -6753, -7922, -8349, -8057, -7142, -5746, -4045, -2230, -462, 1147, 2552,
-    3758, 4796, 5684, 6405, 6902, 7101, 6920, 6278, 5137, 3539, 1615, -433,
-    -2346, -3849, -4715, -4800, -4061, -2592, -640, 1440, 3256, 4447, 4765, 4137,
-    2679, 639, -1653, -3847, -5634, -6784, -7173, -6799, -5771, -4289, -2596, -935,
-    498, 1597, 2351, 2826, 3129, 3359, 3554, 3675, 3639, 3335, 2653, 1528,
-    -5, -1809, -3656, -5256, -6306, -6586, -6022, -4722, -2946, -1051, 604, 1749,
-    2237, 2068, 1395, 490, -335, -805, -748, -131, 935, 2210, 3391, 4186,
-    4389, 3922, 2853, 1381, -226, -1703, -2849, -3552, -3811, -3728, -3460, -3162,
-    -2958, -2907, -2966, -2996, -2819, -2277, -1298, 70, 1656, 3197, 4378, 4900,
-    4561, 3332, 1358, -1075, -3584, -5759, -7256, -7847, -7430, -6035, -3835, -1136,
-    1668, 4160, 5979, 6886, 6829, 5922, 4406, 2574, 727, -873, -2023, -2595,
-    -2555, -1965, -999, 94, 1039, 1605, 1659, 1192, 313, -811, -2007, -3125,
-    -4055, -4736, -5150, -5315, -5280, -5119, -4907, -4698, -4507, -4306, -4017, -3540,
-    -2795, -1764, -512, 819, 2040, 2952, 3376, 3193, 2371, 966, -871, -2883,
-    -4732, -6070, -6623, -6250, -4979, -3004, -641, 1749, 3817, 5267, 5895, 5606,
-    4433, 2547, 262, -2025, -3898, -5006, -5148, -4330, -2740, -668, 1556, 3634,
-    5345, 6566, 7220, 7255, 6652, 5444, 3729, 1697, -370, -2156, -3382, -3862,
-    -3526, -2434, -759, 1250, 3289, 5030, 6174, 6526, 6032, 4802, 3071, 1137,
-    -720, -2288, -3448, -4167, -4468, -4423, -4152, -3802, -3499, -3304, -3207, -3128,
-    -2936, -2502, -1753, -693, 604, 2004, 3339, 4446, 5206, 5567, 5550, 5235,
-    4738, 4192, 3734, 3471, 3473, 3758, 4264, 4831, 5240, 5298, 4880, 3951,
-    2589, 950, -778, -2424, -3822, -4809, -5249, -5060, -4235, -2884, -1252, 339,
-    1565, 2188, 2104, 1390, 281, -900, -1818, -2207, -1945, -1102, 96, 1334,
-    2288, 2704, 2470, 1646, 439, -854, -1908, -2444, -2297, -1451, -43, 1664,
-    3347, 4699, 5494, 5632, 5158, 4249, 3160, 2165, 1477, 1171, 1167, 1269,
-    1241, 896, 145, -965, -2280, -3584, -4642, -5254, -5307, -4800, -3845, -2647,
-    -1468, -558, -72, -35, -333, -730, -942, -736, -2, 1222, 2753, 4298,
-    5533, 6184, 6077, 5175, 3601, 1606, -497, -2395, -3839, -4681, -4889, -4509,
-    -3644, -2433, -1031, 413, 1783, 3003, 4052, 4933, 5637, 6115, 6282, 6040,
-    5317, 4109, 2493, 610, -1318, -3010, -4174, -4580, -4131, -2928, -1297, 303,
-    1422, 1738, 1131, -272, -2118, -3944, -5306, -5892, -5592, -4506, -2874, -971,
-    954, 2716, 4194, 5315, 6022, 6291, 6158, 5706, 5062, 4372, 3742, 3194,
-    2671, 2085, 1336, 330, -962, -2457, -3987, -5338, -6288, -6667, -6415, -5595,
-    -4346, -2861, -1364, -59, 926, 1534, 1766, 1689, 1446, 1215, 1161, 1404,
-    1986, 2864, 3911, 4950, 5787, 6239, 6172, 5514, 4270, 2533, 484, -1633,
-    -3546, -4986, -5725, -5633, -4708, -3079, -977, 1290, 3399, 5061, 6053, 6234,
-    5579, 4200, 2328, 275, -1618, -3054, -3858, -4004, -3604, -2870, -2061, -1424,
-    -1120, -1193, -1561, -2059, -2504, -2751, -2711, -2340, -1635, -638, 564, 1826,
-    2960, 3780, 4152, 4038, 3507, 2719, 1864, 1127, 646, 490, 636, 981,
-    1361, 1573, 1430, 840, -188, -1565, -3142, -4698, -5986, -6809, -7057, -6732,
-    -5947, -4875, -3672, -2432, -1214, -55, 1008, 1917, 2609, 3065, 3333, 3500,
-    3672, 3945, 4359, 4868, 5369, 5729, 5796, 5433, 4592, 3317, 1725, -5,
-    -1644, -2960, -3788, -4052, -3785, -3142, -2383, -1770, -1497, -1627, -2091, -2715,
-    -3279, -3566, -3400, -2700, -1501, 58, 1768, 3371, 4606, 5274, 5275, 4622,
-    3450, 2010, 609, -453, -950, -784, -15, 1160, 2469, 3627, 4403, 4670,
-    4412, 3706, 2700, 1578, 500, -448, -1249, -1943, -2611, -3353, -4234, -5254,
-    -6337, -7335, -8037, -8231, -7776, -6659, -5017, -3104, -1243, 259, 1176, 1389,
-    916, -95, -1394, -2667, -3608, -3983, -3701, -2837, -1595, -252, 914, 1697,
-    2008, 1878, 1436, 862, 322, -76, -322, -506, -775, -1259, -2025, -3045,
-    -4205, -5317, -6176, -6608, -6509, -5860, -4724, -3241, -1603, -14, 1329, 2268,
-    2696, 2585, 1997, 1079, 26, -979, -1820, -2480, -3033, -3593, -4245, -4991,
-    -5749, -6364, -6652, -6456, -5698, -4398, -2682, -760, 1113, 2703, 3843, 4441,
-    4461, 3921, 2909, 1594, 214, -957, -1679, -1821, -1416, -658, 160, 730,
-    812, 289, -812, -2337, -4052, -5683, -6948, -7622, -7583, -6826, -5456, -3669,
-    -1709, 185, 1818, 3037, 3745, 3931, 3666, 3086, 2376, 1722, 1248, 969,
-    789, 540, 40, -827, -2061, -3543, -5067, -6387, -7271, -7559, -7194, -6222,
-    -4775, -3035, -1210, 492, 1891, 2872, 3402, 3515, 3308, 2927, 2528, 2235,
-    2133, 2262, 2591, 3010, 3363, 3477, 3185, 2387, 1121, -441, -2055, -3461,
-    -4433, -4825, -4604, -3819, -2572, -1003, 712, 2403, 3920, 5138, 5955, 6320,
-    6223, 5694, 4805, 3693, 2545, 1562, 921, 724, 965, 1514, 2150, 2612,
-    2657, 2129, 1007, -587, -2416, -4185, -5612, -6490, -6716, -6294, -5321, -3970,
-    -2453, -972, 314, 1308, 1995, 2431, 2718, 2967, 3277, 3698, 4219, 4784,
-    5320, 5742, 5951, 5843, 5327, 4359, 2966, 1252, -629, -2497, -4157, -5432,
-    -6195, -6364, -5905, -4870, -3414, -1769, -194, 1065, 1830, 2039, 1744, 1070,
-    197, -675, -1371, -1782, -1867, -1648, -1195, -591, 110, 865, 1627, 2351,
-    2999, 3546, 3972, 4277, 4453, 4463, 4242, 3723, 2848, 1613, 114, -1449,
-    -2819, -3738, -3990, -3476, -2261, -558, 1324, 3034, 4238, 4689, 4270, 3012,
-    1097, -1160, -3364, -5115, -6086, -6098, -5176, -3535, -1512, 524, 2260, 3514,
-    4253, 4559, 4569, 4430, 4273, 4180, 4158, 4135, 3978, 3532, 2666, 1343,
-    -349, -2219, -4046, -5624, -6799, -7504, -7768, -7685, -7384, -7005, -6667, -6422,
-    -6238, -6023, -5676, -5109, -4280, -3206, -1962, -659, 580, 1646, 2463, 3002,
-    3294, 3426, 3510, 3645, 3901, 4290, 4737, 5082, 5126, 4700, 3728, 2261,
-    494, -1286, -2790, -3807, -4258, -4206, -3836, -3389, -3083, -3035, -3224, -3492,
-    -3615, -3383, -2679, -1515, -21, 1597, 3114, 4316, 5019, 5095, 4501, 3324,
-    1786, 203, -1111, -1917, -2097, -1673, -792, 347, 1546, 2634, 3494, 4088,
-    4481, 4795, 5179, 5753, 6576, 7605, 8699, 9654, 10238, 10259, 9604, 8272,
-    6370, 4094, 1677, -665, -2758, -4472, -5716, -6445, -6664, -6436, -5880, -5156,
-    -4405, -3711, -3079, -2454, -1747, -875, 209, 1507, 2980, 4549, 6107, 7546,
-    8754, 9619, 10039, 9952, 9343, 8254, 6803, 5187, 3629, 2310, 1313, 604,
-    57, -500, -1223, -2207, -3462, -4917, -6414, -7732, -8623, -8878, -8384, -7166,
-    -5378, -3251, -1035, 1046, 2805, 4082, 4742, 4693, 3944, 2648, 1093, -368,
-    -1388, -1716, -1266, -143, 1399, 3019, 4365, 5151, 5224, 4585, 3353, 1719,
-    -100, -1897, -3492, -4753, -5610, -6065, -6194, -6129, -6012, -5929, -5853, -5672,
-    -5246, -4463, -3259, -1664, 195, 2145, 4021, 5686, 7031, 7976, 8452, 8391,
-    7737, 6494, 4748, 2680, 543, -1395, -2925, -3945, -4462, -4567, -4385, -4026,
-    -3566, -3052, -2498, -1867, -1092, -120, 1068, 2428, 3843, 5130, 6083, 6531,
-    6380, 5638, 4400, 2823, 1089, -606, -2079, -3195, -3877, -4118, -3992, -3654,
-    -3307, -3158, -3356, -3929, -4755, -5592, -6157, -6201, -5587, -4322, -2556, -533,
-    1450, 3092, 4136, 4428, 3942, 2794, 1216, -506, -2101, -3377, -4236, -4681,
-    -4787, -4679, -4498, -4359, -4296, -4236, -4028, -3526, -2657, -1475, -167, 981,
-    1676, 1710, 1009, -353, -2158, -4086, -5784, -6938, -7330, -6886, -5700, -3999,
-    -2098, -319, 1061, 1877, 2113, 1902, 1479, 1106, 982, 1199, 1722, 2398,
-    2998, 3280, 3073, 2321, 1099, -389, -1835, -2927, -3433, -3244, -2386, -1033,
-    536, 2011, 3128, 3712, 3723, 3289, 2665, 2135, 1920, 2115, 2660, 3357,
-    3930, 4115, 3734, 2750, 1263, -529, -2358, -3932, -5000, -5419, -5151, -4266,
-    -2962, -1529, -237, 734, 1314, 1562, 1655, 1806, 2168, 2796, 3660, 4623,
-    5467, 5959, 5913, 5220, 3894, 2097, 109, -1748, -3175, -3953, -3998, -3375,
-    -2286, -1017, 123, 889, 1158, 955, 447, -108, -468, -475, -77, 684,
-    1687, 2759, 3719, 4404, 4674, 4458, 3770, 2715, 1458, 208, -827, -1481,
-    -1650, -1303, -505, 588, 1759, 2782, 3467, 3720, 3556, 3079, 2436, 1789,
-    1300, 1089, 1194, 1571, 2095, 2582, 2842, 2723, 2155, 1162, -142, -1579,
-    -2935, -3988, -4565, -4593, -4117, -3285, -2307, -1404, -753, -453, -520, -876,
-    -1361, -1782, -1973, -1812, -1245, -305, 904, 2253, 3611, 4820, 5722, 6192,
-    6165, 5629, 4631, 3267, 1663, -31, -1645, -3002, -3959, -4439, -4437, -4025,
-    -3340, -2547, -1801, -1213, -815, -553, -311, 38, 598, 1409, 2446, 3631,
-    4861, 6014, 6936, 7452, 7408, 6733, 5474, 3800, 1957, 209, -1202, -2093,
-    -2374, -2071, -1337, -437, 303, 616, 387, -326, -1328, -2333, -3052, -3283,
-    -2951, -2093, -842, 591, 1964, 3074, 3791, 4065, 3945, 3569, 3111, 2741,
-    2593, 2722, 3066, 3470, 3740, 3698, 3226, 2302, 1010, -486, -1963, -3165,
-    -3867, -3945, -3402, -2357, -1017, 360, 1525, 2290, 2564, 2366, 1823, 1129,
-    481, 20, -204, -253, -257, -362, -676, -1245, -2029, -2905, -3689, -4188,
-    -4261, -3880, -3149, -2266, -1466, -941, -778, -938, -1283, -1622, -1748, -1500,
-    -830, 183, 1365, 2477, 3268, 3531, 3162, 2191, 778, -800, -2227, -3217,
-    -3597, -3341, -2568, -1502, -390, 559, 1225, 1601, 1788, 1929, 2146, 2492,
-    2920, 3279, 3382, 3097, 2397, 1364, 178, -918, -1681, -1938, -1625, -829,
-    213, 1180, 1786, 1864, 1411, 572, -404, -1234, -1682, -1609, -996, 46,
-    1303, 2508, 3407, 3822, 3696, 3090, 2163, 1139, 260, -269, -336, 25,
-    626, 1170, 1364, 1025, 140, -1150, -2599, -3943, -4956, -5494, -5495, -4976,
-    -4029, -2806, -1509, -354, 474, 858, 785, 355, -250, -816, -1157, -1151,
-    -774, -91, 778, 1686, 2484, 3041, 3264, 3117, 2630, 1897, 1070, 307,
-    -272, -628, -807, -926, -1132, -1548, -2229, -3122, -4073, -4865, -5294, -5236,
-    -4665, -3647, -2311, -820, 659, 1967, 2954, 3480, 3435, 2784, 1598, 55,
-    -1585, -3033, -4034, -4429, -4180, -3371, -2170, -791, 565, 1748, 2685, 3355,
-    3772, 3973, 4025, 4011, 3998, 4010, 4032, 3999, 3799, 3313, 2480, 1318,
-    -84, -1577, -2962, -4034, -4626, -4635, -4037, -2918, -1463, 107, 1577, 2769,
-    3553, 3854, 3667, 3062, 2192, 1269, 505, 61, 22, 386, 1068, 1924,
-    2780, 3451, 3773, 3635, 3017, 1991, 722, -581, -1718, -2533, -2920, -2834,
-    -2315, -1496, -570, 227, 685, 682, 225, -569, -1503, -2341, -2866, -2958,
-    -2624, -1978, -1197, -474, 23, 189, -5, -529, -1305, -2204, -3059, -3715,
-    -4067, -4084, -3815, -3398, -3014, -2813, -2860, -3136, -3542, -3910, -4055, -3841,
-    -3233, -2288, -1145, 11, 1008, 1715, 2038, 1924, 1378, 487, -595, -1679,
-    -2593, -3232, -3592, -3757, -3875, -4095, -4503, -5077, -5708, -6241, -6512, -6380,
-    -5761, -4670, -3214, -1568, 60, 1457, 2452, 2949, 2937, 2490, 1763, 949,
-    225, -310, -644, -851, -1081, -1502, -2223, -3231, -4393, -5505, -6348, -6745,
-    -6616, -5988, -4968, -3712, -2413, -1253, -352, 248, 564, 668, 688, 763,
-    984, 1357, 1806, 2195, 2364, 2190, 1642, 811, -99, -845, -1214, -1079,
-    -427, 649, 1965, 3303, 4453, 5252, 5616, 5552, 5162, 4606, 4058, 3676,
-    3570, 3755, 4134, 4527, 4732, 4595, 4072, 3247, 2301, 1454, 896, 738,
-    989, 1550, 2230, 2787, 2990, 2691, 1873, 671, -666, -1841, -2606, -2813,
-    -2418, -1488, -177, 1305, 2730, 3883, 4606, 4841, 4640, 4126, 3462, 2817,
-    2321, 2035, 1925, 1867, 1688, 1225, 389, -796, -2190, -3574, -4694, -5342,
-    -5411, -4892, -3857, -2457, -891, 630, 1894, 2724, 3026, 2816, 2193, 1319,
-    402, -337, -721, -661, -166, 664, 1625, 2460, 2919, 2833, 2156, 973,
-    -543, -2190, -3753, -5030, -5865, -6169, -5943, -5287, -4378, -3406, -2529, -1842,
-    -1359, -1026, -760, -481, -127, 331, 886, 1495, 2077, 2531, 2741, 2596,
-    2014, 987, -391, -1909, -3270, -4183, -4449, -4014, -2980, -1555, 23, 1536,
-    2793, 3647, 4014, 3892, 3361, 2597, 1830, 1290, 1144, 1463, 2209, 3238,
-    4330, 5256, 5813, 5858, 5336, 4289, 2834, 1151, -545, -2044, -3181, -3844,
-    -4003, -3734, -3186, -2552, -2033, -1781, -1849, -2192, -2674, -3103, -3279, -3070,
-    -2459, -1531, -438, 635, 1485, 1938, 1878, 1268, 166, -1261, -2751, -4009,
-    -4769, -4848, -4191, -2882, -1137, 747, 2475, 3815, 4637, 4934, 4807, 4412,
-    3900, 3392, 2963, 2645, 2414, 2178, 1803, 1157, 149, -1218, -2814, -4402,
-    -5700, -6442, -6452, -5700, -4299, -2490, -590, 1097, 2350, 3045, 3197, 2972,
-    2612, 2341, 2312, 2564, 3014, 3477, 3731, 3578, 2892, 1655, -38, -1992,
-    -3958, -5689, -6992, -7771, -8024, -7807, -7223, -6385, -5390, -4309, -3191, -2049,
-    -836, 502, 1986, 3579, 5182, 6642, 7788, 8462, 8569, 8099, 7128, 5814,
-    4363, 2959, 1710, 644, -281, -1174, -2148, -3268, -4543, -5912, -7241, -8353,
-    -9066, -9231, -8789, -7806, -6442, -4891, -3336, -1901, -617, 558, 1689, 2824,
-    3962, 5033, 5886, 6336, 6235, 5499, 4125, 2217, -30, -2365, -4514, -6219,
-    -7305, -7728, -7576, -7042, -6351, -5688, -5163, -4792, -4497, -4147, -3616, -2811,
-    -1702, -322, 1243, 2848, 4312, 5487, 6282, 6655, 6645, 6386, 6052, 5777,
-    5630, 5563, 5403, 4944, 4055, 2716, 1004, -933, -2900, -4690, -6118, -7030,
-    -7317, -6940, -5956, -4508, -2806, -1094, 398, 1489, 2090, 2239, 2103, 1920,
-    1928, 2283, 2977, 3833, 4581, 4947, 4732, 3865, 2397, 481, -1633, -3660,
-    -5337, -6441, -6830, -6495, -5543, -4157, -2560, -977, 422, 1534, 2342, 2912,
-    3355, 3790, 4322, 4980, 5686, 6283, 6596, 6460, 5765, 4492, 2711, 574,
-    -1687, -3792, -5457, -6455, -6669, -6101, -4875, -3206, -1348, 454, 2003, 3166,
-    3885, 4159, 4056, 3724, 3331, 3029, 2928, 3061, 3364, 3723, 3987, 3992,
-    3616, 2821, 1652, 244, -1188, -2408, -3190, -3362, -2866, -1768, -229, 1519,
-    3189, 4524, 5331, 5501, 5023, 3987, 2588, 1097, -186, -1009, -1219, -795,
-    135, 1327, 2483, 3315, 3602, 3235, 2250, 825, -773, -2261, -3384, -3950,
-    -3871, -3174, -1988, -542, 880, 2017, 2683, 2801, 2435, 1760, 996, 382,
-    121, 320, 968, 1936, 2974, 3796, 4163, 3931, 3075, 1719, 86, -1561,
-    -2951, -3863, -4191, -3963, -3342, -2588, -1981, -1731, -1929, -2530, -3364, -4173,
-    -4669, -4609, -3878, -2525, -761, 1091, 2694, 3788, 4233, 4040, 3349, 2381,
-    1389, 607, 184, 143, 378, 665, 732, 366, -509, -1815, -3325, -4730,
-    -5731, -6104, -5752, -4764, -3373, -1887, -628, 162, 408, 200, -260, -702,
-    -869, -630, -29, 744, 1397, 1639, 1282, 307, -1126, -2735, -4192, -5204,
-    -5596, -5350, -4595, -3552, -2481, -1586, -941, -485, -63, 494, 1287, 2314,
-    3466, 4540, 5284, 5474, 4958, 3708, 1859, -314, -2472, -4277, -5477, -5967,
-    -5776, -5046, -4011, -2916, -1951, -1238, -793, -505, -193, 282, 965, 1789,
-    2577, 3100, 3167, 2675, 1649, 254, -1241, -2517, -3289, -3385, -2786, -1633,
-    -193, 1212, 2293, 2862, 2874, 2431, 1748, 1089, 706, 756, 1272, 2161,
-    3230, 4230, 4935, 5184, 4910, 4177, 3162, 2117, 1319, 980, 1167, 1811,
-    2719, 3596, 4124, 4073, 3336, 1965, 181, -1685, -3302, -4394, -4788, -4445,
-    -3447, -1979, -313, 1253, 2469, 3162, 3270, 2866, 2136, 1320, 657, 329,
-    430, 943, 1742, 2613, 3298, 3559, 3256, 2404, 1151, -251, -1505, -2359,
-    -2651, -2306, -1356, 57, 1714, 3356, 4711, 5559, 5778, 5356, 4396, 3084,
-    1643, 310, -692, -1216, -1215, -745, 14, 798, 1337, 1411, 902, -154,
-    -1576, -3107, -4454, -5346, -5605, -5167, -4072, -2477, -621, 1262, 2975, 4358,
-    5295, 5741, 5709, 5245, 4451, 3496, 2564, 1787, 1232, 894, 660, 354,
-    -186, -1063, -2290, -3749, -5215, -6433, -7147, -7161, -6424, -5024, -3134, -975,
-    1217, 3236, 4909, 6103, 6745, 6823, 6397, 5596, 4600, 3602, 2766, 2163,
-    1732, 1331, 781, -86, -1355, -2978, -4777, -6486, -7801, -8471, -8353, -7435,
-    -5831, -3757, -1469, 778, 2763, 4310, 5301, 5708, 5596, 5114, 4464, 3857,
-    3432, 3210, 3103, 2952, 2574, 1844, 729, -718, -2344, -3921, -5218, -6034,
-    -6241, -5843, -4985, -3887, -2801, -1956, -1485, -1392, -1571, -1830, -1939, -1714,
-    -1060, 0, 1302, 2584, 3567, 4031, 3874, 3158, 2085, 936, -17, -596,
-    -768, -653, -476, -472, -807, -1543, -2614, -3837, -4957, -5717, -5904, -5428,
-    -4365, -2934, -1442, -205, 560, 778, 514, -44, -629, -987, -953, -494,
-    263, 1054, 1576, 1596, 1033, -9, -1275, -2433, -3169, -3292, -2796, -1841,
-    -705, 277, 827, 826, 304, -579, -1563, -2363, -2756, -2624, -1973, -964,
-    130, 1001, 1413, 1282, 705, -60, -685, -895, -545, 336, 1537, 2731,
-    3590, 3867, 3440, 2357, 823, -871, -2411, -3491, -3898, -3563, -2592, -1252,
-    99, 1113, 1543, 1300, 490, -644, -1809, -2718, -3157, -3056, -2488, -1641,
-    -763, -85, 251, 213, -135, -644, -1122, -1372, -1233, -636, 347, 1517,
-    2597, 3321, 3500, 3058, 2063, 704, -758, -2049, -2920, -3195, -2829, -1903,
-    -607, 802, 2046, 2885, 3168, 2866, 2079, 1012, -60, -862, -1207, -1053,
-    -483, 314, 1084, 1580, 1618, 1107, 100, -1225, -2622, -3823, -4600, -4830,
-    -4505, -3701, -2564, -1277, -18, 1055, 1839, 2292, 2442, 2368, 2197, 2084,
-    2158, 2475, 2982, 3532, 3922, 3956, 3512, 2586, 1276, -252, -1797, -3165,
-    -4175, -4673, -4575, -3903, -2771, -1356, 125, 1459, 2477, 3059, 3144, 2761,
-    2028, 1124, 269, -326, -530, -319, 242, 1013, 1812, 2456, 2787, 2714,
-    2221, 1367, 273, -889, -1929, -2678, -3015, -2904, -2400, -1640, -828, -183,
-    139, 77, -335, -964, -1609, -2058, -2151, -1810, -1064, -55, 999, 1866,
-    2376, 2426, 2000, 1183, 147, -909, -1781, -2278, -2285, -1804, -947, 79,
-    1016, 1627, 1762, 1392, 611, -384, -1354, -2068, -2358, -2161, -1530, -615,
-    357, 1125, 1481, 1323, 680, -278, -1287, -2071, -2429, -2288, -1726, -948,
-    -215, 236, 269, -133, -857, -1685, -2368, -2699, -2573, -2008, -1146, -217,
-    530, 889, 750, 137, -805, -1838, -2687, -3127, -3050, -2485, -1606, -680,
-    23, 306, 101, -510, -1327, -2096, -2572, -2586, -2116, -1290, -339, 478,
-    949, 974, 597, -13, -620, -991, -945, -394, 610, 1879, 3151, 4149,
-    4650, 4555, 3934, 2989, 1987, 1183, 754, 746, 1062, 1500, 1816, 1796,
-    1313, 385, -826, -2060, -3025, -3484, -3321, -2576, -1429, -165, 900, 1519,
-    1572, 1075, 187, -816, -1623, -1968, -1692, -777, 635, 2268, 3798, 4931,
-    5468, 5344, 4642, 3571, 2405, 1414, 798, 636, 860, 1272, 1608, 1613,
-    1132, 164, -1127, -2466, -3540, -4078, -3916, -3035, -1564, 269, 2185, 3907,
-    5195, 5886, 5917, 5341, 4319, 3089, 1918, 1038, 578, 514, 671, 792,
-    629, 32, -996, -2299, -3602, -4584, -4968, -4594, -3443, -1632, 614, 3003,
-    5246, 7112, 8440, 9130, 9151, 8540, 7376, 5785, 3954, 2113, 467, -855,
-    -1817, -2486, -3026, -3618, -4358, -5202, -5980, -6440, -6343, -5559, -4119, -2184,
-    17, 2269, 4410, 6335, 7956, 9160, 9818, 9806, 9054, 7588, 5570, 3263,
-    994, -918, -2231, -2845, -2831, -2404, -1865, -1514, -1566, -2099, -3033, -4163,
-    -5217, -5930, -6109, -5667, -4630, -3122, -1328, 554, 2339, 3874, 5047, 5783,
-    6057, 5891, 5373, 4646, 3894, 3286, 2935, 2844, 2897, 2890, 2625, 1975,
-    930, -399, -1815, -3112, -4126, -4763, -4986, -4826, -4382, -3801, -3252, -2906,
-    -2881, -3189, -3726, -4297, -4667, -4620, -4033, -2900, -1326, 517, 2419, 4176,
-    5626, 6645, 7147, 7091, 6499, 5468, 4185, 2902, 1855, 1188, 918, 918,
-    946, 726, 70, -1078, -2638, -4404, -6091, -7405, -8101, -8028, -7172, -5677,
-    -3805, -1853, -91, 1302, 2281, 2928, 3380, 3770, 4194, 4670, 5124, 5424,
-    5408, 4920, 3858, 2233, 184, -2057, -4197, -5924, -6990, -7261, -6743, -5578,
-    -4019, -2365, -886, 251, 1010, 1474, 1803, 2153, 2611, 3155, 3654, 3935,
-    3851, 3330, 2402, 1204, -57, -1163, -1947, -2316, -2290, -2004, -1667, -1490,
-    -1624, -2104, -2808, -3501, -3920, -3863, -3250, -2159, -805, 517, 1517, 1997,
-    1902, 1338, 521, -291, -870, -1086, -941, -560, -140, 100, -21, -585,
-    -1540, -2699, -3780, -4486, -4597, -4044, -2932, -1507, -94, 1002, 1567, 1511,
-    888, -112, -1212, -2129, -2637, -2611, -2070, -1183, -215, 556, 898, 691,
-    -34, -1105, -2262, -3222, -3747, -3711, -3135, -2165, -1035, -22, 621, 732,
-    271, -672, -1882, -3063, -3932, -4305, -4141, -3539, -2725, -1980, -1561, -1629,
-    -2213, -3208, -4397, -5493, -6205, -6325, -5773, -4615, -3040, -1322, 245, 1392,
-    1920, 1743, 924, -329, -1713, -2895, -3596, -3673, -3159, -2235, -1167, -256,
-    227, 118, -597, -1797, -3245, -4634, -5659, -6110, -5911, -5104, -3829, -2298,
-    -751, 590, 1545, 2004, 1951, 1472, 736, -50, -679, -996, -934, -536,
-    66, 688, 1137, 1246, 915, 147, -957, -2220, -3419, -4332, -4784, -4690,
-    -4055, -2955, -1528, 53, 1601, 2934, 3885, 4333, 4229, 3608, 2580, 1318,
-    32, -1066, -1805, -2071, -1845, -1218, -363, 538, 1334, 1932, 2315, 2533,
-    2670, 2795, 2969, 3250, 3672, 4215, 4809, 5339, 5642, 5548, 4948, 3835,
-    2303, 535, -1225, -2715, -3713, -4082, -3779, -2870, -1519, 58, 1633, 2990,
-    3957, 4437, 4415, 3963, 3240, 2479, 1918, 1719, 1922, 2432, 3044, 3519,
-    3668, 3397, 2711, 1716, 604, -392, -1051, -1216, -845, -43, 971, 1936,
-    2619, 2879, 2705, 2210, 1583, 1032, 755, 894, 1482, 2435, 3582, 4693,
-    5530, 5912, 5757, 5098, 4069, 2897, 1838, 1099, 772, 824, 1108, 1414,
-    1551, 1406, 990, 428, -68, -286, -78, 597, 1652, 2880, 4013, 4809,
-    5122, 4933, 4348, 3555, 2760, 2140, 1801, 1758, 1935, 2191, 2357, 2276,
-    1854, 1113, 191, -678, -1240, -1310, -861, -38, 905, 1692, 2118, 2109,
-    1746, 1213, 730, 494, 618, 1087, 1769, 2447, 2867, 2809, 2167, 993,
-    -521, -2089, -3397, -4176, -4268, -3666, -2514, -1087, 291, 1334, 1867, 1857,
-    1421, 789, 216, -104, -88, 209, 607, 868, 786, 245, -750, -2047,
-    -3397, -4536, -5248, -5398, -4964, -4062, -2903, -1737, -798, -261, -180, -473,
-    -953, -1398, -1593, -1393, -774, 146, 1155, 2015, 2498, 2441, 1797, 647,
-    -815, -2334, -3629, -4459, -4672, -4261, -3360, -2212, -1113, -328, -35, -268,
-    -913, -1739, -2466, -2843, -2714, -2057, -986, 297, 1550, 2539, 3068, 3014,
-    2356, 1176, -350, -1965, -3375, -4335, -4706, -4477, -3765, -2795, -1834, -1127,
-    -835, -1012, -1586, -2376, -3147, -3680, -3807, -3446, -2612, -1411, -10, 1399,
-    2620, 3486, 3872, 3713, 3026, 1913, 556, -816, -1966, -2703, -2931, -2687,
-    -2128, -1486, -988, -794, -949, -1389, -1954, -2439, -2662, -2512, -1956, -1034,
-    165, 1517, 2887, 4134, 5123, 5725, 5842, 5423, 4494, 3167, 1636, 143,
-    -1066, -1805, -1994, -1662, -945, -53, 782, 1373, 1621, 1531, 1201, 796,
-    501, 467, 771, 1408, 2299, 3315, 4288, 5039, 5394, 5228, 4514, 3353,
-    1957, 596, -458, -1002, -957, -389, 537, 1582, 2480, 2997, 3006, 2516,
-    1662, 679, -158, -622, -591, -51, 915, 2135, 3365, 4358, 4911, 4913,
-    4374, 3445, 2372, 1423, 818, 687, 1039, 1753, 2606, 3317, 3635, 3400,
-    2597, 1363, -38, -1299, -2158, -2460, -2174, -1401, -358, 689, 1490, 1870,
-    1777, 1297, 622, -15, -409, -436, -92, 518, 1204, 1732, 1887, 1544,
-    729, -389, -1539, -2435, -2858, -2728, -2117, -1218, -285, 427, 716, 475,
-    -281, -1393, -2594, -3589, -4131, -4104, -3563, -2720, -1863, -1261, -1092, -1393,
-    -2055, -2862, -3569, -3960, -3909, -3420, -2629, -1760, -1050, -680, -712, -1069,
-    -1572, -1999, -2150, -1907, -1287, -434, 420, 1026, 1186, 821, 3, -1070,
-    -2123, -2882, -3157, -2899, -2208, -1305, -474, 13, -20, -600, -1591, -2731,
-    -3708, -4264, -4259, -3715, -2802, -1786, -938, -454, -414, -768, -1352, -1940,
-    -2315, -2321, -1896, -1091, -66, 956, 1748, 2138, 2053, 1539, 746, -116,
-    -832, -1239, -1270, -962, -446, 77, 397, 352, -109, -908, -1859, -2724,
-    -3286, -3397, -3014, -2213, -1162, -79, 820, 1354, 1418, 1010, 222, -781,
-    -1790, -2595, -3036, -3040, -2632, -1932, -1122, -393, 102, 282, 152, -195,
-    -611, -929, -1000, -724, -92, 800, 1785, 2671, 3280, 3485, 3235, 2549,
-    1504, 242, -1034, -2110, -2810, -3046, -2833, -2290, -1601, -949, -481, -288,
-    -394, -746, -1216, -1635, -1831, -1684, -1167, -345, 643, 1629, 2456, 2996,
-    3160, 2900, 2231, 1253, 145, -868, -1572, -1817, -1566, -896, 24, 986,
-    1783, 2244, 2262, 1825, 1025, 43, -890, -1545, -1742, -1398, -547, 676,
-    2069, 3406, 4463, 5067, 5129, 4656, 3745, 2557, 1300, 190, -589, -910,
-    -732, -115, 778, 1717, 2464, 2834, 2752, 2265, 1518, 714, 61, -265,
-    -153, 421, 1383, 2563, 3723, 4616, 5050, 4937, 4314, 3324, 2173, 1087,
-    276, -123, -77, 341, 973, 1606, 2023, 2070, 1696, 968, 55, -811,
-    -1403, -1554, -1206, -421, 616, 1647, 2413, 2719, 2477, 1722, 607, -642,
-    -1774, -2558, -2836, -2572, -1866, -924, -7, 638, 845, 572, -88, -945,
-    -1762, -2331, -2527, -2326, -1809, -1138, -529, -173, -175, -523, -1084, -1643,
-    -1966, -1880, -1333, -411, 691, 1727, 2470, 2763, 2550, 1886, 929, -104,
-    -998, -1585, -1787, -1634, -1257, -848, -611, -700, -1174, -1963, -2878, -3668,
-    -4096, -4019, -3428, -2444, -1291, -220, 567, 963, 967, 672, 247, -111,
-    -238, -44, 455, 1143, 1832, 2324, 2484, 2272, 1748, 1059, 396, -55,
-    -161, 119, 723, 1501, 2257, 2798, 2993, 2817, 2361, 1804, 1349, 1178,
-    1390, 1973, 2814, 3744, 4570, 5110, 5236, 4922, 4240, 3346, 2446, 1741,
-    1362, 1342, 1617, 2047, 2453, 2664, 2556, 2072, 1251, 231, -787, -1590,
-    -2002, -1934, -1411, -554, 469, 1482, 2314, 2845, 3034, 2913, 2582, 2195,
-    1924, 1890, 2136, 2618, 3228, 3812, 4213, 4304, 4008, 3318, 2308, 1113,
-    -98, -1151, -1897, -2245, -2188, -1803, -1235, -659, -227, -38, -125, -438,
-    -863, -1257, -1494, -1476, -1146, -508, 365, 1350, 2288, 3016, 3401, 3367,
-    2904, 2079, 1029, -83, -1097, -1885, -2362, -2502, -2344, -1976, -1528, -1149,
-    -963, -1025, -1323, -1779, -2265, -2638, -2778, -2618, -2143, -1389, -450, 536,
-    1414, 2037, 2304, 2181, 1696, 926, -18, -1001, -1886, -2550, -2900, -2904,
-    -2605, -2111, -1554, -1066, -756, -682, -834, -1140, -1481, -1717, -1721, -1422,
-    -822, 2, 907, 1723, 2297, 2526, 2370, 1853, 1060, 123, -813, -1590,
-    -2075, -2194, -1975, -1527, -1008, -575, -362, -441, -812, -1408, -2119, -2812,
-    -3341, -3570, -3426, -2946, -2270, -1581, -1057, -823, -926, -1317, -1890, -2503,
-    -2996, -3216, -3062, -2528, -1704, -758, 106, 710, 955, 828, 392, -231,
-    -877, -1382, -1618, -1530, -1163, -654, -187, 68, 4, -392, -1031, -1756,
-    -2387, -2771, -2823, -2557, -2079, -1544, -1124, -968, -1159, -1681, -2431, -3246,
-    -3927, -4298, -4276, -3889, -3257, -2554, -1974, -1664, -1679, -1978, -2429, -2844,
-    -3030, -2858, -2306, -1468, -520, 324, 895, 1115, 1010, 691, 323, 79,
-    92, 405, 947, 1555, 2021, 2174, 1933, 1348, 578, -170, -700, -871,
-    -624, -23, 759, 1501, 1994, 2105, 1818, 1243, 579, 40, -210, -104,
-    306, 872, 1404, 1716, 1681, 1275, 593, -187, -851, -1206, -1147, -681,
-    80, 946, 1692, 2132, 2177, 1855, 1286, 653, 151, -68, 60, 506,
-    1158, 1846, 2383, 2627, 2506, 2045, 1358, 615, -18, -412, -491, -245,
-    254, 870, 1434, 1787, 1814, 1494, 911, 223, -384, -755, -792, -481,
-    110, 842, 1531, 1989, 2073, 1734, 1034, 129, -779, -1483, -1823, -1725,
-    -1222, -446, 405, 1100, 1435, 1304, 730, -143, -1087, -1855, -2260, -2218,
-    -1738, -914, 99, 1100, 1881, 2279, 2209, 1695, 864, -90, -948, -1516,
-    -1675, -1402, -754, 149, 1138, 2010, 2582, 2732, 2431, 1752, 852, -61,
-    -783, -1160, -1120, -672, 104, 1079, 2090, 2962, 3539, 3721, 3481, 2874,
-    2026, 1118, 341, -145, -248, 43, 655, 1440, 2207, 2776, 3016, 2866,
-    2351, 1578, 704, -97, -664, -864, -643, -41, 803, 1688, 2398, 2760,
-    2691, 2196, 1364, 345, -676, -1511, -1995, -2017, -1558, -716, 329, 1360,
-    2176, 2621, 2610, 2147, 1320, 284, -761, -1604, -2073, -2082, -1653, -908,
-    -33, 760, 1282, 1405, 1105, 462, -357, -1141, -1684, -1841, -1559, -881,
-    68, 1107, 2043, 2701, 2963, 2790, 2252, 1497, 718, 94, -250, -290,
-    -107, 144, 279, 129, -405, -1324, -2518, -3808, -4980, -5832, -6220, -6087,
-    -5478, -4533, -3451, -2433, -1628, -1107, -843, -727, -611, -364, 97, 776,
-    1584, 2352, 2886, 3021, 2666, 1831, 633, -725, -2000, -2970, -3487, -3522,
-    -3160, -2579, -1999, -1622, -1562, -1801, -2212, -2605, -2792, -2630, -2065, -1159,
-    -73, 986, 1831, 2348, 2523, 2449, 2291, 2211, 2308, 2588, 2964, 3281,
-    3376, 3125, 2486, 1519, 370, -762, -1682, -2252, -2430, -2285, -1973, -1678,
-    -1559, -1698, -2081, -2590, -3044, -3263, -3128, -2614, -1793, -809, 161, 948,
-    1439, 1608, 1523, 1313, 1128, 1103, 1312, 1724, 2217, 2626, 2796, 2613,
-    2033, 1111, -22, -1197, -2244, -3018, -3427, -3469, -3232, -2862, -2526, -2367,
-    -2442, -2710, -3048, -3283, -3242, -2804, -1959, -810, 465, 1647, 2516, 2905,
-    2747, 2084, 1055, -137, -1277, -2186, -2761, -2980, -2913, -2698, -2492, -2433,
-    -2619, -3081, -3747, -4470, -5071, -5380, -5256, -4641, -3579, -2205, -712, 675,
-    1735, 2310, 2350, 1901, 1095, 119, -824, -1559, -1975, -2033, -1774, -1312,
-    -804, -417, -284, -463, -918, -1540, -2174, -2646, -2800, -2549, -1887, -886,
-    317, 1543, 2601, 3334, 3638, 3484, 2917, 2052, 1054, 110, -607, -982,
-    -976, -626, -32, 656, 1273, 1673, 1760, 1496, 914, 99, -830, -1753,
-    -2560, -3165, -3514, -3580, -3362, -2888, -2205, -1372, -453, 487, 1397, 2230,
-    2949, 3522, 3924, 4125, 4100, 3830, 3302, 2510, 1458, 179, -1262, -2759,
-    -4164, -5301, -6003, -6157, -5725, -4756, -3372, -1757, -120, 1336, 2440, 3074,
-    3200, 2870, 2215, 1410, 637, 48, -258, -257, -2, 392, 772, 980,
-    896, 492, -155, -894, -1531, -1885, -1851, -1439, -770, -39, 516, 675,
-    305, -605, -1948, -3515, -5044, -6283, -7045, -7235, -6856, -6001, -4828, -3523,
-    -2274, -1247, -545, -194, -141, -276, -463, -586, -584, -458, -263, -71,
-    66, 147, 214, 334, 582, 1012, 1632, 2393, 3199, 3920, 4403, 4517,
-    4189, 3433, 2354, 1133, -35, -1006, -1721, -2212, -2585, -2975, -3471, -4092,
-    -4778, -5414, -5852, -5949, -5614, -4826, -3654, -2239, -761, 619, 1795, 2735,
-    3487, 4140, 4775, 5441, 6143, 6840, 7445, 7846, 7930, 7596, 6790, 5536,
-    3951, 2224, 566, -832, -1852, -2475, -2776, -2881, -2912, -2948, -3004, -3026,
-    -2922, -2594, -1980, -1076, 62, 1323, 2576, 3707, 4632, 5307, 5732, 5952,
-    6030, 6013, 5916, 5720, 5354, 4719, 3739, 2424, 888, -670, -1995, -2845,
-    -3059, -2585, -1491, 45, 1766, 3389, 4652, 5355, 5404, 4841, 3822, 2562,
-    1288, 206, -549, -936, -1002, -852, -612, -398, -270, -214, -156, 4,
-    334, 840, 1451, 2040, 2453, 2538, 2194, 1405, 251, -1104, -2439, -3505,
-    -4089, -4073, -3458, -2347, -918, 603, 1995, 3083, 3756, 3972, 3760, 3212,
-    2464, 1657, 920, 330, -101, -429, -746, -1151, -1713, -2431, -3231, -3976,
-    -4505, -4674, -4387, -3629, -2461, -1011, 555, 2066, 3374, 4359, 4922, 4990,
-    4529, 3561, 2182, 577, -1005, -2305, -3129, -3397, -3160, -2569, -1832, -1142,
-    -638, -378, -345, -462, -614, -678, -548, -160, 488, 1340, 2284, 3176,
-    3859, 4199, 4109, 3566, 2630, 1441, 191, -906, -1661, -1961, -1795, -1251,
-    -492, 277, 857, 1102, 948, 420, -378, -1278, -2088, -2643, -2836, -2628,
-    -2054, -1213, -237, 732, 1561, 2134, 2380, 2302, 1972, 1522, 1125, 937,
-    1053, 1477, 2124, 2840, 3430, 3721, 3606, 3064, 2166, 1071, -15, -906,
-    -1475, -1673, -1540, -1198, -818, -577, -632, -1072, -1880, -2920, -3972, -4784,
-    -5147, -4943, -4167, -2916, -1364, 280, 1816, 3081, 3960, 4419, 4517, 4377,
-    4141, 3943, 3872, 3943, 4090, 4191, 4095, 3665, 2837, 1666, 317, -981,
-    -1998, -2574, -2677, -2406, -1954, -1548, -1388, -1583, -2118, -2866, -3611, -4099,
-    -4118, -3567, -2470, -961, 746, 2398, 3779, 4755, 5279, 5401, 5243, 4942,
-    4589, 4228, 3851, 3394, 2758, 1868, 696, -730, -2308, -3841, -5083, -5825,
-    -5948, -5451, -4459, -3183, -1850, -653, 281, 902, 1250, 1435, 1592, 1839,
-    2235, 2744, 3228, 3503, 3413, 2879, 1934, 727, -516, -1566, -2247, -2475,
-    -2272, -1764, -1136, -565, -183, -52, -147, -361, -538, -531, -250, 296,
-    994, 1660, 2097, 2151, 1757, 960, -86, -1163, -2047, -2551, -2578, -2146,
-    -1393, -532, 217, 679, 760, 455, -162, -938, -1684, -2206, -2353, -2056,
-    -1360, -427, 516, 1241, 1573, 1425, 822, -112, -1187, -2190, -2930, -3273,
-    -3170, -2662, -1877, -988, -166, 449, 770, 790, 592, 315, 107, 81,
-    289, 702, 1221, 1718, 2059, 2115, 1791, 1053, -68, -1465, -2952, -4291,
-    -5254, -5686, -5515, -4773, -3578, -2104, -536, 949, 2202, 3119, 3643, 3763,
-    3519, 2987, 2271, 1490, 759, 162, -270, -560, -774, -997, -1304, -1713,
-    -2184, -2635, -2959, -3052, -2842, -2306, -1465, -393, 786, 1914, 2828, 3376,
-    3455, 3032, 2155, 944, -415, -1696, -2672, -3166, -3094, -2489, -1498, -348,
-    721, 1511, 1904, 1887, 1544, 1024, 508, 174, 136, 413, 929, 1530,
-    2012, 2182, 1910, 1168, 31, -1340, -2726, -3895, -4660, -4909, -4638, -3932,
-    -2942, -1851, -854, -99, 350, 518, 494, 421, 462, 730, 1257, 1990,
-    2805, 3520, 3951, 3957, 3468, 2501, 1162, -374, -1917, -3283, -4316, -4910,
-    -5033, -4725, -4104, -3347, -2645, -2146, -1917, -1922, -2028, -2054, -1847, -1330,
-    -534, 395, 1228, 1741, 1773, 1275, 331, -854, -2006, -2865, -3237, -3042,
-    -2337, -1316, -248, 591, 999, 898, 361, -420, -1183, -1669, -1694, -1213,
-    -315, 791, 1833, 2557, 2804, 2552, 1907, 1073, 290, -241, -422, -273,
-    63, 356, 383, 20, -712, -1656, -2560, -3160, -3268, -2836, -1945, -784,
-    400, 1365, 1947, 2096, 1892, 1525, 1231, 1207, 1546, 2219, 3083, 3914,
-    4467, 4543, 4047, 3017, 1625, 138, -1163, -2058, -2447, -2357, -1923, -1334,
-    -775, -365, -132, -23, 76, 307, 788, 1552, 2522, 3539, 4397, 4885,
-    4841, 4220, 3113, 1726, 333, -793, -1448, -1553, -1157, -406, 492, 1329,
-    1947, 2262, 2294, 2155, 2008, 2000, 2225, 2700, 3358, 4068, 4676, 5043,
-    5066, 4705, 4017, 3152, 2312, 1697, 1446, 1580, 1987, 2481, 2853, 2919,
-    2560, 1776, 691, -482, -1501, -2146, -2271, -1844, -939, 287, 1634, 2894,
-    3886, 4484, 4633, 4377, 3843, 3202, 2622, 2235, 2123, 2290, 2662, 3106,
-    3450, 3533, 3246, 2572, 1603, 506, -530, -1319, -1711, -1620, -1054, -105,
-    1061, 2226, 3157, 3670, 3679, 3205, 2365, 1343, 362, -379, -742, -676,
-    -230, 469, 1250, 1947, 2426, 2611, 2490, 2098, 1502, 802, 120, -427,
-    -750, -787, -532, -48, 544, 1105, 1508, 1667, 1562, 1243, 809, 378,
-    64, -43, 93, 462, 1003, 1614, 2169, 2549, 2664, 2455, 1920, 1123,
-    184, -739, -1483, -1918, -1986, -1722, -1231, -667, -198, 36, -54, -481,
-    -1178, -2004, -2768, -3286, -3426, -3134, -2436, -1445, -328, 720, 1517, 1920,
-    1864, 1379, 585, -341, -1208, -1856, -2196, -2227, -2033, -1751, -1539, -1535,
-    -1813, -2359, -3068, -3785, -4336, -4571, -4405, -3836, -2952, -1919, -942, -212,
-    143, 76, -378, -1101, -1923, -2657, -3136, -3260, -3031, -2550, -2000, -1594,
-    -1513, -1833, -2512, -3414, -4344, -5080, -5430, -5301, -4722, -3834, -2855, -2022,
-    -1500, -1325, -1426, -1660, -1856, -1853, -1567, -1007, -272, 473, 1020, 1175,
-    836, 22, -1123, -2378, -3502, -4287, -4609, -4462, -3954, -3275, -2629, -2180,
-    -1993, -2012, -2089, -2042, -1728, -1092, -191, 821, 1740, 2362, 2547, 2260,
-    1583, 692, -209, -941, -1404, -1607, -1655, -1715, -1939, -2403, -3067, -3784,
-    -4339, -4530, -4224, -3418, -2224, -824, 576, 1779, 2624, 3018, 2948, 2492,
-    1813, 1123, 613, 388, 431, 615, 754, 675, 282, -403, -1252, -2075,
-    -2669, -2867, -2587, -1864, -843, 277, 1278, 1975, 2260, 2134, 1688, 1067,
-    453, 23, -91, 149, 682, 1354, 1952, 2267, 2173, 1663, 849, -72,
-    -870, -1345, -1375, -940, -132, 874, 1855, 2583, 2877, 2664, 1994, 1020,
-    -44, -965, -1538, -1647, -1290, -565, 362, 1285, 1993, 2329, 2227, 1724,
-    943, 75, -647, -1013, -902, -317, 635, 1772, 2866, 3698, 4116, 4051,
-    3513, 2590, 1448, 296, -661, -1253, -1390, -1083, -447, 341, 1072, 1555,
-    1659, 1346, 677, -201, -1082, -1748, -2036, -1860, -1234, -270, 851, 1935,
-    2802, 3312, 3380, 2996, 2223, 1199, 120, -797, -1369, -1492, -1152, -432,
-    499, 1442, 2199, 2611, 2587, 2135, 1366, 461, -372, -953, -1171, -1010,
-    -534, 134, 827, 1365, 1591, 1401, 776, -198, -1347, -2452, -3295, -3701,
-    -3567, -2902, -1813, -483, 872, 2036, 2834, 3173, 3037, 2487, 1653, 709,
-    -158, -796, -1118, -1138, -982, -840, -883, -1218, -1871, -2768, -3753, -4624,
-    -5188, -5299, -4889, -3996, -2753, -1349, 4, 1117, 1845, 2127, 1986, 1536,
-    957, 438, 125, 74, 234, 462, 581, 450, -3, -771, -1751, -2754,
-    -3547, -3933, -3801, -3162, -2147, -976, 116, 932, 1351, 1346, 986, 421,
-    -155, -539, -585, -256, 359, 1076, 1661, 1905, 1695, 1043, 82, -957,
-    -1812, -2278, -2266, -1827, -1129, -408, 117, 331, 228, -99, -483, -726,
-    -671, -263, 448, 1323, 2161, 2747, 2942, 2724, 2184, 1497, 879, 521,
-    512, 815, 1280, 1697, 1860, 1641, 1030, 146, -798, -1564, -1954, -1863,
-    -1308, -432, 520, 1294, 1712, 1723, 1400, 911, 462, 230, 302, 656,
-    1186, 1726, 2097, 2159, 1867, 1290, 585, -50, -435, -463, -125, 486,
-    1200, 1805, 2122, 2050, 1601, 903, 171, -373, -575, -391, 121, 814,
-    1495, 1975, 2120, 1883, 1325, 602, -72, -502, -574, -280, 284, 945,
-    1513, 1824, 1776, 1347, 611, -277, -1111, -1682, -1836, -1522, -816, 110,
-    1037, 1756, 2120, 2074, 1661, 995, 227, -480, -980, -1159, -970, -460,
-    226, 880, 1295, 1320, 903, 104, -933, -2025, -2979, -3623, -3828, -3550,
-    -2841, -1856, -813, 66, 616, 764, 521, -26, -731, -1421, -1918, -2077,
-    -1837, -1246, -452, 342, 933, 1160, 941, 282, -728, -1925, -3083, -3961,
-    -4373, -4237, -3582, -2532, -1271, 5, 1118, 1919, 2296, 2197, 1645, 737,
-    -364, -1474, -2428, -3101, -3412, -3340, -2940, -2334, -1674, -1113, -778, -721,
-    -903, -1224, -1574, -1842, -1924, -1751, -1314, -654, 140, 933, 1565, 1906,
-    1882, 1476, 733, -236, -1271, -2206, -2899, -3254, -3230, -2858, -2238, -1511,
-    -828, -322, -92, -174, -523, -1021, -1516, -1862, -1949, -1713, -1158, -364,
-    522, 1314, 1832, 1946, 1602, 851, -160, -1229, -2157, -2785, -3005, -2797,
-    -2241, -1506, -794, -302, -163, -408, -952, -1624, -2222, -2560, -2516, -2063,
-    -1275, -321, 572, 1177, 1336, 1005, 264, -698, -1637, -2321, -2587, -2377,
-    -1752, -881, 9, 688, 983, 830, 296, -446, -1169, -1668, -1802, -1540,
-    -964, -244, 411, 811, 833, 467, -176, -887, -1430, -1616, -1364, -722,
-    141, 983, 1570, 1742, 1452, 770, -126, -993, -1603, -1809, -1574, -981,
-    -216, 484, 914, 965, 644, 70, -544, -957, -997, -618, 96, 971,
-    1769, 2278, 2369, 2038, 1377, 566, -165, -600, -609, -195, 510, 1277,
-    1858, 2069, 1857, 1300, 572, -109, -537, -564, -140, 672, 1688, 2659,
-    3336, 3544, 3237, 2518, 1592, 704, 76, -133, 114, 732, 1546, 2333,
-    2869, 3002, 2707, 2096, 1359, 707, 311, 271, 592, 1188, 1904, 2549,
-    2950, 2985, 2608, 1876, 949, 46, -620, -889, -688, -59, 849, 1827,
-    2657, 3153, 3203, 2804, 2053, 1126, 243, -392, -640, -462, 81, 841,
-    1617, 2209, 2467, 2310, 1744, 878, -98, -964, -1530, -1673, -1364, -674,
-    243, 1199, 2009, 2518, 2634, 2358, 1785, 1074, 413, -30, -136, 117,
-    653, 1330, 1966, 2363, 2358, 1876, 956, -271, -1603, -2805, -3667, -4048,
-    -3890, -3219, -2151, -877, 372, 1380, 1994, 2157, 1920, 1420, 839, 359,
-    120, 191, 565, 1151, 1789, 2289, 2478, 2242, 1556, 499, -764, -2024,
-    -3063, -3700, -3832, -3453, -2657, -1612, -523, 417, 1060, 1327, 1223, 826,
-    269, -292, -691, -795, -555, -14, 711, 1455, 2026, 2267, 2097, 1525,
-    637, -418, -1453, -2274, -2734, -2750, -2327, -1558, -610, 316, 1021, 1355,
-    1257, 778, 61, -690, -1271, -1517, -1348, -790, 30, 926, 1697, 2170,
-    2227, 1837, 1067, 70, -953, -1784, -2251, -2270, -1867, -1178, -416, 186,
-    451, 297, -230, -971, -1697, -2178, -2242, -1821, -973, 128, 1255, 2170,
-    2665, 2614, 2017, 992, -247, -1434, -2304, -2690, -2568, -2048, -1327, -645,
-    -217, -155, -444, -953, -1475, -1790, -1725, -1213, -326, 742, 1733, 2407,
-    2599, 2256, 1460, 406, -666, -1527, -2011, -2074, -1802, -1369, -976, -792,
-    -900, -1252, -1681, -1972, -1930, -1442, -532, 647, 1858, 2857, 3455, 3563,
-    3209, 2518, 1678, 896, 344, 108, 170, 405, 618, 611, 269, -409,
-    -1316, -2256, -2995, -3335, -3181, -2550, -1568, -446, 581, 1336, 1752, 1873,
-    1837, 1828, 2010, 2467, 3174, 4000, 4751, 5216, 5237, 4747, 3787, 2509,
-    1134, -103, -1014, -1498, -1563, -1328, -991, -765, -802, -1154, -1772, -2510,
-    -3170, -3554, -3530, -3037, -2113, -898, 389, 1511, 2276, 2575, 2408, 1904,
-    1271, 726, 437, 491, 871, 1448, 2026, 2398, 2388, 1900, 950, -331,
-    -1725, -2997, -3937, -4403, -4346, -3819, -2960, -1958, -1011, -314, -10, -146,
-    -649, -1351, -2024, -2431, -2403, -1889, -961, 204, 1366, 2273, 2728, 2633,
-    2003, 951, -346, -1676, -2829, -3636, -3997, -3894, -3379, -2585, -1716, -993,
-    -582, -572, -961, -1649, -2455, -3180, -3639, -3688, -3261, -2396, -1224, 75,
-    1296, 2247, 2795, 2887, 2545, 1845, 920, -60, -916, -1500, -1733, -1628,
-    -1282, -852, -505, -374, -509, -890, -1441, -2033, -2510, -2733, -2607, -2090,
-    -1209, -80, 1121, 2208, 3012, 3410, 3349, 2858, 2031, 1018, 2, -840,
-    -1372, -1514, -1263, -701, 20, 720, 1222, 1393, 1176, 610, -180, -1014,
-    -1691, -2040, -1966, -1461, -605, 434, 1448, 2232, 2632, 2570, 2066, 1250,
-    317, -520, -1076, -1235, -974, -370, 425, 1217, 1808, 2053, 1888, 1354,
-    591, -194, -790, -1040, -876, -323, 499, 1402, 2177, 2643, 2687, 2288,
-    1540, 627, -230, -836, -1068, -898, -406, 244, 848, 1221, 1238, 871,
-    212, -557, -1223, -1602, -1580, -1148, -402, 483, 1284, 1793, 1879, 1529,
-    846, 15, -733, -1195, -1272, -974, -389, 325, 963, 1336, 1336, 970,
-    355, -308, -796, -957, -752, -261, 346, 857, 1089, 944, 435, -317,
-    -1107, -1705, -1925, -1689, -1054, -188, 690, 1363, 1661, 1506, 947, 144,
-    -686, -1314, -1559, -1362, -814, -108, 526, 866, 772, 230, -635, -1614,
-    -2453, -2913, -2857, -2299, -1391, -367, 520, 1078, 1225, 1004, 542, 19,
-    -397, -601, -575, -383, -155, -39, -138, -469, -960, -1482, -1865, -1947,
-    -1635, -935, 44, 1104, 2000, 2500, 2464, 1874, 844, -405, -1592, -2448,
-    -2777, -2494, -1654, -443, 866, 1985, 2679, 2821, 2417, 1598, 572, -425,
-    -1168, -1503, -1398, -941, -299, 319, 721, 791, 528, 25, -565, -1068,
-    -1324, -1234, -776, -29, 852, 1667, 2222, 2378, 2081, 1385, 430, -584,
-    -1433, -1904, -1860, -1292, -318, 840, 1901, 2597, 2753, 2330, 1401, 144,
-    -1196, -2360, -3136, -3378, -3028, -2149, -908, 456, 1686, 2541, 2856, 2577,
-    1783, 658, -543, -1557, -2178, -2299, -1917, -1136, -140, 860, 1659, 2099,
-    2108, 1721, 1060, 298, -372, -778, -817, -476, 189, 1063, 1970, 2703,
-    3083, 3005, 2466, 1572, 504, -508, -1243, -1535, -1317, -640, 353, 1441,
-    2371, 2907, 2907, 2348, 1327, 36, -1275, -2363, -3038, -3200, -2840, -2042,
-    -972, 171, 1186, 1901, 2191, 2017, 1455, 670, -131, -744, -1009, -853,
-    -303, 536, 1502, 2403, 3050, 3296, 3068, 2395, 1411, 327, -624, -1237,
-    -1378, -1023, -267, 701, 1637, 2303, 2543, 2322, 1728, 937, 178, -339,
-    -489, -255, 281, 940, 1482, 1687, 1437, 744, -257, -1336, -2215, -2662,
-    -2547, -1872, -766, 536, 1756, 2651, 3075, 3014, 2584, 1984, 1447, 1166,
-    1239, 1639, 2221, 2764, 3024, 2816, 2086, 933, -432, -1738, -2727, -3216,
-    -3150, -2608, -1773, -893, -188, 220, 330, 253, 171, 264, 634, 1261,
-    2025, 2745, 3224, 3311, 2949, 2206, 1251, 309, -407, -761, -731, -425,
-    -41, 207, 152, -271, -997, -1838, -2554, -2930, -2839, -2280, -1383, -379,
-    491, 1041, 1173, 907, 388, -163, -525, -541, -156, 560, 1419, 2179,
-    2623, 2623, 2179, 1418, 559, -170, -596, -653, -394, 23, 398, 548,
-    375, -120, -843, -1618, -2235, -2509, -2339, -1728, -770, 345, 1377, 2100,
-    2368, 2140, 1498, 636, -196, -774, -943, -650, 35, 929, 1797, 2420,
-    2634, 2360, 1645, 644, -429, -1362, -1983, -2199, -2015, -1532, -918, -367,
-    -50, -64, -408, -988, -1641, -2169, -2391, -2193, -1559, -568, 625, 1799,
-    2724, 3214, 3181, 2629, 1654, 429, -817, -1859, -2523, -2718, -2459, -1871,
-    -1147, -492, -72, 12, -257, -811, -1519, -2212, -2709, -2865, -2610, -1963,
-    -1026, 35, 1025, 1759, 2095, 1951, 1327, 327, -865, -2026, -2949, -3481,
-    -3553, -3184, -2461, -1525, -554, 267, 785, 912, 632, 18, -781, -1576,
-    -2185, -2476, -2375, -1889, -1112, -198, 673, 1332, 1646, 1555, 1072, 284,
-    -660, -1575, -2274, -2630, -2599, -2211, -1562, -795, -70, 471, 718, 609,
-    154, -554, -1360, -2088, -2580, -2732, -2514, -1968, -1190, -306, 539, 1205,
-    1582, 1611, 1309, 767, 126, -458, -842, -930, -706, -240, 337, 871,
-    1212, 1246, 931, 313, -488, -1302, -1944, -2260, -2170, -1680, -888, 37,
-    901, 1530, 1810, 1703, 1260, 613, -61, -583, -811, -677, -219, 437,
-    1117, 1632, 1821, 1609, 1033, 220, -648, -1376, -1798, -1826, -1470, -828,
-    -61, 649, 1144, 1326, 1185, 805, 332, -82, -307, -266, 32, 492,
-    973, 1322, 1406, 1165, 646, -18, -648, -1071, -1156, -861, -240, 568,
-    1379, 2004, 2311, 2262, 1918, 1411, 918, 587, 481, 579, 808, 1050,
-    1173, 1089, 793, 347, -140, -528, -705, -636, -366, 7, 353, 544,
-    497, 207, -258, -770, -1160, -1283, -1067, -531, 221, 1022, 1693, 2088,
-    2122, 1779, 1136, 343, -412, -966, -1215, -1148, -842, -432, -57, 174,
-    212, 71, -174, -414, -536, -467, -205, 190, 606, 911, 989, 796,
-    358, -241, -862, -1334, -1520, -1364, -892, -201, 537, 1134, 1453, 1422,
-    1034, 365, -427, -1152, -1643, -1781, -1531, -956, -196, 583, 1225, 1599,
-    1644, 1374, 874, 278, -248, -562, -592, -350, 79, 567, 968, 1164,
-    1092, 758, 234, -365, -904, -1257, -1326, -1081, -570, 104, 805, 1378,
-    1676, 1612, 1185, 476, -370, -1169, -1757, -2024, -1934, -1520, -884, -170,
-    469, 891, 986, 712, 119, -660, -1445, -2051, -2336, -2235, -1763, -1004,
-    -92, 805, 1521, 1926, 1947, 1596, 966, 218, -472, -960, -1166, -1066,
-    -695, -144, 448, 925, 1142, 1000, 474, -349, -1297, -2170, -2794, -3038,
-    -2846, -2239, -1297, -150, 1034, 2062, 2767, 3044, 2861, 2276, 1429, 507,
-    -308, -859, -1041, -833, -303, 418, 1150, 1698, 1907, 1714, 1143, 296,
-    -667, -1549, -2168, -2396, -2182, -1569, -681, 305, 1203, 1849, 2145, 2082,
-    1730, 1212, 692, 333, 255, 500, 1023, 1693, 2326, 2734, 2769, 2360,
-    1533, 417, -789, -1863, -2598, -2849, -2580, -1875, -909, 85, 877, 1301,
-    1287, 866, 167, -605, -1216, -1467, -1241, -535, 517, 1686, 2710, 3374,
-    3565, 3288, 2662, 1866, 1094, 518, 250, 305, 602, 978, 1223, 1161,
-    717, -65, -1034, -1964, -2628, -2864, -2612, -1916, -936, 91, 927, 1399,
-    1437, 1090, 531, 0, -289, -198, 311, 1155, 2135, 3011, 3558, 3621,
-    3162, 2286, 1199, 135, -699, -1176, -1288, -1137, -893, -739, -820, -1171,
-    -1709, -2277, -2698, -2819, -2568, -1988, -1206, -391, 286, 696, 802, 668,
-    421, 218, 201, 442, 900, 1445, 1906, 2118, 1973, 1454, 641, -306,
-    -1191, -1839, -2146, -2091, -1746, -1264, -827, -583, -621, -939, -1437, -1933,
-    -2236, -2208, -1807, -1092, -217, 624, 1259, 1567, 1506, 1135, 584, 16,
-    -415, -590, -470, -112, 351, 759, 949, 804, 302, -481, -1398, -2266,
-    -2896, -3146, -2959, -2374, -1512, -558, 280, 823, 968, 719, 195, -421,
-    -935, -1199, -1137, -757, -142, 586, 1278, 1776, 1949, 1733, 1153, 321,
-    -586, -1377, -1894, -2040, -1800, -1241, -500, 250, 834, 1114, 1027, 604,
-    -33, -713, -1257, -1528, -1453, -1031, -335, 498, 1304, 1928, 2249, 2196,
-    1779, 1085, 245, -589, -1258, -1634, -1653, -1318, -700, 70, 827, 1410,
-    1703, 1642, 1241, 589, -164, -851, -1321, -1461, -1225, -641, 182, 1077,
-    1861, 2366, 2483, 2173, 1486, 545, -473, -1369, -1969, -2160, -1908, -1259,
-    -337, 675, 1571, 2180, 2395, 2178, 1576, 709, -253, -1123, -1731, -1954,
-    -1752, -1177, -363, 502, 1220, 1627, 1628, 1223, 505, -372, -1234, -1914,
-    -2272, -2233, -1815, -1113, -271, 531, 1120, 1370, 1234, 743, 1, -818,
-    -1517, -1928, -1950, -1574, -882, -26, 813, 1456, 1754, 1621, 1061, 173,
-    -870, -1859, -2597, -2951, -2890, -2477, -1856, -1193, -655, -371, -409, -741,
-    -1262, -1810, -2208, -2301, -2015, -1385, -538, 344, 1058, 1419, 1326, 802,
-    -19, -936, -1725, -2200, -2261, -1921, -1293, -558, 93, 497, 561, 294,
-    -187, -706, -1082, -1183, -967, -491, 100, 627, 928, 894, 501, -170,
-    -960, -1669, -2118, -2194, -1898, -1335, -662, -54, 338, 434, 247, -127,
-    -547, -861, -953, -785, -410, 46, 426, 591, 478, 114, -396, -896,
-    -1209, -1199, -819, -118, 771, 1649, 2306, 2605, 2507, 2061, 1390, 668,
-    68, -299, -393, -259, -9, 211, 287, 169, -112, -452, -699, -713,
-    -412, 208, 1058, 1965, 2728, 3169, 3181, 2751, 1972, 1018, 98, -594,
-    -922, -844, -413, 244, 960, 1551, 1874, 1873, 1583, 1109, 598, 196,
-    -9, 3, 184, 442, 652, 718, 608, 363, 70, -157, -203, 13,
-    502, 1200, 1973, 2655, 3084, 3135, 2744, 1936, 828, -400, -1539, -2377,
-    -2743, -2560, -1861, -772, 506, 1740, 2711, 3265, 3322, 2888, 2063, 1016,
-    -47, -928, -1473, -1615, -1388, -900, -295, 286, 732, 991, 1056, 952,
-    747, 535, 410, 427, 592, 863, 1143, 1309, 1261, 954, 406, -308,
-    -1065, -1716, -2119, -2172, -1829, -1115, -118, 1007, 2067, 2873, 3283, 3221,
-    2685, 1761, 598, -622, -1710, -2489, -2830, -2689, -2114, -1230, -210, 756,
-    1504, 1926, 1962, 1616, 968, 163, -625, -1224, -1509, -1436, -1058, -497,
-    98, 578, 834, 815, 524, 20, -584, -1140, -1505, -1590, -1360, -852,
-    -173, 524, 1080, 1361, 1280, 828, 91, -778, -1609, -2236, -2526, -2421,
-    -1957, -1243, -439, 275, 734, 833, 549, -65, -887, -1737, -2417, -2773,
-    -2732, -2310, -1598, -754, 49, 656, 964, 923, 565, -1, -613, -1116,
-    -1396, -1413, -1210, -897, -612, -471, -530, -776, -1124, -1445, -1603, -1494,
-    -1080, -400, 434, 1262, 1913, 2232, 2125, 1587, 710, -328, -1306, -2008,
-    -2298, -2148, -1634, -905, -147, 459, 785, 799, 556, 184, -157, -332,
-    -289, -69, 231, 498, 632, 573, 330, -22, -357, -536, -454, -86,
-    489, 1120, 1636, 1898, 1835, 1475, 921, 313, -206, -529, -619, -521,
-    -346, -219, -228, -397, -686, -1003, -1228, -1245, -987, -475, 201, 890,
-    1415, 1621, 1439, 915, 183, -576, -1168, -1438, -1323, -853, -139, 648,
-    1311, 1691, 1717, 1406, 853, 211, -345, -685, -758, -595, -305, -36,
-    70, -61, -415, -904, -1398, -1754, -1857, -1653, -1163, -478, 245, 821,
-    1101, 1022, 610, -31, -741, -1346, -1708, -1754, -1472, -918, -213, 473,
-    973, 1174, 1035, 597, -19, -652, -1148, -1398, -1347, -1008, -456, 185,
-    763, 1138, 1220, 994, 509, -121, -747, -1225, -1456, -1397, -1075, -582,
-    -55, 365, 560, 460, 71, -527, -1214, -1847, -2288, -2436, -2247, -1741,
-    -990, -128, 673, 1259, 1523, 1420, 984, 323, -421, -1108, -1608, -1808,
-    -1660, -1199, -522, 235, 905, 1337, 1439, 1193, 643, -109, -920, -1640,
-    -2134, -2301, -2095, -1546, -753, 142, 975, 1599, 1912, 1875, 1510, 897,
-    161, -550, -1091, -1338, -1233, -796, -109, 707, 1505, 2131, 2459, 2427,
-    2036, 1353, 502, -362, -1089, -1557, -1689, -1478, -980, -299, 426, 1044,
-    1435, 1542, 1373, 995, 519, 77, -218, -294, -119, 290, 864, 1481,
-    1997, 2278, 2237, 1862, 1213, 403, -422, -1110, -1536, -1624, -1360, -793,
-    -44, 725, 1357, 1737, 1804, 1556, 1064, 451, -132, -540, -667, -481,
-    -30, 572, 1175, 1621, 1795, 1645, 1189, 511, -250, -920, -1335, -1385,
-    -1051, -413, 362, 1073, 1539, 1653, 1397, 841, 124, -580, -1100, -1312,
-    -1168, -714, -83, 541, 979, 1121, 942, 498, -90, -662, -1061, -1182,
-    -992, -541, 37, 572, 908, 951, 695, 226, -310, -762, -1003, -954,
-    -617, -86, 482, 917, 1077, 886, 378, -301, -961, -1422, -1557, -1334,
-    -822, -166, 452, 861, 949, 706, 210, -398, -950, -1281, -1302, -1024,
-    -547, -19, 402, 599, 553, 336, 80, -83, -55, 190, 611, 1116,
-    1580, 1876, 1908, 1646, 1147, 540, -12, -374, -475, -324, -9, 332,
-    562, 573, 311, -202, -845, -1442, -1824, -1876, -1555, -918, -103, 720,
-    1396, 1791, 1825, 1517, 979, 373, -133, -402, -374, -84, 368, 850,
-    1216, 1350, 1201, 794, 218, -382, -842, -1042, -933, -552, -8, 540,
-    943, 1090, 928, 476, -171, -864, -1446, -1783, -1789, -1450, -831, -53,
-    734, 1371, 1730, 1751, 1453, 926, 308, -241, -580, -631, -393, 74,
-    654, 1202, 1571, 1656, 1423, 903, 178, -624, -1339, -1821, -1967, -1738,
-    -1172, -386, 461, 1202, 1689, 1813, 1539, 925, 100, -769, -1495, -1929,
-    -1997, -1703, -1112, -344, 442, 1080, 1438, 1433, 1062, 420, -324, -992,
-    -1432, -1535, -1259, -642, 215, 1174, 2073, 2764, 3136, 3137, 2777, 2124,
-    1291, 413, -374, -945, -1205, -1116, -711, -92, 598, 1210, 1621, 1756,
-    1604, 1214, 680, 118, -357, -645, -696, -515, -150, 313, 774, 1133,
-    1310, 1258, 978, 528, 11, -452, -753, -810, -595, -136, 490, 1171,
-    1770, 2147, 2209, 1937, 1376, 625, -172, -862, -1314, -1450, -1249, -749,
-    -54, 681, 1289, 1636, 1650, 1338, 777, 104, -525, -965, -1123, -964,
-    -531, 67, 676, 1134, 1317, 1173, 734, 111, -539, -1055, -1307, -1230,
-    -853, -286, 312, 789, 1032, 988, 677, 188, -345, -776, -981, -891,
-    -523, 19, 573, 970, 1082, 858, 330, -393, -1159, -1792, -2140, -2121,
-    -1755, -1155, -493, 48, 331, 305, 20, -400, -801, -1037, -1008, -691,
-    -150, 474, 1012, 1305, 1244, 827, 163, -569, -1184, -1526, -1511, -1163,
-    -601, 16, 526, 781, 697, 297, -306, -953, -1463, -1685, -1561, -1147,
-    -572, 3, 418, 564, 427, 79, -357, -737, -937, -897, -639, -257,
-    103, 282, 181, -209, -809, -1480, -2038, -2311, -2194, -1678, -850, 131,
-    1059, 1740, 2038, 1906, 1392, 625, -219, -963, -1470, -1673, -1593, -1330,
-    -1024, -799, -717, -773, -895, -978, -910, -615, -82, 628, 1383, 2016,
-    2369, 2330, 1856, 990, -135, -1337, -2415, -3172, -3451, -3183, -2399, -1228,
-    125, 1414, 2413, 2976, 3048, 2658, 1918, 993, 60, -725, -1247, -1456,
-    -1371, -1063, -628, -184, 178, 423, 555, 586, 549, 513, 533, 625,
-    774, 946, 1071, 1066, 880, 509, -5, -570, -1059, -1355, -1382, -1103,
-    -524, 282, 1188, 2036, 2666, 2933, 2752, 2124, 1133, -64, -1262, -2244,
-    -2833, -2913, -2457, -1546, -347, 931, 2089, 2964, 3452, 3509, 3146, 2431,
-    1488, 475, -436, -1095, -1405, -1347, -967, -350, 388, 1117, 1722, 2124,
-    2285, 2208, 1951, 1608, 1271, 1002, 829, 750, 736, 740, 708, 598,
-    387, 93, -231, -498, -609, -491, -119, 481, 1236, 2034, 2735, 3204,
-    3327, 3035, 2326, 1285, 64, -1152, -2169, -2819, -2995, -2669, -1894, -787,
-    482, 1711, 2702, 3301, 3422, 3070, 2325, 1326, 243, -756, -1541, -2036,
-    -2203, -2052, -1655, -1124, -568, -74, 306, 560, 712, 792, 817, 801,
-    750, 656, 498, 255, -92, -546, -1065, -1562, -1930, -2075, -1944, -1543,
-    -949, -283, 321, 728, 816, 523, -126, -1037, -2060, -3002, -3672, -3944,
-    -3775, -3196, -2306, -1267, -263, 549, 1065, 1242, 1118, 791, 381, -10,
-    -317, -520, -654, -787, -987, -1287, -1670, -2068, -2379, -2498, -2350, -1926,
-    -1289, -566, 77, 470, 505, 173, -437, -1170, -1843, -2285, -2387, -2128,
-    -1563, -812, -47, 551, 851, 802, 445, -108, -700, -1191, -1494, -1585,
-    -1501, -1344, -1246, -1315, -1594, -2043, -2532, -2878, -2909, -2532, -1751, -665,
-    556, 1705, 2581, 3038, 3005, 2507, 1663, 663, -294, -1061, -1574, -1845,
-    -1951, -1995, -2064, -2196, -2373, -2538, -2603, -2478, -2110, -1509, -753, 32,
-    697, 1104, 1169, 891, 355, -283, -842, -1151, -1099, -662, 91, 1015,
-    1912, 2579, 2851, 2643, 1973, 965, -189, -1283, -2149, -2674, -2821, -2628,
-    -2196, -1654, -1140, -767, -594, -602, -712, -815, -807, -617, -234, 301,
-    909, 1481, 1901, 2083, 1993, 1658, 1161, 629, 190, -58, -61, 181,
-    603, 1092, 1516, 1742, 1658, 1216, 455, -516, -1539, -2433, -3033, -3228,
-    -2969, -2275, -1237, -17, 1200, 2234, 2933, 3198, 3024, 2485, 1714, 875,
-    136, -368, -558, -417, 4, 591, 1204, 1705, 1983, 1970, 1660, 1111,
-    424, -267, -831, -1165, -1215, -989, -546, 15, 579, 1043, 1324, 1381,
-    1220, 907, 548, 272, 186, 339, 711, 1229, 1779, 2224, 2438, 2335,
-    1878, 1105, 136, -860, -1707, -2247, -2376, -2067, -1386, -457, 554, 1448,
-    2037, 2207, 1942, 1325, 510, -312, -959, -1304, -1291, -942, -361, 294,
-    851, 1166, 1158, 832, 277, -365, -932, -1280, -1323, -1052, -541, 72,
-    617, 937, 940, 621, 54, -624, -1248, -1652, -1721, -1428, -838, -92,
-    624, 1118, 1258, 1007, 420, -376, -1198, -1840, -2146, -2042, -1553, -801,
-    32, 747, 1189, 1270, 996, 460, -185, -765, -1120, -1155, -880, -401,
-    126, 544, 727, 622, 272, -208, -673, -970, -979, -662, -95, 571,
-    1142, 1453, 1424, 1080, 533, -57, -529, -761, -704, -392, 67, 521,
-    816, 848, 597, 134, -392, -817, -1012, -916, -543, 8, 577, 995,
-    1133, 935, 449, -176, -747, -1085, -1073, -682, 2, 808, 1534, 1996,
-    2060, 1691, 978, 100, -727, -1309, -1523, -1350, -869, -225, 409, 869,
-    1049, 934, 598, 182, -152, -275, -140, 214, 675, 1099, 1358, 1366,
-    1095, 597, -13, -583, -970, -1067, -835, -328, 331, 995, 1516, 1764,
-    1669, 1257, 629, -68, -660, -998, -1011, -715, -194, 417, 953, 1265,
-    1265, 942, 359, -346, -998, -1437, -1565, -1346, -825, -114, 622, 1213,
-    1514, 1448, 1027, 347, -436, -1150, -1649, -1838, -1684, -1213, -524, 231,
-    885, 1297, 1378, 1112, 568, -131, -844, -1428, -1751, -1727, -1349, -685,
-    142, 967, 1622, 1979, 1983, 1644, 1031, 272, -470, -1047, -1348, -1320,
-    -985, -434, 209, 825, 1299, 1545, 1518, 1232, 744, 155, -409, -826,
-    -1008, -915, -560, -15, 599, 1155, 1546, 1705, 1617, 1326, 914, 478,
-    121, -57, 7, 318, 817, 1405, 1947, 2310, 2386, 2136, 1583, 800,
-    -93, -941, -1584, -1906, -1844, -1402, -648, 294, 1276, 2139, 2739, 2973,
-    2814, 2302, 1547, 703, -63, -606, -827, -681, -207, 477, 1217, 1855,
-    2255, 2329, 2075, 1557, 885, 204, -323, -568, -480, -89, 502, 1133,
-    1629, 1861, 1765, 1332, 627, -217, -1023, -1618, -1871, -1731, -1243, -528,
-    246, 896, 1267, 1272, 902, 242, -551, -1273, -1743, -1844, -1549, -918,
-    -81, 801, 1564, 2056, 2187, 1951, 1430, 768, 129, -337, -546, -494,
-    -250, 57, 278, 280, -8, -579, -1337, -2108, -2701, -2966, -2816, -2256,
-    -1394, -415, 479, 1111, 1363, 1214, 766, 200, -297, -571, -542, -228,
-    267, 785, 1159, 1259, 1039, 541, -124, -811, -1381, -1747, -1902, -1894,
-    -1818, -1784, -1880, -2134, -2501, -2873, -3105, -3052, -2626, -1835, -793, 312,
-    1271, 1902, 2094, 1840, 1244, 485, -240, -764, -991, -923, -661, -347,
-    -120, -92, -318, -753, -1274, -1728, -1989, -1978, -1706, -1281, -870, -627,
-    -656, -985, -1548, -2200, -2755, -3036, -2916, -2356, -1421, -272, 875, 1813,
-    2396, 2561, 2328, 1797, 1118, 447, -88, -418, -541, -529, -491, -536,
-    -737, -1110, -1612, -2142, -2575, -2783, -2674, -2224, -1487, -590, 298, 999,
-    1378, 1382, 1039, 455, -205, -752, -1026, -935, -482, 238, 1053, 1762,
-    2188, 2224, 1845, 1103, 122, -923, -1837, -2454, -2674, -2467, -1880, -1036,
-    -99, 763, 1410, 1753, 1766, 1491, 1028, 511, 78, -159, -151, 88,
-    481, 913, 1253, 1391, 1265, 873, 284, -382, -985, -1391, -1500, -1270,
-    -745, -35, 713, 1341, 1707, 1717, 1358, 690, -170, -1062, -1803, -2231,
-    -2246, -1822, -1011, 65, 1235, 2305, 3101, 3494, 3421, 2903, 2045, 1009,
-    -25, -884, -1430, -1581, -1325, -725, 91, 955, 1687, 2137, 2222, 1949,
-    1403, 713, 22, -532, -847, -872, -621, -164, 383, 880, 1210, 1308,
-    1169, 835, 399, -13, -275, -296, -39, 471, 1143, 1828, 2361, 2607,
-    2500, 2039, 1291, 390, -494, -1196, -1577, -1549, -1098, -308, 658, 1604,
-    2328, 2665, 2540, 1989, 1131, 138, -789, -1461, -1757, -1632, -1124, -353,
-    497, 1233, 1707, 1846, 1661, 1247, 740, 284, -6, -67, 95, 404,
-    735, 944, 926, 646, 147, -458, -1005, -1322, -1288, -861, -91, 890,
-    1877, 2645, 3009, 2878, 2272, 1318, 219, -798, -1531, -1855, -1743, -1264,
-    -562, 172, 757, 1075, 1094, 863, 499, 161, -9, 54, 329, 720,
-    1076, 1242, 1127, 727, 117, -570, -1160, -1493, -1474, -1097, -450, 306,
-    980, 1403, 1478, 1205, 677, 53, -508, -875, -974, -808, -462, -76,
-    206, 286, 145, -150, -482, -728, -796, -646, -310, 117, 500, 701,
-    615, 207, -462, -1240, -1924, -2318, -2296, -1841, -1048, -93, 812, 1472,
-    1751, 1602, 1083, 338, -450, -1115, -1531, -1645, -1490, -1166, -804, -523,
-    -403, -462, -652, -869, -1000, -963, -734, -352, 94, 475, 665, 573,
-    179, -472, -1268, -2038, -2596, -2805, -2604, -2012, -1129, -121, 812, 1485,
-    1761, 1584, 993, 114, -863, -1727, -2311, -2538, -2412, -2001, -1423, -825,
-    -340, -58, -16, -189, -498, -828, -1071, -1149, -1033, -747, -367, 11,
-    290, 389, 259, -98, -626, -1225, -1775, -2158, -2286, -2113, -1656, -995,
-    -251, 449, 972, 1206, 1092, 646, -51, -873, -1660, -2254, -2537, -2453,
-    -2023, -1338, -533, 240, 832, 1116, 1038, 627, -22, -775, -1483, -2007,
-    -2253, -2176, -1787, -1155, -404, 329, 916, 1260, 1321, 1124, 742, 274,
-    -181, -545, -772, -847, -785, -636, -485, -406, -443, -607, -879, -1204,
-    -1495, -1654, -1603, -1296, -736, 29, 910, 1778, 2496, 2951, 3071, 2824,
-    2231, 1380, 410, -518, -1253, -1667, -1697, -1365, -767, -54, 608, 1074,
-    1245, 1088, 654, 64, -528, -984, -1197, -1113, -734, -130, 591, 1302,
-    1873, 2206, 2258, 2043, 1630, 1128, 668, 358, 250, 339, 576, 866,
-    1089, 1143, 963, 542, -63, -740, -1350, -1754, -1850, -1602, -1049, -299,
-    499, 1184, 1625, 1761, 1609, 1257, 843, 514, 393, 536, 910, 1427,
-    1971, 2420, 2670, 2672, 2443, 2063, 1636, 1269, 1043, 983, 1049, 1154,
-    1194, 1081, 764, 254, -372, -994, -1467, -1653, -1474, -936, -129, 793,
-    1646, 2258, 2516, 2397, 1963, 1346, 711, 219, -17, 39, 341, 774,
-    1198, 1476, 1529, 1347, 1001, 598, 263, 82, 77, 191, 335, 420,
-    368, 139, -236, -662, -1010, -1160, -1023, -576, 122, 946, 1736, 2333,
-    2619, 2551, 2168, 1562, 861, 209, -277, -547, -612, -530, -394, -289,
-    -276, -374, -557, -756, -875, -845, -636, -257, 223, 680, 980, 1037,
-    817, 342, -292, -928, -1410, -1623, -1515, -1105, -490, 174, 714, 995,
-    953, 593, -8, -716, -1367, -1821, -1989, -1849, -1450, -909, -370, 48,
-    264, 242, 7, -359, -751, -1078, -1254, -1224, -996, -648, -285, -19,
-    62, -86, -441, -927, -1441, -1858, -2064, -1994, -1642, -1064, -375, 270,
-    729, 902, 744, 277, -416, -1209, -1961, -2530, -2799, -2715, -2297, -1629,
-    -850, -129, 389, 612, 509, 107, -507, -1204, -1836, -2266, -2400, -2223,
-    -1786, -1191, -571, -62, 234, 273, 68, -323, -792, -1210, -1456, -1454,
-    -1201, -770, -276, 169, 456, 498, 260, -222, -859, -1531, -2091, -2402,
-    -2376, -2005, -1353, -541, 268, 915, 1274, 1274, 908, 244, -590, -1438,
-    -2141, -2572, -2662, -2408, -1870, -1159, -420, 199, 581, 659, 431, -33,
-    -611, -1157, -1541, -1671, -1515, -1107, -538, 63, 550, 796, 730, 362,
-    -211, -836, -1354, -1635, -1612, -1284, -726, -72, 517, 897, 972, 716,
-    196, -445, -1040, -1441, -1547, -1318, -792, -90, 624, 1178, 1436, 1334,
-    906, 277, -382, -905, -1170, -1122, -789, -265, 308, 770, 985, 894,
-    534, 15, -507, -869, -953, -715, -199, 479, 1161, 1676, 1888, 1742,
-    1279, 629, -25, -505, -684, -519, -63, 554, 1167, 1622, 1806, 1688,
-    1324, 845, 402, 127, 84, 262, 578, 910, 1130, 1146, 930, 529,
-    48, -368, -575, -483, -87, 535, 1240, 1856, 2224, 2255, 1940, 1357,
-    651, 6, -422, -545, -354, 84, 639, 1155, 1500, 1598, 1437, 1082,
-    660, 318, 175, 280, 601, 1033, 1440, 1697, 1717, 1475, 1023, 480,
-    -3, -286, -280, 18, 521, 1099, 1608, 1916, 1949, 1706, 1250, 686,
-    157, -188, -253, -31, 403, 921, 1373, 1636, 1653, 1427, 1009, 494,
-    9, -319, -396, -190, 242, 777, 1262, 1568, 1616, 1396, 965, 426,
-    -101, -494, -654, -529, -140, 420, 1008, 1476, 1718, 1680, 1358, 810,
-    151, -475, -943, -1155, -1066, -704, -166, 429, 967, 1347, 1503, 1417,
-    1126, 710, 278, -51, -188, -107, 164, 549, 939, 1217, 1284, 1089,
-    634, -24, -787, -1519, -2085, -2376, -2334, -1957, -1303, -491, 318, 971,
-    1363, 1448, 1246, 837, 333, -138, -459, -551, -392, -19, 490, 1032,
-    1497, 1788, 1832, 1601, 1118, 455, -281, -958, -1457, -1695, -1656, -1373,
-    -912, -374, 125, 478, 619, 531, 253, -130, -514, -798, -905, -787,
-    -441, 93, 732, 1360, 1857, 2134, 2144, 1885, 1403, 782, 131, -441,
-    -838, -990, -880, -549, -97, 347, 660, 754, 585, 170, -406, -1014,
-    -1526, -1830, -1848, -1560, -1023, -342, 352, 924, 1264, 1319, 1100, 674,
-    145, -360, -725, -871, -768, -429, 72, 614, 1063, 1308, 1284, 983,
-    463, -162, -751, -1173, -1345, -1241, -901, -422, 67, 449, 640, 609,
-    385, 46, -306, -562, -635, -484, -132, 336, 807, 1161, 1298, 1170,
-    799, 267, -307, -792, -1073, -1090, -853, -448, -6, 325, 439, 293,
-    -89, -614, -1138, -1501, -1587, -1354, -841, -162, 519, 1037, 1279, 1205,
-    866, 370, -141, -540, -746, -751, -622, -469, -412, -532, -844, -1280,
-    -1724, -2046, -2137, -1947, -1507, -920, -313, 194, 509, 605, 525, 358,
-    191, 94, 109, 218, 334, 348, 177, -205, -757, -1368, -1891, -2196,
-    -2203, -1906, -1374, -744, -172, 208, 317, 152, -212, -639, -971, -1087,
-    -936, -548, -21, 506, 876, 966, 726, 200, -490, -1178, -1690, -1895,
-    -1745, -1282, -630, 30, 515, 696, 538, 89, -534, -1167, -1652, -1877,
-    -1797, -1441, -910, -355, 72, 262, 170, -162, -623, -1065, -1353, -1395,
-    -1163, -699, -98, 509, 981, 1202, 1118, 741, 139, -570, -1238, -1717,
-    -1903, -1752, -1293, -636, 63, 641, 972, 982, 668, 104, -576, -1216,
-    -1667, -1818, -1620, -1103, -366, 440, 1136, 1570, 1639, 1321, 679, -160,
-    -1026, -1739, -2157, -2213, -1922, -1365, -674, -29, 392, 467, 153, -508,
-    -1383, -2276, -2994, -3382, -3341, -2842, -1947, -782, 500, 1730, 2741, 3414,
-    3699, 3615, 3244, 2721, 2196, 1802, 1639, 1768, 2169, 2738, 3337, 3815,
-    4027, 3862, 3281, 2312, 1032, -436, -1937, -3317, -4457, -5282, -5755, -5883,
-    -5701, -5265, -4631, -3853, -2969, -2002, -961, 161, 1372, 2655, 3948, 5152,
-    6146, 6810, 7037, 6759, 5970, 4734, 3170, 1438, -280, -1818, -3046, -3890,
-    -4341, -4461, -4358, -4140, -3884, -3630, -3368, -3038, -2557, -1859, -905, 303,
-    1699, 3155, 4515, 5627, 6349, 6587, 6313, 5571, 4456, 3111, 1713, 437,
-    -586, -1294, -1695, -1862, -1898, -1897, -1925, -2018, -2173, -2343, -2448, -2393,
-    -2103, -1545, -741, 232, 1247, 2168, 2877, 3300, 3419, 3280, 2989, 2673,
-    2443, 2357, 2402, 2486, 2480, 2265, 1775, 1016, 67, -937, -1836, -2481,
-    -2768, -2676, -2275, -1696, -1090, -603, -333, -295, -417, -577, -640, -493,
-    -88, 534, 1260, 1933, 2397, 2537, 2323, 1813, 1132, 442, -101, -388,
-    -395, -183, 117, 351, 406, 240, -96, -484, -764, -799, -508, 99,
-    921, 1791, 2523, 2957, 2998, 2643, 1998, 1256, 624, 275, 301, 683,
-    1277, 1883, 2304, 2389, 2073, 1402, 524, -366, -1065, -1413, -1340, -895,
-    -231, 442, 921, 1068, 855, 368, -229, -742, -1005, -921, -493, 182,
-    949, 1628, 2066, 2180, 1970, 1512, 940, 407, 42, -96, -21, 194,
-    438, 586, 536, 236, -291, -958, -1632, -2171, -2453, -2407, -2035, -1411,
-    -657, 88, 708, 1122, 1303, 1283, 1140, 981, 908, 998, 1289, 1769,
-    2374, 2991, 3488, 3745, 3688, 3301, 2632, 1770, 822, -101, -899, -1487,
-    -1808, -1851, -1663, -1345, -1027, -829, -828, -1036, -1406, -1836, -2198, -2363,
-    -2238, -1777, -1006, -23, 1014, 1926, 2555, 2787, 2582, 1981, 1102, 112,
-    -802, -1480, -1828, -1830, -1539, -1065, -556, -159, 27, -36, -339, -821,
-    -1374, -1876, -2221, -2332, -2165, -1720, -1053, -262, 528, 1189, 1624, 1776,
-    1627, 1202, 573, -158, -889, -1512, -1928, -2083, -1980, -1665, -1200, -669,
-    -177, 183, 348, 290, 22, -395, -854, -1235, -1441, -1421, -1170, -742,
-    -239, 209, 490, 528, 296, -172, -777, -1385, -1867, -2118, -2081, -1769,
-    -1260, -667, -117, 271, 410, 283, -67, -554, -1059, -1444, -1615, -1539,
-    -1244, -804, -333, 53, 264, 251, 18, -364, -785, -1127, -1294, -1236,
-    -964, -554, -123, 215, 368, 293, 8, -423, -893, -1283, -1491, -1475,
-    -1259, -915, -554, -292, -212, -342, -647, -1030, -1360, -1520, -1441, -1112,
-    -593, -5, 502, 806, 832, 570, 83, -501, -1031, -1377, -1462, -1284,
-    -919, -495, -153, -16, -145, -519, -1037, -1551, -1903, -1968, -1699, -1143,
-    -421, 304, 865, 1137, 1072, 709, 160, -423, -882, -1102, -1045, -764,
-    -372, -12, 190, 160, -93, -482, -880, -1161, -1231, -1058, -703, -281,
-    82, 281, 254, 7, -370, -750, -1001, -1019, -763, -296, 236, 664,
-    851, 714, 269, -366, -1027, -1544, -1783, -1682, -1277, -686, -59, 450,
-    731, 744, 529, 185, -160, -383, -406, -226, 97, 457, 723, 780,
-    581, 147, -439, -1050, -1540, -1784, -1710, -1316, -681, 54, 726, 1186,
-    1333, 1137, 658, 18, -633, -1143, -1383, -1291, -888, -268, 428, 1039,
-    1421, 1487, 1239, 755, 169, -368, -718, -804, -620, -231, 260, 723,
-    1025, 1070, 839, 385, -193, -763, -1185, -1345, -1197, -759, -103, 656,
-    1371, 1899, 2135, 2033, 1613, 959, 206, -490, -985, -1177, -1031, -585,
-    59, 757, 1358, 1735, 1815, 1588, 1112, 495, -121, -597, -822, -742,
-    -366, 227, 910, 1537, 1978, 2144, 2003, 1587, 982, 301, -326, -772,
-    -943, -808, -398, 205, 872, 1461, 1864, 2026, 1937, 1625, 1157, 638,
-    183, -107, -170, -3, 349, 804, 1260, 1610, 1767, 1678, 1332, 768,
-    88, -574, -1082, -1324, -1241, -845, -218, 520, 1231, 1770, 2025, 1958,
-    1601, 1039, 404, -159, -539, -680, -579, -290, 83, 421, 622, 623,
-    411, 38, -403, -803, -1062, -1108, -922, -540, -50, 435, 791, 930,
-    823, 499, 36, -447, -819, -976, -868, -503, 41, 637, 1144, 1442,
-    1465, 1214, 759, 223, -266, -594, -696, -571, -279, 80, 394, 573,
-    572, 404, 134, -147, -343, -378, -226, 89, 489, 858, 1077, 1072,
-    835, 419, -85, -562, -908, -1051, -972, -716, -367, -35, 174, 189,
-    0, -340, -736, -1068, -1223, -1134, -805, -298, 281, 806, 1161, 1283,
-    1173, 884, 513, 177, -23, -39, 111, 352, 572, 661, 546, 217,
-    -279, -841, -1340, -1656, -1714, -1502, -1081, -565, -86, 248, 385, 339,
-    187, 23, -69, -23, 186, 523, 905, 1234, 1423, 1425, 1251, 962,
-    644, 381, 247, 283, 475, 764, 1062, 1274, 1314, 1144, 783, 290,
-    -252, -743, -1095, -1255, -1212, -1004, -718, -456, -296, -292, -460, -772,
-    -1149, -1490, -1693, -1668, -1368, -823, -123, 608, 1241, 1664, 1818, 1698,
-    1353, 875, 389, 14, -174, -155, 37, 321, 599, 784, 815, 662,
-    330, -126, -611, -1015, -1244, -1244, -1014, -595, -63, 488, 963, 1271,
-    1348, 1178, 813, 345, -116, -465, -632, -596, -378, -30, 368, 706,
-    886, 844, 570, 105, -459, -1001, -1413, -1615, -1561, -1245, -715, -60,
-    611, 1187, 1568, 1697, 1569, 1227, 746, 227, -214, -487, -543, -381,
-    -51, 348, 697, 889, 860, 585, 96, -517, -1126, -1598, -1824, -1736,
-    -1334, -684, 100, 877, 1504, 1872, 1932, 1698, 1229, 630, 30, -455,
-    -744, -796, -617, -273, 128, 470, 653, 613, 342, -112, -662, -1192,
-    -1582, -1747, -1654, -1307, -757, -103, 522, 998, 1234, 1173, 828, 284,
-    -334, -904, -1313, -1473, -1355, -996, -485, 61, 499, 703, 604, 215,
-    -387, -1077, -1714, -2159, -2318, -2157, -1712, -1084, -420, 123, 423, 423,
-    143, -329, -860, -1300, -1528, -1478, -1157, -645, -77, 403, 682, 709,
-    499, 134, -262, -556, -641, -466, -67, 440, 901, 1173, 1158, 837,
-    278, -388, -1003, -1418, -1530, -1311, -824, -207, 367, 737, 804, 557,
-    69, -524, -1059, -1395, -1444, -1197, -737, -218, 184, 329, 157, -292,
-    -886, -1449, -1814, -1860, -1543, -927, -160, 567, 1074, 1236, 1025, 521,
-    -115, -693, -1047, -1079, -789, -281, 286, 731, 914, 777, 366, -191,
-    -729, -1089, -1171, -955, -513, 20, 480, 730, 697, 405, -38, -476,
-    -755, -781, -535, -71, 493, 999, 1310, 1348, 1111, 672, 167, -247,
-    -447, -381, -74, 390, 883, 1260, 1401, 1250, 831, 243, -366, -842,
-    -1066, -989, -643, -126, 423, 859, 1068, 996, 665, 165, -364, -772,
-    -940, -813, -411, 185, 850, 1453, 1875, 2029, 1882, 1481, 934, 372,
-    -83, -332, -323, -80, 316, 767, 1167, 1413, 1430, 1209, 799, 283,
-    -226, -600, -744, -624, -262, 272, 862, 1376, 1697, 1751, 1528, 1077,
-    502, -68, -508, -716, -651, -330, 185, 791, 1353, 1735, 1846, 1659,
-    1209, 590, -60, -596, -906, -930, -664, -165, 467, 1113, 1652, 1969,
-    1997, 1729, 1224, 590, -38, -531, -804, -820, -590, -174, 332, 826,
-    1211, 1405, 1370, 1130, 757, 344, -15, -234, -261, -89, 243, 662,
-    1064, 1340, 1410, 1241, 853, 311, -284, -819, -1196, -1349, -1253, -931,
-    -456, 60, 503, 786, 862, 721, 408, 7, -377, -643, -718, -574,
-    -239, 208, 661, 1014, 1179, 1111, 814, 345, -200, -701, -1051, -1180,
-    -1070, -758, -317, 159, 568, 824, 882, 739, 437, 57, -295, -521,
-    -563, -412, -99, 306, 702, 988, 1086, 955, 603, 100, -435, -879,
-    -1130, -1126, -868, -426, 77, 511, 770, 793, 573, 160, -338, -789,
-    -1072, -1113, -896, -472, 52, 552, 927, 1120, 1124, 986, 789, 616,
-    535, 587, 765, 1003, 1197, 1238, 1058, 654, 91, -519, -1053, -1398,
-    -1477, -1280, -867, -342, 170, 544, 693, 603, 331, -12, -298, -416,
-    -306, 27, 512, 1018, 1397, 1541, 1412, 1036, 496, -75, -533, -776,
-    -768, -537, -168, 208, 469, 533, 388, 83, -282, -593, -755, -718,
-    -480, -98, 323, 672, 868, 869, 692, 404, 104, -108, -165, -53,
-    192, 489, 739, 856, 808, 612, 333, 51, -156, -238, -169, 34,
-    314, 573, 711, 653, 380, -63, -573, -1032, -1341, -1436, -1294, -935,
-    -431, 113, 582, 874, 934, 769, 444, 57, -285, -488, -500, -315,
-    27, 447, 845, 1116, 1192, 1057, 742, 317, -122, -476, -667, -656,
-    -444, -88, 320, 681, 915, 974, 841, 549, 180, -171, -419, -496,
-    -370, -68, 339, 768, 1132, 1343, 1332, 1080, 616, 12, -623, -1162,
-    -1507, -1608, -1451, -1069, -546, 5, 463, 725, 726, 469, 30, -483,
-    -964, -1323, -1484, -1408, -1108, -645, -115, 370, 707, 829, 724, 429,
-    6, -468, -909, -1237, -1386, -1323, -1057, -643, -161, 306, 684, 899,
-    903, 691, 306, -173, -637, -981, -1129, -1059, -796, -412, -2, 340,
-    538, 537, 324, -57, -521, -974, -1322, -1485, -1426, -1170, -789, -378,
-    -41, 138, 121, -81, -425, -838, -1225, -1492, -1567, -1416, -1064, -588,
-    -95, 307, 527, 521, 290, -120, -625, -1106, -1437, -1531, -1359, -966,
-    -450, 57, 446, 644, 613, 354, -78, -589, -1070, -1409, -1520, -1377,
-    -1031, -579, -135, 194, 331, 260, 22, -305, -622, -830, -855, -678,
-    -335, 97, 517, 814, 897, 731, 351, -154, -660, -1027, -1156, -1020,
-    -671, -207, 238, 526, 565, 348, -54, -519, -901, -1073, -979, -639,
-    -140, 402, 858, 1126, 1169, 1013, 738, 445, 227, 137, 167, 253,
-    306, 253, 59, -265, -668, -1056, -1324, -1384, -1203, -810, -299, 198,
-    556, 692, 589, 300, -62, -369, -515, -437, -135, 319, 798, 1163,
-    1297, 1142, 731, 182, -357, -750, -896, -764, -420, 5, 372, 561,
-    502, 198, -261, -747, -1131, -1301, -1199, -846, -337, 197, 623, 834,
-    786, 524, 156, -182, -369, -340, -99, 283, 696, 1010, 1127, 1001,
-    654, 163, -353, -766, -971, -917, -616, -140, 392, 844, 1105, 1110,
-    860, 423, -86, -548, -855, -933, -759, -371, 147, 677, 1093, 1294,
-    1231, 922, 448, -74, -522, -795, -830, -618, -220, 245, 640, 857,
-    834, 572, 136, -363, -806, -1091, -1143, -928, -471, 145, 792, 1336,
-    1663, 1705, 1453, 965, 342, -284, -785, -1052, -1023, -703, -174, 432,
-    971, 1324, 1406, 1188, 701, 39, -673, -1296, -1709, -1836, -1652, -1193,
-    -547, 159, 794, 1250, 1455, 1391, 1097, 661, 180, -252, -551, -658,
-    -556, -269, 141, 570, 901, 1046, 970, 685, 242, -272, -750, -1093,
-    -1224, -1110, -777, -294, 244, 727, 1045, 1132, 973, 592, 55, -518,
-    -979, -1213, -1161, -834, -305, 306, 862, 1248, 1379, 1210, 756, 97,
-    -642, -1319, -1807, -2021, -1928, -1563, -1015, -405, 138, 496, 592, 424,
-    55, -410, -847, -1135, -1196, -1011, -621, -114, 390, 765, 924, 842,
-    547, 120, -333, -701, -896, -875, -651, -299, 77, 369, 483, 371,
-    48, -415, -921, -1357, -1610, -1604, -1336, -860, -273, 298, 723, 922,
-    871, 604, 199, -222, -531, -637, -512, -194, 217, 589, 803, 791,
-    548, 126, -376, -837, -1137, -1201, -1019, -651, -214, 157, 351, 312,
-    49, -368, -816, -1161, -1305, -1211, -900, -458, -10, 324, 482, 455,
-    286, 59, -125, -200, -148, 1, 176, 281, 250, 72, -211, -531,
-    -794, -914, -857, -639, -322, 3, 235, 299, 169, -124, -494, -809,
-    -951, -860, -550, -99, 375, 739, 904, 852, 627, 321, 43, -122,
-    -127, 25, 284, 549, 702, 653, 377, -86, -635, -1132, -1443, -1482,
-    -1230, -740, -114, 513, 1005, 1265, 1250, 986, 555, 77, -321, -547,
-    -556, -341, 51, 521, 947, 1224, 1289, 1130, 795, 375, -25, -312,
-    -415, -320, -66, 267, 588, 804, 847, 697, 388, -3, -376, -633,
-    -705, -570, -238, 237, 757, 1207, 1491, 1546, 1345, 918, 350, -241,
-    -743, -1065, -1149, -975, -562, 22, 671, 1251, 1643, 1757, 1568, 1125,
-    541, -61, -574, -913, -1028, -915, -611, -186, 268, 653, 893, 944,
-    807, 524, 162, -204, -499, -648, -602, -363, 17, 453, 854, 1135,
-    1239, 1138, 844, 404, -89, -532, -830, -915, -758, -384, 127, 670,
-    1136, 1427, 1468, 1237, 768, 143, -521, -1094, -1468, -1576, -1399, -967,
-    -354, 323, 941, 1385, 1568, 1447, 1054, 487, -134, -691, -1079, -1229,
-    -1127, -808, -349, 153, 586, 850, 882, 670, 263, -237, -697, -997,
-    -1063, -878, -492, 0, 474, 812, 932, 819, 514, 95, -337, -677,
-    -838, -785, -530, -127, 341, 759, 1013, 1027, 779, 299, -327, -972,
-    -1494, -1781, -1774, -1473, -941, -297, 317, 776, 1003, 969, 706, 302,
-    -126, -468, -648, -633, -449, -181, 64, 196, 156, -63, -406, -770,
-    -1041, -1133, -1005, -685, -257, 172, 499, 644, 574, 328, 1, -287,
-    -434, -373, -104, 314, 774, 1149, 1320, 1223, 876, 370, -174, -623,
-    -871, -871, -653, -310, 33, 263, 310, 155, -165, -552, -873, -1006,
-    -895, -559, -88, 377, 699, 785, 603, 187, -362, -896, -1274, -1399,
-    -1241, -856, -363, 98, 416, 521, 407, 138, -185, -453, -570, -476,
-    -192, 183, 521, 709, 682, 441, 70, -302, -552, -593, -393, 10,
-    508, 966, 1265, 1324, 1133, 751, 285, -149, -451, -546, -419, -114,
-    276, 635, 849, 846, 628, 269, -125, -443, -585, -496, -196, 234,
-    691, 1064, 1255, 1209, 944, 528, 55, -373, -652, -709, -522, -128,
-    391, 915, 1325, 1532, 1500, 1240, 814, 314, -163, -517, -668, -593,
-    -337, 14, 363, 614, 691, 574, 293, -88, -488, -810, -976, -948,
-    -720, -334, 126, 555, 864, 987, 885, 574, 125, -374, -835, -1170,
-    -1312, -1242, -983, -585, -126, 298, 601, 724, 648, 402, 57, -297,
-    -579, -723, -682, -455, -92, 319, 681, 908, 937, 740, 327, -255,
-    -918, -1556, -2056, -2322, -2300, -2014, -1540, -975, -422, 14, 256, 273,
-    88, -233, -574, -793, -762, -412, 263, 1209, 2313, 3430, 4408, 5107,
-    5415, 5280, 4725, 3841, 2760, 1615, 518, -460, -1284, -1968, -2564, -3143,
-    -3763, -4445, -5153, -5789, -6216, -6291, -5910, -5023, -3668, -1954, -46, 1865,
-    3575, 4897, 5702, 5938, 5623, 4854, 3798, 2658, 1614, 786, 212, -166,
-    -487, -907, -1540, -2421, -3486, -4583, -5510, -6068, -6113, -5587, -4536, -3095,
-    -1457, 168, 1587, 2654, 3298, 3537, 3469, 3231, 2958, 2743, 2639, 2625,
-    2613, 2479, 2115, 1461, 514, -656, -1903, -3044, -3913, -4396, -4441, -4072,
-    -3387, -2530, -1648, -867, -268, 120, 340, 490, 679, 980, 1405, 1913,
-    2416, 2802, 2967, 2853, 2464, 1856, 1124, 371, -314, -875, -1291, -1584,
-    -1810, -2027, -2271, -2541, -2783, -2906, -2823, -2492, -1929, -1213, -474, 151,
-    563, 728, 668, 468, 251, 134, 180, 392, 706, 1008, 1166, 1085,
-    730, 141, -573, -1262, -1765, -1948, -1746, -1188, -397, 459, 1209, 1719,
-    1916, 1818, 1519, 1143, 834, 708, 814, 1113, 1498, 1828, 1968, 1834,
-    1428, 821, 133, -484, -889, -994, -784, -307, 314, 899, 1271, 1323,
-    1033, 457, -285, -1021, -1582, -1845, -1753, -1339, -711, -24, 573, 953,
-    1044, 858, 473, 7, -415, -670, -676, -419, 44, 606, 1123, 1454,
-    1506, 1246, 700, -49, -864, -1587, -2080, -2256, -2091, -1644, -1047, -456,
-    -13, 186, 103, -218, -660, -1071, -1292, -1206, -771, -26, 918, 1909,
-    2786, 3418, 3726, 3688, 3334, 2744, 2038, 1336, 741, 322, 103, 49,
-    81, 114, 69, -121, -486, -1007, -1622, -2247, -2777, -3108, -3159, -2892,
-    -2320, -1509, -577, 339, 1108, 1624, 1824, 1706, 1335, 821, 290, -139,
-    -383, -412, -257, 3, 263, 412, 368, 101, -367, -950, -1506, -1885,
-    -1984, -1761, -1233, -475, 386, 1205, 1839, 2169, 2121, 1699, 995, 160,
-    -635, -1234, -1538, -1513, -1202, -698, -127, 379, 712, 815, 693, 412,
-    87, -159, -235, -104, 226, 701, 1217, 1639, 1833, 1718, 1281, 580,
-    -262, -1077, -1702, -2020, -1983, -1614, -1011, -309, 348, 831, 1045, 963,
-    636, 171, -304, -650, -761, -596, -200, 318, 803, 1098, 1093, 776,
-    204, -511, -1221, -1766, -2031, -1972, -1606, -1007, -308, 330, 780, 972,
-    906, 654, 348, 124, 84, 272, 665, 1185, 1724, 2175, 2462, 2568,
-    2542, 2464, 2414, 2448, 2573, 2734, 2837, 2790, 2523, 2006, 1262, 376,
-    -556, -1455, -2258, -2926, -3451, -3845, -4107, -4222, -4158, -3857, -3264, -2357,
-    -1172, 217, 1687, 3064, 4148, 4777, 4857, 4382, 3456, 2283, 1112, 182,
-    -349, -464, -286, -21, 104, -83, -652, -1534, -2546, -3443, -3983, -3999,
-    -3446, -2413, -1075, 341, 1605, 2542, 3064, 3165, 2918, 2459, 1953, 1544,
-    1321, 1297, 1392, 1471, 1406, 1125, 614, -66, -797, -1440, -1883, -2043,
-    -1894, -1487, -932, -367, 71, 282, 244, 18, -292, -565, -682, -563,
-    -197, 367, 1046, 1732, 2300, 2649, 2722, 2505, 2040, 1419, 758, 168,
-    -266, -502, -567, -543, -529, -613, -855, -1268, -1799, -2353, -2817, -3082,
-    -3072, -2766, -2202, -1461, -659, 91, 700, 1114, 1311, 1312, 1181, 1001,
-    853, 804, 882, 1069, 1295, 1474, 1526, 1401, 1086, 610, 42, -519,
-    -971, -1229, -1234, -971, -481, 153, 822, 1416, 1835, 2008, 1913, 1584,
-    1101, 585, 162, -72, -75, 143, 517, 946, 1311, 1510, 1474, 1185,
-    678, 37, -624, -1182, -1534, -1625, -1453, -1068, -551, -11, 440, 708,
-    742, 549, 183, -274, -727, -1076, -1247, -1211, -973, -582, -126, 277,
-    520, 531, 275, -221, -864, -1516, -2032, -2290, -2210, -1786, -1095, -280,
-    487, 1044, 1278, 1150, 704, 53, -643, -1212, -1514, -1460, -1046, -359,
-    451, 1215, 1775, 2017, 1911, 1506, 914, 278, -253, -573, -645, -488,
-    -179, 153, 371, 375, 117, -393, -1075, -1796, -2420, -2835, -2968, -2805,
-    -2408, -1880, -1329, -869, -600, -567, -738, -1020, -1291, -1420, -1326, -1004,
-    -502, 92, 657, 1072, 1256, 1192, 902, 460, -21, -427, -694, -809,
-    -802, -731, -663, -646, -691, -782, -872, -902, -817, -593, -252, 136,
-    470, 660, 644, 426, 68, -329, -656, -821, -769, -514, -136, 248,
-    526, 615, 490, 189, -197, -543, -732, -698, -449, -49, 393, 740,
-    870, 721, 313, -271, -884, -1359, -1561, -1433, -990, -318, 424, 1055,
-    1430, 1469, 1161, 572, -173, -920, -1526, -1890, -1989, -1877, -1646, -1394,
-    -1203, -1116, -1119, -1157, -1156, -1027, -691, -113, 672, 1580, 2496, 3304,
-    3913, 4290, 4444, 4426, 4307, 4160, 4028, 3920, 3822, 3674, 3395, 2919,
-    2227, 1341, 315, -776, -1853, -2850, -3715, -4399, -4879, -5148, -5204, -5026,
-    -4588, -3868, -2862, -1594, -128, 1429, 2938, 4259, 5267, 5868, 6010, 5691,
-    4963, 3928, 2739, 1568, 549, -254, -840, -1267, -1635, -2046, -2543, -3091,
-    -3608, -3980, -4092, -3865, -3300, -2456, -1432, -336, 722, 1661, 2441, 3056,
-    3510, 3813, 3980, 4030, 3963, 3768, 3436, 2956, 2320, 1556, 728, -94,
-    -841, -1444, -1843, -2033, -2059, -1975, -1840, -1725, -1688, -1734, -1828, -1917,
-    -1920, -1751, -1352, -709, 162, 1191, 2251, 3194, 3895, 4254, 4215, 3800,
-    3098, 2226, 1322, 527, -50, -365, -431, -318, -147, -54, -146, -479,
-    -1048, -1764, -2486, -3066, -3379, -3346, -2950, -2245, -1327, -326, 606, 1328,
-    1750, 1841, 1620, 1168, 608, 66, -349, -558, -531, -310, 14, 336,
-    557, 621, 526, 324, 93, -85, -135, -5, 319, 802, 1349, 1831,
-    2125, 2148, 1874, 1340, 648, -65, -664, -1032, -1092, -842, -351, 259,
-    843, 1260, 1413, 1281, 903, 366, -208, -688, -980, -1049, -925, -687,
-    -446, -295, -286, -423, -667, -946, -1180, -1308, -1286, -1112, -834, -536,
-    -301, -186, -202, -317, -466, -576, -590, -481, -259, 19, 273, 423,
-    410, 214, -133, -558, -974, -1301, -1481, -1498, -1380, -1187, -983, -821,
-    -721, -653, -552, -353, -12, 478, 1092, 1756, 2360, 2787, 2947, 2800,
-    2365, 1725, 1009, 352, -146, -439, -534, -492, -412, -399, -538, -869,
-    -1375, -1978, -2553, -2972, -3136, -3000, -2583, -1971, -1291, -674, -220, 24,
-    67, -32, -176, -264, -223, -24, 300, 669, 975, 1119, 1044, 744,
-    266, -305, -863, -1309, -1571, -1625, -1491, -1221, -885, -553, -274, -59,
-    98, 216, 315, 409, 495, 570, 625, 635, 561, 382, 110, -222,
-    -565, -856, -1033, -1055, -914, -619, -207, 259, 709, 1074, 1301, 1361,
-    1267, 1058, 782, 488, 227, 39, -66, -111, -142, -210, -349, -572,
-    -865, -1189, -1488, -1699, -1764, -1644, -1333, -865, -309, 246, 717, 1042,
-    1199, 1190, 1051, 837, 614, 437, 346, 354, 442, 564, 668, 704,
-    633, 428, 93, -332, -794, -1221, -1535, -1670, -1597, -1328, -898, -362,
-    213, 756, 1198, 1481, 1565, 1444, 1150, 746, 320, -39, -263, -311,
-    -171, 139, 564, 1026, 1429, 1687, 1736, 1552, 1153, 600, -12, -582,
-    -1022, -1271, -1309, -1166, -915, -641, -429, -342, -412, -625, -923, -1231,
-    -1468, -1559, -1462, -1180, -759, -267, 198, 541, 689, 623, 364, -27,
-    -461, -829, -1041, -1046, -839, -454, 39, 544, 957, 1197, 1217, 1020,
-    655, 213, -198, -482, -577, -466, -186, 180, 527, 761, 816, 662,
-    316, -155, -653, -1073, -1331, -1374, -1200, -859, -451, -95, 106, 101,
-    -97, -419, -760, -1003, -1052, -872, -489, 17, 540, 967, 1212, 1242,
-    1077, 779, 433, 126, -71, -121, -36, 121, 268, 328, 252, 34,
-    -285, -629, -916, -1074, -1066, -904, -658, -418, -274, -293, -495, -833,
-    -1214, -1535, -1705, -1651, -1349, -837, -210, 413, 911, 1198, 1247, 1096,
-    829, 546, 336, 259, 329, 506, 708, 833, 783, 504, 23, -556,
-    -1087, -1433, -1498, -1252, -752, -116, 515, 1005, 1247, 1197, 899, 468,
-    48, -221, -241, 2, 450, 993, 1505, 1863, 1990, 1874, 1577, 1211,
-    903, 748, 779, 961, 1211, 1407, 1436, 1232, 789, 147, -608, -1356,
-    -1984, -2415, -2616, -2602, -2440, -2227, -2048, -1953, -1952, -1996, -1993, -1842,
-    -1463, -823, 53, 1082, 2146, 3106, 3824, 4196, 4174, 3776, 3084, 2228,
-    1356, 603, 69, -210, -268, -206, -149, -205, -438, -859, -1411, -1984,
-    -2439, -2648, -2530, -2069, -1308, -348, 666, 1568, 2213, 2508, 2429, 2035,
-    1447, 809, 255, -113, -250, -176, 46, 326, 559, 646, 533, 219,
-    -247, -773, -1237, -1534, -1608, -1441, -1059, -529, 48, 571, 958, 1162,
-    1191, 1098, 953, 830, 789, 853, 997, 1174, 1331, 1401, 1323, 1065,
-    628, 42, -626, -1276, -1806, -2144, -2244, -2081, -1677, -1096, -422, 246,
-    810, 1190, 1345, 1270, 993, 583, 132, -274, -559, -672, -603, -383,
-    -71, 258, 519, 640, 576, 319, -98, -600, -1089, -1473, -1684, -1683,
-    -1469, -1077, -565, -8, 508, 904, 1134, 1195, 1124, 979, 825, 720,
-    699, 768, 894, 1022, 1093, 1048, 840, 453, -83, -700, -1313, -1826,
-    -2151, -2243, -2106, -1781, -1336, -866, -470, -218, -132, -197, -367, -570,
-    -724, -765, -663, -425, -96, 247, 521, 666, 660, 520, 304, 93,
-    -47, -96, -65, 8, 58, 18, -162, -495, -950, -1455, -1912, -2229,
-    -2342, -2237, -1953, -1576, -1205, -926, -797, -827, -970, -1145, -1264, -1249,
-    -1069, -745, -348, 47, 378, 603, 715, 742, 729, 718, 735, 783,
-    835, 852, 788, 593, 239, -249, -800, -1325, -1732, -1932, -1880, -1594,
-    -1145, -637, -182, 122, 237, 188, 41, -112, -178, -105, 107, 402,
-    689, 865, 844, 590, 124, -475, -1082, -1559, -1795, -1746, -1448, -1004,
-    -549, -205, -46, -80, -254, -468, -612, -604, -409, -31, 480, 1035,
-    1526, 1858, 1971, 1852, 1540, 1117, 675, 292, 16, -150, -239, -316,
-    -438, -626, -860, -1087, -1230, -1212, -982, -544, 58, 735, 1379, 1880,
-    2154, 2151, 1875, 1391, 806, 243, -180, -377, -315, -35, 375, 795,
-    1109, 1231, 1134, 847, 433, -10, -378, -586, -597, -420, -104, 267,
-    600, 822, 885, 776, 526, 211, -71, -225, -176, 96, 551, 1102,
-    1636, 2039, 2218, 2120, 1746, 1151, 433, -280, -863, -1225, -1314, -1120,
-    -685, -86, 569, 1154, 1555, 1698, 1575, 1234, 774, 310, -54, -247,
-    -233, -20, 341, 761, 1146, 1411, 1494, 1374, 1073, 652, 196, -199,
-    -455, -524, -403, -130, 219, 544, 755, 792, 632, 294, -160, -639,
-    -1050, -1309, -1346, -1135, -698, -101, 554, 1141, 1537, 1655, 1462, 989,
-    325, -399, -1044, -1494, -1670, -1541, -1142, -567, 56, 593, 916, 947,
-    688, 205, -387, -948, -1333, -1442, -1245, -780, -144, 522, 1070, 1392,
-    1442, 1230, 825, 337, -108, -407, -499, -379, -102, 233, 508, 628,
-    542, 246, -210, -727, -1179, -1452, -1470, -1204, -695, -53, 568, 1025,
-    1216, 1099, 700, 113, -515, -1035, -1324, -1321, -1044, -583, -71, 354,
-    576, 539, 261, -169, -623, -962, -1079, -941, -589, -126, 313, 600,
-    654, 474, 123, -298, -679, -922, -971, -834, -580, -303, -89, 5,
-    -32, -157, -288, -341, -254, -5, 378, 819, 1210, 1453, 1485, 1299,
-    947, 523, 130, -153, -292, -294, -199, -75, 8, -5, -140, -381,
-    -668, -912, -1029, -967, -716, -313, 161, 606, 936, 1094, 1067, 889,
-    638, 405, 264, 257, 371, 547, 699, 748, 637, 351, -72, -553,
-    -1003, -1335, -1480, -1403, -1126, -715, -258, 148, 417, 511, 453, 307,
-    152, 58, 73, 215, 464, 766, 1048, 1237, 1281, 1166, 917, 592,
-    265, 6, -140, -159, -66, 101, 291, 443, 514, 493, 401, 278,
-    183, 172, 282, 515, 846, 1219, 1553, 1761, 1783, 1595, 1210, 680,
-    97, -433, -809, -954, -827, -443, 135, 807, 1455, 1960, 2241, 2258,
-    2020, 1579, 1032, 500, 90, -126, -127, 64, 382, 735, 1018, 1140,
-    1042, 712, 185, -457, -1108, -1663, -2041, -2194, -2119, -1853, -1463, -1038,
-    -669, -435, -384, -532, -863, -1322, -1831, -2310, -2685, -2893, -2904, -2731,
-    -2422, -2045, -1681, -1400, -1241, -1208, -1287, -1430, -1573, -1655, -1629, -1471,
-    -1183, -805, -394, -6, 301, 476, 502, 405, 239, 76, -3, 70,
-    318, 730, 1258, 1830, 2358, 2771, 3024, 3103, 3030, 2859, 2668, 2538,
-    2539, 2710, 3044, 3482, 3936, 4305, 4487, 4419, 4086, 3528, 2828, 2096,
-    1438, 920, 565, 348, 207, 74, -108, -368, -704, -1085, -1458, -1759,
-    -1927, -1923, -1751, -1459, -1125, -841, -683, -694, -862, -1123, -1361, -1437,
-    -1234, -689, 189, 1318, 2541, 3665, 4507, 4925, 4829, 4196, 3084, 1619,
-    -23, -1636, -3029, -4063, -4658, -4780, -4454, -3752, -2766, -1595, -342, 893,
-    2033, 3006, 3736, 4144, 4171, 3782, 2986, 1851, 504, -898, -2192, -3214,
-    -3838, -3996, -3702, -3048, -2201, -1353, -674, -266, -149, -271, -517, -759,
-    -896, -884, -759, -617, -572, -706, -1043, -1543, -2115, -2644, -3029, -3201,
-    -3146, -2896, -2522, -2115, -1758, -1500, -1340, -1236, -1134, -983, -764, -505,
-    -262, -88, -27, -105, -319, -624, -939, -1168, -1232, -1097, -799, -425,
-    -81, 141, 187, 58, -189, -466, -684, -777, -715, -510, -218, 87,
-    329, 463, 476, 391, 265, 169, 166, 280, 500, 776, 1040, 1221,
-    1274, 1196, 1022, 816, 662, 636, 789, 1140, 1662, 2285, 2907, 3429,
-    3764, 3850, 3676, 3280, 2742, 2163, 1647, 1282, 1104, 1105, 1237, 1424,
-    1576, 1631, 1559, 1363, 1077, 764, 501, 345, 325, 434, 623, 815,
-    933, 921, 746, 408, -53, -569, -1048, -1397, -1538, -1427, -1071, -527,
-    113, 743, 1264, 1594, 1683, 1525, 1151, 624, 33, -519, -933, -1143,
-    -1130, -916, -569, -186, 132, 305, 286, 74, -292, -745, -1209, -1621,
-    -1933, -2114, -2158, -2090, -1963, -1845, -1804, -1892, -2125, -2472, -2863, -3215,
-    -3450, -3503, -3347, -2984, -2447, -1791, -1097, -444, 108, 513, 745, 807,
-    733, 570, 383, 263, 292, 512, 908, 1418, 1929, 2297, 2407, 2199,
-    1663, 835, -193, -1294, -2332, -3185, -3749, -3971, -3851, -3422, -2738, -1870,
-    -897, 103, 1072, 1962, 2748, 3413, 3950, 4351, 4607, 4710, 4647, 4408,
-    3988, 3387, 2618, 1715, 728, -278, -1232, -2063, -2733, -3225, -3542, -3702,
-    -3737, -3678, -3543, -3335, -3044, -2640, -2093, -1402, -595, 291, 1199, 2039,
-    2710, 3129, 3243, 3038, 2556, 1871, 1059, 186, -673, -1454, -2118, -2642,
-    -2998, -3163, -3138, -2924, -2517, -1927, -1202, -416, 335, 945, 1328, 1448,
-    1326, 1029, 668, 370, 237, 305, 541, 850, 1098, 1151, 930, 429,
-    -281, -1058, -1730, -2135, -2167, -1800, -1090, -179, 751, 1514, 1963, 2024,
-    1705, 1094, 324, -462, -1144, -1650, -1956, -2071, -2017, -1818, -1493, -1047,
-    -486, 170, 886, 1619, 2303, 2851, 3177, 3231, 2998, 2504, 1828, 1077,
-    363, -230, -650, -894, -1008, -1063, -1140, -1297, -1554, -1881, -2208, -2449,
-    -2506, -2307, -1834, -1129, -275, 614, 1399, 1973, 2293, 2368, 2233, 1955,
-    1620, 1304, 1045, 846, 684, 512, 281, -31, -407, -790, -1092, -1210,
-    -1062, -623, 72, 934, 1830, 2613, 3161, 3400, 3318, 2956, 2406, 1791,
-    1245, 871, 715, 757, 925, 1121, 1241, 1200, 959, 528, -39, -666,
-    -1253, -1691, -1885, -1784, -1405, -820, -144, 492, 979, 1247, 1267, 1058,
-    678, 224, -188, -454, -505, -317, 83, 621, 1188, 1666, 1958, 2006,
-    1798, 1371, 800, 177, -415, -911, -1261, -1448, -1489, -1428, -1326, -1264,
-    -1316, -1518, -1858, -2280, -2692, -3005, -3148, -3096, -2856, -2471, -2007, -1541,
-    -1150, -905, -850, -980, -1256, -1608, -1941, -2153, -2172, -1973, -1565, -999,
-    -360, 246, 731, 1024, 1083, 915, 580, 158, -256, -568, -711, -662,
-    -439, -88, 315, 691, 983, 1160, 1216, 1182, 1118, 1077, 1087, 1160,
-    1286, 1434, 1560, 1622, 1578, 1390, 1039, 538, -74, -736, -1366, -1886,
-    -2248, -2429, -2436, -2311, -2119, -1913, -1724, -1559, -1406, -1226, -972, -608,
-    -126, 447, 1043, 1567, 1917, 2011, 1810, 1336, 674, -62, -748, -1286,
-    -1619, -1742, -1694, -1557, -1434, -1415, -1546, -1821, -2182, -2536, -2778, -2832,
-    -2669, -2311, -1828, -1316, -861, -526, -350, -334, -435, -573, -671, -673,
-    -562, -361, -127, 67, 160, 124, -23, -228, -413, -499, -433, -206,
-    145, 542, 886, 1094, 1135, 1046, 906, 815, 864, 1103, 1525, 2070,
-    2651, 3147, 3435, 3433, 3131, 2593, 1932, 1290, 788, 506, 456, 602,
-    863, 1142, 1346, 1415, 1331, 1117, 831, 553, 348, 242, 225, 258,
-    286, 260, 165, 31, -82, -109, 7, 304, 765, 1336, 1939, 2495,
-    2923, 3171, 3231, 3132, 2922, 2667, 2434, 2254, 2114, 1971, 1767, 1443,
-    976, 392, -244, -845, -1310, -1554, -1548, -1323, -948, -512, -109, 196,
-    365, 388, 289, 124, -34, -116, -59, 163, 509, 894, 1228, 1428,
-    1420, 1181, 757, 225, -335, -843, -1218, -1403, -1382, -1174, -836, -456,
-    -115, 129, 252, 264, 216, 173, 197, 321, 548, 835, 1116, 1323,
-    1396, 1281, 953, 421, -272, -1049, -1809, -2436, -2842, -2972, -2818, -2428,
-    -1895, -1321, -796, -397, -183, -173, -345, -643, -984, -1266, -1401, -1347,
-    -1107, -723, -257, 203, 565, 754, 725, 473, 38, -502, -1047, -1506,
-    -1807, -1913, -1818, -1557, -1192, -813, -512, -363, -401, -617, -956, -1338,
-    -1684, -1939, -2075, -2085, -1990, -1831, -1666, -1560, -1576, -1752, -2070, -2468,
-    -2851, -3122, -3195, -3016, -2568, -1871, -990, -24, 922, 1754, 2403, 2825,
-    3020, 3026, 2912, 2754, 2636, 2623, 2734, 2944, 3203, 3445, 3592, 3571,
-    3356, 2959, 2416, 1789, 1158, 600, 158, -161, -393, -610, -903, -1336,
-    -1920, -2611, -3324, -3941, -4332, -4380, -4010, -3208, -2032, -593, 953, 2426,
-    3650, 4482, 4839, 4706, 4138, 3235, 2134, 982, -78, -938, -1547, -1924,
-    -2131, -2247, -2343, -2458, -2593, -2711, -2744, -2627, -2318, -1812, -1139, -360,
-    429, 1135, 1687, 2046, 2212, 2231, 2174, 2107, 2064, 2058, 2074, 2054,
-    1926, 1642, 1187, 576, -140, -877, -1549, -2099, -2505, -2771, -2928, -3011,
-    -3037, -3004, -2900, -2712, -2422, -2028, -1548, -1025, -514, -70, 272, 520,
-    714, 909, 1157, 1478, 1851, 2217, 2503, 2630, 2538, 2213, 1688, 1041,
-    374, -199, -585, -741, -683, -472, -181, 123, 403, 648, 867, 1078,
-    1290, 1506, 1703, 1840, 1867, 1755, 1507, 1148, 732, 346, 80, 5,
-    148, 490, 947, 1401, 1735, 1853, 1705, 1304, 736, 122, -424, -818,
-    -1015, -1028, -920, -782, -701, -740, -923, -1218, -1546, -1801, -1879, -1715,
-    -1296, -650, 154, 1008, 1793, 2414, 2811, 2958, 2869, 2601, 2220, 1789,
-    1370, 1001, 677, 376, 73, -272, -710, -1265, -1908, -2578, -3202, -3691,
-    -3958, -3959, -3690, -3181, -2494, -1715, -925, -183, 474, 1032, 1505, 1914,
-    2278, 2610, 2915, 3165, 3315, 3319, 3136, 2732, 2105, 1296, 364, -618,
-    -1563, -2384, -3015, -3413, -3556, -3450, -3133, -2655, -2076, -1465, -879, -342,
-    141, 575, 978, 1379, 1788, 2192, 2569, 2896, 3141, 3258, 3198, 2931,
-    2450, 1774, 948, 36, -877, -1704, -2365, -2800, -2983, -2932, -2703, -2380,
-    -2055, -1801, -1663, -1648, -1736, -1873, -1988, -2010, -1888, -1596, -1144, -583,
-    3, 526, 905, 1076, 1018, 756, 341, -149, -618, -981, -1194, -1241,
-    -1121, -869, -544, -203, 123, 407, 632, 796, 907, 966, 975, 947,
-    879, 754, 559, 292, -50, -444, -829, -1131, -1293, -1277, -1063, -667,
-    -138, 460, 1055, 1563, 1916, 2082, 2074, 1938, 1756, 1624, 1623, 1801,
-    2151, 2601, 3032, 3311, 3324, 2998, 2329, 1379, 250, -940, -2062, -2992,
-    -3640, -3964, -3979, -3768, -3470, -3233, -3172, -3331, -3665, -4051, -4323, -4335,
-    -3987, -3250, -2181, -909, 416, 1653, 2677, 3397, 3769, 3786, 3463, 2854,
-    2051, 1159, 276, -514, -1155, -1643, -2008, -2281, -2477, -2600, -2629, -2525,
-    -2246, -1768, -1095, -259, 687, 1683, 2658, 3534, 4228, 4676, 4834, 4675,
-    4202, 3459, 2518, 1465, 394, -604, -1457, -2125, -2601, -2906, -3076, -3155,
-    -3169, -3119, -2963, -2636, -2083, -1281, -251, 930, 2137, 3219, 4039, 4489,
-    4509, 4110, 3376, 2440, 1471, 648, 112, -91, -8, 248, 534, 701,
-    639, 314, -231, -905, -1586, -2150, -2498, -2595, -2455, -2138, -1717, -1260,
-    -812, -395, -5, 383, 801, 1261, 1753, 2240, 2658, 2920, 2934, 2647,
-    2046, 1171, 103, -1042, -2145, -3096, -3805, -4210, -4281, -4037, -3545, -2898,
-    -2198, -1540, -989, -564, -237, 47, 352, 743, 1269, 1941, 2727, 3563,
-    4349, 4976, 5348, 5403, 5118, 4517, 3672, 2690, 1670, 702, -151, -852,
-    -1400, -1813, -2112, -2320, -2461, -2554, -2600, -2581, -2468, -2225, -1829, -1276,
-    -587, 188, 974, 1690, 2260, 2624, 2741, 2611, 2264, 1758, 1161, 554,
-    17, -389, -637, -726, -676, -525, -323, -111, 83, 242, 350, 401,
-    413, 413, 424, 458, 521, 609, 696, 738, 694, 532, 232, -190,
-    -682, -1155, -1514, -1678, -1587, -1219, -617, 117, 853, 1455, 1810, 1857,
-    1608, 1142, 591, 100, -208, -268, -75, 315, 791, 1217, 1478, 1508,
-    1288, 850, 277, -326, -862, -1248, -1428, -1400, -1221, -968, -707, -488,
-    -334, -236, -168, -114, -63, -7, 51, 93, 102, 65, -30, -191,
-    -402, -633, -853, -1029, -1123, -1108, -984, -766, -479, -156, 178, 515,
-    863, 1224, 1593, 1951, 2275, 2540, 2728, 2819, 2780, 2578, 2189, 1619,
-    918, 178, -489, -979, -1221, -1186, -892, -396, 219, 866, 1461, 1929,
-    2231, 2370, 2373, 2270, 2086, 1824, 1452, 910, 148, -846, -2032, -3318,
-    -4548, -5534, -6096, -6102, -5500, -4338, -2751, -929, 921, 2595, 3923, 4797,
-    5160, 5011, 4417, 3518, 2493, 1520, 736, 203, -108, -292, -462, -712,
-    -1092, -1573, -2062, -2441, -2605, -2483, -2061, -1399, -598, 224, 950, 1489,
-    1802, 1898, 1822, 1636, 1406, 1186, 1006, 883, 821, 807, 828, 870,
-    910, 907, 823, 635, 317, -147, -745, -1432, -2146, -2813, -3343, -3663,
-    -3732, -3549, -3138, -2541, -1827, -1070, -331, 355, 991, 1602, 2216, 2850,
-    3483, 4040, 4417, 4512, 4246, 3584, 2549, 1229, -243, -1712, -3019, -4025,
-    -4638, -4829, -4636, -4157, -3527, -2889, -2379, -2096, -2058, -2201, -2404, -2529,
-    -2445, -2060, -1359, -417, 633, 1624, 2388, 2786, 2748, 2275, 1441, 381,
-    -726, -1699, -2372, -2632, -2449, -1887, -1074, -172, 653, 1265, 1592, 1632,
-    1420, 1024, 529, 29, -400, -705, -862, -864, -728, -479, -146, 244,
-    667, 1102, 1533, 1944, 2316, 2624, 2836, 2920, 2849, 2612, 2213, 1674,
-    1032, 335, -367, -1025, -1587, -2011, -2269, -2351, -2267, -2056, -1772, -1473,
-    -1211, -1025, -927, -893, -882, -848, -755, -578, -317, -2, 312, 559,
-    671, 596, 312, -160, -761, -1404, -1982, -2395, -2573, -2497, -2201, -1762,
-    -1275, -838, -524, -363, -342, -417, -514, -558, -485, -257, 125, 612,
-    1115, 1537, 1788, 1800, 1545, 1048, 386, -336, -1000, -1495, -1741, -1710,
-    -1429, -971, -439, 66, 461, 681, 688, 495, 149, -286, -745, -1156,
-    -1462, -1633, -1666, -1573, -1384, -1131, -838, -526, -215, 80, 349, 558,
-    655, 593, 338, -124, -767, -1509, -2235, -2831, -3190, -3224, -2888, -2201,
-    -1238, -110, 1055, 2127, 3012, 3666, 4100, 4354, 4471, 4487, 4419, 4264,
-    4004, 3634, 3152, 2565, 1902, 1213, 539, -102, -698, -1240, -1738, -2217,
-    -2695, -3187, -3713, -4264, -4784, -5182, -5361, -5230, -4735, -3885, -2751, -1440,
-    -73, 1234, 2391, 3331, 4013, 4426, 4599, 4561, 4330, 3924, 3366, 2670,
-    1853, 953, 10, -937, -1839, -2633, -3269, -3715, -3941, -3938, -3732, -3356,
-    -2836, -2196, -1471, -690, 131, 960, 1751, 2458, 3029, 3410, 3568, 3493,
-    3200, 2723, 2124, 1484, 878, 370, -1, -241, -387, -487, -580, -687,
-    -799, -882, -898, -808, -584, -236, 199, 661, 1067, 1332, 1402, 1284,
-    1032, 712, 416, 240, 243, 436, 785, 1213, 1597, 1815, 1786, 1480,
-    918, 179, -617, -1355, -1941, -2295, -2373, -2200, -1852, -1432, -1052, -807,
-    -753, -887, -1164, -1502, -1803, -1969, -1941, -1699, -1259, -670, 0, 673,
-    1262, 1687, 1896, 1878, 1657, 1283, 835, 406, 74, -111, -125, 19,
-    282, 605, 926, 1185, 1338, 1366, 1274, 1089, 854, 619, 424, 298,
-    254, 291, 395, 539, 686, 794, 835, 803, 712, 594, 483, 415,
-    415, 483, 617, 816, 1065, 1320, 1527, 1638, 1624, 1465, 1175, 788,
-    348, -99, -508, -836, -1060, -1181, -1221, -1213, -1194, -1181, -1174, -1163,
-    -1130, -1065, -966, -844, -709, -576, -466, -398, -381, -418, -509, -646,
-    -805, -957, -1079, -1158, -1198, -1211, -1213, -1209, -1197, -1160, -1073, -913,
-    -663, -313, 131, 638, 1163, 1662, 2105, 2467, 2729, 2892, 2964, 2949,
-    2842, 2642, 2353, 1990, 1579, 1153, 743, 364, 13, -322, -658, -1006,
-    -1362, -1705, -2003, -2227, -2348, -2353, -2238, -2018, -1720, -1379, -1038, -735,
-    -495, -314, -165, -11, 181, 427, 728, 1060, 1363, 1564, 1600, 1424,
-    1025, 440, -240, -909, -1476, -1874, -2062, -2043, -1854, -1547, -1178, -798,
-    -453, -163, 76, 277, 450, 605, 740, 840, 884, 860, 762, 599,
-    397, 198, 47, -31, -27, 38, 117, 152, 95, -70, -338, -681,
-    -1051, -1395, -1673, -1864, -1970, -2020, -2063, -2139, -2256, -2393, -2505, -2523,
-    -2382, -2035, -1464, -679, 272, 1308, 2336, 3263, 4008, 4518, 4784, 4827,
-    4688, 4420, 4079, 3694, 3271, 2810, 2303, 1732, 1076, 331, -489, -1355,
-    -2220, -3032, -3752, -4347, -4782, -5026, -5051, -4824, -4317, -3515, -2438, -1125,
-    350, 1894, 3402, 4770, 5897, 6687, 7063, 6975, 6420, 5449, 4161, 2684,
-    1160, -276, -1534, -2574, -3385, -3978, -4379, -4619, -4709, -4646, -4425, -4033,
-    -3454, -2696, -1786, -763, 322, 1386, 2341, 3116, 3661, 3932, 3912, 3618,
-    3085, 2361, 1509, 601, -298, -1137, -1868, -2459, -2889, -3147, -3227, -3137,
-    -2898, -2545, -2120, -1672, -1237, -834, -474, -161, 115, 378, 646, 936,
-    1264, 1633, 2021, 2391, 2699, 2891, 2913, 2740, 2385, 1879, 1279, 659,
-    93, -369, -709, -930, -1060, -1140, -1210, -1291, -1388, -1489, -1566, -1579,
-    -1494, -1288, -961, -540, -76, 383, 796, 1127, 1351, 1472, 1503, 1453,
-    1330, 1147, 908, 607, 248, -153, -575, -995, -1377, -1680, -1862, -1883,
-    -1708, -1332, -785, -126, 568, 1199, 1682, 1960, 2001, 1795, 1377, 812,
-    188, -412, -907, -1233, -1365, -1310, -1103, -803, -478, -182, 63, 258,
-    422, 588, 783, 1015, 1280, 1560, 1811, 1967, 1960, 1742, 1301, 672,
-    -69, -815, -1456, -1907, -2118, -2077, -1810, -1376, -857, -329, 149, 547,
-    860, 1108, 1308, 1465, 1568, 1591, 1495, 1243, 831, 288, -325, -915,
-    -1373, -1610, -1595, -1357, -973, -554, -224, -69, -109, -307, -591, -855,
-    -985, -897, -559, 15, 762, 1581, 2348, 2961, 3362, 3528, 3472, 3235,
-    2873, 2426, 1922, 1388, 858, 364, -70, -426, -700, -907, -1075, -1235,
-    -1415, -1633, -1892, -2168, -2413, -2566, -2569, -2388, -2023, -1514, -946, -428,
-    -54, 121, 84, -120, -400, -647, -765, -700, -458, -106, 251, 509,
-    586, 434, 63, -456, -1017, -1501, -1798, -1832, -1598, -1157, -603, -37,
-    445, 771, 910, 865, 669, 377, 51, -258, -527, -750, -946, -1142,
-    -1349, -1553, -1730, -1852, -1880, -1767, -1480, -1015, -409, 277, 959, 1550,
-    1970, 2182, 2196, 2049, 1791, 1482, 1194, 984, 881, 890, 992, 1140,
-    1271, 1335, 1302, 1159, 913, 603, 279, -10, -222, -337, -370, -357,
-    -340, -358, -444, -617, -873, -1196, -1560, -1927, -2252, -2504, -2654, -2680,
-    -2567, -2316, -1939, -1466, -937, -387, 153, 656, 1103, 1490, 1835, 2158,
-    2478, 2806, 3145, 3475, 3753, 3937, 3987, 3881, 3613, 3203, 2684, 2089,
-    1450, 801, 164, -465, -1099, -1748, -2408, -3060, -3675, -4198, -4559, -4688,
-    -4529, -4046, -3244, -2191, -990, 239, 1379, 2331, 3027, 3432, 3550, 3427,
-    3140, 2781, 2430, 2138, 1920, 1750, 1574, 1326, 946, 398, -315, -1160,
-    -2065, -2932, -3648, -4116, -4269, -4071, -3532, -2722, -1743, -713, 249, 1057,
-    1671, 2095, 2360, 2513, 2603, 2668, 2732, 2801, 2845, 2803, 2621, 2257,
-    1691, 938, 64, -844, -1716, -2498, -3141, -3611, -3901, -4011, -3952, -3752,
-    -3448, -3052, -2563, -1982, -1316, -574, 228, 1056, 1859, 2573, 3132, 3477,
-    3565, 3375, 2922, 2257, 1448, 561, -327, -1145, -1855, -2442, -2892, -3203,
-    -3394, -3485, -3472, -3350, -3132, -2833, -2472, -2086, -1723, -1416, -1193, -1071,
-    -1046, -1084, -1140, -1169, -1133, -1013, -812, -545, -223, 133, 499, 855,
-    1193, 1505, 1787, 2034, 2228, 2338, 2335, 2199, 1909, 1465, 897, 267,
-    -354, -886, -1256, -1417, -1363, -1126, -765, -355, 21, 287, 392, 338,
-    168, -47, -218, -259, -132, 142, 516, 923, 1279, 1509, 1579, 1480,
-    1214, 810, 323, -208, -757, -1293, -1786, -2219, -2580, -2838, -2961, -2929,
-    -2716, -2296, -1674, -894, -26, 834, 1573, 2094, 2344, 2310, 2023, 1555,
-    1007, 483, 75, -165, -245, -225, -182, -189, -305, -538, -840, -1130,
-    -1315, -1306, -1041, -523, 183, 965, 1681, 2193, 2411, 2315, 1946, 1400,
-    813, 331, 63, 76, 370, 874, 1457, 1970, 2278, 2288, 1963, 1333,
-    486, -467, -1404, -2217, -2824, -3179, -3277, -3144, -2823, -2371, -1853, -1339,
-    -874, -485, -187, 23, 170, 287, 398, 506, 610, 701, 755, 748,
-    659, 484, 232, -64, -362, -616, -781, -817, -716, -510, -249, 19,
-    255, 419, 487, 450, 317, 113, -130, -371, -582, -745, -860, -937,
-    -995, -1047, -1106, -1188, -1312, -1480, -1674, -1859, -1993, -2032, -1936, -1688,
-    -1294, -785, -209, 366, 860, 1186, 1283, 1136, 783, 296, -232, -698,
-    -1011, -1109, -961, -572, 9, 712, 1470, 2221, 2908, 3495, 3980, 4371,
-    4664, 4846, 4898, 4795, 4516, 4052, 3409, 2605, 1684, 706, -273, -1201,
-    -2035, -2739, -3304, -3735, -4037, -4206, -4218, -4033, -3615, -2950, -2058, -983,
-    218, 1475, 2716, 3867, 4847, 5575, 5985, 6033, 5722, 5100, 4248, 3275,
-    2293, 1400, 652, 61, -405, -815, -1251, -1772, -2386, -3046, -3657, -4091,
-    -4228, -3983, -3339, -2340, -1096, 246, 1517, 2566, 3290, 3658, 3686, 3429,
-    2973, 2428, 1882, 1368, 881, 394, -128, -720, -1382, -2062, -2682, -3150,
-    -3394, -3376, -3101, -2611, -1980, -1306, -682, -179, 168, 371, 481, 561,
-    672, 867, 1176, 1593, 2082, 2590, 3041, 3348, 3448, 3316, 2954, 2384,
-    1663, 865, 54, -702, -1327, -1759, -1987, -2041, -1978, -1874, -1815, -1865,
-    -2041, -2320, -2641, -2910, -3027, -2923, -2567, -1976, -1220, -402, 384, 1061,
-    1577, 1905, 2052, 2060, 1990, 1887, 1781, 1674, 1543, 1341, 1026, 585,
-    39, -557, -1132, -1602, -1895, -1967, -1803, -1431, -919, -349, 200, 661,
-    986, 1164, 1219, 1199, 1148, 1103, 1086, 1096, 1103, 1069, 970, 801,
-    575, 323, 89, -68, -102, 12, 270, 641, 1055, 1422, 1670, 1752,
-    1645, 1365, 962, 501, 53, -303, -501, -506, -323, 15, 455, 920,
-    1325, 1619, 1775, 1789, 1679, 1480, 1235, 997, 809, 679, 583, 484,
-    339, 109, -214, -611, -1042, -1456, -1793, -1986, -1987, -1781, -1374, -802,
-    -143, 506, 1069, 1489, 1729, 1791, 1705, 1523, 1319, 1170, 1128, 1209,
-    1394, 1630, 1845, 1965, 1942, 1754, 1398, 904, 343, -203, -668, -992,
-    -1127, -1066, -844, -516, -137, 233, 547, 786, 954, 1061, 1118, 1143,
-    1149, 1126, 1053, 916, 703, 412, 63, -317, -694, -1030, -1302, -1493,
-    -1594, -1599, -1508, -1322, -1062, -759, -439, -124, 172, 438, 664, 831,
-    933, 970, 947, 877, 779, 663, 530, 379, 203, -9, -265, -551,
-    -844, -1126, -1376, -1583, -1743, -1867, -1958, -2009, -2017, -1971, -1856, -1673,
-    -1428, -1123, -762, -342, 129, 627, 1129, 1620, 2079, 2481, 2812, 3055,
-    3193, 3230, 3186, 3072, 2896, 2666, 2389, 2064, 1698, 1301, 878, 432,
-    -31, -509, -994, -1464, -1893, -2263, -2563, -2785, -2924, -2986, -2977, -2888,
-    -2698, -2390, -1954, -1381, -673, 129, 956, 1738, 2399, 2848, 3024, 2912,
-    2544, 1989, 1357, 761, 276, -61, -261, -379, -499, -693, -1016, -1476,
-    -2030, -2600, -3088, -3394, -3450, -3233, -2759, -2082, -1282, -442, 373, 1109,
-    1731, 2225, 2579, 2785, 2845, 2760, 2524, 2151, 1664, 1091, 465, -170,
-    -767, -1295, -1729, -2059, -2283, -2399, -2400, -2283, -2045, -1690, -1243, -742,
-    -225, 266, 682, 983, 1150, 1171, 1060, 863, 640, 436, 286, 201,
-    166, 143, 92, -12, -177, -398, -652, -894, -1068, -1149, -1128, -1006,
-    -812, -606, -444, -367, -409, -576, -831, -1127, -1411, -1629, -1742, -1739,
-    -1627, -1423, -1153, -848, -543, -262, -28, 158, 309, 441, 573, 733,
-    936, 1172, 1419, 1646, 1813, 1879, 1824, 1638, 1332, 934, 483, 30,
-    -368, -670, -851, -898, -831, -689, -516, -347, -212, -121, -65, -32,
-    1, 55, 137, 255, 415, 598, 768, 902, 977, 967, 861, 666,
-    399, 88, -233, -524, -749, -885, -919, -858, -738, -590, -438, -308,
-    -218, -163, -134, -114, -72, 14, 150, 333, 542, 741, 889, 950,
-    905, 746, 469, 87, -358, -822, -1272, -1659, -1941, -2110, -2167, -2120,
-    -1991, -1806, -1579, -1325, -1061, -794, -524, -245, 45, 346, 651, 948,
-    1209, 1413, 1544, 1579, 1509, 1346, 1098, 790, 465, 159, -113, -339,
-    -517, -653, -758, -849, -943, -1043, -1150, -1253, -1319, -1325, -1254, -1088,
-    -835, -533, -214, 91, 336, 491, 541, 488, 349, 152, -77, -305,
-    -503, -659, -764, -818, -839, -838, -820, -800, -781, -740, -668, -562,
-    -418, -256, -105, 13, 77, 68, -17, -173, -385, -618, -841, -1029,
-    -1158, -1219, -1213, -1138, -1015, -878, -741, -615, -513, -434, -371, -320,
-    -268, -208, -150, -97, -51, -12, 30, 81, 144, 239, 382, 554,
-    735, 924, 1096, 1231, 1330, 1380, 1368, 1299, 1175, 994, 769, 516,
-    245, -39, -335, -632, -914, -1167, -1379, -1521, -1579, -1564, -1483, -1345,
-    -1165, -945, -689, -403, -83, 266, 627, 969, 1246, 1418, 1472, 1391,
-    1158, 809, 398, -45, -468, -814, -1064, -1208, -1236, -1174, -1070, -947,
-    -833, -741, -654, -556, -437, -278, -75, 152, 385, 590, 731, 794,
-    778, 690, 547, 368, 172, -21, -200, -367, -510, -627, -723, -797,
-    -849, -880, -868, -804, -691, -531, -343, -165, -14, 99, 152, 160,
-    141, 88, 22, -16, -30, -32, -2, 50, 94, 128, 144, 123,
-    69, -13, -124, -245, -351, -429, -470, -473, -448, -410, -372, -347,
-    -339, -350, -373, -390, -399, -401, -378, -328, -261, -176, -91, -35,
-    -3, 11, -13, -67, -132, -207, -275, -313, -331, -325, -279, -216,
-    -150, -66, 16, 72, 119, 158, 176, 194, 226, 259, 298, 351,
-    406, 448, 473, 470, 435, 366, 268, 154, 34, -83, -190, -282,
-    -348, -380, -398, -416, -419, -410, -409, -397, -369, -342, -303, -242,
-    -181, -114, -22, 75, 161, 239, 294, 324, 346, 350, 327, 310,
-    302, 279, 250, 220, 178, 135, 104, 75, 46, 27, 12, -5,
-    -14, -13, -4, 6, 23, 50, 71, 79, 83, 82, 72, 68,
-    75, 83, 99, 121, 140, 172, 215, 239, 254, 278, 278, 253,
-    240, 230, 207, 199, 205, 202, 207, 221, 224, 226, 237, 237,
-    227, 216, 201, 183, 174, 172, 178, 196, 222, 250, 278, 303,
-    325, 343, 360, 386, 414, 439, 463, 475, 463, 448, 431, 398,
-    369, 354, 334, 320, 331, 351, 375, 414, 440, 441, 444, 449,
-    442, 444, 459, 467, 472, 483, 487, 485, 486, 478, 459, 448,
-    441, 423, 393, 374, 364, 349, 339, 336, 325, 313, 304, 273,
-    227, 200, 188, 179, 190, 210, 215, 212, 203, 181, 163, 148,
-    122, 103, 97, 87, 79, 86, 80, 61, 54, 50, 37, 26,
-    11, -5, -13, -21, -30, -36, -44, -55, -70, -93, -109, -111,
-    -122, -135, -137, -150, -174, -185, -197, -214, -220, -237, -272, -290,
-    -298, -322, -328, -317, -324, -329, -312, -301, -292, -270, -257, -250,
-    -239, -239, -242, -231, -230, -244, -249, -256, -267, -260, -247, -245,
-    -245, -247, -251, -241, -230, -232, -228, -218, -213, -203, -190, -185,
-    -176, -172, -183, -182, -169, -172, -173, -152, -138, -133, -120, -111,
-    -102, -78, -63, -55, -31, -10, -6, 4, 15, 10, 10, 15,
-    10, 11, 18, 12, 10, 17, 16, 20, 35, 39, 46, 68,
-    82, 86, 100, 113, 119, 127, 129, 121, 125, 130, 130, 144,
-    161, 162, 162, 162, 144, 126, 123, 121, 125, 140, 146, 153,
-    166, 165, 153, 153, 154, 155, 161, 161, 163, 180, 184, 176,
-    179, 175, 158, 159, 164, 151, 142, 129, 99, 89, 102, 109,
-    120, 138, 145, 155, 170, 166, 154, 142, 125, 108, 96, 85,
-    85, 88, 84, 87, 95, 94, 100, 107, 95, 90, 94, 82,
-    71, 77, 69, 52, 50, 40, 17, 9, 8, -3, -7, 7,
-    15, 16, 24, 36, 40, 35, 24, 0, -32, -67, -98, -106,
-    -96, -99, -101, -87, -93, -118, -124, -116, -97, -64, -52, -59,
-    -52, -58, -90, -103, -116, -157, -198, -237, -280, -311, -348, -401,
-    -436, -471, -529, -568, -585, -595, -559, -481, -388, -256, -95, 67,
-    254, 440, 563, 624, 627, 573, 496, 394, 277, 200, 137, 52,
-    15, 11, -26, -43, -16, -15, -12, 24, 33, 34, 51, 24,
-    -47, -113, -199, -303, -380, -444, -496, -511, -509, -509, -499, -480,
-    -455, -441, -457, -487, -524, -574, -603, -604, -609, -602, -578, -578,
-    -589, -582, -586, -621, -666, -717, -780, -854, -911, -929, -929, -914,
-    -836, -697, -499, -181, 255, 749, 1294, 1821, 2189, 2357, 2332, 2100,
-    1721, 1290, 867, 528, 309, 191, 193, 312, 486, 684, 862, 955,
-    967, 905, 762, 603, 472, 344, 247, 197, 142, 100, 94, 67,
-    20, -9, -47, -97, -134, -176, -207, -206, -204, -200, -178, -167,
-    -174, -203, -288, -416, -564, -734, -903, -1048, -1175, -1263, -1309, -1331,
-    -1295, -1194, -1055, -857, -621, -394, -145, 81, 209, 280, 285, 182,
-    98, 71, 19, 58, 204, 270, 398, 656, 575, 123, -85, 17,
-    23, -28, 9, 5, -32, -10, -4, -20, -6, -4, -17, -9,
-    -11, -21, -8, -5, -19, -22, -24, -27, -20, -22, -23, -12,
-    -13, -15, -2, -1, -10, -3, 6, 0, 6, 18, 15, 4,
-    3, 3, 0, 0, 1, -4, -9, -4, -5, -9, -5, -2,
-    -7, -11, -16, -30, -36, -34, -33, -31, -23, -11, -2, 1,
-    2, 14, 22, 11, -6, -8, -2, -5, -13, -14, -10, -6,
-    -1, 6, 4, -2, -6, -8, -12, -10, -1, 10, 12, 8,
-    11, 11, 5, 7, 14, 11, 16, 32, 35, 30, 29, 23,
-    17, 17, 4, -3, 12, 11, -6, -1, 11, 4, 0, 7,
-    11, 16, 14, 3, 6, 12, -5, -18, -7, -4, -12, -10,
-    -4, -3, 6, 15, 14, 8, 3, 3, 9, 8, 2, 0,
-    -10, -22, -18, -6, -6, -6, 1, 4, 1, -4, -6, -6,
-    -7, -8, -5, -5, -6, 4, 13, 10, 18, 31, 21, 3,
-    3, 9, 7, 13, 21, 15, 11, 14, 12, 9, 10, 2,
-    -6, 1, 5, -3, -1, 12, 14, 13, 17, 21, 17, 10,
-    4, 3, -5, -15, -9, -4, -15, -20, -8, -2, -1, 7,
-    13, 12, 8, 5, 6, 3, -7, -9, -9, -14, -3, 14,
-    8, 2, 9, -1, -12, -1, 1, -8, -8, -8, -10, -6,
-    -10, -16, -7, -5, -13, -7, 2, -1, -2, -1, -6, -5,
-    -4, -4, 5, 13, 12, 13, 15, 12, 13, 14, 10, 7,
-    0, -8, -4, 2, 1, 0, 0, 0, 7, 8, 3, 4,
-    5, -4, -7, -2, -1, -1, 0, 5, 11, 9, 4, 4,
-    2, -3, 0, 1, -1, 3, 2, -2, 2, 0, -10, -9,
-    -10, -17, -18, -19, -20, -11, -6, -8, 1, 5, -3, 0,
-    5, 1, 3, 9, 4, 3, 6, 3, 2, 4, 3, 5,
-    6, 3, 4, -1, -6, 0, -1, -10, -3, -1, -12, -5,
-    4, -9, -9, 2, -5, -10, -2, -3, -2, 0, -7, -4,
-    0, -8, -2, 5, -8, -6, 3, -10, -6, 11, -5, -7,
-    18, 2, -12, 18, 16, -11, 9, 20, -8, -2, 13, -6,
-    -7, 11, 2, -3, 11, 7, 0, 8, 7, -1, 1, 2,
-    -1, -3, -5, -5, -8, -10, -5, -1, -3, 1, 6, 2,
-    3, 4, -3, -4, -2, -8, -9, -6, -8, -8, -4, -4,
-    -3, 1, -1, -2, 1, -3, -6, -2, -1, -2, 2, 2,
-    0, 1, 1, -3, -1, 3, 3, 2, 2, 3, 2, -1,
-    1, 2, 0, -1, 1, 0, 0, 3, 3, 2, 5, 5,
-    4, 4, 5, 5, 5, 4, 3, 1, 0, 0, 0, -4,
-    -5, -2, -3, -4, -2, -1, -2, 0, 1, 0, 0, -1,
-    -1, -1, -1, -2, -1, -2, -2, -1, 0, -1, 0, 3,
-    2, 1, 1, 1, -1, -2, -3, -4, -4, -2, -3, -4,
-    -3, -1, -3, -3, -2, -2, -2, -2, -1, 0, 0, 0,
-    0, 3, 3, 3, 3, 1, -1, 1, 3, 1, 0, 1,
-    2, 0, 0, 0, -1, -3, -2, 0, 0, -1, 0, 0,
-    1, 3, 4, 3, 3, 3, 2, 0, 2, 2, -1, -2,
-    -1, -1, -1, -2, -2, -3, -2, -2, -2, -2, -3, -1,
-    0, -1, 0, 2, 1, 1, 2, 1, 1, 2, 0, -1,
-    0, 0, -2, 0, 2, 1, 1, 2, 3, 3, 4, 3,
-    1, -2, -2, -1, -1, -2, 0, 0, 0, 0, 1, -1,
-    -1, 0, -1, -2, 0, 0, -1, 0, 1, -1, -2, 1,
-    1, -2, -1, 1, 1, -1, 1, 2, -1, 0, 3, 2,
-    1, 1, 2, 1, 1, 3, 1, -2, -1, 0, -1, -1,
-    1, -1, -3, -1, 0, -2, -4, -3, -2, -3, -4, -3,
-    -2, -5, -4, -2, -3, -5, -2, 2, -1, -5, -3, -1,
-    -1, -1, -1, 0, 0, -2, -1, 0, 0, 0, 1, 0,
-    1, 4, 4, 3, 3, 4, 3, 3, 4, 4, 4, 3,
-    3, 3, 2, 1, 2, 1, -1, -1, 0, 0, -1, 0,
-    1, 1, 0, 0, 0, -1, -1, 1, 1, -1, -3, -3,
-    -3, -1, -2, -5, -3, 1, -2, -4, -3, -3, -4, -5,
-    -5, -4, -4, -5, -5, -3, -4, -3, -1, -1, -2, -2,
-    -1, 0, -1, -2, -2, 1, 0, -2, -2, -1, -2, -1,
-    -1, -1, 0, 0, -1, 0, 1, -1, 0, 1, 0, -1,
-    0, 0, 1, 1, 1, 1, 3, 2, -1, -1, -1, -1,
-    0, 0, -2, 1, 3, 0, -2, 0, 1, -2, -2, 0,
-    0, -1, -1, 0, 0, 0, 0, 0, 1, -2, -2, 1,
-    1, 0, 1, 0, -1, 1, 1, -3, -2, 0, -2, -3,
-    -2, -1, 0, -1, -1, -1, -1, -2, -1, -1, -3, -2,
-    -2, -2, 1, 0, -2, 0, 1, -2, -2, 0, -2, -2,
-};
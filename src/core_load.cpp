@@ -0,0 +1,42 @@
+#include "core_load.h"
+
+volatile uint32_t CoreLoad::idle_us_[CoreLoad::NUM_CORES] = {0, 0};
+uint32_t CoreLoad::sample_idle_us_[CoreLoad::NUM_CORES] = {0, 0};
+uint32_t CoreLoad::sample_time_us_[CoreLoad::NUM_CORES] = {0, 0};
+
+bool CoreLoad::idleUntil(absolute_time_t deadline, WakeCheck wake_early, void *ctx) {
+    uint core = get_core_num();
+    uint32_t start = time_us_32();
+
+    // A SEV that arrives between the check and the WFE is latched in the
+    // event register, so the WFE returns at once and nothing is missed.
+    bool reached = false;
+    while (!(wake_early && wake_early(ctx))) {
+        if (best_effort_wfe_or_timeout(deadline)) {
+            reached = true;
+            break;
+        }
+    }
+
+    idle_us_[core] += time_us_32() - start;
+    return reached;
+}
+
+uint32_t CoreLoad::samplePercent(uint core) {
+    if (core >= NUM_CORES) {
+        return 0;
+    }
+    // 32-bit counters wrap every ~71 minutes; unsigned differences stay
+    // correct as long as samples are taken more often than that.
+    uint32_t now  = time_us_32();
+    uint32_t idle = idle_us_[core];
+    uint32_t wall_delta = now - sample_time_us_[core];
+    uint32_t idle_delta = idle - sample_idle_us_[core];
+    sample_time_us_[core] = now;
+    sample_idle_us_[core] = idle;
+
+    if (wall_delta == 0 || idle_delta >= wall_delta) {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)(wall_delta - idle_delta) * 100) / wall_delta);
+}
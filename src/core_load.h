@@ -0,0 +1,39 @@
+#ifndef CORE_LOAD_H
+#define CORE_LOAD_H
+
+#include "pico/stdlib.h"
+
+// ---------------------------------------------------------------------------
+// Per-core load accounting.
+//
+// Each core's loop does all of its sleeping through CoreLoad::idleUntil(),
+// which books the time as idle for the calling core; everything else counts
+// as busy.  Interrupts serviced while the core is parked in WFE are booked
+// as idle, so the figure is the headroom left for the loop itself.
+// ---------------------------------------------------------------------------
+class CoreLoad {
+public:
+    // Early-wake check for idleUntil(), polled after every WFE wake-up
+    typedef bool (*WakeCheck)(void *ctx);
+
+    // Sleep in WFE until `deadline`, or until wake_early(ctx) returns true.
+    // Returns true if the deadline was reached.
+    static bool idleUntil(absolute_time_t deadline,
+                          WakeCheck wake_early = nullptr, void *ctx = nullptr);
+
+    // Busy time of `core` (0 or 1) as a percentage of the wall time since
+    // the previous sample of that core.  Call from one place only.
+    static uint32_t samplePercent(uint core);
+
+private:
+    static const uint NUM_CORES = 2;
+
+    // Microseconds spent in idleUntil(); each entry written by its own core
+    static volatile uint32_t idle_us_[NUM_CORES];
+
+    // Sampler state (owned by the caller of samplePercent)
+    static uint32_t sample_idle_us_[NUM_CORES];
+    static uint32_t sample_time_us_[NUM_CORES];
+};
+
+#endif // CORE_LOAD_H
@@ -0,0 +1,86 @@
+#include "frame_clock.h"
+
+FrameClock::FrameClock(uint32_t fps)
+    : fps_(0), period_us_(0), next_tick_(0) {
+    frame_.time     = 0;
+    frame_.now_ms   = 0;
+    frame_.delta_us = 0;
+    frame_.index    = 0;
+    setFps(fps);
+}
+
+void FrameClock::setFps(uint32_t fps) {
+    fps_       = fps > 0 ? fps : 1;
+    period_us_ = 1000000u / fps_;
+}
+
+void FrameClock::start() {
+    absolute_time_t now = get_absolute_time();
+    frame_.time     = now;
+    frame_.now_ms   = to_ms_since_boot(now);
+    frame_.delta_us = 0;
+    frame_.index    = 0;
+    next_tick_      = delayed_by_us(now, period_us_);
+}
+
+void FrameClock::advance(absolute_time_t now) {
+    frame_.delta_us = (uint32_t)absolute_time_diff_us(frame_.time, now);
+    frame_.time     = now;
+    frame_.now_ms   = to_ms_since_boot(now);
+    frame_.index++;
+
+    // Stay on the fixed grid; if a frame overran by more than a whole
+    // period, drop the missed ticks instead of bursting to catch up.
+    next_tick_ = delayed_by_us(next_tick_, period_us_);
+    if (absolute_time_diff_us(now, next_tick_) <= 0) {
+        next_tick_ = delayed_by_us(now, period_us_);
+    }
+}
+
+bool FrameClock::tick() {
+    absolute_time_t now = get_absolute_time();
+    if (absolute_time_diff_us(now, next_tick_) > 0) {
+        return false;
+    }
+    advance(now);
+    return true;
+}
+
+const FrameInfo &FrameClock::waitForTick() {
+    return waitForTick(next_tick_);
+}
+
+absolute_time_t FrameClock::gridTickAtOrAfter(absolute_time_t t) const {
+    int64_t ahead = absolute_time_diff_us(next_tick_, t);
+    if (ahead <= 0) {
+        return next_tick_;
+    }
+    // Skip whole periods so the wake-up lands on the grid
+    uint64_t periods = ((uint64_t)ahead + period_us_ - 1) / period_us_;
+    return delayed_by_us(next_tick_, periods * period_us_);
+}
+
+const FrameInfo &FrameClock::waitForTick(absolute_time_t not_before,
+                                         CoreLoad::WakeCheck wake_early,
+                                         void *ctx) {
+    // The next tick on the grid, before skipping ahead to the deadline
+    absolute_time_t grid_tick = next_tick_;
+
+    if (is_at_the_end_of_time(not_before)) {
+        next_tick_ = at_the_end_of_time;
+    } else {
+        next_tick_ = gridTickAtOrAfter(not_before);
+    }
+
+    // Core sleeps in WFE between interrupts until the tick is due
+    if (!CoreLoad::idleUntil(next_tick_, wake_early, ctx)) {
+        // Woken early: handle it on the first grid tick from now, which may
+        // be well before the deadline we were sleeping towards
+        next_tick_ = grid_tick;
+        next_tick_ = gridTickAtOrAfter(get_absolute_time());
+        CoreLoad::idleUntil(next_tick_);
+    }
+
+    advance(get_absolute_time());
+    return frame_;
+}
@@ -0,0 +1,66 @@
+#ifndef FRAME_CLOCK_H
+#define FRAME_CLOCK_H
+
+#include "pico/stdlib.h"
+#include "core_load.h"
+
+// Timing for one rendered frame, handed to every Animation::update
+struct FrameInfo {
+    absolute_time_t time;   // when this tick fired
+    uint32_t now_ms;        // same instant, ms since boot
+    uint32_t delta_us;      // time since the previous tick
+    uint32_t index;         // ticks since FrameClock::start()
+};
+
+// ---------------------------------------------------------------------------
+// Fixed-rate frame clock.  The main loop waits for each tick, then renders
+// and shows exactly one frame, so the time is read once per frame instead of
+// once per animation and the frame rate is a single tunable.
+//
+// The loop is tickless: it passes the earliest deadline any component
+// reported, and the clock sleeps (WFE) straight through ticks nobody needs.
+// ---------------------------------------------------------------------------
+class FrameClock {
+public:
+    explicit FrameClock(uint32_t fps = 50);
+
+    // Change the tick rate; takes effect from the next tick
+    void setFps(uint32_t fps);
+    uint32_t getFps() const { return fps_; }
+
+    // Reset the frame index and schedule the first tick for now
+    void start();
+
+    // The most recent tick (frame 0 right after start())
+    const FrameInfo &frame() const { return frame_; }
+
+    // When the next tick is due
+    absolute_time_t nextTickTime() const { return next_tick_; }
+
+    // Non-blocking: if the next tick is due, advance and return true
+    bool tick();
+
+    // Sleep until the next tick, then advance
+    const FrameInfo &waitForTick();
+
+    // Sleep until the first tick at or after `not_before`, then advance.
+    // Ticks stay on the fixed grid; at_the_end_of_time sleeps until reset.
+    // If wake_early(ctx) turns true while asleep (e.g. a command arrived
+    // from the other core), the wait is cut short to the next grid tick.
+    const FrameInfo &waitForTick(absolute_time_t not_before,
+                                 CoreLoad::WakeCheck wake_early = nullptr,
+                                 void *ctx = nullptr);
+
+private:
+    uint32_t fps_;
+    uint32_t period_us_;
+    absolute_time_t next_tick_;
+    FrameInfo frame_;
+
+    void advance(absolute_time_t now);
+
+    // First grid tick at or after `t` (never before next_tick_)
+    absolute_time_t gridTickAtOrAfter(absolute_time_t t) const;
+};
+
+#endif // FRAME_CLOCK_H
@@ -0,0 +1,72 @@
+#ifndef GAMMA_H
+#define GAMMA_H
+
+#include <stdint.h>
+
+// ---------------------------------------------------------------------------
+// Gamma correction tables for the LED output stage.
+//
+// Tables are generated at compile time and end up in .rodata (flash), so
+// correcting a channel costs one table lookup at runtime.  Each NeoPixel
+// strip selects its own table with NeoPixel::setGamma().
+// ---------------------------------------------------------------------------
+
+struct GammaTable {
+    uint8_t v[256];
+};
+
+// constexpr natural log for x > 0: range-reduce to [0.5, 1) by powers of two,
+// then ln(m) = 2 * atanh((m - 1) / (m + 1)) as a power series.
+constexpr double gamma_ln(double x) {
+    int k = 0;
+    while (x >= 1.0) { x *= 0.5; k++; }
+    while (x < 0.5)  { x *= 2.0; k--; }
+    double z  = (x - 1.0) / (x + 1.0);
+    double z2 = z * z;
+    double term = z;
+    double sum  = 0.0;
+    for (int n = 1; n < 60; n += 2) {
+        sum  += term / n;
+        term *= z2;
+    }
+    return 2.0 * sum + k * 0.69314718055994530942;
+}
+
+// constexpr exp for x <= 0: halve until small, Taylor series, square back up.
+constexpr double gamma_exp(double x) {
+    int halvings = 0;
+    while (x < -0.5) { x *= 0.5; halvings++; }
+    double term = 1.0;
+    double sum  = 1.0;
+    for (int n = 1; n < 20; n++) {
+        term *= x / n;
+        sum  += term;
+    }
+    for (int i = 0; i < halvings; i++) {
+        sum *= sum;
+    }
+    return sum;
+}
+
+// out = 255 * (in / 255) ^ gamma, rounded to nearest
+constexpr GammaTable makeGammaTable(double gamma) {
+    GammaTable table{};
+    for (int i = 0; i < 256; i++) {
+        if (i == 0) {
+            table.v[i] = 0;
+        } else if (gamma == 1.0) {
+            table.v[i] = (uint8_t)i;
+        } else {
+            double level = gamma_exp(gamma * gamma_ln(i / 255.0));
+            table.v[i] = (uint8_t)(level * 255.0 + 0.5);
+        }
+    }
+    return table;
+}
+
+// Built-in tables
+inline constexpr GammaTable GAMMA_LINEAR = makeGammaTable(1.0);
+inline constexpr GammaTable GAMMA_2_2    = makeGammaTable(2.2);   // sRGB-like
+inline constexpr GammaTable GAMMA_2_8    = makeGammaTable(2.8);   // steeper, good for very dim fades
+
+#endif // GAMMA_H
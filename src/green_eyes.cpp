@@ -0,0 +1,43 @@
+#include "green_eyes.h"
+#include <stdlib.h>
+
+GreenEyesScheduler::GreenEyesScheduler(uint32_t hold_ms, uint32_t min_gap_ms,
+                                       uint32_t max_gap_ms)
+    : hold_ms_(hold_ms), min_gap_ms_(min_gap_ms),
+      max_gap_ms_(max_gap_ms > min_gap_ms ? max_gap_ms : min_gap_ms + 1),
+      steady_(false), active_(false),
+      next_on_(at_the_end_of_time), next_off_(at_the_end_of_time) {
+}
+
+absolute_time_t GreenEyesScheduler::randomGapAfter(absolute_time_t t) const {
+    return delayed_by_ms(t, min_gap_ms_ + (rand() % (max_gap_ms_ - min_gap_ms_)));
+}
+
+void GreenEyesScheduler::start(absolute_time_t now) {
+    active_   = false;
+    next_on_  = randomGapAfter(now);
+    next_off_ = at_the_end_of_time;
+}
+
+GreenEyesScheduler::Action GreenEyesScheduler::update(absolute_time_t now) {
+    if (active_) {
+        // Hold neon green until the duration elapses
+        if (absolute_time_diff_us(next_off_, now) >= 0) {
+            active_   = false;
+            next_off_ = at_the_end_of_time;
+            // Schedule the next random trigger
+            next_on_  = randomGapAfter(now);
+            return EYES_OFF;
+        }
+    } else if (steady_ && absolute_time_diff_us(next_on_, now) >= 0) {
+        active_   = true;
+        next_off_ = delayed_by_ms(now, hold_ms_);
+        return EYES_ON;
+    }
+    return NONE;
+}
+
+absolute_time_t GreenEyesScheduler::nextDeadline() const {
+    if (active_) return next_off_;
+    return steady_ ? next_on_ : at_the_end_of_time;
+}
@@ -0,0 +1,50 @@
+#ifndef GREEN_EYES_H
+#define GREEN_EYES_H
+
+#include "pico/stdlib.h"
+
+// ---------------------------------------------------------------------------
+// Random green-eyes timing: once the boot sequence has finished, the eyes
+// turn green for a fixed hold at random 20-60 s intervals.  Only decides
+// *when*; the caller turns actions into LED commands and audio.
+// ---------------------------------------------------------------------------
+class GreenEyesScheduler {
+public:
+    enum Action {
+        NONE,
+        EYES_ON,    // start of a hold
+        EYES_OFF,   // end of a hold
+    };
+
+    GreenEyesScheduler(uint32_t hold_ms = 10000,
+                       uint32_t min_gap_ms = 20000,
+                       uint32_t max_gap_ms = 60000);
+
+    // Arm the first trigger, a random gap after `now` (uses rand())
+    void start(absolute_time_t now);
+
+    // Triggers only fire once the LEDs have reached steady state
+    void setSteadyState(bool steady) { steady_ = steady; }
+
+    // Call on every wake-up; returns what changed at `now`
+    Action update(absolute_time_t now);
+
+    // When update() next needs to run (end of time until steady state)
+    absolute_time_t nextDeadline() const;
+
+    bool isActive() const { return active_; }
+
+private:
+    uint32_t hold_ms_;
+    uint32_t min_gap_ms_;
+    uint32_t max_gap_ms_;
+
+    bool steady_;
+    bool active_;
+    absolute_time_t next_on_;
+    absolute_time_t next_off_;
+
+    absolute_time_t randomGapAfter(absolute_time_t t) const;
+};
+
+#endif // GREEN_EYES_H
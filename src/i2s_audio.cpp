@@ -1,40 +1,87 @@
 #include "i2s_audio.h"
 #include "i2s_out.pio.h"
+#include "hardware/clocks.h"
+#include "hardware/pll.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
 #include <stdio.h>
 #include <string.h>
 
+// 1: print a line for every voice started (play, enqueue, loop restart)
+#ifndef I2S_AUDIO_DEBUG
+#define I2S_AUDIO_DEBUG 0
+#endif
+
 I2SAudio *I2SAudio::instance_ = nullptr;
 
+// SysTick: 24-bit down-counter at the processor clock, used to time the IRQ
+// (the Cortex-M0+ has no cycle counter)
+static const uint32_t SYSTICK_MASK = 0x00FFFFFF;
+
 I2SAudio::I2SAudio(uint data_pin, uint bclk_pin, uint lrclk_pin,
-                   PIO pio, uint sm)
+                   uint32_t output_rate, PIO pio, uint sm)
     : pio_(pio), sm_(sm),
       data_pin_(data_pin), bclk_pin_(bclk_pin), lrclk_pin_(lrclk_pin),
-      pio_offset_(0), dma_channel_(-1), playing_(false),
-      next_is_a_(true),
-      src_samples_(nullptr), src_num_samples_(0), src_pos_(0) {
+      pio_offset_(0), dma_chan_a_(-1), dma_chan_b_(-1), playing_(false),
+      direct_(false), direct_slot_(0), leaving_direct_(false), handover_mix_(false),
+      stream_ending_(false), stereo_a_(false),
+      stereo_b_(false), sample_rate_(0),
+      clkdiv_(0), queue_head_(0), queue_count_(0), queue_voice_(NO_VOICE),
+      clip_start_cb_(nullptr), clip_start_ctx_(nullptr),
+      clip_table_(nullptr), clip_count_(0),
+      irq_cycles_max_(0), underruns_(0) {
+
+    memset(voices_, 0, sizeof(voices_));
+    master_.set(GAIN_UNITY);
 
     // Load PIO program
     pio_offset_ = pio_add_program(pio_, &i2s_out_program);
 
-    // Claim a DMA channel
-    dma_channel_ = dma_claim_unused_channel(true);
+    // Claim the ping-pong DMA channel pair
+    dma_chan_a_ = dma_claim_unused_channel(true);
+    dma_chan_b_ = dma_claim_unused_channel(true);
+
+    // Free-running SysTick for IRQ cycle measurements (CLKSOURCE | ENABLE)
+    systick_hw->rvr = SYSTICK_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;
 
     // Set up DMA IRQ handler
     instance_ = this;
     irq_set_exclusive_handler(DMA_IRQ_0, dmaIrqHandler);
     irq_set_enabled(DMA_IRQ_0, true);
 
+    // The bus rate never changes: the state machine idles at its first
+    // pull until samples arrive
+    initPio(output_rate);
+
     printf("I2S Audio initialized: DIN=GPIO%d, BCLK=GPIO%d, LRCLK=GPIO%d\n",
            data_pin_, bclk_pin_, lrclk_pin_);
+    printf("I2S: %lu Hz requested, clk_sys %lu Hz / %lu.%03lu / %d -> %.2f Hz (%+.1f ppm)\n",
+           (unsigned long)sample_rate_, (unsigned long)clock_get_hz(clk_sys),
+           (unsigned long)(clkdiv_ >> 8), (unsigned long)(((clkdiv_ & 0xFF) * 1000) >> 8),
+           i2s_out_CYCLES_PER_SAMPLE, getAchievedRate(), getRateErrorPpm());
 }
 
 I2SAudio::~I2SAudio() {
-    stop();
+    // No time for a fade: silence the voices and stop the DMA at once
+    uint32_t irq_state = save_and_disable_interrupts();
+    for (uint v = 0; v < MAX_VOICES; v++) {
+        voices_[v].active = false;
+    }
+    queue_count_ = 0;
+    if (playing_) {
+        stopStream();
+    }
+    restore_interrupts(irq_state);
     irq_set_enabled(DMA_IRQ_0, false);
     pio_sm_set_enabled(pio_, sm_, false);
     pio_remove_program(pio_, &i2s_out_program, pio_offset_);
-    if (dma_channel_ >= 0) {
-        dma_channel_unclaim(dma_channel_);
+    if (dma_chan_a_ >= 0) {
+        dma_channel_unclaim(dma_chan_a_);
+    }
+    if (dma_chan_b_ >= 0) {
+        dma_channel_unclaim(dma_chan_b_);
     }
     if (instance_ == this) instance_ = nullptr;
 }
@@ -43,102 +90,865 @@ void I2SAudio::initPio(uint32_t sample_rate) {
     pio_sm_set_enabled(pio_, sm_, false);
     pio_sm_clear_fifos(pio_, sm_);
 
+    sample_rate_ = sample_rate;
+    clkdiv_ = bestDivider(clock_get_hz(clk_sys), 1, sample_rate);
     i2s_out_program_init(pio_, sm_, pio_offset_,
-                         data_pin_, bclk_pin_, lrclk_pin_, sample_rate);
+                         data_pin_, bclk_pin_, lrclk_pin_,
+                         (uint16_t)(clkdiv_ >> 8), (uint8_t)(clkdiv_ & 0xFF));
 }
 
-uint32_t I2SAudio::fillBuffer(uint32_t *buf) {
-    uint32_t remaining = src_num_samples_ - src_pos_;
-    uint32_t count = remaining < BUF_SAMPLES ? remaining : BUF_SAMPLES;
+// ---------------------------------------------------------------------------
+// Clocking.  The PIO divider is 16.8 fixed point, so for a clock of
+// clk_num / clk_den Hz the best divider (in 1/256 units) is the one nearest
+// clk * 256 / (rate * CYCLES_PER_SAMPLE).  Errors are worked out exactly in
+// integers, in parts per billion.
+// ---------------------------------------------------------------------------
+uint32_t I2SAudio::bestDivider(uint64_t clk_num, uint32_t clk_den, uint32_t rate) {
+    uint64_t den = (uint64_t)clk_den * rate * i2s_out_CYCLES_PER_SAMPLE;
+    uint64_t div = (clk_num * 256 + den / 2) / den;
+    if (div < 0x100) div = 0x100;            // 1.0 is the fastest the PIO runs
+    if (div > 0xFFFFFF) div = 0xFFFFFF;
+    return (uint32_t)div;
+}
 
-    for (uint32_t i = 0; i < count; i++) {
-        uint16_t s = (uint16_t)src_samples_[src_pos_++];
-        buf[i] = ((uint32_t)s << 16) | (uint32_t)s;
-    }
+int64_t I2SAudio::rateErrorPpb(uint64_t clk_num, uint32_t clk_den, uint32_t rate,
+                               uint32_t clkdiv) {
+    // achieved = clk_num * 256 / (clk_den * clkdiv * CYCLES_PER_SAMPLE)
+    int64_t den = (int64_t)clk_den * clkdiv * i2s_out_CYCLES_PER_SAMPLE;
+    int64_t diff = (int64_t)(clk_num * 256) - den * rate;
+    return diff * 1000000000LL / (den * rate);
+}
 
-    // Zero-fill remainder for the last partial buffer
-    if (count < BUF_SAMPLES) {
-        memset(&buf[count], 0, (BUF_SAMPLES - count) * sizeof(uint32_t));
+float I2SAudio::getAchievedRate() const {
+    if (clkdiv_ == 0) return 0.0f;
+    return (float)clock_get_hz(clk_sys) * 256.0f /
+           ((float)clkdiv_ * i2s_out_CYCLES_PER_SAMPLE);
+}
+
+float I2SAudio::getRateErrorPpm() const {
+    if (clkdiv_ == 0) return 0.0f;
+    return rateErrorPpb(clock_get_hz(clk_sys), 1, sample_rate_, clkdiv_) / 1000.0f;
+}
+
+uint32_t I2SAudio::selectAudioSysClock(const uint32_t *rates, uint num_rates,
+                                       uint32_t min_khz, uint32_t max_khz) {
+    // Every PLL setting the hardware allows: VCO 750-1600 MHz from the
+    // crystal (refdiv 1, so fbdiv alone sets the VCO), two post dividers 1-7
+    const uint fbdiv_min = (PICO_PLL_VCO_MIN_FREQ_HZ + XOSC_HZ - 1) / XOSC_HZ;
+    const uint fbdiv_max = PICO_PLL_VCO_MAX_FREQ_HZ / XOSC_HZ;
+    int64_t best_error = INT64_MAX;
+    uint best_fractional = 0;
+    uint64_t best_vco = 0;
+    uint best_pd1 = 0, best_pd2 = 0;
+
+    for (uint fbdiv = fbdiv_min; fbdiv <= fbdiv_max; fbdiv++) {
+        uint64_t vco = (uint64_t)XOSC_HZ * fbdiv;
+
+        for (uint pd1 = 1; pd1 <= 7; pd1++) {
+            for (uint pd2 = 1; pd2 <= pd1; pd2++) {
+                uint32_t pd = pd1 * pd2;
+                if (vco < (uint64_t)min_khz * 1000 * pd ||
+                    vco > (uint64_t)max_khz * 1000 * pd) continue;
+
+                // Score: worst error over the rates, then how many of them
+                // need a fractional divider (those jitter by one clk_sys
+                // cycle), then the faster clock
+                int64_t worst = 0;
+                uint fractional = 0;
+                for (uint r = 0; r < num_rates; r++) {
+                    uint32_t div = bestDivider(vco, pd, rates[r]);
+                    int64_t err = rateErrorPpb(vco, pd, rates[r], div);
+                    if (err < 0) err = -err;
+                    if (err > worst) worst = err;
+                    if (div & 0xFF) fractional++;
+                }
+
+                bool better = worst < best_error ||
+                    (worst == best_error && fractional < best_fractional) ||
+                    (worst == best_error && fractional == best_fractional &&
+                     vco * best_pd1 * best_pd2 > best_vco * pd);
+                if (better) {
+                    best_error = worst;
+                    best_fractional = fractional;
+                    best_vco = vco;
+                    best_pd1 = pd1;
+                    best_pd2 = pd2;
+                }
+            }
+        }
     }
 
-    return count;
+    if (best_vco == 0) return 0;
+    set_sys_clock_pll((uint32_t)best_vco, best_pd1, best_pd2);
+    return (uint32_t)(best_vco / (best_pd1 * best_pd2));
 }
 
-void I2SAudio::dmaIrqHandler() {
-    if (!instance_) return;
+uint32_t I2SAudio::getBufferCycles() const {
+    if (sample_rate_ == 0) return 0;
+    return (uint32_t)(((uint64_t)clock_get_hz(clk_sys) * BUF_SAMPLES) / sample_rate_);
+}
 
-    dma_hw->ints0 = 1u << instance_->dma_channel_;
+// ---------------------------------------------------------------------------
+// Mixer.  Runs once per buffer in the DMA IRQ: every active voice is
+// decoded and resampled to the output rate as needed, scaled by its gain
+// times the master gain (mixer.h) and summed at 32 bits, then the sum is
+// saturated to 16 bits.  Mono voices sum into mix_; stereo voices into mix_stereo_,
+// which turns the buffer into stereo frames (mono voices on both sides).
+// Without a stereo voice the buffer stays mono and the PIO sends each
+// sample on both channels.  Returns the number of frames that carry audio
+// (0 once every voice has finished).
+// ---------------------------------------------------------------------------
 
-    if (!instance_->playing_ || instance_->src_pos_ >= instance_->src_num_samples_) {
-        instance_->playing_ = false;
-        return;
+// Decode (and resample) up to `count` samples of a voice.  `src` points at
+// the result: voice_buf_, or the clip itself in flash for plain PCM.
+// `finished` is set once the clip has nothing more to give.  For a stereo
+// voice `src` holds `count` interleaved frames.  Loops jump
+// back here, at the exact sample: a resampled voice keeps its filter
+// history across the jump, a direct one ends its span at the loop end.
+uint32_t I2SAudio::renderVoice(Voice &voice, uint32_t count, const int16_t *&src,
+                               bool &finished) {
+    if (voice.resample) {
+        // The resampler pulls input samples one at a time
+        uint32_t n = voice.resampler.process(voice_buf_, count, [&voice](int16_t &s) {
+            if (voice.pos >= voice.end() && !voice.loopBack()) return false;
+            if (voice.codec == CODEC_IMA_ADPCM) {
+                voice.adpcm.next(s);
+            } else {
+                s = voice.samples[voice.pos];
+            }
+            voice.pos++;
+            return true;
+        });
+        src = voice_buf_;
+        finished = n < count;
+        return n;
     }
 
-    // Fill the next buffer and start a new DMA transfer
-    uint32_t *buf = instance_->next_is_a_ ? instance_->buf_a_ : instance_->buf_b_;
-    instance_->next_is_a_ = !instance_->next_is_a_;
-    uint32_t count = instance_->fillBuffer(buf);
+    uint32_t end = voice.end();
+    uint32_t remaining = end - voice.pos;
+    uint32_t n = remaining < count ? remaining : count;
 
-    if (count > 0) {
-        dma_channel_transfer_from_buffer_now(instance_->dma_channel_, buf, BUF_SAMPLES);
+    if (voice.codec == CODEC_IMA_ADPCM) {
+        voice.adpcm.decode(voice_buf_, n);
+        src = voice_buf_;
     } else {
-        instance_->playing_ = false;
+        src = voice.samples + voice.pos * voice.channels;   // straight from flash
     }
+
+    voice.pos += n;
+    if (voice.pos == end && voice.loopBack()) {
+        finished = false;   // the next span starts at the loop start
+    } else {
+        finished = voice.pos >= voice.num_samples;
+    }
+    return n;
 }
 
-void I2SAudio::play(const int16_t *samples, uint32_t num_samples,
-                    uint32_t sample_rate) {
-    stop();
+uint32_t I2SAudio::fillBuffer(int16_t *buf, bool &stereo) {
+    uint32_t frames = 0;
+    memset(mix_, 0, sizeof(mix_));
+    stereo = false;
+
+    // Master gain at the start and the end of this buffer
+    int32_t master0 = master_.current;
+    int32_t master1 = master_.advance(BUF_SAMPLES);
+    int32_t master_span = master1 - master0;
+
+    for (uint v = 0; v < MAX_VOICES; v++) {
+        Voice &voice = voices_[v];
+
+        // A queue voice may run through several clips in one buffer:
+        // `done` is where the next one picks up
+        uint32_t done = 0;
+        while (voice.active && done < BUF_SAMPLES) {
+            if (voice.announce) {
+                voice.announce = false;
+                if (clip_start_cb_) clip_start_cb_(voice.tag, clip_start_ctx_);
+            }
+
+            const int16_t *src;
+            bool finished;
+            uint32_t count = renderVoice(voice, BUF_SAMPLES - done, src, finished);
 
-    src_samples_ = samples;
-    src_num_samples_ = num_samples;
-    src_pos_ = 0;
-    next_is_a_ = true;
+            // Gain stage: voice ramp times master ramp, interpolated per
+            // sample (master taken at this part's ends of the buffer ramp)
+            int32_t m0 = master0 + master_span * (int32_t)done / (int32_t)BUF_SAMPLES;
+            int32_t m1 = master0 + master_span * (int32_t)(done + count) / (int32_t)BUF_SAMPLES;
+            int32_t g0 = mixGain(voice.gain.current, m0);
+            int32_t g1 = mixGain(voice.gain.advance(count), m1);
+            if (voice.channels == 2) {
+                if (!stereo) {
+                    // First stereo voice in this buffer
+                    memset(mix_stereo_, 0, sizeof(mix_stereo_));
+                    stereo = true;
+                }
+                mixScaledStereo(mix_stereo_ + done * 2, src, count, g0, g1);
+            } else {
+                mixScaled(mix_ + done, src, count, g0, g1);
+            }
+            done += count;
 
-    // Configure PIO for this sample rate
-    initPio(sample_rate);
+            if (voice.stopping && voice.gain.current == 0) {
+                // Faded out within this buffer
+                finished = true;
+            }
+            if (finished) {
+                if (voice.queued && !voice.stopping && queue_count_ > 0) {
+                    // Next queued clip carries on at the following sample
+                    loadVoice(voice, queue_[queue_head_]);
+                    voice.announce = true;
+                    queue_head_ = (queue_head_ + 1) % QUEUE_LEN;
+                    queue_count_--;
+                } else {
+                    // Last samples are in this buffer; the slot is free again.
+                    // Clips still waiting for a queue voice that is gone
+                    // would otherwise play on the next one, out of order.
+                    voice.active = false;
+                    if (voice.queued) queue_count_ = 0;
+                }
+            }
+        }
+        if (done > frames) frames = done;
+    }
+
+    if (stereo) {
+        for (uint32_t i = 0; i < BUF_SAMPLES; i++) {
+            buf[i * 2]     = saturate16(mix_[i] + mix_stereo_[i * 2]);
+            buf[i * 2 + 1] = saturate16(mix_[i] + mix_stereo_[i * 2 + 1]);
+        }
+    } else {
+        for (uint32_t i = 0; i < BUF_SAMPLES; i++) {
+            buf[i] = saturate16(mix_[i]);
+        }
+    }
+
+    return frames;
+}
 
-    // Configure DMA to feed the PIO TX FIFO
-    dma_channel_config cfg = dma_channel_get_default_config(dma_channel_);
-    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+// ---------------------------------------------------------------------------
+// Ping-pong streaming.  Channel A plays buf_a_ and triggers channel B, which
+// plays buf_b_ and triggers A again; each channel's read address wraps back
+// to the start of its buffer, so the hardware keeps going with no CPU help.
+// The completion IRQ of one channel only refills that channel's buffer while
+// the other one plays.
+// ---------------------------------------------------------------------------
+// A stereo buffer moves one 32-bit frame per transfer; a mono one 16 bits,
+// which the bus duplicates into both halves of the FIFO word.
+void I2SAudio::configureChannel(uint chan, int16_t *buf, uint chain_to, bool stereo) {
+    dma_channel_config cfg = dma_channel_get_default_config(chan);
+    channel_config_set_transfer_data_size(&cfg, stereo ? DMA_SIZE_32 : DMA_SIZE_16);
     channel_config_set_read_increment(&cfg, true);
     channel_config_set_write_increment(&cfg, false);
+    channel_config_set_ring(&cfg, false, stereo ? BUF_RING_BITS_STEREO : BUF_RING_BITS_MONO);
     channel_config_set_dreq(&cfg, pio_get_dreq(pio_, sm_, true));
+    channel_config_set_chain_to(&cfg, chain_to);
 
     dma_channel_configure(
-        dma_channel_,
+        chan,
         &cfg,
         &pio_->txf[sm_],     // write to PIO TX FIFO
-        NULL,                 // read address set per transfer
-        BUF_SAMPLES,          // transfer count
+        buf,                  // read ring over this buffer
+        BUF_SAMPLES,          // transfer count (reloaded on every trigger)
         false                 // don't start yet
     );
+}
+
+// Called from the refill IRQ after an underrun: `chan` is already playing
+// `buf` with the wrong frame layout.  Stop it without triggering `other`,
+// reconfigure it and play the buffer again from its start.  Should it have
+// chained on to `other` meanwhile, it is simply left armed for the next
+// trigger.
+void I2SAudio::restartChannel(uint chan, int16_t *buf, uint other, bool stereo) {
+    dma_channel_config cfg = dma_get_channel_config(chan);
+    channel_config_set_chain_to(&cfg, chan);
+    dma_channel_set_config(chan, &cfg, false);
+    dma_channel_abort(chan);
+    dma_hw->ints0 = 1u << chan;
+
+    configureChannel(chan, buf, other, stereo);
+    if (!dma_channel_is_busy(other)) {
+        dma_channel_start(chan);
+    }
+}
+
+void I2SAudio::refill(uint chan, int16_t *buf, uint other, bool &stereo) {
+    bool stereo_now;
+    uint32_t frames = fillBuffer(buf, stereo_now);
 
-    // Enable DMA completion interrupt for this channel
-    dma_channel_set_irq0_enabled(dma_channel_, true);
+    if (frames > 0) {
+        stream_ending_ = false;
+    } else if (!stream_ending_) {
+        // Silence queued; the other buffer still holds the last audio
+        stream_ending_ = true;
+    } else {
+        // Both buffers are silent: the clip tail has played out
+        stopStream();
+        return;
+    }
 
-    // Fill the first buffer and start streaming
-    uint32_t *buf = buf_a_;
-    next_is_a_ = false;
-    fillBuffer(buf);
+    // The other channel already finished and restarted this one before the
+    // refill was done: part of this buffer went out stale
+    if (!dma_channel_is_busy(other)) {
+        underruns_++;
+        // Running with the old frame layout it would mis-frame this buffer
+        // and every later one: start it over in the new layout
+        if (stereo_now != stereo) {
+            restartChannel(chan, buf, other, stereo_now);
+            stereo = stereo_now;
+        }
+        return;
+    }
 
+    // Switch this channel between mono and stereo frames for its next
+    // run; it is idle until the other channel chains to it
+    if (stereo_now != stereo) {
+        configureChannel(chan, buf, other, stereo_now);
+        stereo = stereo_now;
+    }
+}
+
+void I2SAudio::dmaIrqHandler() {
+    if (!instance_) return;
+    uint32_t t_start = systick_hw->cvr;
+    I2SAudio &self = *instance_;
+
+    uint32_t mask_a = 1u << self.dma_chan_a_;
+    uint32_t mask_b = 1u << self.dma_chan_b_;
+    uint32_t pending = dma_hw->ints0 & (mask_a | mask_b);
+    dma_hw->ints0 = pending;
+
+    if (self.direct_ && self.leaving_direct_) {
+        self.handover();
+    } else if (self.direct_) {
+        if (pending & mask_a) {
+            // The whole clip is in the PIO FIFO: the voice is done
+            self.voices_[self.direct_slot_].active = false;
+            self.stopStream();
+        }
+    } else if (self.playing_ && (pending & mask_a)) {
+        self.refill(self.dma_chan_a_, self.buf_a_, self.dma_chan_b_, self.stereo_a_);
+    }
+    if (!self.direct_ && self.playing_ && (pending & mask_b)) {
+        self.refill(self.dma_chan_b_, self.buf_b_, self.dma_chan_a_, self.stereo_b_);
+    }
+
+    uint32_t cycles = (t_start - systick_hw->cvr) & SYSTICK_MASK;
+    if (cycles > self.irq_cycles_max_) {
+        self.irq_cycles_max_ = cycles;
+    }
+}
+
+void I2SAudio::startStream() {
+    fillBuffer(buf_a_, stereo_a_);
+    runStream();
+}
+
+// Start the ping-pong stream with buf_a_ already mixed.  Buffer B only has
+// to be ready when A has played out.
+void I2SAudio::runStream() {
+    configureChannel(dma_chan_a_, buf_a_, dma_chan_b_, stereo_a_);
+
+    dma_hw->ints0 = (1u << dma_chan_a_) | (1u << dma_chan_b_);
+    dma_channel_set_irq0_enabled(dma_chan_a_, true);
+    dma_channel_set_irq0_enabled(dma_chan_b_, true);
+
+    direct_ = false;
+    playing_ = true;
+    dma_channel_start(dma_chan_a_);
+    stream_ending_ = (fillBuffer(buf_b_, stereo_b_) == 0);
+    configureChannel(dma_chan_b_, buf_b_, dma_chan_a_, stereo_b_);
+}
+
+// ---------------------------------------------------------------------------
+// Direct mode.  One voice, PCM at the output rate, unity gain and no ramp
+// (see directAllowed()): channel A copies the flash
+// array into the PIO FIFO, one 16-bit sample or 32-bit stereo frame at a
+// time, and raises its IRQ once at the end of the clip.
+// ---------------------------------------------------------------------------
+void I2SAudio::startDirect(uint slot) {
+    const Voice &voice = voices_[slot];
+
+    dma_channel_config cfg = dma_channel_get_default_config(dma_chan_a_);
+    channel_config_set_transfer_data_size(&cfg,
+                                          voice.channels == 2 ? DMA_SIZE_32 : DMA_SIZE_16);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(pio_, sm_, true));
+
+    dma_channel_configure(
+        dma_chan_a_,
+        &cfg,
+        &pio_->txf[sm_],     // write to PIO TX FIFO
+        voice.samples,        // read the clip straight from flash
+        voice.num_samples,    // whole clip (in frames) in one transfer
+        false                 // don't start yet
+    );
+
+    dma_hw->ints0 = 1u << dma_chan_a_;
+    dma_channel_set_irq0_enabled(dma_chan_a_, true);
+
+    direct_ = true;
+    direct_slot_ = slot;
     playing_ = true;
-    dma_channel_transfer_from_buffer_now(dma_channel_, buf, BUF_SAMPLES);
+    dma_channel_start(dma_chan_a_);
+}
+
+uint32_t I2SAudio::directFrame() const {
+    const Voice &voice = voices_[direct_slot_];
+    uintptr_t read_addr = dma_hw->ch[dma_chan_a_].read_addr;
+    return (uint32_t)((read_addr - (uintptr_t)voice.samples) /
+                      (sizeof(int16_t) * voice.channels));
+}
+
+// Called with interrupts disabled, and only re-arms the DMA: the mixing is
+// left to the refill IRQ.  The PIO FIFO holds 8 frames, under 0.2 ms, far
+// less than a mix takes, so the flash transfer is cut short
+// DIRECT_HANDOVER_FRAMES ahead and chained on to channel B.  The IRQ,
+// raised here, mixes buf_b_ from the handover frame while the transfer
+// plays on, and B follows it at the next sample.
+void I2SAudio::leaveDirect() {
+    if (leaving_direct_) return;
+    Voice &voice = voices_[direct_slot_];
+
+    // B plays buf_b_ first; its layout is fixed up if the mix disagrees
+    configureChannel(dma_chan_b_, buf_b_, dma_chan_a_, stereo_b_);
+    dma_hw->ints0 = 1u << dma_chan_b_;
+    dma_channel_set_irq0_enabled(dma_chan_b_, true);
 
-    printf("I2S: playing %lu samples at %lu Hz (streaming)\n",
-           (unsigned long)num_samples, (unsigned long)sample_rate);
+    // Not busy: the clip already ended and handover() starts B itself
+    bool busy = dma_channel_is_busy(dma_chan_a_);
+    dma_channel_abort(dma_chan_a_);
+    dma_hw->ints0 = 1u << dma_chan_a_;
+
+    uint32_t frame = directFrame();
+    uint32_t handover = frame + DIRECT_HANDOVER_FRAMES;
+    if (handover >= voice.num_samples) {
+        // The transfer plays the rest of the clip
+        handover = voice.num_samples;
+        voice.active = false;
+    }
+    voice.pos = handover;
+
+    if (busy && handover > frame) {
+        dma_channel_config cfg = dma_get_channel_config(dma_chan_a_);
+        channel_config_set_chain_to(&cfg, dma_chan_b_);
+        dma_channel_set_config(dma_chan_a_, &cfg, false);
+        // The abort left the read address at the next frame
+        dma_channel_set_trans_count(dma_chan_a_, handover - frame, false);
+        dma_channel_start(dma_chan_a_);
+    }
+
+    leaving_direct_ = true;
+    handover_mix_ = true;
+    irq_set_pending(DMA_IRQ_0);
+}
+
+// Refill IRQ while leaving direct mode: mix buf_b_ once, then, when the
+// flash transfer has ended, take over as the ping-pong stream.  A mix
+// slower than the lead lets B start on a stale buffer, counted as an
+// underrun.
+void I2SAudio::handover() {
+    uint chan_a = dma_chan_a_;
+    uint chan_b = dma_chan_b_;
+
+    if (handover_mix_) {
+        handover_mix_ = false;
+        bool stereo;
+        stream_ending_ = (fillBuffer(buf_b_, stereo) == 0);
+        if (dma_channel_is_busy(chan_b)) {
+            underruns_++;
+            if (stereo != stereo_b_) {
+                restartChannel(chan_b, buf_b_, chan_a, stereo);
+            }
+        } else if (stereo != stereo_b_) {
+            configureChannel(chan_b, buf_b_, chan_a, stereo);
+        }
+        stereo_b_ = stereo;
+    }
+
+    // Still playing the clip up to the handover frame
+    if (dma_channel_is_busy(chan_a)) return;
+
+    leaving_direct_ = false;
+    direct_ = false;
+    dma_hw->ints0 = 1u << chan_a;
+    if (!dma_channel_is_busy(chan_b)) {
+        // The transfer ended without chaining: the clip ran out first
+        underruns_++;
+        dma_channel_start(chan_b);
+    }
+    configureChannel(chan_a, buf_a_, chan_b, stereo_a_);
+    refill(chan_a, buf_a_, chan_b, stereo_a_);
+}
+
+void I2SAudio::stopStream() {
+    playing_ = false;
+    direct_ = false;
+    leaving_direct_ = false;
+    handover_mix_ = false;
+    dma_channel_set_irq0_enabled(dma_chan_a_, false);
+    dma_channel_set_irq0_enabled(dma_chan_b_, false);
+
+    // Break the chain first: aborting one channel must not trigger the other
+    uint chans[2] = { (uint)dma_chan_a_, (uint)dma_chan_b_ };
+    for (uint chan : chans) {
+        dma_channel_config cfg = dma_get_channel_config(chan);
+        channel_config_set_chain_to(&cfg, chan);
+        dma_channel_set_config(chan, &cfg, false);
+    }
+    dma_channel_abort(dma_chan_a_);
+    dma_channel_abort(dma_chan_b_);
+    dma_hw->ints0 = (1u << dma_chan_a_) | (1u << dma_chan_b_);
+}
+
+I2SAudio::VoiceId I2SAudio::play(const int16_t *samples, uint32_t num_samples,
+                                 uint32_t sample_rate, uint16_t gain,
+                                 uint8_t num_channels) {
+    return startVoice({CODEC_PCM16, num_channels, samples, num_samples, sample_rate,
+                       0, 0, 0, gain, 0}, false);
+}
+
+I2SAudio::VoiceId I2SAudio::playAdpcm(const uint8_t *data, uint32_t num_samples,
+                                      uint32_t sample_rate, uint16_t gain) {
+    return startVoice({CODEC_IMA_ADPCM, 1, data, num_samples, sample_rate,
+                       0, 0, 0, gain, 0}, false);
+}
+
+I2SAudio::VoiceId I2SAudio::playLooped(const int16_t *samples, uint32_t num_samples,
+                                       uint32_t sample_rate, uint32_t loop_start,
+                                       uint32_t loop_end, uint16_t loop_count,
+                                       uint16_t gain, uint8_t num_channels) {
+    return startVoice({CODEC_PCM16, num_channels, samples, num_samples, sample_rate,
+                       loop_start, loop_end, loop_count, gain, 0}, false);
+}
+
+I2SAudio::VoiceId I2SAudio::playAdpcmLooped(const uint8_t *data, uint32_t num_samples,
+                                            uint32_t sample_rate, uint32_t loop_start,
+                                            uint32_t loop_end, uint16_t loop_count,
+                                            uint16_t gain) {
+    return startVoice({CODEC_IMA_ADPCM, 1, data, num_samples, sample_rate,
+                       loop_start, loop_end, loop_count, gain, 0}, false);
+}
+
+void I2SAudio::endLoop(VoiceId voice) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    int slot = voiceSlot(voice);
+    if (slot >= 0) {
+        voices_[slot].loops_left = 0;
+    }
+    restore_interrupts(irq_state);
+}
+
+void I2SAudio::setClipTable(const ClipDescriptor *table, uint count) {
+    clip_table_ = table;
+    clip_count_ = table ? count : 0;
+}
+
+const AudioClip *I2SAudio::clipById(ClipId clip) const {
+    uint index = (uint)clip;
+    return index < clip_count_ ? &clip_table_[index].clip : nullptr;
+}
+
+I2SAudio::VoiceId I2SAudio::play(ClipId clip, uint16_t gain) {
+    const AudioClip *found = clipById(clip);
+    return found ? startVoice(clipRef(*found, 0, gain, 0), false) : NO_VOICE;
+}
+
+I2SAudio::VoiceId I2SAudio::playLooped(ClipId clip, uint16_t loop_count, uint16_t gain) {
+    const AudioClip *found = clipById(clip);
+    return found ? startVoice(clipRef(*found, loop_count, gain, 0), false) : NO_VOICE;
+}
+
+I2SAudio::ClipRef I2SAudio::clipRef(const AudioClip &clip, uint16_t loop_count,
+                                    uint16_t gain, uint32_t tag) {
+    return {clip.codec == AudioCodec::IMA_ADPCM ? CODEC_IMA_ADPCM : CODEC_PCM16,
+            clip.channels, clip.data, clip.num_samples, clip.sample_rate,
+            clip.loop_start, clip.loop_end, loop_count, gain, tag};
+}
+
+// Stereo clips skip the decoder and the resampler: PCM at the output rate
+bool I2SAudio::clipSupported(const ClipRef &clip) const {
+    if (!clip.data || clip.num_samples == 0) return false;
+    if (clip.channels == 1) return true;
+    if (clip.channels == 2 && clip.codec == CODEC_PCM16 &&
+        clip.sample_rate == sample_rate_) return true;
+    printf("I2S: unsupported clip (%u channels at %lu Hz)\n",
+           clip.channels, (unsigned long)clip.sample_rate);
+    return false;
+}
+
+// Point a voice at a new clip (position, decoder, resampler and gain); the
+// caller owns `active` and `generation`
+void I2SAudio::loadVoice(Voice &voice, const ClipRef &clip) {
+    uint32_t frames = clip.num_samples / clip.channels;
+    voice.codec       = clip.codec;
+    voice.channels    = clip.channels;
+    voice.data        = clip.data;
+    if (clip.codec == CODEC_IMA_ADPCM) {
+        voice.samples = nullptr;
+        voice.adpcm.start(static_cast<const uint8_t *>(clip.data), clip.num_samples);
+    } else {
+        voice.samples = static_cast<const int16_t *>(clip.data);
+    }
+    voice.resample    = (clip.sample_rate != sample_rate_);
+    if (voice.resample) {
+        voice.resampler.start(clip.sample_rate, sample_rate_);
+    }
+    voice.num_samples = frames;
+    voice.pos         = 0;
+    if (clip.loop_count && clip.loop_start < clip.loop_end &&
+        clip.loop_end <= frames) {
+        voice.loop_start = clip.loop_start;
+        voice.loop_end   = clip.loop_end;
+        voice.loops_left = clip.loop_count;
+    } else {
+        voice.loops_left = 0;
+    }
+    voice.gain.set(clip.gain);
+    voice.stopping    = false;
+    voice.tag         = clip.tag;
+}
+
+I2SAudio::VoiceId I2SAudio::startVoice(const ClipRef &clip, bool queued) {
+    if (!clipSupported(clip)) return NO_VOICE;
+
+    // The refill IRQ runs on this core: keep it out while the voice table
+    // and stream state are inspected and updated
+    uint32_t irq_state = save_and_disable_interrupts();
+
+    bool streaming = playing_;
+
+    int slot = -1;
+    for (uint v = 0; v < MAX_VOICES; v++) {
+        if (!voices_[v].active) {
+            slot = (int)v;
+            break;
+        }
+    }
+    if (slot < 0) {
+        restore_interrupts(irq_state);
+        printf("I2S: no free voice\n");
+        return NO_VOICE;
+    }
+
+    Voice &voice = voices_[slot];
+    loadVoice(voice, clip);
+    voice.queued      = queued;
+    voice.announce    = queued;
+    voice.generation++;
+    voice.active      = true;
+    VoiceId id = ((VoiceId)voice.generation << 8) | slot;
+    if (queued) {
+        queue_voice_ = id;
+    }
+
+    // A clip playing straight from flash moves into the mixer, which picks
+    // up the new voice in the same buffer
+    if (streaming && direct_) {
+        leaveDirect();
+    }
+
+    restore_interrupts(irq_state);
+
+    // Idle output: start streaming, without the mixer if nothing needs
+    // mixing or resampling.  Otherwise the voice joins the mix at the next
+    // refill.
+    bool direct = false;
+    if (!streaming) {
+        direct = directAllowed(voice);
+        if (direct) {
+            startDirect(slot);
+        } else {
+            startStream();
+        }
+    }
+
+#if I2S_AUDIO_DEBUG
+    printf("I2S: voice %d playing %lu samples at %lu Hz (%s%s%s%s%s)\n",
+           slot, (unsigned long)clip.num_samples, (unsigned long)clip.sample_rate,
+           clip.codec == CODEC_IMA_ADPCM ? "IMA ADPCM" : "PCM",
+           clip.channels == 2 ? ", stereo" : "",
+           direct ? ", direct" : "",
+           clip.sample_rate != sample_rate_ ? ", resampled" : "",
+           queued ? ", queue" : "");
+#endif
+    return id;
+}
+
+// ---------------------------------------------------------------------------
+// Clip queue
+// ---------------------------------------------------------------------------
+
+bool I2SAudio::enqueue(const int16_t *samples, uint32_t num_samples,
+                       uint32_t sample_rate, uint32_t tag, uint16_t gain,
+                       uint8_t num_channels) {
+    return enqueueClip({CODEC_PCM16, num_channels, samples, num_samples, sample_rate,
+                        0, 0, 0, gain, tag});
+}
+
+bool I2SAudio::enqueueAdpcm(const uint8_t *data, uint32_t num_samples,
+                            uint32_t sample_rate, uint32_t tag, uint16_t gain) {
+    return enqueueClip({CODEC_IMA_ADPCM, 1, data, num_samples, sample_rate,
+                        0, 0, 0, gain, tag});
+}
+
+bool I2SAudio::enqueue(ClipId clip, uint32_t tag, uint16_t gain) {
+    const AudioClip *found = clipById(clip);
+    return found && enqueueClip(clipRef(*found, 0, gain, tag));
+}
+
+bool I2SAudio::enqueueClip(const ClipRef &clip) {
+    if (!clipSupported(clip)) return false;
+
+    // While the queue voice plays, the mixer pops the ring from the IRQ
+    uint32_t irq_state = save_and_disable_interrupts();
+    int slot = voiceSlot(queue_voice_);
+    if (slot >= 0 && !voices_[slot].stopping) {
+        bool ok = queue_count_ < QUEUE_LEN;
+        if (ok) {
+            queue_[(queue_head_ + queue_count_) % QUEUE_LEN] = clip;
+            queue_count_++;
+        }
+        restore_interrupts(irq_state);
+        return ok;
+    }
+    if (slot >= 0) {
+        // Fading out after stop()/fadeOut(): it never chains again, so the
+        // clip starts a new queue alongside it
+        voices_[slot].queued = false;
+        queue_voice_ = NO_VOICE;
+        queue_count_ = 0;
+    }
+    restore_interrupts(irq_state);
+
+    // Queue idle: the clip starts now on a fresh voice
+    return startVoice(clip, true) != NO_VOICE;
+}
+
+void I2SAudio::setClipStartCallback(ClipStartCallback callback, void *ctx) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    clip_start_cb_  = callback;
+    clip_start_ctx_ = ctx;
+    restore_interrupts(irq_state);
+}
+
+I2SAudio::VoiceId I2SAudio::getQueueVoice() const {
+    return voiceSlot(queue_voice_) >= 0 ? queue_voice_ : NO_VOICE;
+}
+
+uint I2SAudio::getQueuedCount() const {
+    return queue_count_;
+}
+
+void I2SAudio::clearQueue() {
+    uint32_t irq_state = save_and_disable_interrupts();
+    queue_count_ = 0;
+    restore_interrupts(irq_state);
+}
+
+int I2SAudio::voiceSlot(VoiceId voice) const {
+    if (voice < 0) return -1;
+    uint slot = (uint)voice & 0xFF;
+    if (slot >= MAX_VOICES) return -1;
+    const Voice &v = voices_[slot];
+    if (!v.active || v.generation != (uint16_t)(voice >> 8)) return -1;
+    return (int)slot;
 }
 
 bool I2SAudio::isPlaying() const {
     return playing_;
 }
 
-void I2SAudio::stop() {
-    if (playing_) {
-        playing_ = false;
-        dma_channel_set_irq0_enabled(dma_channel_, false);
-        dma_channel_abort(dma_channel_);
-        pio_sm_set_enabled(pio_, sm_, false);
-        pio_sm_clear_fifos(pio_, sm_);
+bool I2SAudio::isPlaying(VoiceId voice) const {
+    return voiceSlot(voice) >= 0;
+}
+
+bool I2SAudio::getPosition(VoiceId voice, uint32_t &frame, const void *clip) const {
+    int slot = voiceSlot(voice);
+    if (slot < 0) return false;
+    const Voice &v = voices_[slot];
+    if (clip && v.data != clip) return false;
+    frame = v.pos;
+    if (direct_ && direct_slot_ == (uint)slot) {
+        // The flash transfer is the position; pos jumps ahead to the
+        // handover frame in leaveDirect().  If core0 left direct mode meanwhile
+        // the channel reads a mix buffer: keep pos.
+        uint32_t direct = directFrame();
+        if (direct < v.num_samples) {
+            frame = direct;
+        }
+    }
+    return frame < v.num_samples;
+}
+
+bool I2SAudio::directAllowed(const Voice &voice) const {
+    // Queued clips chain and loops jump inside the mixer
+    return voice.codec == CODEC_PCM16 && !voice.resample && !voice.queued &&
+           voice.loops_left == 0 &&
+           voice.gain.current == GAIN_UNITY && !voice.gain.ramping() &&
+           master_.current == GAIN_UNITY && !master_.ramping();
+}
+
+void I2SAudio::setGain(VoiceId voice, uint16_t gain, uint32_t ramp_ms) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    int slot = voiceSlot(voice);
+    if (slot >= 0 && !voices_[slot].stopping) {
+        voices_[slot].gain.rampTo(gain, msToSamples(ramp_ms));
+        // Direct mode cannot scale: let the mixer apply the new gain
+        if (direct_ && (uint)slot == direct_slot_ && !directAllowed(voices_[slot])) {
+            leaveDirect();
+        }
+    }
+    restore_interrupts(irq_state);
+}
+
+void I2SAudio::setMasterGain(uint16_t gain, uint32_t ramp_ms) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    // Nothing to ramp while the output is idle
+    master_.rampTo(gain, playing_ ? msToSamples(ramp_ms) : 0);
+    if (direct_ && !directAllowed(voices_[direct_slot_])) {
+        leaveDirect();
     }
+    restore_interrupts(irq_state);
+}
+
+void I2SAudio::fadeOut(VoiceId voice, uint32_t ms) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    int slot = voiceSlot(voice);
+    if (slot >= 0) {
+        // The mixer frees the slot in the buffer where the ramp hits 0
+        voices_[slot].gain.rampTo(0, msToSamples(ms));
+        voices_[slot].stopping = true;
+        if (voices_[slot].queued) {
+            // Nothing chains onto a voice on its way out
+            queue_count_ = 0;
+        }
+        if (direct_ && (uint)slot == direct_slot_) {
+            leaveDirect();
+        }
+    }
+    restore_interrupts(irq_state);
+}
+
+void I2SAudio::fadeOut(uint32_t ms) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    for (uint v = 0; v < MAX_VOICES; v++) {
+        if (voices_[v].active) {
+            voices_[v].gain.rampTo(0, msToSamples(ms));
+            voices_[v].stopping = true;
+        }
+    }
+    queue_count_ = 0;
+    if (direct_) {
+        leaveDirect();
+    }
+    restore_interrupts(irq_state);
+}
+
+void I2SAudio::stop(VoiceId voice) {
+    fadeOut(voice, DEFAULT_RAMP_MS);
+}
+
+void I2SAudio::stop() {
+    fadeOut(DEFAULT_RAMP_MS);
 }
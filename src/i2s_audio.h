@@ -4,26 +4,293 @@
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
 #include "hardware/dma.h"
+#include "ima_adpcm.h"
+#include "resampler.h"
+#include "mixer.h"
+#include "asset_pack.h"
 
+// I2S audio output with a small software mixer.
+//
+// Up to MAX_VOICES clips play at once; each DMA refill mixes every
+// active voice (per-voice and master Q15 gain, 32-bit accumulation
+// saturated to 16 bits) into the next buffer.  Clips are mono or
+// interleaved stereo (`wav2cpp.py --stereo`).  Mono is the fast path: a
+// buffer is only mixed and sent as stereo while a stereo clip plays in it;
+// otherwise one 16-bit sample per frame goes out on both channels.  Gain
+// changes, fades and stops are linear ramps, so none of them click.  Clips
+// are raw 16-bit PCM or IMA ADPCM, decoded block by block straight into
+// the mix.  Starting a clip never interrupts the others.
+//
+// The I2S bus runs at one fixed output rate, set once at construction.
+// Clips stored at another rate are converted by a polyphase resampler in
+// the mixer, so clips of any rate mix freely.
+//
+// The PIO program takes one 32-bit word per stereo frame.  There is no
+// separate mono program: mono relies on the RP2040 bus, which replicates a
+// 16-bit DMA write of a sample into both halves of the FIFO word.  A
+// single PCM clip (mono or stereo) at the output rate and unity gain
+// (voice and master) therefore plays in direct mode: one DMA channel reads
+// the flash array into the PIO and the CPU does nothing until the clip
+// ends.  Starting a second voice (or changing a gain, fading or
+// stopping) moves the clip into the mixer at the sample it has reached.
+//
+// In mixer mode two DMA channels chained to each other play the two
+// buffers in turn, so the PIO is fed without a gap: while one buffer plays
+// the IRQ refills the other.  Construct the driver as a static object (the
+// buffers are aligned to their size for the DMA read ring).
 class I2SAudio {
 public:
+    static constexpr uint MAX_VOICES = 4;
+
+    // Handle returned by play(); stays unique after the slot is reused
+    typedef int32_t VoiceId;
+    static constexpr VoiceId NO_VOICE = -1;
+
+    // Q15 gain: 0x8000 = 1.0 (unity), 0 = silent
+    static constexpr uint16_t GAIN_UNITY = 0x8000;
+
+    // Default ramp for gain changes and stops: long enough not to click,
+    // short enough to feel immediate
+    static constexpr uint32_t DEFAULT_RAMP_MS = 5;
+
+    static constexpr uint32_t DEFAULT_OUTPUT_RATE = 44100;
+
     // bclk_pin and lrclk_pin must be consecutive GPIOs (bclk, then bclk+1 = lrclk)
     I2SAudio(uint data_pin, uint bclk_pin, uint lrclk_pin,
+             uint32_t output_rate = DEFAULT_OUTPUT_RATE,
              PIO pio = pio1, uint sm = 0);
     ~I2SAudio();
 
-    // Start playing a mono 16-bit PCM sample array at the given sample rate.
-    // Non-blocking — uses DMA to stream data from flash in small chunks.
-    void play(const int16_t *samples, uint32_t num_samples, uint32_t sample_rate);
+    // Start playing a 16-bit PCM sample array on a free voice.  Stereo clips
+    // (num_channels 2, NAME_NUM_CHANNELS) are interleaved L/R with
+    // num_samples counting both channels, as wav2cpp writes them; they must
+    // be at the output rate.
+    // Non-blocking — streamed from flash by DMA (directly when it is the
+    // only voice at unity gain, otherwise mixed in the refill IRQ).
+    // A clip at another rate than the output is resampled while it mixes.
+    // The clip starts at `gain` as encoded; for a fade-in, start at 0 and
+    // setGain() with the fade time.  Returns NO_VOICE if all voices are
+    // busy.
+    VoiceId play(const int16_t *samples, uint32_t num_samples, uint32_t sample_rate,
+                 uint16_t gain = GAIN_UNITY, uint8_t num_channels = 1);
+
+    // Same for a mono IMA ADPCM clip from `wav2cpp.py --adpcm` (NAME_ADPCM)
+    VoiceId playAdpcm(const uint8_t *data, uint32_t num_samples, uint32_t sample_rate,
+                      uint16_t gain = GAIN_UNITY);
+
+    // Looping: play a clip, jumping back from loop_end to loop_start
+    // `loop_count` times (LOOP_FOREVER: until stopped or endLoop()), then
+    // on to the end of the clip.  The jump happens in the mixer at the
+    // exact sample, so the loop is seamless.  Loop points come from the
+    // NAME_LOOP_START/NAME_LOOP_END constants of `wav2cpp.py --loop`;
+    // invalid points play the clip once.  Loop points count frames.
+    static constexpr uint16_t LOOP_FOREVER = 0xFFFF;
+    VoiceId playLooped(const int16_t *samples, uint32_t num_samples, uint32_t sample_rate,
+                       uint32_t loop_start, uint32_t loop_end,
+                       uint16_t loop_count = LOOP_FOREVER, uint16_t gain = GAIN_UNITY,
+                       uint8_t num_channels = 1);
+    VoiceId playAdpcmLooped(const uint8_t *data, uint32_t num_samples, uint32_t sample_rate,
+                            uint32_t loop_start, uint32_t loop_end,
+                            uint16_t loop_count = LOOP_FOREVER, uint16_t gain = GAIN_UNITY);
+
+    // Let a looping voice finish its current pass and play out the rest
+    // of the clip
+    void endLoop(VoiceId voice);
+
+    // Clips by ID from the generated registry: setClipTable(CLIP_TABLE,
+    // CLIP_COUNT) once (the table must outlive the driver), then each
+    // play is a single indexed load; codec, channels and loop points come
+    // from the clip's descriptor.  Unknown IDs (ClipId::NONE) do not
+    // play: NO_VOICE, or false from enqueue().
+    void setClipTable(const ClipDescriptor *table, uint count);
+    VoiceId play(ClipId clip, uint16_t gain = GAIN_UNITY);
+    VoiceId playLooped(ClipId clip, uint16_t loop_count = LOOP_FOREVER,
+                       uint16_t gain = GAIN_UNITY);
+
+    // Gapless queue: clips added with enqueue() play back to back on one
+    // voice.  When a clip ends the mixer carries on with the next one at
+    // the very next sample, inside the same refill, so there is no gap and
+    // no DMA or PIO restart.  The first clip starts at once if the queue is
+    // idle, or if the queue voice is fading out after stop()/fadeOut(): the
+    // clip then starts a new queue.  Returns false if QUEUE_LEN clips are
+    // already waiting (or no voice is free to start the queue).  `tag` is
+    // handed to the start callback.  Queued clips always go through the
+    // mixer.
+    static constexpr uint QUEUE_LEN = 8;
+    bool enqueue(const int16_t *samples, uint32_t num_samples, uint32_t sample_rate,
+                 uint32_t tag = 0, uint16_t gain = GAIN_UNITY, uint8_t num_channels = 1);
+    bool enqueueAdpcm(const uint8_t *data, uint32_t num_samples, uint32_t sample_rate,
+                      uint32_t tag = 0, uint16_t gain = GAIN_UNITY);
+    bool enqueue(ClipId clip, uint32_t tag = 0, uint16_t gain = GAIN_UNITY);
 
-    // Returns true while audio is still playing
+    // Called with a clip's tag when its first sample is mixed (one or two
+    // buffers before it is heard).  Runs in the refill IRQ on core0: keep
+    // it short, e.g. push an event for the main loop.
+    typedef void (*ClipStartCallback)(uint32_t tag, void *ctx);
+    void setClipStartCallback(ClipStartCallback callback, void *ctx = nullptr);
+
+    // Voice the queue plays on (NO_VOICE while it is idle), and the number
+    // of clips still waiting behind the current one.  Stopping or fading
+    // out the queue voice drops the waiting clips.
+    VoiceId getQueueVoice() const;
+    uint getQueuedCount() const;
+
+    // Drop the waiting clips; the current one plays to its end
+    void clearQueue();
+
+    // The fixed I2S bus rate, the rate the PIO divider actually produces
+    // from clk_sys, and the difference in parts per million
+    uint32_t getOutputRate() const { return sample_rate_; }
+    float getAchievedRate() const;
+    float getRateErrorPpm() const;
+
+    // Audio clock profile.  Searches every sys PLL setting between min_khz
+    // and max_khz for the one whose I2S dividers come closest to all of
+    // `rates`, and switches clk_sys (and clk_peri) to it.  Call first thing
+    // in main(), before stdio and the other clocked peripherals are set up.
+    // Returns the new clk_sys in Hz, or 0 if no setting is in range.
+    static uint32_t selectAudioSysClock(const uint32_t *rates, uint num_rates,
+                                        uint32_t min_khz = 100000,
+                                        uint32_t max_khz = 133000);
+
+    // Returns true while any voice is still playing
     bool isPlaying() const;
 
-    // Stop playback immediately
+    // Returns true while this voice is still playing
+    bool isPlaying(VoiceId voice) const;
+
+    // Frame of its clip the voice is playing (as mixed or streamed, a
+    // buffer ahead of the speaker), for effects that follow the audio.
+    // False once the voice has stopped or, with `clip` set, has moved on
+    // to another clip (the queue voice).  Lock-free: safe to poll from
+    // core1, at worst one refill stale.
+    bool getPosition(VoiceId voice, uint32_t &frame, const void *clip = nullptr) const;
+
+    // Ramp a playing voice's gain to `gain` over `ramp_ms`
+    void setGain(VoiceId voice, uint16_t gain, uint32_t ramp_ms = DEFAULT_RAMP_MS);
+
+    // Master gain, applied on top of every voice, ramped the same way
+    void setMasterGain(uint16_t gain, uint32_t ramp_ms = DEFAULT_RAMP_MS);
+    uint16_t getMasterGain() const { return (uint16_t)master_.target; }
+
+    // Fade one voice (or every voice) to silence over `ms`, then stop it
+    void fadeOut(VoiceId voice, uint32_t ms);
+    void fadeOut(uint32_t ms);
+
+    // Stop one voice with a short fade; the others keep playing
+    void stop(VoiceId voice);
+
+    // Stop all playback with a short fade
     void stop();
 
+    // Worst-case refill IRQ time since the last reset, and the time one
+    // buffer takes to play (the hard deadline), both in sys clock cycles
+    uint32_t getMaxIrqCycles() const { return irq_cycles_max_; }
+    uint32_t getBufferCycles() const;
+    void resetIrqStats() { irq_cycles_max_ = 0; }
+
+    // Buffers that started playing before the IRQ had refilled them
+    // (stale audio went out), counted since boot
+    uint32_t getUnderruns() const { return underruns_; }
+
 private:
-    static constexpr uint32_t BUF_SAMPLES = 256;
+    static constexpr uint32_t BUF_SAMPLES = 256;   // frames per buffer
+
+    // Leaving direct mode, the mixer takes over this far ahead of the
+    // flash transfer: time for the IRQ to mix the first buffer while it
+    // plays on
+    static constexpr uint32_t DIRECT_HANDOVER_FRAMES = BUF_SAMPLES / 2;
+
+    // DMA read ring: each channel wraps back to the start of its buffer
+    // after the last word, so a chained restart needs no re-arming.  A
+    // buffer holds BUF_SAMPLES mono samples or, twice the size, stereo
+    // frames.
+    static constexpr uint BUF_RING_BITS_MONO = 9;
+    static constexpr uint BUF_RING_BITS_STEREO = 10;
+    static constexpr uint32_t BUF_BYTES = BUF_SAMPLES * 2 * sizeof(int16_t);
+    static_assert((1u << BUF_RING_BITS_MONO) == BUF_SAMPLES * sizeof(int16_t) &&
+                  (1u << BUF_RING_BITS_STEREO) == BUF_BYTES,
+                  "DMA ring sizes must match the buffer sizes");
+
+    enum Codec : uint8_t {
+        CODEC_PCM16,
+        CODEC_IMA_ADPCM,
+    };
+
+    // Linear Q15 gain ramp, advanced once per buffer by the mixer
+    struct GainRamp {
+        int32_t current;    // gain at the start of the next buffer
+        int32_t target;
+        uint32_t left;      // samples until `target` is reached
+
+        void set(int32_t gain) { current = target = gain; left = 0; }
+        void rampTo(int32_t gain, uint32_t samples) {
+            target = gain;
+            left = samples;
+            if (samples == 0) current = gain;
+        }
+        // Move `n` samples along the ramp and return the new gain
+        int32_t advance(uint32_t n) {
+            if (left <= n) {
+                current = target;
+                left = 0;
+            } else {
+                // |target - current| <= 0xFFFF, n <= BUF_SAMPLES: no overflow
+                current += (target - current) * (int32_t)n / (int32_t)left;
+                left -= n;
+            }
+            return current;
+        }
+        bool ramping() const { return current != target; }
+    };
+
+    // A clip as handed to play() or enqueue()
+    struct ClipRef {
+        Codec codec;
+        uint8_t channels;
+        const void *data;
+        uint32_t num_samples;   // both channels for stereo
+        uint32_t sample_rate;
+        uint32_t loop_start;
+        uint32_t loop_end;
+        uint16_t loop_count;    // 0: no loop
+        uint16_t gain;
+        uint32_t tag;
+    };
+
+    struct Voice {
+        Codec codec;
+        uint8_t channels;         // 2: interleaved stereo (PCM at the output rate)
+        const void *data;         // the clip as played (getPosition())
+        const int16_t *samples;   // CODEC_PCM16
+        ImaAdpcmDecoder adpcm;    // CODEC_IMA_ADPCM
+        Resampler resampler;      // used when `resample` is set
+        bool resample;            // clip rate != output rate
+        uint32_t num_samples;     // frames
+        uint32_t pos;
+        uint32_t loop_start;
+        uint32_t loop_end;
+        uint16_t loops_left;  // jumps back still to make (LOOP_FOREVER: no limit)
+        GainRamp gain;        // Q15
+        bool stopping;        // free the slot once `gain` reaches 0
+        bool queued;          // plays the clip queue: chain to the next clip
+        bool announce;        // call the start callback with `tag` when mixed
+        uint32_t tag;
+        uint16_t generation;  // bumped on every play() into this slot
+        bool active;
+
+        // Where the current pass ends: the loop end while jumps remain
+        uint32_t end() const { return loops_left ? loop_end : num_samples; }
+
+        // At end(): jump back to the loop start if a pass is left
+        bool loopBack() {
+            if (loops_left == 0) return false;
+            if (loops_left != LOOP_FOREVER) loops_left--;
+            pos = loop_start;
+            if (codec == CODEC_IMA_ADPCM) adpcm.seek(loop_start);
+            return true;
+        }
+    };
 
     PIO pio_;
     uint sm_;
@@ -32,21 +299,82 @@ private:
     uint lrclk_pin_;
     uint pio_offset_;
 
-    int dma_channel_;
-    volatile bool playing_;
+    int dma_chan_a_;            // plays buf_a_, then triggers dma_chan_b_
+    int dma_chan_b_;            // plays buf_b_, then triggers dma_chan_a_
+    volatile bool playing_;     // DMA stream running
+    bool direct_;               // dma_chan_a_ reads direct_slot_'s clip from flash
+    uint direct_slot_;
+    bool leaving_direct_;       // the transfer ends at the handover, chained to B
+    bool handover_mix_;         // buf_b_ still to be mixed for the handover
+    bool stream_ending_;        // last refill was silence
+    bool stereo_a_;             // buf_a_ is configured for stereo frames
+    bool stereo_b_;
+    uint32_t sample_rate_;      // fixed output rate the PIO runs at
+    uint32_t clkdiv_;           // PIO clock divider, 16.8 fixed point
+
+    // Ping-pong buffers for DMA streaming: mono samples (sent on both
+    // channels) or interleaved stereo frames, decided per refill
+    alignas(BUF_BYTES) int16_t buf_a_[BUF_SAMPLES * 2];
+    alignas(BUF_BYTES) int16_t buf_b_[BUF_SAMPLES * 2];
+
+    // Mixer state (flash-resident sources)
+    Voice voices_[MAX_VOICES];
+    GainRamp master_;
+    int32_t mix_[BUF_SAMPLES];
+    int32_t mix_stereo_[BUF_SAMPLES * 2];   // stereo voices, used when one plays
+    int16_t voice_buf_[BUF_SAMPLES];   // decoded/resampled voice, before gain
 
-    // Double buffers for DMA streaming (mono→stereo, 32-bit per frame)
-    uint32_t buf_a_[BUF_SAMPLES];
-    uint32_t buf_b_[BUF_SAMPLES];
-    bool next_is_a_;
+    // Clip queue: a ring filled by enqueue() and drained by the mixer, both
+    // on core0 (enqueue() masks the IRQ)
+    ClipRef queue_[QUEUE_LEN];
+    uint queue_head_;           // next clip to play
+    volatile uint queue_count_;
+    VoiceId queue_voice_;
+    ClipStartCallback clip_start_cb_;
+    void *clip_start_ctx_;
 
-    // Source audio tracking (flash-resident)
-    const int16_t *src_samples_;
-    uint32_t src_num_samples_;
-    volatile uint32_t src_pos_;
+    // Generated clip registry for play(ClipId), read-only in flash
+    const ClipDescriptor *clip_table_;
+    uint clip_count_;
+
+    volatile uint32_t irq_cycles_max_;
+    volatile uint32_t underruns_;
 
     void initPio(uint32_t sample_rate);
-    uint32_t fillBuffer(uint32_t *buf);
+
+    // Nearest 16.8 divider for `rate` from a clock of clk_num/clk_den Hz,
+    // and the error it leaves in parts per billion
+    static uint32_t bestDivider(uint64_t clk_num, uint32_t clk_den, uint32_t rate);
+    static int64_t rateErrorPpb(uint64_t clk_num, uint32_t clk_den, uint32_t rate,
+                                uint32_t clkdiv);
+    void configureChannel(uint chan, int16_t *buf, uint chain_to, bool stereo);
+    void restartChannel(uint chan, int16_t *buf, uint other, bool stereo);
+    void startStream();
+    void runStream();
+    void startDirect(uint slot);
+    uint32_t directFrame() const;
+    void leaveDirect();
+    void handover();
+    void stopStream();
+    void refill(uint chan, int16_t *buf, uint other, bool &stereo);
+    static ClipRef clipRef(const AudioClip &clip, uint16_t loop_count, uint16_t gain,
+                           uint32_t tag);
+    const AudioClip *clipById(ClipId clip) const;
+    bool clipSupported(const ClipRef &clip) const;
+    VoiceId startVoice(const ClipRef &clip, bool queued);
+    void loadVoice(Voice &voice, const ClipRef &clip);
+    bool enqueueClip(const ClipRef &clip);
+    uint32_t fillBuffer(int16_t *buf, bool &stereo);
+    uint32_t renderVoice(Voice &voice, uint32_t count, const int16_t *&src,
+                         bool &finished);
+
+    // Slot of a live handle, or -1 if it has finished or been reused
+    int voiceSlot(VoiceId voice) const;
+
+    uint32_t msToSamples(uint32_t ms) const {
+        return (uint32_t)((uint64_t)ms * sample_rate_ / 1000);
+    }
+    bool directAllowed(const Voice &voice) const;
 
     static I2SAudio *instance_;
     static void dmaIrqHandler();
@@ -0,0 +1,92 @@
+#include "ima_adpcm.h"
+
+static const uint16_t STEP_TABLE[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t INDEX_TABLE[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+void ImaAdpcmDecoder::start(const uint8_t *data, uint32_t num_samples) {
+    data_        = data;
+    num_samples_ = num_samples;
+    block_       = data;
+    block_pos_   = 0;
+    remaining_   = num_samples;
+    predictor_   = 0;
+    step_index_  = 0;
+}
+
+template<typename Sink>
+uint32_t ImaAdpcmDecoder::run(uint32_t count, Sink &&sink) {
+    if (count > remaining_) count = remaining_;
+
+    // Locals so the inner loop stays in registers
+    const uint8_t *block = block_;
+    uint32_t pos   = block_pos_;
+    int32_t pred   = predictor_;
+    int32_t index  = step_index_;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (pos == BLOCK_SAMPLES) {
+            block += BLOCK_BYTES;
+            pos = 0;
+        }
+        if (pos == 0) {
+            // Block header: the first sample is stored as-is
+            pred  = (int16_t)(block[0] | (block[1] << 8));
+            index = block[2] > 88 ? 88 : block[2];
+        } else {
+            uint32_t n = pos - 1;
+            uint8_t byte = block[4 + (n >> 1)];
+            uint32_t nibble = (n & 1) ? (byte >> 4) : (byte & 0x0F);
+
+            int32_t step = STEP_TABLE[index];
+            int32_t diff = step >> 3;
+            if (nibble & 4) diff += step;
+            if (nibble & 2) diff += step >> 1;
+            if (nibble & 1) diff += step >> 2;
+            pred = (nibble & 8) ? pred - diff : pred + diff;
+            if (pred > INT16_MAX) pred = INT16_MAX;
+            if (pred < INT16_MIN) pred = INT16_MIN;
+
+            index += INDEX_TABLE[nibble & 7];
+            if (index < 0) index = 0;
+            if (index > 88) index = 88;
+        }
+        pos++;
+        sink(i, pred);
+    }
+
+    block_      = block;
+    block_pos_  = pos;
+    predictor_  = pred;
+    step_index_ = index;
+    remaining_ -= count;
+    return count;
+}
+
+uint32_t ImaAdpcmDecoder::decode(int16_t *out, uint32_t count) {
+    return run(count, [out](uint32_t i, int32_t sample) {
+        out[i] = (int16_t)sample;
+    });
+}
+
+bool ImaAdpcmDecoder::next(int16_t &sample) {
+    return run(1, [&sample](uint32_t, int32_t s) {
+        sample = (int16_t)s;
+    }) == 1;
+}
+
+void ImaAdpcmDecoder::seek(uint32_t sample) {
+    if (sample > num_samples_) sample = num_samples_;
+    uint32_t block = sample / BLOCK_SAMPLES;
+    block_     = data_ + block * BLOCK_BYTES;
+    block_pos_ = 0;
+    remaining_ = num_samples_ - block * BLOCK_SAMPLES;
+    run(sample - block * BLOCK_SAMPLES, [](uint32_t, int32_t) {});
+}
@@ -0,0 +1,55 @@
+#ifndef IMA_ADPCM_H
+#define IMA_ADPCM_H
+
+#include "pico/stdlib.h"
+
+// ---------------------------------------------------------------------------
+// Streaming IMA ADPCM decoder (mono, 4 bits/sample) for clips produced by
+// `wav2cpp.py --adpcm`.
+//
+// Data is a run of fixed 256-byte blocks, each self-contained: a 4-byte
+// header (int16 first sample, uint8 step index, uint8 reserved) followed by
+// 252 bytes of nibbles, low nibble first -- 505 samples per block.  The last
+// block may be short.
+//
+// The decoder keeps its position across calls, so the refill IRQ can decode
+// one DMA buffer's worth at a time.
+// ---------------------------------------------------------------------------
+class ImaAdpcmDecoder {
+public:
+    static constexpr uint32_t BLOCK_BYTES = 256;
+    static constexpr uint32_t BLOCK_SAMPLES = 1 + (BLOCK_BYTES - 4) * 2;
+
+    // Rewind to the start of `data` (num_samples decoded samples long)
+    void start(const uint8_t *data, uint32_t num_samples);
+
+    // Continue from decoded sample `sample`.  Blocks are self-contained, so
+    // this decodes from the header of the block holding it: at most
+    // BLOCK_SAMPLES - 1 samples of work.
+    void seek(uint32_t sample);
+
+    // Samples not yet decoded
+    uint32_t remaining() const { return remaining_; }
+
+    // Decode up to `count` samples into `out`.  Returns the number of
+    // samples produced.
+    uint32_t decode(int16_t *out, uint32_t count);
+
+    // Decode a single sample (for the resampler); false at the end
+    bool next(int16_t &sample);
+
+private:
+    const uint8_t *data_;       // first block
+    uint32_t num_samples_;
+    const uint8_t *block_;      // current block
+    uint32_t block_pos_;        // next sample within the block
+    uint32_t remaining_;
+    int32_t predictor_;
+    int32_t step_index_;
+
+    // Shared decode loop; `sink(i, sample)` receives each sample
+    template<typename Sink>
+    uint32_t run(uint32_t count, Sink &&sink);
+};
+
+#endif // IMA_ADPCM_H
@@ -0,0 +1,88 @@
+#include "led_show.h"
+
+static const StaticPatternAnimation::PixelColor YELLOW = {122, 136, 0};
+
+// Phase 5: Stable state – two yellow, two red
+static const StaticPatternAnimation::PixelColor STABLE_COLORS[LedShow::NUM_PIXELS] = {
+    YELLOW,                  // LED 0: Yellow
+    YELLOW,                  // LED 1: Yellow
+    {LedShow::RED, 0, 0},    // LED 2: Red
+    {LedShow::RED, 0, 0},    // LED 3: Red
+};
+
+LedShow::LedShow(NeoPixel &strip)
+    : strip_(strip),
+      // Phase 1: Rainbow cycle on all LEDs in unison (~5 s)
+      //          Gives the illusion of a massive computer starting up.
+      rainbow_cycle_(5000, 20, 136),
+      // Phase 2: Rainbow chase across all LEDs (~3 s)
+      rainbow_chase_(3000, 30, 136),
+      // Phase 3: All LEDs turn red for 5 s
+      solid_red_(RED, 0, 0, 5000),
+      // Phase 4: Flicker effect (~1 s), then LEDs off for 1 s
+      flicker_(RED, 0, 0, 1000, 1000, 80),
+      stable_pattern_(STABLE_COLORS, NUM_PIXELS),
+      // Audio pulse on the eyes (LEDs 0-1)
+      eyes_pulse_(0, 2, PULSE_FLOOR),
+      green_eyes_(false) {
+
+    sequencer_.addAnimation(&rainbow_cycle_);
+    sequencer_.addAnimation(&rainbow_chase_);
+    sequencer_.addAnimation(&solid_red_);
+    sequencer_.addAnimation(&flicker_);
+    sequencer_.addAnimation(&stable_pattern_);
+}
+
+void LedShow::start(const FrameInfo &frame) {
+    green_eyes_ = false;
+    sequencer_.start(strip_, frame);
+}
+
+void LedShow::handleCommand(LedCommand cmd, const FrameInfo &frame) {
+    if (cmd == LedCommand::GREEN_EYES_ON) {
+        green_eyes_ = true;
+        // Eyes (LEDs 0-1) go green; sensors (LEDs 2-3) stay red
+        strip_.setPixelColor(0, NEON_GREEN_R, NEON_GREEN_G, NEON_GREEN_B);
+        strip_.setPixelColor(1, NEON_GREEN_R, NEON_GREEN_G, NEON_GREEN_B);
+        strip_.setPixelColor(2, RED, 0, 0);
+        strip_.setPixelColor(3, RED, 0, 0);
+        eyes_pulse_.setColor(NEON_GREEN_R, NEON_GREEN_G, NEON_GREEN_B);
+    } else if (cmd == LedCommand::GREEN_EYES_OFF && green_eyes_) {
+        green_eyes_ = false;
+        eyes_pulse_.setColor(YELLOW.r, YELLOW.g, YELLOW.b);
+        // Restore the stable-state pattern
+        stable_pattern_.start(strip_, frame);
+        stable_pattern_.update(strip_, frame);
+    }
+}
+
+void LedShow::followAudio(const ClipEnvelope &envelope, uint32_t sample_rate,
+                          AudioEnvelopeAnimation::PositionSource source, void *ctx,
+                          const FrameInfo &frame) {
+    if (!inSteadyState()) return;
+    if (green_eyes_) {
+        eyes_pulse_.setColor(NEON_GREEN_R, NEON_GREEN_G, NEON_GREEN_B);
+    } else {
+        eyes_pulse_.setColor(YELLOW.r, YELLOW.g, YELLOW.b);
+    }
+    eyes_pulse_.setClip(envelope, sample_rate, source, ctx);
+    eyes_pulse_.start(strip_, frame);
+}
+
+void LedShow::update(const FrameInfo &frame) {
+    if (!green_eyes_) {
+        sequencer_.update(strip_, frame);
+    }
+    // Drawn over the eyes of whatever is showing
+    eyes_pulse_.update(strip_, frame);
+}
+
+bool LedShow::inSteadyState() const {
+    return sequencer_.getCurrentIndex() >= sequencer_.getCount() - 1;
+}
+
+absolute_time_t LedShow::nextUpdateTime(const FrameInfo &frame) const {
+    absolute_time_t next = green_eyes_ ? at_the_end_of_time
+                                       : sequencer_.nextUpdateTime(frame);
+    return absolute_time_min(next, eyes_pulse_.nextUpdateTime(frame));
+}
@@ -0,0 +1,85 @@
+#ifndef LED_SHOW_H
+#define LED_SHOW_H
+
+#include "neopixel.h"
+#include "animation.h"
+#include "frame_clock.h"
+
+// Commands from the control side (core0) to the LED show
+enum class LedCommand : uint8_t {
+    GREEN_EYES_ON,   // eyes neon green, sensors red
+    GREEN_EYES_OFF,  // back to the stable pattern
+};
+
+// Events from the LED show back to the control side
+enum class LedEvent : uint8_t {
+    STEADY_STATE,    // boot sequence done, stable pattern showing
+};
+
+// ---------------------------------------------------------------------------
+// The Gundam head's light show: boot-up sequence, stable pattern, the
+// green-eyes override and eyes that pulse with the audio.  Layout: LEDs
+// 0-1 are the eyes, 2-3 the sensors.
+//
+// Free of hardware and clock calls, so the same show runs on core1 and in
+// the host simulator (host/).  Colour values are gamma-encoded for
+// GAMMA_2_2 and were chosen so the steady-state output matches the original
+// linear settings.
+// ---------------------------------------------------------------------------
+class LedShow {
+public:
+    static const uint NUM_PIXELS = 4;
+
+    // Neon green (Gundam sensor / camera green) and the base red
+    static const uint8_t NEON_GREEN_R = 70;
+    static const uint8_t NEON_GREEN_G = 229;
+    static const uint8_t NEON_GREEN_B = 41;
+    static const uint8_t RED          = 136;
+
+    // Audio pulse brightness in silence (of 255)
+    static const uint8_t PULSE_FLOOR  = 64;
+
+    explicit LedShow(NeoPixel &strip);
+
+    // Start the boot sequence
+    void start(const FrameInfo &frame);
+
+    // Apply a command from the control side
+    void handleCommand(LedCommand cmd, const FrameInfo &frame);
+
+    // Render this tick into the strip (the caller calls show())
+    void update(const FrameInfo &frame);
+
+    // Boot sequence finished, stable pattern running
+    bool inSteadyState() const;
+
+    bool greenEyesActive() const { return green_eyes_; }
+
+    // Pulse the eyes with a clip that is playing, in their current colour
+    // (green or stable yellow), until `source` reports it stopped.  Replaces
+    // any pulse still running; ignored before steady state.
+    void followAudio(const ClipEnvelope &envelope, uint32_t sample_rate,
+                     AudioEnvelopeAnimation::PositionSource source, void *ctx,
+                     const FrameInfo &frame);
+
+    bool eyesPulsing() const { return !eyes_pulse_.isComplete(); }
+
+    // Earliest deadline for the next update(); green eyes hold until the
+    // next command, a pulse needs every tick
+    absolute_time_t nextUpdateTime(const FrameInfo &frame) const;
+
+private:
+    NeoPixel &strip_;
+
+    RainbowCycleAnimation rainbow_cycle_;
+    RainbowChaseAnimation rainbow_chase_;
+    SolidColorAnimation solid_red_;
+    FlickerAnimation flicker_;
+    StaticPatternAnimation stable_pattern_;
+    AnimationSequencer sequencer_;
+    AudioEnvelopeAnimation eyes_pulse_;
+
+    bool green_eyes_;
+};
+
+#endif // LED_SHOW_H
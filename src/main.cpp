@@ -1,124 +1,219 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "pico/stdlib.h"
+#include "pico/multicore.h"
 #include "neopixel.h"
-#include "animation.h"
+#include "frame_clock.h"
+#include "led_show.h"
+#include "green_eyes.h"
+#include "core_load.h"
+#include "spsc_queue.h"
 #include "i2s_audio.h"
-#include "clip_03.h"
-#include "clip_05.h"
+#include "clips_pack.h"
 
 // Configuration
 #define NEOPIXEL_PIN 26  // QT Py RP2040 NeoPixel BFF typically uses GPIO 12
-#define NUM_PIXELS 4
+#define NUM_PIXELS LedShow::NUM_PIXELS
+// LED_FPS, the frame clock rate for all LED rendering, comes from
+// CMakeLists.txt, which builds the clip envelopes at the same rate
+#define LOAD_REPORT_MS 10000  // how often core loads are printed
+#define AUDIO_RATE 44100      // fixed I2S bus rate; clips are stored at this rate
+#define AUDIO_CLOCK_PROFILE 1 // pick clk_sys for an exact AUDIO_RATE (0: SDK default)
+#define AMBIENCE_LOOP 0       // 1: loop the radar ambience under the show until power-off
+#define AMBIENCE_GAIN 0x2000  // ambience loop level, Q15 (0.25)
 
 // I2S Amplifier BFF pin assignments
 #define I2S_DATA_PIN  29  // A0 — DIN
 #define I2S_BCLK_PIN  27  // A2 — BCLK
 #define I2S_LRCLK_PIN 28  // A1 — LRCLK
 
-int main()
+// Show clips, by name in the asset pack (gundam_add_audio_assets in
+// CMakeLists.txt).  The names resolve to ClipIds at compile time.
+constexpr ClipId AMBIENCE_CLIP = findClip("clip_02");  // radar (AMBIENCE_LOOP)
+constexpr ClipId EYES_CLIP     = findClip("clip_03");  // green eyes on
+constexpr ClipId THEME_CLIP    = findClip("clip_05");  // once, at steady state
+static_assert(AMBIENCE_CLIP != ClipId::NONE && EYES_CLIP != ClipId::NONE &&
+              THEME_CLIP != ClipId::NONE,
+              "show clip missing from the asset pack");
+static_assert(CLIP_TABLE[(uint)EYES_CLIP].envelope.count &&
+              CLIP_TABLE[(uint)THEME_CLIP].envelope.count,
+              "the eyes follow clip_03 and clip_05: they need --envelope");
+static_assert(CLIP_TABLE[(uint)EYES_CLIP].envelope.rate == LED_FPS &&
+              CLIP_TABLE[(uint)THEME_CLIP].envelope.rate == LED_FPS,
+              "clip envelopes must match the LED frame rate");
+
+// ── Inter-core messages ─────────────────────────────────────────────
+//  Core0 (audio + control) tells core1 (LED rendering) what to show;
+//  core1 reports back when the boot sequence has finished.
+static SpscQueue<LedCommand, 8> ledCommands;  // core0 -> core1
+static SpscQueue<LedEvent, 8>   ledEvents;    // core1 -> core0
+
+// ── Audio-synced eyes ───────────────────────────────────────────────
+//  Core0 posts the voice and clip the eyes should follow, by value; core1
+//  keeps its own copy and polls the voice's position once per frame,
+//  looking the level up in the clip's envelope.  Nothing core1 reads is
+//  rewritten by core0.
+struct AudioFollow {
+    I2SAudio *audio;
+    I2SAudio::VoiceId voice;
+    const ClipDescriptor *clip;
+};
+static SpscQueue<AudioFollow, 4> audioFollows;     // core0 -> core1
+
+static bool audio_follow_position(void *ctx, uint32_t &frame) {
+    const AudioFollow *follow = static_cast<const AudioFollow *>(ctx);
+    return follow->audio->getPosition(follow->voice, frame, follow->clip->clip.data);
+}
+
+// Have core1 pulse the eyes with a voice playing `clip`
+static void follow_audio(I2SAudio &audio, I2SAudio::VoiceId voice, ClipId clip) {
+    if (voice == I2SAudio::NO_VOICE) return;
+    audioFollows.push({&audio, voice, &CLIP_TABLE[(uint)clip]});
+}
+
+static bool led_command_pending(void *) {
+    return !ledCommands.empty() || !audioFollows.empty();
+}
+static bool core0_event_pending(void *) {
+    return !ledEvents.empty();
+}
+
+// ── Core1: LED rendering ────────────────────────────────────────────
+//  Owns the strip, the light show and the frame clock, so nothing on
+//  core0 (clip starts, printf, audio IRQs) can delay a frame.  Objects are
+//  static: core1's stack is small.
+static void core1_main()
 {
-    stdio_init_all();
+    // Initialize NeoPixel driver (this hardware's LEDs take RGB wire order)
+    static NeoPixelStrip<ColorOrder::RGB> strip(NEOPIXEL_PIN, NUM_PIXELS);
 
-    printf("Gundam LED Controller - 4 Pixels\n");
+    // Perceptual output: the show's colour values are gamma-encoded, so
+    // fades and low levels step evenly
+    strip.setGamma(GAMMA_2_2);
+
+    // Latch alarms fire on this core rather than core0's default pool
+    strip.setAlarmPool(alarm_pool_create_with_unused_hardware_alarm(4));
+
+    // Boot-up sequence, stable pattern and green eyes (led_show.cpp)
+    static LedShow show(strip);
 
-    // Initialize NeoPixel driver
-    NeoPixel strip(NEOPIXEL_PIN, NUM_PIXELS);
+    // Central frame clock: one time read, one render and one show per tick
+    FrameClock frameClock(LED_FPS);
+    frameClock.start();
+    show.start(frameClock.frame());
 
-    // Initialize I2S audio driver
-    I2SAudio audio(I2S_DATA_PIN, I2S_BCLK_PIN, I2S_LRCLK_PIN);
+    bool steadyReported = false;
 
-    // ── Boot-up animation sequence ──────────────────────────────────
+    //  Tickless: sleep until the show's next step, or until core0 posts a
+    //  command (handled on the next frame tick).
+    absolute_time_t wakeTime = frameClock.nextTickTime();
+    while (true) {
+        const FrameInfo &frame = frameClock.waitForTick(wakeTime, led_command_pending);
+
+        LedCommand cmd;
+        while (ledCommands.pop(cmd)) {
+            show.handleCommand(cmd, frame);
+        }
+        // The show runs one pulse at a time: a new one replaces the
+        // current pulse, so one copy is all it ever reads
+        static AudioFollow follow;
+        while (audioFollows.pop(follow)) {
+            show.followAudio(follow.clip->envelope, follow.clip->clip.sample_rate,
+                             audio_follow_position, &follow, frame);
+        }
+        show.update(frame);
 
-    // Phase 1: Rainbow cycle on all LEDs in unison (~5 s)
-    //          Gives the illusion of a massive computer starting up.
-    RainbowCycleAnimation rainbowCycle(5000, 20, 64);
+        // Tell core0 once boot-up is finished (stable pattern running)
+        if (!steadyReported && show.inSteadyState()) {
+            steadyReported = ledEvents.push(LedEvent::STEADY_STATE);
+        }
 
-    // Phase 2: Rainbow chase across all LEDs (~3 s)
-    RainbowChaseAnimation rainbowChase(3000, 30, 64);
+        // Push this tick's frame to the LEDs (DMA, non-blocking)
+        strip.show();
 
-    // Phase 3: All LEDs turn red for 5 s
-    SolidColorAnimation solidRed(0, 64, 0, 5000);
+        wakeTime = show.nextUpdateTime(frame);
+    }
+}
 
-    // Phase 4: Flicker effect (~1 s), then LEDs off for 1 s
-    FlickerAnimation flicker(0, 64, 0, 1000, 1000, 80);
+int main()
+{
+#if AUDIO_CLOCK_PROFILE
+    // Before anything clocked from clk_sys/clk_peri (stdio, PIO) is set up
+    static const uint32_t audioRates[] = { AUDIO_RATE };
+    I2SAudio::selectAudioSysClock(audioRates, 1);
+#endif
 
-    // Phase 5: Stable state – two yellow, two red
-    StaticPatternAnimation::PixelColor stableColors[NUM_PIXELS] = {
-        {64, 50, 0},  // LED 0: Yellow
-        {64, 50, 0},  // LED 1: Yellow
-        {0,  64, 0},  // LED 2: Red
-        {0,  64, 0},  // LED 3: Red
-    };
-    StaticPatternAnimation stablePattern(stableColors, NUM_PIXELS);
+    stdio_init_all();
 
-    // Assemble and start the sequence
-    AnimationSequencer sequencer;
-    sequencer.addAnimation(&rainbowCycle);
-    sequencer.addAnimation(&rainbowChase);
-    sequencer.addAnimation(&solidRed);
-    sequencer.addAnimation(&flicker);
-    sequencer.addAnimation(&stablePattern);
+    printf("Gundam LED Controller - 4 Pixels\n");
 
-    sequencer.start(strip);
+    // Initialize I2S audio driver (its DMA IRQ is serviced on core0).
+    // Static: the DMA buffers are size-aligned and too big for the stack.
+    static I2SAudio audio(I2S_DATA_PIN, I2S_BCLK_PIN, I2S_LRCLK_PIN, AUDIO_RATE);
+    audio.setClipTable(CLIP_TABLE, CLIP_COUNT);
 
-    // ── Random green-eyes configuration ─────────────────────────────
-    //  Neon green (Gundam sensor / camera green)
-    //  NOTE: R/G are swapped on this hardware (RGB wire order, not GRB)
-    const uint8_t NEON_GREEN_R = 200;
-    const uint8_t NEON_GREEN_G = 15;
-    const uint8_t NEON_GREEN_B = 5;
-    const uint32_t GREEN_EYES_DURATION_MS = 10000;  // 10 s
+    // Hand all LED work to core1
+    multicore_launch_core1(core1_main);
 
     // Seed PRNG from hardware timer so every boot is different
     srand(to_ms_since_boot(get_absolute_time()));
 
-    bool   greenEyesActive    = false;
-    uint32_t greenEyesStart   = 0;
-    bool   audioPlayed        = false;  // Track if clip_05 has been triggered
-    // First possible trigger 20-60 s after boot
-    uint32_t nextGreenEyesTime = to_ms_since_boot(get_absolute_time())
-                                 + 20000 + (rand() % 40000);
+    // Random green eyes: 10 s holds, 20-60 s apart, first 20-60 s after boot
+    GreenEyesScheduler greenEyes;
+    greenEyes.start(get_absolute_time());
 
-    // ── Main loop ───────────────────────────────────────────────────
-    while (true) {
-        uint32_t now = to_ms_since_boot(get_absolute_time());
-
-        if (greenEyesActive) {
-            // Hold neon green until the duration elapses
-            if (now - greenEyesStart >= GREEN_EYES_DURATION_MS) {
-                greenEyesActive = false;
-                // Restore the stable-state pattern
-                stablePattern.start(strip);
-                stablePattern.update(strip);
-                // Schedule the next random trigger (20-60 s from now)
-                nextGreenEyesTime = now + 20000 + (rand() % 40000);
-            }
-        } else {
-            sequencer.update(strip);
+    bool steadyState = false;   // core1 finished the boot sequence
+    absolute_time_t nextLoadReport = make_timeout_time_ms(LOAD_REPORT_MS);
 
-            // Only trigger once boot-up is finished (stable pattern running)
-            bool inStableState = sequencer.getCurrentIndex()
-                                 >= sequencer.getCount() - 1;
-
-            // Play clip_05 once when entering steady state
-            if (inStableState && !audioPlayed) {
-                audio.play(CLIP_05_SAMPLES, CLIP_05_NUM_SAMPLES, CLIP_05_SAMPLE_RATE);
-                audioPlayed = true;
+    // ── Control loop (core0) ────────────────────────────────────────
+    //  Tickless like the LED loop: sleep until the next green-eyes edge
+    //  or load report, or until core1 posts an event.
+    while (true) {
+        absolute_time_t wakeTime = absolute_time_min(nextLoadReport,
+                                                     greenEyes.nextDeadline());
+        CoreLoad::idleUntil(wakeTime, core0_event_pending);
+
+        LedEvent event;
+        while (ledEvents.pop(event)) {
+            // Play the clip_05 theme once when entering steady state; the
+            // eyes pulse with it
+            if (event == LedEvent::STEADY_STATE && !steadyState) {
+                steadyState = true;
+                greenEyes.setSteadyState(true);
+                follow_audio(audio, audio.play(THEME_CLIP), THEME_CLIP);
+
+#if AMBIENCE_LOOP
+                // Radar ambience underneath, looping in the mixer until
+                // power-off.  Off by default: it keeps the mixer busy for
+                // good, so clips never play in direct mode and core0 never
+                // idles.
+                audio.playLooped(AMBIENCE_CLIP, I2SAudio::LOOP_FOREVER, AMBIENCE_GAIN);
+#endif
             }
+        }
 
-            if (inStableState && now >= nextGreenEyesTime) {
-                greenEyesActive = true;
-                greenEyesStart  = now;
-                // Eyes (LEDs 0-1) go green; sensors (LEDs 2-3) stay red
-                strip.setPixelColor(0, NEON_GREEN_R, NEON_GREEN_G, NEON_GREEN_B);
-                strip.setPixelColor(1, NEON_GREEN_R, NEON_GREEN_G, NEON_GREEN_B);
-                strip.setPixelColor(2, 0, 64, 0);
-                strip.setPixelColor(3, 0, 64, 0);
-                audio.play(CLIP_03_SAMPLES, CLIP_03_NUM_SAMPLES, CLIP_03_SAMPLE_RATE);
-            }
+        switch (greenEyes.update(get_absolute_time())) {
+        case GreenEyesScheduler::EYES_ON:
+            ledCommands.push(LedCommand::GREEN_EYES_ON);
+            // Mixed over the theme if it is still playing; the green eyes
+            // pulse with it
+            follow_audio(audio, audio.play(EYES_CLIP), EYES_CLIP);
+            break;
+        case GreenEyesScheduler::EYES_OFF:
+            ledCommands.push(LedCommand::GREEN_EYES_OFF);
+            break;
+        default:
+            break;
         }
 
-        sleep_ms(1);
+        if (time_reached(nextLoadReport)) {
+            printf("Load: core0 %lu%%, core1 %lu%%, audio IRQ worst %lu of %lu cycles, "
+                   "%lu underruns\n",
+                   CoreLoad::samplePercent(0), CoreLoad::samplePercent(1),
+                   audio.getMaxIrqCycles(), audio.getBufferCycles(),
+                   audio.getUnderruns());
+            audio.resetIrqStats();
+            nextLoadReport = delayed_by_ms(nextLoadReport, LOAD_REPORT_MS);
+        }
     }
 }
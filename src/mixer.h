@@ -0,0 +1,75 @@
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <stdint.h>
+
+// ---------------------------------------------------------------------------
+// Gain stage of the I2SAudio mixer: Q15 gains (0x8000 = 1.0) applied to a
+// block of 16-bit samples and summed into a 32-bit mix.  Hardware-free, so
+// the host build tests the same code the refill IRQ runs.
+//
+// A voice gain and the master gain are each up to 0xFFFF (about 2x), so
+// their product is clamped back to MIX_GAIN_MAX: every gain the kernels see
+// fits a Q15.15 accumulator, and a full-scale sample times the gain fits
+// an int32.  The caller saturates the mix to 16 bits.
+// ---------------------------------------------------------------------------
+
+constexpr int32_t MIX_GAIN_MAX = 0xFFFF;
+
+// Voice gain times master gain, in Q15
+inline int32_t mixGain(int32_t voice_gain, int32_t master_gain) {
+    int32_t g = (int32_t)(((int64_t)voice_gain * master_gain) >> 15);
+    return g > MIX_GAIN_MAX ? MIX_GAIN_MAX : g;
+}
+
+// Add `src` into `mix` at a Q15 gain that moves linearly from g0 to g1
+// (0..MIX_GAIN_MAX) across the block.  The ramp runs in Q15.15; its step is
+// a multiply, not a shift, so a falling ramp is well defined.
+inline void mixScaled(int32_t *mix, const int16_t *src, uint32_t count,
+                      int32_t g0, int32_t g1) {
+    if (count == 0) return;
+    if (g0 == g1) {
+        if (g0 == 0) return;
+        for (uint32_t i = 0; i < count; i++) {
+            mix[i] += (src[i] * g0) >> 15;
+        }
+        return;
+    }
+
+    int32_t g = g0 * 32768;
+    int32_t step = (g1 - g0) * 32768 / (int32_t)count;
+    for (uint32_t i = 0; i < count; i++) {
+        mix[i] += (src[i] * (g >> 15)) >> 15;
+        g += step;
+    }
+}
+
+// Same for `count` interleaved stereo frames, one gain step per frame
+inline void mixScaledStereo(int32_t *mix, const int16_t *src, uint32_t count,
+                            int32_t g0, int32_t g1) {
+    if (count == 0) return;
+    if (g0 == g1) {
+        if (g0 == 0) return;
+        for (uint32_t i = 0; i < count * 2; i++) {
+            mix[i] += (src[i] * g0) >> 15;
+        }
+        return;
+    }
+
+    int32_t g = g0 * 32768;
+    int32_t step = (g1 - g0) * 32768 / (int32_t)count;
+    for (uint32_t i = 0; i < count * 2; i += 2) {
+        int32_t gain = g >> 15;
+        mix[i]     += (src[i] * gain) >> 15;
+        mix[i + 1] += (src[i + 1] * gain) >> 15;
+        g += step;
+    }
+}
+
+inline int16_t saturate16(int32_t s) {
+    if (s > INT16_MAX) s = INT16_MAX;
+    if (s < INT16_MIN) s = INT16_MIN;
+    return (int16_t)s;
+}
+
+#endif // MIXER_H
@@ -1,48 +1,191 @@
 #include "neopixel.h"
-#include "ws2812.pio.h"
+#include "hardware/sync.h"
 #include <stdio.h>
+#include <string.h>
 
-NeoPixel::NeoPixel(uint pin, uint num_pixels, PIO pio, uint sm) 
-    : pio_(pio), sm_(sm), pin_(pin), num_pixels_(num_pixels) {
-    
-    // Load the PIO program
-    offset_ = pio_add_program(pio_, &ws2812_program);
-    
-    // Initialize the WS2812 driver
-    ws2812_program_init(pio_, sm_, offset_, pin_, 800000, false);
+NeoPixel::NeoPixel(uint pin, uint num_pixels, uint num_strips, PIO pio,
+                   uint channels)
+    : num_strips_(num_strips < 1 ? 1 : (num_strips > MAX_STRIPS ? MAX_STRIPS : num_strips)),
+      pixels_per_strip_(0), num_pixels_(0), lut_(GAMMA_LINEAR.v),
+      front_(0), pending_(false),
+      pio_(pio), sm_(0), pin_(pin), channels_(channels == 4 ? 4 : 3),
+      offset_(0), program_(nullptr),
+      dma_channel_(-1), stream_words_(0), busy_(false),
+      alarm_pool_(nullptr), latch_alarm_(0),
+      dirty_(true), frames_sent_(0), frames_skipped_(0),
+      frame_done_cb_(nullptr), frame_done_user_(nullptr),
+      gamma_(&GAMMA_LINEAR), brightness_(255) {
+
+    // Clamp so that every strip fits in the framebuffer
+    pixels_per_strip_ = num_pixels;
+    if (pixels_per_strip_ * num_strips_ > MAX_PIXELS) {
+        pixels_per_strip_ = MAX_PIXELS / num_strips_;
+    }
+    num_pixels_ = pixels_per_strip_ * num_strips_;
+
+    // One wire word per pixel; in parallel mode one byte per bit period,
+    // four per word: 2 words per channel
+    stream_words_ = (num_strips_ == 1) ? num_pixels_
+                                       : pixels_per_strip_ * 2 * channels_;
+
+    memset(pixels_, 0, sizeof(pixels_));
+    memset(stream_, 0, sizeof(stream_));
     
-    printf("NeoPixel initialized: %d pixels on GPIO %d\n", num_pixels_, pin_);
+    initOutput();
+
+    if (num_strips_ == 1) {
+        printf("NeoPixel initialized: %d pixels on GPIO %d\n", num_pixels_, pin_);
+    } else {
+        printf("NeoPixel initialized: %d strips x %d pixels on GPIO %d-%d\n",
+               num_strips_, pixels_per_strip_, pin_, pin_ + num_strips_ - 1);
+    }
 }
 
 NeoPixel::~NeoPixel() {
-    pio_sm_set_enabled(pio_, sm_, false);
-    pio_remove_program(pio_, &ws2812_program, offset_);
+    releaseOutput();
 }
 
-void NeoPixel::putPixel(uint32_t pixel_grb) {
-    pio_sm_put_blocking(pio_, sm_, pixel_grb << 8u);
+// Logical color as stored in the back buffer (wire order is applied later)
+static inline uint32_t wrgb_u32(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    return ((uint32_t)(w) << 24) | ((uint32_t)(r) << 16) |
+           ((uint32_t)(g) << 8) | (uint32_t)(b);
 }
 
-uint32_t NeoPixel::urgb_u32(uint8_t r, uint8_t g, uint8_t b) {
-    return ((uint32_t)(r) << 8) | ((uint32_t)(g) << 16) | (uint32_t)(b);
+void NeoPixel::setGamma(const GammaTable &table) {
+    gamma_ = &table;
+    rebuildLut();
 }
 
-void NeoPixel::setPixelColor(uint pixel, uint8_t r, uint8_t g, uint8_t b) {
+void NeoPixel::setBrightness(uint8_t brightness) {
+    brightness_ = brightness;
+    rebuildLut();
+}
+
+void NeoPixel::rebuildLut() {
+    // Every pixel's output changes with the table
+    dirty_ = true;
+
+    if (brightness_ == 255) {
+        lut_ = gamma_->v;
+        return;
+    }
+    // Scale the input before the curve so brightness steps look even
+    for (uint i = 0; i < 256; i++) {
+        scaled_lut_[i] = gamma_->v[(i * (brightness_ + 1u)) >> 8];
+    }
+    lut_ = scaled_lut_;
+}
+
+void NeoPixel::setPixelColor(uint pixel, uint8_t r, uint8_t g, uint8_t b,
+                             uint8_t w) {
     if (pixel < num_pixels_) {
-        putPixel(urgb_u32(r, g, b));
+        storePixel(pixel, wrgb_u32(r, g, b, w));
+    }
+}
+
+void NeoPixel::setStripPixelColor(uint strip, uint pixel,
+                                  uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    if (strip < num_strips_ && pixel < pixels_per_strip_) {
+        storePixel(strip * pixels_per_strip_ + pixel, wrgb_u32(r, g, b, w));
     }
 }
 
-void NeoPixel::fill(uint8_t r, uint8_t g, uint8_t b) {
-    uint32_t color = urgb_u32(r, g, b);
+void NeoPixel::fill(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    uint32_t color = wrgb_u32(r, g, b, w);
     for (uint i = 0; i < num_pixels_; i++) {
-        putPixel(color);
+        storePixel(i, color);
+    }
+}
+
+void NeoPixel::waitForIdle() const {
+    while (busy_) {
+        tight_loop_contents();
+    }
+}
+
+void NeoPixel::setFrameDoneCallback(FrameDoneCallback callback, void *user_data) {
+    frame_done_cb_   = callback;
+    frame_done_user_ = user_data;
+}
+
+// ---------------------------------------------------------------------------
+// Bit-plane transposition for parallel mode.
+//
+// For each pixel slot, the 8 strips' colour bytes form an 8x8 bit matrix
+// (row = strip, column = bit).  Transposing it yields 8 bytes where byte j
+// holds bit (7 - j) of every strip -- exactly what ws2812_parallel shifts
+// out per bit period.  Uses the shift/mask transpose from Hacker's Delight,
+// which needs only 32-bit shifts and masks (no per-bit loops on the Cortex-M0+).
+// ---------------------------------------------------------------------------
+static inline void transpose8(uint32_t x, uint32_t y, uint32_t *out) {
+    uint32_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+    // x/y now hold planes 0-3 / 4-7 with plane 0 in the top byte; the PIO
+    // consumes bytes LSB-first, so byte-reverse each word.
+    out[0] = __builtin_bswap32(x);
+    out[1] = __builtin_bswap32(y);
+}
+
+void NeoPixel::transposeSlot(const uint32_t *words, uint channels,
+                             uint32_t *out) {
+    // Channel bytes go out MSB first, starting at bits 31..24
+    for (uint c = 0; c < channels; c++) {
+        uint shift = 24 - 8 * c;
+        // Strip 7 in the top byte of x ... strip 0 in the low byte of y
+        uint32_t x = ((words[7] >> shift) & 0xFF) << 24 |
+                     ((words[6] >> shift) & 0xFF) << 16 |
+                     ((words[5] >> shift) & 0xFF) << 8  |
+                     ((words[4] >> shift) & 0xFF);
+        uint32_t y = ((words[3] >> shift) & 0xFF) << 24 |
+                     ((words[2] >> shift) & 0xFF) << 16 |
+                     ((words[1] >> shift) & 0xFF) << 8  |
+                     ((words[0] >> shift) & 0xFF);
+        transpose8(x, y, out);
+        out += 2;
     }
 }
 
 void NeoPixel::show() {
-    // Data is automatically sent to LEDs when written to FIFO
-    // This method exists for API compatibility
+    // Nothing changed since the last frame: the LEDs already show this
+    if (!dirty_) {
+        frames_skipped_++;
+        return;
+    }
+
+    // The latch alarm runs on this core: with interrupts off it can neither
+    // start a queued frame nor swap buffers under us.  A frame queued
+    // earlier that has not started is dropped for this newer one.
+    uint32_t irq_state = save_and_disable_interrupts();
+    if (pending_) {
+        pending_ = false;
+        frames_sent_--;
+        frames_skipped_++;
+    }
+    uint back = front_ ^ 1;
+    restore_interrupts(irq_state);
+
+    // Build the idle stream buffer from the back buffer, which stays
+    // untouched so partial updates keep building on this frame
+    encodeFrame(stream_[back]);
+    dirty_ = false;
+    frames_sent_++;
+
+    // Send it now, or queue it behind the frame still on the wire
+    // (pixels_per_strip * 30 us + 300 us for RGB); never waits
+    irq_state = save_and_disable_interrupts();
+    if (busy_) {
+        pending_ = true;
+    } else {
+        front_ = back;
+        transmitFrame();
+    }
+    restore_interrupts(irq_state);
 }
 
 void NeoPixel::clear() {
@@ -70,6 +213,6 @@ void NeoPixel::rainbow(uint32_t offset) {
             b = 255 - hue * 3;
         }
         
-        putPixel(urgb_u32(r, g, b));
+        setPixelColor(i, r, g, b);
     }
 }
@@ -3,40 +3,243 @@
 
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
+#include "gamma.h"
 
-// NeoPixel driver class for WS2812/WS2812B LEDs
+// Order in which the color channels are sent on the wire.  For RGBW strips
+// the white channel always follows the three color channels.
+enum class ColorOrder : uint8_t { RGB, RBG, GRB, GBR, BRG, BGR };
+
+// NeoPixel driver base class for WS2812/WS2812B/SK6812 LEDs
+//
+// Colors are written into a back buffer; show() encodes it into one of two
+// wire-word stream buffers and hands that to a DMA channel that feeds the
+// PIO state machine, so the next frame can be rendered, encoded and queued
+// while the current one is still being clocked out.
+//
+// With num_strips > 1 the driver runs in parallel mode: up to 8 strips on
+// consecutive GPIOs starting at `pin` are clocked out together by a single
+// state machine.  Pixels are addressed as one long strip (strip 0 first),
+// or per strip with setStripPixelColor().
+//
+// show() is free to call every loop: a frame is only sent when a pixel,
+// the gamma curve or the brightness changed since the last one.
+//
+// Colors are stored as given (linear RGB) and corrected on the way out:
+// show() passes every channel through a per-strip lookup table that combines
+// the selected gamma curve with the strip brightness.
+//
+// Instantiate NeoPixelStrip<ORDER, CHANNELS> (below); animations take the
+// NeoPixel base so they work with any wire format.
 class NeoPixel {
 public:
-    NeoPixel(uint pin, uint num_pixels, PIO pio = pio0, uint sm = 0);
-    ~NeoPixel();
+    // Largest number of pixels (across all strips) the framebuffer can hold
+    static const uint MAX_PIXELS = 64;
+    // Largest number of strips driven in parallel by one state machine
+    static const uint MAX_STRIPS = 8;
+
+    // Called from the alarm IRQ once a frame has been clocked out and latched
+    typedef void (*FrameDoneCallback)(void *user_data);
+
+    virtual ~NeoPixel();
     
-    // Set a single pixel color (RGB)
-    void setPixelColor(uint pixel, uint8_t r, uint8_t g, uint8_t b);
+    // Set a single pixel color (RGB, plus W on RGBW strips)
+    void setPixelColor(uint pixel, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0);
+
+    // Set a single pixel on one strip of a parallel group
+    void setStripPixelColor(uint strip, uint pixel,
+                            uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0);
     
     // Set all pixels to the same color
-    void fill(uint8_t r, uint8_t g, uint8_t b);
+    void fill(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0);
     
-    // Update the LEDs with current buffer
+    // Send the frame to the LEDs (non-blocking, DMA driven).
+    // Skipped when nothing changed.  While the previous frame is still on
+    // the wire the new one is encoded into the idle stream buffer and
+    // queued; the latch alarm starts it.  Only the newest frame waits: a
+    // queued frame that has not started is replaced.
     void show();
+
+    // show() calls that went out on the wire vs. were dropped as unchanged
+    uint32_t getFramesSent() const { return frames_sent_; }
+    uint32_t getFramesSkipped() const { return frames_skipped_; }
+
+    // True while a frame is being clocked out or the latch gap is running
+    bool isBusy() const { return busy_; }
+
+    // Block until the current frame, and any queued behind it, has been
+    // clocked out and latched
+    void waitForIdle() const;
+
+    // Optional notification when each frame completes (nullptr to disable)
+    void setFrameDoneCallback(FrameDoneCallback callback, void *user_data = nullptr);
+
+    // Alarm pool for the latch alarm, so it fires on the core that renders
+    // (defaults to the SDK pool on core0).  It must be the core that calls
+    // show(): the alarm starts queued frames.
+    void setAlarmPool(alarm_pool_t *pool);
     
     // Clear all pixels (set to black)
     void clear();
     
-    // Get number of pixels
+    // Get number of pixels (across all strips)
     uint getNumPixels() const { return num_pixels_; }
+
+    // Parallel layout
+    uint getNumStrips() const { return num_strips_; }
+    uint getPixelsPerStrip() const { return pixels_per_strip_; }
+
+    // Select the gamma curve for this strip (flash-resident table)
+    void setGamma(const GammaTable &table);
+
+    // Global brightness scaler for this strip (255 = full)
+    void setBrightness(uint8_t brightness);
+    uint8_t getBrightness() const { return brightness_; }
     
     // Rainbow animation helper
     void rainbow(uint32_t offset);
 
+protected:
+    // num_pixels is per strip; a free state machine on `pio` is claimed.
+    // channels is 3 (RGB) or 4 (RGBW) and sets the PIO autopull threshold.
+    NeoPixel(uint pin, uint num_pixels, uint num_strips, PIO pio, uint channels);
+
+    // Fill `out` (one of stream_) from pixels_ through lut_.  Implemented
+    // by NeoPixelStrip with the wire packing resolved at compile time.
+    virtual void encodeFrame(uint32_t *out) = 0;
+
+    // Store a color, marking the frame dirty only if it actually changed
+    inline void storePixel(uint index, uint32_t wrgb) {
+        if (pixels_[index] != wrgb) {
+            pixels_[index] = wrgb;
+            dirty_ = true;
+        }
+    }
+
+    // Transpose one pixel slot (one packed wire word per strip, first bit in
+    // bit 31) into bit-planes for ws2812_parallel; writes 2 words per channel
+    static void transposeSlot(const uint32_t *words, uint channels, uint32_t *out);
+
+    uint num_strips_;
+    uint pixels_per_strip_;
+    uint num_pixels_;
+
+    // Output correction: points at the flash gamma table at full brightness,
+    // otherwise at scaled_lut_, rebuilt only when gamma/brightness change
+    const uint8_t *lut_;
+
+    // Back buffer: uncorrected 0xWWRRGGBB, written by setPixelColor/fill/clear
+    uint32_t pixels_[MAX_PIXELS];
+    // Stream buffers: corrected wire words for a single strip, bit-planes
+    // in parallel mode.  stream_[front_] is on the wire (or was last); the
+    // other one is encoded while it plays.
+    uint32_t stream_[2][(MAX_PIXELS / 2) * 8];
+    volatile uint front_;
+    volatile bool pending_;     // the other buffer is queued behind front_
+
 private:
+    // WS2812 needs the line held low for >280 us before it latches a frame
+    static const uint32_t LATCH_US = 300;
+    // One bit takes 1.25 us at 800 kHz, so 10 us per 8-bit channel
+    static const uint32_t CHANNEL_US = 10;
+
     PIO pio_;
     uint sm_;
     uint pin_;
-    uint num_pixels_;
+    uint channels_;
     uint offset_;
-    
-    void putPixel(uint32_t pixel_grb);
-    static uint32_t urgb_u32(uint8_t r, uint8_t g, uint8_t b);
+    const pio_program_t *program_;
+
+    int dma_channel_;
+    uint stream_words_;
+    volatile bool busy_;
+    alarm_pool_t *alarm_pool_;
+    alarm_id_t latch_alarm_;
+
+    // Set when the back buffer differs from what was last sent
+    bool dirty_;
+    uint32_t frames_sent_;
+    uint32_t frames_skipped_;
+
+    FrameDoneCallback frame_done_cb_;
+    void *frame_done_user_;
+
+    const GammaTable *gamma_;
+    uint8_t brightness_;
+    uint8_t scaled_lut_[256];
+
+    static int64_t latchAlarmCallback(alarm_id_t id, void *user_data);
+
+    void rebuildLut();
+
+    // Output backend: neopixel_pio.cpp drives PIO + DMA on the RP2040,
+    // host/neopixel_capture.cpp records frames in the simulator
+    void initOutput();
+    void releaseOutput();
+    void transmitFrame();
+};
+
+// ---------------------------------------------------------------------------
+// Compile-time wire format: where each channel lands in the PIO word.
+// The first channel sent occupies bits 31..24 (the PIO shifts MSB first).
+// ---------------------------------------------------------------------------
+constexpr uint colorOrderPosition(ColorOrder order, char channel) {
+    const char *names[] = {"RGB", "RBG", "GRB", "GBR", "BRG", "BGR"};
+    const char *name = names[(uint)order];
+    for (uint i = 0; i < 3; i++) {
+        if (name[i] == channel) return i;
+    }
+    return 3;  // W
+}
+
+template <ColorOrder ORDER, uint CHANNELS>
+struct WireFormat {
+    static_assert(CHANNELS == 3 || CHANNELS == 4, "NeoPixel strips are RGB or RGBW");
+
+    static constexpr uint R_SHIFT = 24 - 8 * colorOrderPosition(ORDER, 'R');
+    static constexpr uint G_SHIFT = 24 - 8 * colorOrderPosition(ORDER, 'G');
+    static constexpr uint B_SHIFT = 24 - 8 * colorOrderPosition(ORDER, 'B');
+    static constexpr uint W_SHIFT = 0;
+
+    // Correct and pack one stored 0xWWRRGGBB color
+    static inline uint32_t pack(uint32_t wrgb, const uint8_t *lut) {
+        uint32_t word = ((uint32_t)lut[(wrgb >> 16) & 0xFF] << R_SHIFT) |
+                        ((uint32_t)lut[(wrgb >> 8) & 0xFF]  << G_SHIFT) |
+                        ((uint32_t)lut[wrgb & 0xFF]         << B_SHIFT);
+        if (CHANNELS == 4) {
+            word |= (uint32_t)lut[wrgb >> 24] << W_SHIFT;
+        }
+        return word;
+    }
+};
+
+// NeoPixel strip with its wire order and channel count fixed at compile
+// time, e.g. NeoPixelStrip<ColorOrder::GRB> or NeoPixelStrip<ColorOrder::GRB, 4>
+template <ColorOrder ORDER, uint CHANNELS = 3>
+class NeoPixelStrip : public NeoPixel {
+public:
+    NeoPixelStrip(uint pin, uint num_pixels, uint num_strips = 1, PIO pio = pio0)
+        : NeoPixel(pin, num_pixels, num_strips, pio, CHANNELS) {}
+
+protected:
+    void encodeFrame(uint32_t *out) override {
+        typedef WireFormat<ORDER, CHANNELS> Format;
+        if (num_strips_ == 1) {
+            for (uint i = 0; i < num_pixels_; i++) {
+                out[i] = Format::pack(pixels_[i], lut_);
+            }
+            return;
+        }
+
+        for (uint p = 0; p < pixels_per_strip_; p++) {
+            // Gather this slot from every strip; unused strips stay dark
+            uint32_t words[MAX_STRIPS] = {0};
+            for (uint s = 0; s < num_strips_; s++) {
+                words[s] = Format::pack(pixels_[s * pixels_per_strip_ + p], lut_);
+            }
+            transposeSlot(words, CHANNELS, out);
+            out += 2 * CHANNELS;
+        }
+    }
 };
 
 #endif // NEOPIXEL_H
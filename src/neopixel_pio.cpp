@@ -0,0 +1,96 @@
+#include "neopixel.h"
+#include "ws2812.pio.h"
+#include "hardware/dma.h"
+
+// ---------------------------------------------------------------------------
+// RP2040 output backend: a PIO state machine generates the WS2812 waveform,
+// fed from the front buffer by one DMA channel; a one-shot alarm marks the
+// end of the latch gap.
+// ---------------------------------------------------------------------------
+
+void NeoPixel::initOutput() {
+    alarm_pool_ = alarm_pool_get_default();
+
+    // Claim a state machine and load the PIO program for this mode
+    sm_ = (uint)pio_claim_unused_sm(pio_, true);
+    if (num_strips_ == 1) {
+        program_ = &ws2812_program;
+        offset_  = pio_add_program(pio_, program_);
+        ws2812_program_init(pio_, sm_, offset_, pin_, 800000, channels_ == 4);
+    } else {
+        program_ = &ws2812_parallel_program;
+        offset_  = pio_add_program(pio_, program_);
+        ws2812_parallel_program_init(pio_, sm_, offset_, pin_, num_strips_, 800000);
+    }
+
+    // DMA channel streams the front buffer into the PIO TX FIFO
+    dma_channel_ = dma_claim_unused_channel(true);
+    dma_channel_config cfg = dma_channel_get_default_config(dma_channel_);
+    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&cfg, true);
+    channel_config_set_write_increment(&cfg, false);
+    channel_config_set_dreq(&cfg, pio_get_dreq(pio_, sm_, true));
+
+    dma_channel_configure(
+        dma_channel_,
+        &cfg,
+        &pio_->txf[sm_],     // write to PIO TX FIFO
+        stream_[0],           // read from the stream buffer on the wire
+        stream_words_,        // whole frame
+        false                 // started by show()
+    );
+}
+
+void NeoPixel::releaseOutput() {
+    if (latch_alarm_ > 0) {
+        alarm_pool_cancel_alarm(alarm_pool_, latch_alarm_);
+    }
+    if (dma_channel_ >= 0) {
+        dma_channel_abort(dma_channel_);
+        dma_channel_unclaim(dma_channel_);
+    }
+    pio_sm_set_enabled(pio_, sm_, false);
+    pio_remove_program(pio_, program_, offset_);
+    pio_sm_unclaim(pio_, sm_);
+}
+
+void NeoPixel::setAlarmPool(alarm_pool_t *pool) {
+    // A pending latch alarm belongs to the old pool
+    waitForIdle();
+    alarm_pool_ = pool ? pool : alarm_pool_get_default();
+}
+
+int64_t NeoPixel::latchAlarmCallback(alarm_id_t id, void *user_data) {
+    NeoPixel *self = static_cast<NeoPixel *>(user_data);
+    self->latch_alarm_ = 0;
+    if (self->pending_) {
+        // show() queued the next frame while this one played: start it
+        self->pending_ = false;
+        self->front_ ^= 1;
+        self->transmitFrame();
+    } else {
+        self->busy_ = false;
+    }
+    if (self->frame_done_cb_) {
+        self->frame_done_cb_(self->frame_done_user_);
+    }
+    return 0;  // one-shot
+}
+
+void NeoPixel::transmitFrame() {
+    busy_ = true;
+    dma_channel_transfer_from_buffer_now(dma_channel_, stream_[front_], stream_words_);
+
+    // The frame takes a fixed time on the wire, so a single hardware alarm
+    // covers both the transfer and the reset gap -- no DMA IRQ needed.
+    // Parallel strips are clocked out together: same time as one strip.
+    uint32_t frame_us = pixels_per_strip_ * channels_ * CHANNEL_US + LATCH_US;
+    latch_alarm_ = alarm_pool_add_alarm_in_us(alarm_pool_, frame_us,
+                                              latchAlarmCallback, this, true);
+    if (latch_alarm_ < 0) {
+        // Alarm pool exhausted: fall back to waiting out the frame here
+        latch_alarm_ = 0;
+        busy_wait_us(frame_us);
+        busy_ = false;
+    }
+}
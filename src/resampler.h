@@ -0,0 +1,141 @@
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <stdint.h>
+
+// ---------------------------------------------------------------------------
+// Fixed-point polyphase resampler for mixer voices whose clip rate differs
+// from the I2S output rate.
+//
+// Each output sample is a 16-tap FIR over the input history, with the
+// coefficient set picked by the sub-sample phase (64 phases, Q15).  The
+// filter is a Blackman-windowed sinc cut off at the input Nyquist rate:
+// right for upsampling and for small rate steps such as 48 kHz -> 44.1 kHz.
+// Large downsampling ratios should be done offline (`wav2cpp.py --rate`).
+//
+// The coefficient table is generated at compile time and lives in flash.
+// ---------------------------------------------------------------------------
+
+struct ResamplerTable {
+    static constexpr unsigned TAPS = 16;
+    static constexpr unsigned PHASE_BITS = 6;
+    static constexpr unsigned PHASES = 1u << PHASE_BITS;
+    int16_t c[PHASES][TAPS];
+};
+
+constexpr double RESAMPLER_PI = 3.14159265358979323846;
+
+// constexpr sin: range-reduce to [-pi, pi], then Taylor series
+constexpr double resampler_sin(double x) {
+    while (x >  RESAMPLER_PI) x -= 2.0 * RESAMPLER_PI;
+    while (x < -RESAMPLER_PI) x += 2.0 * RESAMPLER_PI;
+    double term = x;
+    double sum  = x;
+    for (int n = 1; n < 16; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum  += term;
+    }
+    return sum;
+}
+
+constexpr double resampler_cos(double x) {
+    return resampler_sin(x + RESAMPLER_PI / 2.0);
+}
+
+// Tap k of phase p sits at input offset x = k - (TAPS/2 - 1) - p/PHASES
+// from the output position.  Every phase is normalised to unity DC gain.
+constexpr ResamplerTable makeResamplerTable() {
+    ResamplerTable table{};
+    constexpr double half = ResamplerTable::TAPS / 2;
+    for (unsigned p = 0; p < ResamplerTable::PHASES; p++) {
+        double h[ResamplerTable::TAPS] = {};
+        double sum = 0.0;
+        for (unsigned k = 0; k < ResamplerTable::TAPS; k++) {
+            double x = (double)k - (half - 1.0) - (double)p / ResamplerTable::PHASES;
+            double sinc = (x == 0.0) ? 1.0
+                        : resampler_sin(RESAMPLER_PI * x) / (RESAMPLER_PI * x);
+            double w = 0.42 + 0.5 * resampler_cos(RESAMPLER_PI * x / half)
+                            + 0.08 * resampler_cos(2.0 * RESAMPLER_PI * x / half);
+            h[k] = sinc * w;
+            sum += h[k];
+        }
+        for (unsigned k = 0; k < ResamplerTable::TAPS; k++) {
+            double q = h[k] / sum * 32768.0;
+            if (q > 32767.0) q = 32767.0;   // the centre tap of phase 0
+            table.c[p][k] = (int16_t)(q < 0.0 ? q - 0.5 : q + 0.5);
+        }
+    }
+    return table;
+}
+
+inline constexpr ResamplerTable RESAMPLER_TABLE = makeResamplerTable();
+
+class Resampler {
+public:
+    static constexpr unsigned TAPS = ResamplerTable::TAPS;
+
+    // Resample from in_rate to out_rate, starting a new clip
+    void start(uint32_t in_rate, uint32_t out_rate) {
+        // in/out as Q16 plus an exact remainder, so long clips do not drift
+        step_     = (uint32_t)(((uint64_t)in_rate << 16) / out_rate);
+        step_rem_ = (uint32_t)(((uint64_t)in_rate << 16) % out_rate);
+        rem_      = 0;
+        out_rate_ = out_rate;
+        // Pull TAPS/2 + 1 samples first so the first output lands on the
+        // first input sample (hist_[TAPS/2 - 1])
+        phase_ = (TAPS / 2 + 1) << 16;
+        flush_ = TAPS / 2;
+        for (unsigned k = 0; k < TAPS; k++) hist_[k] = 0;
+    }
+
+    // Produce up to `count` output samples into `out`.  `source(int16_t &s)`
+    // supplies the next input sample and returns false once the clip is
+    // exhausted; the filter is then flushed with silence.  Returns the
+    // number of samples produced (fewer than `count` only at the end of the
+    // clip).
+    template<typename Source>
+    uint32_t process(int16_t *out, uint32_t count, Source &&source) {
+        for (uint32_t n = 0; n < count; n++) {
+            while (phase_ >= 0x10000) {
+                int16_t s;
+                if (!source(s)) {
+                    if (flush_ == 0) return n;
+                    flush_--;
+                    s = 0;
+                }
+                for (unsigned k = 0; k < TAPS - 1; k++) hist_[k] = hist_[k + 1];
+                hist_[TAPS - 1] = s;
+                phase_ -= 0x10000;
+            }
+
+            const int16_t *c = RESAMPLER_TABLE.c[phase_ >> (16 - ResamplerTable::PHASE_BITS)];
+            int32_t acc = 0;   // cannot overflow: sum |c| < 65536
+            for (unsigned k = 0; k < TAPS; k++) {
+                acc += hist_[k] * c[k];
+            }
+            acc >>= 15;
+            if (acc > INT16_MAX) acc = INT16_MAX;   // ringing on full-scale input
+            if (acc < INT16_MIN) acc = INT16_MIN;
+            out[n] = (int16_t)acc;
+
+            phase_ += step_;
+            rem_ += step_rem_;
+            if (rem_ >= out_rate_) {
+                rem_ -= out_rate_;
+                phase_++;
+            }
+        }
+        return count;
+    }
+
+private:
+    uint32_t step_;     // input samples per output sample, Q16
+    uint32_t step_rem_; // ...plus step_rem_ / out_rate_ of a Q16 unit
+    uint32_t rem_;
+    uint32_t out_rate_;
+    uint32_t phase_;    // output position past hist_[TAPS/2 - 1], Q16
+    uint32_t flush_;    // silent samples still to feed after the end
+    int16_t hist_[TAPS];
+};
+
+#endif // RESAMPLER_H
@@ -0,0 +1,64 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+// ---------------------------------------------------------------------------
+// Lock-free single-producer / single-consumer ring for passing small
+// messages between the two cores.
+//
+// Exactly one core may push and exactly one core may pop.  Each index is
+// written by one side only, so no spin lock or interrupt masking is needed:
+// the producer publishes an item by bumping head_ after a barrier, the
+// consumer frees a slot by bumping tail_.  push() also raises SEV so a
+// consumer sleeping in WFE wakes up to drain the ring.
+//
+// The RP2040 SIO FIFO would also work, but it is only 8 x 32 bits deep and
+// the SDK uses it for multicore_launch_core1() and multicore lockout; a
+// shared-memory ring keeps it free and can carry any trivially copyable T.
+// ---------------------------------------------------------------------------
+template <typename T, uint N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    SpscQueue() : head_(0), tail_(0) {}
+
+    // Producer side.  Returns false (item dropped) if the ring is full.
+    bool push(const T &item) {
+        uint32_t head = head_;
+        if (head - tail_ == N) {
+            return false;
+        }
+        items_[head & (N - 1)] = item;
+        __dmb();            // item is visible before the new head
+        head_ = head + 1;
+        __sev();            // wake the consumer if it is in WFE
+        return true;
+    }
+
+    // Consumer side.  Returns false if there is nothing to read.
+    bool pop(T &item) {
+        uint32_t tail = tail_;
+        if (head_ == tail) {
+            return false;
+        }
+        __dmb();            // head read before the item it covers
+        item = items_[tail & (N - 1)];
+        __dmb();            // item copied out before the slot is released
+        tail_ = tail + 1;
+        return true;
+    }
+
+    // Safe to call from either side; only a snapshot
+    bool empty() const { return head_ == tail_; }
+
+private:
+    T items_[N];
+    // Free-running counters; head_ written by the producer, tail_ by the consumer
+    volatile uint32_t head_;
+    volatile uint32_t tail_;
+};
+
+#endif // SPSC_QUEUE_H
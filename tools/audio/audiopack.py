@@ -0,0 +1,358 @@
+#!/usr/bin/env python3
+"""
+audiopack — Pack audio clips into one binary asset file for the firmware.
+
+Usage:
+    python audiopack.py clip NAME SOURCE OUTPUT.clip [wav2cpp options]
+    python audiopack.py link OUTPUT.pack --header HEADER.h --stub STUB.S CLIP.clip...
+
+The firmware build runs both steps from CMake (gundam_add_audio_assets() in
+cmake/GundamAudioAssets.cmake): `clip` converts one source file, with the
+same options as wav2cpp.py (--adpcm, --rate HZ, --loop [START:END],
+--stereo, --trim, --loudness, --peak, --envelope), into a one-clip pack;
+`link` joins the converted clips into the pack and writes the assembler
+.incbin stub that links its payloads into the firmware, with a label at
+every payload and envelope, plus the clip registry header: a ClipId enum, a
+constexpr ClipDescriptor table indexed by it and a perfect hash of the
+clip names.  Only clips whose source or options changed are converted
+again; linking is a copy.
+
+The firmware plays clips through the registry (I2SAudio::play(ClipId)),
+which points into the linked payloads, so the clips never go through the
+C++ compiler.  Lookup is compile-time only: the header and clip table stay
+in the .pack file for the tools (`link` reads them back), and the stub
+skips them, so they cost no flash.
+
+Format (little-endian, every field and payload 4-byte aligned):
+
+    header   16 bytes  magic "GPAK", uint16 version, uint16 clip count,
+                       uint32 total size, uint32 reserved
+    table    48 bytes per clip:
+               char[16] name (NUL-padded), uint32 payload offset (from the
+               start of the pack), uint32 payload bytes, uint32 num_samples
+               (both channels for stereo), uint32 sample rate, uint32 loop
+               start, uint32 loop end (frames; 0/0 = no loop), uint8 codec
+               (0 = PCM16, 1 = IMA ADPCM), uint8 channels, uint16 envelope
+               rate (levels per second; 0 = no envelope), uint32 envelope
+               offset
+    payloads int16 PCM (interleaved for stereo) or IMA ADPCM blocks, each
+             followed by its envelope if it has one: one uint8 level per
+             1/rate s of audio, ceil(frames * rate / sample rate) of them
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import wav2cpp  # noqa: E402
+
+PACK_MAGIC = b"GPAK"
+PACK_VERSION = 1
+HEADER_FORMAT = "<4sHHII"
+ENTRY_FORMAT = "<16sIIIIIIBBHI"
+NAME_LEN = 16
+
+CODEC_PCM16 = 0
+CODEC_IMA_ADPCM = 1
+
+FNV_BASIS = 2166136261
+FNV_PRIME = 16777619
+
+
+def convert(name, source, options):
+    """Convert one source file; returns the table fields and payload."""
+    parser = argparse.ArgumentParser(prog=name)
+    wav2cpp.add_clip_options(parser)
+    opts = parser.parse_args(options)
+
+    if len(name.encode()) >= NAME_LEN:
+        print(f"Error: clip name '{name}' is longer than {NAME_LEN - 1} characters.",
+              file=sys.stderr)
+        sys.exit(1)
+    if not os.path.isfile(source):
+        print(f"Error: file not found: {source}", file=sys.stderr)
+        sys.exit(1)
+
+    samples, sample_rate, num_channels, loop = wav2cpp.load_clip(
+        source, opts.stereo, opts.adpcm, opts.rate, opts.loop,
+        opts.trim, opts.loudness, opts.peak)
+
+    if opts.adpcm:
+        payload = wav2cpp.encode_ima_adpcm(samples)
+        wav2cpp.report_adpcm_snr(samples, payload)
+        codec = CODEC_IMA_ADPCM
+    else:
+        payload = struct.pack(f"<{len(samples)}h", *samples)
+        codec = CODEC_PCM16
+
+    envelope = b""
+    if opts.envelope:
+        envelope = wav2cpp.compute_envelope(samples, num_channels, sample_rate,
+                                            opts.envelope)
+
+    loop_start, loop_end = loop if loop else (0, 0)
+    return dict(name=name, payload=payload, num_samples=len(samples),
+                sample_rate=sample_rate, loop_start=loop_start, loop_end=loop_end,
+                codec=codec, channels=num_channels,
+                envelope=envelope, envelope_rate=opts.envelope or 0)
+
+
+def table_size(count):
+    """Bytes of header and clip table in front of the payloads."""
+    return struct.calcsize(HEADER_FORMAT) + struct.calcsize(ENTRY_FORMAT) * count
+
+
+def write_pack(clips, path):
+    """Lay out the header, the clip table and the 4-byte aligned payloads."""
+    offset = table_size(len(clips))
+    table = b""
+    payloads = b""
+    for clip in clips:
+        payload = clip["payload"]
+        envelope = clip["envelope"]
+        clip["offset"] = offset
+        clip["envelope_offset"] = 0
+        padding = -len(payload) % 4
+        payloads += payload + b"\0" * padding
+        offset += len(payload) + padding
+        if envelope:
+            clip["envelope_offset"] = offset
+            padding = -len(envelope) % 4
+            payloads += envelope + b"\0" * padding
+            offset += len(envelope) + padding
+        table += struct.pack(
+            ENTRY_FORMAT, clip["name"].encode(), clip["offset"], len(payload),
+            clip["num_samples"], clip["sample_rate"], clip["loop_start"],
+            clip["loop_end"], clip["codec"], clip["channels"],
+            clip["envelope_rate"], clip["envelope_offset"])
+
+    header = struct.pack(HEADER_FORMAT, PACK_MAGIC, PACK_VERSION, len(clips), offset, 0)
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "wb") as f:
+        f.write(header + table + payloads)
+    return offset
+
+
+def read_pack(path):
+    """Read back the clips of a pack written by write_pack()."""
+    with open(path, "rb") as f:
+        data = f.read()
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entry_size = struct.calcsize(ENTRY_FORMAT)
+    magic, version, count, size, _ = struct.unpack_from(HEADER_FORMAT, data)
+    if magic != PACK_MAGIC or version != PACK_VERSION or size != len(data):
+        print(f"Error: {path} is not a version {PACK_VERSION} pack.", file=sys.stderr)
+        sys.exit(1)
+    clips = []
+    for i in range(count):
+        (name, offset, length, num_samples, sample_rate, loop_start, loop_end,
+         codec, channels, envelope_rate, envelope_offset) = struct.unpack_from(
+            ENTRY_FORMAT, data, header_size + i * entry_size)
+        envelope = b""
+        if envelope_rate:
+            count = wav2cpp.envelope_count(num_samples // channels, sample_rate,
+                                           envelope_rate)
+            envelope = data[envelope_offset:envelope_offset + count]
+        clips.append(dict(name=name.rstrip(b"\0").decode(),
+                          payload=data[offset:offset + length],
+                          num_samples=num_samples, sample_rate=sample_rate,
+                          loop_start=loop_start, loop_end=loop_end,
+                          codec=codec, channels=channels,
+                          envelope=envelope, envelope_rate=envelope_rate))
+    return clips
+
+
+def clip_name_hash(name, seed):
+    """FNV-1a of the name from a seeded basis, as clipNameHash() in
+    src/asset_pack.h computes it."""
+    h = (FNV_BASIS ^ seed) & 0xFFFFFFFF
+    for byte in name.encode():
+        h = ((h ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def perfect_hash(names):
+    """Find a seed that sends every name to its own slot of the smallest
+    power-of-two table with room to spare; returns (seed, slots)."""
+    slots = 1
+    while slots < 2 * len(names):
+        slots *= 2
+    while True:
+        for seed in range(1 << 16):
+            used = {clip_name_hash(name, seed) & (slots - 1) for name in names}
+            if len(used) == len(names):
+                return seed, slots
+        slots *= 2
+
+
+def symbol_name(name):
+    """Lower-case C identifier for a pack or clip name."""
+    return wav2cpp.sanitize_name(name).lower().lstrip("_")
+
+
+def write_stub(clips, pack_path, path):
+    """Write the .incbin stub: the pack's payloads, without its header and
+    clip table, plus a label at every payload."""
+    pack = symbol_name(os.path.splitext(os.path.basename(pack_path))[0])
+    skip = table_size(len(clips))
+    lines = [
+        "// Generated by tools/audio/audiopack.py -- do not edit.",
+        f'    .section .rodata.{pack}_pack, "a"',
+        "    .balign 4",
+        f"    .global {pack}_pack",
+        f"{pack}_pack:",
+        f'    .incbin "{os.path.abspath(pack_path)}", {skip}',
+        f"    .global {pack}_pack_end",
+        f"{pack}_pack_end:",
+        "",
+    ]
+    for clip in clips:
+        label = f"{pack}_{symbol_name(clip['name'])}"
+        lines += [f"    .global {label}",
+                  f"    .set {label}, {pack}_pack + {clip['offset'] - skip}"]
+        if clip["envelope"]:
+            lines += [f"    .global {label}_envelope",
+                      f"    .set {label}_envelope, "
+                      f"{pack}_pack + {clip['envelope_offset'] - skip}"]
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def write_header(clips, size, pack_path, path):
+    """Write the registry header: the pack's symbols, the ClipId enum, the
+    constexpr descriptor table and the perfect hash of the clip names."""
+    pack = symbol_name(os.path.splitext(os.path.basename(pack_path))[0])
+    guard = wav2cpp.sanitize_name(os.path.basename(path)) + "_H"
+    ids = [wav2cpp.sanitize_name(clip["name"]).lstrip("_") for clip in clips]
+    if len(set(ids)) != len(ids) or "NONE" in ids:
+        print("Error: clip names must give distinct IDs other than NONE.", file=sys.stderr)
+        sys.exit(1)
+    seed, slots = perfect_hash([clip["name"] for clip in clips])
+    hash_table = [len(clips)] * slots
+    for i, clip in enumerate(clips):
+        hash_table[clip_name_hash(clip["name"], seed) & (slots - 1)] = i
+
+    lines = [
+        f"// Generated by tools/audio/audiopack.py from {os.path.basename(pack_path)} -- do not edit.",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        '#include "asset_pack.h"',
+        "",
+        f"// The pack's payloads ({len(clips)} clips, "
+        f"{size - table_size(len(clips))} bytes); its header and clip table",
+        "// are not linked",
+        f'extern "C" const uint8_t {pack}_pack[];',
+        f'extern "C" const uint8_t {pack}_pack_end[];',
+        "",
+        "// Clip payloads inside the pack",
+    ]
+    for clip in clips:
+        label = f"{pack}_{symbol_name(clip['name'])}"
+        lines.append(f'extern "C" const uint8_t {label}[];')
+        if clip["envelope"]:
+            lines.append(f'extern "C" const uint8_t {label}_envelope[];')
+    lines += [
+        "",
+        "enum class ClipId : uint16_t {",
+    ]
+    for clip, clip_id in zip(clips, ids):
+        codec = "IMA ADPCM" if clip["codec"] == CODEC_IMA_ADPCM else "PCM"
+        frames = clip["num_samples"] // clip["channels"]
+        lines.append(f"    {clip_id},".ljust(16) +
+                     f"// {codec}, {clip['sample_rate']} Hz, "
+                     f"{'mono' if clip['channels'] == 1 else 'stereo'}, "
+                     f"{frames / clip['sample_rate']:.2f} s")
+    lines += [
+        "    NONE".ljust(16) + "// no such clip",
+        "};",
+        "",
+        f"constexpr uint CLIP_COUNT = {len(clips)};",
+        "",
+        "// Indexed by ClipId",
+        "inline constexpr ClipDescriptor CLIP_TABLE[CLIP_COUNT] = {",
+    ]
+    for clip in clips:
+        codec = "IMA_ADPCM" if clip["codec"] == CODEC_IMA_ADPCM else "PCM16"
+        label = f"{pack}_{symbol_name(clip['name'])}"
+        envelope = (f"{{{label}_envelope, {len(clip['envelope'])}, {clip['envelope_rate']}}}"
+                    if clip["envelope"] else "{nullptr, 0, 0}")
+        lines.append(f'    {{"{clip["name"]}",')
+        lines.append(f'     {{AudioCodec::{codec}, {clip["channels"]}, {label}, '
+                     f'{clip["num_samples"]}, {clip["sample_rate"]}, '
+                     f'{clip["loop_start"]}, {clip["loop_end"]}}},')
+        lines.append(f"     {envelope}}},")
+    lines += [
+        "};",
+        "",
+        "// Perfect hash of the names: clipNameHash(name, CLIP_HASH_SEED) masked",
+        "// to CLIP_HASH_SLOTS picks a slot holding the clip's index (or",
+        "// CLIP_COUNT), with no two clips in one slot",
+        f"constexpr uint32_t CLIP_HASH_SEED = {seed};",
+        f"constexpr uint CLIP_HASH_SLOTS = {slots};",
+        "inline constexpr uint16_t CLIP_HASH_TABLE[CLIP_HASH_SLOTS] = {",
+        "    " + ", ".join(str(i) for i in hash_table),
+        "};",
+        "",
+        "// Clip by name, or ClipId::NONE: one hash and one string compare.  A",
+        "// literal name resolves at compile time.",
+        "constexpr ClipId findClip(const char *name) {",
+        "    uint16_t index = CLIP_HASH_TABLE[clipNameHash(name, CLIP_HASH_SEED) & (CLIP_HASH_SLOTS - 1)];",
+        "    return (index < CLIP_COUNT && clipNameEqual(name, CLIP_TABLE[index].name))",
+        "           ? ClipId(index) : ClipId::NONE;",
+        "}",
+        "",
+        f"#endif // {guard}",
+        "",
+    ]
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Pack audio clips into one binary asset file."
+    )
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    clip = commands.add_parser("clip", help="Convert one source file into a one-clip pack")
+    clip.add_argument("name", help="Clip name, up to 15 characters")
+    clip.add_argument("source", help="Input audio file path (.wav, .ogg, .mp3)")
+    clip.add_argument("output", help="Converted clip to write (.clip)")
+
+    link = commands.add_parser("link", help="Join converted clips into one pack")
+    link.add_argument("output", help="Pack file to write (.pack)")
+    link.add_argument("clips", nargs="+", help="Converted clips, in table order")
+    link.add_argument("--header", required=True,
+                      help="Registry header to write (ClipId, descriptors, name hash)")
+    link.add_argument("--stub", required=True,
+                      help="Assembler .incbin stub to write (pack and clip symbols)")
+
+    args, options = parser.parse_known_args()
+
+    if args.command == "clip":
+        clip = convert(args.name, args.source, options)
+        write_pack([clip], args.output)
+        codec = "IMA ADPCM" if clip["codec"] == CODEC_IMA_ADPCM else "PCM"
+        print(f"Written: {args.output} ({codec}, {len(clip['payload']) / 1024:.1f} KB)")
+        return
+
+    if options:
+        parser.error(f"unrecognized arguments: {' '.join(options)}")
+    clips = [clip for path in args.clips for clip in read_pack(path)]
+    names = [clip["name"] for clip in clips]
+    if len(set(names)) != len(names):
+        print("Error: duplicate clip names in the pack.", file=sys.stderr)
+        sys.exit(1)
+
+    size = write_pack(clips, args.output)
+    write_header(clips, size, args.output, args.header)
+    write_stub(clips, args.output, args.stub)
+    print(f"Written: {args.output} ({len(clips)} clips, {size / 1024:.1f} KB)")
+
+
+if __name__ == "__main__":
+    main()
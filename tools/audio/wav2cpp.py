@@ -8,13 +8,23 @@ Supported formats:
     .mp3 — requires pydub + FFmpeg
 
 Usage:
-    python wav2cpp.py <input_file> [output_dir]
+    python wav2cpp.py <input_file> [output_dir] [--adpcm] [--rate HZ]
+                      [--loop [START:END]] [--trim [DBFS]]
+                      [--loudness LUFS] [--peak DBFS] [--envelope FPS]
 
 Produces a .h/.cpp pair containing the PCM samples as a const int16_t array
-suitable for embedding in RP2040 firmware.
+suitable for embedding in RP2040 firmware, or with --adpcm a const uint8_t
+array of 4-bit IMA ADPCM blocks (4x smaller) for I2SAudio::playAdpcm().
+With --rate the clip is resampled to the I2S output rate first, so the
+firmware can stream it without its runtime resampler.
+Loop points (from --loop, or a WAV 'smpl' chunk) are written to the header
+as NAME_LOOP_START/NAME_LOOP_END for I2SAudio::playLooped().
+With --envelope FPS an amplitude envelope, one level per LED frame, is
+written as NAME_ENVELOPE for AudioEnvelopeAnimation.
 """
 
 import argparse
+import math
 import os
 import re
 import struct
@@ -120,7 +130,487 @@ def read_wav(path: str, mono: bool = True):
     return samples, sample_rate, out_channels
 
 
-def write_cpp(samples, sample_rate, num_channels, name, output_dir):
+def read_wav_loop(path: str):
+    """Return the first loop of a WAV 'smpl' chunk as (start, end), end
+    exclusive, in sample frames -- or None if the file has no loop."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"RIFF" or data[8:12] != b"WAVE":
+        return None
+    pos = 12
+    while pos + 8 <= len(data):
+        chunk_id = data[pos : pos + 4]
+        size = struct.unpack_from("<I", data, pos + 4)[0]
+        if chunk_id == b"smpl" and size >= 36 + 24:
+            num_loops = struct.unpack_from("<I", data, pos + 8 + 28)[0]
+            if num_loops:
+                # Loop record: id, type, start, end (inclusive), fraction, count
+                start, end = struct.unpack_from("<II", data, pos + 8 + 36 + 8)
+                return start, end + 1
+        pos += 8 + size + (size & 1)
+    return None
+
+
+# ---------------------------------------------------------------------------
+# Loop points.  A jump from the loop end back to the loop start is only
+# seamless if the waveform joins up, so both points are moved to the nearest
+# rising zero crossing.
+# ---------------------------------------------------------------------------
+
+LOOP_SNAP_MS = 2
+
+
+def snap_to_zero_crossing(samples, index, window):
+    """Nearest i within `window` of `index` with samples[i-1] < 0 <= samples[i]."""
+    for d in range(window + 1):
+        for i in (index - d, index + d):
+            if 0 < i < len(samples) and samples[i - 1] < 0 <= samples[i]:
+                return i
+    return index
+
+
+def parse_loop(arg, num_frames, sample_rate):
+    """--loop value: 'START:END' in source frames, or 'all' for the whole clip.
+    A point with an 's' suffix is in seconds (e.g. 0:4.0625s), which holds
+    whatever rate the source file was made at."""
+    if arg == "all":
+        return 0, num_frames
+
+    def point(v):
+        if v.endswith("s"):
+            return round(float(v[:-1]) * sample_rate)
+        return int(v)
+
+    try:
+        start, end = (point(v) for v in arg.split(":"))
+    except ValueError:
+        print(f"Error: bad loop '{arg}', expected START:END.", file=sys.stderr)
+        sys.exit(1)
+    return start, end
+
+
+# ---------------------------------------------------------------------------
+# Loudness and silence (stdlib only).  Loudness is ITU-R BS.1770 integrated
+# loudness: K-weighting (high shelf plus high-pass, designed for the clip's
+# rate), mean square over 400 ms blocks with 75% overlap, then the -70 LUFS
+# absolute and -10 LU relative gates.  Silence is trimmed after gain, so
+# the threshold means the same for every clip.
+# ---------------------------------------------------------------------------
+
+SILENCE_DBFS = -50.0
+PEAK_CEILING_DBFS = -1.0
+
+
+def dbfs_level(dbfs):
+    """Sample magnitude of a dBFS level (0 dBFS = 32768)."""
+    return 32768.0 * 10 ** (dbfs / 20)
+
+
+def biquad(x, b, a):
+    """Direct form I; b and a normalised so that a0 = 1."""
+    y = []
+    x1 = x2 = y1 = y2 = 0.0
+    b0, b1, b2 = b
+    _, a1, a2 = a
+    for v in x:
+        out = b0 * v + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2
+        x2, x1, y2, y1 = x1, v, y1, out
+        y.append(out)
+    return y
+
+
+def k_weighting(rate):
+    """The two BS.1770 K-weighting stages as (b, a) pairs for `rate`."""
+    # Stage 1: +4 dB high shelf above ~1.5 kHz (head effects)
+    gain, fc, q = 4.0, 1500.0, 1 / math.sqrt(2)
+    a_lin = 10 ** (gain / 40)
+    w0 = 2 * math.pi * fc / rate
+    alpha = math.sin(w0) / (2 * q)
+    cos_w0 = math.cos(w0)
+    root = 2 * math.sqrt(a_lin) * alpha
+    b = (a_lin * ((a_lin + 1) + (a_lin - 1) * cos_w0 + root),
+         -2 * a_lin * ((a_lin - 1) + (a_lin + 1) * cos_w0),
+         a_lin * ((a_lin + 1) + (a_lin - 1) * cos_w0 - root))
+    a = ((a_lin + 1) - (a_lin - 1) * cos_w0 + root,
+         2 * ((a_lin - 1) - (a_lin + 1) * cos_w0),
+         (a_lin + 1) - (a_lin - 1) * cos_w0 - root)
+    shelf = (tuple(v / a[0] for v in b), tuple(v / a[0] for v in a))
+
+    # Stage 2: RLB high-pass at 38 Hz
+    fc, q = 38.0, 0.5
+    w0 = 2 * math.pi * fc / rate
+    alpha = math.sin(w0) / (2 * q)
+    cos_w0 = math.cos(w0)
+    b = ((1 + cos_w0) / 2, -(1 + cos_w0), (1 + cos_w0) / 2)
+    a = (1 + alpha, -2 * cos_w0, 1 - alpha)
+    high_pass = (tuple(v / a[0] for v in b), tuple(v / a[0] for v in a))
+    return shelf, high_pass
+
+
+def integrated_loudness(samples, num_channels, rate):
+    """BS.1770 integrated loudness in LUFS, or None for a silent clip."""
+    stages = k_weighting(rate)
+    weighted = []
+    for ch in range(num_channels):
+        x = [v / 32768.0 for v in samples[ch::num_channels]]
+        for b, a in stages:
+            x = biquad(x, b, a)
+        weighted.append(x)
+
+    num_frames = len(weighted[0])
+    block = min(num_frames, int(0.4 * rate))
+    step = max(1, block // 4)
+    powers = []
+    for start in range(0, num_frames - block + 1, step):
+        powers.append(sum(sum(v * v for v in x[start:start + block]) / block
+                          for x in weighted))
+
+    def loudness(power):
+        return -0.691 + 10 * math.log10(power)
+
+    gated = [p for p in powers if p > 0 and loudness(p) > -70.0]
+    if not gated:
+        return None
+    relative = loudness(sum(gated) / len(gated)) - 10.0
+    gated = [p for p in gated if loudness(p) > relative]
+    return loudness(sum(gated) / len(gated))
+
+
+def normalize(samples, num_channels, rate, loudness=None, peak=None):
+    """Scale to `loudness` LUFS with the peak kept under `peak` dBFS (default
+    PEAK_CEILING_DBFS), or without a loudness target to exactly `peak` dBFS."""
+    top = max((abs(v) for v in samples), default=0)
+    if top == 0:
+        print("  silent clip: not normalized")
+        return samples
+    ceiling = PEAK_CEILING_DBFS if peak is None else peak
+    peak_gain = dbfs_level(ceiling) / top
+
+    if loudness is None:
+        gain = peak_gain
+        print(f"  peak {20 * math.log10(top / 32768):.1f} dBFS -> {ceiling:.1f} dBFS")
+    else:
+        measured = integrated_loudness(samples, num_channels, rate)
+        if measured is None:
+            print("  no loudness above the -70 LUFS gate: not normalized")
+            return samples
+        gain = min(10 ** ((loudness - measured) / 20), peak_gain)
+        print(f"  loudness {measured:.1f} LUFS -> {measured + 20 * math.log10(gain):.1f} LUFS"
+              f"{' (peak limited)' if gain == peak_gain else ''}")
+
+    print(f"  gain {20 * math.log10(gain):+.1f} dB")
+    return [max(-32768, min(32767, round(v * gain))) for v in samples]
+
+
+def encoded_bytes(num_samples, adpcm):
+    """Flash taken by num_samples as int16 PCM or as IMA ADPCM blocks."""
+    if not adpcm:
+        return num_samples * 2
+    blocks, rest = divmod(num_samples, ADPCM_BLOCK_SAMPLES)
+    return blocks * ADPCM_BLOCK_BYTES + (4 + rest // 2 if rest else 0)
+
+
+def trim_silence(samples, num_channels, rate, threshold, loop, adpcm):
+    """Drop the leading and trailing frames quieter than `threshold` dBFS on
+    every channel, never cutting into the loop.  Returns (samples, loop)
+    with the loop moved to the trimmed clip."""
+    level = dbfs_level(threshold)
+    num_frames = len(samples) // num_channels
+
+    def audible(frame):
+        return any(abs(v) >= level
+                   for v in samples[frame * num_channels:(frame + 1) * num_channels])
+
+    first = 0
+    while first < num_frames and not audible(first):
+        first += 1
+    if first == num_frames:
+        print(f"  nothing above {threshold:.0f} dBFS: not trimmed")
+        return samples, loop
+    last = num_frames
+    while not audible(last - 1):
+        last -= 1
+    if loop:
+        first = min(first, loop[0])
+        last = max(last, loop[1])
+        loop = (loop[0] - first, loop[1] - first)
+
+    saved = (encoded_bytes(len(samples), adpcm) -
+             encoded_bytes((last - first) * num_channels, adpcm))
+    print(f"  trimmed {first / rate * 1000:.0f} ms + {(num_frames - last) / rate * 1000:.0f} ms "
+          f"below {threshold:.0f} dBFS: {saved} bytes saved")
+    return samples[first * num_channels:last * num_channels], loop
+
+
+# ---------------------------------------------------------------------------
+# Amplitude envelope for audio-synced LEDs: one level per LED frame, so the
+# firmware reads a table entry per frame instead of analysing the audio.
+# Levels follow the RMS of each frame's audio on a dB scale, from
+# ENVELOPE_RANGE_DB under the clip's loudest frame (0) up to it (255), and
+# fall back no faster than ENVELOPE_RELEASE per frame so the light decays
+# instead of flickering.
+# ---------------------------------------------------------------------------
+
+ENVELOPE_RANGE_DB = 36.0
+ENVELOPE_RELEASE = 0.85
+
+
+def envelope_count(num_frames, sample_rate, fps):
+    """Levels covering num_frames of audio, the last one partial."""
+    return (num_frames * fps + sample_rate - 1) // sample_rate
+
+
+def compute_envelope(samples, num_channels, sample_rate, fps):
+    """Envelope levels (bytes) for `samples`, `fps` levels per second.
+    Level i covers frames [i * rate / fps, (i + 1) * rate / fps)."""
+    num_frames = len(samples) // num_channels
+    rms = []
+    for i in range(envelope_count(num_frames, sample_rate, fps)):
+        start = i * sample_rate // fps * num_channels
+        end = min((i + 1) * sample_rate // fps, num_frames) * num_channels
+        chunk = samples[start:end]
+        rms.append(math.sqrt(sum(v * v for v in chunk) / len(chunk)) if chunk else 0.0)
+
+    top = max(rms, default=0.0)
+    levels = bytearray()
+    level = 0.0
+    for r in rms:
+        db = 20 * math.log10(r / top) if r > 0 else -ENVELOPE_RANGE_DB
+        target = max(0.0, 1.0 + db / ENVELOPE_RANGE_DB) * 255
+        level = max(target, level * ENVELOPE_RELEASE)
+        levels.append(round(level))
+    print(f"  envelope: {len(levels)} levels at {fps} per second")
+    return bytes(levels)
+
+
+# ---------------------------------------------------------------------------
+# Band-limited resampling (stdlib only).  Rational ratio up/down, windowed
+# sinc (Blackman) with the cutoff just below the lower of the two Nyquist
+# rates, precomputed as one filter per output phase.
+# ---------------------------------------------------------------------------
+
+RESAMPLE_HALF_TAPS = 32
+
+
+def resample(samples, num_channels, src_rate, dst_rate):
+    """Resample interleaved int16 samples from src_rate to dst_rate."""
+    if src_rate == dst_rate:
+        return samples
+
+    g = math.gcd(src_rate, dst_rate)
+    up, down = dst_rate // g, src_rate // g
+    # Cutoff in cycles per input sample, a little under Nyquist
+    cutoff = 0.5 * min(1.0, dst_rate / src_rate) * 0.94
+    half = RESAMPLE_HALF_TAPS if dst_rate >= src_rate else \
+        int(math.ceil(RESAMPLE_HALF_TAPS * src_rate / dst_rate))
+
+    # filters[p][j] weights input sample (i0 - half + 1 + j) for an output
+    # that sits p/up of a sample past input i0
+    filters = []
+    for p in range(up):
+        frac = p / up
+        taps = []
+        for j in range(2 * half):
+            x = (j - half + 1) - frac
+            sinc = 2 * cutoff if x == 0 else math.sin(2 * math.pi * cutoff * x) / (math.pi * x)
+            w = 0.42 + 0.5 * math.cos(math.pi * x / half) + 0.08 * math.cos(2 * math.pi * x / half)
+            taps.append(sinc * w if abs(x) < half else 0.0)
+        total = sum(taps)
+        filters.append([t / total for t in taps])
+
+    out_channels = []
+    for ch in range(num_channels):
+        src = samples[ch::num_channels]
+        n_out = (len(src) * up) // down
+        padded = [0] * half + src + [0] * half
+        out = []
+        for n in range(n_out):
+            i0, p = divmod(n * down, up)
+            window = padded[i0 + 1 : i0 + 1 + 2 * half]
+            acc = sum(a * b for a, b in zip(window, filters[p]))
+            out.append(max(-32768, min(32767, int(round(acc)))))
+        out_channels.append(out)
+
+    return [s for frame in zip(*out_channels) for s in frame]
+
+
+# ---------------------------------------------------------------------------
+# IMA ADPCM (mono, 4 bits/sample) in fixed 256-byte blocks, matching the
+# decoder in src/ima_adpcm.h.  Each block starts with a 4-byte header --
+# int16 first sample (LE), uint8 step index, uint8 reserved -- followed by
+# 252 bytes of nibbles (low nibble first), i.e. 505 samples per block.
+# Every block is self-contained, so the decoder can start at any block.
+# ---------------------------------------------------------------------------
+
+ADPCM_BLOCK_BYTES = 256
+ADPCM_BLOCK_SAMPLES = 1 + (ADPCM_BLOCK_BYTES - 4) * 2
+
+ADPCM_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+]
+
+ADPCM_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def adpcm_step(predictor, index, nibble):
+    """Apply one nibble exactly as the firmware decoder does."""
+    step = ADPCM_STEP_TABLE[index]
+    diff = step >> 3
+    if nibble & 4:
+        diff += step
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 1:
+        diff += step >> 2
+    predictor = predictor - diff if nibble & 8 else predictor + diff
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + ADPCM_INDEX_TABLE[nibble & 7]))
+    return predictor, index
+
+
+def adpcm_encode_nibble(predictor, index, sample):
+    """Pick the nibble that moves the decoder closest to `sample`."""
+    step = ADPCM_STEP_TABLE[index]
+    delta = sample - predictor
+    nibble = 0
+    if delta < 0:
+        nibble = 8
+        delta = -delta
+    if delta >= step:
+        nibble |= 4
+        delta -= step
+    if delta >= step >> 1:
+        nibble |= 2
+        delta -= step >> 1
+    if delta >= step >> 2:
+        nibble |= 1
+    return nibble
+
+
+def encode_ima_adpcm(samples):
+    """Encode mono int16 samples into IMA ADPCM blocks (bytes)."""
+    out = bytearray()
+    index = 0
+    for start in range(0, len(samples), ADPCM_BLOCK_SAMPLES):
+        block = samples[start : start + ADPCM_BLOCK_SAMPLES]
+        # Header sample is stored exactly; the step index carries over
+        predictor = block[0]
+        out += struct.pack("<hBB", predictor, index, 0)
+
+        body = bytearray(ADPCM_BLOCK_BYTES - 4)
+        for i, sample in enumerate(block[1:]):
+            nibble = adpcm_encode_nibble(predictor, index, sample)
+            predictor, index = adpcm_step(predictor, index, nibble)
+            if i & 1:
+                body[i >> 1] |= nibble << 4
+            else:
+                body[i >> 1] = nibble
+        if len(block) < ADPCM_BLOCK_SAMPLES:
+            # Short final block: stop after its last nibble
+            body = body[: len(block) // 2]
+        out += body
+    return bytes(out)
+
+
+def decode_ima_adpcm(data, num_samples):
+    """Reference decoder, used to report the encoding error."""
+    samples = []
+    pos = 0
+    while len(samples) < num_samples:
+        predictor, index, _ = struct.unpack_from("<hBB", data, pos)
+        samples.append(predictor)
+        count = min(ADPCM_BLOCK_SAMPLES, num_samples - len(samples) + 1) - 1
+        for i in range(count):
+            byte = data[pos + 4 + (i >> 1)]
+            nibble = (byte >> 4) if i & 1 else (byte & 0x0F)
+            predictor, index = adpcm_step(predictor, index, nibble)
+            samples.append(predictor)
+        pos += ADPCM_BLOCK_BYTES
+    return samples
+
+
+def write_loop_constants(f, name, loop):
+    """Loop points for I2SAudio::playLooped(); 0/0 when the clip has none."""
+    start, end = loop if loop else (0, 0)
+    f.write(f"constexpr uint32_t {name}_LOOP_START = {start};\n")
+    f.write(f"constexpr uint32_t {name}_LOOP_END = {end};"
+            f"{'' if loop else '  // no loop'}\n")
+
+
+def write_envelope_header(f, name, envelope):
+    """Envelope declarations, as a ClipEnvelope {LEVELS, COUNT, RATE}."""
+    if not envelope:
+        return
+    levels, fps = envelope
+    f.write(f"extern const uint8_t {name}_ENVELOPE[];\n")
+    f.write(f"constexpr uint32_t {name}_ENVELOPE_COUNT = {len(levels)};\n")
+    f.write(f"constexpr uint32_t {name}_ENVELOPE_RATE = {fps};   // levels per second\n")
+
+
+def write_envelope_source(f, name, envelope):
+    if not envelope:
+        return
+    levels, _ = envelope
+    f.write(f"\nconst uint8_t {name}_ENVELOPE[] = {{\n")
+    for i in range(0, len(levels), 16):
+        f.write("    " + ", ".join(str(v) for v in levels[i : i + 16]) + ",\n")
+    f.write("};\n")
+
+
+def write_cpp_adpcm(samples, sample_rate, name, output_dir, loop=None, envelope=None):
+    """Write .h and .cpp files holding the clip as IMA ADPCM blocks."""
+    os.makedirs(output_dir, exist_ok=True)
+
+    data = encode_ima_adpcm(samples)
+
+    h_path = os.path.join(output_dir, f"{name.lower()}.h")
+    cpp_path = os.path.join(output_dir, f"{name.lower()}.cpp")
+    guard = f"AUDIO_{name}_H"
+
+    # Header
+    with open(h_path, "w", newline="\n") as f:
+        f.write(f"#ifndef {guard}\n")
+        f.write(f"#define {guard}\n\n")
+        f.write("#include <cstdint>\n\n")
+        f.write(f"// Auto-generated by wav2cpp — do not edit\n")
+        f.write(f"// IMA ADPCM, {ADPCM_BLOCK_BYTES}-byte blocks: play with I2SAudio::playAdpcm()\n\n")
+        f.write(f"extern const uint8_t {name}_ADPCM[];\n")
+        f.write(f"constexpr uint32_t {name}_ADPCM_BYTES = {len(data)};\n")
+        f.write(f"constexpr uint32_t {name}_SAMPLE_RATE = {sample_rate};\n")
+        f.write(f"constexpr uint32_t {name}_NUM_SAMPLES = {len(samples)};\n")
+        f.write(f"constexpr uint8_t  {name}_NUM_CHANNELS = 1;\n")
+        write_loop_constants(f, name, loop)
+        write_envelope_header(f, name, envelope)
+        f.write("\n")
+        f.write(f"#endif // {guard}\n")
+
+    # Source
+    with open(cpp_path, "w", newline="\n") as f:
+        f.write(f'#include "{name.lower()}.h"\n\n')
+        f.write(f"// Auto-generated by wav2cpp — do not edit\n")
+        f.write(f"// {len(samples)} samples, {sample_rate} Hz, mono, "
+                f"IMA ADPCM ({len(data)} bytes)\n\n")
+        f.write(f"const uint8_t {name}_ADPCM[] = {{\n")
+
+        # Write 16 bytes per line
+        for i in range(0, len(data), 16):
+            chunk = data[i : i + 16]
+            line = ", ".join(f"0x{b:02x}" for b in chunk)
+            f.write(f"    {line},\n")
+
+        f.write("};\n")
+        write_envelope_source(f, name, envelope)
+
+    return h_path, cpp_path, data
+
+
+def write_cpp(samples, sample_rate, num_channels, name, output_dir, loop=None,
+              envelope=None):
     """Write .h and .cpp files for the audio data."""
     os.makedirs(output_dir, exist_ok=True)
 
@@ -137,7 +627,10 @@ def write_cpp(samples, sample_rate, num_channels, name, output_dir):
         f.write(f"extern const int16_t {name}_SAMPLES[];\n")
         f.write(f"constexpr uint32_t {name}_SAMPLE_RATE = {sample_rate};\n")
         f.write(f"constexpr uint32_t {name}_NUM_SAMPLES = {len(samples)};\n")
-        f.write(f"constexpr uint8_t  {name}_NUM_CHANNELS = {num_channels};\n\n")
+        f.write(f"constexpr uint8_t  {name}_NUM_CHANNELS = {num_channels};\n")
+        write_loop_constants(f, name, loop)
+        write_envelope_header(f, name, envelope)
+        f.write("\n")
         f.write(f"#endif // {guard}\n")
 
     # Source
@@ -155,10 +648,148 @@ def write_cpp(samples, sample_rate, num_channels, name, output_dir):
             f.write(f"    {line},\n")
 
         f.write("};\n")
+        write_envelope_source(f, name, envelope)
 
     return h_path, cpp_path
 
 
+def load_clip(path, stereo=False, adpcm=False, rate=None, loop_arg=None,
+              trim=None, loudness=None, peak=None):
+    """Read, resample, normalize and trim one clip and find its loop, as the
+    command-line options describe it.  Returns (samples, sample_rate,
+    num_channels, loop) with loop None or (start, end) in frames.  Exits on
+    bad input."""
+    if adpcm and stereo:
+        print("Error: --adpcm supports mono clips only.", file=sys.stderr)
+        sys.exit(1)
+    mono = not stereo
+    ext = os.path.splitext(path)[1].lower()
+
+    print(f"Reading: {path}")
+    if ext in COMPRESSED_EXTENSIONS:
+        samples, sample_rate, num_channels = read_compressed(path, mono=mono)
+    elif ext == ".wav":
+        samples, sample_rate, num_channels = read_wav(path, mono=mono)
+    else:
+        print(f"Error: unsupported file format '{ext}'. Use .wav, .ogg, or .mp3.",
+              file=sys.stderr)
+        sys.exit(1)
+    print(f"  {len(samples)} samples, {sample_rate} Hz, "
+          f"{'mono' if num_channels == 1 else 'stereo'}")
+
+    num_frames = len(samples) // num_channels
+    if loop_arg:
+        loop = parse_loop(loop_arg, num_frames, sample_rate)
+    elif ext == ".wav":
+        loop = read_wav_loop(path)
+    else:
+        loop = None
+    if loop and not 0 <= loop[0] < loop[1] <= num_frames:
+        print(f"Error: loop {loop[0]}:{loop[1]} is outside the clip "
+              f"({num_frames} frames).", file=sys.stderr)
+        sys.exit(1)
+
+    if rate and rate != sample_rate:
+        samples = resample(samples, num_channels, sample_rate, rate)
+        print(f"  resampled to {rate} Hz: {len(samples)} samples")
+        if loop:
+            new_frames = len(samples) // num_channels
+            loop = tuple(min(new_frames, round(p * rate / sample_rate)) for p in loop)
+        sample_rate = rate
+
+    if loop:
+        # Snap on the first channel; the whole clip is a loop already joined up
+        if loop != (0, len(samples) // num_channels):
+            first = samples[::num_channels]
+            window = sample_rate * LOOP_SNAP_MS // 1000
+            snapped = (snap_to_zero_crossing(first, loop[0], window) if loop[0] else 0,
+                       snap_to_zero_crossing(first, loop[1], window))
+            if snapped[0] < snapped[1]:
+                loop = snapped
+        print(f"  loop {loop[0]}:{loop[1]} ({(loop[1] - loop[0]) / sample_rate:.3f} s)")
+
+    if loudness is not None or peak is not None:
+        samples = normalize(samples, num_channels, sample_rate, loudness, peak)
+    if trim is not None:
+        samples, loop = trim_silence(samples, num_channels, sample_rate, trim, loop, adpcm)
+
+    return samples, sample_rate, num_channels, loop
+
+
+def report_adpcm_snr(samples, data):
+    """Quality check against the same decoder the firmware uses."""
+    decoded = decode_ima_adpcm(data, len(samples))
+    err = sum((a - b) ** 2 for a, b in zip(samples, decoded))
+    sig = sum(a * a for a in samples)
+    if err and sig:
+        print(f"  ADPCM SNR: {10 * math.log10(sig / err):.1f} dB")
+
+
+def add_clip_options(parser):
+    """Options describing how one clip is converted (shared with audiopack.py)."""
+    parser.add_argument(
+        "--stereo",
+        action="store_true",
+        help="Keep stereo channels (default: mix to mono)",
+    )
+    parser.add_argument(
+        "--adpcm",
+        action="store_true",
+        help="Encode as 4-bit IMA ADPCM blocks (mono only, 4x smaller)",
+    )
+    parser.add_argument(
+        "--rate",
+        type=int,
+        default=None,
+        help="Resample to this rate in Hz, e.g. the I2S output rate 44100 "
+             "(default: keep the source rate)",
+    )
+    parser.add_argument(
+        "--loop",
+        nargs="?",
+        const="all",
+        default=None,
+        metavar="START:END",
+        help="Loop points in source sample frames, or in seconds with an 's' "
+             "suffix (0:4.0625s), END exclusive (no value: the whole clip; "
+             "default: the WAV 'smpl' chunk loop, if any)",
+    )
+    parser.add_argument(
+        "--trim",
+        nargs="?",
+        type=float,
+        const=SILENCE_DBFS,
+        default=None,
+        metavar="DBFS",
+        help=f"Trim leading and trailing silence below DBFS (no value: "
+             f"{SILENCE_DBFS:.0f}), keeping any loop whole",
+    )
+    parser.add_argument(
+        "--loudness",
+        type=float,
+        default=None,
+        metavar="LUFS",
+        help="Normalize to this integrated loudness (ITU-R BS.1770), "
+             "e.g. -16, with the peak kept under --peak",
+    )
+    parser.add_argument(
+        "--peak",
+        type=float,
+        default=None,
+        metavar="DBFS",
+        help=f"Peak ceiling for --loudness (default {PEAK_CEILING_DBFS:.0f}); "
+             f"alone, normalize the peak to DBFS",
+    )
+    parser.add_argument(
+        "--envelope",
+        type=int,
+        default=None,
+        metavar="FPS",
+        help="Also write an amplitude envelope with FPS levels per second "
+             "(the LED frame rate, 50) for audio-synced LEDs",
+    )
+
+
 def main():
     parser = argparse.ArgumentParser(
         description="Convert audio files (WAV, OGG, MP3) to C++ source arrays."
@@ -170,11 +801,7 @@ def main():
         default=None,
         help="Output directory (default: src/audio/ relative to repo root)",
     )
-    parser.add_argument(
-        "--stereo",
-        action="store_true",
-        help="Keep stereo channels (default: mix to mono)",
-    )
+    add_clip_options(parser)
     parser.add_argument(
         "--name",
         default=None,
@@ -196,27 +823,28 @@ def main():
         output_dir = os.path.join(repo_root, "src", "audio")
 
     name = args.name if args.name else sanitize_name(args.input)
-    mono = not args.stereo
-    ext = os.path.splitext(args.input)[1].lower()
-
-    print(f"Reading: {args.input}")
-    if ext in COMPRESSED_EXTENSIONS:
-        samples, sample_rate, num_channels = read_compressed(args.input, mono=mono)
-    elif ext == ".wav":
-        samples, sample_rate, num_channels = read_wav(args.input, mono=mono)
+    samples, sample_rate, num_channels, loop = load_clip(
+        args.input, args.stereo, args.adpcm, args.rate, args.loop,
+        args.trim, args.loudness, args.peak)
+
+    envelope = None
+    if args.envelope:
+        envelope = (compute_envelope(samples, num_channels, sample_rate, args.envelope),
+                    args.envelope)
+
+    if args.adpcm:
+        h_path, cpp_path, data = write_cpp_adpcm(samples, sample_rate, name, output_dir, loop,
+                                                 envelope)
+        size_kb = len(data) / 1024
+        report_adpcm_snr(samples, data)
     else:
-        print(f"Error: unsupported file format '{ext}'. Use .wav, .ogg, or .mp3.",
-              file=sys.stderr)
-        sys.exit(1)
-    print(f"  {len(samples)} samples, {sample_rate} Hz, "
-          f"{'mono' if num_channels == 1 else 'stereo'}")
-
-    h_path, cpp_path = write_cpp(samples, sample_rate, num_channels, name, output_dir)
+        h_path, cpp_path = write_cpp(samples, sample_rate, num_channels, name, output_dir,
+                                     loop, envelope)
+        size_kb = (len(samples) * 2) / 1024
     print(f"Written: {h_path}")
     print(f"Written: {cpp_path}")
 
     # Size estimate
-    size_kb = (len(samples) * 2) / 1024
     print(f"Approx flash usage: {size_kb:.1f} KB")
 
 